@@ -0,0 +1,66 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/execution.h>
+
+#include <functional>
+#include <type_traits>
+
+namespace StdReimpl
+{
+    //
+    // The overloads that take an execution policy. With `execution::par` or `execution::par_unseq` and random access
+    // iterators, the range is split into chunks that the threads of the policy's pool take in turn. Otherwise they call
+    // the sequential algorithm from the standard library.
+    //
+
+    /**
+     * @see https://eel.is/c++draft/alg.foreach
+     * @note A feature from the C++17 standard.
+     */
+    template <class ExecutionPolicy, class ForwardIt, class UnaryFunction>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    void for_each(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, UnaryFunction f);
+
+    /**
+     * @see https://eel.is/c++draft/alg.transform
+     * @note A feature from the C++17 standard.
+     */
+    template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class UnaryOperation>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    ForwardIt2 transform(ExecutionPolicy&& policy, ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 d_first, UnaryOperation unary_op);
+
+    template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class ForwardIt3, class BinaryOperation>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    ForwardIt3 transform(ExecutionPolicy&& policy, ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 first2, ForwardIt3 d_first,
+        BinaryOperation binary_op);
+
+    /**
+     * @brief In parallel, each chunk is sorted with `std::sort`, then neighboring chunks are merged with
+     *        `std::inplace_merge`, half as many at a time each round. The last merge runs on one thread.
+     * @see https://eel.is/c++draft/sort
+     * @note A feature from the C++17 standard.
+     */
+    template <class ExecutionPolicy, class RandomIt>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    void sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last);
+
+    template <class ExecutionPolicy, class RandomIt, class Compare>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    void sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last, Compare comp);
+
+    /**
+     * @brief In parallel, the predicate's results are kept in a buffer of one byte per element while each chunk counts
+     *        its matches, so that the predicate is called exactly once per element. Then each chunk copies its matches
+     *        to where the counts before it say they go.
+     * @see https://eel.is/c++draft/alg.copy
+     * @note A feature from the C++17 standard.
+     */
+    template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class UnaryPredicate>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    ForwardIt2 copy_if(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first, UnaryPredicate pred);
+}
+
+#include <CppUtils/StdReimpl/algorithm.inl>
@@ -0,0 +1,202 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/algorithm.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+
+namespace StdReimpl
+{
+    template <class ExecutionPolicy, class ForwardIt, class UnaryFunction>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    void for_each(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, UnaryFunction f)
+    {
+        if constexpr (Detail::execution_parallel_iterators<ExecutionPolicy, ForwardIt>)
+        {
+            execution::static_thread_pool& pool = policy.get_pool();
+            const std::size_t count = static_cast<std::size_t>(last - first);
+            const std::size_t chunkCount = Detail::execution_chunk_count(pool, count, 1);
+
+            auto body = [&](std::size_t index)
+            {
+                const auto [begin, end] = Detail::execution_chunk(count, chunkCount, index);
+                ForwardIt it = Detail::execution_next(first, begin);
+                for (std::size_t i = begin; i < end; ++i, ++it)
+                {
+                    f(*it);
+                }
+            };
+            Detail::execution_parallel_for(pool, chunkCount, body);
+        }
+        else
+        {
+            std::for_each(first, last, std::move(f));
+        }
+    }
+
+    template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class UnaryOperation>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    ForwardIt2 transform(ExecutionPolicy&& policy, ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 d_first, UnaryOperation unary_op)
+    {
+        if constexpr (Detail::execution_parallel_iterators<ExecutionPolicy, ForwardIt1, ForwardIt2>)
+        {
+            execution::static_thread_pool& pool = policy.get_pool();
+            const std::size_t count = static_cast<std::size_t>(last1 - first1);
+            const std::size_t chunkCount = Detail::execution_chunk_count(pool, count, 1);
+
+            auto body = [&](std::size_t index)
+            {
+                const auto [begin, end] = Detail::execution_chunk(count, chunkCount, index);
+                ForwardIt1 it = Detail::execution_next(first1, begin);
+                ForwardIt2 out = Detail::execution_next(d_first, begin);
+                for (std::size_t i = begin; i < end; ++i, ++it, ++out)
+                {
+                    *out = unary_op(*it);
+                }
+            };
+            Detail::execution_parallel_for(pool, chunkCount, body);
+            return Detail::execution_next(d_first, count);
+        }
+        else
+        {
+            return std::transform(first1, last1, d_first, std::move(unary_op));
+        }
+    }
+
+    template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class ForwardIt3, class BinaryOperation>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    ForwardIt3 transform(ExecutionPolicy&& policy, ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 first2, ForwardIt3 d_first,
+        BinaryOperation binary_op)
+    {
+        if constexpr (Detail::execution_parallel_iterators<ExecutionPolicy, ForwardIt1, ForwardIt2, ForwardIt3>)
+        {
+            execution::static_thread_pool& pool = policy.get_pool();
+            const std::size_t count = static_cast<std::size_t>(last1 - first1);
+            const std::size_t chunkCount = Detail::execution_chunk_count(pool, count, 1);
+
+            auto body = [&](std::size_t index)
+            {
+                const auto [begin, end] = Detail::execution_chunk(count, chunkCount, index);
+                ForwardIt1 it1 = Detail::execution_next(first1, begin);
+                ForwardIt2 it2 = Detail::execution_next(first2, begin);
+                ForwardIt3 out = Detail::execution_next(d_first, begin);
+                for (std::size_t i = begin; i < end; ++i, ++it1, ++it2, ++out)
+                {
+                    *out = binary_op(*it1, *it2);
+                }
+            };
+            Detail::execution_parallel_for(pool, chunkCount, body);
+            return Detail::execution_next(d_first, count);
+        }
+        else
+        {
+            return std::transform(first1, last1, first2, d_first, std::move(binary_op));
+        }
+    }
+
+    template <class ExecutionPolicy, class RandomIt>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    void sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last)
+    {
+        StdReimpl::sort(std::forward<ExecutionPolicy>(policy), first, last, std::less<>());
+    }
+
+    template <class ExecutionPolicy, class RandomIt, class Compare>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    void sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last, Compare comp)
+    {
+        if constexpr (Detail::execution_parallel_iterators<ExecutionPolicy, RandomIt>)
+        {
+            execution::static_thread_pool& pool = policy.get_pool();
+            const std::size_t count = static_cast<std::size_t>(last - first);
+
+            // Small chunks would spend more time merging than sorting.
+            const std::size_t chunkCount = Detail::execution_chunk_count(pool, count, 1024);
+            const auto chunkBegin = [&](std::size_t index) { return Detail::execution_next(first, Detail::execution_chunk(count, chunkCount, index).first); };
+
+            auto sortChunk = [&](std::size_t index)
+            {
+                std::sort(chunkBegin(index), index + 1 < chunkCount ? chunkBegin(index + 1) : last, comp);
+            };
+            Detail::execution_parallel_for(pool, chunkCount, sortChunk);
+
+            // Each round merges pairs of sorted runs of `width` chunks into runs of twice as many.
+            for (std::size_t width = 1; width < chunkCount; width *= 2)
+            {
+                auto mergeRuns = [&](std::size_t index)
+                {
+                    const std::size_t middle = (2 * index + 1) * width;
+                    const std::size_t end = std::min(middle + width, chunkCount);
+                    if (middle < chunkCount)
+                    {
+                        std::inplace_merge(chunkBegin(2 * index * width), chunkBegin(middle), end < chunkCount ? chunkBegin(end) : last, comp);
+                    }
+                };
+                Detail::execution_parallel_for(pool, (chunkCount + 2 * width - 1) / (2 * width), mergeRuns);
+            }
+        }
+        else
+        {
+            std::sort(first, last, std::move(comp));
+        }
+    }
+
+    template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class UnaryPredicate>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    ForwardIt2 copy_if(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first, UnaryPredicate pred)
+    {
+        if constexpr (Detail::execution_parallel_iterators<ExecutionPolicy, ForwardIt1, ForwardIt2>)
+        {
+            execution::static_thread_pool& pool = policy.get_pool();
+            const std::size_t count = static_cast<std::size_t>(last - first);
+            const std::size_t chunkCount = Detail::execution_chunk_count(pool, count, 1);
+            if (chunkCount > 1)
+            {
+                const std::unique_ptr<bool[]> matches = std::make_unique_for_overwrite<bool[]>(count);
+                std::array<std::size_t, Detail::execution_max_chunks> offsets;
+
+                auto countMatches = [&](std::size_t index)
+                {
+                    const auto [begin, end] = Detail::execution_chunk(count, chunkCount, index);
+                    ForwardIt1 it = Detail::execution_next(first, begin);
+                    std::size_t matchCount = 0;
+                    for (std::size_t i = begin; i < end; ++i, ++it)
+                    {
+                        matches[i] = static_cast<bool>(pred(*it));
+                        matchCount += matches[i] ? 1 : 0;
+                    }
+                    offsets[index] = matchCount;
+                };
+                Detail::execution_parallel_for(pool, chunkCount, countMatches);
+
+                std::size_t total = 0;
+                for (std::size_t index = 0; index < chunkCount; ++index)
+                {
+                    total += std::exchange(offsets[index], total);
+                }
+
+                auto copyMatches = [&](std::size_t index)
+                {
+                    const auto [begin, end] = Detail::execution_chunk(count, chunkCount, index);
+                    ForwardIt1 it = Detail::execution_next(first, begin);
+                    ForwardIt2 out = Detail::execution_next(d_first, offsets[index]);
+                    for (std::size_t i = begin; i < end; ++i, ++it)
+                    {
+                        if (matches[i])
+                        {
+                            *out = *it;
+                            ++out;
+                        }
+                    }
+                };
+                Detail::execution_parallel_for(pool, chunkCount, copyMatches);
+                return Detail::execution_next(d_first, total);
+            }
+        }
+        return std::copy_if(first, last, d_first, std::move(pred));
+    }
+}
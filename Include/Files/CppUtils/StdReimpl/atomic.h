@@ -0,0 +1,259 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief How many times a waiting thread checks the value again, with a pause in between, before it parks in the kernel.
+ *        A wake-up that arrives while spinning costs no system call on either side. The default spins for about as long
+ *        as parking and waking take. Threads never spin on a machine with a single hardware thread, where the thread
+ *        they wait for can't run meanwhile. Define it before including this header to change it for the whole build, or
+ *        to 0 to park right away.
+ */
+#ifndef CPPUTILS_STDREIMPL_ATOMIC_WAIT_SPIN_COUNT
+#   define CPPUTILS_STDREIMPL_ATOMIC_WAIT_SPIN_COUNT 64
+#endif
+
+/**
+ * @brief How many times a waiting thread yields its time slice, after spinning and before it parks.
+ */
+#ifndef CPPUTILS_STDREIMPL_ATOMIC_WAIT_YIELD_COUNT
+#   define CPPUTILS_STDREIMPL_ATOMIC_WAIT_YIELD_COUNT 2
+#endif
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        template <class T>
+        concept atomic_integral = std::integral<T> && !std::same_as<std::remove_cv_t<T>, bool>;
+
+        template <class T>
+        concept atomic_floating_point = std::floating_point<T>;
+
+        template <class T>
+        concept atomic_object_pointer = std::is_pointer_v<T> && std::is_object_v<std::remove_pointer_t<T>>;
+
+        /**
+         * @brief The type that the read-modify-write operations of an `atomic_ref<T>` take. Only meaningful for the types
+         *        that have them.
+         */
+        template <class T>
+        using atomic_operand_t = std::conditional_t<atomic_object_pointer<T>, std::ptrdiff_t, T>;
+
+        /**
+         * @brief Gives `atomic_ref<T>` a `difference_type`, only for the types that have one.
+         */
+        template <class T>
+        struct atomic_ref_difference_type
+        {
+        };
+
+        template <class T>
+            requires (atomic_integral<T> || atomic_floating_point<T>)
+        struct atomic_ref_difference_type<T>
+        {
+            using difference_type = T;
+        };
+
+        template <class T>
+            requires atomic_object_pointer<T>
+        struct atomic_ref_difference_type<T>
+        {
+            using difference_type = std::ptrdiff_t;
+        };
+
+        template <class T>
+        T atomic_load(const T* object, std::memory_order order) noexcept;
+
+        template <class T>
+        void atomic_store(T* object, T desired, std::memory_order order) noexcept;
+
+        template <class T>
+        T atomic_exchange(T* object, T desired, std::memory_order order) noexcept;
+
+        template <class T>
+        bool atomic_compare_exchange(T* object, T& expected, T desired, bool weak, std::memory_order success,
+            std::memory_order failure) noexcept;
+
+        template <class T>
+        T atomic_fetch_add(T* object, atomic_operand_t<T> operand, std::memory_order order) noexcept;
+
+        template <class T>
+        T atomic_fetch_sub(T* object, atomic_operand_t<T> operand, std::memory_order order) noexcept;
+
+        template <class T>
+        T atomic_fetch_and(T* object, T operand, std::memory_order order) noexcept;
+
+        template <class T>
+        T atomic_fetch_or(T* object, T operand, std::memory_order order) noexcept;
+
+        template <class T>
+        T atomic_fetch_xor(T* object, T operand, std::memory_order order) noexcept;
+
+        /**
+         * @brief Whether the kernel can wait on an object of type `T` directly, rather than through the version counter of
+         *        its parking slot. True for 4-byte objects on Linux, which is the size `futex(2)` works with.
+         */
+        template <class T>
+        constexpr bool atomic_wait_is_native() noexcept;
+
+        /**
+         * @brief Blocks until `load()` returns something whose bits differ from `old`'s. It spins, then yields, then
+         *        parks the thread on `address`, which the kernel compares with `old` itself when `Native`.
+         */
+        template <bool Native, class T, class Load>
+        void atomic_wait(const void* address, const T& old, Load load) noexcept;
+
+        /**
+         * @brief Like `atomic_wait`, but gives up at `deadline`. Returns whether the value changed.
+         */
+        template <bool Native, class T, class Load, class Clock, class Duration>
+        bool atomic_wait_until(const void* address, const T& old, Load load, const std::chrono::time_point<Clock, Duration>& deadline);
+
+        /**
+         * @brief The first steps of `atomic_wait`: spins, then yields, until `done()` returns true. Returns false if it
+         *        still doesn't, in which case the caller should park. Lets a waiter spin on its own condition, e.g., that a
+         *        count is positive rather than that it changed.
+         */
+        template <class Done>
+        bool atomic_spin(Done done) noexcept;
+
+        /**
+         * @brief The last step of `atomic_wait`: parks the thread on `address` once, unless `changed()` already returns
+         *        true, for at most `timeout` if it isn't null. It may return spuriously.
+         */
+        template <bool Native, class T, class Changed>
+        void atomic_park(const void* address, const T& old, Changed changed, const std::chrono::nanoseconds* timeout) noexcept;
+
+        /**
+         * @brief Wakes threads parked on `address`. It's a single load, with no system call, when none are.
+         */
+        template <bool Native>
+        void atomic_notify(const void* address, bool all) noexcept;
+    }
+
+    /**
+     * @brief Applies atomic operations to an object that isn't itself an `atomic`, e.g., an element of a plain array that
+     *        is only shared between threads in some phases of a computation.
+     *
+     *        `wait()` spins for a bounded time and then parks the thread, with `futex(2)` on Linux and a hashed table of
+     *        condition variables elsewhere, and `notify_one()`/`notify_all()` skip the system call when nothing waits.
+     * @see https://eel.is/c++draft/atomics.ref.generic
+     * @see https://cppreference.com/w/cpp/atomic/atomic_ref
+     * @note A feature from the C++20 standard.
+     */
+    template <class T>
+    class atomic_ref : public Detail::atomic_ref_difference_type<T>
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "atomic_ref requires a trivially copyable type.");
+
+    public:
+        using value_type = T;
+
+        static constexpr std::size_t required_alignment =
+            (sizeof(T) & (sizeof(T) - 1)) == 0 && sizeof(T) <= 16 && sizeof(T) > alignof(T) ? sizeof(T) : alignof(T);
+
+        static constexpr bool is_always_lock_free =
+#if defined(__GNUC__) || defined(__clang__)
+            __atomic_always_lock_free(sizeof(T), 0);
+#else
+            std::atomic_ref<T>::is_always_lock_free;
+#endif
+
+        explicit atomic_ref(T& obj);
+        atomic_ref(const atomic_ref& other) noexcept = default;
+
+        atomic_ref& operator=(const atomic_ref&) = delete;
+
+        T operator=(T desired) const noexcept;
+        operator T() const noexcept;
+
+        bool is_lock_free() const noexcept;
+
+        void store(T desired, std::memory_order order = std::memory_order_seq_cst) const noexcept;
+        T load(std::memory_order order = std::memory_order_seq_cst) const noexcept;
+        T exchange(T desired, std::memory_order order = std::memory_order_seq_cst) const noexcept;
+
+        bool compare_exchange_weak(T& expected, T desired, std::memory_order success, std::memory_order failure) const noexcept;
+        bool compare_exchange_weak(T& expected, T desired, std::memory_order order = std::memory_order_seq_cst) const noexcept;
+        bool compare_exchange_strong(T& expected, T desired, std::memory_order success, std::memory_order failure) const noexcept;
+        bool compare_exchange_strong(T& expected, T desired, std::memory_order order = std::memory_order_seq_cst) const noexcept;
+
+        T fetch_add(Detail::atomic_operand_t<T> operand, std::memory_order order = std::memory_order_seq_cst) const noexcept
+            requires (Detail::atomic_integral<T> || Detail::atomic_floating_point<T> || Detail::atomic_object_pointer<T>);
+        T fetch_sub(Detail::atomic_operand_t<T> operand, std::memory_order order = std::memory_order_seq_cst) const noexcept
+            requires (Detail::atomic_integral<T> || Detail::atomic_floating_point<T> || Detail::atomic_object_pointer<T>);
+
+        T fetch_and(T operand, std::memory_order order = std::memory_order_seq_cst) const noexcept
+            requires Detail::atomic_integral<T>;
+        T fetch_or(T operand, std::memory_order order = std::memory_order_seq_cst) const noexcept
+            requires Detail::atomic_integral<T>;
+        T fetch_xor(T operand, std::memory_order order = std::memory_order_seq_cst) const noexcept
+            requires Detail::atomic_integral<T>;
+
+        T operator++(int) const noexcept
+            requires (Detail::atomic_integral<T> || Detail::atomic_object_pointer<T>);
+        T operator--(int) const noexcept
+            requires (Detail::atomic_integral<T> || Detail::atomic_object_pointer<T>);
+        T operator++() const noexcept
+            requires (Detail::atomic_integral<T> || Detail::atomic_object_pointer<T>);
+        T operator--() const noexcept
+            requires (Detail::atomic_integral<T> || Detail::atomic_object_pointer<T>);
+
+        T operator+=(Detail::atomic_operand_t<T> operand) const noexcept
+            requires (Detail::atomic_integral<T> || Detail::atomic_floating_point<T> || Detail::atomic_object_pointer<T>);
+        T operator-=(Detail::atomic_operand_t<T> operand) const noexcept
+            requires (Detail::atomic_integral<T> || Detail::atomic_floating_point<T> || Detail::atomic_object_pointer<T>);
+        T operator&=(T operand) const noexcept
+            requires Detail::atomic_integral<T>;
+        T operator|=(T operand) const noexcept
+            requires Detail::atomic_integral<T>;
+        T operator^=(T operand) const noexcept
+            requires Detail::atomic_integral<T>;
+
+        void wait(T old, std::memory_order order = std::memory_order_seq_cst) const noexcept;
+        void notify_one() const noexcept;
+        void notify_all() const noexcept;
+
+    private:
+        T* ptr;
+    };
+
+    /**
+     * @brief Blocks until the value of `object` is no longer `old`, like `std::atomic::wait`, but with the bounded
+     *        spin-then-park policy of `atomic_ref::wait` rather than whatever the standard library does.
+     * @see https://eel.is/c++draft/atomics.wait
+     * @see https://cppreference.com/w/cpp/atomic/atomic_wait
+     * @note A feature from the C++20 standard.
+     */
+    template <class T>
+    void atomic_wait(const std::atomic<T>* object, typename std::atomic<T>::value_type old) noexcept;
+
+    template <class T>
+    void atomic_wait_explicit(const std::atomic<T>* object, typename std::atomic<T>::value_type old, std::memory_order order) noexcept;
+
+    /**
+     * @brief Wakes one thread blocked in `atomic_wait` on `object`.
+     * @note Must be paired with this library's `atomic_wait`, not with `std::atomic::wait`.
+     */
+    template <class T>
+    void atomic_notify_one(std::atomic<T>* object) noexcept;
+
+    /**
+     * @brief Wakes every thread blocked in `atomic_wait` on `object`.
+     * @note Must be paired with this library's `atomic_wait`, not with `std::atomic::wait`.
+     */
+    template <class T>
+    void atomic_notify_all(std::atomic<T>* object) noexcept;
+}
+
+#include <CppUtils/StdReimpl/atomic.inl>
@@ -0,0 +1,678 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/atomic.h>
+
+#include <bit>
+#include <cassert>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+#if defined(__linux__)
+#   include <linux/futex.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#   define CPPUTILS_STDREIMPL_ATOMIC_USE_FUTEX 1
+#else
+#   include <condition_variable>
+#   include <mutex>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#   include <immintrin.h>
+#elif defined(_M_ARM64)
+#   include <intrin.h>
+#endif
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        constexpr int atomic_builtin_order(std::memory_order order) noexcept
+        {
+            switch (order)
+            {
+            case std::memory_order_relaxed:
+                return __ATOMIC_RELAXED;
+            case std::memory_order_consume:
+                return __ATOMIC_CONSUME;
+            case std::memory_order_acquire:
+                return __ATOMIC_ACQUIRE;
+            case std::memory_order_release:
+                return __ATOMIC_RELEASE;
+            case std::memory_order_acq_rel:
+                return __ATOMIC_ACQ_REL;
+            default:
+                return __ATOMIC_SEQ_CST;
+            }
+        }
+
+        /**
+         * @brief Storage for a value that the atomic builtins write into, since `T` needn't be default constructible.
+         */
+        template <class T>
+        union atomic_value
+        {
+            atomic_value() noexcept
+            {
+            }
+
+            T value;
+        };
+#endif
+
+        template <class T>
+        T atomic_load(const T* object, std::memory_order order) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            atomic_value<T> result;
+            __atomic_load(object, &result.value, Detail::atomic_builtin_order(order));
+            return result.value;
+#else
+            return std::atomic_ref<T>(*const_cast<T*>(object)).load(order);
+#endif
+        }
+
+        template <class T>
+        void atomic_store(T* object, T desired, std::memory_order order) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __atomic_store(object, &desired, Detail::atomic_builtin_order(order));
+#else
+            std::atomic_ref<T>(*object).store(desired, order);
+#endif
+        }
+
+        template <class T>
+        T atomic_exchange(T* object, T desired, std::memory_order order) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            atomic_value<T> result;
+            __atomic_exchange(object, &desired, &result.value, Detail::atomic_builtin_order(order));
+            return result.value;
+#else
+            return std::atomic_ref<T>(*object).exchange(desired, order);
+#endif
+        }
+
+        template <class T>
+        bool atomic_compare_exchange(T* object, T& expected, T desired, bool weak, std::memory_order success,
+            std::memory_order failure) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __atomic_compare_exchange(object, &expected, &desired, weak, Detail::atomic_builtin_order(success),
+                Detail::atomic_builtin_order(failure));
+#else
+            return weak ?
+                std::atomic_ref<T>(*object).compare_exchange_weak(expected, desired, success, failure) :
+                std::atomic_ref<T>(*object).compare_exchange_strong(expected, desired, success, failure);
+#endif
+        }
+
+        /**
+         * @brief The order of the load that a failed compare-and-swap does, for the overloads that take a single order.
+         */
+        constexpr std::memory_order atomic_failure_order(std::memory_order order) noexcept
+        {
+            switch (order)
+            {
+            case std::memory_order_acq_rel:
+                return std::memory_order_acquire;
+            case std::memory_order_release:
+                return std::memory_order_relaxed;
+            default:
+                return order;
+            }
+        }
+
+        /**
+         * @brief Applies `operation` to the value of `object` with a compare-and-swap loop, for the operations that have
+         *        no instruction of their own (e.g., adding floating-point numbers).
+         */
+        template <class T, class Operation>
+        T atomic_fetch_update(T* object, std::memory_order order, Operation operation) noexcept
+        {
+            T expected = Detail::atomic_load(object, std::memory_order_relaxed);
+            while (!Detail::atomic_compare_exchange(object, expected, operation(expected), true, order, std::memory_order_relaxed))
+            {
+            }
+            return expected;
+        }
+
+        template <class T>
+        T atomic_fetch_add(T* object, atomic_operand_t<T> operand, std::memory_order order) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            if constexpr (atomic_floating_point<T>)
+            {
+                return Detail::atomic_fetch_update(object, order, [operand](T value) { return value + operand; });
+            }
+            else if constexpr (atomic_object_pointer<T>)
+            {
+                // The builtins don't scale by the size of the pointee.
+                return __atomic_fetch_add(object, operand * static_cast<std::ptrdiff_t>(sizeof(std::remove_pointer_t<T>)),
+                    Detail::atomic_builtin_order(order));
+            }
+            else
+            {
+                return __atomic_fetch_add(object, operand, Detail::atomic_builtin_order(order));
+            }
+#else
+            return std::atomic_ref<T>(*object).fetch_add(operand, order);
+#endif
+        }
+
+        template <class T>
+        T atomic_fetch_sub(T* object, atomic_operand_t<T> operand, std::memory_order order) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            if constexpr (atomic_floating_point<T>)
+            {
+                return Detail::atomic_fetch_update(object, order, [operand](T value) { return value - operand; });
+            }
+            else if constexpr (atomic_object_pointer<T>)
+            {
+                return __atomic_fetch_sub(object, operand * static_cast<std::ptrdiff_t>(sizeof(std::remove_pointer_t<T>)),
+                    Detail::atomic_builtin_order(order));
+            }
+            else
+            {
+                return __atomic_fetch_sub(object, operand, Detail::atomic_builtin_order(order));
+            }
+#else
+            return std::atomic_ref<T>(*object).fetch_sub(operand, order);
+#endif
+        }
+
+        template <class T>
+        T atomic_fetch_and(T* object, T operand, std::memory_order order) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __atomic_fetch_and(object, operand, Detail::atomic_builtin_order(order));
+#else
+            return std::atomic_ref<T>(*object).fetch_and(operand, order);
+#endif
+        }
+
+        template <class T>
+        T atomic_fetch_or(T* object, T operand, std::memory_order order) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __atomic_fetch_or(object, operand, Detail::atomic_builtin_order(order));
+#else
+            return std::atomic_ref<T>(*object).fetch_or(operand, order);
+#endif
+        }
+
+        template <class T>
+        T atomic_fetch_xor(T* object, T operand, std::memory_order order) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __atomic_fetch_xor(object, operand, Detail::atomic_builtin_order(order));
+#else
+            return std::atomic_ref<T>(*object).fetch_xor(operand, order);
+#endif
+        }
+
+        /**
+         * @brief Where threads park while they wait on an address. Addresses are hashed into a fixed table of these, so
+         *        waiting never allocates. The waiter count lets `atomic_notify` skip the system call when nothing is
+         *        parked on any address in the slot.
+         */
+        struct alignas(64) atomic_wait_slot
+        {
+            std::atomic<std::uint32_t> waiters{0};
+
+#if defined(CPPUTILS_STDREIMPL_ATOMIC_USE_FUTEX)
+            // Bumped on every notification, for the kernel to wait on when the waited-on object isn't 4 bytes.
+            std::atomic<std::uint32_t> version{0};
+#else
+            std::mutex mutex;
+            std::condition_variable condition;
+#endif
+        };
+
+        inline constexpr std::size_t atomic_wait_slot_count = 256;
+
+        inline atomic_wait_slot& atomic_wait_slot_for(const void* address) noexcept
+        {
+            static atomic_wait_slot slots[atomic_wait_slot_count];
+
+            // Fibonacci hashing, so that neighboring objects land in different slots.
+            const std::uint64_t hash = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(address) >> 2) * 0x9E3779B97F4A7C15ull;
+            return slots[hash >> (64 - std::countr_zero(atomic_wait_slot_count))];
+        }
+
+        inline void atomic_pause() noexcept
+        {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+            _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+            asm volatile("yield" ::: "memory");
+#elif defined(_M_ARM64)
+            __yield();
+#endif
+        }
+
+        /**
+         * @brief Whether spinning can pay off, which it can't when the thread being waited for has no other hardware
+         *        thread to run on.
+         */
+        inline bool atomic_wait_can_spin() noexcept
+        {
+            static const bool canSpin = std::thread::hardware_concurrency() != 1;
+            return canSpin;
+        }
+
+#if defined(CPPUTILS_STDREIMPL_ATOMIC_USE_FUTEX)
+        inline void atomic_futex_wait(const void* address, std::uint32_t expected, const std::chrono::nanoseconds* timeout) noexcept
+        {
+            timespec relative{};
+            if (timeout != nullptr)
+            {
+                relative.tv_sec = static_cast<time_t>(timeout->count() / 1000000000);
+                relative.tv_nsec = static_cast<long>(timeout->count() % 1000000000);
+            }
+
+            // Returns right away if the value at `address` isn't `expected` anymore, so a wake-up can't be missed.
+            syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, expected, timeout != nullptr ? &relative : nullptr, nullptr, 0);
+        }
+
+        inline void atomic_futex_wake(const void* address, int count) noexcept
+        {
+            syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+        }
+#endif
+
+        template <class T>
+        constexpr bool atomic_wait_is_native() noexcept
+        {
+#if defined(CPPUTILS_STDREIMPL_ATOMIC_USE_FUTEX)
+            return sizeof(T) == sizeof(std::uint32_t);
+#else
+            return false;
+#endif
+        }
+
+        template <class Done>
+        bool atomic_spin(Done done) noexcept
+        {
+            const int spinCount = Detail::atomic_wait_can_spin() ? CPPUTILS_STDREIMPL_ATOMIC_WAIT_SPIN_COUNT : 0;
+            for (int i = 0; i < spinCount; ++i)
+            {
+                if (done())
+                {
+                    return true;
+                }
+                Detail::atomic_pause();
+            }
+
+            for (int i = 0; i < CPPUTILS_STDREIMPL_ATOMIC_WAIT_YIELD_COUNT; ++i)
+            {
+                if (done())
+                {
+                    return true;
+                }
+                std::this_thread::yield();
+            }
+
+            return done();
+        }
+
+        template <bool Native, class T, class Changed>
+        void atomic_park(const void* address, const T& old, Changed changed, const std::chrono::nanoseconds* timeout) noexcept
+        {
+            atomic_wait_slot& slot = Detail::atomic_wait_slot_for(address);
+
+            // Announce the waiter before checking the value again. `atomic_notify` does the opposite, so that either it sees
+            // this waiter or this waiter sees the new value.
+            slot.waiters.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+#if defined(CPPUTILS_STDREIMPL_ATOMIC_USE_FUTEX)
+            if constexpr (Native)
+            {
+                if (!changed())
+                {
+                    Detail::atomic_futex_wait(address, std::bit_cast<std::uint32_t>(old), timeout);
+                }
+            }
+            else
+            {
+                const std::uint32_t version = slot.version.load(std::memory_order_seq_cst);
+                if (!changed())
+                {
+                    Detail::atomic_futex_wait(&slot.version, version, timeout);
+                }
+            }
+#else
+            static_cast<void>(old);
+            {
+                std::unique_lock<std::mutex> lock(slot.mutex);
+                if (timeout != nullptr)
+                {
+                    slot.condition.wait_for(lock, *timeout, changed);
+                }
+                else
+                {
+                    slot.condition.wait(lock, changed);
+                }
+            }
+#endif
+
+            slot.waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        template <class T, class Load>
+        auto atomic_changed(const T& old, Load& load) noexcept
+        {
+            // Values are compared by their bits, like the standard's `wait`, rather than with `operator==`.
+            return [&old, &load]()
+            {
+                const T current = load();
+                return std::memcmp(&current, &old, sizeof(T)) != 0;
+            };
+        }
+
+        template <bool Native, class T, class Load>
+        void atomic_wait(const void* address, const T& old, Load load) noexcept
+        {
+            const auto changed = Detail::atomic_changed(old, load);
+            if (Detail::atomic_spin(changed))
+            {
+                return;
+            }
+
+            do
+            {
+                Detail::atomic_park<Native>(address, old, changed, nullptr);
+            }
+            while (!changed());
+        }
+
+        template <bool Native, class T, class Load, class Clock, class Duration>
+        bool atomic_wait_until(const void* address, const T& old, Load load, const std::chrono::time_point<Clock, Duration>& deadline)
+        {
+            const auto changed = Detail::atomic_changed(old, load);
+            if (Detail::atomic_spin(changed))
+            {
+                return true;
+            }
+
+            do
+            {
+                // Waits for a relative time, and checks the clock again after each wake-up, since `Clock` needn't be
+                // steady.
+                const auto now = Clock::now();
+                if (now >= deadline)
+                {
+                    return false;
+                }
+                const auto timeout = std::chrono::ceil<std::chrono::nanoseconds>(deadline - now);
+                Detail::atomic_park<Native>(address, old, changed, &timeout);
+            }
+            while (!changed());
+
+            return true;
+        }
+
+        template <bool Native>
+        void atomic_notify(const void* address, bool all) noexcept
+        {
+            atomic_wait_slot& slot = Detail::atomic_wait_slot_for(address);
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (slot.waiters.load(std::memory_order_relaxed) == 0)
+            {
+                return;
+            }
+
+#if defined(CPPUTILS_STDREIMPL_ATOMIC_USE_FUTEX)
+            if constexpr (Native)
+            {
+                Detail::atomic_futex_wake(address, all ? INT_MAX : 1);
+            }
+            else
+            {
+                // Other addresses may share the version, so everyone on it has to check their value again.
+                slot.version.fetch_add(1, std::memory_order_seq_cst);
+                Detail::atomic_futex_wake(&slot.version, INT_MAX);
+            }
+#else
+            static_cast<void>(all);
+            {
+                // A waiter that has checked its value is either waiting on the condition or yet to lock the mutex.
+                const std::lock_guard<std::mutex> lock(slot.mutex);
+            }
+            slot.condition.notify_all();
+#endif
+        }
+    }
+
+    template <class T>
+    atomic_ref<T>::atomic_ref(T& obj)
+        : ptr(std::addressof(obj))
+    {
+        assert(reinterpret_cast<std::uintptr_t>(ptr) % required_alignment == 0);
+    }
+
+    template <class T>
+    T atomic_ref<T>::operator=(T desired) const noexcept
+    {
+        store(desired);
+        return desired;
+    }
+
+    template <class T>
+    atomic_ref<T>::operator T() const noexcept
+    {
+        return load();
+    }
+
+    template <class T>
+    bool atomic_ref<T>::is_lock_free() const noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __atomic_is_lock_free(sizeof(T), ptr);
+#else
+        return std::atomic_ref<T>(*ptr).is_lock_free();
+#endif
+    }
+
+    template <class T>
+    void atomic_ref<T>::store(T desired, std::memory_order order) const noexcept
+    {
+        Detail::atomic_store(ptr, desired, order);
+    }
+
+    template <class T>
+    T atomic_ref<T>::load(std::memory_order order) const noexcept
+    {
+        return Detail::atomic_load(ptr, order);
+    }
+
+    template <class T>
+    T atomic_ref<T>::exchange(T desired, std::memory_order order) const noexcept
+    {
+        return Detail::atomic_exchange(ptr, desired, order);
+    }
+
+    template <class T>
+    bool atomic_ref<T>::compare_exchange_weak(T& expected, T desired, std::memory_order success, std::memory_order failure) const noexcept
+    {
+        return Detail::atomic_compare_exchange(ptr, expected, desired, true, success, failure);
+    }
+
+    template <class T>
+    bool atomic_ref<T>::compare_exchange_weak(T& expected, T desired, std::memory_order order) const noexcept
+    {
+        return Detail::atomic_compare_exchange(ptr, expected, desired, true, order, Detail::atomic_failure_order(order));
+    }
+
+    template <class T>
+    bool atomic_ref<T>::compare_exchange_strong(T& expected, T desired, std::memory_order success, std::memory_order failure) const noexcept
+    {
+        return Detail::atomic_compare_exchange(ptr, expected, desired, false, success, failure);
+    }
+
+    template <class T>
+    bool atomic_ref<T>::compare_exchange_strong(T& expected, T desired, std::memory_order order) const noexcept
+    {
+        return Detail::atomic_compare_exchange(ptr, expected, desired, false, order, Detail::atomic_failure_order(order));
+    }
+
+    template <class T>
+    T atomic_ref<T>::fetch_add(Detail::atomic_operand_t<T> operand, std::memory_order order) const noexcept
+        requires (Detail::atomic_integral<T> || Detail::atomic_floating_point<T> || Detail::atomic_object_pointer<T>)
+    {
+        return Detail::atomic_fetch_add(ptr, operand, order);
+    }
+
+    template <class T>
+    T atomic_ref<T>::fetch_sub(Detail::atomic_operand_t<T> operand, std::memory_order order) const noexcept
+        requires (Detail::atomic_integral<T> || Detail::atomic_floating_point<T> || Detail::atomic_object_pointer<T>)
+    {
+        return Detail::atomic_fetch_sub(ptr, operand, order);
+    }
+
+    template <class T>
+    T atomic_ref<T>::fetch_and(T operand, std::memory_order order) const noexcept
+        requires Detail::atomic_integral<T>
+    {
+        return Detail::atomic_fetch_and(ptr, operand, order);
+    }
+
+    template <class T>
+    T atomic_ref<T>::fetch_or(T operand, std::memory_order order) const noexcept
+        requires Detail::atomic_integral<T>
+    {
+        return Detail::atomic_fetch_or(ptr, operand, order);
+    }
+
+    template <class T>
+    T atomic_ref<T>::fetch_xor(T operand, std::memory_order order) const noexcept
+        requires Detail::atomic_integral<T>
+    {
+        return Detail::atomic_fetch_xor(ptr, operand, order);
+    }
+
+    template <class T>
+    T atomic_ref<T>::operator++(int) const noexcept
+        requires (Detail::atomic_integral<T> || Detail::atomic_object_pointer<T>)
+    {
+        return fetch_add(1);
+    }
+
+    template <class T>
+    T atomic_ref<T>::operator--(int) const noexcept
+        requires (Detail::atomic_integral<T> || Detail::atomic_object_pointer<T>)
+    {
+        return fetch_sub(1);
+    }
+
+    template <class T>
+    T atomic_ref<T>::operator++() const noexcept
+        requires (Detail::atomic_integral<T> || Detail::atomic_object_pointer<T>)
+    {
+        return fetch_add(1) + 1;
+    }
+
+    template <class T>
+    T atomic_ref<T>::operator--() const noexcept
+        requires (Detail::atomic_integral<T> || Detail::atomic_object_pointer<T>)
+    {
+        return fetch_sub(1) - 1;
+    }
+
+    template <class T>
+    T atomic_ref<T>::operator+=(Detail::atomic_operand_t<T> operand) const noexcept
+        requires (Detail::atomic_integral<T> || Detail::atomic_floating_point<T> || Detail::atomic_object_pointer<T>)
+    {
+        return fetch_add(operand) + operand;
+    }
+
+    template <class T>
+    T atomic_ref<T>::operator-=(Detail::atomic_operand_t<T> operand) const noexcept
+        requires (Detail::atomic_integral<T> || Detail::atomic_floating_point<T> || Detail::atomic_object_pointer<T>)
+    {
+        return fetch_sub(operand) - operand;
+    }
+
+    template <class T>
+    T atomic_ref<T>::operator&=(T operand) const noexcept
+        requires Detail::atomic_integral<T>
+    {
+        return fetch_and(operand) & operand;
+    }
+
+    template <class T>
+    T atomic_ref<T>::operator|=(T operand) const noexcept
+        requires Detail::atomic_integral<T>
+    {
+        return fetch_or(operand) | operand;
+    }
+
+    template <class T>
+    T atomic_ref<T>::operator^=(T operand) const noexcept
+        requires Detail::atomic_integral<T>
+    {
+        return fetch_xor(operand) ^ operand;
+    }
+
+    template <class T>
+    void atomic_ref<T>::wait(T old, std::memory_order order) const noexcept
+    {
+        Detail::atomic_wait<Detail::atomic_wait_is_native<T>()>(ptr, old, [this, order]() { return load(order); });
+    }
+
+    template <class T>
+    void atomic_ref<T>::notify_one() const noexcept
+    {
+        Detail::atomic_notify<Detail::atomic_wait_is_native<T>()>(ptr, false);
+    }
+
+    template <class T>
+    void atomic_ref<T>::notify_all() const noexcept
+    {
+        Detail::atomic_notify<Detail::atomic_wait_is_native<T>()>(ptr, true);
+    }
+
+    namespace Detail
+    {
+        /**
+         * @brief Whether the kernel can wait on a `std::atomic<T>` directly, which also needs it to be laid out as just a
+         *        `T`.
+         */
+        template <class T>
+        constexpr bool atomic_wait_is_native_for_atomic = Detail::atomic_wait_is_native<T>() && sizeof(std::atomic<T>) == sizeof(T);
+    }
+
+    template <class T>
+    void atomic_wait(const std::atomic<T>* object, typename std::atomic<T>::value_type old) noexcept
+    {
+        StdReimpl::atomic_wait_explicit(object, old, std::memory_order_seq_cst);
+    }
+
+    template <class T>
+    void atomic_wait_explicit(const std::atomic<T>* object, typename std::atomic<T>::value_type old, std::memory_order order) noexcept
+    {
+        Detail::atomic_wait<Detail::atomic_wait_is_native_for_atomic<T>>(object, old, [object, order]() { return object->load(order); });
+    }
+
+    template <class T>
+    void atomic_notify_one(std::atomic<T>* object) noexcept
+    {
+        Detail::atomic_notify<Detail::atomic_wait_is_native_for_atomic<T>>(object, false);
+    }
+
+    template <class T>
+    void atomic_notify_all(std::atomic<T>* object) noexcept
+    {
+        Detail::atomic_notify<Detail::atomic_wait_is_native_for_atomic<T>>(object, true);
+    }
+}
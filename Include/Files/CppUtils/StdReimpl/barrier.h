@@ -0,0 +1,133 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/atomic.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        /**
+         * @brief The completion step of a `barrier` that doesn't need one.
+         */
+        struct barrier_empty_completion
+        {
+            void operator()() const noexcept
+            {
+            }
+        };
+
+        /**
+         * @brief How many arrivals a node of a barrier's combining tree counts before it passes one on to its parent. Few
+         *        enough that a node's cache line doesn't bounce between many threads, and enough that the tree stays
+         *        shallow: 64 threads arrive through three levels.
+         */
+        inline constexpr std::uint32_t barrier_fan_in = 4;
+
+        /**
+         * @brief A node of a barrier's combining tree, on its own cache line. It counts arrivals in one of two counters,
+         *        by the parity of the phase, so that the one for the next phase can be cleared while this one is in use.
+         */
+        struct alignas(64) barrier_node
+        {
+            std::atomic<std::uint32_t> arrivals[2] = {0, 0};
+            std::uint32_t expected = 0;
+            std::uint32_t parent = 0;
+        };
+
+        /**
+         * @brief Spreads the calling thread over the leaves of a barrier's tree. Computed once per thread.
+         */
+        std::size_t barrier_thread_hash() noexcept;
+    }
+
+    /**
+     * @brief A reusable rendezvous for a set of threads, which runs a completion step once they have all arrived in the
+     *        current phase, and then starts the next phase.
+     *
+     *        Arrivals are counted in a combining tree rather than in a single counter that every thread contends on: each
+     *        thread counts itself at a leaf that it hashes to, and the last one to arrive at a node carries the arrival up
+     *        to its parent. The thread that fills the root runs the completion step right away, on its own stack, and then
+     *        wakes the others by advancing a phase word that they wait on through the same spin-then-park layer as
+     *        `atomic_ref::wait`; no thread is woken just to run the completion step.
+     * @note Unlike the standard's, the constructor isn't `constexpr`, since it allocates the tree.
+     * @see https://eel.is/c++draft/thread.barrier
+     * @see https://cppreference.com/w/cpp/thread/barrier
+     * @note A feature from the C++20 standard.
+     */
+    template <class CompletionFunction = Detail::barrier_empty_completion>
+    class barrier
+    {
+        static_assert(std::is_nothrow_invocable_v<CompletionFunction&>, "barrier requires a completion function that can be invoked without arguments and doesn't throw.");
+
+    public:
+        /**
+         * @brief The phase that a thread arrived in, to wait for the end of.
+         */
+        class arrival_token
+        {
+        public:
+            arrival_token(arrival_token&&) noexcept = default;
+            arrival_token& operator=(arrival_token&&) noexcept = default;
+
+        private:
+            friend class barrier;
+
+            explicit arrival_token(std::uint32_t inPhase) noexcept;
+
+            std::uint32_t phase;
+        };
+
+        static constexpr std::ptrdiff_t max() noexcept;
+
+        explicit barrier(std::ptrdiff_t expected, CompletionFunction f = CompletionFunction());
+        ~barrier() = default;
+
+        barrier(const barrier&) = delete;
+        barrier& operator=(const barrier&) = delete;
+
+        [[nodiscard]] arrival_token arrive(std::ptrdiff_t update = 1);
+        void wait(arrival_token&& arrival) const;
+        void arrive_and_wait();
+        void arrive_and_drop();
+
+    private:
+        static constexpr std::uint32_t NoParent = ~std::uint32_t{0};
+
+        /**
+         * @brief Spreads `count` expected arrivals over the leaves, and gives every other node one for each child that
+         *        expects any.
+         */
+        void SetExpected(std::uint32_t count) noexcept;
+
+        /**
+         * @brief Counts one arrival at a leaf with room left in `arrivalPhase`, which it reloads if the phase turns out to
+         *        have ended already.
+         */
+        void ArriveAtLeaf(std::uint32_t& arrivalPhase) noexcept;
+
+        /**
+         * @brief Carries the arrival that filled `index` up the tree, and ends the phase if it fills the root.
+         */
+        void Propagate(std::uint32_t index, std::uint32_t arrivalPhase) noexcept;
+
+        void CompletePhase(std::uint32_t arrivalPhase) noexcept;
+
+        std::vector<Detail::barrier_node> nodes;
+        std::uint32_t leafCount;
+        std::uint32_t expectedCount;
+        CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS CompletionFunction completion;
+        std::atomic<std::uint32_t> dropped;
+        alignas(64) std::atomic<std::uint32_t> phase;
+    };
+}
+
+#include <CppUtils/StdReimpl/barrier.inl>
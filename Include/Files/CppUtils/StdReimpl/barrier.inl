@@ -0,0 +1,216 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/barrier.h>
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <limits>
+#include <thread>
+#include <utility>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        inline std::size_t barrier_thread_hash() noexcept
+        {
+            // `std::hash<std::thread::id>` is often just an address, whose low bits are all the same.
+            thread_local const std::size_t hash = static_cast<std::size_t>(
+                (static_cast<std::uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) * 0x9E3779B97F4A7C15ull) >> 32);
+            return hash;
+        }
+
+        inline constexpr bool barrier_wait_is_native = Detail::atomic_wait_is_native_for_atomic<std::uint32_t>;
+    }
+
+    template <class CompletionFunction>
+    barrier<CompletionFunction>::arrival_token::arrival_token(std::uint32_t inPhase) noexcept
+        : phase(inPhase)
+    {
+    }
+
+    template <class CompletionFunction>
+    constexpr std::ptrdiff_t barrier<CompletionFunction>::max() noexcept
+    {
+        return std::numeric_limits<std::int32_t>::max();
+    }
+
+    template <class CompletionFunction>
+    barrier<CompletionFunction>::barrier(std::ptrdiff_t expected, CompletionFunction f)
+        : leafCount(std::max<std::uint32_t>(1, static_cast<std::uint32_t>((expected + Detail::barrier_fan_in - 1) / Detail::barrier_fan_in))),
+          expectedCount(static_cast<std::uint32_t>(expected)), completion(std::move(f)), dropped(0), phase(0)
+    {
+        assert(expected >= 0 && expected <= max());
+
+        // The levels are stored one after another, from the leaves up to the root, so that each node's parent comes
+        // after it.
+        std::size_t nodeCount = 0;
+        for (std::uint32_t levelSize = leafCount; ; levelSize = (levelSize + Detail::barrier_fan_in - 1) / Detail::barrier_fan_in)
+        {
+            nodeCount += levelSize;
+            if (levelSize == 1)
+            {
+                break;
+            }
+        }
+        nodes = std::vector<Detail::barrier_node>(nodeCount);
+
+        std::uint32_t levelBegin = 0;
+        for (std::uint32_t levelSize = leafCount; levelSize > 1; )
+        {
+            const std::uint32_t nextSize = (levelSize + Detail::barrier_fan_in - 1) / Detail::barrier_fan_in;
+            for (std::uint32_t i = 0; i < levelSize; ++i)
+            {
+                nodes[levelBegin + i].parent = levelBegin + levelSize + i / Detail::barrier_fan_in;
+            }
+            levelBegin += levelSize;
+            levelSize = nextSize;
+        }
+        nodes.back().parent = NoParent;
+
+        SetExpected(expectedCount);
+    }
+
+    template <class CompletionFunction>
+    auto barrier<CompletionFunction>::arrive(std::ptrdiff_t update) -> arrival_token
+    {
+        assert(update > 0);
+
+        std::uint32_t arrivalPhase = phase.load(std::memory_order_acquire);
+        const std::uint32_t tokenPhase = arrivalPhase;
+        for (std::ptrdiff_t i = 0; i < update; ++i)
+        {
+            ArriveAtLeaf(arrivalPhase);
+        }
+        return arrival_token(tokenPhase);
+    }
+
+    template <class CompletionFunction>
+    void barrier<CompletionFunction>::wait(arrival_token&& arrival) const
+    {
+        const auto load = [this]() { return phase.load(std::memory_order_acquire); };
+        if (load() == arrival.phase)
+        {
+            Detail::atomic_wait<Detail::barrier_wait_is_native>(&phase, arrival.phase, load);
+        }
+    }
+
+    template <class CompletionFunction>
+    void barrier<CompletionFunction>::arrive_and_wait()
+    {
+        wait(arrive());
+    }
+
+    template <class CompletionFunction>
+    void barrier<CompletionFunction>::arrive_and_drop()
+    {
+        // Counted before the arrival, which the thread that ends the phase synchronizes with.
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        static_cast<void>(arrive());
+    }
+
+    template <class CompletionFunction>
+    void barrier<CompletionFunction>::SetExpected(std::uint32_t count) noexcept
+    {
+        for (Detail::barrier_node& node : nodes)
+        {
+            node.expected = 0;
+        }
+
+        for (std::uint32_t i = 0; i < nodes.size(); ++i)
+        {
+            Detail::barrier_node& node = nodes[i];
+            if (i < leafCount)
+            {
+                const std::uint32_t first = i * Detail::barrier_fan_in;
+                node.expected = count > first ? std::min(count - first, Detail::barrier_fan_in) : 0;
+            }
+            if (node.expected != 0 && node.parent != NoParent)
+            {
+                ++nodes[node.parent].expected;
+            }
+        }
+    }
+
+    template <class CompletionFunction>
+    void barrier<CompletionFunction>::ArriveAtLeaf(std::uint32_t& arrivalPhase) noexcept
+    {
+        const std::uint32_t start = static_cast<std::uint32_t>(Detail::barrier_thread_hash() % leafCount);
+        std::uint32_t index = start;
+        while (true)
+        {
+            // The expected count is read before arriving, since the thread that ends the phase may change it once this
+            // thread has arrived.
+            Detail::barrier_node& node = nodes[index];
+            std::atomic<std::uint32_t>& arrivals = node.arrivals[arrivalPhase & 1];
+            const std::uint32_t expected = node.expected;
+
+            std::uint32_t count = arrivals.load(std::memory_order_relaxed);
+            while (count < expected)
+            {
+                if (arrivals.compare_exchange_weak(count, count + 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+                {
+                    if (count + 1 == expected)
+                    {
+                        Propagate(index, arrivalPhase);
+                    }
+                    return;
+                }
+            }
+
+            // This leaf is full, so the thread moves on to the next one. If they all are, the phase this thread read
+            // has already ended, which it may not have seen yet if it only arrived without waiting.
+            index = index + 1 == leafCount ? 0 : index + 1;
+            if (index == start)
+            {
+                arrivalPhase = phase.load(std::memory_order_acquire);
+            }
+        }
+    }
+
+    template <class CompletionFunction>
+    void barrier<CompletionFunction>::Propagate(std::uint32_t index, std::uint32_t arrivalPhase) noexcept
+    {
+        const std::uint32_t parity = arrivalPhase & 1;
+        while (true)
+        {
+            // Every arrival of the previous phase at this node is done, and none of the next phase's can come before
+            // this one ends.
+            Detail::barrier_node& node = nodes[index];
+            node.arrivals[parity ^ 1].store(0, std::memory_order_relaxed);
+
+            if (node.parent == NoParent)
+            {
+                CompletePhase(arrivalPhase);
+                return;
+            }
+
+            Detail::barrier_node& parent = nodes[node.parent];
+            const std::uint32_t expected = parent.expected;
+            if (parent.arrivals[parity].fetch_add(1, std::memory_order_acq_rel) + 1 != expected)
+            {
+                return;
+            }
+            index = node.parent;
+        }
+    }
+
+    template <class CompletionFunction>
+    void barrier<CompletionFunction>::CompletePhase(std::uint32_t arrivalPhase) noexcept
+    {
+        const std::uint32_t dropCount = dropped.exchange(0, std::memory_order_relaxed);
+        if (dropCount != 0)
+        {
+            expectedCount -= dropCount;
+            SetExpected(expectedCount);
+        }
+
+        completion();
+
+        phase.store(arrivalPhase + 1, std::memory_order_release);
+        Detail::atomic_notify<Detail::barrier_wait_is_native>(&phase, true);
+    }
+}
@@ -0,0 +1,170 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/concepts.h>
+
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        /**
+         * @brief The types the `<bit>` functions take: unsigned integers other than `bool` and the character types.
+         */
+        template <class T>
+        concept bit_unsigned_integer = StdReimpl::unsigned_integral<T> && !StdReimpl::same_as<std::remove_cv_t<T>, bool> &&
+            !StdReimpl::same_as<std::remove_cv_t<T>, char> && !StdReimpl::same_as<std::remove_cv_t<T>, wchar_t> &&
+            !StdReimpl::same_as<std::remove_cv_t<T>, char8_t> && !StdReimpl::same_as<std::remove_cv_t<T>, char16_t> &&
+            !StdReimpl::same_as<std::remove_cv_t<T>, char32_t>;
+    }
+
+    /**
+     * @see https://eel.is/c++draft/bit.endian
+     * @see https://cppreference.com/w/cpp/types/endian
+     * @note A feature from the C++20 standard.
+     */
+    enum class endian
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        little = 0,
+        big = 1,
+        native = little
+#else
+        little = __ORDER_LITTLE_ENDIAN__,
+        big = __ORDER_BIG_ENDIAN__,
+        native = __BYTE_ORDER__
+#endif
+    };
+
+    /**
+     * @brief Implemented with `__builtin_bit_cast`, which GCC, Clang, and MSVC all have, including the versions whose
+     *        `<bit>` doesn't have `std::bit_cast` yet.
+     * @see https://eel.is/c++draft/bit.cast
+     * @see https://cppreference.com/w/cpp/numeric/bit_cast
+     * @note A feature from the C++20 standard.
+     */
+    template <class To, class From>
+        requires (sizeof(To) == sizeof(From) && std::is_trivially_copyable_v<To> && std::is_trivially_copyable_v<From>)
+    constexpr To bit_cast(const From& from) noexcept;
+
+    /**
+     * @brief Uses the compiler's byte swap instruction at runtime.
+     * @see https://eel.is/c++draft/bit.byteswap
+     * @see https://cppreference.com/w/cpp/numeric/byteswap
+     * @note A feature from the C++23 standard.
+     */
+    template <StdReimpl::integral T>
+    constexpr T byteswap(T value) noexcept;
+
+    /**
+     * @brief Batch versions of `byteswap`, for converting whole arrays from another endianness. Writes `byteswap(x[i])`
+     *        to `result[i]` for every element of `x`, using byte shuffles on SSSE3, AVX2, or NEON when available, and
+     *        shifts on SSE2 for 16 and 32-bit elements. `result` must be at least as big as `x`, and may be the same
+     *        range as `x`, but must not otherwise overlap it.
+     * @note Not part of the standard.
+     */
+    inline void byteswap(std::span<const std::uint16_t> x, std::span<std::uint16_t> result) noexcept;
+    inline void byteswap(std::span<const std::uint32_t> x, std::span<std::uint32_t> result) noexcept;
+    inline void byteswap(std::span<const std::uint64_t> x, std::span<std::uint64_t> result) noexcept;
+
+    /**
+     * @see https://eel.is/c++draft/bit.pow.two
+     * @see https://cppreference.com/w/cpp/numeric/has_single_bit
+     * @note A feature from the C++20 standard.
+     */
+    template <Detail::bit_unsigned_integer T>
+    constexpr bool has_single_bit(T x) noexcept;
+
+    /**
+     * @brief The smallest power of two not less than `x`. The behavior is undefined if that isn't representable in `T`.
+     * @see https://eel.is/c++draft/bit.pow.two
+     * @see https://cppreference.com/w/cpp/numeric/bit_ceil
+     * @note A feature from the C++20 standard.
+     */
+    template <Detail::bit_unsigned_integer T>
+    constexpr T bit_ceil(T x) noexcept;
+
+    /**
+     * @brief The largest power of two not greater than `x`, or 0 if `x` is 0.
+     * @see https://eel.is/c++draft/bit.pow.two
+     * @see https://cppreference.com/w/cpp/numeric/bit_floor
+     * @note A feature from the C++20 standard.
+     */
+    template <Detail::bit_unsigned_integer T>
+    constexpr T bit_floor(T x) noexcept;
+
+    /**
+     * @brief The number of bits needed to store `x`, i.e. 1 + floor(log2(x)), or 0 if `x` is 0.
+     * @see https://eel.is/c++draft/bit.pow.two
+     * @see https://cppreference.com/w/cpp/numeric/bit_width
+     * @note A feature from the C++20 standard.
+     */
+    template <Detail::bit_unsigned_integer T>
+    constexpr int bit_width(T x) noexcept;
+
+    /**
+     * @see https://eel.is/c++draft/bit.rotate
+     * @see https://cppreference.com/w/cpp/numeric/rotl
+     * @note A feature from the C++20 standard.
+     */
+    template <Detail::bit_unsigned_integer T>
+    constexpr T rotl(T x, int s) noexcept;
+
+    /**
+     * @see https://eel.is/c++draft/bit.rotate
+     * @see https://cppreference.com/w/cpp/numeric/rotr
+     * @note A feature from the C++20 standard.
+     */
+    template <Detail::bit_unsigned_integer T>
+    constexpr T rotr(T x, int s) noexcept;
+
+    /**
+     * @brief Uses `lzcnt` (or `bsr`) at runtime.
+     * @see https://eel.is/c++draft/bit.count
+     * @see https://cppreference.com/w/cpp/numeric/countl_zero
+     * @note A feature from the C++20 standard.
+     */
+    template <Detail::bit_unsigned_integer T>
+    constexpr int countl_zero(T x) noexcept;
+
+    /**
+     * @see https://eel.is/c++draft/bit.count
+     * @see https://cppreference.com/w/cpp/numeric/countl_one
+     * @note A feature from the C++20 standard.
+     */
+    template <Detail::bit_unsigned_integer T>
+    constexpr int countl_one(T x) noexcept;
+
+    /**
+     * @brief Uses `tzcnt` (or `bsf`) at runtime.
+     * @see https://eel.is/c++draft/bit.count
+     * @see https://cppreference.com/w/cpp/numeric/countr_zero
+     * @note A feature from the C++20 standard.
+     */
+    template <Detail::bit_unsigned_integer T>
+    constexpr int countr_zero(T x) noexcept;
+
+    /**
+     * @see https://eel.is/c++draft/bit.count
+     * @see https://cppreference.com/w/cpp/numeric/countr_one
+     * @note A feature from the C++20 standard.
+     */
+    template <Detail::bit_unsigned_integer T>
+    constexpr int countr_one(T x) noexcept;
+
+    /**
+     * @brief Uses `popcnt` at runtime, where the target has it.
+     * @see https://eel.is/c++draft/bit.count
+     * @see https://cppreference.com/w/cpp/numeric/popcount
+     * @note A feature from the C++20 standard.
+     */
+    template <Detail::bit_unsigned_integer T>
+    constexpr int popcount(T x) noexcept;
+}
+
+#include <CppUtils/StdReimpl/bit.inl>
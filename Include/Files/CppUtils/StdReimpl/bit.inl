@@ -0,0 +1,480 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/bit.h>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(__GNUC__) || defined(__clang__)
+#   define CPPUTILS_STDREIMPL_BIT_USE_GNU_BUILTINS 1
+#elif defined(_MSC_VER)
+#   include <intrin.h>
+#   define CPPUTILS_STDREIMPL_BIT_USE_MSVC_INTRINSICS 1
+#endif
+
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#   define CPPUTILS_STDREIMPL_BIT_USE_AVX2 1
+#elif defined(__SSSE3__) || defined(__AVX__)
+#   include <tmmintrin.h>
+#   define CPPUTILS_STDREIMPL_BIT_USE_SSSE3 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define CPPUTILS_STDREIMPL_BIT_USE_SSE2 1
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#   include <arm_neon.h>
+#   define CPPUTILS_STDREIMPL_BIT_USE_NEON 1
+#endif
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        template <class T>
+        constexpr int bit_digits = std::numeric_limits<T>::digits;
+
+        /**
+         * @brief The type to do bit arithmetic on `T` in, which is at least an `unsigned int`, so that smaller types
+         *        aren't promoted to `int` halfway through.
+         */
+        template <class T>
+        using bit_promoted_t = std::common_type_t<T, unsigned int>;
+
+        //
+        // Portable versions, used during constant evaluation, where we can't use the builtins. Everything is done with
+        // shifts and masks rather than branches or loops over the bits.
+        //
+
+        template <class T>
+        constexpr T byteswap_portable(T value) noexcept
+        {
+            using U = std::make_unsigned_t<T>;
+
+            U remaining = static_cast<U>(value);
+            U result = 0;
+            for (std::size_t i = 0; i < sizeof(T); ++i)
+            {
+                result = static_cast<U>((result << 8) | (remaining & 0xFF));
+                remaining = static_cast<U>(remaining >> 8);
+            }
+            return static_cast<T>(result);
+        }
+
+        template <class T>
+        constexpr int popcount_portable(T x) noexcept
+        {
+            // Sums the bits in pairs, then nibbles, then bytes, and adds up the bytes with a multiply.
+            using U = bit_promoted_t<T>;
+            constexpr U ones = static_cast<U>(~U(0));
+
+            U v = x;
+            v = v - ((v >> 1) & (ones / 3));
+            v = (v & (ones / 15 * 3)) + ((v >> 2) & (ones / 15 * 3));
+            v = (v + (v >> 4)) & (ones / 255 * 15);
+            return static_cast<int>(static_cast<U>(v * (ones / 255)) >> (bit_digits<U> - 8));
+        }
+
+        template <class T>
+        constexpr int countl_zero_portable(T x) noexcept
+        {
+            // Smears the highest set bit into every bit below it, which leaves `bit_width(x)` bits set.
+            bit_promoted_t<T> v = x;
+            for (int shift = 1; shift < bit_digits<T>; shift *= 2)
+            {
+                v |= v >> shift;
+            }
+            return bit_digits<T> - Detail::popcount_portable(v);
+        }
+
+        template <class T>
+        constexpr int countr_zero_portable(T x) noexcept
+        {
+            // Just the trailing zeros, set. All of the bits when `x` is 0.
+            return Detail::popcount_portable(static_cast<T>(static_cast<T>(~x) & static_cast<T>(x - 1)));
+        }
+
+        //
+        // Runtime versions, which use the compiler's builtins, where it has them for `T`.
+        //
+
+        template <class T>
+        T byteswap_builtin(T value) noexcept
+        {
+            using U = std::make_unsigned_t<T>;
+            const U u = static_cast<U>(value);
+
+#if defined(CPPUTILS_STDREIMPL_BIT_USE_GNU_BUILTINS)
+            if constexpr (sizeof(T) == 2)
+            {
+                return static_cast<T>(__builtin_bswap16(u));
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                return static_cast<T>(__builtin_bswap32(u));
+            }
+            else if constexpr (sizeof(T) == 8)
+            {
+                return static_cast<T>(__builtin_bswap64(u));
+            }
+            else
+#elif defined(CPPUTILS_STDREIMPL_BIT_USE_MSVC_INTRINSICS)
+            if constexpr (sizeof(T) == 2)
+            {
+                return static_cast<T>(_byteswap_ushort(u));
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                return static_cast<T>(_byteswap_ulong(u));
+            }
+            else if constexpr (sizeof(T) == 8)
+            {
+                return static_cast<T>(_byteswap_uint64(u));
+            }
+            else
+#endif
+            {
+                return Detail::byteswap_portable(value);
+            }
+        }
+
+        template <class T>
+        int popcount_builtin(T x) noexcept
+        {
+#if defined(CPPUTILS_STDREIMPL_BIT_USE_GNU_BUILTINS)
+            if constexpr (sizeof(T) <= sizeof(unsigned int))
+            {
+                return __builtin_popcount(x);
+            }
+            else if constexpr (sizeof(T) <= sizeof(unsigned long long))
+            {
+                return __builtin_popcountll(x);
+            }
+            else
+#elif defined(CPPUTILS_STDREIMPL_BIT_USE_MSVC_INTRINSICS) && defined(__AVX__) && (defined(_M_X64) || defined(_M_IX86))
+            // The `popcnt` instruction came before AVX, so it's only safe to use when targeting AVX.
+            if constexpr (sizeof(T) <= sizeof(unsigned int))
+            {
+                return static_cast<int>(__popcnt(x));
+            }
+#if defined(_M_X64)
+            else if constexpr (sizeof(T) <= sizeof(unsigned long long))
+            {
+                return static_cast<int>(__popcnt64(x));
+            }
+#endif
+            else
+#endif
+            {
+                return Detail::popcount_portable(x);
+            }
+        }
+
+        template <class T>
+        int countl_zero_builtin(T x) noexcept
+        {
+#if defined(CPPUTILS_STDREIMPL_BIT_USE_GNU_BUILTINS)
+            // The builtins are undefined for 0. With `lzcnt`, the compiler folds this check away.
+            if constexpr (sizeof(T) <= sizeof(unsigned int))
+            {
+                return x == 0 ? bit_digits<T> : __builtin_clz(x) - (bit_digits<unsigned int> - bit_digits<T>);
+            }
+            else if constexpr (sizeof(T) <= sizeof(unsigned long long))
+            {
+                return x == 0 ? bit_digits<T> : __builtin_clzll(x) - (bit_digits<unsigned long long> - bit_digits<T>);
+            }
+            else
+#elif defined(CPPUTILS_STDREIMPL_BIT_USE_MSVC_INTRINSICS)
+            unsigned long index;
+            if constexpr (sizeof(T) <= sizeof(unsigned long))
+            {
+                return _BitScanReverse(&index, x) ? bit_digits<T> - 1 - static_cast<int>(index) : bit_digits<T>;
+            }
+#if defined(_M_X64) || defined(_M_ARM64)
+            else if constexpr (sizeof(T) <= sizeof(unsigned long long))
+            {
+                return _BitScanReverse64(&index, x) ? bit_digits<T> - 1 - static_cast<int>(index) : bit_digits<T>;
+            }
+#endif
+            else
+#endif
+            {
+                return Detail::countl_zero_portable(x);
+            }
+        }
+
+        template <class T>
+        int countr_zero_builtin(T x) noexcept
+        {
+#if defined(CPPUTILS_STDREIMPL_BIT_USE_GNU_BUILTINS)
+            // The builtins are undefined for 0. With `tzcnt`, the compiler folds this check away.
+            if constexpr (sizeof(T) <= sizeof(unsigned int))
+            {
+                return x == 0 ? bit_digits<T> : __builtin_ctz(x);
+            }
+            else if constexpr (sizeof(T) <= sizeof(unsigned long long))
+            {
+                return x == 0 ? bit_digits<T> : __builtin_ctzll(x);
+            }
+            else
+#elif defined(CPPUTILS_STDREIMPL_BIT_USE_MSVC_INTRINSICS)
+            unsigned long index;
+            if constexpr (sizeof(T) <= sizeof(unsigned long))
+            {
+                return _BitScanForward(&index, x) ? static_cast<int>(index) : bit_digits<T>;
+            }
+#if defined(_M_X64) || defined(_M_ARM64)
+            else if constexpr (sizeof(T) <= sizeof(unsigned long long))
+            {
+                return _BitScanForward64(&index, x) ? static_cast<int>(index) : bit_digits<T>;
+            }
+#endif
+            else
+#endif
+            {
+                return Detail::countr_zero_portable(x);
+            }
+        }
+
+#if defined(CPPUTILS_STDREIMPL_BIT_USE_AVX2) || defined(CPPUTILS_STDREIMPL_BIT_USE_SSSE3)
+        /**
+         * @brief The `pshufb` control that reverses the bytes of each `ElementSize` byte element of a vector.
+         */
+        template <std::size_t ElementSize>
+        inline __m128i byteswap_shuffle_control() noexcept
+        {
+            if constexpr (ElementSize == 2)
+            {
+                return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+            }
+            else if constexpr (ElementSize == 4)
+            {
+                return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+            }
+            else
+            {
+                return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+            }
+        }
+#endif
+
+        template <class T>
+        void byteswap_batch(const T* x, T* result, std::size_t count) noexcept
+        {
+            static_assert(std::is_same_v<T, std::uint16_t> || std::is_same_v<T, std::uint32_t> || std::is_same_v<T, std::uint64_t>);
+
+            std::size_t i = 0;
+
+            // Each vector iteration loads before it stores, so `result == x` is fine.
+#if defined(CPPUTILS_STDREIMPL_BIT_USE_AVX2) || defined(CPPUTILS_STDREIMPL_BIT_USE_SSSE3)
+            const __m128i control = Detail::byteswap_shuffle_control<sizeof(T)>();
+#if defined(CPPUTILS_STDREIMPL_BIT_USE_AVX2)
+            // `vpshufb` shuffles within each 128-bit lane, so both lanes get the same control.
+            const __m256i control256 = _mm256_broadcastsi128_si256(control);
+            for (; i + 32 / sizeof(T) <= count; i += 32 / sizeof(T))
+            {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + i), _mm256_shuffle_epi8(v, control256));
+            }
+#endif
+            for (; i + 16 / sizeof(T) <= count; i += 16 / sizeof(T))
+            {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(result + i), _mm_shuffle_epi8(v, control));
+            }
+#elif defined(CPPUTILS_STDREIMPL_BIT_USE_SSE2)
+            // Without `pshufb`, reverse the order of the 16-bit words in each element, then swap the bytes of each word.
+            // That's more work than a `bswap` per element for 64-bit ones, so they're left to the scalar loop.
+            if constexpr (sizeof(T) < 8)
+            {
+                for (; i + 16 / sizeof(T) <= count; i += 16 / sizeof(T))
+                {
+                    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i));
+                    if constexpr (sizeof(T) == 4)
+                    {
+                        v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+                    }
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(result + i), _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)));
+                }
+            }
+#elif defined(CPPUTILS_STDREIMPL_BIT_USE_NEON)
+            for (; i + 16 / sizeof(T) <= count; i += 16 / sizeof(T))
+            {
+                const uint8x16_t v = vld1q_u8(reinterpret_cast<const std::uint8_t*>(x + i));
+                if constexpr (sizeof(T) == 2)
+                {
+                    vst1q_u8(reinterpret_cast<std::uint8_t*>(result + i), vrev16q_u8(v));
+                }
+                else if constexpr (sizeof(T) == 4)
+                {
+                    vst1q_u8(reinterpret_cast<std::uint8_t*>(result + i), vrev32q_u8(v));
+                }
+                else
+                {
+                    vst1q_u8(reinterpret_cast<std::uint8_t*>(result + i), vrev64q_u8(v));
+                }
+            }
+#endif
+
+            // The scalar tail, and the whole range when there's no vector path.
+            for (; i < count; ++i)
+            {
+                result[i] = Detail::byteswap_builtin(x[i]);
+            }
+        }
+    }
+
+    template <class To, class From>
+        requires (sizeof(To) == sizeof(From) && std::is_trivially_copyable_v<To> && std::is_trivially_copyable_v<From>)
+    constexpr To bit_cast(const From& from) noexcept
+    {
+        return __builtin_bit_cast(To, from);
+    }
+
+    template <StdReimpl::integral T>
+    constexpr T byteswap(T value) noexcept
+    {
+        if constexpr (sizeof(T) == 1)
+        {
+            return value;
+        }
+        else
+        {
+            if (std::is_constant_evaluated()) // if consteval
+            {
+                return Detail::byteswap_portable(value);
+            }
+            else
+            {
+                return Detail::byteswap_builtin(value);
+            }
+        }
+    }
+
+    inline void byteswap(std::span<const std::uint16_t> x, std::span<std::uint16_t> result) noexcept
+    {
+        assert(result.size() >= x.size());
+        Detail::byteswap_batch(x.data(), result.data(), x.size());
+    }
+    inline void byteswap(std::span<const std::uint32_t> x, std::span<std::uint32_t> result) noexcept
+    {
+        assert(result.size() >= x.size());
+        Detail::byteswap_batch(x.data(), result.data(), x.size());
+    }
+    inline void byteswap(std::span<const std::uint64_t> x, std::span<std::uint64_t> result) noexcept
+    {
+        assert(result.size() >= x.size());
+        Detail::byteswap_batch(x.data(), result.data(), x.size());
+    }
+
+    template <Detail::bit_unsigned_integer T>
+    constexpr bool has_single_bit(T x) noexcept
+    {
+        return x != 0 && static_cast<T>(x & static_cast<T>(x - 1)) == 0;
+    }
+
+    template <Detail::bit_unsigned_integer T>
+    constexpr T bit_ceil(T x) noexcept
+    {
+        if (x <= 1u)
+        {
+            return T(1);
+        }
+
+        const int shift = StdReimpl::bit_width(static_cast<T>(x - 1));
+        assert(shift < Detail::bit_digits<T>);
+        return static_cast<T>(Detail::bit_promoted_t<T>(1) << shift);
+    }
+
+    template <Detail::bit_unsigned_integer T>
+    constexpr T bit_floor(T x) noexcept
+    {
+        if (x == 0)
+        {
+            return T(0);
+        }
+
+        return static_cast<T>(Detail::bit_promoted_t<T>(1) << (StdReimpl::bit_width(x) - 1));
+    }
+
+    template <Detail::bit_unsigned_integer T>
+    constexpr int bit_width(T x) noexcept
+    {
+        return Detail::bit_digits<T> - StdReimpl::countl_zero(x);
+    }
+
+    template <Detail::bit_unsigned_integer T>
+    constexpr T rotl(T x, int s) noexcept
+    {
+        // The widths are powers of two, so the unsigned remainder is the right one for negative `s` too, and masking the
+        // shifts keeps them in range without a branch for 0. Compilers turn this into a single rotate instruction.
+        constexpr unsigned int digits = Detail::bit_digits<T>;
+        const unsigned int r = static_cast<unsigned int>(s) % digits;
+        const Detail::bit_promoted_t<T> v = x;
+        return static_cast<T>((v << r) | (v >> ((digits - r) & (digits - 1))));
+    }
+
+    template <Detail::bit_unsigned_integer T>
+    constexpr T rotr(T x, int s) noexcept
+    {
+        constexpr unsigned int digits = Detail::bit_digits<T>;
+        const unsigned int r = static_cast<unsigned int>(s) % digits;
+        const Detail::bit_promoted_t<T> v = x;
+        return static_cast<T>((v >> r) | (v << ((digits - r) & (digits - 1))));
+    }
+
+    template <Detail::bit_unsigned_integer T>
+    constexpr int countl_zero(T x) noexcept
+    {
+        if (std::is_constant_evaluated()) // if consteval
+        {
+            return Detail::countl_zero_portable(x);
+        }
+        else
+        {
+            return Detail::countl_zero_builtin(x);
+        }
+    }
+
+    template <Detail::bit_unsigned_integer T>
+    constexpr int countl_one(T x) noexcept
+    {
+        return StdReimpl::countl_zero(static_cast<T>(~x));
+    }
+
+    template <Detail::bit_unsigned_integer T>
+    constexpr int countr_zero(T x) noexcept
+    {
+        if (std::is_constant_evaluated()) // if consteval
+        {
+            return Detail::countr_zero_portable(x);
+        }
+        else
+        {
+            return Detail::countr_zero_builtin(x);
+        }
+    }
+
+    template <Detail::bit_unsigned_integer T>
+    constexpr int countr_one(T x) noexcept
+    {
+        return StdReimpl::countr_zero(static_cast<T>(~x));
+    }
+
+    template <Detail::bit_unsigned_integer T>
+    constexpr int popcount(T x) noexcept
+    {
+        if (std::is_constant_evaluated()) // if consteval
+        {
+            return Detail::popcount_portable(x);
+        }
+        else
+        {
+            return Detail::popcount_builtin(x);
+        }
+    }
+}
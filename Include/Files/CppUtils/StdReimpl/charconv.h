@@ -0,0 +1,142 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/concepts.h>
+
+#include <system_error>
+#include <type_traits>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        /**
+         * @brief The types the integer `to_chars` and `from_chars` take: `char` and the signed and unsigned integers,
+         *        but not `bool` or the other character types.
+         */
+        template <class T>
+        concept charconv_integer = StdReimpl::integral<T> && !StdReimpl::same_as<std::remove_cv_t<T>, bool> &&
+            !StdReimpl::same_as<std::remove_cv_t<T>, wchar_t> && !StdReimpl::same_as<std::remove_cv_t<T>, char8_t> &&
+            !StdReimpl::same_as<std::remove_cv_t<T>, char16_t> && !StdReimpl::same_as<std::remove_cv_t<T>, char32_t>;
+    }
+
+    /**
+     * @see https://eel.is/c++draft/charconv.syn
+     * @see https://cppreference.com/w/cpp/utility/chars_format
+     * @note A feature from the C++17 standard.
+     */
+    enum class chars_format
+    {
+        scientific = 0x1,
+        fixed = 0x2,
+        hex = 0x4,
+        general = fixed | scientific
+    };
+
+    constexpr chars_format operator|(chars_format lhs, chars_format rhs) noexcept;
+    constexpr chars_format operator&(chars_format lhs, chars_format rhs) noexcept;
+    constexpr chars_format operator^(chars_format lhs, chars_format rhs) noexcept;
+    constexpr chars_format operator~(chars_format value) noexcept;
+    constexpr chars_format& operator|=(chars_format& lhs, chars_format rhs) noexcept;
+    constexpr chars_format& operator&=(chars_format& lhs, chars_format rhs) noexcept;
+    constexpr chars_format& operator^=(chars_format& lhs, chars_format rhs) noexcept;
+
+    /**
+     * @see https://eel.is/c++draft/charconv.syn
+     * @see https://cppreference.com/w/cpp/utility/to_chars_result
+     * @note A feature from the C++17 standard. The `operator bool` is a feature from the C++26 standard.
+     */
+    struct to_chars_result
+    {
+        char* ptr;
+        std::errc ec;
+
+        friend constexpr bool operator==(const to_chars_result&, const to_chars_result&) = default;
+        constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+    };
+
+    /**
+     * @see https://eel.is/c++draft/charconv.syn
+     * @see https://cppreference.com/w/cpp/utility/from_chars_result
+     * @note A feature from the C++17 standard. The `operator bool` is a feature from the C++26 standard.
+     */
+    struct from_chars_result
+    {
+        const char* ptr;
+        std::errc ec;
+
+        friend constexpr bool operator==(const from_chars_result&, const from_chars_result&) = default;
+        constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+    };
+
+    /**
+     * @brief Writes base 10 two digits at a time, from a table of the pairs "00" through "99", and other bases one digit
+     *        at a time, with shifts for the powers of two. `base` must be in [2, 36]. When `[first, last)` is too small,
+     *        returns `{last, std::errc::value_too_large}` and the contents of the range are unspecified.
+     * @see https://eel.is/c++draft/charconv.to.chars
+     * @see https://cppreference.com/w/cpp/utility/to_chars
+     * @note A feature from the C++17 standard. Constexpr support is a feature from the C++23 standard.
+     */
+    template <Detail::charconv_integer T>
+    constexpr to_chars_result to_chars(char* first, char* last, T value, int base = 10);
+    to_chars_result to_chars(char* first, char* last, bool value, int base = 10) = delete;
+
+    /**
+     * @brief The shortest representation that `from_chars` reads back as exactly `value`, choosing the closest to
+     *        `value` when there are several. Found with the Schubfach algorithm, which takes a couple of 128-bit
+     *        multiplies and no loops over digits or big integers.
+     *
+     *        With no `fmt`, uses whichever of the fixed and scientific styles is shorter, preferring fixed. With
+     *        `chars_format::general`, uses the same choice as `printf`'s `%g`. Like the standard library's, fixed
+     *        notation for values too big to have a fractional part writes their exact integer value.
+     * @see https://eel.is/c++draft/charconv.to.chars
+     * @see https://cppreference.com/w/cpp/utility/to_chars
+     * @note A feature from the C++17 standard. We don't have the `long double` and extended floating point overloads.
+     */
+    inline to_chars_result to_chars(char* first, char* last, float value);
+    inline to_chars_result to_chars(char* first, char* last, double value);
+    inline to_chars_result to_chars(char* first, char* last, float value, chars_format fmt);
+    inline to_chars_result to_chars(char* first, char* last, double value, chars_format fmt);
+
+    /**
+     * @brief The same as `printf` with the `%f`, `%e`, `%g`, or `%a` conversions and the given precision, rounded
+     *        correctly from the exact binary value, ties to even. Generates the exact decimal digits with 32-bit limb
+     *        big integer arithmetic, which is only as long as the value's fractional bits need, so short for everyday
+     *        values.
+     * @see https://eel.is/c++draft/charconv.to.chars
+     * @see https://cppreference.com/w/cpp/utility/to_chars
+     * @note A feature from the C++17 standard. We don't have the `long double` and extended floating point overloads.
+     */
+    inline to_chars_result to_chars(char* first, char* last, float value, chars_format fmt, int precision);
+    inline to_chars_result to_chars(char* first, char* last, double value, chars_format fmt, int precision);
+
+    /**
+     * @brief Accepts an optional '-' for signed types, then the digits of `base`, which must be in [2, 36]. Letters are
+     *        case insensitive. On overflow, returns `std::errc::result_out_of_range` past all the digits, and leaves
+     *        `value` unmodified.
+     * @see https://eel.is/c++draft/charconv.from.chars
+     * @see https://cppreference.com/w/cpp/utility/from_chars
+     * @note A feature from the C++17 standard. Constexpr support is a feature from the C++23 standard.
+     */
+    template <Detail::charconv_integer T>
+    constexpr from_chars_result from_chars(const char* first, const char* last, T& value, int base = 10);
+
+    /**
+     * @brief Correctly rounded, ties to even. Tries the Clinger fast path first, for short inputs whose value is one
+     *        exact floating point operation away, then the Eisel-Lemire algorithm, which rounds from a 128-bit product
+     *        of the first 19 digits and a table of powers of five. Only inputs with more than 19 significant digits
+     *        can be ambiguous there, and they're settled by an exact big integer comparison against the halfway point.
+     *
+     *        Like the standard library's, returns `std::errc::result_out_of_range` and leaves `value` unmodified when
+     *        the value overflows to infinity, or underflows to zero from a nonzero input.
+     * @see https://eel.is/c++draft/charconv.from.chars
+     * @see https://cppreference.com/w/cpp/utility/from_chars
+     * @note A feature from the C++17 standard. We don't have the `long double` and extended floating point overloads.
+     */
+    inline from_chars_result from_chars(const char* first, const char* last, float& value, chars_format fmt = chars_format::general);
+    inline from_chars_result from_chars(const char* first, const char* last, double& value, chars_format fmt = chars_format::general);
+}
+
+#include <CppUtils/StdReimpl/charconv.inl>
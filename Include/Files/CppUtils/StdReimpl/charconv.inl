@@ -0,0 +1,2323 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/charconv.h>
+#include <CppUtils/StdReimpl/bit.h>
+
+#include <cassert>
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+#if defined(__SIZEOF_INT128__)
+#   define CPPUTILS_STDREIMPL_CHARCONV_USE_INT128 1
+#elif defined(_MSC_VER) && defined(_M_X64)
+#   include <intrin.h>
+#   define CPPUTILS_STDREIMPL_CHARCONV_USE_UMUL128 1
+#endif
+
+// The Clinger fast path needs floating point operations to be rounded to the type's own precision, which they aren't on
+// x87.
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+#   define CPPUTILS_STDREIMPL_CHARCONV_USE_CLINGER_FAST_PATH 1
+#endif
+
+namespace StdReimpl
+{
+    constexpr chars_format operator|(chars_format lhs, chars_format rhs) noexcept
+    {
+        return static_cast<chars_format>(static_cast<int>(lhs) | static_cast<int>(rhs));
+    }
+    constexpr chars_format operator&(chars_format lhs, chars_format rhs) noexcept
+    {
+        return static_cast<chars_format>(static_cast<int>(lhs) & static_cast<int>(rhs));
+    }
+    constexpr chars_format operator^(chars_format lhs, chars_format rhs) noexcept
+    {
+        return static_cast<chars_format>(static_cast<int>(lhs) ^ static_cast<int>(rhs));
+    }
+    constexpr chars_format operator~(chars_format value) noexcept
+    {
+        return static_cast<chars_format>(~static_cast<int>(value));
+    }
+    constexpr chars_format& operator|=(chars_format& lhs, chars_format rhs) noexcept
+    {
+        return lhs = lhs | rhs;
+    }
+    constexpr chars_format& operator&=(chars_format& lhs, chars_format rhs) noexcept
+    {
+        return lhs = lhs & rhs;
+    }
+    constexpr chars_format& operator^=(chars_format& lhs, chars_format rhs) noexcept
+    {
+        return lhs = lhs ^ rhs;
+    }
+
+    namespace Detail
+    {
+        //
+        // Integers.
+        //
+
+        inline constexpr char charconv_digit_pairs[] =
+            "00010203040506070809"
+            "10111213141516171819"
+            "20212223242526272829"
+            "30313233343536373839"
+            "40414243444546474849"
+            "50515253545556575859"
+            "60616263646566676869"
+            "70717273747576777879"
+            "80818283848586878889"
+            "90919293949596979899";
+
+        inline constexpr char charconv_digit_letters[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+        template <class U>
+        constexpr int charconv_count_decimal_digits(U value) noexcept
+        {
+            int count = 1;
+            while (true)
+            {
+                if (value < 10u)
+                {
+                    return count;
+                }
+                if (value < 100u)
+                {
+                    return count + 1;
+                }
+                if (value < 1000u)
+                {
+                    return count + 2;
+                }
+                if (value < 10000u)
+                {
+                    return count + 3;
+                }
+                value = static_cast<U>(value / 10000u);
+                count += 4;
+            }
+        }
+
+        /**
+         * @brief Writes the decimal digits of `value` so that they end just before `end`, two at a time.
+         */
+        template <class U>
+        constexpr void charconv_write_decimal_backward(char* end, U value) noexcept
+        {
+            while (value >= 100u)
+            {
+                const std::size_t pair = static_cast<std::size_t>(value % 100u) * 2;
+                value = static_cast<U>(value / 100u);
+                end -= 2;
+                end[0] = charconv_digit_pairs[pair];
+                end[1] = charconv_digit_pairs[pair + 1];
+            }
+
+            if (value >= 10u)
+            {
+                const std::size_t pair = static_cast<std::size_t>(value) * 2;
+                end[-2] = charconv_digit_pairs[pair];
+                end[-1] = charconv_digit_pairs[pair + 1];
+            }
+            else
+            {
+                end[-1] = static_cast<char>('0' + value);
+            }
+        }
+
+        template <class U>
+        constexpr to_chars_result charconv_to_chars_unsigned(char* first, char* last, U value, int base)
+        {
+            if (base == 10)
+            {
+                const int length = charconv_count_decimal_digits(value);
+                if (last - first < length)
+                {
+                    return {last, std::errc::value_too_large};
+                }
+                charconv_write_decimal_backward(first + length, value);
+                return {first + length, std::errc{}};
+            }
+
+            if (StdReimpl::has_single_bit(static_cast<unsigned int>(base)))
+            {
+                const int shift = StdReimpl::countr_zero(static_cast<unsigned int>(base));
+                const int length = value == 0 ? 1 : (StdReimpl::bit_width(value) + shift - 1) / shift;
+                if (last - first < length)
+                {
+                    return {last, std::errc::value_too_large};
+                }
+
+                char* p = first + length;
+                do
+                {
+                    *--p = charconv_digit_letters[value & static_cast<unsigned int>(base - 1)];
+                    value = static_cast<U>(value >> shift);
+                } while (value != 0);
+                return {first + length, std::errc{}};
+            }
+
+            const U unsignedBase = static_cast<U>(base);
+            int length = 1;
+            for (U remaining = value; remaining >= unsignedBase; remaining = static_cast<U>(remaining / unsignedBase))
+            {
+                ++length;
+            }
+            if (last - first < length)
+            {
+                return {last, std::errc::value_too_large};
+            }
+
+            char* p = first + length;
+            do
+            {
+                *--p = charconv_digit_letters[value % unsignedBase];
+                value = static_cast<U>(value / unsignedBase);
+            } while (value != 0);
+            return {first + length, std::errc{}};
+        }
+
+        /**
+         * @brief The value of a digit or letter in bases up to 36, or 36 for characters that aren't digits in any base.
+         */
+        constexpr unsigned int charconv_digit_value(char c) noexcept
+        {
+            const unsigned int code = static_cast<unsigned char>(c);
+            if (code - '0' < 10u)
+            {
+                return code - '0';
+            }
+
+            // Setting this bit lowercases ASCII letters.
+            const unsigned int lowercase = code | 0x20u;
+            if (lowercase - 'a' < 26u)
+            {
+                return lowercase - 'a' + 10;
+            }
+            return 36;
+        }
+
+        constexpr bool charconv_is_decimal_digit(char c) noexcept
+        {
+            return static_cast<unsigned int>(static_cast<unsigned char>(c)) - '0' < 10u;
+        }
+
+        //
+        // Floating point: the shared pieces.
+        //
+
+        struct charconv_uint128
+        {
+            std::uint64_t high;
+            std::uint64_t low;
+        };
+
+        inline charconv_uint128 charconv_multiply_64x64(std::uint64_t a, std::uint64_t b) noexcept
+        {
+#if defined(CPPUTILS_STDREIMPL_CHARCONV_USE_INT128)
+            __extension__ using uint128 = unsigned __int128;
+            const uint128 product = static_cast<uint128>(a) * b;
+            return {static_cast<std::uint64_t>(product >> 64), static_cast<std::uint64_t>(product)};
+#elif defined(CPPUTILS_STDREIMPL_CHARCONV_USE_UMUL128)
+            std::uint64_t high;
+            const std::uint64_t low = _umul128(a, b, &high);
+            return {high, low};
+#else
+            const std::uint64_t aLow = a & 0xFFFFFFFFu;
+            const std::uint64_t aHigh = a >> 32;
+            const std::uint64_t bLow = b & 0xFFFFFFFFu;
+            const std::uint64_t bHigh = b >> 32;
+
+            const std::uint64_t lowLow = aLow * bLow;
+            const std::uint64_t highLow = aHigh * bLow;
+            const std::uint64_t lowHigh = aLow * bHigh;
+            const std::uint64_t highHigh = aHigh * bHigh;
+
+            const std::uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFFu) + (lowHigh & 0xFFFFFFFFu);
+            return {highHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32), (middle << 32) | (lowLow & 0xFFFFFFFFu)};
+#endif
+        }
+
+        template <class T>
+        struct charconv_float_traits;
+
+        template <>
+        struct charconv_float_traits<float>
+        {
+            using bits_type = std::uint32_t;
+
+            // The explicitly stored mantissa bits, which don't include the hidden bit.
+            static constexpr int mantissa_bits = 23;
+            static constexpr int exponent_bias = 127;
+            static constexpr int infinite_exponent = 0xFF;
+
+            // The number of hexadecimal digits after the point in `chars_format::hex`.
+            static constexpr int hex_digits = 6;
+
+            // Any 19 digits times a power of ten outside of these round to zero or infinity.
+            static constexpr int smallest_power_of_ten = -64;
+            static constexpr int largest_power_of_ten = 38;
+
+            // The powers of ten for which a product with 19 digits can land exactly halfway between two floats.
+            static constexpr int min_exponent_round_to_even = -17;
+            static constexpr int max_exponent_round_to_even = 10;
+
+            // The powers of ten that are exactly representable, for the Clinger fast path.
+            static constexpr float exact_powers_of_ten[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+        };
+
+        template <>
+        struct charconv_float_traits<double>
+        {
+            using bits_type = std::uint64_t;
+
+            static constexpr int mantissa_bits = 52;
+            static constexpr int exponent_bias = 1023;
+            static constexpr int infinite_exponent = 0x7FF;
+
+            static constexpr int hex_digits = 13;
+
+            static constexpr int smallest_power_of_ten = -342;
+            static constexpr int largest_power_of_ten = 308;
+
+            static constexpr int min_exponent_round_to_even = -4;
+            static constexpr int max_exponent_round_to_even = 23;
+
+            static constexpr double exact_powers_of_ten[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+        };
+
+        /**
+         * @brief A float's fields, with the sign taken off.
+         */
+        template <class T>
+        struct charconv_float_fields
+        {
+            using traits = charconv_float_traits<T>;
+            using bits_type = typename traits::bits_type;
+
+            explicit charconv_float_fields(T value) noexcept
+            {
+                const bits_type bits = StdReimpl::bit_cast<bits_type>(value);
+                negative = (bits >> (sizeof(bits_type) * 8 - 1)) != 0;
+                exponent = static_cast<int>((bits >> traits::mantissa_bits) & static_cast<bits_type>(traits::infinite_exponent));
+                fraction = bits & ((bits_type{1} << traits::mantissa_bits) - 1);
+            }
+
+            // The value is `mantissa * 2^binary_exponent()`.
+            std::uint64_t Mantissa() const noexcept
+            {
+                return exponent == 0 ? fraction : (std::uint64_t{1} << traits::mantissa_bits) | fraction;
+            }
+            int BinaryExponent() const noexcept
+            {
+                return (exponent == 0 ? 1 : exponent) - traits::exponent_bias - traits::mantissa_bits;
+            }
+
+            bool negative;
+            int exponent;
+            bits_type fraction;
+        };
+
+        /**
+         * @brief 128-bit approximations of the powers of five from 5^-342 to 5^324, normalized so that the top bit is
+         *        set. Positive powers are truncated, and negative ones are the reciprocals truncated, except that those
+         *        from 5^-27 to 5^-1 are rounded up instead. This is the table from the Eisel-Lemire algorithm's reference
+         *        implementation, fast_float, which its proof of correctness depends on, extended up to 5^324 for the
+         *        Schubfach algorithm to share.
+         */
+        inline constexpr int charconv_smallest_power_of_five = -342;
+        inline constexpr charconv_uint128 charconv_powers_of_five[] = {
+            {0xeef453d6923bd65a, 0x113faa2906a13b3f}, {0x9558b4661b6565f8, 0x4ac7ca59a424c507},
+            {0xbaaee17fa23ebf76, 0x5d79bcf00d2df649}, {0xe95a99df8ace6f53, 0xf4d82c2c107973dc},
+            {0x91d8a02bb6c10594, 0x79071b9b8a4be869}, {0xb64ec836a47146f9, 0x9748e2826cdee284},
+            {0xe3e27a444d8d98b7, 0xfd1b1b2308169b25}, {0x8e6d8c6ab0787f72, 0xfe30f0f5e50e20f7},
+            {0xb208ef855c969f4f, 0xbdbd2d335e51a935}, {0xde8b2b66b3bc4723, 0xad2c788035e61382},
+            {0x8b16fb203055ac76, 0x4c3bcb5021afcc31}, {0xaddcb9e83c6b1793, 0xdf4abe242a1bbf3d},
+            {0xd953e8624b85dd78, 0xd71d6dad34a2af0d}, {0x87d4713d6f33aa6b, 0x8672648c40e5ad68},
+            {0xa9c98d8ccb009506, 0x680efdaf511f18c2}, {0xd43bf0effdc0ba48, 0x0212bd1b2566def2},
+            {0x84a57695fe98746d, 0x014bb630f7604b57}, {0xa5ced43b7e3e9188, 0x419ea3bd35385e2d},
+            {0xcf42894a5dce35ea, 0x52064cac828675b9}, {0x818995ce7aa0e1b2, 0x7343efebd1940993},
+            {0xa1ebfb4219491a1f, 0x1014ebe6c5f90bf8}, {0xca66fa129f9b60a6, 0xd41a26e077774ef6},
+            {0xfd00b897478238d0, 0x8920b098955522b4}, {0x9e20735e8cb16382, 0x55b46e5f5d5535b0},
+            {0xc5a890362fddbc62, 0xeb2189f734aa831d}, {0xf712b443bbd52b7b, 0xa5e9ec7501d523e4},
+            {0x9a6bb0aa55653b2d, 0x47b233c92125366e}, {0xc1069cd4eabe89f8, 0x999ec0bb696e840a},
+            {0xf148440a256e2c76, 0xc00670ea43ca250d}, {0x96cd2a865764dbca, 0x380406926a5e5728},
+            {0xbc807527ed3e12bc, 0xc605083704f5ecf2}, {0xeba09271e88d976b, 0xf7864a44c633682e},
+            {0x93445b8731587ea3, 0x7ab3ee6afbe0211d}, {0xb8157268fdae9e4c, 0x5960ea05bad82964},
+            {0xe61acf033d1a45df, 0x6fb92487298e33bd}, {0x8fd0c16206306bab, 0xa5d3b6d479f8e056},
+            {0xb3c4f1ba87bc8696, 0x8f48a4899877186c}, {0xe0b62e2929aba83c, 0x331acdabfe94de87},
+            {0x8c71dcd9ba0b4925, 0x9ff0c08b7f1d0b14}, {0xaf8e5410288e1b6f, 0x07ecf0ae5ee44dd9},
+            {0xdb71e91432b1a24a, 0xc9e82cd9f69d6150}, {0x892731ac9faf056e, 0xbe311c083a225cd2},
+            {0xab70fe17c79ac6ca, 0x6dbd630a48aaf406}, {0xd64d3d9db981787d, 0x092cbbccdad5b108},
+            {0x85f0468293f0eb4e, 0x25bbf56008c58ea5}, {0xa76c582338ed2621, 0xaf2af2b80af6f24e},
+            {0xd1476e2c07286faa, 0x1af5af660db4aee1}, {0x82cca4db847945ca, 0x50d98d9fc890ed4d},
+            {0xa37fce126597973c, 0xe50ff107bab528a0}, {0xcc5fc196fefd7d0c, 0x1e53ed49a96272c8},
+            {0xff77b1fcbebcdc4f, 0x25e8e89c13bb0f7a}, {0x9faacf3df73609b1, 0x77b191618c54e9ac},
+            {0xc795830d75038c1d, 0xd59df5b9ef6a2417}, {0xf97ae3d0d2446f25, 0x4b0573286b44ad1d},
+            {0x9becce62836ac577, 0x4ee367f9430aec32}, {0xc2e801fb244576d5, 0x229c41f793cda73f},
+            {0xf3a20279ed56d48a, 0x6b43527578c1110f}, {0x9845418c345644d6, 0x830a13896b78aaa9},
+            {0xbe5691ef416bd60c, 0x23cc986bc656d553}, {0xedec366b11c6cb8f, 0x2cbfbe86b7ec8aa8},
+            {0x94b3a202eb1c3f39, 0x7bf7d71432f3d6a9}, {0xb9e08a83a5e34f07, 0xdaf5ccd93fb0cc53},
+            {0xe858ad248f5c22c9, 0xd1b3400f8f9cff68}, {0x91376c36d99995be, 0x23100809b9c21fa1},
+            {0xb58547448ffffb2d, 0xabd40a0c2832a78a}, {0xe2e69915b3fff9f9, 0x16c90c8f323f516c},
+            {0x8dd01fad907ffc3b, 0xae3da7d97f6792e3}, {0xb1442798f49ffb4a, 0x99cd11cfdf41779c},
+            {0xdd95317f31c7fa1d, 0x40405643d711d583}, {0x8a7d3eef7f1cfc52, 0x482835ea666b2572},
+            {0xad1c8eab5ee43b66, 0xda3243650005eecf}, {0xd863b256369d4a40, 0x90bed43e40076a82},
+            {0x873e4f75e2224e68, 0x5a7744a6e804a291}, {0xa90de3535aaae202, 0x711515d0a205cb36},
+            {0xd3515c2831559a83, 0x0d5a5b44ca873e03}, {0x8412d9991ed58091, 0xe858790afe9486c2},
+            {0xa5178fff668ae0b6, 0x626e974dbe39a872}, {0xce5d73ff402d98e3, 0xfb0a3d212dc8128f},
+            {0x80fa687f881c7f8e, 0x7ce66634bc9d0b99}, {0xa139029f6a239f72, 0x1c1fffc1ebc44e80},
+            {0xc987434744ac874e, 0xa327ffb266b56220}, {0xfbe9141915d7a922, 0x4bf1ff9f0062baa8},
+            {0x9d71ac8fada6c9b5, 0x6f773fc3603db4a9}, {0xc4ce17b399107c22, 0xcb550fb4384d21d3},
+            {0xf6019da07f549b2b, 0x7e2a53a146606a48}, {0x99c102844f94e0fb, 0x2eda7444cbfc426d},
+            {0xc0314325637a1939, 0xfa911155fefb5308}, {0xf03d93eebc589f88, 0x793555ab7eba27ca},
+            {0x96267c7535b763b5, 0x4bc1558b2f3458de}, {0xbbb01b9283253ca2, 0x9eb1aaedfb016f16},
+            {0xea9c227723ee8bcb, 0x465e15a979c1cadc}, {0x92a1958a7675175f, 0x0bfacd89ec191ec9},
+            {0xb749faed14125d36, 0xcef980ec671f667b}, {0xe51c79a85916f484, 0x82b7e12780e7401a},
+            {0x8f31cc0937ae58d2, 0xd1b2ecb8b0908810}, {0xb2fe3f0b8599ef07, 0x861fa7e6dcb4aa15},
+            {0xdfbdcece67006ac9, 0x67a791e093e1d49a}, {0x8bd6a141006042bd, 0xe0c8bb2c5c6d24e0},
+            {0xaecc49914078536d, 0x58fae9f773886e18}, {0xda7f5bf590966848, 0xaf39a475506a899e},
+            {0x888f99797a5e012d, 0x6d8406c952429603}, {0xaab37fd7d8f58178, 0xc8e5087ba6d33b83},
+            {0xd5605fcdcf32e1d6, 0xfb1e4a9a90880a64}, {0x855c3be0a17fcd26, 0x5cf2eea09a55067f},
+            {0xa6b34ad8c9dfc06f, 0xf42faa48c0ea481e}, {0xd0601d8efc57b08b, 0xf13b94daf124da26},
+            {0x823c12795db6ce57, 0x76c53d08d6b70858}, {0xa2cb1717b52481ed, 0x54768c4b0c64ca6e},
+            {0xcb7ddcdda26da268, 0xa9942f5dcf7dfd09}, {0xfe5d54150b090b02, 0xd3f93b35435d7c4c},
+            {0x9efa548d26e5a6e1, 0xc47bc5014a1a6daf}, {0xc6b8e9b0709f109a, 0x359ab6419ca1091b},
+            {0xf867241c8cc6d4c0, 0xc30163d203c94b62}, {0x9b407691d7fc44f8, 0x79e0de63425dcf1d},
+            {0xc21094364dfb5636, 0x985915fc12f542e4}, {0xf294b943e17a2bc4, 0x3e6f5b7b17b2939d},
+            {0x979cf3ca6cec5b5a, 0xa705992ceecf9c42}, {0xbd8430bd08277231, 0x50c6ff782a838353},
+            {0xece53cec4a314ebd, 0xa4f8bf5635246428}, {0x940f4613ae5ed136, 0x871b7795e136be99},
+            {0xb913179899f68584, 0x28e2557b59846e3f}, {0xe757dd7ec07426e5, 0x331aeada2fe589cf},
+            {0x9096ea6f3848984f, 0x3ff0d2c85def7621}, {0xb4bca50b065abe63, 0x0fed077a756b53a9},
+            {0xe1ebce4dc7f16dfb, 0xd3e8495912c62894}, {0x8d3360f09cf6e4bd, 0x64712dd7abbbd95c},
+            {0xb080392cc4349dec, 0xbd8d794d96aacfb3}, {0xdca04777f541c567, 0xecf0d7a0fc5583a0},
+            {0x89e42caaf9491b60, 0xf41686c49db57244}, {0xac5d37d5b79b6239, 0x311c2875c522ced5},
+            {0xd77485cb25823ac7, 0x7d633293366b828b}, {0x86a8d39ef77164bc, 0xae5dff9c02033197},
+            {0xa8530886b54dbdeb, 0xd9f57f830283fdfc}, {0xd267caa862a12d66, 0xd072df63c324fd7b},
+            {0x8380dea93da4bc60, 0x4247cb9e59f71e6d}, {0xa46116538d0deb78, 0x52d9be85f074e608},
+            {0xcd795be870516656, 0x67902e276c921f8b}, {0x806bd9714632dff6, 0x00ba1cd8a3db53b6},
+            {0xa086cfcd97bf97f3, 0x80e8a40eccd228a4}, {0xc8a883c0fdaf7df0, 0x6122cd128006b2cd},
+            {0xfad2a4b13d1b5d6c, 0x796b805720085f81}, {0x9cc3a6eec6311a63, 0xcbe3303674053bb0},
+            {0xc3f490aa77bd60fc, 0xbedbfc4411068a9c}, {0xf4f1b4d515acb93b, 0xee92fb5515482d44},
+            {0x991711052d8bf3c5, 0x751bdd152d4d1c4a}, {0xbf5cd54678eef0b6, 0xd262d45a78a0635d},
+            {0xef340a98172aace4, 0x86fb897116c87c34}, {0x9580869f0e7aac0e, 0xd45d35e6ae3d4da0},
+            {0xbae0a846d2195712, 0x8974836059cca109}, {0xe998d258869facd7, 0x2bd1a438703fc94b},
+            {0x91ff83775423cc06, 0x7b6306a34627ddcf}, {0xb67f6455292cbf08, 0x1a3bc84c17b1d542},
+            {0xe41f3d6a7377eeca, 0x20caba5f1d9e4a93}, {0x8e938662882af53e, 0x547eb47b7282ee9c},
+            {0xb23867fb2a35b28d, 0xe99e619a4f23aa43}, {0xdec681f9f4c31f31, 0x6405fa00e2ec94d4},
+            {0x8b3c113c38f9f37e, 0xde83bc408dd3dd04}, {0xae0b158b4738705e, 0x9624ab50b148d445},
+            {0xd98ddaee19068c76, 0x3badd624dd9b0957}, {0x87f8a8d4cfa417c9, 0xe54ca5d70a80e5d6},
+            {0xa9f6d30a038d1dbc, 0x5e9fcf4ccd211f4c}, {0xd47487cc8470652b, 0x7647c3200069671f},
+            {0x84c8d4dfd2c63f3b, 0x29ecd9f40041e073}, {0xa5fb0a17c777cf09, 0xf468107100525890},
+            {0xcf79cc9db955c2cc, 0x7182148d4066eeb4}, {0x81ac1fe293d599bf, 0xc6f14cd848405530},
+            {0xa21727db38cb002f, 0xb8ada00e5a506a7c}, {0xca9cf1d206fdc03b, 0xa6d90811f0e4851c},
+            {0xfd442e4688bd304a, 0x908f4a166d1da663}, {0x9e4a9cec15763e2e, 0x9a598e4e043287fe},
+            {0xc5dd44271ad3cdba, 0x40eff1e1853f29fd}, {0xf7549530e188c128, 0xd12bee59e68ef47c},
+            {0x9a94dd3e8cf578b9, 0x82bb74f8301958ce}, {0xc13a148e3032d6e7, 0xe36a52363c1faf01},
+            {0xf18899b1bc3f8ca1, 0xdc44e6c3cb279ac1}, {0x96f5600f15a7b7e5, 0x29ab103a5ef8c0b9},
+            {0xbcb2b812db11a5de, 0x7415d448f6b6f0e7}, {0xebdf661791d60f56, 0x111b495b3464ad21},
+            {0x936b9fcebb25c995, 0xcab10dd900beec34}, {0xb84687c269ef3bfb, 0x3d5d514f40eea742},
+            {0xe65829b3046b0afa, 0x0cb4a5a3112a5112}, {0x8ff71a0fe2c2e6dc, 0x47f0e785eaba72ab},
+            {0xb3f4e093db73a093, 0x59ed216765690f56}, {0xe0f218b8d25088b8, 0x306869c13ec3532c},
+            {0x8c974f7383725573, 0x1e414218c73a13fb}, {0xafbd2350644eeacf, 0xe5d1929ef90898fa},
+            {0xdbac6c247d62a583, 0xdf45f746b74abf39}, {0x894bc396ce5da772, 0x6b8bba8c328eb783},
+            {0xab9eb47c81f5114f, 0x066ea92f3f326564}, {0xd686619ba27255a2, 0xc80a537b0efefebd},
+            {0x8613fd0145877585, 0xbd06742ce95f5f36}, {0xa798fc4196e952e7, 0x2c48113823b73704},
+            {0xd17f3b51fca3a7a0, 0xf75a15862ca504c5}, {0x82ef85133de648c4, 0x9a984d73dbe722fb},
+            {0xa3ab66580d5fdaf5, 0xc13e60d0d2e0ebba}, {0xcc963fee10b7d1b3, 0x318df905079926a8},
+            {0xffbbcfe994e5c61f, 0xfdf17746497f7052}, {0x9fd561f1fd0f9bd3, 0xfeb6ea8bedefa633},
+            {0xc7caba6e7c5382c8, 0xfe64a52ee96b8fc0}, {0xf9bd690a1b68637b, 0x3dfdce7aa3c673b0},
+            {0x9c1661a651213e2d, 0x06bea10ca65c084e}, {0xc31bfa0fe5698db8, 0x486e494fcff30a62},
+            {0xf3e2f893dec3f126, 0x5a89dba3c3efccfa}, {0x986ddb5c6b3a76b7, 0xf89629465a75e01c},
+            {0xbe89523386091465, 0xf6bbb397f1135823}, {0xee2ba6c0678b597f, 0x746aa07ded582e2c},
+            {0x94db483840b717ef, 0xa8c2a44eb4571cdc}, {0xba121a4650e4ddeb, 0x92f34d62616ce413},
+            {0xe896a0d7e51e1566, 0x77b020baf9c81d17}, {0x915e2486ef32cd60, 0x0ace1474dc1d122e},
+            {0xb5b5ada8aaff80b8, 0x0d819992132456ba}, {0xe3231912d5bf60e6, 0x10e1fff697ed6c69},
+            {0x8df5efabc5979c8f, 0xca8d3ffa1ef463c1}, {0xb1736b96b6fd83b3, 0xbd308ff8a6b17cb2},
+            {0xddd0467c64bce4a0, 0xac7cb3f6d05ddbde}, {0x8aa22c0dbef60ee4, 0x6bcdf07a423aa96b},
+            {0xad4ab7112eb3929d, 0x86c16c98d2c953c6}, {0xd89d64d57a607744, 0xe871c7bf077ba8b7},
+            {0x87625f056c7c4a8b, 0x11471cd764ad4972}, {0xa93af6c6c79b5d2d, 0xd598e40d3dd89bcf},
+            {0xd389b47879823479, 0x4aff1d108d4ec2c3}, {0x843610cb4bf160cb, 0xcedf722a585139ba},
+            {0xa54394fe1eedb8fe, 0xc2974eb4ee658828}, {0xce947a3da6a9273e, 0x733d226229feea32},
+            {0x811ccc668829b887, 0x0806357d5a3f525f}, {0xa163ff802a3426a8, 0xca07c2dcb0cf26f7},
+            {0xc9bcff6034c13052, 0xfc89b393dd02f0b5}, {0xfc2c3f3841f17c67, 0xbbac2078d443ace2},
+            {0x9d9ba7832936edc0, 0xd54b944b84aa4c0d}, {0xc5029163f384a931, 0x0a9e795e65d4df11},
+            {0xf64335bcf065d37d, 0x4d4617b5ff4a16d5}, {0x99ea0196163fa42e, 0x504bced1bf8e4e45},
+            {0xc06481fb9bcf8d39, 0xe45ec2862f71e1d6}, {0xf07da27a82c37088, 0x5d767327bb4e5a4c},
+            {0x964e858c91ba2655, 0x3a6a07f8d510f86f}, {0xbbe226efb628afea, 0x890489f70a55368b},
+            {0xeadab0aba3b2dbe5, 0x2b45ac74ccea842e}, {0x92c8ae6b464fc96f, 0x3b0b8bc90012929d},
+            {0xb77ada0617e3bbcb, 0x09ce6ebb40173744}, {0xe55990879ddcaabd, 0xcc420a6a101d0515},
+            {0x8f57fa54c2a9eab6, 0x9fa946824a12232d}, {0xb32df8e9f3546564, 0x47939822dc96abf9},
+            {0xdff9772470297ebd, 0x59787e2b93bc56f7}, {0x8bfbea76c619ef36, 0x57eb4edb3c55b65a},
+            {0xaefae51477a06b03, 0xede622920b6b23f1}, {0xdab99e59958885c4, 0xe95fab368e45eced},
+            {0x88b402f7fd75539b, 0x11dbcb0218ebb414}, {0xaae103b5fcd2a881, 0xd652bdc29f26a119},
+            {0xd59944a37c0752a2, 0x4be76d3346f0495f}, {0x857fcae62d8493a5, 0x6f70a4400c562ddb},
+            {0xa6dfbd9fb8e5b88e, 0xcb4ccd500f6bb952}, {0xd097ad07a71f26b2, 0x7e2000a41346a7a7},
+            {0x825ecc24c873782f, 0x8ed400668c0c28c8}, {0xa2f67f2dfa90563b, 0x728900802f0f32fa},
+            {0xcbb41ef979346bca, 0x4f2b40a03ad2ffb9}, {0xfea126b7d78186bc, 0xe2f610c84987bfa8},
+            {0x9f24b832e6b0f436, 0x0dd9ca7d2df4d7c9}, {0xc6ede63fa05d3143, 0x91503d1c79720dbb},
+            {0xf8a95fcf88747d94, 0x75a44c6397ce912a}, {0x9b69dbe1b548ce7c, 0xc986afbe3ee11aba},
+            {0xc24452da229b021b, 0xfbe85badce996168}, {0xf2d56790ab41c2a2, 0xfae27299423fb9c3},
+            {0x97c560ba6b0919a5, 0xdccd879fc967d41a}, {0xbdb6b8e905cb600f, 0x5400e987bbc1c920},
+            {0xed246723473e3813, 0x290123e9aab23b68}, {0x9436c0760c86e30b, 0xf9a0b6720aaf6521},
+            {0xb94470938fa89bce, 0xf808e40e8d5b3e69}, {0xe7958cb87392c2c2, 0xb60b1d1230b20e04},
+            {0x90bd77f3483bb9b9, 0xb1c6f22b5e6f48c2}, {0xb4ecd5f01a4aa828, 0x1e38aeb6360b1af3},
+            {0xe2280b6c20dd5232, 0x25c6da63c38de1b0}, {0x8d590723948a535f, 0x579c487e5a38ad0e},
+            {0xb0af48ec79ace837, 0x2d835a9df0c6d851}, {0xdcdb1b2798182244, 0xf8e431456cf88e65},
+            {0x8a08f0f8bf0f156b, 0x1b8e9ecb641b58ff}, {0xac8b2d36eed2dac5, 0xe272467e3d222f3f},
+            {0xd7adf884aa879177, 0x5b0ed81dcc6abb0f}, {0x86ccbb52ea94baea, 0x98e947129fc2b4e9},
+            {0xa87fea27a539e9a5, 0x3f2398d747b36224}, {0xd29fe4b18e88640e, 0x8eec7f0d19a03aad},
+            {0x83a3eeeef9153e89, 0x1953cf68300424ac}, {0xa48ceaaab75a8e2b, 0x5fa8c3423c052dd7},
+            {0xcdb02555653131b6, 0x3792f412cb06794d}, {0x808e17555f3ebf11, 0xe2bbd88bbee40bd0},
+            {0xa0b19d2ab70e6ed6, 0x5b6aceaeae9d0ec4}, {0xc8de047564d20a8b, 0xf245825a5a445275},
+            {0xfb158592be068d2e, 0xeed6e2f0f0d56712}, {0x9ced737bb6c4183d, 0x55464dd69685606b},
+            {0xc428d05aa4751e4c, 0xaa97e14c3c26b886}, {0xf53304714d9265df, 0xd53dd99f4b3066a8},
+            {0x993fe2c6d07b7fab, 0xe546a8038efe4029}, {0xbf8fdb78849a5f96, 0xde98520472bdd033},
+            {0xef73d256a5c0f77c, 0x963e66858f6d4440}, {0x95a8637627989aad, 0xdde7001379a44aa8},
+            {0xbb127c53b17ec159, 0x5560c018580d5d52}, {0xe9d71b689dde71af, 0xaab8f01e6e10b4a6},
+            {0x9226712162ab070d, 0xcab3961304ca70e8}, {0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d22},
+            {0xe45c10c42a2b3b05, 0x8cb89a7db77c506a}, {0x8eb98a7a9a5b04e3, 0x77f3608e92adb242},
+            {0xb267ed1940f1c61c, 0x55f038b237591ed3}, {0xdf01e85f912e37a3, 0x6b6c46dec52f6688},
+            {0x8b61313bbabce2c6, 0x2323ac4b3b3da015}, {0xae397d8aa96c1b77, 0xabec975e0a0d081a},
+            {0xd9c7dced53c72255, 0x96e7bd358c904a21}, {0x881cea14545c7575, 0x7e50d64177da2e54},
+            {0xaa242499697392d2, 0xdde50bd1d5d0b9e9}, {0xd4ad2dbfc3d07787, 0x955e4ec64b44e864},
+            {0x84ec3c97da624ab4, 0xbd5af13bef0b113e}, {0xa6274bbdd0fadd61, 0xecb1ad8aeacdd58e},
+            {0xcfb11ead453994ba, 0x67de18eda5814af2}, {0x81ceb32c4b43fcf4, 0x80eacf948770ced7},
+            {0xa2425ff75e14fc31, 0xa1258379a94d028d}, {0xcad2f7f5359a3b3e, 0x096ee45813a04330},
+            {0xfd87b5f28300ca0d, 0x8bca9d6e188853fc}, {0x9e74d1b791e07e48, 0x775ea264cf55347e},
+            {0xc612062576589dda, 0x95364afe032a819e}, {0xf79687aed3eec551, 0x3a83ddbd83f52205},
+            {0x9abe14cd44753b52, 0xc4926a9672793543}, {0xc16d9a0095928a27, 0x75b7053c0f178294},
+            {0xf1c90080baf72cb1, 0x5324c68b12dd6339}, {0x971da05074da7bee, 0xd3f6fc16ebca5e04},
+            {0xbce5086492111aea, 0x88f4bb1ca6bcf585}, {0xec1e4a7db69561a5, 0x2b31e9e3d06c32e6},
+            {0x9392ee8e921d5d07, 0x3aff322e62439fd0}, {0xb877aa3236a4b449, 0x09befeb9fad487c3},
+            {0xe69594bec44de15b, 0x4c2ebe687989a9b4}, {0x901d7cf73ab0acd9, 0x0f9d37014bf60a11},
+            {0xb424dc35095cd80f, 0x538484c19ef38c95}, {0xe12e13424bb40e13, 0x2865a5f206b06fba},
+            {0x8cbccc096f5088cb, 0xf93f87b7442e45d4}, {0xafebff0bcb24aafe, 0xf78f69a51539d749},
+            {0xdbe6fecebdedd5be, 0xb573440e5a884d1c}, {0x89705f4136b4a597, 0x31680a88f8953031},
+            {0xabcc77118461cefc, 0xfdc20d2b36ba7c3e}, {0xd6bf94d5e57a42bc, 0x3d32907604691b4d},
+            {0x8637bd05af6c69b5, 0xa63f9a49c2c1b110}, {0xa7c5ac471b478423, 0x0fcf80dc33721d54},
+            {0xd1b71758e219652b, 0xd3c36113404ea4a9}, {0x83126e978d4fdf3b, 0x645a1cac083126ea},
+            {0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a4}, {0xcccccccccccccccc, 0xcccccccccccccccd},
+            {0x8000000000000000, 0x0000000000000000}, {0xa000000000000000, 0x0000000000000000},
+            {0xc800000000000000, 0x0000000000000000}, {0xfa00000000000000, 0x0000000000000000},
+            {0x9c40000000000000, 0x0000000000000000}, {0xc350000000000000, 0x0000000000000000},
+            {0xf424000000000000, 0x0000000000000000}, {0x9896800000000000, 0x0000000000000000},
+            {0xbebc200000000000, 0x0000000000000000}, {0xee6b280000000000, 0x0000000000000000},
+            {0x9502f90000000000, 0x0000000000000000}, {0xba43b74000000000, 0x0000000000000000},
+            {0xe8d4a51000000000, 0x0000000000000000}, {0x9184e72a00000000, 0x0000000000000000},
+            {0xb5e620f480000000, 0x0000000000000000}, {0xe35fa931a0000000, 0x0000000000000000},
+            {0x8e1bc9bf04000000, 0x0000000000000000}, {0xb1a2bc2ec5000000, 0x0000000000000000},
+            {0xde0b6b3a76400000, 0x0000000000000000}, {0x8ac7230489e80000, 0x0000000000000000},
+            {0xad78ebc5ac620000, 0x0000000000000000}, {0xd8d726b7177a8000, 0x0000000000000000},
+            {0x878678326eac9000, 0x0000000000000000}, {0xa968163f0a57b400, 0x0000000000000000},
+            {0xd3c21bcecceda100, 0x0000000000000000}, {0x84595161401484a0, 0x0000000000000000},
+            {0xa56fa5b99019a5c8, 0x0000000000000000}, {0xcecb8f27f4200f3a, 0x0000000000000000},
+            {0x813f3978f8940984, 0x4000000000000000}, {0xa18f07d736b90be5, 0x5000000000000000},
+            {0xc9f2c9cd04674ede, 0xa400000000000000}, {0xfc6f7c4045812296, 0x4d00000000000000},
+            {0x9dc5ada82b70b59d, 0xf020000000000000}, {0xc5371912364ce305, 0x6c28000000000000},
+            {0xf684df56c3e01bc6, 0xc732000000000000}, {0x9a130b963a6c115c, 0x3c7f400000000000},
+            {0xc097ce7bc90715b3, 0x4b9f100000000000}, {0xf0bdc21abb48db20, 0x1e86d40000000000},
+            {0x96769950b50d88f4, 0x1314448000000000}, {0xbc143fa4e250eb31, 0x17d955a000000000},
+            {0xeb194f8e1ae525fd, 0x5dcfab0800000000}, {0x92efd1b8d0cf37be, 0x5aa1cae500000000},
+            {0xb7abc627050305ad, 0xf14a3d9e40000000}, {0xe596b7b0c643c719, 0x6d9ccd05d0000000},
+            {0x8f7e32ce7bea5c6f, 0xe4820023a2000000}, {0xb35dbf821ae4f38b, 0xdda2802c8a800000},
+            {0xe0352f62a19e306e, 0xd50b2037ad200000}, {0x8c213d9da502de45, 0x4526f422cc340000},
+            {0xaf298d050e4395d6, 0x9670b12b7f410000}, {0xdaf3f04651d47b4c, 0x3c0cdd765f114000},
+            {0x88d8762bf324cd0f, 0xa5880a69fb6ac800}, {0xab0e93b6efee0053, 0x8eea0d047a457a00},
+            {0xd5d238a4abe98068, 0x72a4904598d6d880}, {0x85a36366eb71f041, 0x47a6da2b7f864750},
+            {0xa70c3c40a64e6c51, 0x999090b65f67d924}, {0xd0cf4b50cfe20765, 0xfff4b4e3f741cf6d},
+            {0x82818f1281ed449f, 0xbff8f10e7a8921a4}, {0xa321f2d7226895c7, 0xaff72d52192b6a0d},
+            {0xcbea6f8ceb02bb39, 0x9bf4f8a69f764490}, {0xfee50b7025c36a08, 0x02f236d04753d5b4},
+            {0x9f4f2726179a2245, 0x01d762422c946590}, {0xc722f0ef9d80aad6, 0x424d3ad2b7b97ef5},
+            {0xf8ebad2b84e0d58b, 0xd2e0898765a7deb2}, {0x9b934c3b330c8577, 0x63cc55f49f88eb2f},
+            {0xc2781f49ffcfa6d5, 0x3cbf6b71c76b25fb}, {0xf316271c7fc3908a, 0x8bef464e3945ef7a},
+            {0x97edd871cfda3a56, 0x97758bf0e3cbb5ac}, {0xbde94e8e43d0c8ec, 0x3d52eeed1cbea317},
+            {0xed63a231d4c4fb27, 0x4ca7aaa863ee4bdd}, {0x945e455f24fb1cf8, 0x8fe8caa93e74ef6a},
+            {0xb975d6b6ee39e436, 0xb3e2fd538e122b44}, {0xe7d34c64a9c85d44, 0x60dbbca87196b616},
+            {0x90e40fbeea1d3a4a, 0xbc8955e946fe31cd}, {0xb51d13aea4a488dd, 0x6babab6398bdbe41},
+            {0xe264589a4dcdab14, 0xc696963c7eed2dd1}, {0x8d7eb76070a08aec, 0xfc1e1de5cf543ca2},
+            {0xb0de65388cc8ada8, 0x3b25a55f43294bcb}, {0xdd15fe86affad912, 0x49ef0eb713f39ebe},
+            {0x8a2dbf142dfcc7ab, 0x6e3569326c784337}, {0xacb92ed9397bf996, 0x49c2c37f07965404},
+            {0xd7e77a8f87daf7fb, 0xdc33745ec97be906}, {0x86f0ac99b4e8dafd, 0x69a028bb3ded71a3},
+            {0xa8acd7c0222311bc, 0xc40832ea0d68ce0c}, {0xd2d80db02aabd62b, 0xf50a3fa490c30190},
+            {0x83c7088e1aab65db, 0x792667c6da79e0fa}, {0xa4b8cab1a1563f52, 0x577001b891185938},
+            {0xcde6fd5e09abcf26, 0xed4c0226b55e6f86}, {0x80b05e5ac60b6178, 0x544f8158315b05b4},
+            {0xa0dc75f1778e39d6, 0x696361ae3db1c721}, {0xc913936dd571c84c, 0x03bc3a19cd1e38e9},
+            {0xfb5878494ace3a5f, 0x04ab48a04065c723}, {0x9d174b2dcec0e47b, 0x62eb0d64283f9c76},
+            {0xc45d1df942711d9a, 0x3ba5d0bd324f8394}, {0xf5746577930d6500, 0xca8f44ec7ee36479},
+            {0x9968bf6abbe85f20, 0x7e998b13cf4e1ecb}, {0xbfc2ef456ae276e8, 0x9e3fedd8c321a67e},
+            {0xefb3ab16c59b14a2, 0xc5cfe94ef3ea101e}, {0x95d04aee3b80ece5, 0xbba1f1d158724a12},
+            {0xbb445da9ca61281f, 0x2a8a6e45ae8edc97}, {0xea1575143cf97226, 0xf52d09d71a3293bd},
+            {0x924d692ca61be758, 0x593c2626705f9c56}, {0xb6e0c377cfa2e12e, 0x6f8b2fb00c77836c},
+            {0xe498f455c38b997a, 0x0b6dfb9c0f956447}, {0x8edf98b59a373fec, 0x4724bd4189bd5eac},
+            {0xb2977ee300c50fe7, 0x58edec91ec2cb657}, {0xdf3d5e9bc0f653e1, 0x2f2967b66737e3ed},
+            {0x8b865b215899f46c, 0xbd79e0d20082ee74}, {0xae67f1e9aec07187, 0xecd8590680a3aa11},
+            {0xda01ee641a708de9, 0xe80e6f4820cc9495}, {0x884134fe908658b2, 0x3109058d147fdcdd},
+            {0xaa51823e34a7eede, 0xbd4b46f0599fd415}, {0xd4e5e2cdc1d1ea96, 0x6c9e18ac7007c91a},
+            {0x850fadc09923329e, 0x03e2cf6bc604ddb0}, {0xa6539930bf6bff45, 0x84db8346b786151c},
+            {0xcfe87f7cef46ff16, 0xe612641865679a63}, {0x81f14fae158c5f6e, 0x4fcb7e8f3f60c07e},
+            {0xa26da3999aef7749, 0xe3be5e330f38f09d}, {0xcb090c8001ab551c, 0x5cadf5bfd3072cc5},
+            {0xfdcb4fa002162a63, 0x73d9732fc7c8f7f6}, {0x9e9f11c4014dda7e, 0x2867e7fddcdd9afa},
+            {0xc646d63501a1511d, 0xb281e1fd541501b8}, {0xf7d88bc24209a565, 0x1f225a7ca91a4226},
+            {0x9ae757596946075f, 0x3375788de9b06958}, {0xc1a12d2fc3978937, 0x0052d6b1641c83ae},
+            {0xf209787bb47d6b84, 0xc0678c5dbd23a49a}, {0x9745eb4d50ce6332, 0xf840b7ba963646e0},
+            {0xbd176620a501fbff, 0xb650e5a93bc3d898}, {0xec5d3fa8ce427aff, 0xa3e51f138ab4cebe},
+            {0x93ba47c980e98cdf, 0xc66f336c36b10137}, {0xb8a8d9bbe123f017, 0xb80b0047445d4184},
+            {0xe6d3102ad96cec1d, 0xa60dc059157491e5}, {0x9043ea1ac7e41392, 0x87c89837ad68db2f},
+            {0xb454e4a179dd1877, 0x29babe4598c311fb}, {0xe16a1dc9d8545e94, 0xf4296dd6fef3d67a},
+            {0x8ce2529e2734bb1d, 0x1899e4a65f58660c}, {0xb01ae745b101e9e4, 0x5ec05dcff72e7f8f},
+            {0xdc21a1171d42645d, 0x76707543f4fa1f73}, {0x899504ae72497eba, 0x6a06494a791c53a8},
+            {0xabfa45da0edbde69, 0x0487db9d17636892}, {0xd6f8d7509292d603, 0x45a9d2845d3c42b6},
+            {0x865b86925b9bc5c2, 0x0b8a2392ba45a9b2}, {0xa7f26836f282b732, 0x8e6cac7768d7141e},
+            {0xd1ef0244af2364ff, 0x3207d795430cd926}, {0x8335616aed761f1f, 0x7f44e6bd49e807b8},
+            {0xa402b9c5a8d3a6e7, 0x5f16206c9c6209a6}, {0xcd036837130890a1, 0x36dba887c37a8c0f},
+            {0x802221226be55a64, 0xc2494954da2c9789}, {0xa02aa96b06deb0fd, 0xf2db9baa10b7bd6c},
+            {0xc83553c5c8965d3d, 0x6f92829494e5acc7}, {0xfa42a8b73abbf48c, 0xcb772339ba1f17f9},
+            {0x9c69a97284b578d7, 0xff2a760414536efb}, {0xc38413cf25e2d70d, 0xfef5138519684aba},
+            {0xf46518c2ef5b8cd1, 0x7eb258665fc25d69}, {0x98bf2f79d5993802, 0xef2f773ffbd97a61},
+            {0xbeeefb584aff8603, 0xaafb550ffacfd8fa}, {0xeeaaba2e5dbf6784, 0x95ba2a53f983cf38},
+            {0x952ab45cfa97a0b2, 0xdd945a747bf26183}, {0xba756174393d88df, 0x94f971119aeef9e4},
+            {0xe912b9d1478ceb17, 0x7a37cd5601aab85d}, {0x91abb422ccb812ee, 0xac62e055c10ab33a},
+            {0xb616a12b7fe617aa, 0x577b986b314d6009}, {0xe39c49765fdf9d94, 0xed5a7e85fda0b80b},
+            {0x8e41ade9fbebc27d, 0x14588f13be847307}, {0xb1d219647ae6b31c, 0x596eb2d8ae258fc8},
+            {0xde469fbd99a05fe3, 0x6fca5f8ed9aef3bb}, {0x8aec23d680043bee, 0x25de7bb9480d5854},
+            {0xada72ccc20054ae9, 0xaf561aa79a10ae6a}, {0xd910f7ff28069da4, 0x1b2ba1518094da04},
+            {0x87aa9aff79042286, 0x90fb44d2f05d0842}, {0xa99541bf57452b28, 0x353a1607ac744a53},
+            {0xd3fa922f2d1675f2, 0x42889b8997915ce8}, {0x847c9b5d7c2e09b7, 0x69956135febada11},
+            {0xa59bc234db398c25, 0x43fab9837e699095}, {0xcf02b2c21207ef2e, 0x94f967e45e03f4bb},
+            {0x8161afb94b44f57d, 0x1d1be0eebac278f5}, {0xa1ba1ba79e1632dc, 0x6462d92a69731732},
+            {0xca28a291859bbf93, 0x7d7b8f7503cfdcfe}, {0xfcb2cb35e702af78, 0x5cda735244c3d43e},
+            {0x9defbf01b061adab, 0x3a0888136afa64a7}, {0xc56baec21c7a1916, 0x088aaa1845b8fdd0},
+            {0xf6c69a72a3989f5b, 0x8aad549e57273d45}, {0x9a3c2087a63f6399, 0x36ac54e2f678864b},
+            {0xc0cb28a98fcf3c7f, 0x84576a1bb416a7dd}, {0xf0fdf2d3f3c30b9f, 0x656d44a2a11c51d5},
+            {0x969eb7c47859e743, 0x9f644ae5a4b1b325}, {0xbc4665b596706114, 0x873d5d9f0dde1fee},
+            {0xeb57ff22fc0c7959, 0xa90cb506d155a7ea}, {0x9316ff75dd87cbd8, 0x09a7f12442d588f2},
+            {0xb7dcbf5354e9bece, 0x0c11ed6d538aeb2f}, {0xe5d3ef282a242e81, 0x8f1668c8a86da5fa},
+            {0x8fa475791a569d10, 0xf96e017d694487bc}, {0xb38d92d760ec4455, 0x37c981dcc395a9ac},
+            {0xe070f78d3927556a, 0x85bbe253f47b1417}, {0x8c469ab843b89562, 0x93956d7478ccec8e},
+            {0xaf58416654a6babb, 0x387ac8d1970027b2}, {0xdb2e51bfe9d0696a, 0x06997b05fcc0319e},
+            {0x88fcf317f22241e2, 0x441fece3bdf81f03}, {0xab3c2fddeeaad25a, 0xd527e81cad7626c3},
+            {0xd60b3bd56a5586f1, 0x8a71e223d8d3b074}, {0x85c7056562757456, 0xf6872d5667844e49},
+            {0xa738c6bebb12d16c, 0xb428f8ac016561db}, {0xd106f86e69d785c7, 0xe13336d701beba52},
+            {0x82a45b450226b39c, 0xecc0024661173473}, {0xa34d721642b06084, 0x27f002d7f95d0190},
+            {0xcc20ce9bd35c78a5, 0x31ec038df7b441f4}, {0xff290242c83396ce, 0x7e67047175a15271},
+            {0x9f79a169bd203e41, 0x0f0062c6e984d386}, {0xc75809c42c684dd1, 0x52c07b78a3e60868},
+            {0xf92e0c3537826145, 0xa7709a56ccdf8a82}, {0x9bbcc7a142b17ccb, 0x88a66076400bb691},
+            {0xc2abf989935ddbfe, 0x6acff893d00ea435}, {0xf356f7ebf83552fe, 0x0583f6b8c4124d43},
+            {0x98165af37b2153de, 0xc3727a337a8b704a}, {0xbe1bf1b059e9a8d6, 0x744f18c0592e4c5c},
+            {0xeda2ee1c7064130c, 0x1162def06f79df73}, {0x9485d4d1c63e8be7, 0x8addcb5645ac2ba8},
+            {0xb9a74a0637ce2ee1, 0x6d953e2bd7173692}, {0xe8111c87c5c1ba99, 0xc8fa8db6ccdd0437},
+            {0x910ab1d4db9914a0, 0x1d9c9892400a22a2}, {0xb54d5e4a127f59c8, 0x2503beb6d00cab4b},
+            {0xe2a0b5dc971f303a, 0x2e44ae64840fd61d}, {0x8da471a9de737e24, 0x5ceaecfed289e5d2},
+            {0xb10d8e1456105dad, 0x7425a83e872c5f47}, {0xdd50f1996b947518, 0xd12f124e28f77719},
+            {0x8a5296ffe33cc92f, 0x82bd6b70d99aaa6f}, {0xace73cbfdc0bfb7b, 0x636cc64d1001550b},
+            {0xd8210befd30efa5a, 0x3c47f7e05401aa4e}, {0x8714a775e3e95c78, 0x65acfaec34810a71},
+            {0xa8d9d1535ce3b396, 0x7f1839a741a14d0d}, {0xd31045a8341ca07c, 0x1ede48111209a050},
+            {0x83ea2b892091e44d, 0x934aed0aab460432}, {0xa4e4b66b68b65d60, 0xf81da84d5617853f},
+            {0xce1de40642e3f4b9, 0x36251260ab9d668e}, {0x80d2ae83e9ce78f3, 0xc1d72b7c6b426019},
+            {0xa1075a24e4421730, 0xb24cf65b8612f81f}, {0xc94930ae1d529cfc, 0xdee033f26797b627},
+            {0xfb9b7cd9a4a7443c, 0x169840ef017da3b1}, {0x9d412e0806e88aa5, 0x8e1f289560ee864e},
+            {0xc491798a08a2ad4e, 0xf1a6f2bab92a27e2}, {0xf5b5d7ec8acb58a2, 0xae10af696774b1db},
+            {0x9991a6f3d6bf1765, 0xacca6da1e0a8ef29}, {0xbff610b0cc6edd3f, 0x17fd090a58d32af3},
+            {0xeff394dcff8a948e, 0xddfc4b4cef07f5b0}, {0x95f83d0a1fb69cd9, 0x4abdaf101564f98e},
+            {0xbb764c4ca7a4440f, 0x9d6d1ad41abe37f1}, {0xea53df5fd18d5513, 0x84c86189216dc5ed},
+            {0x92746b9be2f8552c, 0x32fd3cf5b4e49bb4}, {0xb7118682dbb66a77, 0x3fbc8c33221dc2a1},
+            {0xe4d5e82392a40515, 0x0fabaf3feaa5334a}, {0x8f05b1163ba6832d, 0x29cb4d87f2a7400e},
+            {0xb2c71d5bca9023f8, 0x743e20e9ef511012}, {0xdf78e4b2bd342cf6, 0x914da9246b255416},
+            {0x8bab8eefb6409c1a, 0x1ad089b6c2f7548e}, {0xae9672aba3d0c320, 0xa184ac2473b529b1},
+            {0xda3c0f568cc4f3e8, 0xc9e5d72d90a2741e}, {0x8865899617fb1871, 0x7e2fa67c7a658892},
+            {0xaa7eebfb9df9de8d, 0xddbb901b98feeab7}, {0xd51ea6fa85785631, 0x552a74227f3ea565},
+            {0x8533285c936b35de, 0xd53a88958f87275f}, {0xa67ff273b8460356, 0x8a892abaf368f137},
+            {0xd01fef10a657842c, 0x2d2b7569b0432d85}, {0x8213f56a67f6b29b, 0x9c3b29620e29fc73},
+            {0xa298f2c501f45f42, 0x8349f3ba91b47b8f}, {0xcb3f2f7642717713, 0x241c70a936219a73},
+            {0xfe0efb53d30dd4d7, 0xed238cd383aa0110}, {0x9ec95d1463e8a506, 0xf4363804324a40aa},
+            {0xc67bb4597ce2ce48, 0xb143c6053edcd0d5}, {0xf81aa16fdc1b81da, 0xdd94b7868e94050a},
+            {0x9b10a4e5e9913128, 0xca7cf2b4191c8326}, {0xc1d4ce1f63f57d72, 0xfd1c2f611f63a3f0},
+            {0xf24a01a73cf2dccf, 0xbc633b39673c8cec}, {0x976e41088617ca01, 0xd5be0503e085d813},
+            {0xbd49d14aa79dbc82, 0x4b2d8644d8a74e18}, {0xec9c459d51852ba2, 0xddf8e7d60ed1219e},
+            {0x93e1ab8252f33b45, 0xcabb90e5c942b503}, {0xb8da1662e7b00a17, 0x3d6a751f3b936243},
+            {0xe7109bfba19c0c9d, 0x0cc512670a783ad4}, {0x906a617d450187e2, 0x27fb2b80668b24c5},
+            {0xb484f9dc9641e9da, 0xb1f9f660802dedf6}, {0xe1a63853bbd26451, 0x5e7873f8a0396973},
+            {0x8d07e33455637eb2, 0xdb0b487b6423e1e8}, {0xb049dc016abc5e5f, 0x91ce1a9a3d2cda62},
+            {0xdc5c5301c56b75f7, 0x7641a140cc7810fb}, {0x89b9b3e11b6329ba, 0xa9e904c87fcb0a9d},
+            {0xac2820d9623bf429, 0x546345fa9fbdcd44}, {0xd732290fbacaf133, 0xa97c177947ad4095},
+            {0x867f59a9d4bed6c0, 0x49ed8eabcccc485d}, {0xa81f301449ee8c70, 0x5c68f256bfff5a74},
+            {0xd226fc195c6a2f8c, 0x73832eec6fff3111}, {0x83585d8fd9c25db7, 0xc831fd53c5ff7eab},
+            {0xa42e74f3d032f525, 0xba3e7ca8b77f5e55}, {0xcd3a1230c43fb26f, 0x28ce1bd2e55f35eb},
+            {0x80444b5e7aa7cf85, 0x7980d163cf5b81b3}, {0xa0555e361951c366, 0xd7e105bcc332621f},
+            {0xc86ab5c39fa63440, 0x8dd9472bf3fefaa7}, {0xfa856334878fc150, 0xb14f98f6f0feb951},
+            {0x9c935e00d4b9d8d2, 0x6ed1bf9a569f33d3}, {0xc3b8358109e84f07, 0x0a862f80ec4700c8},
+            {0xf4a642e14c6262c8, 0xcd27bb612758c0fa}, {0x98e7e9cccfbd7dbd, 0x8038d51cb897789c},
+            {0xbf21e44003acdd2c, 0xe0470a63e6bd56c3}, {0xeeea5d5004981478, 0x1858ccfce06cac74},
+            {0x95527a5202df0ccb, 0x0f37801e0c43ebc8}, {0xbaa718e68396cffd, 0xd30560258f54e6ba},
+            {0xe950df20247c83fd, 0x47c6b82ef32a2069}, {0x91d28b7416cdd27e, 0x4cdc331d57fa5441},
+            {0xb6472e511c81471d, 0xe0133fe4adf8e952}, {0xe3d8f9e563a198e5, 0x58180fddd97723a6},
+            {0x8e679c2f5e44ff8f, 0x570f09eaa7ea7648}, {0xb201833b35d63f73, 0x2cd2cc6551e513da},
+            {0xde81e40a034bcf4f, 0xf8077f7ea65e58d1}, {0x8b112e86420f6191, 0xfb04afaf27faf782},
+            {0xadd57a27d29339f6, 0x79c5db9af1f9b563}, {0xd94ad8b1c7380874, 0x18375281ae7822bc},
+            {0x87cec76f1c830548, 0x8f2293910d0b15b5}, {0xa9c2794ae3a3c69a, 0xb2eb3875504ddb22},
+            {0xd433179d9c8cb841, 0x5fa60692a46151eb}, {0x849feec281d7f328, 0xdbc7c41ba6bcd333},
+            {0xa5c7ea73224deff3, 0x12b9b522906c0800}, {0xcf39e50feae16bef, 0xd768226b34870a00},
+            {0x81842f29f2cce375, 0xe6a1158300d46640}, {0xa1e53af46f801c53, 0x60495ae3c1097fd0},
+            {0xca5e89b18b602368, 0x385bb19cb14bdfc4}, {0xfcf62c1dee382c42, 0x46729e03dd9ed7b5},
+            {0x9e19db92b4e31ba9, 0x6c07a2c26a8346d1}
+        };
+
+        //
+        // Floating point: the shortest representation.
+        //
+
+        struct charconv_decimal
+        {
+            std::uint64_t digits;
+            int exponent;
+        };
+
+        /**
+         * @brief The Schubfach algorithm's power of ten: floor(10^k * 2^r) + 1, for the r that puts the top bit at 127.
+         *        Those are our power of five table's entries, plus one where the table truncated.
+         */
+        inline charconv_uint128 charconv_schubfach_power_of_ten(int k) noexcept
+        {
+            charconv_uint128 power = charconv_powers_of_five[k - charconv_smallest_power_of_five];
+            if (k < -27 || k >= 0)
+            {
+                ++power.low;
+                power.high += power.low == 0 ? 1 : 0;
+            }
+            return power;
+        }
+
+        /**
+         * @brief floor(g * cp / 2^128), with the lowest bit set when that's inexact. Only the sign of the remainder
+         *        matters to the algorithm, which this keeps.
+         */
+        inline std::uint64_t charconv_round_to_odd(charconv_uint128 g, std::uint64_t cp) noexcept
+        {
+            const charconv_uint128 low = charconv_multiply_64x64(g.low, cp);
+            const charconv_uint128 high = charconv_multiply_64x64(g.high, cp);
+
+            const std::uint64_t middle = high.low + low.high;
+            const std::uint64_t top = high.high + (middle < high.low ? 1 : 0);
+            return top | (middle > 1 ? 1 : 0);
+        }
+
+        inline std::uint32_t charconv_round_to_odd(std::uint64_t g, std::uint32_t cp) noexcept
+        {
+            const charconv_uint128 product = charconv_multiply_64x64(g, cp);
+            const std::uint32_t top = static_cast<std::uint32_t>(product.high);
+            const std::uint32_t middle = static_cast<std::uint32_t>(product.low >> 32);
+            return top | (middle > 1 ? 1 : 0);
+        }
+
+        /**
+         * @brief The Schubfach algorithm, by Raffaello Giulietti, following Alexander Bolz's C++ implementation. Finds
+         *        the shortest decimal in the rounding interval of `c * 2^q`, picking the closest when there are several,
+         *        from three round-to-odd products: one for each bound of the interval, and one for the value. The
+         *        value must not be zero. The digits may have trailing zeros.
+         */
+        template <class T>
+        charconv_decimal charconv_schubfach(const charconv_float_fields<T>& fields) noexcept
+        {
+            using traits = charconv_float_traits<T>;
+            using carrier = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+            const carrier c = static_cast<carrier>(fields.Mantissa());
+            const int q = fields.BinaryExponent();
+
+            if (fields.exponent != 0 && -traits::mantissa_bits <= q && q <= 0)
+            {
+                // Integers that fit in the mantissa are their own shortest representation.
+                const carrier fractionMask = static_cast<carrier>((carrier{1} << -q) - 1);
+                if ((c & fractionMask) == 0)
+                {
+                    return {static_cast<std::uint64_t>(c >> -q), 0};
+                }
+            }
+
+            const bool isEven = c % 2 == 0;
+            const bool lowerBoundaryIsCloser = fields.fraction == 0 && fields.exponent > 1;
+
+            const carrier cbl = 4 * c - 2 + (lowerBoundaryIsCloser ? 1 : 0);
+            const carrier cb = 4 * c;
+            const carrier cbr = 4 * c + 2;
+
+            // floor(log10(2^q)), or floor(log10(3/4 * 2^q)) when the lower boundary is closer, and then
+            // q + floor(log2(10^-k)) + 1.
+            const int k = (q * 1262611 - (lowerBoundaryIsCloser ? 524031 : 0)) >> 22;
+            const int h = q + ((-k * 1741647) >> 19) + 1;
+
+            carrier vbl;
+            carrier vb;
+            carrier vbr;
+            if constexpr (sizeof(T) == 4)
+            {
+                const std::uint64_t g = charconv_powers_of_five[-k - charconv_smallest_power_of_five].high + 1;
+                vbl = charconv_round_to_odd(g, static_cast<std::uint32_t>(cbl << h));
+                vb = charconv_round_to_odd(g, static_cast<std::uint32_t>(cb << h));
+                vbr = charconv_round_to_odd(g, static_cast<std::uint32_t>(cbr << h));
+            }
+            else
+            {
+                const charconv_uint128 g = charconv_schubfach_power_of_ten(-k);
+                vbl = charconv_round_to_odd(g, cbl << h);
+                vb = charconv_round_to_odd(g, cb << h);
+                vbr = charconv_round_to_odd(g, cbr << h);
+            }
+
+            // The interval is closed when the mantissa is even, since ties round to even.
+            const carrier lower = vbl + (isEven ? 0 : 1);
+            const carrier upper = vbr - (isEven ? 0 : 1);
+
+            // Try one digit fewer than the value's first: at most one of its two neighbors is in the interval.
+            const carrier s = vb / 4;
+            if (s >= 10)
+            {
+                const carrier sp = s / 10;
+                const bool upInside = lower <= 40 * sp;
+                const bool wpInside = 40 * sp + 40 <= upper;
+                if (upInside != wpInside)
+                {
+                    return {static_cast<std::uint64_t>(sp + (wpInside ? 1 : 0)), k + 1};
+                }
+            }
+
+            const bool uInside = lower <= 4 * s;
+            const bool wInside = 4 * s + 4 <= upper;
+            if (uInside != wInside)
+            {
+                return {static_cast<std::uint64_t>(s + (wInside ? 1 : 0)), k};
+            }
+
+            // Both neighbors are in the interval, so pick the closer one, ties to even.
+            const carrier mid = 4 * s + 2;
+            const bool roundUp = vb > mid || (vb == mid && (s & 1) != 0);
+            return {static_cast<std::uint64_t>(s + (roundUp ? 1 : 0)), k};
+        }
+
+        template <class T>
+        charconv_decimal charconv_shortest(const charconv_float_fields<T>& fields) noexcept
+        {
+            charconv_decimal decimal = charconv_schubfach(fields);
+            while (decimal.digits % 100 == 0)
+            {
+                decimal.digits /= 100;
+                decimal.exponent += 2;
+            }
+            if (decimal.digits % 10 == 0)
+            {
+                decimal.digits /= 10;
+                decimal.exponent += 1;
+            }
+            return decimal;
+        }
+
+        //
+        // Floating point: exact digits, for the formats with a precision.
+        //
+
+        /**
+         * @brief An unsigned big integer with a fixed capacity, in 32-bit limbs, least significant first. Big enough for
+         *        any double times the powers of five and two that the exact comparisons in `from_chars` need.
+         */
+        struct charconv_bigint
+        {
+            static constexpr int capacity = 128;
+
+            void MultiplyAdd(std::uint32_t multiplier, std::uint32_t addend) noexcept
+            {
+                std::uint64_t carry = addend;
+                for (int i = 0; i < size; ++i)
+                {
+                    const std::uint64_t product = std::uint64_t{limbs[i]} * multiplier + carry;
+                    limbs[i] = static_cast<std::uint32_t>(product);
+                    carry = product >> 32;
+                }
+                if (carry != 0)
+                {
+                    assert(size < capacity);
+                    limbs[size++] = static_cast<std::uint32_t>(carry);
+                }
+            }
+
+            void MultiplyByPowerOfFive(int exponent) noexcept
+            {
+                constexpr std::uint32_t smallPowers[] = {1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625,
+                    48828125, 244140625};
+
+                // 5^13 is the biggest power of five that fits in a limb.
+                for (; exponent >= 13; exponent -= 13)
+                {
+                    MultiplyAdd(1220703125u, 0);
+                }
+                if (exponent > 0)
+                {
+                    MultiplyAdd(smallPowers[exponent], 0);
+                }
+            }
+
+            void ShiftLeft(int bits) noexcept
+            {
+                if (size == 0)
+                {
+                    return;
+                }
+
+                const int limbShift = bits / 32;
+                const int bitShift = bits % 32;
+                assert(size + limbShift + 1 <= capacity);
+
+                if (bitShift == 0)
+                {
+                    for (int i = size - 1; i >= 0; --i)
+                    {
+                        limbs[i + limbShift] = limbs[i];
+                    }
+                    size += limbShift;
+                }
+                else
+                {
+                    limbs[size + limbShift] = limbs[size - 1] >> (32 - bitShift);
+                    for (int i = size - 1; i > 0; --i)
+                    {
+                        limbs[i + limbShift] = (limbs[i] << bitShift) | (limbs[i - 1] >> (32 - bitShift));
+                    }
+                    limbs[limbShift] = limbs[0] << bitShift;
+                    size += limbShift + 1;
+                }
+
+                for (int i = 0; i < limbShift; ++i)
+                {
+                    limbs[i] = 0;
+                }
+                Trim();
+            }
+
+            // Returns the remainder.
+            std::uint32_t DivideBySmall(std::uint32_t divisor) noexcept
+            {
+                std::uint64_t remainder = 0;
+                for (int i = size - 1; i >= 0; --i)
+                {
+                    const std::uint64_t current = (remainder << 32) | limbs[i];
+                    limbs[i] = static_cast<std::uint32_t>(current / divisor);
+                    remainder = current % divisor;
+                }
+                Trim();
+                return static_cast<std::uint32_t>(remainder);
+            }
+
+            void Trim() noexcept
+            {
+                while (size > 0 && limbs[size - 1] == 0)
+                {
+                    --size;
+                }
+            }
+
+            static charconv_bigint FromUint64(std::uint64_t value) noexcept
+            {
+                charconv_bigint result;
+                result.limbs[0] = static_cast<std::uint32_t>(value);
+                result.limbs[1] = static_cast<std::uint32_t>(value >> 32);
+                result.size = 2;
+                result.Trim();
+                return result;
+            }
+
+            static int Compare(const charconv_bigint& lhs, const charconv_bigint& rhs) noexcept
+            {
+                if (lhs.size != rhs.size)
+                {
+                    return lhs.size < rhs.size ? -1 : 1;
+                }
+                for (int i = lhs.size - 1; i >= 0; --i)
+                {
+                    if (lhs.limbs[i] != rhs.limbs[i])
+                    {
+                        return lhs.limbs[i] < rhs.limbs[i] ? -1 : 1;
+                    }
+                }
+                return 0;
+            }
+
+            std::uint32_t limbs[capacity];
+            int size = 0;
+        };
+
+        /**
+         * @brief The leading significant digits of a float's exact decimal expansion.
+         */
+        struct charconv_exact_digits
+        {
+            // A double has at most 767 significant digits.
+            static constexpr int capacity = 800;
+
+            char digits[capacity];
+            int size = 0;
+
+            // The power of ten of the first digit.
+            int exponent = 0;
+
+            // Whether any nonzero digits come after the ones in `digits`.
+            bool sticky = false;
+        };
+
+        /**
+         * @brief Generates the significant digits of `mantissa * 2^binaryExponent`, which must not be zero, stopping
+         *        after `maxDigits` of them, or after the one at `maxFractionDigits` places after the decimal point.
+         *        When no digits are generated, `exponent` is set below the last place allowed.
+         *
+         *        The integer part comes from dividing it by 10^9, in a big integer when it doesn't fit in 64 bits, and the
+         *        fraction from multiplying it by 10^9 and taking what carries out past the point, so each digit costs a
+         *        few multiplies per 32 bits of the fraction.
+         */
+        inline void charconv_generate_exact_digits(std::uint64_t mantissa, int binaryExponent, int maxDigits,
+            int maxFractionDigits, charconv_exact_digits& out) noexcept
+        {
+            assert(mantissa != 0);
+            maxDigits = maxDigits < charconv_exact_digits::capacity ? maxDigits : charconv_exact_digits::capacity;
+            out.size = 0;
+            out.sticky = false;
+
+            const auto pushIntegerDigits = [&](const char* first, const char* last)
+            {
+                for (; first != last; ++first)
+                {
+                    if (out.size < maxDigits)
+                    {
+                        out.digits[out.size++] = *first;
+                    }
+                    else if (*first != '0')
+                    {
+                        out.sticky = true;
+                    }
+                }
+            };
+
+            if (binaryExponent >= 0)
+            {
+                if (StdReimpl::bit_width(mantissa) + binaryExponent <= 64)
+                {
+                    const std::uint64_t integer = mantissa << binaryExponent;
+                    char buffer[20];
+                    const int length = charconv_count_decimal_digits(integer);
+                    charconv_write_decimal_backward(buffer + length, integer);
+                    out.exponent = length - 1;
+                    pushIntegerDigits(buffer, buffer + length);
+                    return;
+                }
+
+                // Up to 2^1024, which is 35 chunks of 9 digits.
+                charconv_bigint integer = charconv_bigint::FromUint64(mantissa);
+                integer.ShiftLeft(binaryExponent);
+                std::uint32_t chunks[40];
+                int chunkCount = 0;
+                while (integer.size > 0)
+                {
+                    chunks[chunkCount++] = integer.DivideBySmall(1000000000u);
+                }
+
+                char buffer[9];
+                const int leadingLength = charconv_count_decimal_digits(chunks[chunkCount - 1]);
+                charconv_write_decimal_backward(buffer + leadingLength, chunks[chunkCount - 1]);
+                out.exponent = leadingLength - 1 + 9 * (chunkCount - 1);
+                pushIntegerDigits(buffer, buffer + leadingLength);
+                for (int i = chunkCount - 2; i >= 0; --i)
+                {
+                    for (char& digit : buffer)
+                    {
+                        digit = '0';
+                    }
+                    charconv_write_decimal_backward(buffer + 9, chunks[i]);
+                    pushIntegerDigits(buffer, buffer + 9);
+                }
+                return;
+            }
+
+            const int fractionBits = -binaryExponent;
+            const std::uint64_t integer = fractionBits < 64 ? mantissa >> fractionBits : 0;
+            const std::uint64_t fraction = fractionBits < 64 ? mantissa & ((std::uint64_t{1} << fractionBits) - 1) : mantissa;
+
+            if (integer != 0)
+            {
+                char buffer[20];
+                const int length = charconv_count_decimal_digits(integer);
+                charconv_write_decimal_backward(buffer + length, integer);
+                out.exponent = length - 1;
+                pushIntegerDigits(buffer, buffer + length);
+            }
+
+            // The fraction as a number of limbs, scaled so that it's over 2^(32 * limbCount). It only has the mantissa's
+            // few bits to begin with, and fills up the limbs as it's multiplied.
+            constexpr int maxLimbs = (1074 + 31) / 32;
+            std::uint32_t limbs[maxLimbs];
+            const int limbCount = (fractionBits + 31) / 32;
+            const int scale = limbCount * 32 - fractionBits;
+            const std::uint64_t scaledLow = fraction << scale;
+            const std::uint64_t scaledHigh = scale == 0 ? 0 : fraction >> (64 - scale);
+            for (int i = 0; i < limbCount; ++i)
+            {
+                limbs[i] = i == 0 ? static_cast<std::uint32_t>(scaledLow)
+                    : i == 1    ? static_cast<std::uint32_t>(scaledLow >> 32)
+                    : i == 2    ? static_cast<std::uint32_t>(scaledHigh)
+                                : 0;
+            }
+
+            int lowestLimb = 0;
+            int position = 0;
+            while (true)
+            {
+                while (lowestLimb < limbCount && limbs[lowestLimb] == 0)
+                {
+                    ++lowestLimb;
+                }
+                if (lowestLimb == limbCount)
+                {
+                    break;
+                }
+                if (position >= maxFractionDigits || out.size >= maxDigits)
+                {
+                    out.sticky = true;
+                    break;
+                }
+
+                std::uint64_t carry = 0;
+                for (int i = lowestLimb; i < limbCount; ++i)
+                {
+                    const std::uint64_t product = std::uint64_t{limbs[i]} * 1000000000u + carry;
+                    limbs[i] = static_cast<std::uint32_t>(product);
+                    carry = product >> 32;
+                }
+
+                char buffer[9] = {'0', '0', '0', '0', '0', '0', '0', '0', '0'};
+                charconv_write_decimal_backward(buffer + 9, static_cast<std::uint32_t>(carry));
+                for (const char digit : buffer)
+                {
+                    ++position;
+                    if (out.size == 0 && integer == 0)
+                    {
+                        if (digit == '0')
+                        {
+                            continue;
+                        }
+                        out.exponent = -position;
+                    }
+
+                    if (position <= maxFractionDigits && out.size < maxDigits)
+                    {
+                        out.digits[out.size++] = digit;
+                    }
+                    else if (digit != '0')
+                    {
+                        out.sticky = true;
+                    }
+                }
+            }
+
+            if (out.size == 0)
+            {
+                out.exponent = -maxFractionDigits - 1;
+            }
+        }
+
+        /**
+         * @brief Rounds to `count` significant digits, ties to even. The digits must have been generated with at least
+         *        one more than that allowed, so that the first one dropped is there to look at.
+         */
+        inline void charconv_round_exact_digits(charconv_exact_digits& digits, int count) noexcept
+        {
+            if (count >= digits.size)
+            {
+                return;
+            }
+            if (count < 0)
+            {
+                digits.size = 0;
+                return;
+            }
+
+            const char roundingDigit = digits.digits[count];
+            bool aboveHalf = digits.sticky;
+            for (int i = count + 1; i < digits.size && !aboveHalf; ++i)
+            {
+                aboveHalf = digits.digits[i] != '0';
+            }
+            const bool odd = count > 0 && (digits.digits[count - 1] - '0') % 2 != 0;
+
+            digits.size = count;
+            digits.sticky = false;
+            if (roundingDigit > '5' || (roundingDigit == '5' && (aboveHalf || odd)))
+            {
+                int i = count - 1;
+                while (i >= 0 && digits.digits[i] == '9')
+                {
+                    digits.digits[i--] = '0';
+                }
+
+                if (i >= 0)
+                {
+                    ++digits.digits[i];
+                }
+                else
+                {
+                    // All nines, or nothing, rounded up to the next power of ten.
+                    digits.digits[0] = '1';
+                    digits.size = count > 0 ? count : 1;
+                    ++digits.exponent;
+                }
+            }
+        }
+
+        //
+        // Floating point: writing.
+        //
+
+        inline int charconv_exponent_length(int exponent) noexcept
+        {
+            return exponent >= 100 || exponent <= -100 ? 5 : 4;
+        }
+
+        /**
+         * @brief Writes "e+XX", with at least two digits, like `printf`.
+         */
+        inline char* charconv_write_exponent(char* p, int exponent) noexcept
+        {
+            *p++ = 'e';
+            *p++ = exponent < 0 ? '-' : '+';
+            const unsigned int magnitude = static_cast<unsigned int>(exponent < 0 ? -exponent : exponent);
+            if (magnitude >= 100)
+            {
+                *p++ = static_cast<char>('0' + magnitude / 100);
+            }
+            const std::size_t pair = static_cast<std::size_t>(magnitude % 100) * 2;
+            *p++ = charconv_digit_pairs[pair];
+            *p++ = charconv_digit_pairs[pair + 1];
+            return p;
+        }
+
+        inline char* charconv_fill(char* p, char c, std::ptrdiff_t count) noexcept
+        {
+            for (std::ptrdiff_t i = 0; i < count; ++i)
+            {
+                *p++ = c;
+            }
+            return p;
+        }
+
+        inline to_chars_result charconv_write_special(char* first, char* last, bool negative, bool isNan) noexcept
+        {
+            const std::ptrdiff_t length = 3 + (negative ? 1 : 0);
+            if (last - first < length)
+            {
+                return {last, std::errc::value_too_large};
+            }
+            if (negative)
+            {
+                *first++ = '-';
+            }
+            const char* text = isNan ? "nan" : "inf";
+            first[0] = text[0];
+            first[1] = text[1];
+            first[2] = text[2];
+            return {first + 3, std::errc{}};
+        }
+
+        inline to_chars_result charconv_write_shortest_scientific(char* first, char* last, charconv_decimal decimal,
+            int digitCount) noexcept
+        {
+            const int exponent = decimal.exponent + digitCount - 1;
+            const std::ptrdiff_t length = digitCount + (digitCount > 1 ? 1 : 0) + charconv_exponent_length(exponent);
+            if (last - first < length)
+            {
+                return {last, std::errc::value_too_large};
+            }
+
+            // Writes the digits one place to the right, then moves the first one over the point.
+            charconv_write_decimal_backward(first + 1 + digitCount, decimal.digits);
+            first[0] = first[1];
+            char* p = first + 1;
+            if (digitCount > 1)
+            {
+                first[1] = '.';
+                p = first + 1 + digitCount;
+            }
+            return {charconv_write_exponent(p, exponent), std::errc{}};
+        }
+
+        /**
+         * @brief For values whose shortest representation has no fractional digits to begin with.
+         */
+        inline std::ptrdiff_t charconv_shortest_fixed_length(charconv_decimal decimal, int digitCount) noexcept
+        {
+            const int exponent = decimal.exponent + digitCount - 1;
+            if (decimal.exponent >= 0)
+            {
+                return digitCount + decimal.exponent;
+            }
+            if (exponent >= 0)
+            {
+                return digitCount + 1;
+            }
+            return digitCount + 1 - exponent;
+        }
+
+        inline to_chars_result charconv_write_shortest_fixed(char* first, char* last, charconv_decimal decimal,
+            int digitCount) noexcept
+        {
+            const std::ptrdiff_t length = charconv_shortest_fixed_length(decimal, digitCount);
+            if (last - first < length)
+            {
+                return {last, std::errc::value_too_large};
+            }
+
+            const int exponent = decimal.exponent + digitCount - 1;
+            if (decimal.exponent >= 0)
+            {
+                charconv_write_decimal_backward(first + digitCount, decimal.digits);
+                charconv_fill(first + digitCount, '0', decimal.exponent);
+            }
+            else if (exponent >= 0)
+            {
+                // Writes the digits one place to the right, then moves the integer part over the point.
+                charconv_write_decimal_backward(first + length, decimal.digits);
+                for (int i = 0; i <= exponent; ++i)
+                {
+                    first[i] = first[i + 1];
+                }
+                first[exponent + 1] = '.';
+            }
+            else
+            {
+                first[0] = '0';
+                first[1] = '.';
+                charconv_fill(first + 2, '0', -exponent - 1);
+                charconv_write_decimal_backward(first + length, decimal.digits);
+            }
+            return {first + length, std::errc{}};
+        }
+
+        inline to_chars_result charconv_write_fixed_digits(char* first, char* last, const charconv_exact_digits& digits,
+            int precision) noexcept
+        {
+            const bool zero = digits.size == 0;
+            const std::ptrdiff_t integerLength = !zero && digits.exponent >= 0 ? digits.exponent + 1 : 1;
+            const std::ptrdiff_t length = integerLength + (precision > 0 ? 1 + std::ptrdiff_t{precision} : 0);
+            if (last - first < length)
+            {
+                return {last, std::errc::value_too_large};
+            }
+
+            // Digit i of the output, counting from the first integer digit, is at `index` in `digits`.
+            const auto digitAt = [&](std::ptrdiff_t index)
+            {
+                return !zero && index >= 0 && index < digits.size ? digits.digits[index] : '0';
+            };
+
+            char* p = first;
+            const std::ptrdiff_t firstIndex = std::ptrdiff_t{digits.exponent} - (integerLength - 1);
+            for (std::ptrdiff_t i = 0; i < integerLength; ++i)
+            {
+                *p++ = digitAt(firstIndex + i);
+            }
+            if (precision > 0)
+            {
+                *p++ = '.';
+                const std::ptrdiff_t fractionIndex = zero ? 0 : std::ptrdiff_t{digits.exponent} + 1;
+                std::ptrdiff_t i = 0;
+                for (; i < precision && fractionIndex + i < digits.size; ++i)
+                {
+                    *p++ = digitAt(fractionIndex + i);
+                }
+                p = charconv_fill(p, '0', precision - i);
+            }
+            return {p, std::errc{}};
+        }
+
+        inline to_chars_result charconv_write_scientific_digits(char* first, char* last, const charconv_exact_digits& digits,
+            int precision) noexcept
+        {
+            const int exponent = digits.size == 0 ? 0 : digits.exponent;
+            const std::ptrdiff_t length = 1 + (precision > 0 ? 1 + std::ptrdiff_t{precision} : 0) + charconv_exponent_length(exponent);
+            if (last - first < length)
+            {
+                return {last, std::errc::value_too_large};
+            }
+
+            char* p = first;
+            *p++ = digits.size == 0 ? '0' : digits.digits[0];
+            if (precision > 0)
+            {
+                *p++ = '.';
+                std::ptrdiff_t i = 0;
+                for (; i < precision && i + 1 < digits.size; ++i)
+                {
+                    *p++ = digits.digits[i + 1];
+                }
+                p = charconv_fill(p, '0', precision - i);
+            }
+            return {charconv_write_exponent(p, exponent), std::errc{}};
+        }
+
+        /**
+         * @brief `%f` with the given precision. Nothing after 1100 places is ever nonzero for a double.
+         */
+        inline to_chars_result charconv_write_fixed_precision(char* first, char* last, std::uint64_t mantissa,
+            int binaryExponent, int precision) noexcept
+        {
+            charconv_exact_digits digits;
+            if (mantissa != 0)
+            {
+                const int places = precision < 1100 ? precision : 1100;
+                charconv_generate_exact_digits(mantissa, binaryExponent, charconv_exact_digits::capacity, places + 1, digits);
+                charconv_round_exact_digits(digits, digits.exponent + 1 + places);
+            }
+            return charconv_write_fixed_digits(first, last, digits, precision);
+        }
+
+        inline to_chars_result charconv_write_scientific_precision(char* first, char* last, std::uint64_t mantissa,
+            int binaryExponent, int precision) noexcept
+        {
+            charconv_exact_digits digits;
+            if (mantissa != 0)
+            {
+                const int count = precision < charconv_exact_digits::capacity ? precision + 1 : charconv_exact_digits::capacity;
+                charconv_generate_exact_digits(mantissa, binaryExponent, count + 1, std::numeric_limits<int>::max(), digits);
+                charconv_round_exact_digits(digits, count);
+            }
+            return charconv_write_scientific_digits(first, last, digits, precision);
+        }
+
+        /**
+         * @brief `%g` with the given precision: scientific when the exponent is less than -4, or at least the precision,
+         *        and fixed otherwise, without trailing zeros.
+         */
+        inline to_chars_result charconv_write_general_precision(char* first, char* last, std::uint64_t mantissa,
+            int binaryExponent, int precision) noexcept
+        {
+            if (mantissa == 0)
+            {
+                if (first == last)
+                {
+                    return {last, std::errc::value_too_large};
+                }
+                *first = '0';
+                return {first + 1, std::errc{}};
+            }
+
+            const int significantDigits = precision == 0 ? 1 : precision;
+            const int count = significantDigits < charconv_exact_digits::capacity ? significantDigits : charconv_exact_digits::capacity;
+            charconv_exact_digits digits;
+            charconv_generate_exact_digits(mantissa, binaryExponent, count + 1, std::numeric_limits<int>::max(), digits);
+            charconv_round_exact_digits(digits, count);
+            while (digits.size > 1 && digits.digits[digits.size - 1] == '0')
+            {
+                --digits.size;
+            }
+
+            if (-4 <= digits.exponent && digits.exponent < significantDigits)
+            {
+                const int places = digits.size - 1 - digits.exponent;
+                return charconv_write_fixed_digits(first, last, digits, places > 0 ? places : 0);
+            }
+            return charconv_write_scientific_digits(first, last, digits, digits.size - 1);
+        }
+
+        /**
+         * @brief `%a` without the "0x", with the given precision, or as many digits as it takes when it's negative.
+         *        Subnormals are written with a leading 0, rather than normalized.
+         */
+        template <class T>
+        to_chars_result charconv_write_hex(char* first, char* last, const charconv_float_fields<T>& fields, int precision) noexcept
+        {
+            using traits = charconv_float_traits<T>;
+            constexpr int digitBits = traits::hex_digits * 4;
+
+            std::uint64_t leading = fields.exponent == 0 ? 0 : 1;
+            std::uint64_t fraction = std::uint64_t{fields.fraction} << (digitBits - traits::mantissa_bits);
+            const int exponent = fields.exponent == 0 ? (fields.fraction == 0 ? 0 : 1 - traits::exponent_bias)
+                                                      : fields.exponent - traits::exponent_bias;
+
+            int fractionDigits = traits::hex_digits;
+            if (precision < 0)
+            {
+                while (fractionDigits > 0 && (fraction & 0xF) == 0)
+                {
+                    fraction >>= 4;
+                    --fractionDigits;
+                }
+                precision = fractionDigits;
+            }
+            else if (precision < traits::hex_digits)
+            {
+                // Rounds the leading digit and fraction together, ties to even. A leading 1 can round up to 2.
+                const int droppedBits = 4 * (traits::hex_digits - precision);
+                const std::uint64_t all = (leading << digitBits) | fraction;
+                std::uint64_t kept = all >> droppedBits;
+                const std::uint64_t dropped = all & ((std::uint64_t{1} << droppedBits) - 1);
+                const std::uint64_t half = std::uint64_t{1} << (droppedBits - 1);
+                if (dropped > half || (dropped == half && (kept & 1) != 0))
+                {
+                    ++kept;
+                }
+
+                fractionDigits = precision;
+                leading = kept >> (4 * precision);
+                fraction = kept & ((std::uint64_t{1} << (4 * precision)) - 1);
+            }
+
+            const unsigned int exponentMagnitude = static_cast<unsigned int>(exponent < 0 ? -exponent : exponent);
+            const int exponentDigits = charconv_count_decimal_digits(exponentMagnitude);
+            const std::ptrdiff_t length = 1 + (precision > 0 ? 1 + std::ptrdiff_t{precision} : 0) + 2 + exponentDigits;
+            if (last - first < length)
+            {
+                return {last, std::errc::value_too_large};
+            }
+
+            char* p = first;
+            *p++ = charconv_digit_letters[leading];
+            if (precision > 0)
+            {
+                *p++ = '.';
+                for (int i = fractionDigits - 1; i >= 0; --i)
+                {
+                    *p++ = charconv_digit_letters[(fraction >> (4 * i)) & 0xF];
+                }
+                p = charconv_fill(p, '0', std::ptrdiff_t{precision} - fractionDigits);
+            }
+            *p++ = 'p';
+            *p++ = exponent < 0 ? '-' : '+';
+            charconv_write_decimal_backward(p + exponentDigits, exponentMagnitude);
+            return {p + exponentDigits, std::errc{}};
+        }
+
+        /**
+         * @brief The shortest round trip representation. An empty `fmt` is the overload without one, which picks
+         *        whichever of fixed and scientific is shorter.
+         */
+        template <class T>
+        to_chars_result charconv_to_chars_shortest(char* first, char* last, T value, chars_format fmt) noexcept
+        {
+            using traits = charconv_float_traits<T>;
+            const charconv_float_fields<T> fields(value);
+
+            if (fields.exponent == traits::infinite_exponent)
+            {
+                return charconv_write_special(first, last, fields.negative, fields.fraction != 0);
+            }
+            if (fields.negative)
+            {
+                if (first == last)
+                {
+                    return {last, std::errc::value_too_large};
+                }
+                *first++ = '-';
+            }
+
+            if (fmt == chars_format::hex)
+            {
+                return charconv_write_hex(first, last, fields, -1);
+            }
+
+            if (fields.exponent == 0 && fields.fraction == 0)
+            {
+                const std::ptrdiff_t length = fmt == chars_format::scientific ? 5 : 1;
+                if (last - first < length)
+                {
+                    return {last, std::errc::value_too_large};
+                }
+                *first = '0';
+                return {fmt == chars_format::scientific ? charconv_write_exponent(first + 1, 0) : first + 1, std::errc{}};
+            }
+
+            const charconv_decimal decimal = charconv_shortest(fields);
+            const int digitCount = charconv_count_decimal_digits(decimal.digits);
+            const int exponent = decimal.exponent + digitCount - 1;
+
+            bool useFixed;
+            if (fmt == chars_format::fixed)
+            {
+                useFixed = true;
+            }
+            else if (fmt == chars_format::scientific)
+            {
+                useFixed = false;
+            }
+            else if (fmt == chars_format::general)
+            {
+                // `%g` with its default precision of 6.
+                useFixed = -4 <= exponent && exponent < 6;
+            }
+            else
+            {
+                const std::ptrdiff_t scientificLength = digitCount + (digitCount > 1 ? 1 : 0) + charconv_exponent_length(exponent);
+                useFixed = charconv_shortest_fixed_length(decimal, digitCount) <= scientificLength;
+            }
+
+            if (!useFixed)
+            {
+                return charconv_write_shortest_scientific(first, last, decimal, digitCount);
+            }
+            if (fields.BinaryExponent() > 0)
+            {
+                // Too big to have a fractional part, so write its exact integer value, rather than the shortest digits
+                // padded with zeros.
+                return charconv_write_fixed_precision(first, last, fields.Mantissa(), fields.BinaryExponent(), 0);
+            }
+            return charconv_write_shortest_fixed(first, last, decimal, digitCount);
+        }
+
+        template <class T>
+        to_chars_result charconv_to_chars_precision(char* first, char* last, T value, chars_format fmt, int precision) noexcept
+        {
+            using traits = charconv_float_traits<T>;
+            const charconv_float_fields<T> fields(value);
+
+            if (fields.exponent == traits::infinite_exponent)
+            {
+                return charconv_write_special(first, last, fields.negative, fields.fraction != 0);
+            }
+            if (fields.negative)
+            {
+                if (first == last)
+                {
+                    return {last, std::errc::value_too_large};
+                }
+                *first++ = '-';
+            }
+
+            if (fmt == chars_format::hex)
+            {
+                return charconv_write_hex(first, last, fields, precision);
+            }
+
+            // A negative precision means the default, like in `printf`.
+            if (precision < 0)
+            {
+                precision = 6;
+            }
+            if (fmt == chars_format::fixed)
+            {
+                return charconv_write_fixed_precision(first, last, fields.Mantissa(), fields.BinaryExponent(), precision);
+            }
+            if (fmt == chars_format::scientific)
+            {
+                return charconv_write_scientific_precision(first, last, fields.Mantissa(), fields.BinaryExponent(), precision);
+            }
+            return charconv_write_general_precision(first, last, fields.Mantissa(), fields.BinaryExponent(), precision);
+        }
+
+        //
+        // Floating point: parsing.
+        //
+
+        /**
+         * @brief A float's mantissa without the hidden bit, and biased exponent.
+         */
+        struct charconv_adjusted_mantissa
+        {
+            std::uint64_t mantissa;
+            int power2;
+
+            friend bool operator==(const charconv_adjusted_mantissa&, const charconv_adjusted_mantissa&) = default;
+        };
+
+        /**
+         * @brief The Eisel-Lemire algorithm, following Daniel Lemire's fast_float. Rounds `w * 10^q` to the nearest
+         *        float, ties to even, from the high bits of the product of `w` and a 128-bit approximation of 5^q,
+         *        which Noble Mushtak and Daniel Lemire proved is always precise enough.
+         */
+        template <class T>
+        charconv_adjusted_mantissa charconv_eisel_lemire(std::int64_t q, std::uint64_t w) noexcept
+        {
+            using traits = charconv_float_traits<T>;
+
+            if (w == 0 || q < traits::smallest_power_of_ten)
+            {
+                return {0, 0};
+            }
+            if (q > traits::largest_power_of_ten)
+            {
+                return {0, traits::infinite_exponent};
+            }
+
+            const int leadingZeros = StdReimpl::countl_zero(w);
+            w <<= leadingZeros;
+
+            // We need the hidden bit, a bit to round with, and one more in case the product's top bit is clear. Only
+            // when those are all ones might the rest of the product carry into them.
+            constexpr int precision = traits::mantissa_bits + 3;
+            constexpr std::uint64_t precisionMask = ~std::uint64_t{0} >> precision;
+            const charconv_uint128& power = charconv_powers_of_five[q - charconv_smallest_power_of_five];
+            charconv_uint128 product = charconv_multiply_64x64(w, power.high);
+            if ((product.high & precisionMask) == precisionMask)
+            {
+                const charconv_uint128 lowProduct = charconv_multiply_64x64(w, power.low);
+                product.low += lowProduct.high;
+                if (lowProduct.high > product.low)
+                {
+                    ++product.high;
+                }
+            }
+
+            const int upperBit = static_cast<int>(product.high >> 63);
+            const int shift = upperBit + 64 - traits::mantissa_bits - 3;
+
+            charconv_adjusted_mantissa answer;
+            answer.mantissa = product.high >> shift;
+            // floor(log2(10^q)) + 63, then the normalization and bias.
+            answer.power2 = static_cast<int>((((152170 + 65536) * q) >> 16) + 63) + upperBit - leadingZeros + traits::exponent_bias;
+
+            if (answer.power2 <= 0)
+            {
+                // A subnormal, unless it rounds up to the smallest normal.
+                if (-answer.power2 + 1 >= 64)
+                {
+                    return {0, 0};
+                }
+                answer.mantissa >>= -answer.power2 + 1;
+                answer.mantissa += answer.mantissa & 1;
+                answer.mantissa >>= 1;
+                answer.power2 = answer.mantissa < (std::uint64_t{1} << traits::mantissa_bits) ? 0 : 1;
+                return answer;
+            }
+
+            // Round half up, unless the product is exactly halfway, which can only happen for powers of ten small enough
+            // to be exact.
+            if (product.low <= 1 && q >= traits::min_exponent_round_to_even && q <= traits::max_exponent_round_to_even &&
+                (answer.mantissa & 3) == 1 && (answer.mantissa << shift) == product.high)
+            {
+                answer.mantissa &= ~std::uint64_t{1};
+            }
+
+            answer.mantissa += answer.mantissa & 1;
+            answer.mantissa >>= 1;
+            if (answer.mantissa >= (std::uint64_t{2} << traits::mantissa_bits))
+            {
+                answer.mantissa = std::uint64_t{1} << traits::mantissa_bits;
+                ++answer.power2;
+            }
+
+            answer.mantissa &= ~(std::uint64_t{1} << traits::mantissa_bits);
+            if (answer.power2 >= traits::infinite_exponent)
+            {
+                return {0, traits::infinite_exponent};
+            }
+            return answer;
+        }
+
+        /**
+         * @brief Rounds `mantissa * 2^exponent`, plus a little more when `sticky`, to the nearest float, ties to even.
+         *        For hexadecimal input, which we can round directly.
+         */
+        template <class T>
+        charconv_adjusted_mantissa charconv_round_binary(std::uint64_t mantissa, std::int64_t exponent, bool sticky) noexcept
+        {
+            using traits = charconv_float_traits<T>;
+            constexpr int digits = traits::mantissa_bits + 1;
+            constexpr std::int64_t minLowestBit = 1 - traits::exponent_bias - traits::mantissa_bits;
+
+            const int leadingZeros = StdReimpl::countl_zero(mantissa);
+            mantissa <<= leadingZeros;
+            exponent -= leadingZeros;
+
+            // The power of two of the lowest bit we keep, which is pushed up for subnormals.
+            std::int64_t lowestBit = exponent + (64 - digits);
+            if (lowestBit < minLowestBit)
+            {
+                lowestBit = minLowestBit;
+            }
+            const std::int64_t shift = lowestBit - exponent;
+            if (shift > 64)
+            {
+                return {0, 0};
+            }
+
+            std::uint64_t kept = shift == 64 ? 0 : mantissa >> shift;
+            const std::uint64_t dropped = shift == 64 ? mantissa : mantissa & ((std::uint64_t{1} << shift) - 1);
+            const std::uint64_t half = std::uint64_t{1} << (shift - 1);
+            if (dropped > half || (dropped == half && (sticky || (kept & 1) != 0)))
+            {
+                ++kept;
+            }
+            if (kept == (std::uint64_t{1} << digits))
+            {
+                kept >>= 1;
+                ++lowestBit;
+            }
+
+            constexpr std::uint64_t hiddenBit = std::uint64_t{1} << traits::mantissa_bits;
+            if (kept < hiddenBit)
+            {
+                return {kept, 0};
+            }
+            const std::int64_t power2 = lowestBit + traits::exponent_bias + traits::mantissa_bits;
+            if (power2 >= traits::infinite_exponent)
+            {
+                return {0, traits::infinite_exponent};
+            }
+            return {kept & ~hiddenBit, static_cast<int>(power2)};
+        }
+
+        struct charconv_parsed_decimal
+        {
+            // The first 19 significant digits, and the power of ten that scales them.
+            std::uint64_t mantissa = 0;
+            std::int64_t exponent = 0;
+
+            // Whether there were nonzero digits after those.
+            bool truncated = false;
+
+            // The significand, including any decimal point, and the explicit exponent after it, for the exact fallback.
+            const char* significandFirst = nullptr;
+            const char* significandLast = nullptr;
+            std::int64_t explicitExponent = 0;
+        };
+
+        /**
+         * @brief Reads an exponent's optional sign and digits, saturating far beyond any float's range. Returns null
+         *        when there are no digits.
+         */
+        inline const char* charconv_parse_exponent(const char* p, const char* last, std::int64_t& exponent) noexcept
+        {
+            bool negative = false;
+            if (p != last && (*p == '+' || *p == '-'))
+            {
+                negative = *p == '-';
+                ++p;
+            }
+            if (p == last || !charconv_is_decimal_digit(*p))
+            {
+                return nullptr;
+            }
+
+            std::int64_t magnitude = 0;
+            for (; p != last && charconv_is_decimal_digit(*p); ++p)
+            {
+                if (magnitude < 0x10000000)
+                {
+                    magnitude = magnitude * 10 + (*p - '0');
+                }
+            }
+            exponent = negative ? -magnitude : magnitude;
+            return p;
+        }
+
+        /**
+         * @brief Parses the decimal significand and exponent, as `fmt` allows. Returns the end of the number, or null
+         *        when it's malformed.
+         */
+        inline const char* charconv_parse_decimal(const char* first, const char* last, chars_format fmt,
+            charconv_parsed_decimal& parsed) noexcept
+        {
+            const char* p = first;
+            std::uint64_t mantissa = 0;
+            int keptDigits = 0;
+            std::int64_t exponent = 0;
+            bool truncated = false;
+            bool anyDigits = false;
+
+            for (; p != last && charconv_is_decimal_digit(*p); ++p)
+            {
+                anyDigits = true;
+                const unsigned int digit = static_cast<unsigned int>(*p - '0');
+                if (keptDigits < 19)
+                {
+                    if (mantissa != 0 || digit != 0)
+                    {
+                        mantissa = mantissa * 10 + digit;
+                        ++keptDigits;
+                    }
+                }
+                else
+                {
+                    ++exponent;
+                    truncated = truncated || digit != 0;
+                }
+            }
+
+            if (p != last && *p == '.')
+            {
+                ++p;
+                for (; p != last && charconv_is_decimal_digit(*p); ++p)
+                {
+                    anyDigits = true;
+                    const unsigned int digit = static_cast<unsigned int>(*p - '0');
+                    if (keptDigits < 19)
+                    {
+                        if (mantissa != 0 || digit != 0)
+                        {
+                            mantissa = mantissa * 10 + digit;
+                            ++keptDigits;
+                        }
+                        --exponent;
+                    }
+                    else
+                    {
+                        truncated = truncated || digit != 0;
+                    }
+                }
+            }
+
+            if (!anyDigits)
+            {
+                return nullptr;
+            }
+            parsed.significandFirst = first;
+            parsed.significandLast = p;
+
+            // The scientific format requires an exponent, and the fixed one doesn't have one.
+            const bool allowExponent = (fmt & chars_format::scientific) == chars_format::scientific;
+            const bool requireExponent = allowExponent && (fmt & chars_format::fixed) != chars_format::fixed;
+            std::int64_t explicitExponent = 0;
+            if (allowExponent && p != last && (*p == 'e' || *p == 'E'))
+            {
+                if (const char* end = charconv_parse_exponent(p + 1, last, explicitExponent))
+                {
+                    p = end;
+                }
+                else if (requireExponent)
+                {
+                    return nullptr;
+                }
+            }
+            else if (requireExponent)
+            {
+                return nullptr;
+            }
+
+            parsed.mantissa = mantissa;
+            parsed.exponent = exponent + explicitExponent;
+            parsed.truncated = truncated;
+            parsed.explicitExponent = explicitExponent;
+            return p;
+        }
+
+        /**
+         * @brief For inputs with more than 19 significant digits, where the value is between `lower` and the float
+         *        above it. Compares all the digits, as a big integer, with the point halfway between them.
+         */
+        template <class T>
+        charconv_adjusted_mantissa charconv_decide_exactly(const charconv_parsed_decimal& parsed, charconv_adjusted_mantissa lower) noexcept
+        {
+            using traits = charconv_float_traits<T>;
+
+            // The halfway points of doubles have at most 767 significant digits, so past that, only whether there are
+            // more nonzero digits matters.
+            constexpr int maxDigits = 780;
+            constexpr std::uint32_t powersOfTen[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+                1000000000};
+
+            charconv_bigint digits;
+            std::int64_t exponent = parsed.explicitExponent;
+            bool sticky = false;
+            bool inFraction = false;
+            int keptDigits = 0;
+            std::uint32_t chunk = 0;
+            int chunkDigits = 0;
+            for (const char* p = parsed.significandFirst; p != parsed.significandLast; ++p)
+            {
+                if (*p == '.')
+                {
+                    inFraction = true;
+                    continue;
+                }
+
+                const std::uint32_t digit = static_cast<std::uint32_t>(*p - '0');
+                if (keptDigits == 0 && digit == 0)
+                {
+                    exponent -= inFraction ? 1 : 0;
+                }
+                else if (keptDigits < maxDigits)
+                {
+                    chunk = chunk * 10 + digit;
+                    ++keptDigits;
+                    if (++chunkDigits == 9)
+                    {
+                        digits.MultiplyAdd(1000000000u, chunk);
+                        chunk = 0;
+                        chunkDigits = 0;
+                    }
+                    exponent -= inFraction ? 1 : 0;
+                }
+                else
+                {
+                    exponent += inFraction ? 0 : 1;
+                    sticky = sticky || digit != 0;
+                }
+            }
+            digits.MultiplyAdd(powersOfTen[chunkDigits], chunk);
+
+            // The halfway point is (2m + 1) * 2^(e - 1), and the input is digits * 5^exponent * 2^exponent. Moves the
+            // powers of five and two over to whichever side keeps them positive.
+            const std::uint64_t m = lower.power2 == 0 ? lower.mantissa : lower.mantissa | (std::uint64_t{1} << traits::mantissa_bits);
+            const int e = (lower.power2 == 0 ? 1 : lower.power2) - traits::exponent_bias - traits::mantissa_bits;
+            charconv_bigint halfway = charconv_bigint::FromUint64(2 * m + 1);
+            const std::int64_t halfwayExponent = e - 1;
+
+            if (exponent >= 0)
+            {
+                digits.MultiplyByPowerOfFive(static_cast<int>(exponent));
+            }
+            else
+            {
+                halfway.MultiplyByPowerOfFive(static_cast<int>(-exponent));
+            }
+            if (exponent > halfwayExponent)
+            {
+                digits.ShiftLeft(static_cast<int>(exponent - halfwayExponent));
+            }
+            else
+            {
+                halfway.ShiftLeft(static_cast<int>(halfwayExponent - exponent));
+            }
+
+            int order = charconv_bigint::Compare(digits, halfway);
+            if (order == 0 && sticky)
+            {
+                order = 1;
+            }
+            if (order > 0 || (order == 0 && (m & 1) != 0))
+            {
+                ++lower.mantissa;
+                if (lower.mantissa == (std::uint64_t{1} << traits::mantissa_bits))
+                {
+                    lower.mantissa = 0;
+                    ++lower.power2;
+                }
+            }
+            return lower;
+        }
+
+        inline bool charconv_starts_with_ignoring_case(const char* first, const char* last, const char* lowercase) noexcept
+        {
+            for (; *lowercase != '\0'; ++first, ++lowercase)
+            {
+                if (first == last || (*first | 0x20) != *lowercase)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Parses "inf", "infinity", "nan", or "nan(chars)", ignoring case. Returns null for anything else.
+         */
+        template <class T>
+        const char* charconv_parse_special(const char* p, const char* last, bool negative, T& value) noexcept
+        {
+            using bits_type = typename charconv_float_traits<T>::bits_type;
+            const bits_type signBit = negative ? bits_type{1} << (sizeof(bits_type) * 8 - 1) : 0;
+
+            if (charconv_starts_with_ignoring_case(p, last, "inf"))
+            {
+                p += 3;
+                if (charconv_starts_with_ignoring_case(p, last, "inity"))
+                {
+                    p += 5;
+                }
+                value = StdReimpl::bit_cast<T>(StdReimpl::bit_cast<bits_type>(std::numeric_limits<T>::infinity()) | signBit);
+                return p;
+            }
+
+            if (charconv_starts_with_ignoring_case(p, last, "nan"))
+            {
+                p += 3;
+                if (p != last && *p == '(')
+                {
+                    const char* q = p + 1;
+                    while (q != last && (charconv_digit_value(*q) < 36 || *q == '_'))
+                    {
+                        ++q;
+                    }
+                    if (q != last && *q == ')')
+                    {
+                        p = q + 1;
+                    }
+                }
+                value = StdReimpl::bit_cast<T>(StdReimpl::bit_cast<bits_type>(std::numeric_limits<T>::quiet_NaN()) | signBit);
+                return p;
+            }
+            return nullptr;
+        }
+
+        template <class T>
+        from_chars_result charconv_from_chars_hex(const char* first, const char* p, const char* last, bool negative,
+            T& value) noexcept
+        {
+            std::uint64_t mantissa = 0;
+            int keptDigits = 0;
+            std::int64_t exponent = 0;
+            bool sticky = false;
+            bool anyDigits = false;
+
+            for (; p != last && charconv_digit_value(*p) < 16; ++p)
+            {
+                anyDigits = true;
+                const unsigned int digit = charconv_digit_value(*p);
+                if (keptDigits < 16)
+                {
+                    if (mantissa != 0 || digit != 0)
+                    {
+                        mantissa = (mantissa << 4) | digit;
+                        ++keptDigits;
+                    }
+                }
+                else
+                {
+                    exponent += 4;
+                    sticky = sticky || digit != 0;
+                }
+            }
+
+            if (p != last && *p == '.')
+            {
+                ++p;
+                for (; p != last && charconv_digit_value(*p) < 16; ++p)
+                {
+                    anyDigits = true;
+                    const unsigned int digit = charconv_digit_value(*p);
+                    if (keptDigits < 16)
+                    {
+                        if (mantissa != 0 || digit != 0)
+                        {
+                            mantissa = (mantissa << 4) | digit;
+                            ++keptDigits;
+                        }
+                        exponent -= 4;
+                    }
+                    else
+                    {
+                        sticky = sticky || digit != 0;
+                    }
+                }
+            }
+
+            if (!anyDigits)
+            {
+                return {first, std::errc::invalid_argument};
+            }
+
+            if (p != last && (*p == 'p' || *p == 'P'))
+            {
+                std::int64_t explicitExponent = 0;
+                if (const char* end = charconv_parse_exponent(p + 1, last, explicitExponent))
+                {
+                    p = end;
+                    exponent += explicitExponent;
+                }
+            }
+
+            using bits_type = typename charconv_float_traits<T>::bits_type;
+            const bits_type signBit = negative ? bits_type{1} << (sizeof(bits_type) * 8 - 1) : 0;
+            if (mantissa == 0)
+            {
+                value = StdReimpl::bit_cast<T>(signBit);
+                return {p, std::errc{}};
+            }
+
+            const charconv_adjusted_mantissa rounded = charconv_round_binary<T>(mantissa, exponent, sticky);
+            if (rounded.power2 == charconv_float_traits<T>::infinite_exponent || (rounded.power2 == 0 && rounded.mantissa == 0))
+            {
+                return {p, std::errc::result_out_of_range};
+            }
+            value = StdReimpl::bit_cast<T>(static_cast<bits_type>(signBit | rounded.mantissa |
+                (static_cast<bits_type>(rounded.power2) << charconv_float_traits<T>::mantissa_bits)));
+            return {p, std::errc{}};
+        }
+
+        template <class T>
+        from_chars_result charconv_from_chars_float(const char* first, const char* last, T& value, chars_format fmt) noexcept
+        {
+            using traits = charconv_float_traits<T>;
+            using bits_type = typename traits::bits_type;
+
+            const char* p = first;
+            const bool negative = p != last && *p == '-';
+            if (negative)
+            {
+                ++p;
+            }
+
+            if (const char* end = charconv_parse_special(p, last, negative, value))
+            {
+                return {end, std::errc{}};
+            }
+            if (fmt == chars_format::hex)
+            {
+                return charconv_from_chars_hex(first, p, last, negative, value);
+            }
+
+            charconv_parsed_decimal parsed;
+            const char* end = charconv_parse_decimal(p, last, fmt, parsed);
+            if (end == nullptr)
+            {
+                return {first, std::errc::invalid_argument};
+            }
+
+            const bits_type signBit = negative ? bits_type{1} << (sizeof(bits_type) * 8 - 1) : 0;
+            if (parsed.mantissa == 0)
+            {
+                value = StdReimpl::bit_cast<T>(signBit);
+                return {end, std::errc{}};
+            }
+
+#if defined(CPPUTILS_STDREIMPL_CHARCONV_USE_CLINGER_FAST_PATH)
+            // When the digits and the power of ten are both exact, one correctly rounded operation gets the answer.
+            constexpr std::int64_t maxExactPower = static_cast<std::int64_t>(sizeof(traits::exact_powers_of_ten) / sizeof(T)) - 1;
+            if (!parsed.truncated && -maxExactPower <= parsed.exponent && parsed.exponent <= maxExactPower &&
+                parsed.mantissa <= (std::uint64_t{1} << (traits::mantissa_bits + 1)))
+            {
+                T result = static_cast<T>(parsed.mantissa);
+                if (parsed.exponent < 0)
+                {
+                    result = result / traits::exact_powers_of_ten[-parsed.exponent];
+                }
+                else
+                {
+                    result = result * traits::exact_powers_of_ten[parsed.exponent];
+                }
+                value = negative ? -result : result;
+                return {end, std::errc{}};
+            }
+#endif
+
+            charconv_adjusted_mantissa answer = charconv_eisel_lemire<T>(parsed.exponent, parsed.mantissa);
+            if (parsed.truncated && answer != charconv_eisel_lemire<T>(parsed.exponent, parsed.mantissa + 1))
+            {
+                answer = charconv_decide_exactly<T>(parsed, answer);
+            }
+
+            if (answer.power2 == traits::infinite_exponent || (answer.power2 == 0 && answer.mantissa == 0))
+            {
+                return {end, std::errc::result_out_of_range};
+            }
+            value = StdReimpl::bit_cast<T>(static_cast<bits_type>(signBit | answer.mantissa |
+                (static_cast<bits_type>(answer.power2) << traits::mantissa_bits)));
+            return {end, std::errc{}};
+        }
+    }
+
+    template <Detail::charconv_integer T>
+    constexpr to_chars_result to_chars(char* first, char* last, T value, int base)
+    {
+        assert(2 <= base && base <= 36);
+
+        using U = std::make_unsigned_t<T>;
+        U magnitude = static_cast<U>(value);
+        if constexpr (std::is_signed_v<T>)
+        {
+            if (value < 0)
+            {
+                if (first == last)
+                {
+                    return {last, std::errc::value_too_large};
+                }
+                *first++ = '-';
+                magnitude = static_cast<U>(0 - magnitude);
+            }
+        }
+        return Detail::charconv_to_chars_unsigned(first, last, magnitude, base);
+    }
+
+    inline to_chars_result to_chars(char* first, char* last, float value)
+    {
+        return Detail::charconv_to_chars_shortest(first, last, value, chars_format{});
+    }
+    inline to_chars_result to_chars(char* first, char* last, double value)
+    {
+        return Detail::charconv_to_chars_shortest(first, last, value, chars_format{});
+    }
+
+    inline to_chars_result to_chars(char* first, char* last, float value, chars_format fmt)
+    {
+        return Detail::charconv_to_chars_shortest(first, last, value, fmt);
+    }
+    inline to_chars_result to_chars(char* first, char* last, double value, chars_format fmt)
+    {
+        return Detail::charconv_to_chars_shortest(first, last, value, fmt);
+    }
+
+    inline to_chars_result to_chars(char* first, char* last, float value, chars_format fmt, int precision)
+    {
+        return Detail::charconv_to_chars_precision(first, last, value, fmt, precision);
+    }
+    inline to_chars_result to_chars(char* first, char* last, double value, chars_format fmt, int precision)
+    {
+        return Detail::charconv_to_chars_precision(first, last, value, fmt, precision);
+    }
+
+    template <Detail::charconv_integer T>
+    constexpr from_chars_result from_chars(const char* first, const char* last, T& value, int base)
+    {
+        assert(2 <= base && base <= 36);
+
+        using U = std::make_unsigned_t<T>;
+        const char* p = first;
+        bool negative = false;
+        if constexpr (std::is_signed_v<T>)
+        {
+            if (p != last && *p == '-')
+            {
+                negative = true;
+                ++p;
+            }
+        }
+
+        const U maxMagnitude = negative ? static_cast<U>(static_cast<U>(std::numeric_limits<T>::max()) + 1u)
+                                        : static_cast<U>(std::numeric_limits<T>::max());
+        const U unsignedBase = static_cast<U>(base);
+        const U cutoff = static_cast<U>(maxMagnitude / unsignedBase);
+        const unsigned int cutoffDigit = static_cast<unsigned int>(maxMagnitude % unsignedBase);
+
+        const char* digitsFirst = p;
+        U result = 0;
+        bool overflow = false;
+        for (; p != last; ++p)
+        {
+            const unsigned int digit = Detail::charconv_digit_value(*p);
+            if (digit >= static_cast<unsigned int>(base))
+            {
+                break;
+            }
+
+            if (result > cutoff || (result == cutoff && digit > cutoffDigit))
+            {
+                overflow = true;
+            }
+            else
+            {
+                result = static_cast<U>(result * unsignedBase + digit);
+            }
+        }
+
+        if (p == digitsFirst)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+        if (overflow)
+        {
+            return {p, std::errc::result_out_of_range};
+        }
+
+        value = static_cast<T>(negative ? static_cast<U>(0 - result) : result);
+        return {p, std::errc{}};
+    }
+
+    inline from_chars_result from_chars(const char* first, const char* last, float& value, chars_format fmt)
+    {
+        return Detail::charconv_from_chars_float(first, last, value, fmt);
+    }
+    inline from_chars_result from_chars(const char* first, const char* last, double& value, chars_format fmt)
+    {
+        return Detail::charconv_from_chars_float(first, last, value, fmt);
+    }
+}
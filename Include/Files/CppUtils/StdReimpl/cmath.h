@@ -0,0 +1,67 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/concepts.h>
+
+#include <span>
+
+namespace StdReimpl
+{
+    /**
+     * @brief Implemented by reading the sign bit directly, so it's exact for -0, infinities, and NaNs.
+     * @see https://eel.is/c++draft/c.math.fpclass
+     * @see https://cppreference.com/w/cpp/numeric/math/signbit
+     * @note Constexpr support is a feature from the C++23 standard.
+     */
+    template <StdReimpl::floating_point floating_point_type>
+    constexpr bool signbit(floating_point_type x) noexcept;
+
+    /**
+     * @brief Implemented by combining the bits of `mag` and `sgn`, so it's exact for -0, infinities, and NaNs.
+     * @see https://eel.is/c++draft/c.math
+     * @see https://cppreference.com/w/cpp/numeric/math/copysign
+     * @note Templated and constexpr support is a feature from the C++23 standard.
+     */
+    template <StdReimpl::floating_point floating_point_type>
+    constexpr floating_point_type copysign(floating_point_type mag, floating_point_type sgn) noexcept;
+
+    /**
+     * @brief Implemented by clearing the sign bit, so it's exact for -0, infinities, and NaNs.
+     * @see https://eel.is/c++draft/c.math.abs
+     * @see https://cppreference.com/w/cpp/numeric/math/fabs
+     * @note Templated and constexpr support is a feature from the C++23 standard.
+     */
+    template <StdReimpl::floating_point floating_point_type>
+    constexpr floating_point_type fabs(floating_point_type x) noexcept;
+
+    /**
+     * @brief Returns one of `FP_INFINITE`, `FP_NAN`, `FP_NORMAL`, `FP_SUBNORMAL`, or `FP_ZERO` from `<cmath>`.
+     * @see https://eel.is/c++draft/c.math.fpclass
+     * @see https://cppreference.com/w/cpp/numeric/math/fpclassify
+     * @note Constexpr support is a feature from the C++23 standard.
+     */
+    template <StdReimpl::floating_point floating_point_type>
+    constexpr int fpclassify(floating_point_type x) noexcept;
+
+    /**
+     * @brief Batch versions of `fabs`. Writes `fabs(x[i])` to `result[i]` for every element of `x`, using SSE2, AVX, or
+     *        NEON when available. `result` must be at least as big as `x`, and may be the same range as `x`, but must not
+     *        otherwise overlap it.
+     * @note Not part of the standard.
+     */
+    inline void fabs(std::span<const float> x, std::span<float> result) noexcept;
+    inline void fabs(std::span<const double> x, std::span<double> result) noexcept;
+
+    /**
+     * @brief Batch versions of `copysign`. Writes `copysign(mag[i], sgn[i])` to `result[i]` for every element of `mag`,
+     *        using SSE2, AVX, or NEON when available. `sgn` and `result` must be at least as big as `mag`. `result` may be
+     *        the same range as one of the inputs, but must not otherwise overlap them.
+     * @note Not part of the standard.
+     */
+    inline void copysign(std::span<const float> mag, std::span<const float> sgn, std::span<float> result) noexcept;
+    inline void copysign(std::span<const double> mag, std::span<const double> sgn, std::span<double> result) noexcept;
+}
+
+#include <CppUtils/StdReimpl/cmath.inl>
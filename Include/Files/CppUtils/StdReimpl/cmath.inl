@@ -0,0 +1,407 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/cmath.h>
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(__AVX__)
+#   include <immintrin.h>
+#   define CPPUTILS_STDREIMPL_CMATH_USE_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define CPPUTILS_STDREIMPL_CMATH_USE_SSE2 1
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#   include <arm_neon.h>
+#   define CPPUTILS_STDREIMPL_CMATH_USE_NEON 1
+#endif
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        /**
+         * @brief The unsigned integer with the same size as a `float` or `double`. Used to work on the value's bits
+         *        directly, both at runtime and in constant evaluation. `void` for types without one (e.g., `long double`).
+         */
+        template <class T>
+        using float_bits_t =
+            std::conditional_t<std::numeric_limits<T>::is_iec559 && sizeof(T) == sizeof(std::uint32_t), std::uint32_t,
+            std::conditional_t<std::numeric_limits<T>::is_iec559 && sizeof(T) == sizeof(std::uint64_t), std::uint64_t,
+            void>>;
+
+        template <class T>
+        constexpr bool has_float_bits_v = !std::is_void_v<float_bits_t<T>>;
+
+        template <class T>
+        constexpr float_bits_t<T> float_sign_mask = float_bits_t<T>(1) << (sizeof(T) * CHAR_BIT - 1);
+
+        template <class T>
+        constexpr float_bits_t<T> float_fraction_mask =
+            (float_bits_t<T>(1) << (std::numeric_limits<T>::digits - 1)) - 1;
+
+        template <class T>
+        constexpr float_bits_t<T> float_exponent_mask = ~(float_sign_mask<T> | float_fraction_mask<T>);
+
+        /**
+         * @brief The index of the byte holding the sign bit of a `long double`. Only used during constant evaluation, where
+         *        we can't defer to the standard library. Handles the x87 80-bit format (whose padding bytes come after
+         *        the value) and the IEEE binary64/binary128 formats.
+         */
+        template <class T>
+        consteval std::size_t long_double_sign_byte_index()
+        {
+            static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big,
+                "Mixed endian is not supported.");
+            static_assert(std::numeric_limits<T>::is_iec559 || std::numeric_limits<T>::digits == 64,
+                "Unsupported long double format.");
+
+            // The x87 extended format stores 10 bytes of value, regardless of its padded size.
+            constexpr std::size_t valueSize = (std::numeric_limits<T>::digits == 64) ? 10 : sizeof(T);
+
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                return valueSize - 1;
+            }
+            else
+            {
+                return 0;
+            }
+        }
+
+        template <class T>
+        constexpr bool constexpr_long_double_signbit(T x)
+        {
+            const auto bytes = std::bit_cast<std::array<unsigned char, sizeof(T)>>(x);
+            return (bytes[long_double_sign_byte_index<T>()] & 0x80u) != 0;
+        }
+
+        template <class T>
+        constexpr T constexpr_long_double_copysign(T mag, T sgn)
+        {
+            auto bytes = std::bit_cast<std::array<unsigned char, sizeof(T)>>(mag);
+            unsigned char& signByte = bytes[long_double_sign_byte_index<T>()];
+            signByte = static_cast<unsigned char>((signByte & 0x7Fu) | (StdReimpl::Detail::constexpr_long_double_signbit(sgn) ? 0x80u : 0u));
+            return std::bit_cast<T>(bytes);
+        }
+
+        template <class T>
+        constexpr int constexpr_long_double_fpclassify(T x)
+        {
+            // Without access to the bits in a portable way, we classify using comparisons. These are exact, just slower.
+            if (x != x)
+            {
+                return FP_NAN;
+            }
+            if (x == std::numeric_limits<T>::infinity() || x == -std::numeric_limits<T>::infinity())
+            {
+                return FP_INFINITE;
+            }
+            if (x == T(0))
+            {
+                return FP_ZERO;
+            }
+            if (x < std::numeric_limits<T>::min() && x > -std::numeric_limits<T>::min())
+            {
+                return FP_SUBNORMAL;
+            }
+            return FP_NORMAL;
+        }
+
+        template <class T>
+        void fabs_batch(const T* x, T* result, std::size_t count) noexcept;
+
+        template <class T>
+        void copysign_batch(const T* mag, const T* sgn, T* result, std::size_t count) noexcept;
+    }
+
+    template <StdReimpl::floating_point floating_point_type>
+    constexpr bool signbit(floating_point_type x) noexcept
+    {
+        using T = floating_point_type;
+
+        if constexpr (Detail::has_float_bits_v<T>)
+        {
+            return (std::bit_cast<Detail::float_bits_t<T>>(x) & Detail::float_sign_mask<T>) != 0;
+        }
+        else
+        {
+            if (std::is_constant_evaluated()) // if consteval
+            {
+                return Detail::constexpr_long_double_signbit(x);
+            }
+            else
+            {
+                return std::signbit(x);
+            }
+        }
+    }
+
+    template <StdReimpl::floating_point floating_point_type>
+    constexpr floating_point_type copysign(floating_point_type mag, floating_point_type sgn) noexcept
+    {
+        using T = floating_point_type;
+
+        if constexpr (Detail::has_float_bits_v<T>)
+        {
+            using Bits = Detail::float_bits_t<T>;
+            constexpr Bits signMask = Detail::float_sign_mask<T>;
+
+            // Branchless: take everything but the sign from `mag`, and only the sign from `sgn`.
+            return std::bit_cast<T>((std::bit_cast<Bits>(mag) & ~signMask) | (std::bit_cast<Bits>(sgn) & signMask));
+        }
+        else
+        {
+            if (std::is_constant_evaluated()) // if consteval
+            {
+                return Detail::constexpr_long_double_copysign(mag, sgn);
+            }
+            else
+            {
+                return std::copysign(mag, sgn);
+            }
+        }
+    }
+
+    template <StdReimpl::floating_point floating_point_type>
+    constexpr floating_point_type fabs(floating_point_type x) noexcept
+    {
+        using T = floating_point_type;
+
+        if constexpr (Detail::has_float_bits_v<T>)
+        {
+            using Bits = Detail::float_bits_t<T>;
+
+            return std::bit_cast<T>(std::bit_cast<Bits>(x) & ~Detail::float_sign_mask<T>);
+        }
+        else
+        {
+            if (std::is_constant_evaluated()) // if consteval
+            {
+                return Detail::constexpr_long_double_copysign(x, T(0));
+            }
+            else
+            {
+                return std::fabs(x);
+            }
+        }
+    }
+
+    template <StdReimpl::floating_point floating_point_type>
+    constexpr int fpclassify(floating_point_type x) noexcept
+    {
+        using T = floating_point_type;
+
+        if constexpr (Detail::has_float_bits_v<T>)
+        {
+            using Bits = Detail::float_bits_t<T>;
+
+            const Bits bits = std::bit_cast<Bits>(x);
+            const Bits exponent = bits & Detail::float_exponent_mask<T>;
+            const Bits fraction = bits & Detail::float_fraction_mask<T>;
+
+            if (exponent == Detail::float_exponent_mask<T>)
+            {
+                return (fraction != 0) ? FP_NAN : FP_INFINITE;
+            }
+            if (exponent == 0)
+            {
+                return (fraction != 0) ? FP_SUBNORMAL : FP_ZERO;
+            }
+            return FP_NORMAL;
+        }
+        else
+        {
+            if (std::is_constant_evaluated()) // if consteval
+            {
+                return Detail::constexpr_long_double_fpclassify(x);
+            }
+            else
+            {
+                return std::fpclassify(x);
+            }
+        }
+    }
+
+    inline void fabs(std::span<const float> x, std::span<float> result) noexcept
+    {
+        assert(result.size() >= x.size());
+        Detail::fabs_batch(x.data(), result.data(), x.size());
+    }
+    inline void fabs(std::span<const double> x, std::span<double> result) noexcept
+    {
+        assert(result.size() >= x.size());
+        Detail::fabs_batch(x.data(), result.data(), x.size());
+    }
+
+    inline void copysign(std::span<const float> mag, std::span<const float> sgn, std::span<float> result) noexcept
+    {
+        assert(sgn.size() >= mag.size());
+        assert(result.size() >= mag.size());
+        Detail::copysign_batch(mag.data(), sgn.data(), result.data(), mag.size());
+    }
+    inline void copysign(std::span<const double> mag, std::span<const double> sgn, std::span<double> result) noexcept
+    {
+        assert(sgn.size() >= mag.size());
+        assert(result.size() >= mag.size());
+        Detail::copysign_batch(mag.data(), sgn.data(), result.data(), mag.size());
+    }
+
+    namespace Detail
+    {
+        template <class T>
+        void fabs_batch(const T* x, T* result, std::size_t count) noexcept
+        {
+            static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>);
+
+            std::size_t i = 0;
+
+            // Each vector iteration loads before it stores, so `result == x` is fine.
+#if defined(CPPUTILS_STDREIMPL_CMATH_USE_AVX)
+            if constexpr (std::is_same_v<T, float>)
+            {
+                const __m256 mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+                for (; i + 8 <= count; i += 8)
+                {
+                    _mm256_storeu_ps(result + i, _mm256_and_ps(_mm256_loadu_ps(x + i), mask));
+                }
+            }
+            else
+            {
+                const __m256d mask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFF));
+                for (; i + 4 <= count; i += 4)
+                {
+                    _mm256_storeu_pd(result + i, _mm256_and_pd(_mm256_loadu_pd(x + i), mask));
+                }
+            }
+#elif defined(CPPUTILS_STDREIMPL_CMATH_USE_SSE2)
+            if constexpr (std::is_same_v<T, float>)
+            {
+                const __m128 mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+                for (; i + 4 <= count; i += 4)
+                {
+                    _mm_storeu_ps(result + i, _mm_and_ps(_mm_loadu_ps(x + i), mask));
+                }
+            }
+            else
+            {
+                const __m128d mask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFF));
+                for (; i + 2 <= count; i += 2)
+                {
+                    _mm_storeu_pd(result + i, _mm_and_pd(_mm_loadu_pd(x + i), mask));
+                }
+            }
+#elif defined(CPPUTILS_STDREIMPL_CMATH_USE_NEON)
+            if constexpr (std::is_same_v<T, float>)
+            {
+                // `vabsq_f32` only clears the sign bit, so it's exact for NaNs too.
+                for (; i + 4 <= count; i += 4)
+                {
+                    vst1q_f32(result + i, vabsq_f32(vld1q_f32(x + i)));
+                }
+            }
+#if defined(__aarch64__) || defined(_M_ARM64)
+            else
+            {
+                for (; i + 2 <= count; i += 2)
+                {
+                    vst1q_f64(result + i, vabsq_f64(vld1q_f64(x + i)));
+                }
+            }
+#endif
+#endif
+
+            // The scalar tail, and the whole range when there's no vector path.
+            for (; i < count; ++i)
+            {
+                result[i] = StdReimpl::fabs(x[i]);
+            }
+        }
+
+        template <class T>
+        void copysign_batch(const T* mag, const T* sgn, T* result, std::size_t count) noexcept
+        {
+            static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>);
+
+            std::size_t i = 0;
+
+#if defined(CPPUTILS_STDREIMPL_CMATH_USE_AVX)
+            if constexpr (std::is_same_v<T, float>)
+            {
+                const __m256 signMask = _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(0x80000000u)));
+                for (; i + 8 <= count; i += 8)
+                {
+                    const __m256 m = _mm256_andnot_ps(signMask, _mm256_loadu_ps(mag + i));
+                    const __m256 s = _mm256_and_ps(signMask, _mm256_loadu_ps(sgn + i));
+                    _mm256_storeu_ps(result + i, _mm256_or_ps(m, s));
+                }
+            }
+            else
+            {
+                const __m256d signMask = _mm256_castsi256_pd(_mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ull)));
+                for (; i + 4 <= count; i += 4)
+                {
+                    const __m256d m = _mm256_andnot_pd(signMask, _mm256_loadu_pd(mag + i));
+                    const __m256d s = _mm256_and_pd(signMask, _mm256_loadu_pd(sgn + i));
+                    _mm256_storeu_pd(result + i, _mm256_or_pd(m, s));
+                }
+            }
+#elif defined(CPPUTILS_STDREIMPL_CMATH_USE_SSE2)
+            if constexpr (std::is_same_v<T, float>)
+            {
+                const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u)));
+                for (; i + 4 <= count; i += 4)
+                {
+                    const __m128 m = _mm_andnot_ps(signMask, _mm_loadu_ps(mag + i));
+                    const __m128 s = _mm_and_ps(signMask, _mm_loadu_ps(sgn + i));
+                    _mm_storeu_ps(result + i, _mm_or_ps(m, s));
+                }
+            }
+            else
+            {
+                const __m128d signMask = _mm_castsi128_pd(_mm_set1_epi64x(static_cast<long long>(0x8000000000000000ull)));
+                for (; i + 2 <= count; i += 2)
+                {
+                    const __m128d m = _mm_andnot_pd(signMask, _mm_loadu_pd(mag + i));
+                    const __m128d s = _mm_and_pd(signMask, _mm_loadu_pd(sgn + i));
+                    _mm_storeu_pd(result + i, _mm_or_pd(m, s));
+                }
+            }
+#elif defined(CPPUTILS_STDREIMPL_CMATH_USE_NEON)
+            if constexpr (std::is_same_v<T, float>)
+            {
+                const uint32x4_t signMask = vdupq_n_u32(0x80000000u);
+                for (; i + 4 <= count; i += 4)
+                {
+                    // Bitwise select: the sign bit from `sgn`, everything else from `mag`.
+                    vst1q_f32(result + i, vbslq_f32(signMask, vld1q_f32(sgn + i), vld1q_f32(mag + i)));
+                }
+            }
+#if defined(__aarch64__) || defined(_M_ARM64)
+            else
+            {
+                const uint64x2_t signMask = vdupq_n_u64(0x8000000000000000ull);
+                for (; i + 2 <= count; i += 2)
+                {
+                    vst1q_f64(result + i, vbslq_f64(signMask, vld1q_f64(sgn + i), vld1q_f64(mag + i)));
+                }
+            }
+#endif
+#endif
+
+            for (; i < count; ++i)
+            {
+                result[i] = StdReimpl::copysign(mag[i], sgn[i]);
+            }
+        }
+    }
+}
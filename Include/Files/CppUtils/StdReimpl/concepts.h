@@ -4,6 +4,7 @@
 
 #include <type_traits>
 #include <functional>
+#include <utility>
 
 /**
  * @brief Rewrites of the standard library's concepts library. This is necessary for certain
@@ -19,6 +20,151 @@ namespace StdReimpl
          */
         template <class T, class U>
         concept same_as_impl = std::is_same_v<T, U>;
+
+        /**
+         * @brief Whether INVOKE of a `F` is a plain call expression, which it is unless `F` is a pointer to member.
+         *        That's the common case, e.g., function pointers and lambdas, and checking the call itself is much
+         *        cheaper to compile than going through `std::invoke`, which instantiates its dispatch on `F` and a
+         *        `std::forward` per argument first.
+         */
+        template <class F>
+        concept invoke_is_call = !std::is_member_pointer_v<std::remove_cvref_t<F>>;
+
+        template <class F, class... Args>
+        concept call_invocable = requires(F&& f, Args&&... args) {
+            static_cast<F&&>(f)(static_cast<Args&&>(args)...);
+        };
+
+        template <class F, class... Args>
+        concept nothrow_call_invocable = requires(F&& f, Args&&... args) {
+            { static_cast<F&&>(f)(static_cast<Args&&>(args)...) } noexcept;
+        };
+
+        template <class F, class... Args>
+        using call_result_t = decltype(std::declval<F>()(std::declval<Args>()...));
+
+        /**
+         * @brief INVOKE of a pointer to member, written as the expression itself when the object is a (class derived
+         *        from the) member's class, or a pointer to one. Anything else, e.g., a `std::reference_wrapper`, is left
+         *        to `std::invoke`, as is a `F` that isn't a pointer to member.
+         * @see https://eel.is/c++draft/func.require#1
+         */
+        template <class F, class... Args>
+        struct member_invoke
+        {
+            static constexpr bool is_direct = false;
+        };
+
+        template <class F, class T, class... Args>
+            requires (std::is_member_function_pointer_v<std::remove_cvref_t<F>>)
+        struct member_invoke<F, T, Args...>
+        {
+            static constexpr bool on_object = requires(F&& f, T&& t, Args&&... args) {
+                (static_cast<T&&>(t).*f)(static_cast<Args&&>(args)...);
+            };
+            static constexpr bool on_pointer = requires(F&& f, T&& t, Args&&... args) {
+                ((*static_cast<T&&>(t)).*f)(static_cast<Args&&>(args)...);
+            };
+            static constexpr bool is_direct = on_object || on_pointer;
+            static constexpr bool is_nothrow = on_object
+                ? requires(F&& f, T&& t, Args&&... args) { { (static_cast<T&&>(t).*f)(static_cast<Args&&>(args)...) } noexcept; }
+                : requires(F&& f, T&& t, Args&&... args) { { ((*static_cast<T&&>(t)).*f)(static_cast<Args&&>(args)...) } noexcept; };
+
+            static constexpr decltype(auto) Invoke(F&& f, T&& t, Args&&... args)
+                noexcept(is_nothrow)
+                requires (is_direct)
+            {
+                if constexpr (on_object)
+                {
+                    return (static_cast<T&&>(t).*f)(static_cast<Args&&>(args)...);
+                }
+                else
+                {
+                    return ((*static_cast<T&&>(t)).*f)(static_cast<Args&&>(args)...);
+                }
+            }
+        };
+
+        template <class F, class T>
+            requires (std::is_member_object_pointer_v<std::remove_cvref_t<F>>)
+        struct member_invoke<F, T>
+        {
+            static constexpr bool on_object = requires(F&& f, T&& t) {
+                static_cast<T&&>(t).*f;
+            };
+            static constexpr bool on_pointer = requires(F&& f, T&& t) {
+                (*static_cast<T&&>(t)).*f;
+            };
+            static constexpr bool is_direct = on_object || on_pointer;
+            static constexpr bool is_nothrow = on_object
+                ? requires(F&& f, T&& t) { { static_cast<T&&>(t).*f } noexcept; }
+                : requires(F&& f, T&& t) { { (*static_cast<T&&>(t)).*f } noexcept; };
+
+            static constexpr decltype(auto) Invoke(F&& f, T&& t)
+                noexcept(is_nothrow)
+                requires (is_direct)
+            {
+                if constexpr (on_object)
+                {
+                    return static_cast<T&&>(t).*f;
+                }
+                else
+                {
+                    return (*static_cast<T&&>(t)).*f;
+                }
+            }
+        };
+
+        template <class F, class... Args>
+        using member_invoke_result_t = decltype(StdReimpl::Detail::member_invoke<F, Args...>::Invoke(std::declval<F>(), std::declval<Args>()...));
+
+        /**
+         * @brief `std::is_invocable_r_v` as a concept, which only falls back to the standard trait for the pointers to
+         *        members that `member_invoke` leaves to it. Being a concept, its conjunctions stop at the first
+         *        unsatisfied operand.
+         */
+        template <class R, class F, class... Args>
+        concept invocable_r =
+            (StdReimpl::Detail::invoke_is_call<F>
+                && StdReimpl::Detail::call_invocable<F, Args...>
+                && (std::is_void_v<R> || std::is_convertible_v<StdReimpl::Detail::call_result_t<F, Args...>, R>))
+            || (!StdReimpl::Detail::invoke_is_call<F>
+                && StdReimpl::Detail::member_invoke<F, Args...>::is_direct
+                && (std::is_void_v<R> || std::is_convertible_v<StdReimpl::Detail::member_invoke_result_t<F, Args...>, R>))
+            || (!StdReimpl::Detail::invoke_is_call<F>
+                && !StdReimpl::Detail::member_invoke<F, Args...>::is_direct
+                && std::is_invocable_r_v<R, F, Args...>);
+
+        /**
+         * @brief `std::is_nothrow_invocable_r_v` as a concept, which only falls back to the standard trait for the
+         *        pointers to members that `member_invoke` leaves to it.
+         */
+        template <class R, class F, class... Args>
+        concept nothrow_invocable_r =
+            (StdReimpl::Detail::invoke_is_call<F>
+                && StdReimpl::Detail::nothrow_call_invocable<F, Args...>
+                && (std::is_void_v<R> || std::is_nothrow_convertible_v<StdReimpl::Detail::call_result_t<F, Args...>, R>))
+            || (!StdReimpl::Detail::invoke_is_call<F>
+                && StdReimpl::Detail::member_invoke<F, Args...>::is_direct
+                && StdReimpl::Detail::member_invoke<F, Args...>::is_nothrow
+                && (std::is_void_v<R> || std::is_nothrow_convertible_v<StdReimpl::Detail::member_invoke_result_t<F, Args...>, R>))
+            || (!StdReimpl::Detail::invoke_is_call<F>
+                && !StdReimpl::Detail::member_invoke<F, Args...>::is_direct
+                && std::is_nothrow_invocable_r_v<R, F, Args...>);
+
+        // The concepts above as variables, for argument lists that expand a pack into `F`, which a concept can't take.
+
+        template <class R, class F, class... Args>
+        inline constexpr bool is_invocable_r_v = StdReimpl::Detail::invocable_r<R, F, Args...>;
+
+        template <class R, class F, class... Args>
+        inline constexpr bool is_nothrow_invocable_r_v = StdReimpl::Detail::nothrow_invocable_r<R, F, Args...>;
+
+        template <class F, class... Args>
+        inline constexpr bool is_invocable_v = StdReimpl::Detail::invocable_r<void, F, Args...>;
+
+        template <class F, class... Args>
+        inline constexpr bool is_nothrow_invocable_v = StdReimpl::Detail::nothrow_invocable_r<void, F, Args...>;
     }
 
     /**
@@ -64,9 +210,12 @@ namespace StdReimpl
      * @see https://eel.is/c++draft/concept.invocable#concept:invocable
      */
     template <class F, class... Args>
-    concept invocable = requires(F&& f, Args&&... args) {
-        std::invoke(std::forward<F>(f), std::forward<Args>(args)...); // not required to be equality-preserving
-    };
+    concept invocable =
+        (StdReimpl::Detail::invoke_is_call<F> && StdReimpl::Detail::call_invocable<F, Args...>)
+        || (!StdReimpl::Detail::invoke_is_call<F> && StdReimpl::Detail::member_invoke<F, Args...>::is_direct)
+        || (!StdReimpl::Detail::invoke_is_call<F> && !StdReimpl::Detail::member_invoke<F, Args...>::is_direct && requires(F&& f, Args&&... args) {
+            std::invoke(std::forward<F>(f), std::forward<Args>(args)...); // not required to be equality-preserving
+        });
 
     /**
      * @see https://eel.is/c++draft/concept.regularinvocable#concept:regular_invocable
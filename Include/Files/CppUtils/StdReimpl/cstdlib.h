@@ -5,6 +5,8 @@
 #include <CppUtils_StdReimpl_Export.h>
 #include <CppUtils/StdReimpl/concepts.h>
 
+#include <span>
+
 namespace StdReimpl
 {
     /**
@@ -16,15 +18,34 @@ namespace StdReimpl
     constexpr long int abs(long int j);
     constexpr long long int abs(long long int j);
 
-#if 0 // Disabled until we have `std::signbit` reimplemented.
     /**
+     * @brief Implemented with `StdReimpl::fabs`, so it's exact for -0, infinities, and NaNs.
      * @see https://eel.is/c++draft/c.math.abs
      * @see https://cppreference.com/w/cpp/numeric/math/fabs
      * @note Templated and constexpr support is a feature from the C++23 standard.
      */
     template <StdReimpl::floating_point floating_point_type>
     constexpr floating_point_type abs(floating_point_type x);
-#endif // #if 0
+
+    /**
+     * @brief Batch versions of the floating point `abs`. Same as the batch `StdReimpl::fabs` from `cmath.h`.
+     * @note Not part of the standard.
+     */
+    inline void abs(std::span<const float> x, std::span<float> result) noexcept;
+    inline void abs(std::span<const double> x, std::span<double> result) noexcept;
+
+    template <class T, class Abi>
+    class simd;
+
+    /**
+     * @brief Element-wise `abs` of a `simd` from `simd.h`, which is where it's defined. Clears the sign bits of
+     *        floating point elements, so it's exact for -0, infinities, and NaNs.
+     * @see https://eel.is/c++draft/simd.math
+     * @note A feature from the C++26 standard.
+     */
+    template <class T, class Abi>
+        requires StdReimpl::signed_integral<T> || StdReimpl::floating_point<T>
+    constexpr simd<T, Abi> abs(const simd<T, Abi>& j);
 }
 
 #include <CppUtils/StdReimpl/cstdlib.inl>
@@ -3,7 +3,9 @@
 #pragma once
 
 #include <CppUtils/StdReimpl/cstdlib.h>
+#include <CppUtils/StdReimpl/cmath.h>
 
+#include <cstdlib>
 #include <type_traits>
 
 namespace StdReimpl
@@ -27,28 +29,20 @@ namespace StdReimpl
         return Detail::abs(j);
     }
 
-#if 0 // Disabled until we have `std::signbit` reimplemented.
     template <StdReimpl::floating_point floating_point_type>
     constexpr floating_point_type abs(floating_point_type x)
     {
-        if (std::is_constant_evaluated()) // if consteval
-        {
-            // A manual implementation, based on a simple branch.
-
-            // Use the sign bit to determine negativity. To support -0 and -inf. Note: NaN propogation will naturally occur.
-            if (std::signbit(x)) // TODO: Reimplement `signbit` for constexpr support.
-            {
-                return -x;
-            }
+        return StdReimpl::fabs(x);
+    }
 
-            return x;
-        }
-        else
-        {
-            return std::abs(x);
-        }
+    inline void abs(std::span<const float> x, std::span<float> result) noexcept
+    {
+        StdReimpl::fabs(x, result);
+    }
+    inline void abs(std::span<const double> x, std::span<double> result) noexcept
+    {
+        StdReimpl::fabs(x, result);
     }
-#endif // #if 0
 
     namespace Detail
     {
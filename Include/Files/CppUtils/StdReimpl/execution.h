@@ -0,0 +1,1557 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/atomic.h>
+#include <CppUtils/StdReimpl/latch.h>
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+/**
+ * @brief The most tasks a `bulk` on a `static_thread_pool` splits its work into, which are stored in its operation state
+ *        so that starting it allocates nothing. Pools with more threads than this use only this many for one `bulk`.
+ */
+#ifndef CPPUTILS_STDREIMPL_EXECUTION_BULK_MAX_TASKS
+#   define CPPUTILS_STDREIMPL_EXECUTION_BULK_MAX_TASKS 64
+#endif
+
+namespace StdReimpl
+{
+    namespace execution
+    {
+        struct sender_t
+        {
+        };
+
+        struct receiver_t
+        {
+        };
+
+        struct operation_state_t
+        {
+        };
+
+        struct scheduler_t
+        {
+        };
+
+        /**
+         * @brief Completes a receiver with values, by calling its `set_value` member.
+         * @see https://eel.is/c++draft/exec.set.value
+         * @note A feature from the C++26 standard.
+         */
+        struct set_value_t
+        {
+            template <class Rcvr, class... Vs>
+            void operator()(Rcvr&& rcvr, Vs&&... vs) const noexcept;
+        };
+
+        struct set_error_t
+        {
+            template <class Rcvr, class E>
+            void operator()(Rcvr&& rcvr, E&& e) const noexcept;
+        };
+
+        struct set_stopped_t
+        {
+            template <class Rcvr>
+            void operator()(Rcvr&& rcvr) const noexcept;
+        };
+
+        inline constexpr set_value_t set_value{};
+        inline constexpr set_error_t set_error{};
+        inline constexpr set_stopped_t set_stopped{};
+
+        /**
+         * @brief Lists the ways a sender can complete, as function types whose return type is the completion tag and
+         *        whose parameters are what it completes with, e.g., `set_value_t(int)`.
+         * @see https://eel.is/c++draft/exec.cmplsig
+         * @note A feature from the C++26 standard.
+         */
+        template <class... Sigs>
+        struct completion_signatures
+        {
+        };
+
+        struct empty_env
+        {
+        };
+
+        /**
+         * @brief Gets the environment of a sender or receiver from its `get_env` member, or an `empty_env` if it has none.
+         * @see https://eel.is/c++draft/exec.get.env
+         * @note A feature from the C++26 standard.
+         */
+        struct get_env_t
+        {
+            template <class T>
+            auto operator()(const T& t) const noexcept;
+        };
+
+        inline constexpr get_env_t get_env{};
+
+        template <class T>
+        using env_of_t = decltype(execution::get_env(std::declval<T>()));
+    }
+
+    namespace Detail
+    {
+        template <class Env, class Query>
+        concept execution_has_query = requires(const Env& env) { env.query(Query()); };
+    }
+
+    namespace execution
+    {
+        /**
+         * @brief Gets from the environment of a sender the scheduler on whose execution resource it completes with `Tag`.
+         * @see https://eel.is/c++draft/exec.get.compl.sched
+         * @note A feature from the C++26 standard.
+         */
+        template <class Tag>
+        struct get_completion_scheduler_t
+        {
+            template <class Env>
+                requires Detail::execution_has_query<Env, get_completion_scheduler_t<Tag>>
+            auto operator()(const Env& env) const noexcept;
+        };
+
+        template <class Tag>
+        inline constexpr get_completion_scheduler_t<Tag> get_completion_scheduler{};
+
+        /**
+         * @brief Connects a sender to a receiver, by calling the sender's `connect` member, which returns the operation
+         *        state that holds everything the work needs until it completes.
+         * @see https://eel.is/c++draft/exec.connect
+         * @note A feature from the C++26 standard.
+         */
+        struct connect_t
+        {
+            template <class Sndr, class Rcvr>
+                requires requires(Sndr&& sndr, Rcvr&& rcvr) { std::forward<Sndr>(sndr).connect(std::forward<Rcvr>(rcvr)); }
+            auto operator()(Sndr&& sndr, Rcvr&& rcvr) const
+                noexcept(noexcept(std::forward<Sndr>(sndr).connect(std::forward<Rcvr>(rcvr))));
+        };
+
+        struct start_t
+        {
+            template <class Op>
+            void operator()(Op& op) const noexcept;
+        };
+
+        struct schedule_t
+        {
+            template <class Sch>
+                requires requires(Sch&& sch) { std::forward<Sch>(sch).schedule(); }
+            auto operator()(Sch&& sch) const noexcept(noexcept(std::forward<Sch>(sch).schedule()));
+        };
+
+        inline constexpr connect_t connect{};
+        inline constexpr start_t start{};
+        inline constexpr schedule_t schedule{};
+
+        template <class Sndr>
+        concept sender = std::derived_from<typename std::remove_cvref_t<Sndr>::sender_concept, sender_t> &&
+            std::move_constructible<std::remove_cvref_t<Sndr>> && std::constructible_from<std::remove_cvref_t<Sndr>, Sndr>;
+
+        template <class Rcvr>
+        concept receiver = std::derived_from<typename std::remove_cvref_t<Rcvr>::receiver_concept, receiver_t> &&
+            std::move_constructible<std::remove_cvref_t<Rcvr>> && std::constructible_from<std::remove_cvref_t<Rcvr>, Rcvr>;
+
+        template <class Op>
+        concept operation_state = std::derived_from<typename Op::operation_state_concept, operation_state_t> &&
+            std::is_object_v<Op> && requires(Op& op) { { op.start() } noexcept; };
+
+        template <class Sndr, class Rcvr>
+        concept sender_to = sender<Sndr> && receiver<Rcvr> && requires(Sndr&& sndr, Rcvr&& rcvr)
+        {
+            execution::connect(std::forward<Sndr>(sndr), std::forward<Rcvr>(rcvr));
+        };
+
+        template <class Sch>
+        concept scheduler = requires(Sch&& sch) { { execution::schedule(std::forward<Sch>(sch)) } -> sender; } &&
+            std::equality_comparable<std::remove_cvref_t<Sch>> && std::copy_constructible<std::remove_cvref_t<Sch>>;
+
+        template <class Sndr, class Rcvr>
+        using connect_result_t = decltype(execution::connect(std::declval<Sndr>(), std::declval<Rcvr>()));
+
+        template <class Sch>
+        using schedule_result_t = decltype(execution::schedule(std::declval<Sch>()));
+
+        template <class Sndr>
+        using completion_signatures_of_t = typename std::remove_cvref_t<Sndr>::completion_signatures;
+    }
+
+    namespace Detail
+    {
+        inline constexpr bool execution_has_exceptions =
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            true;
+#else
+            false;
+#endif
+
+        template <class... Ts>
+        struct execution_list
+        {
+        };
+
+        template <class... Lists>
+        struct execution_concat
+        {
+            using type = execution_list<>;
+        };
+
+        template <class... As>
+        struct execution_concat<execution_list<As...>>
+        {
+            using type = execution_list<As...>;
+        };
+
+        template <class... As, class... Bs, class... Rest>
+        struct execution_concat<execution_list<As...>, execution_list<Bs...>, Rest...>
+            : execution_concat<execution_list<As..., Bs...>, Rest...>
+        {
+        };
+
+        template <class Out, class In>
+        struct execution_unique
+        {
+            using type = Out;
+        };
+
+        template <class... Out, class First, class... Rest>
+        struct execution_unique<execution_list<Out...>, execution_list<First, Rest...>>
+            : execution_unique<std::conditional_t<(std::is_same_v<First, Out> || ...), execution_list<Out...>, execution_list<Out..., First>>,
+                execution_list<Rest...>>
+        {
+        };
+
+        template <template <class...> class F, class List>
+        struct execution_apply;
+
+        template <template <class...> class F, class... Ts>
+        struct execution_apply<F, execution_list<Ts...>>
+        {
+            using type = F<Ts...>;
+        };
+
+        template <template <class...> class F, class List>
+        using execution_apply_t = typename execution_apply<F, List>::type;
+
+        template <class T, class List>
+        struct execution_index_of;
+
+        template <class T, class... Ts>
+        struct execution_index_of<T, execution_list<T, Ts...>> : std::integral_constant<std::size_t, 0>
+        {
+        };
+
+        template <class T, class U, class... Ts>
+        struct execution_index_of<T, execution_list<U, Ts...>>
+            : std::integral_constant<std::size_t, 1 + execution_index_of<T, execution_list<Ts...>>::value>
+        {
+        };
+
+        /**
+         * @brief The signatures of `Sigs`, which is either a `completion_signatures` or an `execution_list`, as an
+         *        `execution_list`.
+         */
+        template <class Sigs>
+        struct execution_signature_list
+        {
+            using type = Sigs;
+        };
+
+        template <class... Sigs>
+        struct execution_signature_list<execution::completion_signatures<Sigs...>>
+        {
+            using type = execution_list<Sigs...>;
+        };
+
+        /**
+         * @brief Merges lists of signatures into one `completion_signatures`, without duplicates.
+         */
+        template <class... SigLists>
+        using execution_merge_signatures_t = execution_apply_t<execution::completion_signatures,
+            typename execution_unique<execution_list<>, typename execution_concat<typename execution_signature_list<SigLists>::type...>::type>::type>;
+
+        /**
+         * @brief Maps each signature of `Sigs` to a list of signatures with `Transform<Sig>::type`, and merges the results.
+         */
+        template <template <class> class Transform, class Sigs>
+        struct execution_transform_signatures;
+
+        template <template <class> class Transform, class... Sigs>
+        struct execution_transform_signatures<Transform, execution::completion_signatures<Sigs...>>
+        {
+            using type = execution_merge_signatures_t<typename Transform<Sigs>::type...>;
+        };
+
+        template <template <class> class Transform, class Sigs>
+        using execution_transform_signatures_t = typename execution_transform_signatures<Transform, Sigs>::type;
+
+        template <class Tag, template <class...> class Tuple, class Sig>
+        struct execution_gather_one
+        {
+            using type = execution_list<>;
+        };
+
+        template <class Tag, template <class...> class Tuple, class... As>
+        struct execution_gather_one<Tag, Tuple, Tag(As...)>
+        {
+            using type = execution_list<Tuple<As...>>;
+        };
+
+        /**
+         * @brief Collects `Tuple<Args...>` for each signature `Tag(Args...)` of `Sigs`, without duplicates, as
+         *        `Variant<Tuples...>`.
+         */
+        template <class Tag, class Sigs, template <class...> class Tuple, template <class...> class Variant>
+        struct execution_gather;
+
+        template <class Tag, class... Sigs, template <class...> class Tuple, template <class...> class Variant>
+        struct execution_gather<Tag, execution::completion_signatures<Sigs...>, Tuple, Variant>
+        {
+            using type = execution_apply_t<Variant,
+                typename execution_unique<execution_list<>, typename execution_concat<typename execution_gather_one<Tag, Tuple, Sigs>::type...>::type>::type>;
+        };
+
+        template <class... Ts>
+        using execution_decayed_tuple = std::tuple<std::decay_t<Ts>...>;
+
+        struct execution_empty_variant
+        {
+            execution_empty_variant() = delete;
+        };
+
+        template <class... Ts>
+        struct execution_variant_or_empty_impl
+        {
+            using type = std::variant<std::decay_t<Ts>...>;
+        };
+
+        template <>
+        struct execution_variant_or_empty_impl<>
+        {
+            using type = execution_empty_variant;
+        };
+
+        template <class... Ts>
+        using execution_variant_or_empty = typename execution_variant_or_empty_impl<Ts...>::type;
+
+        template <class... Ts>
+        using execution_monostate_variant = std::variant<std::monostate, Ts...>;
+
+        template <class... Ts>
+        struct execution_single_impl
+        {
+            static_assert(sizeof...(Ts) == 1, "The sender must complete with exactly one set of values.");
+        };
+
+        template <class T>
+        struct execution_single_impl<T>
+        {
+            using type = T;
+        };
+
+        template <class... Ts>
+        using execution_single = typename execution_single_impl<Ts...>::type;
+
+        template <class T>
+        struct execution_value_signature
+        {
+            using type = execution::set_value_t(T);
+        };
+
+        template <>
+        struct execution_value_signature<void>
+        {
+            using type = execution::set_value_t();
+        };
+
+        template <class T>
+        using execution_value_signature_t = typename execution_value_signature<T>::type;
+
+        /**
+         * @brief `set_error_t(std::exception_ptr)` if `MayThrow` and exceptions are enabled, so that an operation can
+         *        report what was thrown while it ran, and nothing otherwise.
+         */
+        template <bool MayThrow>
+        using execution_exception_signature = std::conditional_t<MayThrow && execution_has_exceptions,
+            execution_list<execution::set_error_t(std::exception_ptr)>, execution_list<>>;
+    }
+
+    namespace execution
+    {
+        /**
+         * @brief The types of the values that `Sndr` can complete with, as `Variant<Tuple<Values...>...>`.
+         * @see https://eel.is/c++draft/exec.getcomplsigs
+         * @note A feature from the C++26 standard.
+         */
+        template <class Sndr, template <class...> class Tuple = Detail::execution_decayed_tuple,
+            template <class...> class Variant = Detail::execution_variant_or_empty>
+        using value_types_of_t = typename Detail::execution_gather<set_value_t, completion_signatures_of_t<Sndr>, Tuple, Variant>::type;
+
+        template <class Sndr, template <class...> class Variant = Detail::execution_variant_or_empty>
+        using error_types_of_t = typename Detail::execution_gather<set_error_t, completion_signatures_of_t<Sndr>, Detail::execution_single, Variant>::type;
+
+        template <class Sndr>
+        inline constexpr bool sends_stopped = !std::is_same_v<
+            typename Detail::execution_gather<set_stopped_t, completion_signatures_of_t<Sndr>, Detail::execution_list, Detail::execution_list>::type,
+            Detail::execution_list<>>;
+
+        class static_thread_pool;
+    }
+
+    namespace Detail
+    {
+        /**
+         * @brief A base for operation states, which must stay where they are once connected, since the receivers of the
+         *        operations they contain point back into them.
+         */
+        struct execution_immovable
+        {
+            execution_immovable() = default;
+            execution_immovable(const execution_immovable&) = delete;
+            execution_immovable& operator=(const execution_immovable&) = delete;
+        };
+
+        /**
+         * @brief Converts to the result of calling `fn`, so that emplacing it into a `std::optional`, `std::variant` or
+         *        `std::tuple` constructs an immovable operation state right there from what `connect` returns.
+         */
+        template <class Fn>
+        struct execution_emplace
+        {
+            operator std::invoke_result_t<Fn>() &&;
+
+            Fn fn;
+        };
+
+        template <class Fn>
+        execution_emplace(Fn) -> execution_emplace<Fn>;
+
+        /**
+         * @brief The receiver that the operation states of the adaptors connect their children to. It forwards each
+         *        completion to `op->complete<Index>(tag, args...)`, and the environment of `op->rcvr`.
+         */
+        template <class Op, std::size_t Index = 0>
+        struct execution_receiver
+        {
+            using receiver_concept = execution::receiver_t;
+
+            template <class... Vs>
+            void set_value(Vs&&... vs) && noexcept;
+
+            template <class E>
+            void set_error(E&& e) && noexcept;
+
+            void set_stopped() && noexcept;
+
+            auto get_env() const noexcept;
+
+            Op* op;
+        };
+
+        /**
+         * @brief What an adaptor returns when it's called without a sender, to be applied to one with `operator|`.
+         */
+        template <class Tag, class... Args>
+        struct execution_closure
+        {
+            template <execution::sender Sndr>
+            friend auto operator|(Sndr&& sndr, execution_closure self)
+            {
+                return std::apply([&sndr](Args&... args) { return Tag()(std::forward<Sndr>(sndr), std::move(args)...); }, self.args);
+            }
+
+            std::tuple<Args...> args;
+        };
+
+        /**
+         * @brief Calls `fn`, and completes `rcvr` with the exception if it throws.
+         */
+        template <class Rcvr, class Fn>
+        void execution_try(Rcvr& rcvr, Fn&& fn) noexcept;
+
+        //
+        // just
+        //
+
+        template <class Rcvr, class... Ts>
+        struct just_operation : execution_immovable
+        {
+            using operation_state_concept = execution::operation_state_t;
+
+            just_operation(std::tuple<Ts...> inValues, Rcvr inRcvr);
+
+            void start() & noexcept;
+
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS std::tuple<Ts...> values;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Rcvr rcvr;
+        };
+
+        template <class... Ts>
+        struct just_sender
+        {
+            using sender_concept = execution::sender_t;
+            using completion_signatures = execution::completion_signatures<execution::set_value_t(Ts...)>;
+
+            template <execution::receiver Rcvr>
+            just_operation<std::remove_cvref_t<Rcvr>, Ts...> connect(Rcvr&& rcvr) &&;
+
+            template <execution::receiver Rcvr>
+            just_operation<std::remove_cvref_t<Rcvr>, Ts...> connect(Rcvr&& rcvr) const&
+                requires (std::copy_constructible<Ts> && ...);
+
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS std::tuple<Ts...> values;
+        };
+
+        //
+        // then
+        //
+
+        template <class Fn>
+        struct then_transform
+        {
+            template <class Sig>
+            struct apply
+            {
+                using type = execution_list<Sig>;
+            };
+
+            template <class... As>
+            struct apply<execution::set_value_t(As...)>
+            {
+                using type = typename execution_concat<execution_list<execution_value_signature_t<std::invoke_result_t<Fn, As...>>>,
+                    execution_exception_signature<!std::is_nothrow_invocable_v<Fn, As...>>>::type;
+            };
+        };
+
+        /**
+         * @brief Calls the function with the values its sender completes with, in the frame of that completion, so that
+         *        a chain of `then`s adds no operation state of its own.
+         */
+        template <class Rcvr, class Fn>
+        struct then_receiver
+        {
+            using receiver_concept = execution::receiver_t;
+
+            template <class... Vs>
+            void set_value(Vs&&... vs) && noexcept;
+
+            template <class E>
+            void set_error(E&& e) && noexcept;
+
+            void set_stopped() && noexcept;
+
+            auto get_env() const noexcept;
+
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Rcvr rcvr;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Fn fn;
+        };
+
+        template <class Child, class Fn>
+        struct then_sender
+        {
+            using sender_concept = execution::sender_t;
+            using completion_signatures =
+                execution_transform_signatures_t<then_transform<Fn>::template apply, execution::completion_signatures_of_t<Child>>;
+
+            template <execution::receiver Rcvr>
+            auto connect(Rcvr&& rcvr) &&;
+
+            template <execution::receiver Rcvr>
+            auto connect(Rcvr&& rcvr) const&
+                requires std::copy_constructible<Child> && std::copy_constructible<Fn>;
+
+            auto get_env() const noexcept;
+
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Child child;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Fn fn;
+        };
+
+        //
+        // let_value
+        //
+
+        template <class Fn>
+        struct let_value_transform
+        {
+            template <class Sig>
+            struct apply
+            {
+                using type = execution_list<Sig>;
+            };
+
+            template <class... As>
+            struct apply<execution::set_value_t(As...)>
+            {
+                using type = typename execution_concat<
+                    typename execution_signature_list<execution::completion_signatures_of_t<std::invoke_result_t<Fn, std::decay_t<As>&...>>>::type,
+                    execution_exception_signature<true>>::type;
+            };
+        };
+
+        template <class Fn, class Rcvr>
+        struct let_value_second
+        {
+            template <class Tuple>
+            struct apply;
+
+            template <class... Ts>
+            struct apply<std::tuple<Ts...>>
+            {
+                using type = execution::connect_result_t<std::invoke_result_t<Fn, Ts&...>, Rcvr>;
+            };
+        };
+
+        template <template <class> class F, class List>
+        struct execution_map;
+
+        template <template <class> class F, class... Ts>
+        struct execution_map<F, execution_list<Ts...>>
+        {
+            using type = execution_list<typename F<Ts>::type...>;
+        };
+
+        /**
+         * @brief Keeps the values the first sender completed with, and the operation state of the sender that the function
+         *        returns for them, in place, so that they live for as long as that second operation runs.
+         */
+        template <class Child, class Fn, class Rcvr>
+        struct let_value_operation : execution_immovable
+        {
+            using operation_state_concept = execution::operation_state_t;
+
+            using arguments_list = execution::value_types_of_t<Child, execution_decayed_tuple, execution_list>;
+            using arguments_type = execution_apply_t<execution_monostate_variant, arguments_list>;
+            using second_type = execution_apply_t<execution_monostate_variant,
+                typename execution_map<let_value_second<Fn, Rcvr>::template apply, arguments_list>::type>;
+
+            let_value_operation(Child inChild, Fn inFn, Rcvr inRcvr);
+
+            void start() & noexcept;
+
+            template <std::size_t Index, class Tag, class... Args>
+            void complete(Tag tag, Args&&... args) noexcept;
+
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Fn fn;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Rcvr rcvr;
+            arguments_type arguments;
+            second_type second;
+            execution::connect_result_t<Child, execution_receiver<let_value_operation>> first;
+        };
+
+        template <class Child, class Fn>
+        struct let_value_sender
+        {
+            using sender_concept = execution::sender_t;
+            using completion_signatures =
+                execution_transform_signatures_t<let_value_transform<Fn>::template apply, execution::completion_signatures_of_t<Child>>;
+
+            template <execution::receiver Rcvr>
+            let_value_operation<Child, Fn, std::remove_cvref_t<Rcvr>> connect(Rcvr&& rcvr) &&;
+
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Child child;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Fn fn;
+        };
+
+        //
+        // when_all
+        //
+
+        template <class... Tuples>
+        struct when_all_value_signature
+        {
+            using type = execution::set_value_t();
+        };
+
+        template <class... As>
+        struct when_all_value_signature<std::tuple<As...>>
+        {
+            using type = execution::set_value_t(As...);
+        };
+
+        template <class... As, class... Bs, class... Rest>
+        struct when_all_value_signature<std::tuple<As...>, std::tuple<Bs...>, Rest...>
+            : when_all_value_signature<std::tuple<As..., Bs...>, Rest...>
+        {
+        };
+
+        struct when_all_transform
+        {
+            template <class Sig>
+            struct apply
+            {
+                using type = execution_list<>;
+            };
+
+            template <class E>
+            struct apply<execution::set_error_t(E)>
+            {
+                using type = execution_list<execution::set_error_t(std::decay_t<E>)>;
+            };
+        };
+
+        template <class... Children>
+        using when_all_signatures_t = execution_merge_signatures_t<
+            execution_list<typename when_all_value_signature<execution::value_types_of_t<Children, execution_decayed_tuple, execution_single>...>::type>,
+            execution_transform_signatures_t<when_all_transform::template apply, execution::completion_signatures_of_t<Children>>...,
+            execution_exception_signature<true>, execution_list<execution::set_stopped_t()>>;
+
+        template <class Op, class Indices, class... Children>
+        struct when_all_operations;
+
+        template <class Op, std::size_t... Is, class... Children>
+        struct when_all_operations<Op, std::index_sequence<Is...>, Children...>
+        {
+            using type = std::tuple<execution::connect_result_t<Children, execution_receiver<Op, Is>>...>;
+        };
+
+        /**
+         * @brief Starts every child, and completes once the last of them does: with all of their values if each
+         *        succeeded, or else with the first error or stop. The children aren't asked to stop early.
+         */
+        template <class Rcvr, class... Children>
+        struct when_all_operation : execution_immovable
+        {
+            using operation_state_concept = execution::operation_state_t;
+
+            using values_type = std::tuple<std::optional<execution::value_types_of_t<Children, execution_decayed_tuple, execution_single>>...>;
+            using errors_type = typename execution_gather<execution::set_error_t, when_all_signatures_t<Children...>,
+                execution_single, execution_monostate_variant>::type;
+
+            static constexpr std::uint32_t succeeded = 0;
+            static constexpr std::uint32_t failed = 1;
+            static constexpr std::uint32_t stopped = 2;
+
+            template <std::size_t... Is>
+            when_all_operation(std::tuple<Children...>&& inChildren, Rcvr inRcvr, std::index_sequence<Is...>);
+
+            void start() & noexcept;
+
+            template <std::size_t Index, class Tag, class... Args>
+            void complete(Tag tag, Args&&... args) noexcept;
+
+            /**
+             * @brief Records that a child completed, and completes the receiver if it was the last one.
+             */
+            void Arrive() noexcept;
+
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Rcvr rcvr;
+            values_type values;
+            errors_type errors;
+            std::atomic<std::uint32_t> state{succeeded};
+            std::atomic<std::size_t> remaining{sizeof...(Children)};
+            typename when_all_operations<when_all_operation, std::index_sequence_for<Children...>, Children...>::type children;
+        };
+
+        template <class... Children>
+        struct when_all_sender
+        {
+            using sender_concept = execution::sender_t;
+            using completion_signatures = when_all_signatures_t<Children...>;
+
+            template <execution::receiver Rcvr>
+            when_all_operation<std::remove_cvref_t<Rcvr>, Children...> connect(Rcvr&& rcvr) &&;
+
+            std::tuple<Children...> children;
+        };
+
+        //
+        // bulk
+        //
+
+        template <class Shape, class Fn>
+        struct bulk_transform
+        {
+            template <class Sig>
+            struct apply
+            {
+                using type = execution_list<Sig>;
+            };
+
+            template <class... As>
+            struct apply<execution::set_value_t(As...)>
+            {
+                using type = typename execution_concat<execution_list<execution::set_value_t(As...)>,
+                    execution_exception_signature<!std::is_nothrow_invocable_v<Fn&, Shape, std::decay_t<As>&...>>>::type;
+            };
+        };
+
+        /**
+         * @brief Calls the function for each index in turn, on the thread its sender completes on.
+         */
+        template <class Rcvr, class Shape, class Fn>
+        struct bulk_receiver
+        {
+            using receiver_concept = execution::receiver_t;
+
+            template <class... Vs>
+            void set_value(Vs&&... vs) && noexcept;
+
+            template <class E>
+            void set_error(E&& e) && noexcept;
+
+            void set_stopped() && noexcept;
+
+            auto get_env() const noexcept;
+
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Rcvr rcvr;
+            Shape shape;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Fn fn;
+        };
+
+        /**
+         * @brief An intrusive unit of work for a `static_thread_pool`, embedded in the operation state that submits it, so
+         *        that scheduling allocates nothing.
+         */
+        struct thread_pool_task : execution_immovable
+        {
+            using execute_type = void (*)(thread_pool_task* self) noexcept;
+
+            execute_type execute = nullptr;
+            thread_pool_task* next = nullptr;
+        };
+
+        inline constexpr std::size_t bulk_max_tasks = CPPUTILS_STDREIMPL_EXECUTION_BULK_MAX_TASKS;
+
+        /**
+         * @brief Runs a `bulk` whose sender completes on a `static_thread_pool` on that pool's threads: the thread that the
+         *        sender completes on and up to `bulk_max_tasks - 1` tasks of the pool take chunks of indices from a shared
+         *        counter, and whichever finishes last completes the receiver. Nothing waits, so nothing blocks a worker.
+         */
+        template <class Child, class Shape, class Fn, class Rcvr>
+        struct bulk_operation : execution_immovable
+        {
+            using operation_state_concept = execution::operation_state_t;
+
+            using arguments_list = execution::value_types_of_t<Child, execution_decayed_tuple, execution_list>;
+            using arguments_type = execution_apply_t<execution_monostate_variant, arguments_list>;
+
+            struct task : thread_pool_task
+            {
+                bulk_operation* op = nullptr;
+            };
+
+            bulk_operation(Child inChild, Shape inShape, Fn inFn, Rcvr inRcvr);
+
+            void start() & noexcept;
+
+            template <std::size_t Index, class Tag, class... Args>
+            void complete(Tag tag, Args&&... args) noexcept;
+
+            /**
+             * @brief Calls the function for chunks of indices until there are none left, with the values stored at
+             *        `ArgumentsIndex` of `arguments`.
+             */
+            template <std::size_t ArgumentsIndex>
+            void RunChunks() noexcept;
+
+            /**
+             * @brief Completes the receiver if this was the last of the tasks running chunks.
+             */
+            template <std::size_t ArgumentsIndex>
+            void Finish() noexcept;
+
+            template <std::size_t ArgumentsIndex>
+            static void Execute(thread_pool_task* self) noexcept;
+
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Rcvr rcvr;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Fn fn;
+            Shape shape;
+            std::size_t chunk = 1;
+            execution::static_thread_pool* pool;
+            arguments_type arguments;
+            std::exception_ptr error;
+            std::atomic<std::size_t> next{0};
+            std::atomic<std::size_t> pending{0};
+            std::atomic<bool> failed{false};
+            std::array<task, bulk_max_tasks> tasks;
+            execution::connect_result_t<Child, execution_receiver<bulk_operation>> child;
+        };
+
+        template <class Child, class Shape, class Fn>
+        struct bulk_sender
+        {
+            using sender_concept = execution::sender_t;
+            using completion_signatures =
+                execution_transform_signatures_t<bulk_transform<Shape, Fn>::template apply, execution::completion_signatures_of_t<Child>>;
+
+            template <execution::receiver Rcvr>
+            auto connect(Rcvr&& rcvr) &&;
+
+            auto get_env() const noexcept;
+
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Child child;
+            Shape shape;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Fn fn;
+        };
+
+        //
+        // starts_on
+        //
+
+        struct execution_forward_errors
+        {
+            template <class Sig>
+            struct apply
+            {
+                using type = execution_list<Sig>;
+            };
+
+            template <class... As>
+            struct apply<execution::set_value_t(As...)>
+            {
+                using type = execution_list<>;
+            };
+        };
+
+        /**
+         * @brief Schedules onto the scheduler, and connects and starts the sender from there.
+         */
+        template <class Sch, class Sndr, class Rcvr>
+        struct starts_on_operation : execution_immovable
+        {
+            using operation_state_concept = execution::operation_state_t;
+
+            starts_on_operation(Sch inSch, Sndr inSndr, Rcvr inRcvr);
+
+            void start() & noexcept;
+
+            template <std::size_t Index, class Tag, class... Args>
+            void complete(Tag tag, Args&&... args) noexcept;
+
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Sch sch;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Sndr sndr;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Rcvr rcvr;
+            std::optional<execution::connect_result_t<Sndr, Rcvr>> child;
+            execution::connect_result_t<execution::schedule_result_t<Sch&>, execution_receiver<starts_on_operation>> scheduled;
+        };
+
+        template <class Sch, class Sndr>
+        struct starts_on_sender
+        {
+            using sender_concept = execution::sender_t;
+            using completion_signatures = execution_merge_signatures_t<execution::completion_signatures_of_t<Sndr>,
+                execution_transform_signatures_t<execution_forward_errors::template apply, execution::completion_signatures_of_t<execution::schedule_result_t<Sch&>>>,
+                execution_exception_signature<true>>;
+
+            template <execution::receiver Rcvr>
+            starts_on_operation<Sch, Sndr, std::remove_cvref_t<Rcvr>> connect(Rcvr&& rcvr) &&;
+
+            auto get_env() const noexcept;
+
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Sch sch;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Sndr sndr;
+        };
+
+        //
+        // continues_on
+        //
+
+        struct continues_on_transform
+        {
+            template <class Sig>
+            struct apply;
+
+            template <class Tag, class... As>
+            struct apply<Tag(As...)>
+            {
+                using type = execution_list<Tag(std::decay_t<As>...)>;
+            };
+        };
+
+        template <class Sig>
+        struct continues_on_result;
+
+        template <class Tag, class... As>
+        struct continues_on_result<Tag(As...)>
+        {
+            using type = std::tuple<Tag, As...>;
+        };
+
+        template <class Sigs>
+        struct continues_on_results;
+
+        template <class... Sigs>
+        struct continues_on_results<execution::completion_signatures<Sigs...>>
+        {
+            using list = execution_list<typename continues_on_result<Sigs>::type...>;
+            using type = execution_apply_t<execution_monostate_variant, list>;
+        };
+
+        /**
+         * @brief Keeps what the sender completed with, then schedules onto the scheduler and completes the receiver with
+         *        it from there.
+         */
+        template <class Sndr, class Sch, class Rcvr>
+        struct continues_on_operation : execution_immovable
+        {
+            using operation_state_concept = execution::operation_state_t;
+
+            using results_type = typename continues_on_results<
+                execution_transform_signatures_t<continues_on_transform::template apply, execution::completion_signatures_of_t<Sndr>>>::type;
+
+            continues_on_operation(Sndr inSndr, Sch inSch, Rcvr inRcvr);
+
+            void start() & noexcept;
+
+            template <std::size_t Index, class Tag, class... Args>
+            void complete(Tag tag, Args&&... args) noexcept;
+
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Sch sch;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Rcvr rcvr;
+            results_type results;
+            std::optional<execution::connect_result_t<execution::schedule_result_t<Sch&>, execution_receiver<continues_on_operation, 1>>> scheduled;
+            execution::connect_result_t<Sndr, execution_receiver<continues_on_operation, 0>> child;
+        };
+
+        template <class Sch>
+        struct continues_on_env
+        {
+            Sch query(execution::get_completion_scheduler_t<execution::set_value_t>) const noexcept;
+
+            Sch sch;
+        };
+
+        template <class Sndr, class Sch>
+        struct continues_on_sender
+        {
+            using sender_concept = execution::sender_t;
+            using completion_signatures = execution_merge_signatures_t<
+                execution_transform_signatures_t<continues_on_transform::template apply, execution::completion_signatures_of_t<Sndr>>,
+                execution_transform_signatures_t<execution_forward_errors::template apply, execution::completion_signatures_of_t<execution::schedule_result_t<Sch&>>>,
+                execution_exception_signature<true>>;
+
+            template <execution::receiver Rcvr>
+            continues_on_operation<Sndr, Sch, std::remove_cvref_t<Rcvr>> connect(Rcvr&& rcvr) &&;
+
+            continues_on_env<Sch> get_env() const noexcept;
+
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Sndr sndr;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Sch sch;
+        };
+
+        //
+        // static_thread_pool
+        //
+
+        /**
+         * @brief A Chase-Lev work-stealing deque of tasks, in the formulation for the C11 memory model by Lê et al. Its
+         *        worker pushes and pops at the bottom without contention, and other workers steal from the top with a
+         *        compare-and-swap. The ring grows by doubling; rings it outgrew are kept until the deque is destroyed,
+         *        since a thief may still be reading one.
+         */
+        class work_stealing_deque
+        {
+        public:
+            work_stealing_deque();
+
+            work_stealing_deque(const work_stealing_deque&) = delete;
+            work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+
+            /**
+             * @brief Only called by the owner.
+             */
+            void push(thread_pool_task* task);
+
+            /**
+             * @brief Only called by the owner. Returns the task pushed last, or null if there is none.
+             */
+            thread_pool_task* pop() noexcept;
+
+            /**
+             * @brief Returns the task pushed first, or null if there is none or another thread took it first.
+             */
+            thread_pool_task* steal() noexcept;
+
+            bool empty() const noexcept;
+
+        private:
+            struct ring
+            {
+                explicit ring(std::int64_t inCapacity);
+
+                std::atomic<thread_pool_task*>& operator[](std::int64_t index) noexcept;
+
+                std::int64_t capacity;
+                std::unique_ptr<std::atomic<thread_pool_task*>[]> slots;
+            };
+
+            ring* Grow(ring* old, std::int64_t bottomIndex, std::int64_t topIndex);
+
+            alignas(64) std::atomic<std::int64_t> top{0};
+            alignas(64) std::atomic<std::int64_t> bottom{0};
+            std::atomic<ring*> array;
+
+            // Only touched by the owner.
+            std::vector<std::unique_ptr<ring>> rings;
+        };
+
+        template <class Rcvr>
+        struct thread_pool_operation : thread_pool_task
+        {
+            using operation_state_concept = execution::operation_state_t;
+
+            thread_pool_operation(execution::static_thread_pool* inPool, Rcvr inRcvr);
+
+            void start() & noexcept;
+
+            static void Execute(thread_pool_task* self) noexcept;
+
+            execution::static_thread_pool* pool;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Rcvr rcvr;
+        };
+
+        struct thread_pool_env
+        {
+            auto query(execution::get_completion_scheduler_t<execution::set_value_t>) const noexcept;
+
+            execution::static_thread_pool* pool;
+        };
+
+        struct thread_pool_sender
+        {
+            using sender_concept = execution::sender_t;
+            using completion_signatures = execution::completion_signatures<execution::set_value_t()>;
+
+            template <execution::receiver Rcvr>
+            thread_pool_operation<std::remove_cvref_t<Rcvr>> connect(Rcvr&& rcvr) const;
+
+            thread_pool_env get_env() const noexcept;
+
+            execution::static_thread_pool* pool;
+        };
+
+        //
+        // sync_wait
+        //
+
+        template <class Values>
+        struct sync_wait_state
+        {
+            std::optional<Values> result;
+            std::exception_ptr error;
+            std::atomic<std::uint32_t> done{0};
+        };
+
+        template <class Values>
+        struct sync_wait_receiver
+        {
+            using receiver_concept = execution::receiver_t;
+
+            template <class... Vs>
+            void set_value(Vs&&... vs) && noexcept;
+
+            template <class E>
+            void set_error(E&& e) && noexcept;
+
+            void set_stopped() && noexcept;
+
+            void Finish() noexcept;
+
+            sync_wait_state<Values>* state;
+        };
+    }
+
+    namespace execution
+    {
+        /**
+         * @brief A sender that completes right away with copies of the given values.
+         * @see https://eel.is/c++draft/exec.just
+         * @note A feature from the C++26 standard.
+         */
+        struct just_t
+        {
+            template <class... Ts>
+            auto operator()(Ts&&... ts) const;
+        };
+
+        /**
+         * @brief Adapts a sender so that its values are passed to a function, whose result it completes with instead.
+         *        An exception from the function becomes an error. Connecting a chain of `then`s allocates nothing and
+         *        nests no operation states, since each one only wraps the receiver of the one before it.
+         * @see https://eel.is/c++draft/exec.then
+         * @note A feature from the C++26 standard.
+         */
+        struct then_t
+        {
+            template <sender Sndr, class Fn>
+            auto operator()(Sndr&& sndr, Fn&& fn) const;
+
+            template <class Fn>
+            auto operator()(Fn&& fn) const;
+        };
+
+        /**
+         * @brief Adapts a sender so that its values are passed, as lvalues that live until the end, to a function that
+         *        returns another sender, which is started and completes in its place.
+         * @see https://eel.is/c++draft/exec.let
+         * @note A feature from the C++26 standard.
+         */
+        struct let_value_t
+        {
+            template <sender Sndr, class Fn>
+            auto operator()(Sndr&& sndr, Fn&& fn) const;
+
+            template <class Fn>
+            auto operator()(Fn&& fn) const;
+        };
+
+        /**
+         * @brief A sender that starts all of the given senders, each of which must complete with a single set of values,
+         *        and completes with all of those values once the last one completes.
+         * @see https://eel.is/c++draft/exec.when.all
+         * @note A feature from the C++26 standard.
+         */
+        struct when_all_t
+        {
+            template <sender... Sndrs>
+            auto operator()(Sndrs&&... sndrs) const;
+        };
+
+        /**
+         * @brief Adapts a sender so that a function is called with each index in `[0, shape)` and its values, which it
+         *        then completes with. When the sender completes on a `static_thread_pool`, the calls are spread over the
+         *        pool's threads.
+         * @see https://eel.is/c++draft/exec.bulk
+         * @note A feature from the C++26 standard.
+         */
+        struct bulk_t
+        {
+            template <sender Sndr, std::integral Shape, class Fn>
+            auto operator()(Sndr&& sndr, Shape shape, Fn&& fn) const;
+
+            template <std::integral Shape, class Fn>
+            auto operator()(Shape shape, Fn&& fn) const;
+        };
+
+        /**
+         * @brief Adapts a sender so that it's started on the given scheduler's execution resource.
+         * @see https://eel.is/c++draft/exec.starts.on
+         * @note A feature from the C++26 standard.
+         */
+        struct starts_on_t
+        {
+            template <scheduler Sch, sender Sndr>
+            auto operator()(Sch&& sch, Sndr&& sndr) const;
+        };
+
+        /**
+         * @brief Adapts a sender so that it completes on the given scheduler's execution resource.
+         * @see https://eel.is/c++draft/exec.continues.on
+         * @note A feature from the C++26 standard.
+         */
+        struct continues_on_t
+        {
+            template <sender Sndr, scheduler Sch>
+            auto operator()(Sndr&& sndr, Sch&& sch) const;
+
+            template <scheduler Sch>
+            auto operator()(Sch&& sch) const;
+        };
+
+        inline constexpr just_t just{};
+        inline constexpr then_t then{};
+        inline constexpr let_value_t let_value{};
+        inline constexpr when_all_t when_all{};
+        inline constexpr bulk_t bulk{};
+        inline constexpr starts_on_t starts_on{};
+        inline constexpr continues_on_t continues_on{};
+
+        /**
+         * @brief A fixed set of worker threads, each with a Chase-Lev deque of tasks. Work scheduled from a worker goes to
+         *        the bottom of its own deque, where that worker takes it back first, while idle workers steal from the top
+         *        of the others' deques. Work scheduled from other threads goes to a shared queue. Workers with nothing to
+         *        do park on a counter that is only bumped when someone parks, so scheduling costs a fence and a load when
+         *        every worker is busy.
+         *
+         *        Scheduling allocates nothing: the task is part of the operation state. The pool finishes the work it
+         *        was given before its destructor returns.
+         * @see https://wg21.link/p2079
+         * @note Based on a proposal for the C++26 standard.
+         */
+        class static_thread_pool
+        {
+        public:
+            class scheduler
+            {
+            public:
+                using scheduler_concept = scheduler_t;
+
+                [[nodiscard]] Detail::thread_pool_sender schedule() const noexcept;
+
+                bool operator==(const scheduler&) const noexcept = default;
+
+            private:
+                friend class static_thread_pool;
+                friend struct Detail::thread_pool_env;
+
+                template <class, class, class, class>
+                friend struct Detail::bulk_operation;
+
+                explicit scheduler(static_thread_pool* inPool) noexcept;
+
+                static_thread_pool* pool;
+            };
+
+            static_thread_pool();
+            explicit static_thread_pool(std::uint32_t threadCount);
+
+            ~static_thread_pool();
+
+            static_thread_pool(const static_thread_pool&) = delete;
+            static_thread_pool& operator=(const static_thread_pool&) = delete;
+
+            [[nodiscard]] scheduler get_scheduler() noexcept;
+
+            [[nodiscard]] std::uint32_t available_parallelism() const noexcept;
+
+            /**
+             * @brief Runs `task->execute(task)` on one of the workers. What the pool's senders submit their operation
+             *        states through.
+             */
+            void enqueue(Detail::thread_pool_task* task) noexcept;
+
+        private:
+            struct worker;
+
+            void Run(std::uint32_t index) noexcept;
+
+            /**
+             * @brief Takes a task from the worker's own deque, then from the shared queue, then from another worker.
+             */
+            Detail::thread_pool_task* FindTask(std::uint32_t index) noexcept;
+
+            Detail::thread_pool_task* PopShared() noexcept;
+
+            bool HasTasks() const noexcept;
+
+            /**
+             * @brief Wakes a parked worker, if there is one.
+             */
+            void Wake() noexcept;
+
+            /**
+             * @brief Lets the workers finish the work they have, and joins them.
+             */
+            void StopWorkers() noexcept;
+
+            std::vector<std::unique_ptr<worker>> workers;
+
+            std::mutex sharedMutex;
+            Detail::thread_pool_task* sharedHead = nullptr;
+            Detail::thread_pool_task* sharedTail = nullptr;
+            std::atomic<std::size_t> sharedCount{0};
+
+            // Bumped to wake parked workers, and how many are parked or about to.
+            alignas(64) std::atomic<std::uint32_t> epoch{0};
+            std::atomic<std::uint32_t> sleepers{0};
+            std::atomic<bool> stopping{false};
+        };
+    }
+
+    namespace Detail
+    {
+        /**
+         * @brief Whether the sender completes on a `static_thread_pool`, so that a `bulk` after it can run in parallel.
+         */
+        template <class Sndr>
+        concept bulk_parallel = requires(const Sndr& sndr)
+        {
+            { execution::get_completion_scheduler<execution::set_value_t>(execution::get_env(sndr)) } -> std::same_as<execution::static_thread_pool::scheduler>;
+        };
+    }
+
+    namespace Detail
+    {
+        /**
+         * @brief What the parallel policies have in common: the pool that the algorithms run on, which `on` picks.
+         */
+        template <class Policy>
+        class execution_pool_policy
+        {
+        public:
+            /**
+             * @brief A copy of this policy that runs the algorithms on `inPool` instead of the shared pool.
+             * @note Not part of the standard.
+             */
+            [[nodiscard]] constexpr Policy on(execution::static_thread_pool& inPool) const noexcept;
+
+            /**
+             * @brief The pool from `on`, or else a pool shared by the whole program with a thread per core, which is
+             *        started the first time it's needed.
+             * @note Not part of the standard.
+             */
+            [[nodiscard]] execution::static_thread_pool& get_pool() const noexcept;
+
+        private:
+            execution::static_thread_pool* pool = nullptr;
+        };
+    }
+
+    namespace execution
+    {
+        /**
+         * @brief Runs an algorithm's steps in order on the calling thread.
+         * @see https://eel.is/c++draft/execpol.seq
+         * @note A feature from the C++17 standard.
+         */
+        class sequenced_policy
+        {
+        };
+
+        /**
+         * @brief Lets an algorithm split its work among the threads of a `static_thread_pool`, with the calling thread
+         *        taking part. Called from a worker of that same pool, the algorithm runs on the calling thread alone,
+         *        since a worker that waited on its own pool could wait forever. An exception out of an element access
+         *        function calls `std::terminate`.
+         * @see https://eel.is/c++draft/execpol.par
+         * @note A feature from the C++17 standard.
+         */
+        class parallel_policy : public Detail::execution_pool_policy<parallel_policy>
+        {
+        };
+
+        /**
+         * @brief Same as `parallel_policy`. Each chunk of a parallel algorithm is a plain loop that the compiler is free
+         *        to vectorize.
+         * @see https://eel.is/c++draft/execpol.parunseq
+         * @note A feature from the C++17 standard.
+         */
+        class parallel_unsequenced_policy : public Detail::execution_pool_policy<parallel_unsequenced_policy>
+        {
+        };
+
+        /**
+         * @brief Same as `sequenced_policy`.
+         * @see https://eel.is/c++draft/execpol.unseq
+         * @note A feature from the C++20 standard.
+         */
+        class unsequenced_policy
+        {
+        };
+
+        inline constexpr sequenced_policy seq{};
+        inline constexpr parallel_policy par{};
+        inline constexpr parallel_unsequenced_policy par_unseq{};
+        inline constexpr unsequenced_policy unseq{};
+    }
+
+    /**
+     * @see https://eel.is/c++draft/execpol.type
+     * @note A feature from the C++17 standard.
+     */
+    template <class T>
+    struct is_execution_policy : std::false_type
+    {
+    };
+
+    template <>
+    struct is_execution_policy<execution::sequenced_policy> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_execution_policy<execution::parallel_policy> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_execution_policy<execution::parallel_unsequenced_policy> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_execution_policy<execution::unsequenced_policy> : std::true_type
+    {
+    };
+
+    template <class T>
+    inline constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+
+    namespace Detail
+    {
+        template <class Policy>
+        concept execution_parallel_policy = std::same_as<std::remove_cvref_t<Policy>, execution::parallel_policy> ||
+            std::same_as<std::remove_cvref_t<Policy>, execution::parallel_unsequenced_policy>;
+
+        /**
+         * @brief Whether an algorithm runs in parallel with this policy and these iterators. Only random access iterators
+         *        can be split into chunks without walking the range.
+         */
+        template <class Policy, class... Its>
+        concept execution_parallel_iterators = execution_parallel_policy<Policy> && (std::random_access_iterator<Its> && ...);
+
+        template <std::random_access_iterator It>
+        constexpr It execution_next(It first, std::size_t n);
+
+        /**
+         * @brief The most chunks a parallel algorithm splits its range into, so that per-chunk results fit in an array
+         *        on the stack.
+         */
+        inline constexpr std::size_t execution_max_chunks = bulk_max_tasks * 4;
+
+        execution::static_thread_pool& execution_default_pool() noexcept;
+
+        /**
+         * @brief How many chunks of at least `minChunkSize` elements to split `count` elements into on `pool`. A few per
+         *        thread, so that a thread that is held up doesn't hold up the rest, and 1 where running in parallel
+         *        can't help.
+         */
+        std::size_t execution_chunk_count(const execution::static_thread_pool& pool, std::size_t count, std::size_t minChunkSize) noexcept;
+
+        /**
+         * @brief The half-open range of indices of chunk `index`, when `count` elements are split into `chunkCount`
+         *        chunks whose sizes differ by at most 1.
+         */
+        constexpr std::pair<std::size_t, std::size_t> execution_chunk(std::size_t count, std::size_t chunkCount, std::size_t index) noexcept;
+
+        /**
+         * @brief Calls `fn(i)` for every `i` in `[0, count)` and returns once all calls have returned. Up to
+         *        `bulk_max_tasks - 1` tasks of the pool take indices from a shared counter, as does the calling thread,
+         *        and nothing is allocated. The calls are made from a noexcept function, so an exception calls
+         *        `std::terminate`, as the parallel algorithms require.
+         */
+        template <class Fn>
+        void execution_parallel_for(execution::static_thread_pool& pool, std::size_t count, Fn& fn) noexcept;
+    }
+
+    namespace this_thread
+    {
+        /**
+         * @brief Starts a sender, which must complete with a single set of values, and blocks the calling thread until it
+         *        completes. Returns the values, or nothing if it was stopped, and throws its error. The operation state
+         *        lives on the caller's stack, so nothing is allocated.
+         * @see https://eel.is/c++draft/exec.sync.wait
+         * @note A feature from the C++26 standard.
+         */
+        struct sync_wait_t
+        {
+            template <execution::sender Sndr>
+            auto operator()(Sndr&& sndr) const;
+        };
+
+        inline constexpr sync_wait_t sync_wait{};
+    }
+}
+
+#include <CppUtils/StdReimpl/execution.inl>
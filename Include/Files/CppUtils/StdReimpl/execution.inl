@@ -0,0 +1,1312 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/execution.h>
+
+#include <algorithm>
+#include <functional>
+#include <system_error>
+
+namespace StdReimpl
+{
+    namespace execution
+    {
+        template <class Rcvr, class... Vs>
+        void set_value_t::operator()(Rcvr&& rcvr, Vs&&... vs) const noexcept
+        {
+            std::forward<Rcvr>(rcvr).set_value(std::forward<Vs>(vs)...);
+        }
+
+        template <class Rcvr, class E>
+        void set_error_t::operator()(Rcvr&& rcvr, E&& e) const noexcept
+        {
+            std::forward<Rcvr>(rcvr).set_error(std::forward<E>(e));
+        }
+
+        template <class Rcvr>
+        void set_stopped_t::operator()(Rcvr&& rcvr) const noexcept
+        {
+            std::forward<Rcvr>(rcvr).set_stopped();
+        }
+
+        template <class T>
+        auto get_env_t::operator()(const T& t) const noexcept
+        {
+            if constexpr (requires { t.get_env(); })
+            {
+                return t.get_env();
+            }
+            else
+            {
+                return empty_env();
+            }
+        }
+
+        template <class Tag>
+        template <class Env>
+            requires Detail::execution_has_query<Env, get_completion_scheduler_t<Tag>>
+        auto get_completion_scheduler_t<Tag>::operator()(const Env& env) const noexcept
+        {
+            return env.query(*this);
+        }
+
+        template <class Sndr, class Rcvr>
+            requires requires(Sndr&& sndr, Rcvr&& rcvr) { std::forward<Sndr>(sndr).connect(std::forward<Rcvr>(rcvr)); }
+        auto connect_t::operator()(Sndr&& sndr, Rcvr&& rcvr) const
+            noexcept(noexcept(std::forward<Sndr>(sndr).connect(std::forward<Rcvr>(rcvr))))
+        {
+            return std::forward<Sndr>(sndr).connect(std::forward<Rcvr>(rcvr));
+        }
+
+        template <class Op>
+        void start_t::operator()(Op& op) const noexcept
+        {
+            op.start();
+        }
+
+        template <class Sch>
+            requires requires(Sch&& sch) { std::forward<Sch>(sch).schedule(); }
+        auto schedule_t::operator()(Sch&& sch) const noexcept(noexcept(std::forward<Sch>(sch).schedule()))
+        {
+            return std::forward<Sch>(sch).schedule();
+        }
+    }
+
+    namespace Detail
+    {
+        template <class Fn>
+        execution_emplace<Fn>::operator std::invoke_result_t<Fn>() &&
+        {
+            return std::move(fn)();
+        }
+
+        template <class Op, std::size_t Index>
+        template <class... Vs>
+        void execution_receiver<Op, Index>::set_value(Vs&&... vs) && noexcept
+        {
+            op->template complete<Index>(execution::set_value_t(), std::forward<Vs>(vs)...);
+        }
+
+        template <class Op, std::size_t Index>
+        template <class E>
+        void execution_receiver<Op, Index>::set_error(E&& e) && noexcept
+        {
+            op->template complete<Index>(execution::set_error_t(), std::forward<E>(e));
+        }
+
+        template <class Op, std::size_t Index>
+        void execution_receiver<Op, Index>::set_stopped() && noexcept
+        {
+            op->template complete<Index>(execution::set_stopped_t());
+        }
+
+        template <class Op, std::size_t Index>
+        auto execution_receiver<Op, Index>::get_env() const noexcept
+        {
+            return execution::get_env(op->rcvr);
+        }
+
+        template <class Rcvr, class Fn>
+        void execution_try(Rcvr& rcvr, Fn&& fn) noexcept
+        {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            try
+            {
+                std::forward<Fn>(fn)();
+            }
+            catch (...)
+            {
+                execution::set_error(std::move(rcvr), std::current_exception());
+            }
+#else
+            static_cast<void>(rcvr);
+            std::forward<Fn>(fn)();
+#endif
+        }
+
+        //
+        // just
+        //
+
+        template <class Rcvr, class... Ts>
+        just_operation<Rcvr, Ts...>::just_operation(std::tuple<Ts...> inValues, Rcvr inRcvr)
+            : values(std::move(inValues)), rcvr(std::move(inRcvr))
+        {
+        }
+
+        template <class Rcvr, class... Ts>
+        void just_operation<Rcvr, Ts...>::start() & noexcept
+        {
+            std::apply([this](Ts&... vs) { execution::set_value(std::move(rcvr), std::move(vs)...); }, values);
+        }
+
+        template <class... Ts>
+        template <execution::receiver Rcvr>
+        just_operation<std::remove_cvref_t<Rcvr>, Ts...> just_sender<Ts...>::connect(Rcvr&& rcvr) &&
+        {
+            return just_operation<std::remove_cvref_t<Rcvr>, Ts...>(std::move(values), std::forward<Rcvr>(rcvr));
+        }
+
+        template <class... Ts>
+        template <execution::receiver Rcvr>
+        just_operation<std::remove_cvref_t<Rcvr>, Ts...> just_sender<Ts...>::connect(Rcvr&& rcvr) const&
+            requires (std::copy_constructible<Ts> && ...)
+        {
+            return just_operation<std::remove_cvref_t<Rcvr>, Ts...>(values, std::forward<Rcvr>(rcvr));
+        }
+
+        //
+        // then
+        //
+
+        template <class Rcvr, class Fn>
+        template <class... Vs>
+        void then_receiver<Rcvr, Fn>::set_value(Vs&&... vs) && noexcept
+        {
+            Detail::execution_try(rcvr, [&]()
+            {
+                if constexpr (std::is_void_v<std::invoke_result_t<Fn, Vs...>>)
+                {
+                    std::invoke(std::move(fn), std::forward<Vs>(vs)...);
+                    execution::set_value(std::move(rcvr));
+                }
+                else
+                {
+                    execution::set_value(std::move(rcvr), std::invoke(std::move(fn), std::forward<Vs>(vs)...));
+                }
+            });
+        }
+
+        template <class Rcvr, class Fn>
+        template <class E>
+        void then_receiver<Rcvr, Fn>::set_error(E&& e) && noexcept
+        {
+            execution::set_error(std::move(rcvr), std::forward<E>(e));
+        }
+
+        template <class Rcvr, class Fn>
+        void then_receiver<Rcvr, Fn>::set_stopped() && noexcept
+        {
+            execution::set_stopped(std::move(rcvr));
+        }
+
+        template <class Rcvr, class Fn>
+        auto then_receiver<Rcvr, Fn>::get_env() const noexcept
+        {
+            return execution::get_env(rcvr);
+        }
+
+        template <class Child, class Fn>
+        template <execution::receiver Rcvr>
+        auto then_sender<Child, Fn>::connect(Rcvr&& rcvr) &&
+        {
+            return execution::connect(std::move(child), then_receiver<std::remove_cvref_t<Rcvr>, Fn>{std::forward<Rcvr>(rcvr), std::move(fn)});
+        }
+
+        template <class Child, class Fn>
+        template <execution::receiver Rcvr>
+        auto then_sender<Child, Fn>::connect(Rcvr&& rcvr) const&
+            requires std::copy_constructible<Child> && std::copy_constructible<Fn>
+        {
+            return execution::connect(child, then_receiver<std::remove_cvref_t<Rcvr>, Fn>{std::forward<Rcvr>(rcvr), fn});
+        }
+
+        template <class Child, class Fn>
+        auto then_sender<Child, Fn>::get_env() const noexcept
+        {
+            return execution::get_env(child);
+        }
+
+        //
+        // let_value
+        //
+
+        template <class Child, class Fn, class Rcvr>
+        let_value_operation<Child, Fn, Rcvr>::let_value_operation(Child inChild, Fn inFn, Rcvr inRcvr)
+            : fn(std::move(inFn)), rcvr(std::move(inRcvr)),
+              first(execution::connect(std::move(inChild), execution_receiver<let_value_operation>{this}))
+        {
+        }
+
+        template <class Child, class Fn, class Rcvr>
+        void let_value_operation<Child, Fn, Rcvr>::start() & noexcept
+        {
+            execution::start(first);
+        }
+
+        template <class Child, class Fn, class Rcvr>
+        template <std::size_t Index, class Tag, class... Args>
+        void let_value_operation<Child, Fn, Rcvr>::complete(Tag tag, Args&&... args) noexcept
+        {
+            if constexpr (std::is_same_v<Tag, execution::set_value_t>)
+            {
+                // Index 0 of both variants is the empty state.
+                constexpr std::size_t alternative = execution_index_of<execution_decayed_tuple<Args...>, arguments_list>::value + 1;
+
+                Detail::execution_try(rcvr, [&]()
+                {
+                    auto& stored = arguments.template emplace<alternative>(std::forward<Args>(args)...);
+                    auto& op = second.template emplace<alternative>(execution_emplace{[this, &stored]()
+                    {
+                        return execution::connect(std::apply(std::move(fn), stored), std::move(rcvr));
+                    }});
+                    execution::start(op);
+                });
+            }
+            else
+            {
+                tag(std::move(rcvr), std::forward<Args>(args)...);
+            }
+        }
+
+        template <class Child, class Fn>
+        template <execution::receiver Rcvr>
+        let_value_operation<Child, Fn, std::remove_cvref_t<Rcvr>> let_value_sender<Child, Fn>::connect(Rcvr&& rcvr) &&
+        {
+            return let_value_operation<Child, Fn, std::remove_cvref_t<Rcvr>>(std::move(child), std::move(fn), std::forward<Rcvr>(rcvr));
+        }
+
+        //
+        // when_all
+        //
+
+        template <class Rcvr, class... Children>
+        template <std::size_t... Is>
+        when_all_operation<Rcvr, Children...>::when_all_operation(std::tuple<Children...>&& inChildren, Rcvr inRcvr, std::index_sequence<Is...>)
+            : rcvr(std::move(inRcvr)),
+              children(execution_emplace{[this, &inChildren]()
+              {
+                  return execution::connect(std::get<Is>(std::move(inChildren)), execution_receiver<when_all_operation, Is>{this});
+              }}...)
+        {
+        }
+
+        template <class Rcvr, class... Children>
+        void when_all_operation<Rcvr, Children...>::start() & noexcept
+        {
+            if constexpr (sizeof...(Children) == 0)
+            {
+                execution::set_value(std::move(rcvr));
+            }
+            else
+            {
+                std::apply([](auto&... ops) { (execution::start(ops), ...); }, children);
+            }
+        }
+
+        template <class Rcvr, class... Children>
+        template <std::size_t Index, class Tag, class... Args>
+        void when_all_operation<Rcvr, Children...>::complete(Tag, Args&&... args) noexcept
+        {
+            if constexpr (std::is_same_v<Tag, execution::set_value_t>)
+            {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+                try
+                {
+                    std::get<Index>(values).emplace(std::forward<Args>(args)...);
+                }
+                catch (...)
+                {
+                    std::uint32_t expected = succeeded;
+                    if (state.compare_exchange_strong(expected, failed, std::memory_order_relaxed))
+                    {
+                        errors.template emplace<std::exception_ptr>(std::current_exception());
+                    }
+                }
+#else
+                std::get<Index>(values).emplace(std::forward<Args>(args)...);
+#endif
+            }
+            else
+            {
+                std::uint32_t expected = succeeded;
+                if (state.compare_exchange_strong(expected, std::is_same_v<Tag, execution::set_error_t> ? failed : stopped, std::memory_order_relaxed))
+                {
+                    if constexpr (std::is_same_v<Tag, execution::set_error_t>)
+                    {
+                        errors.template emplace<std::decay_t<Args>...>(std::forward<Args>(args)...);
+                    }
+                }
+            }
+
+            Arrive();
+        }
+
+        template <class Rcvr, class... Children>
+        void when_all_operation<Rcvr, Children...>::Arrive() noexcept
+        {
+            // The last child to arrive sees what the others stored.
+            if (remaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                return;
+            }
+
+            switch (state.load(std::memory_order_relaxed))
+            {
+            case succeeded:
+                std::apply([this](auto&... stored)
+                {
+                    std::apply([this](auto&&... vs) { execution::set_value(std::move(rcvr), std::move(vs)...); }, std::tuple_cat(std::move(*stored)...));
+                }, values);
+                break;
+            case failed:
+                std::visit([this](auto& error)
+                {
+                    if constexpr (!std::is_same_v<std::remove_cvref_t<decltype(error)>, std::monostate>)
+                    {
+                        execution::set_error(std::move(rcvr), std::move(error));
+                    }
+                }, errors);
+                break;
+            default:
+                execution::set_stopped(std::move(rcvr));
+                break;
+            }
+        }
+
+        template <class... Children>
+        template <execution::receiver Rcvr>
+        when_all_operation<std::remove_cvref_t<Rcvr>, Children...> when_all_sender<Children...>::connect(Rcvr&& rcvr) &&
+        {
+            return when_all_operation<std::remove_cvref_t<Rcvr>, Children...>(std::move(children), std::forward<Rcvr>(rcvr),
+                std::index_sequence_for<Children...>());
+        }
+
+        //
+        // bulk
+        //
+
+        template <class Rcvr, class Shape, class Fn>
+        template <class... Vs>
+        void bulk_receiver<Rcvr, Shape, Fn>::set_value(Vs&&... vs) && noexcept
+        {
+            Detail::execution_try(rcvr, [&]()
+            {
+                for (Shape i = 0; i < shape; ++i)
+                {
+                    std::invoke(fn, i, vs...);
+                }
+                execution::set_value(std::move(rcvr), std::forward<Vs>(vs)...);
+            });
+        }
+
+        template <class Rcvr, class Shape, class Fn>
+        template <class E>
+        void bulk_receiver<Rcvr, Shape, Fn>::set_error(E&& e) && noexcept
+        {
+            execution::set_error(std::move(rcvr), std::forward<E>(e));
+        }
+
+        template <class Rcvr, class Shape, class Fn>
+        void bulk_receiver<Rcvr, Shape, Fn>::set_stopped() && noexcept
+        {
+            execution::set_stopped(std::move(rcvr));
+        }
+
+        template <class Rcvr, class Shape, class Fn>
+        auto bulk_receiver<Rcvr, Shape, Fn>::get_env() const noexcept
+        {
+            return execution::get_env(rcvr);
+        }
+
+        template <class Child, class Shape, class Fn, class Rcvr>
+        bulk_operation<Child, Shape, Fn, Rcvr>::bulk_operation(Child inChild, Shape inShape, Fn inFn, Rcvr inRcvr)
+            : rcvr(std::move(inRcvr)), fn(std::move(inFn)), shape(inShape),
+              pool(execution::get_completion_scheduler<execution::set_value_t>(execution::get_env(inChild)).pool),
+              child(execution::connect(std::move(inChild), execution_receiver<bulk_operation>{this}))
+        {
+            for (task& t : tasks)
+            {
+                t.op = this;
+            }
+        }
+
+        template <class Child, class Shape, class Fn, class Rcvr>
+        void bulk_operation<Child, Shape, Fn, Rcvr>::start() & noexcept
+        {
+            execution::start(child);
+        }
+
+        template <class Child, class Shape, class Fn, class Rcvr>
+        template <std::size_t Index, class Tag, class... Args>
+        void bulk_operation<Child, Shape, Fn, Rcvr>::complete(Tag tag, Args&&... args) noexcept
+        {
+            if constexpr (!std::is_same_v<Tag, execution::set_value_t>)
+            {
+                tag(std::move(rcvr), std::forward<Args>(args)...);
+            }
+            else
+            {
+                constexpr std::size_t alternative = execution_index_of<execution_decayed_tuple<Args...>, arguments_list>::value + 1;
+
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+                try
+                {
+                    arguments.template emplace<alternative>(std::forward<Args>(args)...);
+                }
+                catch (...)
+                {
+                    execution::set_error(std::move(rcvr), std::current_exception());
+                    return;
+                }
+#else
+                arguments.template emplace<alternative>(std::forward<Args>(args)...);
+#endif
+
+                // A few chunks per task, so that a task that is held up doesn't hold up the rest.
+                const std::size_t count = shape > 0 ? static_cast<std::size_t>(shape) : 0;
+                const std::size_t taskCount = std::min({count, static_cast<std::size_t>(pool->available_parallelism()), bulk_max_tasks});
+                chunk = taskCount > 0 ? std::max<std::size_t>(count / (taskCount * 4), 1) : 1;
+                pending.store(std::max<std::size_t>(taskCount, 1), std::memory_order_relaxed);
+
+                // This thread runs the first task itself.
+                for (std::size_t i = 1; i < taskCount; ++i)
+                {
+                    tasks[i].execute = &Execute<alternative>;
+                    pool->enqueue(&tasks[i]);
+                }
+                RunChunks<alternative>();
+                Finish<alternative>();
+            }
+        }
+
+        template <class Child, class Shape, class Fn, class Rcvr>
+        template <std::size_t ArgumentsIndex>
+        void bulk_operation<Child, Shape, Fn, Rcvr>::RunChunks() noexcept
+        {
+            const std::size_t count = shape > 0 ? static_cast<std::size_t>(shape) : 0;
+            auto& stored = std::get<ArgumentsIndex>(arguments);
+
+            while (true)
+            {
+                const std::size_t begin = next.fetch_add(chunk, std::memory_order_relaxed);
+                if (begin >= count)
+                {
+                    return;
+                }
+                const std::size_t end = std::min(begin + chunk, count);
+
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+                try
+                {
+#endif
+                    std::apply([this, begin, end](auto&... vs)
+                    {
+                        for (std::size_t i = begin; i < end; ++i)
+                        {
+                            std::invoke(fn, static_cast<Shape>(i), vs...);
+                        }
+                    }, stored);
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+                }
+                catch (...)
+                {
+                    if (!failed.exchange(true, std::memory_order_relaxed))
+                    {
+                        error = std::current_exception();
+                    }
+                    // Leaves nothing for the other tasks to run.
+                    next.store(count, std::memory_order_relaxed);
+                    return;
+                }
+#endif
+            }
+        }
+
+        template <class Child, class Shape, class Fn, class Rcvr>
+        template <std::size_t ArgumentsIndex>
+        void bulk_operation<Child, Shape, Fn, Rcvr>::Finish() noexcept
+        {
+            if (pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                return;
+            }
+
+            if (failed.load(std::memory_order_relaxed))
+            {
+                execution::set_error(std::move(rcvr), std::move(error));
+                return;
+            }
+            std::apply([this](auto&... vs) { execution::set_value(std::move(rcvr), std::move(vs)...); }, std::get<ArgumentsIndex>(arguments));
+        }
+
+        template <class Child, class Shape, class Fn, class Rcvr>
+        template <std::size_t ArgumentsIndex>
+        void bulk_operation<Child, Shape, Fn, Rcvr>::Execute(thread_pool_task* self) noexcept
+        {
+            bulk_operation* op = static_cast<task*>(self)->op;
+            op->template RunChunks<ArgumentsIndex>();
+            op->template Finish<ArgumentsIndex>();
+        }
+
+        template <class Child, class Shape, class Fn>
+        template <execution::receiver Rcvr>
+        auto bulk_sender<Child, Shape, Fn>::connect(Rcvr&& rcvr) &&
+        {
+            if constexpr (bulk_parallel<Child>)
+            {
+                return bulk_operation<Child, Shape, Fn, std::remove_cvref_t<Rcvr>>(std::move(child), shape, std::move(fn), std::forward<Rcvr>(rcvr));
+            }
+            else
+            {
+                return execution::connect(std::move(child), bulk_receiver<std::remove_cvref_t<Rcvr>, Shape, Fn>{std::forward<Rcvr>(rcvr), shape, std::move(fn)});
+            }
+        }
+
+        template <class Child, class Shape, class Fn>
+        auto bulk_sender<Child, Shape, Fn>::get_env() const noexcept
+        {
+            return execution::get_env(child);
+        }
+
+        //
+        // starts_on
+        //
+
+        template <class Sch, class Sndr, class Rcvr>
+        starts_on_operation<Sch, Sndr, Rcvr>::starts_on_operation(Sch inSch, Sndr inSndr, Rcvr inRcvr)
+            : sch(std::move(inSch)), sndr(std::move(inSndr)), rcvr(std::move(inRcvr)),
+              scheduled(execution::connect(execution::schedule(sch), execution_receiver<starts_on_operation>{this}))
+        {
+        }
+
+        template <class Sch, class Sndr, class Rcvr>
+        void starts_on_operation<Sch, Sndr, Rcvr>::start() & noexcept
+        {
+            execution::start(scheduled);
+        }
+
+        template <class Sch, class Sndr, class Rcvr>
+        template <std::size_t Index, class Tag, class... Args>
+        void starts_on_operation<Sch, Sndr, Rcvr>::complete(Tag tag, Args&&... args) noexcept
+        {
+            if constexpr (std::is_same_v<Tag, execution::set_value_t>)
+            {
+                Detail::execution_try(rcvr, [this]()
+                {
+                    auto& op = child.emplace(execution_emplace{[this]() { return execution::connect(std::move(sndr), std::move(rcvr)); }});
+                    execution::start(op);
+                });
+            }
+            else
+            {
+                tag(std::move(rcvr), std::forward<Args>(args)...);
+            }
+        }
+
+        template <class Sch, class Sndr>
+        template <execution::receiver Rcvr>
+        starts_on_operation<Sch, Sndr, std::remove_cvref_t<Rcvr>> starts_on_sender<Sch, Sndr>::connect(Rcvr&& rcvr) &&
+        {
+            return starts_on_operation<Sch, Sndr, std::remove_cvref_t<Rcvr>>(std::move(sch), std::move(sndr), std::forward<Rcvr>(rcvr));
+        }
+
+        template <class Sch, class Sndr>
+        auto starts_on_sender<Sch, Sndr>::get_env() const noexcept
+        {
+            return execution::get_env(sndr);
+        }
+
+        //
+        // continues_on
+        //
+
+        template <class Sndr, class Sch, class Rcvr>
+        continues_on_operation<Sndr, Sch, Rcvr>::continues_on_operation(Sndr inSndr, Sch inSch, Rcvr inRcvr)
+            : sch(std::move(inSch)), rcvr(std::move(inRcvr)),
+              child(execution::connect(std::move(inSndr), execution_receiver<continues_on_operation, 0>{this}))
+        {
+        }
+
+        template <class Sndr, class Sch, class Rcvr>
+        void continues_on_operation<Sndr, Sch, Rcvr>::start() & noexcept
+        {
+            execution::start(child);
+        }
+
+        template <class Sndr, class Sch, class Rcvr>
+        template <std::size_t Index, class Tag, class... Args>
+        void continues_on_operation<Sndr, Sch, Rcvr>::complete(Tag tag, Args&&... args) noexcept
+        {
+            if constexpr (Index == 0)
+            {
+                // The sender completed: keep what it completed with, and move over to the scheduler.
+                Detail::execution_try(rcvr, [&]()
+                {
+                    results.template emplace<std::tuple<Tag, std::decay_t<Args>...>>(tag, std::forward<Args>(args)...);
+                    auto& op = scheduled.emplace(execution_emplace{[this]()
+                    {
+                        return execution::connect(execution::schedule(sch), execution_receiver<continues_on_operation, 1>{this});
+                    }});
+                    execution::start(op);
+                });
+            }
+            else if constexpr (std::is_same_v<Tag, execution::set_value_t>)
+            {
+                std::visit([this](auto& result)
+                {
+                    if constexpr (!std::is_same_v<std::remove_cvref_t<decltype(result)>, std::monostate>)
+                    {
+                        std::apply([this](auto completion, auto&... vs) { completion(std::move(rcvr), std::move(vs)...); }, result);
+                    }
+                }, results);
+            }
+            else
+            {
+                tag(std::move(rcvr), std::forward<Args>(args)...);
+            }
+        }
+
+        template <class Sch>
+        Sch continues_on_env<Sch>::query(execution::get_completion_scheduler_t<execution::set_value_t>) const noexcept
+        {
+            return sch;
+        }
+
+        template <class Sndr, class Sch>
+        template <execution::receiver Rcvr>
+        continues_on_operation<Sndr, Sch, std::remove_cvref_t<Rcvr>> continues_on_sender<Sndr, Sch>::connect(Rcvr&& rcvr) &&
+        {
+            return continues_on_operation<Sndr, Sch, std::remove_cvref_t<Rcvr>>(std::move(sndr), std::move(sch), std::forward<Rcvr>(rcvr));
+        }
+
+        template <class Sndr, class Sch>
+        continues_on_env<Sch> continues_on_sender<Sndr, Sch>::get_env() const noexcept
+        {
+            return continues_on_env<Sch>{sch};
+        }
+
+        //
+        // static_thread_pool
+        //
+
+        // The pool whose worker the current thread is, if any, and which of its workers.
+        inline thread_local const execution::static_thread_pool* thread_pool_current = nullptr;
+        inline thread_local std::uint32_t thread_pool_current_index = 0;
+
+        inline work_stealing_deque::ring::ring(std::int64_t inCapacity)
+            : capacity(inCapacity), slots(std::make_unique<std::atomic<thread_pool_task*>[]>(static_cast<std::size_t>(inCapacity)))
+        {
+        }
+
+        inline std::atomic<thread_pool_task*>& work_stealing_deque::ring::operator[](std::int64_t index) noexcept
+        {
+            return slots[static_cast<std::size_t>(index & (capacity - 1))];
+        }
+
+        inline work_stealing_deque::work_stealing_deque()
+        {
+            rings.push_back(std::make_unique<ring>(256));
+            array.store(rings.back().get(), std::memory_order_relaxed);
+        }
+
+        inline void work_stealing_deque::push(thread_pool_task* task)
+        {
+            const std::int64_t b = bottom.load(std::memory_order_relaxed);
+            const std::int64_t t = top.load(std::memory_order_acquire);
+            ring* a = array.load(std::memory_order_relaxed);
+            if (b - t > a->capacity - 1)
+            {
+                a = Grow(a, b, t);
+            }
+
+            (*a)[b].store(task, std::memory_order_relaxed);
+            // Every store to `bottom` releases, so that a thief that reads any of them sees the tasks pushed before it.
+            bottom.store(b + 1, std::memory_order_release);
+        }
+
+        inline thread_pool_task* work_stealing_deque::pop() noexcept
+        {
+            const std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+            ring* a = array.load(std::memory_order_relaxed);
+            bottom.store(b, std::memory_order_release);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                bottom.store(b + 1, std::memory_order_release);
+                return nullptr;
+            }
+
+            thread_pool_task* task = (*a)[b].load(std::memory_order_relaxed);
+            if (t == b)
+            {
+                // The last task: race the thieves for it.
+                if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    task = nullptr;
+                }
+                bottom.store(b + 1, std::memory_order_release);
+            }
+            return task;
+        }
+
+        inline thread_pool_task* work_stealing_deque::steal() noexcept
+        {
+            std::int64_t t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const std::int64_t b = bottom.load(std::memory_order_acquire);
+            if (t >= b)
+            {
+                return nullptr;
+            }
+
+            ring* a = array.load(std::memory_order_acquire);
+            thread_pool_task* task = (*a)[t].load(std::memory_order_relaxed);
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return nullptr;
+            }
+            return task;
+        }
+
+        inline bool work_stealing_deque::empty() const noexcept
+        {
+            return top.load(std::memory_order_seq_cst) >= bottom.load(std::memory_order_seq_cst);
+        }
+
+        inline work_stealing_deque::ring* work_stealing_deque::Grow(ring* old, std::int64_t bottomIndex, std::int64_t topIndex)
+        {
+            std::unique_ptr<ring> grown = std::make_unique<ring>(old->capacity * 2);
+            for (std::int64_t i = topIndex; i < bottomIndex; ++i)
+            {
+                (*grown)[i].store((*old)[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+
+            ring* result = grown.get();
+            rings.push_back(std::move(grown));
+            array.store(result, std::memory_order_release);
+            return result;
+        }
+
+        template <class Rcvr>
+        thread_pool_operation<Rcvr>::thread_pool_operation(execution::static_thread_pool* inPool, Rcvr inRcvr)
+            : pool(inPool), rcvr(std::move(inRcvr))
+        {
+            execute = &Execute;
+        }
+
+        template <class Rcvr>
+        void thread_pool_operation<Rcvr>::start() & noexcept
+        {
+            pool->enqueue(this);
+        }
+
+        template <class Rcvr>
+        void thread_pool_operation<Rcvr>::Execute(thread_pool_task* self) noexcept
+        {
+            execution::set_value(std::move(static_cast<thread_pool_operation*>(self)->rcvr));
+        }
+
+        inline auto thread_pool_env::query(execution::get_completion_scheduler_t<execution::set_value_t>) const noexcept
+        {
+            return execution::static_thread_pool::scheduler(pool);
+        }
+
+        template <execution::receiver Rcvr>
+        thread_pool_operation<std::remove_cvref_t<Rcvr>> thread_pool_sender::connect(Rcvr&& rcvr) const
+        {
+            return thread_pool_operation<std::remove_cvref_t<Rcvr>>(pool, std::forward<Rcvr>(rcvr));
+        }
+
+        inline thread_pool_env thread_pool_sender::get_env() const noexcept
+        {
+            return thread_pool_env{pool};
+        }
+
+        //
+        // sync_wait
+        //
+
+        template <class Values>
+        template <class... Vs>
+        void sync_wait_receiver<Values>::set_value(Vs&&... vs) && noexcept
+        {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            try
+            {
+                state->result.emplace(std::forward<Vs>(vs)...);
+            }
+            catch (...)
+            {
+                state->error = std::current_exception();
+            }
+#else
+            state->result.emplace(std::forward<Vs>(vs)...);
+#endif
+            Finish();
+        }
+
+        template <class Values>
+        template <class E>
+        void sync_wait_receiver<Values>::set_error(E&& e) && noexcept
+        {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            if constexpr (std::is_same_v<std::remove_cvref_t<E>, std::exception_ptr>)
+            {
+                state->error = std::forward<E>(e);
+            }
+            else if constexpr (std::is_same_v<std::remove_cvref_t<E>, std::error_code>)
+            {
+                state->error = std::make_exception_ptr(std::system_error(e));
+            }
+            else
+            {
+                state->error = std::make_exception_ptr(std::forward<E>(e));
+            }
+            Finish();
+#else
+            static_cast<void>(e);
+            std::terminate();
+#endif
+        }
+
+        template <class Values>
+        void sync_wait_receiver<Values>::set_stopped() && noexcept
+        {
+            Finish();
+        }
+
+        template <class Values>
+        void sync_wait_receiver<Values>::Finish() noexcept
+        {
+            // The waiter may return, and destroy the operation state this receiver is part of, as soon as it sees the
+            // store, so only the address is used after it.
+            std::atomic<std::uint32_t>* done = &state->done;
+            done->store(1, std::memory_order_release);
+            Detail::atomic_notify<Detail::atomic_wait_is_native_for_atomic<std::uint32_t>>(done, false);
+        }
+    }
+
+    namespace execution
+    {
+        template <class... Ts>
+        auto just_t::operator()(Ts&&... ts) const
+        {
+            return Detail::just_sender<std::decay_t<Ts>...>{std::tuple<std::decay_t<Ts>...>(std::forward<Ts>(ts)...)};
+        }
+
+        template <sender Sndr, class Fn>
+        auto then_t::operator()(Sndr&& sndr, Fn&& fn) const
+        {
+            return Detail::then_sender<std::remove_cvref_t<Sndr>, std::decay_t<Fn>>{std::forward<Sndr>(sndr), std::forward<Fn>(fn)};
+        }
+
+        template <class Fn>
+        auto then_t::operator()(Fn&& fn) const
+        {
+            return Detail::execution_closure<then_t, std::decay_t<Fn>>{std::tuple<std::decay_t<Fn>>(std::forward<Fn>(fn))};
+        }
+
+        template <sender Sndr, class Fn>
+        auto let_value_t::operator()(Sndr&& sndr, Fn&& fn) const
+        {
+            return Detail::let_value_sender<std::remove_cvref_t<Sndr>, std::decay_t<Fn>>{std::forward<Sndr>(sndr), std::forward<Fn>(fn)};
+        }
+
+        template <class Fn>
+        auto let_value_t::operator()(Fn&& fn) const
+        {
+            return Detail::execution_closure<let_value_t, std::decay_t<Fn>>{std::tuple<std::decay_t<Fn>>(std::forward<Fn>(fn))};
+        }
+
+        template <sender... Sndrs>
+        auto when_all_t::operator()(Sndrs&&... sndrs) const
+        {
+            return Detail::when_all_sender<std::remove_cvref_t<Sndrs>...>{std::tuple<std::remove_cvref_t<Sndrs>...>(std::forward<Sndrs>(sndrs)...)};
+        }
+
+        template <sender Sndr, std::integral Shape, class Fn>
+        auto bulk_t::operator()(Sndr&& sndr, Shape shape, Fn&& fn) const
+        {
+            return Detail::bulk_sender<std::remove_cvref_t<Sndr>, Shape, std::decay_t<Fn>>{std::forward<Sndr>(sndr), shape, std::forward<Fn>(fn)};
+        }
+
+        template <std::integral Shape, class Fn>
+        auto bulk_t::operator()(Shape shape, Fn&& fn) const
+        {
+            return Detail::execution_closure<bulk_t, Shape, std::decay_t<Fn>>{std::tuple<Shape, std::decay_t<Fn>>(shape, std::forward<Fn>(fn))};
+        }
+
+        template <scheduler Sch, sender Sndr>
+        auto starts_on_t::operator()(Sch&& sch, Sndr&& sndr) const
+        {
+            return Detail::starts_on_sender<std::remove_cvref_t<Sch>, std::remove_cvref_t<Sndr>>{std::forward<Sch>(sch), std::forward<Sndr>(sndr)};
+        }
+
+        template <sender Sndr, scheduler Sch>
+        auto continues_on_t::operator()(Sndr&& sndr, Sch&& sch) const
+        {
+            return Detail::continues_on_sender<std::remove_cvref_t<Sndr>, std::remove_cvref_t<Sch>>{std::forward<Sndr>(sndr), std::forward<Sch>(sch)};
+        }
+
+        template <scheduler Sch>
+        auto continues_on_t::operator()(Sch&& sch) const
+        {
+            return Detail::execution_closure<continues_on_t, std::remove_cvref_t<Sch>>{std::tuple<std::remove_cvref_t<Sch>>(std::forward<Sch>(sch))};
+        }
+
+        struct static_thread_pool::worker
+        {
+            Detail::work_stealing_deque deque;
+            std::uint64_t seed = 0;
+            std::thread thread;
+        };
+
+        inline static_thread_pool::scheduler::scheduler(static_thread_pool* inPool) noexcept
+            : pool(inPool)
+        {
+        }
+
+        inline Detail::thread_pool_sender static_thread_pool::scheduler::schedule() const noexcept
+        {
+            return Detail::thread_pool_sender{pool};
+        }
+
+        inline static_thread_pool::static_thread_pool()
+            : static_thread_pool(std::max(std::thread::hardware_concurrency(), 1u))
+        {
+        }
+
+        inline static_thread_pool::static_thread_pool(std::uint32_t threadCount)
+        {
+            const std::uint32_t count = std::max<std::uint32_t>(threadCount, 1);
+            workers.reserve(count);
+            for (std::uint32_t i = 0; i < count; ++i)
+            {
+                workers.push_back(std::make_unique<worker>());
+                workers.back()->seed = 0x9E3779B97F4A7C15ull * (i + 1);
+            }
+
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            try
+            {
+#endif
+                for (std::uint32_t i = 0; i < count; ++i)
+                {
+                    workers[i]->thread = std::thread([this, i]() { Run(i); });
+                }
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            }
+            catch (...)
+            {
+                // The destructor won't run, so stop the workers that did start.
+                StopWorkers();
+                throw;
+            }
+#endif
+        }
+
+        inline static_thread_pool::~static_thread_pool()
+        {
+            StopWorkers();
+        }
+
+        inline void static_thread_pool::StopWorkers() noexcept
+        {
+            stopping.store(true, std::memory_order_seq_cst);
+            epoch.fetch_add(1, std::memory_order_release);
+            Detail::atomic_notify<Detail::atomic_wait_is_native_for_atomic<std::uint32_t>>(&epoch, true);
+
+            for (const std::unique_ptr<worker>& w : workers)
+            {
+                if (w->thread.joinable())
+                {
+                    w->thread.join();
+                }
+            }
+        }
+
+        inline static_thread_pool::scheduler static_thread_pool::get_scheduler() noexcept
+        {
+            return scheduler(this);
+        }
+
+        inline std::uint32_t static_thread_pool::available_parallelism() const noexcept
+        {
+            return static_cast<std::uint32_t>(workers.size());
+        }
+
+        inline void static_thread_pool::enqueue(Detail::thread_pool_task* task) noexcept
+        {
+            if (Detail::thread_pool_current == this)
+            {
+                workers[Detail::thread_pool_current_index]->deque.push(task);
+            }
+            else
+            {
+                const std::lock_guard<std::mutex> lock(sharedMutex);
+                task->next = nullptr;
+                if (sharedTail != nullptr)
+                {
+                    sharedTail->next = task;
+                }
+                else
+                {
+                    sharedHead = task;
+                }
+                sharedTail = task;
+                sharedCount.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            Wake();
+        }
+
+        inline void static_thread_pool::Run(std::uint32_t index) noexcept
+        {
+            Detail::thread_pool_current = this;
+            Detail::thread_pool_current_index = index;
+
+            while (true)
+            {
+                if (Detail::thread_pool_task* task = FindTask(index))
+                {
+                    task->execute(task);
+                    continue;
+                }
+
+                // Announce that this worker is about to park before checking for work one last time, so that whoever
+                // adds work after that check sees it and bumps the epoch.
+                const std::uint32_t current = epoch.load(std::memory_order_acquire);
+                sleepers.fetch_add(1, std::memory_order_seq_cst);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (HasTasks())
+                {
+                    sleepers.fetch_sub(1, std::memory_order_relaxed);
+                    continue;
+                }
+                if (stopping.load(std::memory_order_relaxed))
+                {
+                    sleepers.fetch_sub(1, std::memory_order_relaxed);
+                    return;
+                }
+
+                Detail::atomic_wait<Detail::atomic_wait_is_native_for_atomic<std::uint32_t>>(&epoch, current,
+                    [this]() { return epoch.load(std::memory_order_acquire); });
+                sleepers.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        inline Detail::thread_pool_task* static_thread_pool::FindTask(std::uint32_t index) noexcept
+        {
+            worker& self = *workers[index];
+            if (Detail::thread_pool_task* task = self.deque.pop())
+            {
+                return task;
+            }
+
+            if (sharedCount.load(std::memory_order_relaxed) > 0)
+            {
+                if (Detail::thread_pool_task* task = PopShared())
+                {
+                    return task;
+                }
+            }
+
+            // Try every other worker once, starting from a random one so that thieves spread out.
+            const std::uint32_t count = static_cast<std::uint32_t>(workers.size());
+            self.seed ^= self.seed << 13;
+            self.seed ^= self.seed >> 7;
+            self.seed ^= self.seed << 17;
+            const std::uint32_t first = static_cast<std::uint32_t>(self.seed % count);
+            for (std::uint32_t i = 0; i < count; ++i)
+            {
+                const std::uint32_t victim = (first + i) % count;
+                if (victim == index)
+                {
+                    continue;
+                }
+                if (Detail::thread_pool_task* task = workers[victim]->deque.steal())
+                {
+                    return task;
+                }
+            }
+            return nullptr;
+        }
+
+        inline Detail::thread_pool_task* static_thread_pool::PopShared() noexcept
+        {
+            const std::lock_guard<std::mutex> lock(sharedMutex);
+            Detail::thread_pool_task* task = sharedHead;
+            if (task != nullptr)
+            {
+                sharedHead = task->next;
+                if (sharedHead == nullptr)
+                {
+                    sharedTail = nullptr;
+                }
+                sharedCount.fetch_sub(1, std::memory_order_relaxed);
+            }
+            return task;
+        }
+
+        inline bool static_thread_pool::HasTasks() const noexcept
+        {
+            if (sharedCount.load(std::memory_order_seq_cst) > 0)
+            {
+                return true;
+            }
+            return std::any_of(workers.begin(), workers.end(), [](const std::unique_ptr<worker>& w) { return !w->deque.empty(); });
+        }
+
+        inline void static_thread_pool::Wake() noexcept
+        {
+            // Pairs with the fence a worker issues after announcing that it's about to park.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (sleepers.load(std::memory_order_relaxed) == 0)
+            {
+                return;
+            }
+
+            epoch.fetch_add(1, std::memory_order_release);
+            Detail::atomic_notify<Detail::atomic_wait_is_native_for_atomic<std::uint32_t>>(&epoch, false);
+        }
+    }
+
+    namespace Detail
+    {
+        template <class Policy>
+        constexpr Policy execution_pool_policy<Policy>::on(execution::static_thread_pool& inPool) const noexcept
+        {
+            Policy result;
+            static_cast<execution_pool_policy&>(result).pool = &inPool;
+            return result;
+        }
+
+        template <class Policy>
+        execution::static_thread_pool& execution_pool_policy<Policy>::get_pool() const noexcept
+        {
+            return pool != nullptr ? *pool : Detail::execution_default_pool();
+        }
+
+        template <std::random_access_iterator It>
+        constexpr It execution_next(It first, std::size_t n)
+        {
+            return first + static_cast<std::iter_difference_t<It>>(n);
+        }
+
+        inline execution::static_thread_pool& execution_default_pool() noexcept
+        {
+            static execution::static_thread_pool pool;
+            return pool;
+        }
+
+        inline std::size_t execution_chunk_count(const execution::static_thread_pool& pool, std::size_t count, std::size_t minChunkSize) noexcept
+        {
+            const std::size_t threadCount = pool.available_parallelism();
+            if (threadCount <= 1 || thread_pool_current == &pool)
+            {
+                return 1;
+            }
+            return std::max<std::size_t>(std::min({count / std::max<std::size_t>(minChunkSize, 1), threadCount * 4, execution_max_chunks}), 1);
+        }
+
+        constexpr std::pair<std::size_t, std::size_t> execution_chunk(std::size_t count, std::size_t chunkCount, std::size_t index) noexcept
+        {
+            // The first `count % chunkCount` chunks get one element more than the rest.
+            const std::size_t size = count / chunkCount;
+            const std::size_t remainder = count % chunkCount;
+            const std::size_t begin = index * size + std::min(index, remainder);
+            return {begin, begin + size + (index < remainder ? 1 : 0)};
+        }
+
+        /**
+         * @brief The state of one `execution_parallel_for`, which lives on the calling thread's stack until every task
+         *        that was handed to the pool has run.
+         */
+        template <class Fn>
+        struct execution_parallel_for_state
+        {
+            struct task : thread_pool_task
+            {
+                execution_parallel_for_state* state = nullptr;
+            };
+
+            execution_parallel_for_state(Fn& inFn, std::size_t inCount, std::size_t taskCount)
+                : fn(inFn),
+                  count(inCount),
+                  done(static_cast<std::ptrdiff_t>(taskCount))
+            {
+            }
+
+            void Run() noexcept
+            {
+                while (true)
+                {
+                    const std::size_t i = next.fetch_add(1, std::memory_order_relaxed);
+                    if (i >= count)
+                    {
+                        return;
+                    }
+                    fn(i);
+                }
+            }
+
+            static void Execute(thread_pool_task* self) noexcept
+            {
+                execution_parallel_for_state* state = static_cast<task*>(self)->state;
+                state->Run();
+                state->done.count_down();
+            }
+
+            Fn& fn;
+            std::size_t count;
+            std::atomic<std::size_t> next{0};
+            StdReimpl::latch done;
+            std::array<task, bulk_max_tasks> tasks;
+        };
+
+        template <class Fn>
+        void execution_parallel_for(execution::static_thread_pool& pool, std::size_t count, Fn& fn) noexcept
+        {
+            // A worker of the pool can't wait on it, and one index needs no help.
+            const std::size_t taskCount = std::min({count, static_cast<std::size_t>(pool.available_parallelism()), bulk_max_tasks});
+            if (taskCount <= 1 || thread_pool_current == &pool)
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    fn(i);
+                }
+                return;
+            }
+
+            // This thread is the first task.
+            execution_parallel_for_state<Fn> state(fn, count, taskCount - 1);
+            for (std::size_t i = 1; i < taskCount; ++i)
+            {
+                state.tasks[i].state = &state;
+                state.tasks[i].execute = &execution_parallel_for_state<Fn>::Execute;
+                pool.enqueue(&state.tasks[i]);
+            }
+            state.Run();
+            state.done.wait();
+        }
+    }
+
+    namespace this_thread
+    {
+        template <execution::sender Sndr>
+        auto sync_wait_t::operator()(Sndr&& sndr) const
+        {
+            using values_type = execution::value_types_of_t<Sndr, Detail::execution_decayed_tuple, Detail::execution_single>;
+
+            Detail::sync_wait_state<values_type> state;
+            auto op = execution::connect(std::forward<Sndr>(sndr), Detail::sync_wait_receiver<values_type>{&state});
+            execution::start(op);
+
+            Detail::atomic_wait<Detail::atomic_wait_is_native_for_atomic<std::uint32_t>>(&state.done, std::uint32_t{0},
+                [&state]() { return state.done.load(std::memory_order_acquire); });
+
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            if (state.error)
+            {
+                std::rethrow_exception(state.error);
+            }
+#endif
+            return std::move(state.result);
+        }
+    }
+}
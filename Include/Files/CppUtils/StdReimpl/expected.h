@@ -0,0 +1,920 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/concepts.h>
+
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace StdReimpl
+{
+    template <class E>
+    class unexpected;
+
+    template <class T, class E>
+    class expected;
+
+    /**
+     * @see https://eel.is/c++draft/expected.bad.void
+     * @note A feature from the C++23 standard.
+     */
+    template <class E>
+    class bad_expected_access;
+
+    template <>
+    class bad_expected_access<void> : public std::exception
+    {
+    protected:
+        bad_expected_access() noexcept = default;
+        bad_expected_access(const bad_expected_access&) noexcept = default;
+        bad_expected_access(bad_expected_access&&) noexcept = default;
+        bad_expected_access& operator=(const bad_expected_access&) noexcept = default;
+        bad_expected_access& operator=(bad_expected_access&&) noexcept = default;
+        ~bad_expected_access() override = default;
+
+    public:
+        const char* what() const noexcept override;
+    };
+
+    /**
+     * @brief Thrown by `expected::value` when there's an error instead, carrying a copy of the error.
+     * @see https://eel.is/c++draft/expected.bad
+     * @note A feature from the C++23 standard.
+     */
+    template <class E>
+    class bad_expected_access : public bad_expected_access<void>
+    {
+    public:
+        explicit bad_expected_access(E e);
+
+        const char* what() const noexcept override;
+
+        E& error() & noexcept;
+        const E& error() const& noexcept;
+        E&& error() && noexcept;
+        const E&& error() const&& noexcept;
+
+    private:
+        E unex;
+    };
+
+    /**
+     * @see https://eel.is/c++draft/expected.syn
+     * @note A feature from the C++23 standard.
+     */
+    struct unexpect_t
+    {
+        explicit unexpect_t() = default;
+    };
+
+    inline constexpr unexpect_t unexpect{};
+
+    /**
+     * @brief Wraps an error, to construct or assign an `expected` as holding that error.
+     * @see https://eel.is/c++draft/expected.unexpected
+     * @see https://cppreference.com/w/cpp/utility/expected/unexpected
+     * @note A feature from the C++23 standard.
+     */
+    template <class E>
+    class unexpected
+    {
+        static_assert(std::is_object_v<E> && !std::is_array_v<E> && !std::is_const_v<E> && !std::is_volatile_v<E>,
+            "unexpected's error type must be a non-array, non-cv object type.");
+
+    public:
+        constexpr unexpected(const unexpected&) = default;
+        constexpr unexpected(unexpected&&) = default;
+
+        template <class Err = E>
+            requires (!std::is_same_v<std::remove_cvref_t<Err>, unexpected> &&
+                !std::is_same_v<std::remove_cvref_t<Err>, std::in_place_t> &&
+                std::is_constructible_v<E, Err>)
+        constexpr explicit unexpected(Err&& e);
+
+        template <class... Args>
+            requires std::is_constructible_v<E, Args...>
+        constexpr explicit unexpected(std::in_place_t, Args&&... args);
+
+        template <class U, class... Args>
+            requires std::is_constructible_v<E, std::initializer_list<U>&, Args...>
+        constexpr explicit unexpected(std::in_place_t, std::initializer_list<U> il, Args&&... args);
+
+        constexpr unexpected& operator=(const unexpected&) = default;
+        constexpr unexpected& operator=(unexpected&&) = default;
+
+        constexpr const E& error() const& noexcept;
+        constexpr E& error() & noexcept;
+        constexpr const E&& error() const&& noexcept;
+        constexpr E&& error() && noexcept;
+
+        constexpr void swap(unexpected& other) noexcept(std::is_nothrow_swappable_v<E>);
+
+        template <class E2>
+        friend constexpr bool operator==(const unexpected& x, const unexpected<E2>& y)
+        {
+            return x.error() == y.error();
+        }
+
+        friend constexpr void swap(unexpected& x, unexpected& y) noexcept(noexcept(x.swap(y)))
+            requires std::is_swappable_v<E>
+        {
+            x.swap(y);
+        }
+
+    private:
+        E unex;
+    };
+
+    template <class E>
+    unexpected(E) -> unexpected<E>;
+
+    /**
+     * @brief Specialize this to name a value of `E` that's never used as an error, e.g., an error code enum's `None` or
+     *        `Success`, by giving it a `static constexpr E value` member. `expected<void, E>` then stores that value to
+     *        mean "no error", so it's only as big as an `E`. `E` must be trivially copyable and equality comparable.
+     *
+     *            template <>
+     *            struct StdReimpl::expected_niche<ErrorCode>
+     *            {
+     *                static constexpr ErrorCode value = ErrorCode::None;
+     *            };
+     * @note Not part of the standard. Constructing an `expected<void, E>` with the niche value as its error is a
+     *       precondition violation.
+     */
+    template <class E>
+    struct expected_niche
+    {
+    };
+
+    namespace Detail
+    {
+        template <class T>
+        inline constexpr bool is_unexpected_v = false;
+
+        template <class E>
+        inline constexpr bool is_unexpected_v<StdReimpl::unexpected<E>> = true;
+
+        template <class T>
+        inline constexpr bool is_expected_v = false;
+
+        template <class T, class E>
+        inline constexpr bool is_expected_v<StdReimpl::expected<T, E>> = true;
+
+        /**
+         * @brief Whether `E` has an `expected_niche`, and can use it.
+         */
+        template <class E>
+        concept expected_has_niche =
+            std::is_trivially_copyable_v<E> &&
+            requires (const E& e)
+            {
+                requires std::is_convertible_v<decltype(StdReimpl::expected_niche<E>::value), E>;
+                { e == e } -> StdReimpl::same_as<bool>;
+            };
+
+        /**
+         * @see https://eel.is/c++draft/expected.object.cons
+         */
+        template <class T, class W>
+        inline constexpr bool converts_from_any_cvref_v =
+            std::is_constructible_v<T, W&> || std::is_convertible_v<W&, T> ||
+            std::is_constructible_v<T, W> || std::is_convertible_v<W, T> ||
+            std::is_constructible_v<T, const W&> || std::is_convertible_v<const W&, T> ||
+            std::is_constructible_v<T, const W> || std::is_convertible_v<const W, T>;
+
+        /**
+         * @brief Whether `unexpected<E>` can be constructed from some cvref-qualified `W`, which rules out constructing
+         *        an `expected` from another `expected` that could also be taken as its error.
+         */
+        template <class E, class W>
+        inline constexpr bool unexpected_constructible_from_any_cvref_v =
+            std::is_constructible_v<StdReimpl::unexpected<E>, W&> ||
+            std::is_constructible_v<StdReimpl::unexpected<E>, W> ||
+            std::is_constructible_v<StdReimpl::unexpected<E>, const W&> ||
+            std::is_constructible_v<StdReimpl::unexpected<E>, const W>;
+
+        /**
+         * @brief The constraints of converting from `expected<U, G>`, where `UF` and `GF` are how its value and error are
+         *        forwarded.
+         */
+        template <class T, class E, class U, class G, class UF, class GF>
+        inline constexpr bool expected_can_convert_v =
+            std::is_constructible_v<T, UF> && std::is_constructible_v<E, GF> &&
+            (std::is_same_v<std::remove_cv_t<T>, bool> || !converts_from_any_cvref_v<T, StdReimpl::expected<U, G>>) &&
+            !unexpected_constructible_from_any_cvref_v<E, StdReimpl::expected<U, G>>;
+
+        template <class E, class U, class G, class GF>
+        inline constexpr bool expected_void_can_convert_v =
+            std::is_void_v<U> && std::is_constructible_v<E, GF> &&
+            !unexpected_constructible_from_any_cvref_v<E, StdReimpl::expected<U, G>>;
+
+        /**
+         * @brief The constraints of constructing from a value.
+         */
+        template <class T, class E, class U>
+        inline constexpr bool expected_can_construct_from_value_v =
+            !std::is_same_v<std::remove_cvref_t<U>, std::in_place_t> &&
+            !std::is_same_v<std::remove_cvref_t<U>, StdReimpl::unexpect_t> &&
+            !std::is_same_v<StdReimpl::expected<T, E>, std::remove_cvref_t<U>> &&
+            !is_unexpected_v<std::remove_cvref_t<U>> &&
+            std::is_constructible_v<T, U> &&
+            (!std::is_same_v<std::remove_cv_t<T>, bool> || !is_expected_v<std::remove_cvref_t<U>>);
+
+        /**
+         * @brief The constraints of assigning a value, or an error.
+         */
+        template <class T, class E, class U>
+        inline constexpr bool expected_can_assign_value_v =
+            !std::is_same_v<StdReimpl::expected<T, E>, std::remove_cvref_t<U>> &&
+            !is_unexpected_v<std::remove_cvref_t<U>> &&
+            std::is_constructible_v<T, U> && std::is_assignable_v<T&, U> &&
+            (std::is_nothrow_constructible_v<T, U> || std::is_nothrow_move_constructible_v<T> || std::is_nothrow_move_constructible_v<E>);
+
+        template <class T, class E, class GF>
+        inline constexpr bool expected_can_assign_error_v =
+            std::is_constructible_v<E, GF> && std::is_assignable_v<E&, GF> &&
+            (std::is_nothrow_constructible_v<E, GF> || std::is_nothrow_move_constructible_v<T> || std::is_nothrow_move_constructible_v<E>);
+
+        /**
+         * @brief Whether the copy and move operations of an `expected` holding `Ts` exist, and whether they're trivial.
+         *        These are concepts so that each trivial one subsumes the other, which picks the defaulted special member
+         *        over the user-provided one. With a single type, that's `expected<void, E>`, whose assignments never
+         *        have to put a value back, so they don't need either type to be nothrow move constructible.
+         */
+        template <class... Ts>
+        concept expected_copy_constructible = (std::is_copy_constructible_v<Ts> && ...);
+
+        template <class... Ts>
+        concept expected_trivially_copy_constructible =
+            expected_copy_constructible<Ts...> && (std::is_trivially_copy_constructible_v<Ts> && ...);
+
+        template <class... Ts>
+        concept expected_move_constructible = (std::is_move_constructible_v<Ts> && ...);
+
+        template <class... Ts>
+        concept expected_trivially_move_constructible =
+            expected_move_constructible<Ts...> && (std::is_trivially_move_constructible_v<Ts> && ...);
+
+        template <class... Ts>
+        concept expected_copy_assignable =
+            ((std::is_copy_assignable_v<Ts> && std::is_copy_constructible_v<Ts>) && ...) &&
+            (sizeof...(Ts) == 1 || (std::is_nothrow_move_constructible_v<Ts> || ...));
+
+        template <class... Ts>
+        concept expected_trivially_copy_assignable =
+            expected_copy_assignable<Ts...> &&
+            ((std::is_trivially_copy_constructible_v<Ts> && std::is_trivially_copy_assignable_v<Ts> && std::is_trivially_destructible_v<Ts>) && ...);
+
+        template <class... Ts>
+        concept expected_move_assignable =
+            ((std::is_move_assignable_v<Ts> && std::is_move_constructible_v<Ts>) && ...) &&
+            (sizeof...(Ts) == 1 || (std::is_nothrow_move_constructible_v<Ts> || ...));
+
+        template <class... Ts>
+        concept expected_trivially_move_assignable =
+            expected_move_assignable<Ts...> &&
+            ((std::is_trivially_move_constructible_v<Ts> && std::is_trivially_move_assignable_v<Ts> && std::is_trivially_destructible_v<Ts>) && ...);
+
+        /**
+         * @brief Tags the private constructors that initialize the value or error directly from the result of invoking a
+         *        function, which is how `transform` and `transform_error` avoid a move.
+         */
+        struct expected_invoke_value_t
+        {
+            explicit expected_invoke_value_t() = default;
+        };
+
+        struct expected_invoke_error_t
+        {
+            explicit expected_invoke_error_t() = default;
+        };
+
+        /**
+         * @brief The storage of `expected<T, E>`. It's a named union rather than an anonymous one so that it can be
+         *        `[[no_unique_address]]`, which lets the `has_value` flag after it go in its tail padding.
+         */
+        template <class T, class E>
+        union expected_union
+        {
+            constexpr expected_union() noexcept {}
+
+            template <class... Args>
+            constexpr explicit expected_union(std::in_place_t, Args&&... args)
+                : val(std::forward<Args>(args)...)
+            {
+            }
+
+            template <class... Args>
+            constexpr explicit expected_union(StdReimpl::unexpect_t, Args&&... args)
+                : unex(std::forward<Args>(args)...)
+            {
+            }
+
+            template <class F, class... Args>
+            constexpr explicit expected_union(expected_invoke_value_t, F&& f, Args&&... args)
+                : val(std::invoke(std::forward<F>(f), std::forward<Args>(args)...))
+            {
+            }
+
+            template <class F, class... Args>
+            constexpr explicit expected_union(expected_invoke_error_t, F&& f, Args&&... args)
+                : unex(std::invoke(std::forward<F>(f), std::forward<Args>(args)...))
+            {
+            }
+
+            constexpr expected_union(const expected_union&) = default;
+            constexpr expected_union(expected_union&&) = default;
+            constexpr expected_union& operator=(const expected_union&) = default;
+            constexpr expected_union& operator=(expected_union&&) = default;
+
+            constexpr ~expected_union()
+                requires (std::is_trivially_destructible_v<T> && std::is_trivially_destructible_v<E>) = default;
+            constexpr ~expected_union() {}
+
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS T val;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS E unex;
+        };
+
+        /**
+         * @brief The storage of `expected<void, E>`: the error, and whether there is one. When `E` has an
+         *        `expected_niche`, the error is always there and the niche value means there isn't one.
+         */
+        struct expected_no_value
+        {
+        };
+
+        template <class E, bool Niche = expected_has_niche<E>>
+        class expected_void_storage
+        {
+        public:
+            constexpr expected_void_storage() noexcept
+                : has_val(true)
+            {
+            }
+
+            template <class... Args>
+            constexpr explicit expected_void_storage(StdReimpl::unexpect_t, Args&&... args)
+                : u(StdReimpl::unexpect, std::forward<Args>(args)...), has_val(false)
+            {
+            }
+
+            template <class F, class... Args>
+            constexpr explicit expected_void_storage(expected_invoke_error_t, F&& f, Args&&... args)
+                : u(expected_invoke_error_t(), std::forward<F>(f), std::forward<Args>(args)...), has_val(false)
+            {
+            }
+
+            constexpr expected_void_storage(const expected_void_storage&)
+                requires expected_trivially_copy_constructible<E> = default;
+            constexpr expected_void_storage(const expected_void_storage& other)
+                requires expected_copy_constructible<E>;
+
+            constexpr expected_void_storage(expected_void_storage&&)
+                requires expected_trivially_move_constructible<E> = default;
+            constexpr expected_void_storage(expected_void_storage&& other) noexcept(std::is_nothrow_move_constructible_v<E>)
+                requires expected_move_constructible<E>;
+
+            constexpr expected_void_storage& operator=(const expected_void_storage&) = default;
+            constexpr expected_void_storage& operator=(expected_void_storage&&) = default;
+
+            constexpr ~expected_void_storage()
+                requires std::is_trivially_destructible_v<E> = default;
+            constexpr ~expected_void_storage();
+
+            constexpr bool HasValue() const noexcept;
+            constexpr E& Error() noexcept;
+            constexpr const E& Error() const noexcept;
+
+            /**
+             * @brief Constructs the error. There must not be one.
+             */
+            template <class... Args>
+            constexpr void ConstructError(Args&&... args);
+
+            /**
+             * @brief Destroys the error. There must be one.
+             */
+            constexpr void DestroyError() noexcept;
+
+        private:
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS expected_union<expected_no_value, E> u;
+            bool has_val;
+        };
+
+        template <class E>
+        class expected_void_storage<E, true>
+        {
+        public:
+            constexpr expected_void_storage() noexcept;
+
+            template <class... Args>
+            constexpr explicit expected_void_storage(StdReimpl::unexpect_t, Args&&... args);
+
+            template <class F, class... Args>
+            constexpr explicit expected_void_storage(expected_invoke_error_t, F&& f, Args&&... args);
+
+            constexpr bool HasValue() const noexcept;
+            constexpr E& Error() noexcept;
+            constexpr const E& Error() const noexcept;
+
+            template <class... Args>
+            constexpr void ConstructError(Args&&... args);
+
+            constexpr void DestroyError() noexcept;
+
+        private:
+            E unex;
+        };
+
+        /**
+         * @brief Moves `source` back into the destroyed object `target` if the scope exits through an exception, unless
+         *        released. Used to put back the old value or error when constructing the new one throws.
+         */
+        template <class T>
+        class expected_restore_guard
+        {
+        public:
+            constexpr expected_restore_guard(T& inTarget, T& inSource) noexcept
+                : target(std::addressof(inTarget)), source(std::addressof(inSource))
+            {
+            }
+
+            expected_restore_guard(const expected_restore_guard&) = delete;
+            expected_restore_guard& operator=(const expected_restore_guard&) = delete;
+
+            constexpr ~expected_restore_guard();
+
+            constexpr void Release() noexcept
+            {
+                target = nullptr;
+            }
+
+        private:
+            T* target;
+            T* source;
+        };
+
+        /**
+         * @brief Throws `bad_expected_access`, or aborts when exceptions are disabled.
+         */
+        template <class E>
+        [[noreturn]] void expected_throw_bad_access(E&& e);
+    }
+
+    /**
+     * @brief Either a value of type `T` or an error of type `E`, returned by value, so that a function can report
+     *        failure without exceptions or out-params.
+     *
+     *        The value and the error share storage, and the flag saying which one is there goes after them, in their
+     *        tail padding when they have some that can be reused. So, e.g., `expected<int, ErrorCode>` is 8 bytes. It's
+     *        trivially copyable, movable, and destructible whenever `T` and `E` are, so it's returned in registers.
+     * @see https://eel.is/c++draft/expected.expected
+     * @see https://cppreference.com/w/cpp/utility/expected
+     * @note A feature from the C++23 standard.
+     */
+    template <class T, class E>
+    class expected
+    {
+        static_assert(!std::is_reference_v<T> && !std::is_function_v<T> && !std::is_array_v<T> &&
+            !std::is_same_v<std::remove_cv_t<T>, std::in_place_t> && !std::is_same_v<std::remove_cv_t<T>, unexpect_t> &&
+            !Detail::is_unexpected_v<std::remove_cv_t<T>>, "expected's value type is not valid.");
+        static_assert(std::is_object_v<E> && !std::is_array_v<E> && !std::is_const_v<E> && !std::is_volatile_v<E>,
+            "expected's error type must be a non-array, non-cv object type.");
+
+        template <class, class>
+        friend class expected;
+
+    public:
+        using value_type = T;
+        using error_type = E;
+        using unexpected_type = unexpected<E>;
+
+        template <class U>
+        using rebind = expected<U, error_type>;
+
+        // Constructors.
+
+        constexpr expected()
+            requires std::is_default_constructible_v<T>;
+
+        constexpr expected(const expected&)
+            requires Detail::expected_trivially_copy_constructible<T, E> = default;
+        constexpr expected(const expected& rhs)
+            requires Detail::expected_copy_constructible<T, E>;
+
+        constexpr expected(expected&&)
+            requires Detail::expected_trivially_move_constructible<T, E> = default;
+        constexpr expected(expected&& rhs) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>)
+            requires Detail::expected_move_constructible<T, E>;
+
+        template <class U, class G>
+            requires Detail::expected_can_convert_v<T, E, U, G, const U&, const G&>
+        constexpr explicit(!std::is_convertible_v<const U&, T> || !std::is_convertible_v<const G&, E>)
+            expected(const expected<U, G>& rhs);
+
+        template <class U, class G>
+            requires Detail::expected_can_convert_v<T, E, U, G, U, G>
+        constexpr explicit(!std::is_convertible_v<U, T> || !std::is_convertible_v<G, E>)
+            expected(expected<U, G>&& rhs);
+
+        template <class U = std::remove_cv_t<T>>
+            requires Detail::expected_can_construct_from_value_v<T, E, U>
+        constexpr explicit(!std::is_convertible_v<U, T>) expected(U&& v);
+
+        template <class G>
+            requires std::is_constructible_v<E, const G&>
+        constexpr explicit(!std::is_convertible_v<const G&, E>) expected(const unexpected<G>& e);
+
+        template <class G>
+            requires std::is_constructible_v<E, G>
+        constexpr explicit(!std::is_convertible_v<G, E>) expected(unexpected<G>&& e);
+
+        template <class... Args>
+            requires std::is_constructible_v<T, Args...>
+        constexpr explicit expected(std::in_place_t, Args&&... args);
+
+        template <class U, class... Args>
+            requires std::is_constructible_v<T, std::initializer_list<U>&, Args...>
+        constexpr explicit expected(std::in_place_t, std::initializer_list<U> il, Args&&... args);
+
+        template <class... Args>
+            requires std::is_constructible_v<E, Args...>
+        constexpr explicit expected(unexpect_t, Args&&... args);
+
+        template <class U, class... Args>
+            requires std::is_constructible_v<E, std::initializer_list<U>&, Args...>
+        constexpr explicit expected(unexpect_t, std::initializer_list<U> il, Args&&... args);
+
+        // Destructor.
+
+        constexpr ~expected()
+            requires (std::is_trivially_destructible_v<T> && std::is_trivially_destructible_v<E>) = default;
+        constexpr ~expected();
+
+        // Assignment.
+
+        constexpr expected& operator=(const expected&)
+            requires Detail::expected_trivially_copy_assignable<T, E> = default;
+        constexpr expected& operator=(const expected& rhs)
+            requires Detail::expected_copy_assignable<T, E>;
+
+        constexpr expected& operator=(expected&&)
+            requires Detail::expected_trivially_move_assignable<T, E> = default;
+        constexpr expected& operator=(expected&& rhs) noexcept(
+            std::is_nothrow_move_assignable_v<T> && std::is_nothrow_move_constructible_v<T> &&
+            std::is_nothrow_move_assignable_v<E> && std::is_nothrow_move_constructible_v<E>)
+            requires Detail::expected_move_assignable<T, E>;
+
+        template <class U = std::remove_cv_t<T>>
+            requires Detail::expected_can_assign_value_v<T, E, U>
+        constexpr expected& operator=(U&& v);
+
+        template <class G>
+            requires Detail::expected_can_assign_error_v<T, E, const G&>
+        constexpr expected& operator=(const unexpected<G>& e);
+
+        template <class G>
+            requires Detail::expected_can_assign_error_v<T, E, G>
+        constexpr expected& operator=(unexpected<G>&& e);
+
+        template <class... Args>
+            requires std::is_nothrow_constructible_v<T, Args...>
+        constexpr T& emplace(Args&&... args) noexcept;
+
+        template <class U, class... Args>
+            requires std::is_nothrow_constructible_v<T, std::initializer_list<U>&, Args...>
+        constexpr T& emplace(std::initializer_list<U> il, Args&&... args) noexcept;
+
+        // Swap.
+
+        constexpr void swap(expected& rhs) noexcept(
+            std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T> &&
+            std::is_nothrow_move_constructible_v<E> && std::is_nothrow_swappable_v<E>)
+            requires (std::is_swappable_v<T> && std::is_swappable_v<E> &&
+                std::is_move_constructible_v<T> && std::is_move_constructible_v<E> &&
+                (std::is_nothrow_move_constructible_v<T> || std::is_nothrow_move_constructible_v<E>));
+
+        friend constexpr void swap(expected& x, expected& y) noexcept(noexcept(x.swap(y)))
+            requires requires { x.swap(y); }
+        {
+            x.swap(y);
+        }
+
+        // Observers.
+
+        constexpr const T* operator->() const noexcept;
+        constexpr T* operator->() noexcept;
+        constexpr const T& operator*() const& noexcept;
+        constexpr T& operator*() & noexcept;
+        constexpr const T&& operator*() const&& noexcept;
+        constexpr T&& operator*() && noexcept;
+        constexpr explicit operator bool() const noexcept;
+        constexpr bool has_value() const noexcept;
+        constexpr const T& value() const&;
+        constexpr T& value() &;
+        constexpr const T&& value() const&&;
+        constexpr T&& value() &&;
+        constexpr const E& error() const& noexcept;
+        constexpr E& error() & noexcept;
+        constexpr const E&& error() const&& noexcept;
+        constexpr E&& error() && noexcept;
+
+        template <class U = std::remove_cv_t<T>>
+        constexpr T value_or(U&& v) const&;
+        template <class U = std::remove_cv_t<T>>
+        constexpr T value_or(U&& v) &&;
+
+        template <class G = E>
+        constexpr E error_or(G&& e) const&;
+        template <class G = E>
+        constexpr E error_or(G&& e) &&;
+
+        // Monadic operations.
+
+        template <class F>
+            requires std::is_constructible_v<E, E&>
+        constexpr auto and_then(F&& f) &;
+        template <class F>
+            requires std::is_constructible_v<E, E&&>
+        constexpr auto and_then(F&& f) &&;
+        template <class F>
+            requires std::is_constructible_v<E, const E&>
+        constexpr auto and_then(F&& f) const&;
+        template <class F>
+            requires std::is_constructible_v<E, const E&&>
+        constexpr auto and_then(F&& f) const&&;
+
+        template <class F>
+            requires std::is_constructible_v<T, T&>
+        constexpr auto or_else(F&& f) &;
+        template <class F>
+            requires std::is_constructible_v<T, T&&>
+        constexpr auto or_else(F&& f) &&;
+        template <class F>
+            requires std::is_constructible_v<T, const T&>
+        constexpr auto or_else(F&& f) const&;
+        template <class F>
+            requires std::is_constructible_v<T, const T&&>
+        constexpr auto or_else(F&& f) const&&;
+
+        template <class F>
+            requires std::is_constructible_v<E, E&>
+        constexpr auto transform(F&& f) &;
+        template <class F>
+            requires std::is_constructible_v<E, E&&>
+        constexpr auto transform(F&& f) &&;
+        template <class F>
+            requires std::is_constructible_v<E, const E&>
+        constexpr auto transform(F&& f) const&;
+        template <class F>
+            requires std::is_constructible_v<E, const E&&>
+        constexpr auto transform(F&& f) const&&;
+
+        template <class F>
+            requires std::is_constructible_v<T, T&>
+        constexpr auto transform_error(F&& f) &;
+        template <class F>
+            requires std::is_constructible_v<T, T&&>
+        constexpr auto transform_error(F&& f) &&;
+        template <class F>
+            requires std::is_constructible_v<T, const T&>
+        constexpr auto transform_error(F&& f) const&;
+        template <class F>
+            requires std::is_constructible_v<T, const T&&>
+        constexpr auto transform_error(F&& f) const&&;
+
+        // Equality operators.
+
+        template <class T2, class E2>
+            requires (!std::is_void_v<T2>)
+        friend constexpr bool operator==(const expected& x, const expected<T2, E2>& y)
+        {
+            if (x.has_value() != y.has_value())
+            {
+                return false;
+            }
+            return x.has_value() ? static_cast<bool>(*x == *y) : static_cast<bool>(x.error() == y.error());
+        }
+
+        template <class T2>
+            requires (!Detail::is_expected_v<T2>)
+        friend constexpr bool operator==(const expected& x, const T2& v)
+        {
+            return x.has_value() && static_cast<bool>(*x == v);
+        }
+
+        template <class E2>
+        friend constexpr bool operator==(const expected& x, const unexpected<E2>& e)
+        {
+            return !x.has_value() && static_cast<bool>(x.error() == e.error());
+        }
+
+    private:
+        template <class F, class... Args>
+        constexpr explicit expected(Detail::expected_invoke_value_t tag, F&& f, Args&&... args);
+
+        template <class F, class... Args>
+        constexpr explicit expected(Detail::expected_invoke_error_t tag, F&& f, Args&&... args);
+
+        /**
+         * @brief Replaces the value with an error or vice versa, such that if constructing the new one throws, the old one
+         *        is put back.
+         * @see https://eel.is/c++draft/expected.object.assign#lib:reinit-expected
+         */
+        template <class NewVal, class OldVal, class... Args>
+        static constexpr void ReinitExpected(NewVal& newVal, OldVal& oldVal, Args&&... args);
+
+        CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Detail::expected_union<T, E> u;
+        bool has_val;
+    };
+
+    /**
+     * @brief An `expected` with no value, only possibly an error. If `E` has an `expected_niche`, it's the size of an `E`.
+     * @see https://eel.is/c++draft/expected.void
+     * @note A feature from the C++23 standard.
+     */
+    template <class T, class E>
+        requires std::is_void_v<T>
+    class expected<T, E>
+    {
+        static_assert(std::is_object_v<E> && !std::is_array_v<E> && !std::is_const_v<E> && !std::is_volatile_v<E>,
+            "expected's error type must be a non-array, non-cv object type.");
+
+        template <class, class>
+        friend class expected;
+
+    public:
+        using value_type = T;
+        using error_type = E;
+        using unexpected_type = unexpected<E>;
+
+        template <class U>
+        using rebind = expected<U, error_type>;
+
+        // Constructors.
+
+        constexpr expected() noexcept;
+
+        constexpr expected(const expected&) = default;
+        constexpr expected(expected&&) = default;
+
+        template <class U, class G>
+            requires Detail::expected_void_can_convert_v<E, U, G, const G&>
+        constexpr explicit(!std::is_convertible_v<const G&, E>) expected(const expected<U, G>& rhs);
+
+        template <class U, class G>
+            requires Detail::expected_void_can_convert_v<E, U, G, G>
+        constexpr explicit(!std::is_convertible_v<G, E>) expected(expected<U, G>&& rhs);
+
+        template <class G>
+            requires std::is_constructible_v<E, const G&>
+        constexpr explicit(!std::is_convertible_v<const G&, E>) expected(const unexpected<G>& e);
+
+        template <class G>
+            requires std::is_constructible_v<E, G>
+        constexpr explicit(!std::is_convertible_v<G, E>) expected(unexpected<G>&& e);
+
+        constexpr explicit expected(std::in_place_t) noexcept;
+
+        template <class... Args>
+            requires std::is_constructible_v<E, Args...>
+        constexpr explicit expected(unexpect_t, Args&&... args);
+
+        template <class U, class... Args>
+            requires std::is_constructible_v<E, std::initializer_list<U>&, Args...>
+        constexpr explicit expected(unexpect_t, std::initializer_list<U> il, Args&&... args);
+
+        // Destructor.
+
+        constexpr ~expected() = default;
+
+        // Assignment.
+
+        constexpr expected& operator=(const expected&)
+            requires Detail::expected_trivially_copy_assignable<E> = default;
+        constexpr expected& operator=(const expected& rhs)
+            requires Detail::expected_copy_assignable<E>;
+
+        constexpr expected& operator=(expected&&)
+            requires Detail::expected_trivially_move_assignable<E> = default;
+        constexpr expected& operator=(expected&& rhs) noexcept(std::is_nothrow_move_constructible_v<E> && std::is_nothrow_move_assignable_v<E>)
+            requires Detail::expected_move_assignable<E>;
+
+        template <class G>
+            requires (std::is_constructible_v<E, const G&> && std::is_assignable_v<E&, const G&>)
+        constexpr expected& operator=(const unexpected<G>& e);
+
+        template <class G>
+            requires (std::is_constructible_v<E, G> && std::is_assignable_v<E&, G>)
+        constexpr expected& operator=(unexpected<G>&& e);
+
+        constexpr void emplace() noexcept;
+
+        // Swap.
+
+        constexpr void swap(expected& rhs) noexcept(std::is_nothrow_move_constructible_v<E> && std::is_nothrow_swappable_v<E>)
+            requires (std::is_swappable_v<E> && std::is_move_constructible_v<E>);
+
+        friend constexpr void swap(expected& x, expected& y) noexcept(noexcept(x.swap(y)))
+            requires requires { x.swap(y); }
+        {
+            x.swap(y);
+        }
+
+        // Observers.
+
+        constexpr explicit operator bool() const noexcept;
+        constexpr bool has_value() const noexcept;
+        constexpr void operator*() const noexcept;
+        constexpr void value() const&;
+        constexpr void value() &&;
+        constexpr const E& error() const& noexcept;
+        constexpr E& error() & noexcept;
+        constexpr const E&& error() const&& noexcept;
+        constexpr E&& error() && noexcept;
+
+        template <class G = E>
+        constexpr E error_or(G&& e) const&;
+        template <class G = E>
+        constexpr E error_or(G&& e) &&;
+
+        // Monadic operations.
+
+        template <class F>
+            requires std::is_constructible_v<E, E&>
+        constexpr auto and_then(F&& f) &;
+        template <class F>
+            requires std::is_constructible_v<E, E&&>
+        constexpr auto and_then(F&& f) &&;
+        template <class F>
+            requires std::is_constructible_v<E, const E&>
+        constexpr auto and_then(F&& f) const&;
+        template <class F>
+            requires std::is_constructible_v<E, const E&&>
+        constexpr auto and_then(F&& f) const&&;
+
+        template <class F>
+        constexpr auto or_else(F&& f) &;
+        template <class F>
+        constexpr auto or_else(F&& f) &&;
+        template <class F>
+        constexpr auto or_else(F&& f) const&;
+        template <class F>
+        constexpr auto or_else(F&& f) const&&;
+
+        template <class F>
+            requires std::is_constructible_v<E, E&>
+        constexpr auto transform(F&& f) &;
+        template <class F>
+            requires std::is_constructible_v<E, E&&>
+        constexpr auto transform(F&& f) &&;
+        template <class F>
+            requires std::is_constructible_v<E, const E&>
+        constexpr auto transform(F&& f) const&;
+        template <class F>
+            requires std::is_constructible_v<E, const E&&>
+        constexpr auto transform(F&& f) const&&;
+
+        template <class F>
+        constexpr auto transform_error(F&& f) &;
+        template <class F>
+        constexpr auto transform_error(F&& f) &&;
+        template <class F>
+        constexpr auto transform_error(F&& f) const&;
+        template <class F>
+        constexpr auto transform_error(F&& f) const&&;
+
+        // Equality operators.
+
+        template <class T2, class E2>
+            requires std::is_void_v<T2>
+        friend constexpr bool operator==(const expected& x, const expected<T2, E2>& y)
+        {
+            if (x.has_value() != y.has_value())
+            {
+                return false;
+            }
+            return x.has_value() || static_cast<bool>(x.error() == y.error());
+        }
+
+        template <class E2>
+        friend constexpr bool operator==(const expected& x, const unexpected<E2>& e)
+        {
+            return !x.has_value() && static_cast<bool>(x.error() == e.error());
+        }
+
+    private:
+        template <class F, class... Args>
+        constexpr explicit expected(Detail::expected_invoke_error_t tag, F&& f, Args&&... args);
+
+        Detail::expected_void_storage<E> storage;
+    };
+}
+
+#include <CppUtils/StdReimpl/expected.inl>
@@ -0,0 +1,1641 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/expected.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <memory>
+#include <utility>
+
+namespace StdReimpl
+{
+    inline const char* bad_expected_access<void>::what() const noexcept
+    {
+        return "bad access to StdReimpl::expected without expected value";
+    }
+
+    template <class E>
+    bad_expected_access<E>::bad_expected_access(E e)
+        : unex(std::move(e))
+    {
+    }
+
+    template <class E>
+    const char* bad_expected_access<E>::what() const noexcept
+    {
+        return bad_expected_access<void>::what();
+    }
+
+    template <class E>
+    E& bad_expected_access<E>::error() & noexcept
+    {
+        return unex;
+    }
+
+    template <class E>
+    const E& bad_expected_access<E>::error() const& noexcept
+    {
+        return unex;
+    }
+
+    template <class E>
+    E&& bad_expected_access<E>::error() && noexcept
+    {
+        return std::move(unex);
+    }
+
+    template <class E>
+    const E&& bad_expected_access<E>::error() const&& noexcept
+    {
+        return std::move(unex);
+    }
+
+    template <class E>
+    template <class Err>
+        requires (!std::is_same_v<std::remove_cvref_t<Err>, unexpected<E>> &&
+            !std::is_same_v<std::remove_cvref_t<Err>, std::in_place_t> &&
+            std::is_constructible_v<E, Err>)
+    constexpr unexpected<E>::unexpected(Err&& e)
+        : unex(std::forward<Err>(e))
+    {
+    }
+
+    template <class E>
+    template <class... Args>
+        requires std::is_constructible_v<E, Args...>
+    constexpr unexpected<E>::unexpected(std::in_place_t, Args&&... args)
+        : unex(std::forward<Args>(args)...)
+    {
+    }
+
+    template <class E>
+    template <class U, class... Args>
+        requires std::is_constructible_v<E, std::initializer_list<U>&, Args...>
+    constexpr unexpected<E>::unexpected(std::in_place_t, std::initializer_list<U> il, Args&&... args)
+        : unex(il, std::forward<Args>(args)...)
+    {
+    }
+
+    template <class E>
+    constexpr const E& unexpected<E>::error() const& noexcept
+    {
+        return unex;
+    }
+
+    template <class E>
+    constexpr E& unexpected<E>::error() & noexcept
+    {
+        return unex;
+    }
+
+    template <class E>
+    constexpr const E&& unexpected<E>::error() const&& noexcept
+    {
+        return std::move(unex);
+    }
+
+    template <class E>
+    constexpr E&& unexpected<E>::error() && noexcept
+    {
+        return std::move(unex);
+    }
+
+    template <class E>
+    constexpr void unexpected<E>::swap(unexpected& other) noexcept(std::is_nothrow_swappable_v<E>)
+    {
+        static_assert(std::is_swappable_v<E>, "unexpected::swap requires a swappable error type.");
+
+        using std::swap;
+        swap(unex, other.unex);
+    }
+
+    namespace Detail
+    {
+        template <class T>
+        constexpr expected_restore_guard<T>::~expected_restore_guard()
+        {
+            if (target)
+            {
+                std::construct_at(target, std::move(*source));
+            }
+        }
+
+        template <class E>
+        [[noreturn]] void expected_throw_bad_access(E&& e)
+        {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            throw StdReimpl::bad_expected_access<std::decay_t<E>>(std::forward<E>(e));
+#else
+            static_cast<void>(e);
+            std::abort();
+#endif
+        }
+
+        template <class E, bool Niche>
+        constexpr expected_void_storage<E, Niche>::expected_void_storage(const expected_void_storage& other)
+            requires expected_copy_constructible<E>
+            : has_val(other.has_val)
+        {
+            if (!has_val)
+            {
+                std::construct_at(std::addressof(u.unex), other.u.unex);
+            }
+        }
+
+        template <class E, bool Niche>
+        constexpr expected_void_storage<E, Niche>::expected_void_storage(expected_void_storage&& other) noexcept(std::is_nothrow_move_constructible_v<E>)
+            requires expected_move_constructible<E>
+            : has_val(other.has_val)
+        {
+            if (!has_val)
+            {
+                std::construct_at(std::addressof(u.unex), std::move(other.u.unex));
+            }
+        }
+
+        template <class E, bool Niche>
+        constexpr expected_void_storage<E, Niche>::~expected_void_storage()
+        {
+            if (!has_val)
+            {
+                std::destroy_at(std::addressof(u.unex));
+            }
+        }
+
+        template <class E, bool Niche>
+        constexpr bool expected_void_storage<E, Niche>::HasValue() const noexcept
+        {
+            return has_val;
+        }
+
+        template <class E, bool Niche>
+        constexpr E& expected_void_storage<E, Niche>::Error() noexcept
+        {
+            return u.unex;
+        }
+
+        template <class E, bool Niche>
+        constexpr const E& expected_void_storage<E, Niche>::Error() const noexcept
+        {
+            return u.unex;
+        }
+
+        template <class E, bool Niche>
+        template <class... Args>
+        constexpr void expected_void_storage<E, Niche>::ConstructError(Args&&... args)
+        {
+            std::construct_at(std::addressof(u.unex), std::forward<Args>(args)...);
+            has_val = false;
+        }
+
+        template <class E, bool Niche>
+        constexpr void expected_void_storage<E, Niche>::DestroyError() noexcept
+        {
+            std::destroy_at(std::addressof(u.unex));
+            has_val = true;
+        }
+
+        template <class E>
+        constexpr expected_void_storage<E, true>::expected_void_storage() noexcept
+            : unex(StdReimpl::expected_niche<E>::value)
+        {
+        }
+
+        template <class E>
+        template <class... Args>
+        constexpr expected_void_storage<E, true>::expected_void_storage(StdReimpl::unexpect_t, Args&&... args)
+            : unex(std::forward<Args>(args)...)
+        {
+            assert(!HasValue() && "The niche value can't be used as an error.");
+        }
+
+        template <class E>
+        template <class F, class... Args>
+        constexpr expected_void_storage<E, true>::expected_void_storage(expected_invoke_error_t, F&& f, Args&&... args)
+            : unex(std::invoke(std::forward<F>(f), std::forward<Args>(args)...))
+        {
+            assert(!HasValue() && "The niche value can't be used as an error.");
+        }
+
+        template <class E>
+        constexpr bool expected_void_storage<E, true>::HasValue() const noexcept
+        {
+            return unex == static_cast<E>(StdReimpl::expected_niche<E>::value);
+        }
+
+        template <class E>
+        constexpr E& expected_void_storage<E, true>::Error() noexcept
+        {
+            return unex;
+        }
+
+        template <class E>
+        constexpr const E& expected_void_storage<E, true>::Error() const noexcept
+        {
+            return unex;
+        }
+
+        template <class E>
+        template <class... Args>
+        constexpr void expected_void_storage<E, true>::ConstructError(Args&&... args)
+        {
+            // `E` is trivially copyable, so it's fine to construct over the niche value without destroying it.
+            std::construct_at(std::addressof(unex), std::forward<Args>(args)...);
+            assert(!HasValue() && "The niche value can't be used as an error.");
+        }
+
+        template <class E>
+        constexpr void expected_void_storage<E, true>::DestroyError() noexcept
+        {
+            unex = StdReimpl::expected_niche<E>::value;
+        }
+    }
+
+    template <class T, class E>
+    constexpr expected<T, E>::expected()
+        requires std::is_default_constructible_v<T>
+        : u(std::in_place), has_val(true)
+    {
+    }
+
+    template <class T, class E>
+    constexpr expected<T, E>::expected(const expected& rhs)
+        requires Detail::expected_copy_constructible<T, E>
+        : has_val(rhs.has_val)
+    {
+        if (has_val)
+        {
+            std::construct_at(std::addressof(u.val), rhs.u.val);
+        }
+        else
+        {
+            std::construct_at(std::addressof(u.unex), rhs.u.unex);
+        }
+    }
+
+    template <class T, class E>
+    constexpr expected<T, E>::expected(expected&& rhs) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>)
+        requires Detail::expected_move_constructible<T, E>
+        : has_val(rhs.has_val)
+    {
+        if (has_val)
+        {
+            std::construct_at(std::addressof(u.val), std::move(rhs.u.val));
+        }
+        else
+        {
+            std::construct_at(std::addressof(u.unex), std::move(rhs.u.unex));
+        }
+    }
+
+    template <class T, class E>
+    template <class U, class G>
+        requires Detail::expected_can_convert_v<T, E, U, G, const U&, const G&>
+    constexpr expected<T, E>::expected(const expected<U, G>& rhs)
+        : has_val(rhs.has_value())
+    {
+        if (has_val)
+        {
+            std::construct_at(std::addressof(u.val), *rhs);
+        }
+        else
+        {
+            std::construct_at(std::addressof(u.unex), rhs.error());
+        }
+    }
+
+    template <class T, class E>
+    template <class U, class G>
+        requires Detail::expected_can_convert_v<T, E, U, G, U, G>
+    constexpr expected<T, E>::expected(expected<U, G>&& rhs)
+        : has_val(rhs.has_value())
+    {
+        if (has_val)
+        {
+            std::construct_at(std::addressof(u.val), std::move(*rhs));
+        }
+        else
+        {
+            std::construct_at(std::addressof(u.unex), std::move(rhs).error());
+        }
+    }
+
+    template <class T, class E>
+    template <class U>
+        requires Detail::expected_can_construct_from_value_v<T, E, U>
+    constexpr expected<T, E>::expected(U&& v)
+        : u(std::in_place, std::forward<U>(v)), has_val(true)
+    {
+    }
+
+    template <class T, class E>
+    template <class G>
+        requires std::is_constructible_v<E, const G&>
+    constexpr expected<T, E>::expected(const unexpected<G>& e)
+        : u(unexpect, e.error()), has_val(false)
+    {
+    }
+
+    template <class T, class E>
+    template <class G>
+        requires std::is_constructible_v<E, G>
+    constexpr expected<T, E>::expected(unexpected<G>&& e)
+        : u(unexpect, std::move(e).error()), has_val(false)
+    {
+    }
+
+    template <class T, class E>
+    template <class... Args>
+        requires std::is_constructible_v<T, Args...>
+    constexpr expected<T, E>::expected(std::in_place_t, Args&&... args)
+        : u(std::in_place, std::forward<Args>(args)...), has_val(true)
+    {
+    }
+
+    template <class T, class E>
+    template <class U, class... Args>
+        requires std::is_constructible_v<T, std::initializer_list<U>&, Args...>
+    constexpr expected<T, E>::expected(std::in_place_t, std::initializer_list<U> il, Args&&... args)
+        : u(std::in_place, il, std::forward<Args>(args)...), has_val(true)
+    {
+    }
+
+    template <class T, class E>
+    template <class... Args>
+        requires std::is_constructible_v<E, Args...>
+    constexpr expected<T, E>::expected(unexpect_t, Args&&... args)
+        : u(unexpect, std::forward<Args>(args)...), has_val(false)
+    {
+    }
+
+    template <class T, class E>
+    template <class U, class... Args>
+        requires std::is_constructible_v<E, std::initializer_list<U>&, Args...>
+    constexpr expected<T, E>::expected(unexpect_t, std::initializer_list<U> il, Args&&... args)
+        : u(unexpect, il, std::forward<Args>(args)...), has_val(false)
+    {
+    }
+
+    template <class T, class E>
+    template <class F, class... Args>
+    constexpr expected<T, E>::expected(Detail::expected_invoke_value_t tag, F&& f, Args&&... args)
+        : u(tag, std::forward<F>(f), std::forward<Args>(args)...), has_val(true)
+    {
+    }
+
+    template <class T, class E>
+    template <class F, class... Args>
+    constexpr expected<T, E>::expected(Detail::expected_invoke_error_t tag, F&& f, Args&&... args)
+        : u(tag, std::forward<F>(f), std::forward<Args>(args)...), has_val(false)
+    {
+    }
+
+    template <class T, class E>
+    constexpr expected<T, E>::~expected()
+    {
+        if (has_val)
+        {
+            std::destroy_at(std::addressof(u.val));
+        }
+        else
+        {
+            std::destroy_at(std::addressof(u.unex));
+        }
+    }
+
+    template <class T, class E>
+    template <class NewVal, class OldVal, class... Args>
+    constexpr void expected<T, E>::ReinitExpected(NewVal& newVal, OldVal& oldVal, Args&&... args)
+    {
+        if constexpr (std::is_nothrow_constructible_v<NewVal, Args...>)
+        {
+            std::destroy_at(std::addressof(oldVal));
+            std::construct_at(std::addressof(newVal), std::forward<Args>(args)...);
+        }
+        else if constexpr (std::is_nothrow_move_constructible_v<NewVal>)
+        {
+            NewVal temp(std::forward<Args>(args)...);
+            std::destroy_at(std::addressof(oldVal));
+            std::construct_at(std::addressof(newVal), std::move(temp));
+        }
+        else
+        {
+            // The assignment operators require one of the two to be nothrow move constructible, so this one is.
+            OldVal temp(std::move(oldVal));
+            std::destroy_at(std::addressof(oldVal));
+            Detail::expected_restore_guard<OldVal> guard(oldVal, temp);
+            std::construct_at(std::addressof(newVal), std::forward<Args>(args)...);
+            guard.Release();
+        }
+    }
+
+    template <class T, class E>
+    constexpr expected<T, E>& expected<T, E>::operator=(const expected& rhs)
+        requires Detail::expected_copy_assignable<T, E>
+    {
+        if (has_val && rhs.has_val)
+        {
+            u.val = rhs.u.val;
+        }
+        else if (has_val)
+        {
+            ReinitExpected(u.unex, u.val, rhs.u.unex);
+        }
+        else if (rhs.has_val)
+        {
+            ReinitExpected(u.val, u.unex, rhs.u.val);
+        }
+        else
+        {
+            u.unex = rhs.u.unex;
+        }
+        has_val = rhs.has_val;
+        return *this;
+    }
+
+    template <class T, class E>
+    constexpr expected<T, E>& expected<T, E>::operator=(expected&& rhs) noexcept(
+        std::is_nothrow_move_assignable_v<T> && std::is_nothrow_move_constructible_v<T> &&
+        std::is_nothrow_move_assignable_v<E> && std::is_nothrow_move_constructible_v<E>)
+        requires Detail::expected_move_assignable<T, E>
+    {
+        if (has_val && rhs.has_val)
+        {
+            u.val = std::move(rhs.u.val);
+        }
+        else if (has_val)
+        {
+            ReinitExpected(u.unex, u.val, std::move(rhs.u.unex));
+        }
+        else if (rhs.has_val)
+        {
+            ReinitExpected(u.val, u.unex, std::move(rhs.u.val));
+        }
+        else
+        {
+            u.unex = std::move(rhs.u.unex);
+        }
+        has_val = rhs.has_val;
+        return *this;
+    }
+
+    template <class T, class E>
+    template <class U>
+        requires Detail::expected_can_assign_value_v<T, E, U>
+    constexpr expected<T, E>& expected<T, E>::operator=(U&& v)
+    {
+        if (has_val)
+        {
+            u.val = std::forward<U>(v);
+        }
+        else
+        {
+            ReinitExpected(u.val, u.unex, std::forward<U>(v));
+            has_val = true;
+        }
+        return *this;
+    }
+
+    template <class T, class E>
+    template <class G>
+        requires Detail::expected_can_assign_error_v<T, E, const G&>
+    constexpr expected<T, E>& expected<T, E>::operator=(const unexpected<G>& e)
+    {
+        if (has_val)
+        {
+            ReinitExpected(u.unex, u.val, e.error());
+            has_val = false;
+        }
+        else
+        {
+            u.unex = e.error();
+        }
+        return *this;
+    }
+
+    template <class T, class E>
+    template <class G>
+        requires Detail::expected_can_assign_error_v<T, E, G>
+    constexpr expected<T, E>& expected<T, E>::operator=(unexpected<G>&& e)
+    {
+        if (has_val)
+        {
+            ReinitExpected(u.unex, u.val, std::move(e).error());
+            has_val = false;
+        }
+        else
+        {
+            u.unex = std::move(e).error();
+        }
+        return *this;
+    }
+
+    template <class T, class E>
+    template <class... Args>
+        requires std::is_nothrow_constructible_v<T, Args...>
+    constexpr T& expected<T, E>::emplace(Args&&... args) noexcept
+    {
+        if (has_val)
+        {
+            std::destroy_at(std::addressof(u.val));
+        }
+        else
+        {
+            std::destroy_at(std::addressof(u.unex));
+            has_val = true;
+        }
+        return *std::construct_at(std::addressof(u.val), std::forward<Args>(args)...);
+    }
+
+    template <class T, class E>
+    template <class U, class... Args>
+        requires std::is_nothrow_constructible_v<T, std::initializer_list<U>&, Args...>
+    constexpr T& expected<T, E>::emplace(std::initializer_list<U> il, Args&&... args) noexcept
+    {
+        if (has_val)
+        {
+            std::destroy_at(std::addressof(u.val));
+        }
+        else
+        {
+            std::destroy_at(std::addressof(u.unex));
+            has_val = true;
+        }
+        return *std::construct_at(std::addressof(u.val), il, std::forward<Args>(args)...);
+    }
+
+    template <class T, class E>
+    constexpr void expected<T, E>::swap(expected& rhs) noexcept(
+        std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T> &&
+        std::is_nothrow_move_constructible_v<E> && std::is_nothrow_swappable_v<E>)
+        requires (std::is_swappable_v<T> && std::is_swappable_v<E> &&
+            std::is_move_constructible_v<T> && std::is_move_constructible_v<E> &&
+            (std::is_nothrow_move_constructible_v<T> || std::is_nothrow_move_constructible_v<E>))
+    {
+        using std::swap;
+
+        if (has_val && rhs.has_val)
+        {
+            swap(u.val, rhs.u.val);
+        }
+        else if (!has_val && !rhs.has_val)
+        {
+            swap(u.unex, rhs.u.unex);
+        }
+        else if (!has_val)
+        {
+            rhs.swap(*this);
+        }
+        else
+        {
+            // We have the value and `rhs` has the error. Move whichever can't throw through a temporary, and if moving
+            // the other one throws, put the temporary back.
+            if constexpr (std::is_nothrow_move_constructible_v<E>)
+            {
+                E temp(std::move(rhs.u.unex));
+                std::destroy_at(std::addressof(rhs.u.unex));
+                Detail::expected_restore_guard<E> guard(rhs.u.unex, temp);
+                std::construct_at(std::addressof(rhs.u.val), std::move(u.val));
+                guard.Release();
+                std::destroy_at(std::addressof(u.val));
+                std::construct_at(std::addressof(u.unex), std::move(temp));
+            }
+            else
+            {
+                T temp(std::move(u.val));
+                std::destroy_at(std::addressof(u.val));
+                Detail::expected_restore_guard<T> guard(u.val, temp);
+                std::construct_at(std::addressof(u.unex), std::move(rhs.u.unex));
+                guard.Release();
+                std::destroy_at(std::addressof(rhs.u.unex));
+                std::construct_at(std::addressof(rhs.u.val), std::move(temp));
+            }
+            has_val = false;
+            rhs.has_val = true;
+        }
+    }
+
+    template <class T, class E>
+    constexpr const T* expected<T, E>::operator->() const noexcept
+    {
+        assert(has_val);
+        return std::addressof(u.val);
+    }
+
+    template <class T, class E>
+    constexpr T* expected<T, E>::operator->() noexcept
+    {
+        assert(has_val);
+        return std::addressof(u.val);
+    }
+
+    template <class T, class E>
+    constexpr const T& expected<T, E>::operator*() const& noexcept
+    {
+        assert(has_val);
+        return u.val;
+    }
+
+    template <class T, class E>
+    constexpr T& expected<T, E>::operator*() & noexcept
+    {
+        assert(has_val);
+        return u.val;
+    }
+
+    template <class T, class E>
+    constexpr const T&& expected<T, E>::operator*() const&& noexcept
+    {
+        assert(has_val);
+        return std::move(u.val);
+    }
+
+    template <class T, class E>
+    constexpr T&& expected<T, E>::operator*() && noexcept
+    {
+        assert(has_val);
+        return std::move(u.val);
+    }
+
+    template <class T, class E>
+    constexpr expected<T, E>::operator bool() const noexcept
+    {
+        return has_val;
+    }
+
+    template <class T, class E>
+    constexpr bool expected<T, E>::has_value() const noexcept
+    {
+        return has_val;
+    }
+
+    template <class T, class E>
+    constexpr const T& expected<T, E>::value() const&
+    {
+        static_assert(std::is_copy_constructible_v<E>, "expected::value requires a copyable error type.");
+
+        if (!has_val)
+        {
+            Detail::expected_throw_bad_access(std::as_const(u.unex));
+        }
+        return u.val;
+    }
+
+    template <class T, class E>
+    constexpr T& expected<T, E>::value() &
+    {
+        static_assert(std::is_copy_constructible_v<E>, "expected::value requires a copyable error type.");
+
+        if (!has_val)
+        {
+            Detail::expected_throw_bad_access(std::as_const(u.unex));
+        }
+        return u.val;
+    }
+
+    template <class T, class E>
+    constexpr const T&& expected<T, E>::value() const&&
+    {
+        static_assert(std::is_copy_constructible_v<E> && std::is_constructible_v<E, const E&&>,
+            "expected::value requires a copyable error type.");
+
+        if (!has_val)
+        {
+            Detail::expected_throw_bad_access(std::move(u.unex));
+        }
+        return std::move(u.val);
+    }
+
+    template <class T, class E>
+    constexpr T&& expected<T, E>::value() &&
+    {
+        static_assert(std::is_copy_constructible_v<E> && std::is_constructible_v<E, E&&>,
+            "expected::value requires a copyable error type.");
+
+        if (!has_val)
+        {
+            Detail::expected_throw_bad_access(std::move(u.unex));
+        }
+        return std::move(u.val);
+    }
+
+    template <class T, class E>
+    constexpr const E& expected<T, E>::error() const& noexcept
+    {
+        assert(!has_val);
+        return u.unex;
+    }
+
+    template <class T, class E>
+    constexpr E& expected<T, E>::error() & noexcept
+    {
+        assert(!has_val);
+        return u.unex;
+    }
+
+    template <class T, class E>
+    constexpr const E&& expected<T, E>::error() const&& noexcept
+    {
+        assert(!has_val);
+        return std::move(u.unex);
+    }
+
+    template <class T, class E>
+    constexpr E&& expected<T, E>::error() && noexcept
+    {
+        assert(!has_val);
+        return std::move(u.unex);
+    }
+
+    template <class T, class E>
+    template <class U>
+    constexpr T expected<T, E>::value_or(U&& v) const&
+    {
+        static_assert(std::is_copy_constructible_v<T> && std::is_convertible_v<U, T>,
+            "expected::value_or requires a copyable value type that the default converts to.");
+
+        return has_val ? u.val : static_cast<T>(std::forward<U>(v));
+    }
+
+    template <class T, class E>
+    template <class U>
+    constexpr T expected<T, E>::value_or(U&& v) &&
+    {
+        static_assert(std::is_move_constructible_v<T> && std::is_convertible_v<U, T>,
+            "expected::value_or requires a movable value type that the default converts to.");
+
+        return has_val ? std::move(u.val) : static_cast<T>(std::forward<U>(v));
+    }
+
+    template <class T, class E>
+    template <class G>
+    constexpr E expected<T, E>::error_or(G&& e) const&
+    {
+        static_assert(std::is_copy_constructible_v<E> && std::is_convertible_v<G, E>,
+            "expected::error_or requires a copyable error type that the default converts to.");
+
+        return has_val ? static_cast<E>(std::forward<G>(e)) : u.unex;
+    }
+
+    template <class T, class E>
+    template <class G>
+    constexpr E expected<T, E>::error_or(G&& e) &&
+    {
+        static_assert(std::is_move_constructible_v<E> && std::is_convertible_v<G, E>,
+            "expected::error_or requires a movable error type that the default converts to.");
+
+        return has_val ? static_cast<E>(std::forward<G>(e)) : std::move(u.unex);
+    }
+
+    namespace Detail
+    {
+        /**
+         * @brief Checks the mandate of `and_then` that the function returns an `expected` with the same error type.
+         */
+        template <class U, class E>
+        constexpr void expected_check_and_then_result() noexcept
+        {
+            static_assert(is_expected_v<U>, "and_then's function must return an expected.");
+            if constexpr (is_expected_v<U>)
+            {
+                static_assert(StdReimpl::same_as<typename U::error_type, E>, "and_then's function must return an expected with the same error type.");
+            }
+        }
+
+        /**
+         * @brief Checks the mandate of `or_else` that the function returns an `expected` with the same value type.
+         */
+        template <class G, class T>
+        constexpr void expected_check_or_else_result() noexcept
+        {
+            static_assert(is_expected_v<G>, "or_else's function must return an expected.");
+            if constexpr (is_expected_v<G>)
+            {
+                static_assert(StdReimpl::same_as<typename G::value_type, T>, "or_else's function must return an expected with the same value type.");
+            }
+        }
+    }
+
+    template <class T, class E>
+    template <class F>
+        requires std::is_constructible_v<E, E&>
+    constexpr auto expected<T, E>::and_then(F&& f) &
+    {
+        using U = std::remove_cvref_t<std::invoke_result_t<F, T&>>;
+        Detail::expected_check_and_then_result<U, E>();
+
+        if (has_val)
+        {
+            return std::invoke(std::forward<F>(f), u.val);
+        }
+        return U(unexpect, u.unex);
+    }
+
+    template <class T, class E>
+    template <class F>
+        requires std::is_constructible_v<E, E&&>
+    constexpr auto expected<T, E>::and_then(F&& f) &&
+    {
+        using U = std::remove_cvref_t<std::invoke_result_t<F, T&&>>;
+        Detail::expected_check_and_then_result<U, E>();
+
+        if (has_val)
+        {
+            return std::invoke(std::forward<F>(f), std::move(u.val));
+        }
+        return U(unexpect, std::move(u.unex));
+    }
+
+    template <class T, class E>
+    template <class F>
+        requires std::is_constructible_v<E, const E&>
+    constexpr auto expected<T, E>::and_then(F&& f) const&
+    {
+        using U = std::remove_cvref_t<std::invoke_result_t<F, const T&>>;
+        Detail::expected_check_and_then_result<U, E>();
+
+        if (has_val)
+        {
+            return std::invoke(std::forward<F>(f), u.val);
+        }
+        return U(unexpect, u.unex);
+    }
+
+    template <class T, class E>
+    template <class F>
+        requires std::is_constructible_v<E, const E&&>
+    constexpr auto expected<T, E>::and_then(F&& f) const&&
+    {
+        using U = std::remove_cvref_t<std::invoke_result_t<F, const T&&>>;
+        Detail::expected_check_and_then_result<U, E>();
+
+        if (has_val)
+        {
+            return std::invoke(std::forward<F>(f), std::move(u.val));
+        }
+        return U(unexpect, std::move(u.unex));
+    }
+
+    template <class T, class E>
+    template <class F>
+        requires std::is_constructible_v<T, T&>
+    constexpr auto expected<T, E>::or_else(F&& f) &
+    {
+        using G = std::remove_cvref_t<std::invoke_result_t<F, E&>>;
+        Detail::expected_check_or_else_result<G, T>();
+
+        if (has_val)
+        {
+            return G(std::in_place, u.val);
+        }
+        return std::invoke(std::forward<F>(f), u.unex);
+    }
+
+    template <class T, class E>
+    template <class F>
+        requires std::is_constructible_v<T, T&&>
+    constexpr auto expected<T, E>::or_else(F&& f) &&
+    {
+        using G = std::remove_cvref_t<std::invoke_result_t<F, E&&>>;
+        Detail::expected_check_or_else_result<G, T>();
+
+        if (has_val)
+        {
+            return G(std::in_place, std::move(u.val));
+        }
+        return std::invoke(std::forward<F>(f), std::move(u.unex));
+    }
+
+    template <class T, class E>
+    template <class F>
+        requires std::is_constructible_v<T, const T&>
+    constexpr auto expected<T, E>::or_else(F&& f) const&
+    {
+        using G = std::remove_cvref_t<std::invoke_result_t<F, const E&>>;
+        Detail::expected_check_or_else_result<G, T>();
+
+        if (has_val)
+        {
+            return G(std::in_place, u.val);
+        }
+        return std::invoke(std::forward<F>(f), u.unex);
+    }
+
+    template <class T, class E>
+    template <class F>
+        requires std::is_constructible_v<T, const T&&>
+    constexpr auto expected<T, E>::or_else(F&& f) const&&
+    {
+        using G = std::remove_cvref_t<std::invoke_result_t<F, const E&&>>;
+        Detail::expected_check_or_else_result<G, T>();
+
+        if (has_val)
+        {
+            return G(std::in_place, std::move(u.val));
+        }
+        return std::invoke(std::forward<F>(f), std::move(u.unex));
+    }
+
+    template <class T, class E>
+    template <class F>
+        requires std::is_constructible_v<E, E&>
+    constexpr auto expected<T, E>::transform(F&& f) &
+    {
+        using U = std::remove_cv_t<std::invoke_result_t<F, T&>>;
+
+        if (!has_val)
+        {
+            return expected<U, E>(unexpect, u.unex);
+        }
+        if constexpr (std::is_void_v<U>)
+        {
+            std::invoke(std::forward<F>(f), u.val);
+            return expected<U, E>();
+        }
+        else
+        {
+            return expected<U, E>(Detail::expected_invoke_value_t(), std::forward<F>(f), u.val);
+        }
+    }
+
+    template <class T, class E>
+    template <class F>
+        requires std::is_constructible_v<E, E&&>
+    constexpr auto expected<T, E>::transform(F&& f) &&
+    {
+        using U = std::remove_cv_t<std::invoke_result_t<F, T&&>>;
+
+        if (!has_val)
+        {
+            return expected<U, E>(unexpect, std::move(u.unex));
+        }
+        if constexpr (std::is_void_v<U>)
+        {
+            std::invoke(std::forward<F>(f), std::move(u.val));
+            return expected<U, E>();
+        }
+        else
+        {
+            return expected<U, E>(Detail::expected_invoke_value_t(), std::forward<F>(f), std::move(u.val));
+        }
+    }
+
+    template <class T, class E>
+    template <class F>
+        requires std::is_constructible_v<E, const E&>
+    constexpr auto expected<T, E>::transform(F&& f) const&
+    {
+        using U = std::remove_cv_t<std::invoke_result_t<F, const T&>>;
+
+        if (!has_val)
+        {
+            return expected<U, E>(unexpect, u.unex);
+        }
+        if constexpr (std::is_void_v<U>)
+        {
+            std::invoke(std::forward<F>(f), u.val);
+            return expected<U, E>();
+        }
+        else
+        {
+            return expected<U, E>(Detail::expected_invoke_value_t(), std::forward<F>(f), u.val);
+        }
+    }
+
+    template <class T, class E>
+    template <class F>
+        requires std::is_constructible_v<E, const E&&>
+    constexpr auto expected<T, E>::transform(F&& f) const&&
+    {
+        using U = std::remove_cv_t<std::invoke_result_t<F, const T&&>>;
+
+        if (!has_val)
+        {
+            return expected<U, E>(unexpect, std::move(u.unex));
+        }
+        if constexpr (std::is_void_v<U>)
+        {
+            std::invoke(std::forward<F>(f), std::move(u.val));
+            return expected<U, E>();
+        }
+        else
+        {
+            return expected<U, E>(Detail::expected_invoke_value_t(), std::forward<F>(f), std::move(u.val));
+        }
+    }
+
+    template <class T, class E>
+    template <class F>
+        requires std::is_constructible_v<T, T&>
+    constexpr auto expected<T, E>::transform_error(F&& f) &
+    {
+        using G = std::remove_cv_t<std::invoke_result_t<F, E&>>;
+
+        if (has_val)
+        {
+            return expected<T, G>(std::in_place, u.val);
+        }
+        return expected<T, G>(Detail::expected_invoke_error_t(), std::forward<F>(f), u.unex);
+    }
+
+    template <class T, class E>
+    template <class F>
+        requires std::is_constructible_v<T, T&&>
+    constexpr auto expected<T, E>::transform_error(F&& f) &&
+    {
+        using G = std::remove_cv_t<std::invoke_result_t<F, E&&>>;
+
+        if (has_val)
+        {
+            return expected<T, G>(std::in_place, std::move(u.val));
+        }
+        return expected<T, G>(Detail::expected_invoke_error_t(), std::forward<F>(f), std::move(u.unex));
+    }
+
+    template <class T, class E>
+    template <class F>
+        requires std::is_constructible_v<T, const T&>
+    constexpr auto expected<T, E>::transform_error(F&& f) const&
+    {
+        using G = std::remove_cv_t<std::invoke_result_t<F, const E&>>;
+
+        if (has_val)
+        {
+            return expected<T, G>(std::in_place, u.val);
+        }
+        return expected<T, G>(Detail::expected_invoke_error_t(), std::forward<F>(f), u.unex);
+    }
+
+    template <class T, class E>
+    template <class F>
+        requires std::is_constructible_v<T, const T&&>
+    constexpr auto expected<T, E>::transform_error(F&& f) const&&
+    {
+        using G = std::remove_cv_t<std::invoke_result_t<F, const E&&>>;
+
+        if (has_val)
+        {
+            return expected<T, G>(std::in_place, std::move(u.val));
+        }
+        return expected<T, G>(Detail::expected_invoke_error_t(), std::forward<F>(f), std::move(u.unex));
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    constexpr expected<T, E>::expected() noexcept
+    {
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class U, class G>
+        requires Detail::expected_void_can_convert_v<E, U, G, const G&>
+    constexpr expected<T, E>::expected(const expected<U, G>& rhs)
+    {
+        if (!rhs.has_value())
+        {
+            storage.ConstructError(rhs.error());
+        }
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class U, class G>
+        requires Detail::expected_void_can_convert_v<E, U, G, G>
+    constexpr expected<T, E>::expected(expected<U, G>&& rhs)
+    {
+        if (!rhs.has_value())
+        {
+            storage.ConstructError(std::move(rhs).error());
+        }
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class G>
+        requires std::is_constructible_v<E, const G&>
+    constexpr expected<T, E>::expected(const unexpected<G>& e)
+        : storage(unexpect, e.error())
+    {
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class G>
+        requires std::is_constructible_v<E, G>
+    constexpr expected<T, E>::expected(unexpected<G>&& e)
+        : storage(unexpect, std::move(e).error())
+    {
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    constexpr expected<T, E>::expected(std::in_place_t) noexcept
+    {
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class... Args>
+        requires std::is_constructible_v<E, Args...>
+    constexpr expected<T, E>::expected(unexpect_t, Args&&... args)
+        : storage(unexpect, std::forward<Args>(args)...)
+    {
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class U, class... Args>
+        requires std::is_constructible_v<E, std::initializer_list<U>&, Args...>
+    constexpr expected<T, E>::expected(unexpect_t, std::initializer_list<U> il, Args&&... args)
+        : storage(unexpect, il, std::forward<Args>(args)...)
+    {
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F, class... Args>
+    constexpr expected<T, E>::expected(Detail::expected_invoke_error_t tag, F&& f, Args&&... args)
+        : storage(tag, std::forward<F>(f), std::forward<Args>(args)...)
+    {
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    constexpr expected<T, E>& expected<T, E>::operator=(const expected& rhs)
+        requires Detail::expected_copy_assignable<E>
+    {
+        if (has_value() && !rhs.has_value())
+        {
+            storage.ConstructError(rhs.error());
+        }
+        else if (!has_value() && rhs.has_value())
+        {
+            storage.DestroyError();
+        }
+        else if (!has_value())
+        {
+            storage.Error() = rhs.error();
+        }
+        return *this;
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    constexpr expected<T, E>& expected<T, E>::operator=(expected&& rhs) noexcept(std::is_nothrow_move_constructible_v<E> && std::is_nothrow_move_assignable_v<E>)
+        requires Detail::expected_move_assignable<E>
+    {
+        if (has_value() && !rhs.has_value())
+        {
+            storage.ConstructError(std::move(rhs).error());
+        }
+        else if (!has_value() && rhs.has_value())
+        {
+            storage.DestroyError();
+        }
+        else if (!has_value())
+        {
+            storage.Error() = std::move(rhs).error();
+        }
+        return *this;
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class G>
+        requires (std::is_constructible_v<E, const G&> && std::is_assignable_v<E&, const G&>)
+    constexpr expected<T, E>& expected<T, E>::operator=(const unexpected<G>& e)
+    {
+        if (has_value())
+        {
+            storage.ConstructError(e.error());
+        }
+        else
+        {
+            storage.Error() = e.error();
+        }
+        return *this;
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class G>
+        requires (std::is_constructible_v<E, G> && std::is_assignable_v<E&, G>)
+    constexpr expected<T, E>& expected<T, E>::operator=(unexpected<G>&& e)
+    {
+        if (has_value())
+        {
+            storage.ConstructError(std::move(e).error());
+        }
+        else
+        {
+            storage.Error() = std::move(e).error();
+        }
+        return *this;
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    constexpr void expected<T, E>::emplace() noexcept
+    {
+        if (!has_value())
+        {
+            storage.DestroyError();
+        }
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    constexpr void expected<T, E>::swap(expected& rhs) noexcept(std::is_nothrow_move_constructible_v<E> && std::is_nothrow_swappable_v<E>)
+        requires (std::is_swappable_v<E> && std::is_move_constructible_v<E>)
+    {
+        if (!has_value() && !rhs.has_value())
+        {
+            using std::swap;
+            swap(storage.Error(), rhs.storage.Error());
+        }
+        else if (!has_value())
+        {
+            rhs.swap(*this);
+        }
+        else if (!rhs.has_value())
+        {
+            storage.ConstructError(std::move(rhs.storage.Error()));
+            rhs.storage.DestroyError();
+        }
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    constexpr expected<T, E>::operator bool() const noexcept
+    {
+        return storage.HasValue();
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    constexpr bool expected<T, E>::has_value() const noexcept
+    {
+        return storage.HasValue();
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    constexpr void expected<T, E>::operator*() const noexcept
+    {
+        assert(has_value());
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    constexpr void expected<T, E>::value() const&
+    {
+        static_assert(std::is_copy_constructible_v<E>, "expected::value requires a copyable error type.");
+
+        if (!has_value())
+        {
+            Detail::expected_throw_bad_access(storage.Error());
+        }
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    constexpr void expected<T, E>::value() &&
+    {
+        static_assert(std::is_copy_constructible_v<E> && std::is_move_constructible_v<E>,
+            "expected::value requires a copyable error type.");
+
+        if (!has_value())
+        {
+            Detail::expected_throw_bad_access(std::move(storage.Error()));
+        }
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    constexpr const E& expected<T, E>::error() const& noexcept
+    {
+        assert(!has_value());
+        return storage.Error();
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    constexpr E& expected<T, E>::error() & noexcept
+    {
+        assert(!has_value());
+        return storage.Error();
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    constexpr const E&& expected<T, E>::error() const&& noexcept
+    {
+        assert(!has_value());
+        return std::move(storage.Error());
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    constexpr E&& expected<T, E>::error() && noexcept
+    {
+        assert(!has_value());
+        return std::move(storage.Error());
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class G>
+    constexpr E expected<T, E>::error_or(G&& e) const&
+    {
+        static_assert(std::is_copy_constructible_v<E> && std::is_convertible_v<G, E>,
+            "expected::error_or requires a copyable error type that the default converts to.");
+
+        return has_value() ? static_cast<E>(std::forward<G>(e)) : storage.Error();
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class G>
+    constexpr E expected<T, E>::error_or(G&& e) &&
+    {
+        static_assert(std::is_move_constructible_v<E> && std::is_convertible_v<G, E>,
+            "expected::error_or requires a movable error type that the default converts to.");
+
+        return has_value() ? static_cast<E>(std::forward<G>(e)) : std::move(storage.Error());
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F>
+        requires std::is_constructible_v<E, E&>
+    constexpr auto expected<T, E>::and_then(F&& f) &
+    {
+        using U = std::remove_cvref_t<std::invoke_result_t<F>>;
+        Detail::expected_check_and_then_result<U, E>();
+
+        if (has_value())
+        {
+            return std::invoke(std::forward<F>(f));
+        }
+        return U(unexpect, storage.Error());
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F>
+        requires std::is_constructible_v<E, E&&>
+    constexpr auto expected<T, E>::and_then(F&& f) &&
+    {
+        using U = std::remove_cvref_t<std::invoke_result_t<F>>;
+        Detail::expected_check_and_then_result<U, E>();
+
+        if (has_value())
+        {
+            return std::invoke(std::forward<F>(f));
+        }
+        return U(unexpect, std::move(storage.Error()));
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F>
+        requires std::is_constructible_v<E, const E&>
+    constexpr auto expected<T, E>::and_then(F&& f) const&
+    {
+        using U = std::remove_cvref_t<std::invoke_result_t<F>>;
+        Detail::expected_check_and_then_result<U, E>();
+
+        if (has_value())
+        {
+            return std::invoke(std::forward<F>(f));
+        }
+        return U(unexpect, storage.Error());
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F>
+        requires std::is_constructible_v<E, const E&&>
+    constexpr auto expected<T, E>::and_then(F&& f) const&&
+    {
+        using U = std::remove_cvref_t<std::invoke_result_t<F>>;
+        Detail::expected_check_and_then_result<U, E>();
+
+        if (has_value())
+        {
+            return std::invoke(std::forward<F>(f));
+        }
+        return U(unexpect, std::move(storage.Error()));
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F>
+    constexpr auto expected<T, E>::or_else(F&& f) &
+    {
+        using G = std::remove_cvref_t<std::invoke_result_t<F, E&>>;
+        Detail::expected_check_or_else_result<G, T>();
+
+        if (has_value())
+        {
+            return G();
+        }
+        return std::invoke(std::forward<F>(f), storage.Error());
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F>
+    constexpr auto expected<T, E>::or_else(F&& f) &&
+    {
+        using G = std::remove_cvref_t<std::invoke_result_t<F, E&&>>;
+        Detail::expected_check_or_else_result<G, T>();
+
+        if (has_value())
+        {
+            return G();
+        }
+        return std::invoke(std::forward<F>(f), std::move(storage.Error()));
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F>
+    constexpr auto expected<T, E>::or_else(F&& f) const&
+    {
+        using G = std::remove_cvref_t<std::invoke_result_t<F, const E&>>;
+        Detail::expected_check_or_else_result<G, T>();
+
+        if (has_value())
+        {
+            return G();
+        }
+        return std::invoke(std::forward<F>(f), storage.Error());
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F>
+    constexpr auto expected<T, E>::or_else(F&& f) const&&
+    {
+        using G = std::remove_cvref_t<std::invoke_result_t<F, const E&&>>;
+        Detail::expected_check_or_else_result<G, T>();
+
+        if (has_value())
+        {
+            return G();
+        }
+        return std::invoke(std::forward<F>(f), std::move(storage.Error()));
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F>
+        requires std::is_constructible_v<E, E&>
+    constexpr auto expected<T, E>::transform(F&& f) &
+    {
+        using U = std::remove_cv_t<std::invoke_result_t<F>>;
+
+        if (!has_value())
+        {
+            return expected<U, E>(unexpect, storage.Error());
+        }
+        if constexpr (std::is_void_v<U>)
+        {
+            std::invoke(std::forward<F>(f));
+            return expected<U, E>();
+        }
+        else
+        {
+            return expected<U, E>(Detail::expected_invoke_value_t(), std::forward<F>(f));
+        }
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F>
+        requires std::is_constructible_v<E, E&&>
+    constexpr auto expected<T, E>::transform(F&& f) &&
+    {
+        using U = std::remove_cv_t<std::invoke_result_t<F>>;
+
+        if (!has_value())
+        {
+            return expected<U, E>(unexpect, std::move(storage.Error()));
+        }
+        if constexpr (std::is_void_v<U>)
+        {
+            std::invoke(std::forward<F>(f));
+            return expected<U, E>();
+        }
+        else
+        {
+            return expected<U, E>(Detail::expected_invoke_value_t(), std::forward<F>(f));
+        }
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F>
+        requires std::is_constructible_v<E, const E&>
+    constexpr auto expected<T, E>::transform(F&& f) const&
+    {
+        using U = std::remove_cv_t<std::invoke_result_t<F>>;
+
+        if (!has_value())
+        {
+            return expected<U, E>(unexpect, storage.Error());
+        }
+        if constexpr (std::is_void_v<U>)
+        {
+            std::invoke(std::forward<F>(f));
+            return expected<U, E>();
+        }
+        else
+        {
+            return expected<U, E>(Detail::expected_invoke_value_t(), std::forward<F>(f));
+        }
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F>
+        requires std::is_constructible_v<E, const E&&>
+    constexpr auto expected<T, E>::transform(F&& f) const&&
+    {
+        using U = std::remove_cv_t<std::invoke_result_t<F>>;
+
+        if (!has_value())
+        {
+            return expected<U, E>(unexpect, std::move(storage.Error()));
+        }
+        if constexpr (std::is_void_v<U>)
+        {
+            std::invoke(std::forward<F>(f));
+            return expected<U, E>();
+        }
+        else
+        {
+            return expected<U, E>(Detail::expected_invoke_value_t(), std::forward<F>(f));
+        }
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F>
+    constexpr auto expected<T, E>::transform_error(F&& f) &
+    {
+        using G = std::remove_cv_t<std::invoke_result_t<F, E&>>;
+
+        if (has_value())
+        {
+            return expected<T, G>();
+        }
+        return expected<T, G>(Detail::expected_invoke_error_t(), std::forward<F>(f), storage.Error());
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F>
+    constexpr auto expected<T, E>::transform_error(F&& f) &&
+    {
+        using G = std::remove_cv_t<std::invoke_result_t<F, E&&>>;
+
+        if (has_value())
+        {
+            return expected<T, G>();
+        }
+        return expected<T, G>(Detail::expected_invoke_error_t(), std::forward<F>(f), std::move(storage.Error()));
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F>
+    constexpr auto expected<T, E>::transform_error(F&& f) const&
+    {
+        using G = std::remove_cv_t<std::invoke_result_t<F, const E&>>;
+
+        if (has_value())
+        {
+            return expected<T, G>();
+        }
+        return expected<T, G>(Detail::expected_invoke_error_t(), std::forward<F>(f), storage.Error());
+    }
+
+    template <class T, class E>
+        requires std::is_void_v<T>
+    template <class F>
+    constexpr auto expected<T, E>::transform_error(F&& f) const&&
+    {
+        using G = std::remove_cv_t<std::invoke_result_t<F, const E&&>>;
+
+        if (has_value())
+        {
+            return expected<T, G>();
+        }
+        return expected<T, G>(Detail::expected_invoke_error_t(), std::forward<F>(f), std::move(storage.Error()));
+    }
+}
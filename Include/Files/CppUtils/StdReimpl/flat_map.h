@@ -0,0 +1,654 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/flat_tree.h>
+#include <CppUtils/StdReimpl/utility.h>
+
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        /**
+         * @see https://eel.is/c++draft/flat.map.defn#lib:iter-key-type
+         */
+        template <class InputIterator>
+        using iter_key_t = std::remove_const_t<typename std::iterator_traits<InputIterator>::value_type::first_type>;
+
+        template <class InputIterator>
+        using iter_mapped_t = typename std::iterator_traits<InputIterator>::value_type::second_type;
+
+        /**
+         * @brief Thrown by `flat_map::at`. Aborts instead when exceptions are disabled.
+         */
+        [[noreturn]] inline void flat_map_throw_out_of_range();
+
+        /**
+         * @brief The iterator of the flat maps. It walks the key and mapped containers side by side, and dereferences to a
+         *        pair of references into them.
+         *
+         *        Since dereferencing makes a pair rather than returning a reference, this is a random access iterator to
+         *        the C++20 iterator concepts, but only an input iterator to the classic requirements, as the standard says.
+         */
+        template <class KeyIterator, class MappedIterator>
+        class flat_map_iterator
+        {
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::pair<std::iter_value_t<KeyIterator>, std::iter_value_t<MappedIterator>>;
+            using reference = std::pair<std::iter_reference_t<KeyIterator>, std::iter_reference_t<MappedIterator>>;
+            using difference_type = std::ptrdiff_t;
+
+            /**
+             * @brief Keeps the pair that `operator->` points to alive until the end of the full expression.
+             */
+            struct pointer
+            {
+                reference value;
+
+                reference* operator->() noexcept
+                {
+                    return std::addressof(value);
+                }
+            };
+
+            flat_map_iterator() = default;
+
+            flat_map_iterator(KeyIterator inKeyIterator, MappedIterator inMappedIterator)
+                : key_iterator(inKeyIterator)
+                , mapped_iterator(inMappedIterator)
+            {
+            }
+
+            /**
+             * @brief Converts an `iterator` to a `const_iterator`.
+             */
+            template <class OtherMappedIterator>
+                requires (!std::is_same_v<OtherMappedIterator, MappedIterator> && std::is_convertible_v<OtherMappedIterator, MappedIterator>)
+            flat_map_iterator(flat_map_iterator<KeyIterator, OtherMappedIterator> other)
+                : key_iterator(other.key_iterator)
+                , mapped_iterator(other.mapped_iterator)
+            {
+            }
+
+            reference operator*() const
+            {
+                return reference(*key_iterator, *mapped_iterator);
+            }
+
+            pointer operator->() const
+            {
+                return pointer{**this};
+            }
+
+            reference operator[](difference_type n) const
+            {
+                return *(*this + n);
+            }
+
+            flat_map_iterator& operator++()
+            {
+                ++key_iterator;
+                ++mapped_iterator;
+                return *this;
+            }
+
+            flat_map_iterator operator++(int)
+            {
+                flat_map_iterator result = *this;
+                ++*this;
+                return result;
+            }
+
+            flat_map_iterator& operator--()
+            {
+                --key_iterator;
+                --mapped_iterator;
+                return *this;
+            }
+
+            flat_map_iterator operator--(int)
+            {
+                flat_map_iterator result = *this;
+                --*this;
+                return result;
+            }
+
+            flat_map_iterator& operator+=(difference_type n)
+            {
+                key_iterator += n;
+                mapped_iterator += n;
+                return *this;
+            }
+
+            flat_map_iterator& operator-=(difference_type n)
+            {
+                return *this += -n;
+            }
+
+            friend flat_map_iterator operator+(flat_map_iterator it, difference_type n)
+            {
+                return it += n;
+            }
+
+            friend flat_map_iterator operator+(difference_type n, flat_map_iterator it)
+            {
+                return it += n;
+            }
+
+            friend flat_map_iterator operator-(flat_map_iterator it, difference_type n)
+            {
+                return it -= n;
+            }
+
+            friend difference_type operator-(const flat_map_iterator& x, const flat_map_iterator& y)
+            {
+                return static_cast<difference_type>(x.key_iterator - y.key_iterator);
+            }
+
+            friend bool operator==(const flat_map_iterator& x, const flat_map_iterator& y)
+            {
+                return x.key_iterator == y.key_iterator;
+            }
+
+            friend auto operator<=>(const flat_map_iterator& x, const flat_map_iterator& y)
+            {
+                return x.key_iterator <=> y.key_iterator;
+            }
+
+        private:
+            template <class, class>
+            friend class flat_map_iterator;
+
+            KeyIterator key_iterator{};
+            MappedIterator mapped_iterator{};
+        };
+
+        /**
+         * @brief Everything `flat_map` and `flat_multimap` have in common, which is all of it but their names and their
+         *        comparisons. `Multi` picks between the two: whether equivalent keys are allowed, which sorted tag the
+         *        constructors take, and what `insert` and `emplace` return.
+         */
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        class flat_map_base
+        {
+            static_assert(std::is_same_v<Key, typename KeyContainer::value_type>, "KeyContainer must hold Key.");
+            static_assert(std::is_same_v<T, typename MappedContainer::value_type>, "MappedContainer must hold T.");
+            static_assert(std::random_access_iterator<typename KeyContainer::iterator>, "KeyContainer must be random access.");
+            static_assert(std::random_access_iterator<typename MappedContainer::iterator>, "MappedContainer must be random access.");
+
+            using sorted_tag_type = std::conditional_t<Multi, StdReimpl::sorted_equivalent_t, StdReimpl::sorted_unique_t>;
+
+        public:
+            using key_type = Key;
+            using mapped_type = T;
+            using value_type = std::pair<key_type, mapped_type>;
+            using key_compare = Compare;
+            using reference = std::pair<const key_type&, mapped_type&>;
+            using const_reference = std::pair<const key_type&, const mapped_type&>;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using iterator = Detail::flat_map_iterator<typename KeyContainer::const_iterator, typename MappedContainer::iterator>;
+            using const_iterator = Detail::flat_map_iterator<typename KeyContainer::const_iterator, typename MappedContainer::const_iterator>;
+            using reverse_iterator = std::reverse_iterator<iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+            using key_container_type = KeyContainer;
+            using mapped_container_type = MappedContainer;
+
+            /**
+             * @see https://eel.is/c++draft/flat.map.defn
+             */
+            class value_compare
+            {
+            public:
+                bool operator()(const_reference x, const_reference y) const
+                {
+                    return comp(x.first, y.first);
+                }
+
+            private:
+                friend flat_map_base;
+
+                explicit value_compare(key_compare inComp)
+                    : comp(inComp)
+                {
+                }
+
+                key_compare comp;
+            };
+
+            struct containers
+            {
+                key_container_type keys;
+                mapped_container_type values;
+            };
+
+        private:
+            using insert_result_type = std::conditional_t<Multi, iterator, std::pair<iterator, bool>>;
+
+        public:
+            // Construct/copy/destroy.
+
+            flat_map_base();
+            explicit flat_map_base(const key_compare& comp);
+
+            /**
+             * @brief Sorts the containers by key, dropping all but the first of equivalent keys for a `flat_map`. They must
+             *        be the same size.
+             */
+            flat_map_base(key_container_type keyCont, mapped_container_type mappedCont, const key_compare& comp = key_compare());
+
+            /**
+             * @brief Takes the containers as they are. They must already be sorted by key (and unique for a `flat_map`).
+             */
+            flat_map_base(sorted_tag_type, key_container_type keyCont, mapped_container_type mappedCont, const key_compare& comp = key_compare());
+
+            template <std::input_iterator InputIterator>
+            flat_map_base(InputIterator first, InputIterator last, const key_compare& comp = key_compare());
+            template <std::input_iterator InputIterator>
+            flat_map_base(sorted_tag_type, InputIterator first, InputIterator last, const key_compare& comp = key_compare());
+
+            flat_map_base(std::initializer_list<value_type> il, const key_compare& comp = key_compare());
+            flat_map_base(sorted_tag_type, std::initializer_list<value_type> il, const key_compare& comp = key_compare());
+
+            // Iterators.
+
+            iterator begin() noexcept;
+            const_iterator begin() const noexcept;
+            iterator end() noexcept;
+            const_iterator end() const noexcept;
+            reverse_iterator rbegin() noexcept;
+            const_reverse_iterator rbegin() const noexcept;
+            reverse_iterator rend() noexcept;
+            const_reverse_iterator rend() const noexcept;
+
+            const_iterator cbegin() const noexcept;
+            const_iterator cend() const noexcept;
+            const_reverse_iterator crbegin() const noexcept;
+            const_reverse_iterator crend() const noexcept;
+
+            // Capacity.
+
+            [[nodiscard]] bool empty() const noexcept;
+            size_type size() const noexcept;
+            size_type max_size() const noexcept;
+
+            // Element access.
+
+            mapped_type& operator[](const key_type& x) requires (!Multi);
+            mapped_type& operator[](key_type&& x) requires (!Multi);
+            template <class K>
+                requires (!Multi && Detail::transparent_compare<Compare> && std::is_constructible_v<key_type, K>)
+            mapped_type& operator[](K&& x);
+
+            mapped_type& at(const key_type& x) requires (!Multi);
+            const mapped_type& at(const key_type& x) const requires (!Multi);
+            template <class K>
+                requires (!Multi && Detail::transparent_compare<Compare>)
+            mapped_type& at(const K& x);
+            template <class K>
+                requires (!Multi && Detail::transparent_compare<Compare>)
+            const mapped_type& at(const K& x) const;
+
+            // Modifiers.
+
+            template <class... Args>
+            insert_result_type emplace(Args&&... args);
+            template <class... Args>
+            iterator emplace_hint(const_iterator position, Args&&... args);
+
+            insert_result_type insert(const value_type& x);
+            insert_result_type insert(value_type&& x);
+            template <class P>
+                requires (std::is_constructible_v<std::pair<key_type, mapped_type>, P>)
+            insert_result_type insert(P&& x);
+            iterator insert(const_iterator position, const value_type& x);
+            iterator insert(const_iterator position, value_type&& x);
+            template <class P>
+                requires (std::is_constructible_v<std::pair<key_type, mapped_type>, P>)
+            iterator insert(const_iterator position, P&& x);
+
+            /**
+             * @brief Appends the elements, then sorts and merges them in at once. That's linear in `size()` plus
+             *        `N log N` in the number of new elements, rather than a shift per element.
+             */
+            template <std::input_iterator InputIterator>
+            void insert(InputIterator first, InputIterator last);
+
+            /**
+             * @brief Like the above, but the elements must already be sorted (and unique for a `flat_map`), so they're
+             *        only merged in.
+             */
+            template <std::input_iterator InputIterator>
+            void insert(sorted_tag_type, InputIterator first, InputIterator last);
+
+            template <Detail::container_compatible_range<value_type> R>
+            void insert_range(R&& rg);
+
+            void insert(std::initializer_list<value_type> il);
+            void insert(sorted_tag_type s, std::initializer_list<value_type> il);
+
+            containers extract() &&;
+            void replace(key_container_type&& keyCont, mapped_container_type&& mappedCont);
+
+            template <class... Args>
+                requires (!Multi && std::is_constructible_v<mapped_type, Args...>)
+            std::pair<iterator, bool> try_emplace(const key_type& k, Args&&... args);
+            template <class... Args>
+                requires (!Multi && std::is_constructible_v<mapped_type, Args...>)
+            std::pair<iterator, bool> try_emplace(key_type&& k, Args&&... args);
+            template <class K, class... Args>
+                requires (!Multi && Detail::transparent_compare<Compare> && std::is_constructible_v<key_type, K> &&
+                    std::is_constructible_v<mapped_type, Args...> && !std::is_convertible_v<K&&, const_iterator> &&
+                    !std::is_convertible_v<K&&, iterator>)
+            std::pair<iterator, bool> try_emplace(K&& k, Args&&... args);
+            template <class... Args>
+                requires (!Multi && std::is_constructible_v<mapped_type, Args...>)
+            iterator try_emplace(const_iterator hint, const key_type& k, Args&&... args);
+            template <class... Args>
+                requires (!Multi && std::is_constructible_v<mapped_type, Args...>)
+            iterator try_emplace(const_iterator hint, key_type&& k, Args&&... args);
+            template <class K, class... Args>
+                requires (!Multi && Detail::transparent_compare<Compare> && std::is_constructible_v<key_type, K> &&
+                    std::is_constructible_v<mapped_type, Args...>)
+            iterator try_emplace(const_iterator hint, K&& k, Args&&... args);
+
+            template <class M>
+                requires (!Multi && std::is_assignable_v<mapped_type&, M> && std::is_constructible_v<mapped_type, M>)
+            std::pair<iterator, bool> insert_or_assign(const key_type& k, M&& obj);
+            template <class M>
+                requires (!Multi && std::is_assignable_v<mapped_type&, M> && std::is_constructible_v<mapped_type, M>)
+            std::pair<iterator, bool> insert_or_assign(key_type&& k, M&& obj);
+            template <class K, class M>
+                requires (!Multi && Detail::transparent_compare<Compare> && std::is_constructible_v<key_type, K> &&
+                    std::is_assignable_v<mapped_type&, M> && std::is_constructible_v<mapped_type, M>)
+            std::pair<iterator, bool> insert_or_assign(K&& k, M&& obj);
+            template <class M>
+                requires (!Multi && std::is_assignable_v<mapped_type&, M> && std::is_constructible_v<mapped_type, M>)
+            iterator insert_or_assign(const_iterator hint, const key_type& k, M&& obj);
+            template <class M>
+                requires (!Multi && std::is_assignable_v<mapped_type&, M> && std::is_constructible_v<mapped_type, M>)
+            iterator insert_or_assign(const_iterator hint, key_type&& k, M&& obj);
+            template <class K, class M>
+                requires (!Multi && Detail::transparent_compare<Compare> && std::is_constructible_v<key_type, K> &&
+                    std::is_assignable_v<mapped_type&, M> && std::is_constructible_v<mapped_type, M>)
+            iterator insert_or_assign(const_iterator hint, K&& k, M&& obj);
+
+            iterator erase(iterator position);
+            iterator erase(const_iterator position);
+            size_type erase(const key_type& x);
+            template <class K>
+                requires (Detail::transparent_compare<Compare> && !std::is_convertible_v<K&&, iterator> &&
+                    !std::is_convertible_v<K&&, const_iterator>)
+            size_type erase(K&& x);
+            iterator erase(const_iterator first, const_iterator last);
+
+            void swap(flat_map_base& y) noexcept;
+            void clear() noexcept;
+
+            // Observers.
+
+            key_compare key_comp() const;
+            value_compare value_comp() const;
+            const key_container_type& keys() const noexcept;
+            const mapped_container_type& values() const noexcept;
+
+            // Map operations.
+
+            iterator find(const key_type& x);
+            const_iterator find(const key_type& x) const;
+            template <class K>
+                requires (Detail::transparent_compare<Compare>)
+            iterator find(const K& x);
+            template <class K>
+                requires (Detail::transparent_compare<Compare>)
+            const_iterator find(const K& x) const;
+
+            size_type count(const key_type& x) const;
+            template <class K>
+                requires (Detail::transparent_compare<Compare>)
+            size_type count(const K& x) const;
+
+            bool contains(const key_type& x) const;
+            template <class K>
+                requires (Detail::transparent_compare<Compare>)
+            bool contains(const K& x) const;
+
+            iterator lower_bound(const key_type& x);
+            const_iterator lower_bound(const key_type& x) const;
+            template <class K>
+                requires (Detail::transparent_compare<Compare>)
+            iterator lower_bound(const K& x);
+            template <class K>
+                requires (Detail::transparent_compare<Compare>)
+            const_iterator lower_bound(const K& x) const;
+
+            iterator upper_bound(const key_type& x);
+            const_iterator upper_bound(const key_type& x) const;
+            template <class K>
+                requires (Detail::transparent_compare<Compare>)
+            iterator upper_bound(const K& x);
+            template <class K>
+                requires (Detail::transparent_compare<Compare>)
+            const_iterator upper_bound(const K& x) const;
+
+            std::pair<iterator, iterator> equal_range(const key_type& x);
+            std::pair<const_iterator, const_iterator> equal_range(const key_type& x) const;
+            template <class K>
+                requires (Detail::transparent_compare<Compare>)
+            std::pair<iterator, iterator> equal_range(const K& x);
+            template <class K>
+                requires (Detail::transparent_compare<Compare>)
+            std::pair<const_iterator, const_iterator> equal_range(const K& x) const;
+
+        protected:
+            bool Equals(const flat_map_base& other) const;
+            auto Compare3Way(const flat_map_base& other) const;
+
+        private:
+            iterator IteratorAt(size_type i) noexcept;
+            const_iterator IteratorAt(size_type i) const noexcept;
+            size_type IndexOf(const_iterator position) const noexcept;
+
+            template <class K>
+            size_type LowerBoundIndex(const K& x) const;
+            template <class K>
+            size_type UpperBoundIndex(const K& x) const;
+
+            /**
+             * @brief The index of the first element with a key equivalent to `x`, or `size()` if there's none.
+             */
+            template <class K>
+            size_type FindIndex(const K& x) const;
+
+            template <class K>
+            std::pair<size_type, size_type> EqualRangeIndices(const K& x) const;
+
+            /**
+             * @brief Where a `flat_multimap` inserts `x` given the hint: at the hint if `x` belongs there, and otherwise as
+             *        close to it as the order allows.
+             */
+            template <class K>
+            size_type MultiHintIndex(const_iterator hint, const K& x) const;
+
+            /**
+             * @brief Inserts the key constructed from `key` at `i` in the keys, and the value constructed from `args` at `i`
+             *        in the values.
+             */
+            template <class KeyArg, class... Args>
+            void InsertAt(size_type i, KeyArg&& key, Args&&... args);
+
+            template <class KeyArg, class... Args>
+            std::pair<size_type, bool> TryEmplaceIndex(KeyArg&& key, Args&&... args);
+
+            template <class KeyArg, class... Args>
+            size_type TryEmplaceHintIndex(const_iterator hint, KeyArg&& key, Args&&... args);
+
+            template <class InputIterator, class Sentinel>
+            void InsertRange(InputIterator first, Sentinel last, bool isSorted);
+
+            void EraseIndices(size_type first, size_type last);
+
+            containers c;
+            key_compare compare;
+            Detail::flat_tree_index<key_type, key_compare, SearchMode> index;
+        };
+    }
+
+    /**
+     * @brief A sorted associative container with unique keys, stored as a sorted container of keys next to a container of
+     *        values, rather than as nodes. Lookups only touch the keys, which are contiguous, so they stay in cache and
+     *        avoid `std::map`'s pointer chasing. In return, insertion and erasure shift the elements after them.
+     *
+     *        Lookups use a branchless binary search, and a SIMD linear scan for small tables of arithmetic keys. Set
+     *        `SearchMode` to `flat_search_mode::eytzinger` for tables that are built once and then read a lot.
+     * @see https://eel.is/c++draft/flat.map
+     * @see https://cppreference.com/w/cpp/container/flat_map
+     * @note A feature from the C++23 standard. The constructors that take allocators or `from_range_t` are left out.
+     *       `SearchMode` is not part of the standard.
+     */
+    template <class Key, class T, class Compare = std::less<Key>, class KeyContainer = std::vector<Key>,
+        class MappedContainer = std::vector<T>, flat_search_mode SearchMode = flat_search_mode::binary>
+    class flat_map : public Detail::flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, false>
+    {
+        using base_type = Detail::flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, false>;
+
+    public:
+        using base_type::base_type;
+
+        // Declared here rather than inherited, since deducing the template arguments from a braced list only considers
+        // the class's own initializer-list constructors.
+        flat_map() = default;
+        flat_map(std::initializer_list<typename base_type::value_type> il, const typename base_type::key_compare& comp = typename base_type::key_compare());
+
+        flat_map& operator=(std::initializer_list<typename base_type::value_type> il);
+
+        friend bool operator==(const flat_map& x, const flat_map& y)
+        {
+            return x.Equals(y);
+        }
+
+        friend auto operator<=>(const flat_map& x, const flat_map& y)
+        {
+            return x.Compare3Way(y);
+        }
+
+        friend void swap(flat_map& x, flat_map& y) noexcept
+        {
+            x.swap(y);
+        }
+    };
+
+    /**
+     * @brief A `flat_map` that allows equivalent keys. Equivalent keys keep the order that they were inserted in.
+     * @see https://eel.is/c++draft/flat.multimap
+     * @see https://cppreference.com/w/cpp/container/flat_multimap
+     * @note A feature from the C++23 standard. The constructors that take allocators or `from_range_t` are left out.
+     *       `SearchMode` is not part of the standard.
+     */
+    template <class Key, class T, class Compare = std::less<Key>, class KeyContainer = std::vector<Key>,
+        class MappedContainer = std::vector<T>, flat_search_mode SearchMode = flat_search_mode::binary>
+    class flat_multimap : public Detail::flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, true>
+    {
+        using base_type = Detail::flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, true>;
+
+    public:
+        using base_type::base_type;
+
+        // Declared here rather than inherited, since deducing the template arguments from a braced list only considers
+        // the class's own initializer-list constructors.
+        flat_multimap() = default;
+        flat_multimap(std::initializer_list<typename base_type::value_type> il, const typename base_type::key_compare& comp = typename base_type::key_compare());
+
+        flat_multimap& operator=(std::initializer_list<typename base_type::value_type> il);
+
+        friend bool operator==(const flat_multimap& x, const flat_multimap& y)
+        {
+            return x.Equals(y);
+        }
+
+        friend auto operator<=>(const flat_multimap& x, const flat_multimap& y)
+        {
+            return x.Compare3Way(y);
+        }
+
+        friend void swap(flat_multimap& x, flat_multimap& y) noexcept
+        {
+            x.swap(y);
+        }
+    };
+
+    /**
+     * @see https://eel.is/c++draft/flat.map.erasure
+     */
+    template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, class Predicate>
+    typename flat_map<Key, T, Compare, KeyContainer, MappedContainer, SearchMode>::size_type
+        erase_if(flat_map<Key, T, Compare, KeyContainer, MappedContainer, SearchMode>& c, Predicate pred);
+
+    /**
+     * @see https://eel.is/c++draft/flat.multimap.erasure
+     */
+    template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, class Predicate>
+    typename flat_multimap<Key, T, Compare, KeyContainer, MappedContainer, SearchMode>::size_type
+        erase_if(flat_multimap<Key, T, Compare, KeyContainer, MappedContainer, SearchMode>& c, Predicate pred);
+
+    // Deduction guides. Since most of the constructors are inherited, they have no implicit guides.
+
+    template <class KeyContainer, class MappedContainer, class Compare = std::less<typename KeyContainer::value_type>>
+    flat_map(KeyContainer, MappedContainer, Compare = Compare())
+        -> flat_map<typename KeyContainer::value_type, typename MappedContainer::value_type, Compare, KeyContainer, MappedContainer>;
+
+    template <class KeyContainer, class MappedContainer, class Compare = std::less<typename KeyContainer::value_type>>
+    flat_map(sorted_unique_t, KeyContainer, MappedContainer, Compare = Compare())
+        -> flat_map<typename KeyContainer::value_type, typename MappedContainer::value_type, Compare, KeyContainer, MappedContainer>;
+
+    template <std::input_iterator InputIterator, class Compare = std::less<Detail::iter_key_t<InputIterator>>>
+    flat_map(InputIterator, InputIterator, Compare = Compare())
+        -> flat_map<Detail::iter_key_t<InputIterator>, Detail::iter_mapped_t<InputIterator>, Compare>;
+
+    template <std::input_iterator InputIterator, class Compare = std::less<Detail::iter_key_t<InputIterator>>>
+    flat_map(sorted_unique_t, InputIterator, InputIterator, Compare = Compare())
+        -> flat_map<Detail::iter_key_t<InputIterator>, Detail::iter_mapped_t<InputIterator>, Compare>;
+
+    template <class Key, class T, class Compare = std::less<Key>>
+    flat_map(std::initializer_list<std::pair<Key, T>>, Compare = Compare()) -> flat_map<Key, T, Compare>;
+
+    template <class Key, class T, class Compare = std::less<Key>>
+    flat_map(sorted_unique_t, std::initializer_list<std::pair<Key, T>>, Compare = Compare()) -> flat_map<Key, T, Compare>;
+
+    template <class KeyContainer, class MappedContainer, class Compare = std::less<typename KeyContainer::value_type>>
+    flat_multimap(KeyContainer, MappedContainer, Compare = Compare())
+        -> flat_multimap<typename KeyContainer::value_type, typename MappedContainer::value_type, Compare, KeyContainer, MappedContainer>;
+
+    template <class KeyContainer, class MappedContainer, class Compare = std::less<typename KeyContainer::value_type>>
+    flat_multimap(sorted_equivalent_t, KeyContainer, MappedContainer, Compare = Compare())
+        -> flat_multimap<typename KeyContainer::value_type, typename MappedContainer::value_type, Compare, KeyContainer, MappedContainer>;
+
+    template <std::input_iterator InputIterator, class Compare = std::less<Detail::iter_key_t<InputIterator>>>
+    flat_multimap(InputIterator, InputIterator, Compare = Compare())
+        -> flat_multimap<Detail::iter_key_t<InputIterator>, Detail::iter_mapped_t<InputIterator>, Compare>;
+
+    template <std::input_iterator InputIterator, class Compare = std::less<Detail::iter_key_t<InputIterator>>>
+    flat_multimap(sorted_equivalent_t, InputIterator, InputIterator, Compare = Compare())
+        -> flat_multimap<Detail::iter_key_t<InputIterator>, Detail::iter_mapped_t<InputIterator>, Compare>;
+
+    template <class Key, class T, class Compare = std::less<Key>>
+    flat_multimap(std::initializer_list<std::pair<Key, T>>, Compare = Compare()) -> flat_multimap<Key, T, Compare>;
+
+    template <class Key, class T, class Compare = std::less<Key>>
+    flat_multimap(sorted_equivalent_t, std::initializer_list<std::pair<Key, T>>, Compare = Compare()) -> flat_multimap<Key, T, Compare>;
+}
+
+#include <CppUtils/StdReimpl/flat_map.inl>
@@ -0,0 +1,1000 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/flat_map.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        [[noreturn]] inline void flat_map_throw_out_of_range()
+        {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            throw std::out_of_range("flat_map::at");
+#else
+            std::abort();
+#endif
+        }
+
+        // The constructors below delegate to the comparator constructor so that, if they throw part way through, our
+        // members are already constructed and the guard can clear them.
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::flat_map_base()
+            : flat_map_base(key_compare())
+        {
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::flat_map_base(const key_compare& comp)
+            : c()
+            , compare(comp)
+        {
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::flat_map_base(key_container_type keyCont, mapped_container_type mappedCont, const key_compare& comp)
+            : flat_map_base(comp)
+        {
+            assert(keyCont.size() == mappedCont.size());
+
+            c.keys = std::move(keyCont);
+            c.values = std::move(mappedCont);
+
+            Detail::flat_clear_guard guard(*this);
+            Detail::flat_sort_and_merge_tail<!Multi>(compare, 0, false, c.keys, c.values);
+            index.Rebuild(c.keys);
+            guard.Release();
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::flat_map_base(sorted_tag_type, key_container_type keyCont, mapped_container_type mappedCont, const key_compare& comp)
+            : flat_map_base(comp)
+        {
+            assert(keyCont.size() == mappedCont.size());
+            assert((Detail::flat_is_sorted<!Multi>(keyCont, comp)));
+
+            c.keys = std::move(keyCont);
+            c.values = std::move(mappedCont);
+
+            Detail::flat_clear_guard guard(*this);
+            index.Rebuild(c.keys);
+            guard.Release();
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <std::input_iterator InputIterator>
+        flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::flat_map_base(InputIterator first, InputIterator last, const key_compare& comp)
+            : flat_map_base(comp)
+        {
+            InsertRange(first, last, false);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <std::input_iterator InputIterator>
+        flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::flat_map_base(sorted_tag_type, InputIterator first, InputIterator last, const key_compare& comp)
+            : flat_map_base(comp)
+        {
+            InsertRange(first, last, true);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::flat_map_base(std::initializer_list<value_type> il, const key_compare& comp)
+            : flat_map_base(il.begin(), il.end(), comp)
+        {
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::flat_map_base(sorted_tag_type s, std::initializer_list<value_type> il, const key_compare& comp)
+            : flat_map_base(s, il.begin(), il.end(), comp)
+        {
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::begin() noexcept
+        {
+            return IteratorAt(0);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::begin() const noexcept
+        {
+            return IteratorAt(0);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::end() noexcept
+        {
+            return IteratorAt(size());
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::end() const noexcept
+        {
+            return IteratorAt(size());
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::reverse_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::rbegin() noexcept
+        {
+            return reverse_iterator(end());
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_reverse_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::rbegin() const noexcept
+        {
+            return const_reverse_iterator(end());
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::reverse_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::rend() noexcept
+        {
+            return reverse_iterator(begin());
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_reverse_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::rend() const noexcept
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::cend() const noexcept
+        {
+            return end();
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_reverse_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::crbegin() const noexcept
+        {
+            return rbegin();
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_reverse_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::crend() const noexcept
+        {
+            return rend();
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        bool flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::empty() const noexcept
+        {
+            return c.keys.empty();
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::size_type flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::size() const noexcept
+        {
+            return c.keys.size();
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::size_type flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::max_size() const noexcept
+        {
+            return std::min<size_type>(c.keys.max_size(), c.values.max_size());
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::mapped_type& flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::operator[](const key_type& x) requires (!Multi)
+        {
+            return c.values[TryEmplaceIndex(x).first];
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::mapped_type& flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::operator[](key_type&& x) requires (!Multi)
+        {
+            return c.values[TryEmplaceIndex(std::move(x)).first];
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (!Multi && Detail::transparent_compare<Compare> && std::is_constructible_v<Key, K>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::mapped_type& flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::operator[](K&& x)
+        {
+            return c.values[TryEmplaceIndex(std::forward<K>(x)).first];
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::mapped_type& flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::at(const key_type& x) requires (!Multi)
+        {
+            const size_type i = FindIndex(x);
+            if (i == size())
+            {
+                Detail::flat_map_throw_out_of_range();
+            }
+            return c.values[i];
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        const typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::mapped_type& flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::at(const key_type& x) const requires (!Multi)
+        {
+            const size_type i = FindIndex(x);
+            if (i == size())
+            {
+                Detail::flat_map_throw_out_of_range();
+            }
+            return c.values[i];
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (!Multi && Detail::transparent_compare<Compare>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::mapped_type& flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::at(const K& x)
+        {
+            const size_type i = FindIndex(x);
+            if (i == size())
+            {
+                Detail::flat_map_throw_out_of_range();
+            }
+            return c.values[i];
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (!Multi && Detail::transparent_compare<Compare>)
+        const typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::mapped_type& flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::at(const K& x) const
+        {
+            const size_type i = FindIndex(x);
+            if (i == size())
+            {
+                Detail::flat_map_throw_out_of_range();
+            }
+            return c.values[i];
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class... Args>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert_result_type flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::emplace(Args&&... args)
+        {
+            std::pair<key_type, mapped_type> value(std::forward<Args>(args)...);
+            if constexpr (Multi)
+            {
+                const size_type i = UpperBoundIndex(value.first);
+                InsertAt(i, std::move(value.first), std::move(value.second));
+                return IteratorAt(i);
+            }
+            else
+            {
+                const auto [i, inserted] = TryEmplaceIndex(std::move(value.first), std::move(value.second));
+                return {IteratorAt(i), inserted};
+            }
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class... Args>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::emplace_hint(const_iterator position, Args&&... args)
+        {
+            std::pair<key_type, mapped_type> value(std::forward<Args>(args)...);
+            if constexpr (Multi)
+            {
+                const size_type i = MultiHintIndex(position, value.first);
+                InsertAt(i, std::move(value.first), std::move(value.second));
+                return IteratorAt(i);
+            }
+            else
+            {
+                return IteratorAt(TryEmplaceHintIndex(position, std::move(value.first), std::move(value.second)));
+            }
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert_result_type flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert(const value_type& x)
+        {
+            return emplace(x);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert_result_type flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert(value_type&& x)
+        {
+            return emplace(std::move(x));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class P>
+            requires (std::is_constructible_v<std::pair<Key, T>, P>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert_result_type flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert(P&& x)
+        {
+            return emplace(std::forward<P>(x));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert(const_iterator position, const value_type& x)
+        {
+            return emplace_hint(position, x);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert(const_iterator position, value_type&& x)
+        {
+            return emplace_hint(position, std::move(x));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class P>
+            requires (std::is_constructible_v<std::pair<Key, T>, P>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert(const_iterator position, P&& x)
+        {
+            return emplace_hint(position, std::forward<P>(x));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <std::input_iterator InputIterator>
+        void flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert(InputIterator first, InputIterator last)
+        {
+            InsertRange(first, last, false);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <std::input_iterator InputIterator>
+        void flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert(sorted_tag_type, InputIterator first, InputIterator last)
+        {
+            InsertRange(first, last, true);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <Detail::container_compatible_range<std::pair<Key, T>> R>
+        void flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert_range(R&& rg)
+        {
+            InsertRange(std::ranges::begin(rg), std::ranges::end(rg), false);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        void flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert(std::initializer_list<value_type> il)
+        {
+            InsertRange(il.begin(), il.end(), false);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        void flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert(sorted_tag_type, std::initializer_list<value_type> il)
+        {
+            InsertRange(il.begin(), il.end(), true);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::containers flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::extract() &&
+        {
+            containers result = std::move(c);
+            clear();
+            return result;
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        void flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::replace(key_container_type&& keyCont, mapped_container_type&& mappedCont)
+        {
+            assert(keyCont.size() == mappedCont.size());
+            assert((Detail::flat_is_sorted<!Multi>(keyCont, compare)));
+
+            Detail::flat_clear_guard guard(*this);
+            c.keys = std::move(keyCont);
+            c.values = std::move(mappedCont);
+            index.Rebuild(c.keys);
+            guard.Release();
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class... Args>
+            requires (!Multi && std::is_constructible_v<T, Args...>)
+        std::pair<typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator, bool> flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::try_emplace(const key_type& k, Args&&... args)
+        {
+            const auto [i, inserted] = TryEmplaceIndex(k, std::forward<Args>(args)...);
+            return {IteratorAt(i), inserted};
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class... Args>
+            requires (!Multi && std::is_constructible_v<T, Args...>)
+        std::pair<typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator, bool> flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::try_emplace(key_type&& k, Args&&... args)
+        {
+            const auto [i, inserted] = TryEmplaceIndex(std::move(k), std::forward<Args>(args)...);
+            return {IteratorAt(i), inserted};
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K, class... Args>
+            requires (!Multi && Detail::transparent_compare<Compare> && std::is_constructible_v<Key, K> &&
+                std::is_constructible_v<T, Args...> && !std::is_convertible_v<K&&, typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator> &&
+                !std::is_convertible_v<K&&, typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator>)
+        std::pair<typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator, bool> flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::try_emplace(K&& k, Args&&... args)
+        {
+            const auto [i, inserted] = TryEmplaceIndex(std::forward<K>(k), std::forward<Args>(args)...);
+            return {IteratorAt(i), inserted};
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class... Args>
+            requires (!Multi && std::is_constructible_v<T, Args...>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::try_emplace(const_iterator hint, const key_type& k, Args&&... args)
+        {
+            return IteratorAt(TryEmplaceHintIndex(hint, k, std::forward<Args>(args)...));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class... Args>
+            requires (!Multi && std::is_constructible_v<T, Args...>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::try_emplace(const_iterator hint, key_type&& k, Args&&... args)
+        {
+            return IteratorAt(TryEmplaceHintIndex(hint, std::move(k), std::forward<Args>(args)...));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K, class... Args>
+            requires (!Multi && Detail::transparent_compare<Compare> && std::is_constructible_v<Key, K> &&
+                std::is_constructible_v<T, Args...>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::try_emplace(const_iterator hint, K&& k, Args&&... args)
+        {
+            return IteratorAt(TryEmplaceHintIndex(hint, std::forward<K>(k), std::forward<Args>(args)...));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class M>
+            requires (!Multi && std::is_assignable_v<T&, M> && std::is_constructible_v<T, M>)
+        std::pair<typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator, bool> flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert_or_assign(const key_type& k, M&& obj)
+        {
+            const auto [i, inserted] = TryEmplaceIndex(k, std::forward<M>(obj));
+            if (!inserted)
+            {
+                c.values[i] = std::forward<M>(obj);
+            }
+            return {IteratorAt(i), inserted};
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class M>
+            requires (!Multi && std::is_assignable_v<T&, M> && std::is_constructible_v<T, M>)
+        std::pair<typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator, bool> flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert_or_assign(key_type&& k, M&& obj)
+        {
+            const auto [i, inserted] = TryEmplaceIndex(std::move(k), std::forward<M>(obj));
+            if (!inserted)
+            {
+                c.values[i] = std::forward<M>(obj);
+            }
+            return {IteratorAt(i), inserted};
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K, class M>
+            requires (!Multi && Detail::transparent_compare<Compare> && std::is_constructible_v<Key, K> &&
+                std::is_assignable_v<T&, M> && std::is_constructible_v<T, M>)
+        std::pair<typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator, bool> flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert_or_assign(K&& k, M&& obj)
+        {
+            const auto [i, inserted] = TryEmplaceIndex(std::forward<K>(k), std::forward<M>(obj));
+            if (!inserted)
+            {
+                c.values[i] = std::forward<M>(obj);
+            }
+            return {IteratorAt(i), inserted};
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class M>
+            requires (!Multi && std::is_assignable_v<T&, M> && std::is_constructible_v<T, M>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert_or_assign(const_iterator hint, const key_type& k, M&& obj)
+        {
+            const size_type sizeBefore = size();
+            const size_type i = TryEmplaceHintIndex(hint, k, std::forward<M>(obj));
+            if (size() == sizeBefore)
+            {
+                c.values[i] = std::forward<M>(obj);
+            }
+            return IteratorAt(i);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class M>
+            requires (!Multi && std::is_assignable_v<T&, M> && std::is_constructible_v<T, M>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert_or_assign(const_iterator hint, key_type&& k, M&& obj)
+        {
+            const size_type sizeBefore = size();
+            const size_type i = TryEmplaceHintIndex(hint, std::move(k), std::forward<M>(obj));
+            if (size() == sizeBefore)
+            {
+                c.values[i] = std::forward<M>(obj);
+            }
+            return IteratorAt(i);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K, class M>
+            requires (!Multi && Detail::transparent_compare<Compare> && std::is_constructible_v<Key, K> &&
+                std::is_assignable_v<T&, M> && std::is_constructible_v<T, M>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::insert_or_assign(const_iterator hint, K&& k, M&& obj)
+        {
+            const size_type sizeBefore = size();
+            const size_type i = TryEmplaceHintIndex(hint, std::forward<K>(k), std::forward<M>(obj));
+            if (size() == sizeBefore)
+            {
+                c.values[i] = std::forward<M>(obj);
+            }
+            return IteratorAt(i);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::erase(iterator position)
+        {
+            return erase(const_iterator(position));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::erase(const_iterator position)
+        {
+            const size_type i = IndexOf(position);
+            EraseIndices(i, i + 1);
+            return IteratorAt(i);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::size_type flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::erase(const key_type& x)
+        {
+            const auto [first, last] = EqualRangeIndices(x);
+            EraseIndices(first, last);
+            return last - first;
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare> && !std::is_convertible_v<K&&, typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator> &&
+                !std::is_convertible_v<K&&, typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::size_type flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::erase(K&& x)
+        {
+            const auto [first, last] = EqualRangeIndices(x);
+            EraseIndices(first, last);
+            return last - first;
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::erase(const_iterator first, const_iterator last)
+        {
+            const size_type firstIndex = IndexOf(first);
+            EraseIndices(firstIndex, IndexOf(last));
+            return IteratorAt(firstIndex);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        void flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::swap(flat_map_base& y) noexcept
+        {
+            using std::swap;
+            swap(c.keys, y.c.keys);
+            swap(c.values, y.c.values);
+            swap(compare, y.compare);
+            swap(index, y.index);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        void flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::clear() noexcept
+        {
+            c.keys.clear();
+            c.values.clear();
+            index.Clear();
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::key_compare flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::key_comp() const
+        {
+            return compare;
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::value_compare flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::value_comp() const
+        {
+            return value_compare(compare);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        const typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::key_container_type& flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::keys() const noexcept
+        {
+            return c.keys;
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        const typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::mapped_container_type& flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::values() const noexcept
+        {
+            return c.values;
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::find(const key_type& x)
+        {
+            return IteratorAt(FindIndex(x));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::find(const key_type& x) const
+        {
+            return IteratorAt(FindIndex(x));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::find(const K& x)
+        {
+            return IteratorAt(FindIndex(x));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::find(const K& x) const
+        {
+            return IteratorAt(FindIndex(x));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::size_type flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::count(const key_type& x) const
+        {
+            const auto [first, last] = EqualRangeIndices(x);
+            return last - first;
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::size_type flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::count(const K& x) const
+        {
+            const auto [first, last] = EqualRangeIndices(x);
+            return last - first;
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        bool flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::contains(const key_type& x) const
+        {
+            return FindIndex(x) != size();
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare>)
+        bool flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::contains(const K& x) const
+        {
+            return FindIndex(x) != size();
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::lower_bound(const key_type& x)
+        {
+            return IteratorAt(LowerBoundIndex(x));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::lower_bound(const key_type& x) const
+        {
+            return IteratorAt(LowerBoundIndex(x));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::lower_bound(const K& x)
+        {
+            return IteratorAt(LowerBoundIndex(x));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::lower_bound(const K& x) const
+        {
+            return IteratorAt(LowerBoundIndex(x));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::upper_bound(const key_type& x)
+        {
+            return IteratorAt(UpperBoundIndex(x));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::upper_bound(const key_type& x) const
+        {
+            return IteratorAt(UpperBoundIndex(x));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::upper_bound(const K& x)
+        {
+            return IteratorAt(UpperBoundIndex(x));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare>)
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::upper_bound(const K& x) const
+        {
+            return IteratorAt(UpperBoundIndex(x));
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        std::pair<typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator, typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator> flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::equal_range(const key_type& x)
+        {
+            const auto [first, last] = EqualRangeIndices(x);
+            return {IteratorAt(first), IteratorAt(last)};
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        std::pair<typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator, typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator> flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::equal_range(const key_type& x) const
+        {
+            const auto [first, last] = EqualRangeIndices(x);
+            return {IteratorAt(first), IteratorAt(last)};
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare>)
+        std::pair<typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator, typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator> flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::equal_range(const K& x)
+        {
+            const auto [first, last] = EqualRangeIndices(x);
+            return {IteratorAt(first), IteratorAt(last)};
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare>)
+        std::pair<typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator, typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator> flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::equal_range(const K& x) const
+        {
+            const auto [first, last] = EqualRangeIndices(x);
+            return {IteratorAt(first), IteratorAt(last)};
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        bool flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::Equals(const flat_map_base& other) const
+        {
+            // Comparing the containers whole, rather than pair by pair, lets them use their own fast paths.
+            return c.keys == other.c.keys && c.values == other.c.values;
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        auto flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::Compare3Way(const flat_map_base& other) const
+        {
+            return std::lexicographical_compare_three_way(begin(), end(), other.begin(), other.end(), Detail::synth_three_way);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::IteratorAt(size_type i) noexcept
+        {
+            const difference_type offset = static_cast<difference_type>(i);
+            return iterator(c.keys.cbegin() + offset, c.values.begin() + offset);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::const_iterator flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::IteratorAt(size_type i) const noexcept
+        {
+            const difference_type offset = static_cast<difference_type>(i);
+            return const_iterator(c.keys.cbegin() + offset, c.values.cbegin() + offset);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::size_type flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::IndexOf(const_iterator position) const noexcept
+        {
+            return static_cast<size_type>(position - begin());
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::size_type flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::LowerBoundIndex(const K& x) const
+        {
+            return index.LowerBound(c.keys, compare, x);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::size_type flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::UpperBoundIndex(const K& x) const
+        {
+            return index.UpperBound(c.keys, compare, x);
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::size_type flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::FindIndex(const K& x) const
+        {
+            const size_type i = LowerBoundIndex(x);
+            return (i != size() && !compare(x, c.keys[i])) ? i : size();
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+        std::pair<typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::size_type, typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::size_type> flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::EqualRangeIndices(const K& x) const
+        {
+            const size_type first = LowerBoundIndex(x);
+            if constexpr (Multi)
+            {
+                const size_type count = static_cast<size_type>(Detail::flat_branchless_upper_bound(
+                    c.keys.begin() + static_cast<difference_type>(first), size() - first, x, compare) - c.keys.begin()) - first;
+                return {first, first + count};
+            }
+            else
+            {
+                return {first, (first != size() && !compare(x, c.keys[first])) ? first + 1 : first};
+            }
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::size_type flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::MultiHintIndex(const_iterator hint, const K& x) const
+        {
+            const size_type h = IndexOf(hint);
+            if (h != 0 && compare(x, c.keys[h - 1]))
+            {
+                // It belongs before the hint, so the closest is after the last element that isn't after it.
+                return static_cast<size_type>(Detail::flat_branchless_upper_bound(c.keys.begin(), h, x, compare) - c.keys.begin());
+            }
+            if (h != size() && compare(c.keys[h], x))
+            {
+                // It belongs after the hint, so the closest is before the first element that isn't before it.
+                return static_cast<size_type>(Detail::flat_branchless_lower_bound(
+                    c.keys.begin() + static_cast<difference_type>(h), size() - h, x, compare) - c.keys.begin());
+            }
+            return h;
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class KeyArg, class... Args>
+        void flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::InsertAt(size_type i, KeyArg&& key, Args&&... args)
+        {
+            const difference_type offset = static_cast<difference_type>(i);
+
+            Detail::flat_clear_guard guard(*this);
+            c.keys.emplace(c.keys.begin() + offset, std::forward<KeyArg>(key));
+            c.values.emplace(c.values.begin() + offset, std::forward<Args>(args)...);
+            index.Rebuild(c.keys);
+            guard.Release();
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class KeyArg, class... Args>
+        std::pair<typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::size_type, bool> flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::TryEmplaceIndex(KeyArg&& key, Args&&... args)
+        {
+            const size_type i = LowerBoundIndex(key);
+            if (i != size() && !compare(key, c.keys[i]))
+            {
+                return {i, false};
+            }
+
+            InsertAt(i, std::forward<KeyArg>(key), std::forward<Args>(args)...);
+            return {i, true};
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class KeyArg, class... Args>
+        typename flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::size_type flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::TryEmplaceHintIndex(const_iterator hint, KeyArg&& key, Args&&... args)
+        {
+            // A correct hint saves the search. Otherwise, including when the key is already there, search as usual.
+            const size_type h = IndexOf(hint);
+            if ((h == 0 || compare(c.keys[h - 1], key)) && (h == size() || compare(key, c.keys[h])))
+            {
+                InsertAt(h, std::forward<KeyArg>(key), std::forward<Args>(args)...);
+                return h;
+            }
+            return TryEmplaceIndex(std::forward<KeyArg>(key), std::forward<Args>(args)...).first;
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        template <class InputIterator, class Sentinel>
+        void flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::InsertRange(InputIterator first, Sentinel last, bool isSorted)
+        {
+            Detail::flat_clear_guard guard(*this);
+
+            const size_type oldSize = size();
+            for (; first != last; ++first)
+            {
+                auto&& element = *first;
+                c.keys.insert(c.keys.end(), std::forward<decltype(element)>(element).first);
+                c.values.insert(c.values.end(), std::forward<decltype(element)>(element).second);
+            }
+
+            Detail::flat_sort_and_merge_tail<!Multi>(compare, oldSize, isSorted, c.keys, c.values);
+            index.Rebuild(c.keys);
+            guard.Release();
+        }
+
+        template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, bool Multi>
+        void flat_map_base<Key, T, Compare, KeyContainer, MappedContainer, SearchMode, Multi>::EraseIndices(size_type first, size_type last)
+        {
+            if (first == last)
+            {
+                return;
+            }
+
+            const difference_type firstOffset = static_cast<difference_type>(first);
+            const difference_type lastOffset = static_cast<difference_type>(last);
+
+            Detail::flat_clear_guard guard(*this);
+            c.keys.erase(c.keys.begin() + firstOffset, c.keys.begin() + lastOffset);
+            c.values.erase(c.values.begin() + firstOffset, c.values.begin() + lastOffset);
+            index.Rebuild(c.keys);
+            guard.Release();
+        }
+
+        /**
+         * @brief The body of `erase_if` for both flat maps. The elements that stay are moved down over the ones that don't,
+         *        in both containers at once, and then put back.
+         */
+        template <class FlatMap, class Predicate>
+        typename FlatMap::size_type flat_map_erase_if(FlatMap& c, Predicate& pred)
+        {
+            using size_type = typename FlatMap::size_type;
+            using const_reference = typename FlatMap::const_reference;
+
+            auto [keys, values] = std::move(c).extract();
+
+            size_type kept = 0;
+            for (size_type i = 0; i < keys.size(); ++i)
+            {
+                if (!pred(const_reference(keys[i], values[i])))
+                {
+                    if (kept != i)
+                    {
+                        keys[kept] = std::move(keys[i]);
+                        values[kept] = std::move(values[i]);
+                    }
+                    ++kept;
+                }
+            }
+
+            const size_type removed = keys.size() - kept;
+            keys.erase(keys.begin() + static_cast<std::ptrdiff_t>(kept), keys.end());
+            values.erase(values.begin() + static_cast<std::ptrdiff_t>(kept), values.end());
+            c.replace(std::move(keys), std::move(values));
+            return removed;
+        }
+    }
+
+    template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode>
+    flat_map<Key, T, Compare, KeyContainer, MappedContainer, SearchMode>::flat_map(std::initializer_list<typename base_type::value_type> il, const typename base_type::key_compare& comp)
+        : base_type(il, comp)
+    {
+    }
+
+    template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode>
+    flat_map<Key, T, Compare, KeyContainer, MappedContainer, SearchMode>&
+        flat_map<Key, T, Compare, KeyContainer, MappedContainer, SearchMode>::operator=(std::initializer_list<typename base_type::value_type> il)
+    {
+        this->clear();
+        this->insert(il);
+        return *this;
+    }
+
+    template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode>
+    flat_multimap<Key, T, Compare, KeyContainer, MappedContainer, SearchMode>::flat_multimap(std::initializer_list<typename base_type::value_type> il, const typename base_type::key_compare& comp)
+        : base_type(il, comp)
+    {
+    }
+
+    template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode>
+    flat_multimap<Key, T, Compare, KeyContainer, MappedContainer, SearchMode>&
+        flat_multimap<Key, T, Compare, KeyContainer, MappedContainer, SearchMode>::operator=(std::initializer_list<typename base_type::value_type> il)
+    {
+        this->clear();
+        this->insert(il);
+        return *this;
+    }
+
+    template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, class Predicate>
+    typename flat_map<Key, T, Compare, KeyContainer, MappedContainer, SearchMode>::size_type
+        erase_if(flat_map<Key, T, Compare, KeyContainer, MappedContainer, SearchMode>& c, Predicate pred)
+    {
+        return Detail::flat_map_erase_if(c, pred);
+    }
+
+    template <class Key, class T, class Compare, class KeyContainer, class MappedContainer, flat_search_mode SearchMode, class Predicate>
+    typename flat_multimap<Key, T, Compare, KeyContainer, MappedContainer, SearchMode>::size_type
+        erase_if(flat_multimap<Key, T, Compare, KeyContainer, MappedContainer, SearchMode>& c, Predicate pred)
+    {
+        return Detail::flat_map_erase_if(c, pred);
+    }
+}
@@ -0,0 +1,369 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/flat_tree.h>
+#include <CppUtils/StdReimpl/utility.h>
+
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        /**
+         * @brief Everything `flat_set` and `flat_multiset` have in common, which is all of it but their names and their
+         *        comparisons. `Multi` picks between the two: whether equivalent keys are allowed, which sorted tag the
+         *        constructors take, and what `insert` and `emplace` return.
+         */
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        class flat_set_base
+        {
+            static_assert(std::is_same_v<Key, typename KeyContainer::value_type>, "KeyContainer must hold Key.");
+            static_assert(std::random_access_iterator<typename KeyContainer::iterator>, "KeyContainer must be random access.");
+
+            using sorted_tag_type = std::conditional_t<Multi, StdReimpl::sorted_equivalent_t, StdReimpl::sorted_unique_t>;
+
+        public:
+            using key_type = Key;
+            using value_type = Key;
+            using key_compare = Compare;
+            using value_compare = Compare;
+            using reference = value_type&;
+            using const_reference = const value_type&;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using iterator = typename KeyContainer::const_iterator;
+            using const_iterator = typename KeyContainer::const_iterator;
+            using reverse_iterator = std::reverse_iterator<iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+            using container_type = KeyContainer;
+
+        private:
+            using insert_result_type = std::conditional_t<Multi, iterator, std::pair<iterator, bool>>;
+
+        public:
+            // Construct/copy/destroy.
+
+            flat_set_base();
+            explicit flat_set_base(const key_compare& comp);
+
+            /**
+             * @brief Sorts the container, dropping all but the first of equivalent keys for a `flat_set`.
+             */
+            explicit flat_set_base(container_type cont, const key_compare& comp = key_compare());
+
+            /**
+             * @brief Takes the container as it is. It must already be sorted (and unique for a `flat_set`).
+             */
+            flat_set_base(sorted_tag_type, container_type cont, const key_compare& comp = key_compare());
+
+            template <std::input_iterator InputIterator>
+            flat_set_base(InputIterator first, InputIterator last, const key_compare& comp = key_compare());
+            template <std::input_iterator InputIterator>
+            flat_set_base(sorted_tag_type, InputIterator first, InputIterator last, const key_compare& comp = key_compare());
+
+            flat_set_base(std::initializer_list<value_type> il, const key_compare& comp = key_compare());
+            flat_set_base(sorted_tag_type, std::initializer_list<value_type> il, const key_compare& comp = key_compare());
+
+            // Iterators.
+
+            iterator begin() const noexcept;
+            iterator end() const noexcept;
+            reverse_iterator rbegin() const noexcept;
+            reverse_iterator rend() const noexcept;
+
+            const_iterator cbegin() const noexcept;
+            const_iterator cend() const noexcept;
+            const_reverse_iterator crbegin() const noexcept;
+            const_reverse_iterator crend() const noexcept;
+
+            // Capacity.
+
+            [[nodiscard]] bool empty() const noexcept;
+            size_type size() const noexcept;
+            size_type max_size() const noexcept;
+
+            // Modifiers.
+
+            template <class... Args>
+            insert_result_type emplace(Args&&... args);
+            template <class... Args>
+            iterator emplace_hint(const_iterator position, Args&&... args);
+
+            insert_result_type insert(const value_type& x);
+            insert_result_type insert(value_type&& x);
+            template <class K>
+                requires (!Multi && Detail::transparent_compare<Compare> && std::is_constructible_v<value_type, K>)
+            std::pair<iterator, bool> insert(K&& x);
+            iterator insert(const_iterator position, const value_type& x);
+            iterator insert(const_iterator position, value_type&& x);
+            template <class K>
+                requires (!Multi && Detail::transparent_compare<Compare> && std::is_constructible_v<value_type, K>)
+            iterator insert(const_iterator position, K&& x);
+
+            /**
+             * @brief Appends the elements, then sorts and merges them in at once. That's linear in `size()` plus
+             *        `N log N` in the number of new elements, rather than a shift per element.
+             */
+            template <std::input_iterator InputIterator>
+            void insert(InputIterator first, InputIterator last);
+
+            /**
+             * @brief Like the above, but the elements must already be sorted (and unique for a `flat_set`), so they're
+             *        only merged in.
+             */
+            template <std::input_iterator InputIterator>
+            void insert(sorted_tag_type, InputIterator first, InputIterator last);
+
+            template <Detail::container_compatible_range<value_type> R>
+            void insert_range(R&& rg);
+
+            void insert(std::initializer_list<value_type> il);
+            void insert(sorted_tag_type s, std::initializer_list<value_type> il);
+
+            container_type extract() &&;
+            void replace(container_type&& cont);
+
+            iterator erase(const_iterator position);
+            size_type erase(const key_type& x);
+            template <class K>
+                requires (Detail::transparent_compare<Compare> && !std::is_convertible_v<K&&, iterator> &&
+                    !std::is_convertible_v<K&&, const_iterator>)
+            size_type erase(K&& x);
+            iterator erase(const_iterator first, const_iterator last);
+
+            void swap(flat_set_base& y) noexcept;
+            void clear() noexcept;
+
+            // Observers.
+
+            key_compare key_comp() const;
+            value_compare value_comp() const;
+
+            // Set operations.
+
+            iterator find(const key_type& x) const;
+            template <class K>
+                requires (Detail::transparent_compare<Compare>)
+            iterator find(const K& x) const;
+
+            size_type count(const key_type& x) const;
+            template <class K>
+                requires (Detail::transparent_compare<Compare>)
+            size_type count(const K& x) const;
+
+            bool contains(const key_type& x) const;
+            template <class K>
+                requires (Detail::transparent_compare<Compare>)
+            bool contains(const K& x) const;
+
+            iterator lower_bound(const key_type& x) const;
+            template <class K>
+                requires (Detail::transparent_compare<Compare>)
+            iterator lower_bound(const K& x) const;
+
+            iterator upper_bound(const key_type& x) const;
+            template <class K>
+                requires (Detail::transparent_compare<Compare>)
+            iterator upper_bound(const K& x) const;
+
+            std::pair<iterator, iterator> equal_range(const key_type& x) const;
+            template <class K>
+                requires (Detail::transparent_compare<Compare>)
+            std::pair<iterator, iterator> equal_range(const K& x) const;
+
+        protected:
+            bool Equals(const flat_set_base& other) const;
+            auto Compare3Way(const flat_set_base& other) const;
+
+        private:
+            iterator IteratorAt(size_type i) const noexcept;
+            size_type IndexOf(const_iterator position) const noexcept;
+
+            template <class K>
+            size_type LowerBoundIndex(const K& x) const;
+            template <class K>
+            size_type UpperBoundIndex(const K& x) const;
+
+            /**
+             * @brief The index of the first element equivalent to `x`, or `size()` if there's none.
+             */
+            template <class K>
+            size_type FindIndex(const K& x) const;
+
+            template <class K>
+            std::pair<size_type, size_type> EqualRangeIndices(const K& x) const;
+
+            /**
+             * @brief Where a `flat_multiset` inserts `x` given the hint: at the hint if `x` belongs there, and otherwise as
+             *        close to it as the order allows.
+             */
+            template <class K>
+            size_type MultiHintIndex(const_iterator hint, const K& x) const;
+
+            template <class Arg>
+            void InsertAt(size_type i, Arg&& x);
+
+            template <class Arg>
+            std::pair<size_type, bool> TryInsertIndex(Arg&& x);
+
+            template <class Arg>
+            size_type TryInsertHintIndex(const_iterator hint, Arg&& x);
+
+            template <class InputIterator, class Sentinel>
+            void InsertRange(InputIterator first, Sentinel last, bool isSorted);
+
+            void EraseIndices(size_type first, size_type last);
+
+            container_type c;
+            key_compare compare;
+            Detail::flat_tree_index<key_type, key_compare, SearchMode> index;
+        };
+    }
+
+    /**
+     * @brief A sorted set with unique keys, stored in a sorted container rather than as nodes. Lookups only touch
+     *        contiguous memory, so they stay in cache and avoid `std::set`'s pointer chasing. In return, insertion and
+     *        erasure shift the elements after them.
+     *
+     *        Lookups use a branchless binary search, and a SIMD linear scan for small sets of arithmetic keys. Set
+     *        `SearchMode` to `flat_search_mode::eytzinger` for sets that are built once and then read a lot.
+     * @see https://eel.is/c++draft/flat.set
+     * @see https://cppreference.com/w/cpp/container/flat_set
+     * @note A feature from the C++23 standard. The constructors that take allocators or `from_range_t` are left out.
+     *       `SearchMode` is not part of the standard.
+     */
+    template <class Key, class Compare = std::less<Key>, class KeyContainer = std::vector<Key>,
+        flat_search_mode SearchMode = flat_search_mode::binary>
+    class flat_set : public Detail::flat_set_base<Key, Compare, KeyContainer, SearchMode, false>
+    {
+        using base_type = Detail::flat_set_base<Key, Compare, KeyContainer, SearchMode, false>;
+
+    public:
+        using base_type::base_type;
+
+        // Declared here rather than inherited, since deducing the template arguments from a braced list only considers
+        // the class's own initializer-list constructors.
+        flat_set() = default;
+        flat_set(std::initializer_list<Key> il, const typename base_type::key_compare& comp = typename base_type::key_compare());
+
+        flat_set& operator=(std::initializer_list<Key> il);
+
+        friend bool operator==(const flat_set& x, const flat_set& y)
+        {
+            return x.Equals(y);
+        }
+
+        friend auto operator<=>(const flat_set& x, const flat_set& y)
+        {
+            return x.Compare3Way(y);
+        }
+
+        friend void swap(flat_set& x, flat_set& y) noexcept
+        {
+            x.swap(y);
+        }
+    };
+
+    /**
+     * @brief A `flat_set` that allows equivalent keys. Equivalent keys keep the order that they were inserted in.
+     * @see https://eel.is/c++draft/flat.multiset
+     * @see https://cppreference.com/w/cpp/container/flat_multiset
+     * @note A feature from the C++23 standard. The constructors that take allocators or `from_range_t` are left out.
+     *       `SearchMode` is not part of the standard.
+     */
+    template <class Key, class Compare = std::less<Key>, class KeyContainer = std::vector<Key>,
+        flat_search_mode SearchMode = flat_search_mode::binary>
+    class flat_multiset : public Detail::flat_set_base<Key, Compare, KeyContainer, SearchMode, true>
+    {
+        using base_type = Detail::flat_set_base<Key, Compare, KeyContainer, SearchMode, true>;
+
+    public:
+        using base_type::base_type;
+
+        // Declared here rather than inherited, since deducing the template arguments from a braced list only considers
+        // the class's own initializer-list constructors.
+        flat_multiset() = default;
+        flat_multiset(std::initializer_list<Key> il, const typename base_type::key_compare& comp = typename base_type::key_compare());
+
+        flat_multiset& operator=(std::initializer_list<Key> il);
+
+        friend bool operator==(const flat_multiset& x, const flat_multiset& y)
+        {
+            return x.Equals(y);
+        }
+
+        friend auto operator<=>(const flat_multiset& x, const flat_multiset& y)
+        {
+            return x.Compare3Way(y);
+        }
+
+        friend void swap(flat_multiset& x, flat_multiset& y) noexcept
+        {
+            x.swap(y);
+        }
+    };
+
+    /**
+     * @see https://eel.is/c++draft/flat.set.erasure
+     */
+    template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, class Predicate>
+    typename flat_set<Key, Compare, KeyContainer, SearchMode>::size_type
+        erase_if(flat_set<Key, Compare, KeyContainer, SearchMode>& c, Predicate pred);
+
+    /**
+     * @see https://eel.is/c++draft/flat.multiset.erasure
+     */
+    template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, class Predicate>
+    typename flat_multiset<Key, Compare, KeyContainer, SearchMode>::size_type
+        erase_if(flat_multiset<Key, Compare, KeyContainer, SearchMode>& c, Predicate pred);
+
+    // Deduction guides. Since most of the constructors are inherited, they have no implicit guides.
+
+    template <class KeyContainer, class Compare = std::less<typename KeyContainer::value_type>>
+    flat_set(KeyContainer, Compare = Compare()) -> flat_set<typename KeyContainer::value_type, Compare, KeyContainer>;
+
+    template <class KeyContainer, class Compare = std::less<typename KeyContainer::value_type>>
+    flat_set(sorted_unique_t, KeyContainer, Compare = Compare()) -> flat_set<typename KeyContainer::value_type, Compare, KeyContainer>;
+
+    template <std::input_iterator InputIterator, class Compare = std::less<std::iter_value_t<InputIterator>>>
+    flat_set(InputIterator, InputIterator, Compare = Compare()) -> flat_set<std::iter_value_t<InputIterator>, Compare>;
+
+    template <std::input_iterator InputIterator, class Compare = std::less<std::iter_value_t<InputIterator>>>
+    flat_set(sorted_unique_t, InputIterator, InputIterator, Compare = Compare()) -> flat_set<std::iter_value_t<InputIterator>, Compare>;
+
+    template <class Key, class Compare = std::less<Key>>
+    flat_set(std::initializer_list<Key>, Compare = Compare()) -> flat_set<Key, Compare>;
+
+    template <class Key, class Compare = std::less<Key>>
+    flat_set(sorted_unique_t, std::initializer_list<Key>, Compare = Compare()) -> flat_set<Key, Compare>;
+
+    template <class KeyContainer, class Compare = std::less<typename KeyContainer::value_type>>
+    flat_multiset(KeyContainer, Compare = Compare()) -> flat_multiset<typename KeyContainer::value_type, Compare, KeyContainer>;
+
+    template <class KeyContainer, class Compare = std::less<typename KeyContainer::value_type>>
+    flat_multiset(sorted_equivalent_t, KeyContainer, Compare = Compare()) -> flat_multiset<typename KeyContainer::value_type, Compare, KeyContainer>;
+
+    template <std::input_iterator InputIterator, class Compare = std::less<std::iter_value_t<InputIterator>>>
+    flat_multiset(InputIterator, InputIterator, Compare = Compare()) -> flat_multiset<std::iter_value_t<InputIterator>, Compare>;
+
+    template <std::input_iterator InputIterator, class Compare = std::less<std::iter_value_t<InputIterator>>>
+    flat_multiset(sorted_equivalent_t, InputIterator, InputIterator, Compare = Compare()) -> flat_multiset<std::iter_value_t<InputIterator>, Compare>;
+
+    template <class Key, class Compare = std::less<Key>>
+    flat_multiset(std::initializer_list<Key>, Compare = Compare()) -> flat_multiset<Key, Compare>;
+
+    template <class Key, class Compare = std::less<Key>>
+    flat_multiset(sorted_equivalent_t, std::initializer_list<Key>, Compare = Compare()) -> flat_multiset<Key, Compare>;
+}
+
+#include <CppUtils/StdReimpl/flat_set.inl>
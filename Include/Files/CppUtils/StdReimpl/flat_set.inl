@@ -0,0 +1,646 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/flat_set.h>
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        // The constructors below delegate to the comparator constructor so that, if they throw part way through, our
+        // members are already constructed and the guard can clear them.
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::flat_set_base()
+            : flat_set_base(key_compare())
+        {
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::flat_set_base(const key_compare& comp)
+            : c()
+            , compare(comp)
+        {
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::flat_set_base(container_type cont, const key_compare& comp)
+            : flat_set_base(comp)
+        {
+            c = std::move(cont);
+
+            Detail::flat_clear_guard guard(*this);
+            Detail::flat_sort_and_merge_tail<!Multi>(compare, 0, false, c);
+            index.Rebuild(c);
+            guard.Release();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::flat_set_base(sorted_tag_type, container_type cont, const key_compare& comp)
+            : flat_set_base(comp)
+        {
+            assert((Detail::flat_is_sorted<!Multi>(cont, comp)));
+
+            c = std::move(cont);
+
+            Detail::flat_clear_guard guard(*this);
+            index.Rebuild(c);
+            guard.Release();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <std::input_iterator InputIterator>
+        flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::flat_set_base(InputIterator first, InputIterator last, const key_compare& comp)
+            : flat_set_base(comp)
+        {
+            InsertRange(first, last, false);
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <std::input_iterator InputIterator>
+        flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::flat_set_base(sorted_tag_type, InputIterator first, InputIterator last, const key_compare& comp)
+            : flat_set_base(comp)
+        {
+            InsertRange(first, last, true);
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::flat_set_base(std::initializer_list<value_type> il, const key_compare& comp)
+            : flat_set_base(il.begin(), il.end(), comp)
+        {
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::flat_set_base(sorted_tag_type s, std::initializer_list<value_type> il, const key_compare& comp)
+            : flat_set_base(s, il.begin(), il.end(), comp)
+        {
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::begin() const noexcept
+        {
+            return c.cbegin();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::end() const noexcept
+        {
+            return c.cend();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::reverse_iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::rbegin() const noexcept
+        {
+            return reverse_iterator(end());
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::reverse_iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::rend() const noexcept
+        {
+            return reverse_iterator(begin());
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::const_iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::const_iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::cend() const noexcept
+        {
+            return end();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::const_reverse_iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::crbegin() const noexcept
+        {
+            return rbegin();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::const_reverse_iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::crend() const noexcept
+        {
+            return rend();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        bool flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::empty() const noexcept
+        {
+            return c.empty();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::size_type flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::size() const noexcept
+        {
+            return c.size();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::size_type flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::max_size() const noexcept
+        {
+            return c.max_size();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class... Args>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::insert_result_type flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::emplace(Args&&... args)
+        {
+            value_type value(std::forward<Args>(args)...);
+            if constexpr (Multi)
+            {
+                const size_type i = UpperBoundIndex(value);
+                InsertAt(i, std::move(value));
+                return IteratorAt(i);
+            }
+            else
+            {
+                const auto [i, inserted] = TryInsertIndex(std::move(value));
+                return {IteratorAt(i), inserted};
+            }
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class... Args>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::emplace_hint(const_iterator position, Args&&... args)
+        {
+            value_type value(std::forward<Args>(args)...);
+            if constexpr (Multi)
+            {
+                const size_type i = MultiHintIndex(position, value);
+                InsertAt(i, std::move(value));
+                return IteratorAt(i);
+            }
+            else
+            {
+                return IteratorAt(TryInsertHintIndex(position, std::move(value)));
+            }
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::insert_result_type flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::insert(const value_type& x)
+        {
+            return emplace(x);
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::insert_result_type flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::insert(value_type&& x)
+        {
+            return emplace(std::move(x));
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (!Multi && Detail::transparent_compare<Compare> && std::is_constructible_v<Key, K>)
+        std::pair<typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator, bool> flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::insert(K&& x)
+        {
+            // Only construct the key if it's not already there.
+            const size_type i = LowerBoundIndex(x);
+            if (i != size() && !compare(x, c[i]))
+            {
+                return {IteratorAt(i), false};
+            }
+
+            InsertAt(i, std::forward<K>(x));
+            return {IteratorAt(i), true};
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::insert(const_iterator position, const value_type& x)
+        {
+            return emplace_hint(position, x);
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::insert(const_iterator position, value_type&& x)
+        {
+            return emplace_hint(position, std::move(x));
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (!Multi && Detail::transparent_compare<Compare> && std::is_constructible_v<Key, K>)
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::insert(const_iterator position, K&& x)
+        {
+            return IteratorAt(TryInsertHintIndex(position, std::forward<K>(x)));
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <std::input_iterator InputIterator>
+        void flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::insert(InputIterator first, InputIterator last)
+        {
+            InsertRange(first, last, false);
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <std::input_iterator InputIterator>
+        void flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::insert(sorted_tag_type, InputIterator first, InputIterator last)
+        {
+            InsertRange(first, last, true);
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <Detail::container_compatible_range<Key> R>
+        void flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::insert_range(R&& rg)
+        {
+            InsertRange(std::ranges::begin(rg), std::ranges::end(rg), false);
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        void flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::insert(std::initializer_list<value_type> il)
+        {
+            InsertRange(il.begin(), il.end(), false);
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        void flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::insert(sorted_tag_type, std::initializer_list<value_type> il)
+        {
+            InsertRange(il.begin(), il.end(), true);
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::container_type flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::extract() &&
+        {
+            container_type result = std::move(c);
+            clear();
+            return result;
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        void flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::replace(container_type&& cont)
+        {
+            assert((Detail::flat_is_sorted<!Multi>(cont, compare)));
+
+            Detail::flat_clear_guard guard(*this);
+            c = std::move(cont);
+            index.Rebuild(c);
+            guard.Release();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::erase(const_iterator position)
+        {
+            const size_type i = IndexOf(position);
+            EraseIndices(i, i + 1);
+            return IteratorAt(i);
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::size_type flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::erase(const key_type& x)
+        {
+            const auto [first, last] = EqualRangeIndices(x);
+            EraseIndices(first, last);
+            return last - first;
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare> && !std::is_convertible_v<K&&, typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator> &&
+                !std::is_convertible_v<K&&, typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::const_iterator>)
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::size_type flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::erase(K&& x)
+        {
+            const auto [first, last] = EqualRangeIndices(x);
+            EraseIndices(first, last);
+            return last - first;
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::erase(const_iterator first, const_iterator last)
+        {
+            const size_type firstIndex = IndexOf(first);
+            EraseIndices(firstIndex, IndexOf(last));
+            return IteratorAt(firstIndex);
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        void flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::swap(flat_set_base& y) noexcept
+        {
+            using std::swap;
+            swap(c, y.c);
+            swap(compare, y.compare);
+            swap(index, y.index);
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        void flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::clear() noexcept
+        {
+            c.clear();
+            index.Clear();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::key_compare flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::key_comp() const
+        {
+            return compare;
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::value_compare flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::value_comp() const
+        {
+            return compare;
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::find(const key_type& x) const
+        {
+            return IteratorAt(FindIndex(x));
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare>)
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::find(const K& x) const
+        {
+            return IteratorAt(FindIndex(x));
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::size_type flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::count(const key_type& x) const
+        {
+            const auto [first, last] = EqualRangeIndices(x);
+            return last - first;
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare>)
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::size_type flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::count(const K& x) const
+        {
+            const auto [first, last] = EqualRangeIndices(x);
+            return last - first;
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        bool flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::contains(const key_type& x) const
+        {
+            return FindIndex(x) != size();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare>)
+        bool flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::contains(const K& x) const
+        {
+            return FindIndex(x) != size();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::lower_bound(const key_type& x) const
+        {
+            return IteratorAt(LowerBoundIndex(x));
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare>)
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::lower_bound(const K& x) const
+        {
+            return IteratorAt(LowerBoundIndex(x));
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::upper_bound(const key_type& x) const
+        {
+            return IteratorAt(UpperBoundIndex(x));
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare>)
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::upper_bound(const K& x) const
+        {
+            return IteratorAt(UpperBoundIndex(x));
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        std::pair<typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator, typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator> flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::equal_range(const key_type& x) const
+        {
+            const auto [first, last] = EqualRangeIndices(x);
+            return {IteratorAt(first), IteratorAt(last)};
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+            requires (Detail::transparent_compare<Compare>)
+        std::pair<typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator, typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator> flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::equal_range(const K& x) const
+        {
+            const auto [first, last] = EqualRangeIndices(x);
+            return {IteratorAt(first), IteratorAt(last)};
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        bool flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::Equals(const flat_set_base& other) const
+        {
+            return c == other.c;
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        auto flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::Compare3Way(const flat_set_base& other) const
+        {
+            return std::lexicographical_compare_three_way(begin(), end(), other.begin(), other.end(), Detail::synth_three_way);
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::iterator flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::IteratorAt(size_type i) const noexcept
+        {
+            return c.cbegin() + static_cast<difference_type>(i);
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::size_type flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::IndexOf(const_iterator position) const noexcept
+        {
+            return static_cast<size_type>(position - c.cbegin());
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::size_type flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::LowerBoundIndex(const K& x) const
+        {
+            return index.LowerBound(c, compare, x);
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::size_type flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::UpperBoundIndex(const K& x) const
+        {
+            return index.UpperBound(c, compare, x);
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::size_type flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::FindIndex(const K& x) const
+        {
+            const size_type i = LowerBoundIndex(x);
+            return (i != size() && !compare(x, c[i])) ? i : size();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+        std::pair<typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::size_type, typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::size_type> flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::EqualRangeIndices(const K& x) const
+        {
+            const size_type first = LowerBoundIndex(x);
+            if constexpr (Multi)
+            {
+                const size_type count = static_cast<size_type>(Detail::flat_branchless_upper_bound(
+                    c.begin() + static_cast<difference_type>(first), size() - first, x, compare) - c.begin()) - first;
+                return {first, first + count};
+            }
+            else
+            {
+                return {first, (first != size() && !compare(x, c[first])) ? first + 1 : first};
+            }
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class K>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::size_type flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::MultiHintIndex(const_iterator hint, const K& x) const
+        {
+            const size_type h = IndexOf(hint);
+            if (h != 0 && compare(x, c[h - 1]))
+            {
+                // It belongs before the hint, so the closest is after the last element that isn't after it.
+                return static_cast<size_type>(Detail::flat_branchless_upper_bound(c.begin(), h, x, compare) - c.begin());
+            }
+            if (h != size() && compare(c[h], x))
+            {
+                // It belongs after the hint, so the closest is before the first element that isn't before it.
+                return static_cast<size_type>(Detail::flat_branchless_lower_bound(
+                    c.begin() + static_cast<difference_type>(h), size() - h, x, compare) - c.begin());
+            }
+            return h;
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class Arg>
+        void flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::InsertAt(size_type i, Arg&& x)
+        {
+            Detail::flat_clear_guard guard(*this);
+            c.emplace(c.begin() + static_cast<difference_type>(i), std::forward<Arg>(x));
+            index.Rebuild(c);
+            guard.Release();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class Arg>
+        std::pair<typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::size_type, bool> flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::TryInsertIndex(Arg&& x)
+        {
+            const size_type i = LowerBoundIndex(x);
+            if (i != size() && !compare(x, c[i]))
+            {
+                return {i, false};
+            }
+
+            InsertAt(i, std::forward<Arg>(x));
+            return {i, true};
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class Arg>
+        typename flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::size_type flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::TryInsertHintIndex(const_iterator hint, Arg&& x)
+        {
+            // A correct hint saves the search. Otherwise, including when the key is already there, search as usual.
+            const size_type h = IndexOf(hint);
+            if ((h == 0 || compare(c[h - 1], x)) && (h == size() || compare(x, c[h])))
+            {
+                InsertAt(h, std::forward<Arg>(x));
+                return h;
+            }
+            return TryInsertIndex(std::forward<Arg>(x)).first;
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        template <class InputIterator, class Sentinel>
+        void flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::InsertRange(InputIterator first, Sentinel last, bool isSorted)
+        {
+            Detail::flat_clear_guard guard(*this);
+
+            const size_type oldSize = size();
+            for (; first != last; ++first)
+            {
+                c.insert(c.end(), *first);
+            }
+
+            Detail::flat_sort_and_merge_tail<!Multi>(compare, oldSize, isSorted, c);
+            index.Rebuild(c);
+            guard.Release();
+        }
+
+        template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, bool Multi>
+        void flat_set_base<Key, Compare, KeyContainer, SearchMode, Multi>::EraseIndices(size_type first, size_type last)
+        {
+            if (first == last)
+            {
+                return;
+            }
+
+            Detail::flat_clear_guard guard(*this);
+            c.erase(c.begin() + static_cast<difference_type>(first), c.begin() + static_cast<difference_type>(last));
+            index.Rebuild(c);
+            guard.Release();
+        }
+
+        /**
+         * @brief The body of `erase_if` for both flat sets.
+         */
+        template <class FlatSet, class Predicate>
+        typename FlatSet::size_type flat_set_erase_if(FlatSet& c, Predicate& pred)
+        {
+            using size_type = typename FlatSet::size_type;
+
+            auto keys = std::move(c).extract();
+            const auto newEnd = std::remove_if(keys.begin(), keys.end(),
+                [&pred](const auto& key) { return static_cast<bool>(pred(key)); });
+            const size_type removed = static_cast<size_type>(keys.end() - newEnd);
+            keys.erase(newEnd, keys.end());
+            c.replace(std::move(keys));
+            return removed;
+        }
+    }
+
+    template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode>
+    flat_set<Key, Compare, KeyContainer, SearchMode>::flat_set(std::initializer_list<Key> il, const typename base_type::key_compare& comp)
+        : base_type(il, comp)
+    {
+    }
+
+    template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode>
+    flat_set<Key, Compare, KeyContainer, SearchMode>& flat_set<Key, Compare, KeyContainer, SearchMode>::operator=(std::initializer_list<Key> il)
+    {
+        this->clear();
+        this->insert(il);
+        return *this;
+    }
+
+    template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode>
+    flat_multiset<Key, Compare, KeyContainer, SearchMode>::flat_multiset(std::initializer_list<Key> il, const typename base_type::key_compare& comp)
+        : base_type(il, comp)
+    {
+    }
+
+    template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode>
+    flat_multiset<Key, Compare, KeyContainer, SearchMode>& flat_multiset<Key, Compare, KeyContainer, SearchMode>::operator=(std::initializer_list<Key> il)
+    {
+        this->clear();
+        this->insert(il);
+        return *this;
+    }
+
+    template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, class Predicate>
+    typename flat_set<Key, Compare, KeyContainer, SearchMode>::size_type
+        erase_if(flat_set<Key, Compare, KeyContainer, SearchMode>& c, Predicate pred)
+    {
+        return Detail::flat_set_erase_if(c, pred);
+    }
+
+    template <class Key, class Compare, class KeyContainer, flat_search_mode SearchMode, class Predicate>
+    typename flat_multiset<Key, Compare, KeyContainer, SearchMode>::size_type
+        erase_if(flat_multiset<Key, Compare, KeyContainer, SearchMode>& c, Predicate pred)
+    {
+        return Detail::flat_set_erase_if(c, pred);
+    }
+}
@@ -0,0 +1,221 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/utility.h>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief The size up to which the flat containers look up arithmetic keys with a linear scan over the whole key
+ *        container instead of a binary search. The scan has no data-dependent branches and uses SSE2, AVX2, or NEON when
+ *        available, which beats a binary search's dependent loads on small tables. The crossover is further out the
+ *        wider the vectors are. Define it before including this header to change it for the whole build, or to 0 to
+ *        disable the scan.
+ */
+#ifndef CPPUTILS_STDREIMPL_FLAT_LINEAR_SEARCH_THRESHOLD
+#   if defined(__AVX2__)
+#       define CPPUTILS_STDREIMPL_FLAT_LINEAR_SEARCH_THRESHOLD 32
+#   else
+#       define CPPUTILS_STDREIMPL_FLAT_LINEAR_SEARCH_THRESHOLD 16
+#   endif
+#endif
+
+namespace StdReimpl
+{
+    /**
+     * @see https://eel.is/c++draft/flat.map.syn
+     * @note A feature from the C++23 standard.
+     */
+    struct sorted_unique_t
+    {
+        explicit sorted_unique_t() = default;
+    };
+
+    inline constexpr sorted_unique_t sorted_unique{};
+
+    /**
+     * @see https://eel.is/c++draft/flat.map.syn
+     * @note A feature from the C++23 standard.
+     */
+    struct sorted_equivalent_t
+    {
+        explicit sorted_equivalent_t() = default;
+    };
+
+    inline constexpr sorted_equivalent_t sorted_equivalent{};
+
+    /**
+     * @brief How the flat containers search their keys.
+     * @note Not part of the standard. It's the last template parameter of the flat containers, after the standard ones.
+     */
+    enum class flat_search_mode
+    {
+        /**
+         * @brief A branchless binary search over the sorted keys. No extra memory, and every modification stays as cheap
+         *        as the standard's.
+         */
+        binary,
+
+        /**
+         * @brief Also keeps a copy of the keys in Eytzinger (breadth-first) order, which a search walks top-down so that
+         *        the next few levels are already in cache, at the cost of that copy plus an index per key. The copy is
+         *        rebuilt after every modification, so use this for read-mostly tables that are built in bulk, e.g., with
+         *        a `sorted_unique` constructor or `replace`.
+         */
+        eytzinger,
+    };
+
+    namespace Detail
+    {
+        /**
+         * @brief Whether `Compare` is transparent, which is what enables the heterogeneous lookup overloads.
+         */
+        template <class Compare>
+        concept transparent_compare = requires { typename Compare::is_transparent; };
+
+        /**
+         * @brief Whether looking up `K` in sorted keys of type `Key` is the same as counting the keys less than it, using
+         *        the builtin `<`. That's what the linear scan does.
+         */
+        template <class Key, class Compare, class KeyContainer, class K>
+        concept flat_linear_searchable =
+            std::is_arithmetic_v<Key> && !std::is_same_v<Key, bool> &&
+            std::is_same_v<std::remove_cvref_t<K>, Key> &&
+            (std::is_same_v<Compare, std::less<Key>> || std::is_same_v<Compare, std::less<>>) &&
+            std::contiguous_iterator<typename KeyContainer::const_iterator>;
+
+        /**
+         * @brief The number of the `count` elements at `data` that are less than `key` or, if `Greater`, greater than it.
+         */
+        template <bool Greater, class T>
+        std::size_t flat_count_compare(const T* data, std::size_t count, T key) noexcept;
+
+        /**
+         * @brief Branchless binary searches over `[first, first + count)`. The loop always runs `log2(count)` times and
+         *        the compiler turns the step into a conditional move, so there's nothing to mispredict.
+         */
+        template <class RandomAccessIterator, class K, class Compare>
+        RandomAccessIterator flat_branchless_lower_bound(RandomAccessIterator first, std::size_t count, const K& key, const Compare& compare);
+
+        template <class RandomAccessIterator, class K, class Compare>
+        RandomAccessIterator flat_branchless_upper_bound(RandomAccessIterator first, std::size_t count, const K& key, const Compare& compare);
+
+        /**
+         * @brief The search structure of a flat container. Finds the index of a key's lower or upper bound in the sorted
+         *        key container that it's given, which must be the one that it was last `Rebuild` from.
+         */
+        template <class Key, class Compare, flat_search_mode Mode>
+        class flat_tree_index
+        {
+        public:
+            template <class KeyContainer>
+            void Rebuild(const KeyContainer&)
+            {
+            }
+
+            void Clear() noexcept
+            {
+            }
+
+            template <class KeyContainer, class K>
+            std::size_t LowerBound(const KeyContainer& keys, const Compare& compare, const K& key) const;
+
+            template <class KeyContainer, class K>
+            std::size_t UpperBound(const KeyContainer& keys, const Compare& compare, const K& key) const;
+        };
+
+        template <class Key, class Compare>
+        class flat_tree_index<Key, Compare, flat_search_mode::eytzinger>
+        {
+        public:
+            template <class KeyContainer>
+            void Rebuild(const KeyContainer& keys);
+
+            void Clear() noexcept;
+
+            template <class KeyContainer, class K>
+            std::size_t LowerBound(const KeyContainer& keys, const Compare& compare, const K& key) const;
+
+            template <class KeyContainer, class K>
+            std::size_t UpperBound(const KeyContainer& keys, const Compare& compare, const K& key) const;
+
+        private:
+            /**
+             * @brief Walks the tree from the root, going right while `goRight` says the key at a node is before the key
+             *        we search for. Returns the sorted index of the last node we went left at, or `size` if none.
+             */
+            template <class GoRight>
+            std::size_t Search(std::size_t size, GoRight goRight) const;
+
+            /**
+             * @brief Fills `sorted_indices` by an in-order walk of the subtree rooted at the 1-based `node`.
+             */
+            void AssignSortedIndices(std::size_t node, std::size_t& nextSortedIndex) noexcept;
+
+            // The keys in Eytzinger order, 0-based: the children of the key at `i` are at `2i + 1` and `2i + 2`.
+            std::vector<Key> eytzinger_keys;
+
+            // For each element of `eytzinger_keys`, its index in the sorted key container.
+            std::vector<std::size_t> sorted_indices;
+        };
+
+        /**
+         * @brief Restores a flat container's invariants by clearing it if the scope exits through an exception, as the
+         *        standard allows.
+         */
+        template <class FlatContainer>
+        class flat_clear_guard
+        {
+        public:
+            explicit flat_clear_guard(FlatContainer& inContainer) noexcept
+                : container(&inContainer)
+            {
+            }
+
+            flat_clear_guard(const flat_clear_guard&) = delete;
+            flat_clear_guard& operator=(const flat_clear_guard&) = delete;
+
+            ~flat_clear_guard()
+            {
+                if (container)
+                {
+                    container->clear();
+                }
+            }
+
+            void Release() noexcept
+            {
+                container = nullptr;
+            }
+
+        private:
+            FlatContainer* container;
+        };
+
+        /**
+         * @brief Makes `keys` (and the `values` containers that run parallel to it) sorted again, after elements were
+         *        appended to them from `oldSize` on. `[0, oldSize)` must already be sorted, and unique if `Unique`.
+         *
+         *        The appended elements are stable sorted by index, unless `tailIsSorted` says they already are, and then
+         *        merged behind their equivalents that were already there. If `Unique`, an element equivalent to one
+         *        before it is dropped, so existing elements win, and then the first one appended.
+         */
+        template <bool Unique, class Compare, class KeyContainer, class... ValueContainers>
+        void flat_sort_and_merge_tail(const Compare& compare, std::size_t oldSize, bool tailIsSorted, KeyContainer& keys, ValueContainers&... values);
+
+        /**
+         * @brief Whether `keys` is sorted and, if `Unique`, has no equivalent elements. Used to check the preconditions of
+         *        the `sorted_unique` and `sorted_equivalent` overloads in debug builds.
+         */
+        template <bool Unique, class Compare, class KeyContainer>
+        bool flat_is_sorted(const KeyContainer& keys, const Compare& compare);
+    }
+}
+
+#include <CppUtils/StdReimpl/flat_tree.inl>
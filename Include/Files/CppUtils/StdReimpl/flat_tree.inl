@@ -0,0 +1,539 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/flat_tree.h>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <tuple>
+#include <utility>
+
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#   define CPPUTILS_STDREIMPL_FLAT_USE_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   if defined(__SSE4_2__)
+#       include <nmmintrin.h>
+#   else
+#       include <emmintrin.h>
+#   endif
+#   define CPPUTILS_STDREIMPL_FLAT_USE_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#   include <arm_neon.h>
+#   define CPPUTILS_STDREIMPL_FLAT_USE_NEON 1
+#endif
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+#if defined(CPPUTILS_STDREIMPL_FLAT_USE_SSE2) || defined(CPPUTILS_STDREIMPL_FLAT_USE_AVX2)
+        /**
+         * @brief Adds up the lanes of a vector of counts.
+         */
+        inline std::size_t flat_sum_epi32(__m128i counts) noexcept
+        {
+            counts = _mm_add_epi32(counts, _mm_shuffle_epi32(counts, _MM_SHUFFLE(1, 0, 3, 2)));
+            counts = _mm_add_epi32(counts, _mm_shuffle_epi32(counts, _MM_SHUFFLE(2, 3, 0, 1)));
+            return static_cast<std::size_t>(_mm_cvtsi128_si32(counts));
+        }
+
+        inline std::size_t flat_sum_epi64(__m128i counts) noexcept
+        {
+            // Fewer than 2^32 keys are ever scanned, so the low halves are enough.
+            counts = _mm_add_epi64(counts, _mm_unpackhi_epi64(counts, counts));
+            return static_cast<std::size_t>(_mm_cvtsi128_si32(counts));
+        }
+#endif
+
+#if defined(CPPUTILS_STDREIMPL_FLAT_USE_AVX2)
+        inline std::size_t flat_sum_epi32(__m256i counts) noexcept
+        {
+            return Detail::flat_sum_epi32(_mm_add_epi32(_mm256_castsi256_si128(counts), _mm256_extracti128_si256(counts, 1)));
+        }
+
+        inline std::size_t flat_sum_epi64(__m256i counts) noexcept
+        {
+            return Detail::flat_sum_epi64(_mm_add_epi64(_mm256_castsi256_si128(counts), _mm256_extracti128_si256(counts, 1)));
+        }
+#endif
+
+        template <bool Greater, class T>
+        std::size_t flat_count_compare(const T* data, std::size_t count, T key) noexcept
+        {
+            std::size_t result = 0;
+            std::size_t i = 0;
+
+            // The vector paths compare a whole register of keys at once. A matching lane is all ones, i.e., -1, so
+            // subtracting the masks from an accumulator counts the matches per lane, and we add the lanes up at the end.
+            // There's only a signed integer compare, so unsigned keys are biased into signed range first.
+#if defined(CPPUTILS_STDREIMPL_FLAT_USE_AVX2)
+            if constexpr (std::is_same_v<T, float>)
+            {
+                const __m256 k = _mm256_set1_ps(key);
+                __m256i counts = _mm256_setzero_si256();
+                for (; i + 8 <= count; i += 8)
+                {
+                    const __m256 v = _mm256_loadu_ps(data + i);
+                    const __m256 mask = Greater ? _mm256_cmp_ps(k, v, _CMP_LT_OQ) : _mm256_cmp_ps(v, k, _CMP_LT_OQ);
+                    counts = _mm256_sub_epi32(counts, _mm256_castps_si256(mask));
+                }
+                result = Detail::flat_sum_epi32(counts);
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                const __m256d k = _mm256_set1_pd(key);
+                __m256i counts = _mm256_setzero_si256();
+                for (; i + 4 <= count; i += 4)
+                {
+                    const __m256d v = _mm256_loadu_pd(data + i);
+                    const __m256d mask = Greater ? _mm256_cmp_pd(k, v, _CMP_LT_OQ) : _mm256_cmp_pd(v, k, _CMP_LT_OQ);
+                    counts = _mm256_sub_epi64(counts, _mm256_castpd_si256(mask));
+                }
+                result = Detail::flat_sum_epi64(counts);
+            }
+            else if constexpr (std::is_integral_v<T> && sizeof(T) == 4)
+            {
+                const __m256i bias = _mm256_set1_epi32(std::is_signed_v<T> ? 0 : INT32_MIN);
+                const __m256i k = _mm256_xor_si256(_mm256_set1_epi32(static_cast<std::int32_t>(key)), bias);
+                __m256i counts = _mm256_setzero_si256();
+                for (; i + 8 <= count; i += 8)
+                {
+                    const __m256i v = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), bias);
+                    counts = _mm256_sub_epi32(counts, Greater ? _mm256_cmpgt_epi32(v, k) : _mm256_cmpgt_epi32(k, v));
+                }
+                result = Detail::flat_sum_epi32(counts);
+            }
+            else if constexpr (std::is_integral_v<T> && sizeof(T) == 8)
+            {
+                const __m256i bias = _mm256_set1_epi64x(std::is_signed_v<T> ? 0 : INT64_MIN);
+                const __m256i k = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<std::int64_t>(key)), bias);
+                __m256i counts = _mm256_setzero_si256();
+                for (; i + 4 <= count; i += 4)
+                {
+                    const __m256i v = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), bias);
+                    counts = _mm256_sub_epi64(counts, Greater ? _mm256_cmpgt_epi64(v, k) : _mm256_cmpgt_epi64(k, v));
+                }
+                result = Detail::flat_sum_epi64(counts);
+            }
+#elif defined(CPPUTILS_STDREIMPL_FLAT_USE_SSE2)
+            if constexpr (std::is_same_v<T, float>)
+            {
+                const __m128 k = _mm_set1_ps(key);
+                __m128i counts = _mm_setzero_si128();
+                for (; i + 4 <= count; i += 4)
+                {
+                    const __m128 v = _mm_loadu_ps(data + i);
+                    counts = _mm_sub_epi32(counts, _mm_castps_si128(Greater ? _mm_cmplt_ps(k, v) : _mm_cmplt_ps(v, k)));
+                }
+                result = Detail::flat_sum_epi32(counts);
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                const __m128d k = _mm_set1_pd(key);
+                __m128i counts = _mm_setzero_si128();
+                for (; i + 2 <= count; i += 2)
+                {
+                    const __m128d v = _mm_loadu_pd(data + i);
+                    counts = _mm_sub_epi64(counts, _mm_castpd_si128(Greater ? _mm_cmplt_pd(k, v) : _mm_cmplt_pd(v, k)));
+                }
+                result = Detail::flat_sum_epi64(counts);
+            }
+            else if constexpr (std::is_integral_v<T> && sizeof(T) == 4)
+            {
+                const __m128i bias = _mm_set1_epi32(std::is_signed_v<T> ? 0 : INT32_MIN);
+                const __m128i k = _mm_xor_si128(_mm_set1_epi32(static_cast<std::int32_t>(key)), bias);
+                __m128i counts = _mm_setzero_si128();
+                for (; i + 4 <= count; i += 4)
+                {
+                    const __m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), bias);
+                    counts = _mm_sub_epi32(counts, Greater ? _mm_cmpgt_epi32(v, k) : _mm_cmpgt_epi32(k, v));
+                }
+                result = Detail::flat_sum_epi32(counts);
+            }
+#if defined(__SSE4_2__)
+            else if constexpr (std::is_integral_v<T> && sizeof(T) == 8)
+            {
+                const __m128i bias = _mm_set1_epi64x(std::is_signed_v<T> ? 0 : INT64_MIN);
+                const __m128i k = _mm_xor_si128(_mm_set1_epi64x(static_cast<std::int64_t>(key)), bias);
+                __m128i counts = _mm_setzero_si128();
+                for (; i + 2 <= count; i += 2)
+                {
+                    const __m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), bias);
+                    counts = _mm_sub_epi64(counts, Greater ? _mm_cmpgt_epi64(v, k) : _mm_cmpgt_epi64(k, v));
+                }
+                result = Detail::flat_sum_epi64(counts);
+            }
+#endif
+#elif defined(CPPUTILS_STDREIMPL_FLAT_USE_NEON)
+            // NEON has unsigned compares, so there's no bias. A matching lane is all ones, so we shift it down to 1 and
+            // add the lanes up.
+            if constexpr (std::is_same_v<T, float>)
+            {
+                const float32x4_t k = vdupq_n_f32(key);
+                for (; i + 4 <= count; i += 4)
+                {
+                    const float32x4_t v = vld1q_f32(data + i);
+                    const uint32x4_t mask = Greater ? vcltq_f32(k, v) : vcltq_f32(v, k);
+                    result += vaddvq_u32(vshrq_n_u32(mask, 31));
+                }
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                const float64x2_t k = vdupq_n_f64(key);
+                for (; i + 2 <= count; i += 2)
+                {
+                    const float64x2_t v = vld1q_f64(data + i);
+                    const uint64x2_t mask = Greater ? vcltq_f64(k, v) : vcltq_f64(v, k);
+                    result += static_cast<std::size_t>(vaddvq_u64(vshrq_n_u64(mask, 63)));
+                }
+            }
+            else if constexpr (std::is_integral_v<T> && std::is_signed_v<T> && sizeof(T) == 4)
+            {
+                const int32x4_t k = vdupq_n_s32(static_cast<std::int32_t>(key));
+                for (; i + 4 <= count; i += 4)
+                {
+                    const int32x4_t v = vld1q_s32(reinterpret_cast<const std::int32_t*>(data + i));
+                    const uint32x4_t mask = Greater ? vcltq_s32(k, v) : vcltq_s32(v, k);
+                    result += vaddvq_u32(vshrq_n_u32(mask, 31));
+                }
+            }
+            else if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T> && sizeof(T) == 4)
+            {
+                const uint32x4_t k = vdupq_n_u32(static_cast<std::uint32_t>(key));
+                for (; i + 4 <= count; i += 4)
+                {
+                    const uint32x4_t v = vld1q_u32(reinterpret_cast<const std::uint32_t*>(data + i));
+                    const uint32x4_t mask = Greater ? vcltq_u32(k, v) : vcltq_u32(v, k);
+                    result += vaddvq_u32(vshrq_n_u32(mask, 31));
+                }
+            }
+            else if constexpr (std::is_integral_v<T> && std::is_signed_v<T> && sizeof(T) == 8)
+            {
+                const int64x2_t k = vdupq_n_s64(static_cast<std::int64_t>(key));
+                for (; i + 2 <= count; i += 2)
+                {
+                    const int64x2_t v = vld1q_s64(reinterpret_cast<const std::int64_t*>(data + i));
+                    const uint64x2_t mask = Greater ? vcltq_s64(k, v) : vcltq_s64(v, k);
+                    result += static_cast<std::size_t>(vaddvq_u64(vshrq_n_u64(mask, 63)));
+                }
+            }
+            else if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T> && sizeof(T) == 8)
+            {
+                const uint64x2_t k = vdupq_n_u64(static_cast<std::uint64_t>(key));
+                for (; i + 2 <= count; i += 2)
+                {
+                    const uint64x2_t v = vld1q_u64(reinterpret_cast<const std::uint64_t*>(data + i));
+                    const uint64x2_t mask = Greater ? vcltq_u64(k, v) : vcltq_u64(v, k);
+                    result += static_cast<std::size_t>(vaddvq_u64(vshrq_n_u64(mask, 63)));
+                }
+            }
+#endif
+
+            // The scalar tail, and the whole range for other key types. Still branchless, and compilers vectorize it.
+            for (; i < count; ++i)
+            {
+                result += static_cast<std::size_t>(Greater ? (key < data[i]) : (data[i] < key));
+            }
+
+            return result;
+        }
+
+        template <class RandomAccessIterator, class K, class Compare>
+        RandomAccessIterator flat_branchless_lower_bound(RandomAccessIterator first, std::size_t count, const K& key, const Compare& compare)
+        {
+            using Difference = std::iter_difference_t<RandomAccessIterator>;
+
+            if (count == 0)
+            {
+                return first;
+            }
+
+            // Halve the range every step, keeping the half that the answer is in. Only the start moves, and only by a
+            // select, so the loop has no branch other than its own.
+            while (count > 1)
+            {
+                const std::size_t half = count / 2;
+                first += static_cast<Difference>(static_cast<bool>(compare(first[static_cast<Difference>(half)], key)) ? half : 0);
+                count -= half;
+            }
+            return first + static_cast<Difference>(static_cast<bool>(compare(*first, key)));
+        }
+
+        template <class RandomAccessIterator, class K, class Compare>
+        RandomAccessIterator flat_branchless_upper_bound(RandomAccessIterator first, std::size_t count, const K& key, const Compare& compare)
+        {
+            using Difference = std::iter_difference_t<RandomAccessIterator>;
+
+            if (count == 0)
+            {
+                return first;
+            }
+
+            while (count > 1)
+            {
+                const std::size_t half = count / 2;
+                first += static_cast<Difference>(!static_cast<bool>(compare(key, first[static_cast<Difference>(half)])) ? half : 0);
+                count -= half;
+            }
+            return first + static_cast<Difference>(!static_cast<bool>(compare(key, *first)));
+        }
+
+        /**
+         * @brief The linear scan for small tables, or `false` if it doesn't apply.
+         */
+        template <bool Upper, class Key, class Compare, class KeyContainer, class K>
+        bool flat_try_linear_search(const KeyContainer& keys, const K& key, std::size_t& result) noexcept
+        {
+            if constexpr (Detail::flat_linear_searchable<Key, Compare, KeyContainer, K>)
+            {
+                const std::size_t size = keys.size();
+                if (size <= CPPUTILS_STDREIMPL_FLAT_LINEAR_SEARCH_THRESHOLD)
+                {
+                    const Key* data = std::to_address(keys.begin());
+                    if constexpr (Upper)
+                    {
+                        result = size - Detail::flat_count_compare<true, Key>(data, size, key);
+                    }
+                    else
+                    {
+                        result = Detail::flat_count_compare<false, Key>(data, size, key);
+                    }
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template <class Key, class Compare, flat_search_mode Mode>
+        template <class KeyContainer, class K>
+        std::size_t flat_tree_index<Key, Compare, Mode>::LowerBound(const KeyContainer& keys, const Compare& compare, const K& key) const
+        {
+            std::size_t result = 0;
+            if (Detail::flat_try_linear_search<false, Key, Compare>(keys, key, result))
+            {
+                return result;
+            }
+            return static_cast<std::size_t>(Detail::flat_branchless_lower_bound(keys.begin(), keys.size(), key, compare) - keys.begin());
+        }
+
+        template <class Key, class Compare, flat_search_mode Mode>
+        template <class KeyContainer, class K>
+        std::size_t flat_tree_index<Key, Compare, Mode>::UpperBound(const KeyContainer& keys, const Compare& compare, const K& key) const
+        {
+            std::size_t result = 0;
+            if (Detail::flat_try_linear_search<true, Key, Compare>(keys, key, result))
+            {
+                return result;
+            }
+            return static_cast<std::size_t>(Detail::flat_branchless_upper_bound(keys.begin(), keys.size(), key, compare) - keys.begin());
+        }
+
+        template <class Key, class Compare>
+        template <class KeyContainer>
+        void flat_tree_index<Key, Compare, flat_search_mode::eytzinger>::Rebuild(const KeyContainer& keys)
+        {
+            const std::size_t size = keys.size();
+
+            sorted_indices.resize(size);
+            std::size_t nextSortedIndex = 0;
+            AssignSortedIndices(1, nextSortedIndex);
+
+            eytzinger_keys.clear();
+            eytzinger_keys.reserve(size);
+            for (const std::size_t sortedIndex : sorted_indices)
+            {
+                eytzinger_keys.push_back(keys[sortedIndex]);
+            }
+        }
+
+        template <class Key, class Compare>
+        void flat_tree_index<Key, Compare, flat_search_mode::eytzinger>::Clear() noexcept
+        {
+            eytzinger_keys.clear();
+            sorted_indices.clear();
+        }
+
+        template <class Key, class Compare>
+        template <class KeyContainer, class K>
+        std::size_t flat_tree_index<Key, Compare, flat_search_mode::eytzinger>::LowerBound(const KeyContainer& keys, const Compare& compare, const K& key) const
+        {
+            assert(eytzinger_keys.size() == keys.size());
+
+            std::size_t result = 0;
+            if (Detail::flat_try_linear_search<false, Key, Compare>(keys, key, result))
+            {
+                return result;
+            }
+            return Search(keys.size(), [&compare, &key](const Key& element) { return static_cast<bool>(compare(element, key)); });
+        }
+
+        template <class Key, class Compare>
+        template <class KeyContainer, class K>
+        std::size_t flat_tree_index<Key, Compare, flat_search_mode::eytzinger>::UpperBound(const KeyContainer& keys, const Compare& compare, const K& key) const
+        {
+            assert(eytzinger_keys.size() == keys.size());
+
+            std::size_t result = 0;
+            if (Detail::flat_try_linear_search<true, Key, Compare>(keys, key, result))
+            {
+                return result;
+            }
+            return Search(keys.size(), [&compare, &key](const Key& element) { return !static_cast<bool>(compare(key, element)); });
+        }
+
+        template <class Key, class Compare>
+        template <class GoRight>
+        std::size_t flat_tree_index<Key, Compare, flat_search_mode::eytzinger>::Search(std::size_t size, GoRight goRight) const
+        {
+            const Key* keys = eytzinger_keys.data();
+
+            // 1-based, so that the children of `node` are `2 * node` and `2 * node + 1`.
+            std::size_t node = 1;
+            while (node <= size)
+            {
+#if defined(__GNUC__) || defined(__clang__)
+                if constexpr (sizeof(Key) <= 8)
+                {
+                    // The descendants four levels down are contiguous, and share one or two cache lines for small keys, so
+                    // fetch them while we work through the levels in between. Prefetching past the end is harmless, but we
+                    // compute the address as an integer so that we never form an out of bounds pointer.
+                    __builtin_prefetch(reinterpret_cast<const void*>(reinterpret_cast<std::uintptr_t>(keys) + 16 * node * sizeof(Key)));
+                }
+#endif
+                node = 2 * node + static_cast<std::size_t>(goRight(keys[node - 1]));
+            }
+
+            // Every step appended a bit to `node`: 1 for right, 0 for left. The answer is the last node where we went left,
+            // so drop the trailing right turns and then the left turn itself. Nothing is left if we only ever went right.
+            node >>= std::countr_one(node) + 1;
+            return node == 0 ? size : sorted_indices[node - 1];
+        }
+
+        template <class Key, class Compare>
+        void flat_tree_index<Key, Compare, flat_search_mode::eytzinger>::AssignSortedIndices(std::size_t node, std::size_t& nextSortedIndex) noexcept
+        {
+            if (node > sorted_indices.size())
+            {
+                return;
+            }
+
+            AssignSortedIndices(2 * node, nextSortedIndex);
+            sorted_indices[node - 1] = nextSortedIndex++;
+            AssignSortedIndices(2 * node + 1, nextSortedIndex);
+        }
+
+        template <class Container>
+        void flat_reserve(Container& container, std::size_t size)
+        {
+            if constexpr (requires { container.reserve(size); })
+            {
+                container.reserve(size);
+            }
+        }
+
+        template <bool Unique, class ForwardIterator, class Compare>
+        bool flat_is_sorted(ForwardIterator first, ForwardIterator last, const Compare& compare)
+        {
+            if constexpr (Unique)
+            {
+                return std::adjacent_find(first, last,
+                    [&compare](const auto& a, const auto& b) { return !static_cast<bool>(compare(a, b)); }) == last;
+            }
+            else
+            {
+                return std::is_sorted(first, last, compare);
+            }
+        }
+
+        template <bool Unique, class Compare, class KeyContainer>
+        bool flat_is_sorted(const KeyContainer& keys, const Compare& compare)
+        {
+            return Detail::flat_is_sorted<Unique>(keys.begin(), keys.end(), compare);
+        }
+
+        template <bool Unique, class Compare, class KeyContainer, class... ValueContainers>
+        void flat_sort_and_merge_tail(const Compare& compare, std::size_t oldSize, bool tailIsSorted, KeyContainer& keys, ValueContainers&... values)
+        {
+            const std::size_t size = keys.size();
+            const std::size_t tailSize = size - oldSize;
+            const auto tailBegin = keys.begin() + static_cast<std::iter_difference_t<typename KeyContainer::iterator>>(oldSize);
+
+            tailIsSorted = tailIsSorted || Detail::flat_is_sorted<Unique>(tailBegin, keys.end(), compare);
+
+            // Appending after everything that was already there is the common case, and has nothing left to do.
+            if (tailSize == 0 ||
+                (tailIsSorted && (oldSize == 0 ||
+                    (Unique ? static_cast<bool>(compare(keys[oldSize - 1], keys[oldSize])) : !static_cast<bool>(compare(keys[oldSize], keys[oldSize - 1]))))))
+            {
+                return;
+            }
+
+            // Sort the indices of the tail rather than the elements, so that the keys and values stay together. Empty
+            // means the tail is in order already.
+            std::vector<std::size_t> tailOrder;
+            if (!tailIsSorted)
+            {
+                tailOrder.resize(tailSize);
+                std::iota(tailOrder.begin(), tailOrder.end(), oldSize);
+                std::stable_sort(tailOrder.begin(), tailOrder.end(),
+                    [&compare, &keys](std::size_t a, std::size_t b) { return static_cast<bool>(compare(keys[a], keys[b])); });
+            }
+
+            KeyContainer mergedKeys;
+            std::tuple<ValueContainers...> mergedValues;
+            Detail::flat_reserve(mergedKeys, size);
+            std::apply([size](auto&... mergedValue) { (Detail::flat_reserve(mergedValue, size), ...); }, mergedValues);
+
+            const auto take = [&](std::size_t index)
+            {
+                if constexpr (Unique)
+                {
+                    if (!mergedKeys.empty() && !static_cast<bool>(compare(mergedKeys.back(), keys[index])))
+                    {
+                        return;
+                    }
+                }
+                mergedKeys.insert(mergedKeys.end(), std::move(keys[index]));
+                std::apply([&](auto&... mergedValue) { (mergedValue.insert(mergedValue.end(), std::move(values[index])), ...); }, mergedValues);
+            };
+
+            const auto tailAt = [&tailOrder, oldSize](std::size_t position)
+            {
+                return tailOrder.empty() ? oldSize + position : tailOrder[position];
+            };
+
+            // On ties, the elements that were there first come first, which is also what drops the new ones if `Unique`.
+            std::size_t oldPosition = 0;
+            std::size_t tailPosition = 0;
+            while (oldPosition < oldSize && tailPosition < tailSize)
+            {
+                if (compare(keys[tailAt(tailPosition)], keys[oldPosition]))
+                {
+                    take(tailAt(tailPosition++));
+                }
+                else
+                {
+                    take(oldPosition++);
+                }
+            }
+            for (; oldPosition < oldSize; ++oldPosition)
+            {
+                take(oldPosition);
+            }
+            for (; tailPosition < tailSize; ++tailPosition)
+            {
+                take(tailAt(tailPosition));
+            }
+
+            keys = std::move(mergedKeys);
+            std::apply([&](auto&... mergedValue) { ((values = std::move(mergedValue)), ...); }, mergedValues);
+        }
+    }
+}
@@ -0,0 +1,775 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/concepts.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+namespace StdReimpl
+{
+    /**
+     * @brief Thrown for format strings that are only checked at runtime, i.e. those passed to `vformat` and friends or
+     *        wrapped in `runtime_format`, and for dynamic widths and precisions that aren't valid.
+     * @see https://eel.is/c++draft/format.error
+     * @see https://cppreference.com/w/cpp/utility/format/format_error
+     * @note A feature from the C++20 standard.
+     */
+    class format_error : public std::runtime_error
+    {
+    public:
+        explicit format_error(const std::string& what);
+        explicit format_error(const char* what);
+    };
+
+    template <class CharT>
+    class basic_format_parse_context;
+
+    template <class Out, class CharT>
+    class basic_format_context;
+
+    template <class Context>
+    class basic_format_arg;
+
+    template <class Context>
+    class basic_format_args;
+
+    template <class CharT, class... Args>
+    class basic_format_string;
+
+    /**
+     * @brief Specialized for `bool`, `char`, the standard integer types, `float`, `double`, `const char*`, `char*`,
+     *        arrays of `char`, `std::string`, `std::string_view`, `void*`, `const void*`, and `std::nullptr_t`. Other
+     *        types can be formatted by specializing it with a `constexpr` `parse` and a const `format`, which is usually
+     *        done by deriving from one of the above or by calling `format_to(ctx.out(), ...)`.
+     * @see https://eel.is/c++draft/format.formatter
+     * @see https://cppreference.com/w/cpp/utility/format/formatter
+     * @note A feature from the C++20 standard. Only `char` is supported as the character type.
+     */
+    template <class T, class CharT = char>
+    struct formatter
+    {
+        formatter() = delete;
+        formatter(const formatter&) = delete;
+        formatter& operator=(const formatter&) = delete;
+    };
+
+    namespace Detail
+    {
+        enum class format_arg_type : unsigned char
+        {
+            none,
+            boolean,
+            character,
+            int_type,
+            unsigned_type,
+            long_long_type,
+            unsigned_long_long_type,
+            float_type,
+            double_type,
+            c_string,
+            string,
+            pointer,
+            custom
+        };
+
+        enum class format_align : unsigned char
+        {
+            none,
+            left,
+            right,
+            center
+        };
+
+        enum class format_sign : unsigned char
+        {
+            none,
+            plus,
+            minus,
+            space
+        };
+
+        /**
+         * @brief A standard format specification, `[[fill]align][sign][#][0][width][.precision][L][type]`, parsed.
+         */
+        struct format_spec
+        {
+            // One UTF-8 encoded code point.
+            char fill[4] = {' ', '\0', '\0', '\0'};
+            unsigned char fill_size = 1;
+            format_align align = format_align::none;
+            format_sign sign = format_sign::none;
+            bool alternate = false;
+            bool zero_pad = false;
+            bool locale_specific = false;
+            char type = '\0';
+            int width = 0;
+            int precision = -1;
+
+            // The arguments holding the width and precision, for `{:{}.{}}`, or -1.
+            int width_arg_id = -1;
+            int precision_arg_id = -1;
+        };
+
+        /**
+         * @brief One piece of a format string that `basic_format_string` compiled: a run of literal text, then an
+         *        argument to format, if there is one.
+         */
+        struct format_piece
+        {
+            // Offsets into the format string.
+            std::uint32_t literal_begin = 0;
+            std::uint32_t literal_size = 0;
+
+            // -1 if the piece is only literal text.
+            int arg_id = -1;
+
+            // The spec, for the built in formatters.
+            format_spec spec;
+
+            // Where a custom formatter's `parse` starts, and the automatic argument index it starts from.
+            std::uint32_t spec_begin = 0;
+            std::uint32_t next_arg_id = 0;
+        };
+
+        /**
+         * @brief Where formatted output goes. Everything is written into `data`, and when that's full, the derived class
+         *        flushes it somewhere or replaces it with something bigger. The ones that write to caller supplied
+         *        pointers write to them directly, and the others use a small array of their own, so formatting only
+         *        touches the heap to make a `std::string`.
+         */
+        class format_buffer
+        {
+        public:
+            format_buffer(const format_buffer&) = delete;
+            format_buffer& operator=(const format_buffer&) = delete;
+
+            void PushBack(char c);
+            void Append(const char* first, const char* last);
+            void Append(std::string_view text);
+
+            void Fill(std::size_t count, char c);
+
+            /**
+             * @brief Writes `count` copies of the spec's fill.
+             */
+            void Fill(std::size_t count, const format_spec& spec);
+
+        protected:
+            format_buffer(char* inData, std::size_t inCapacity) noexcept;
+            ~format_buffer() = default;
+
+            /**
+             * @brief Makes room for at least one more character, either by flushing `data[0, size)` and resetting `size`
+             *        or by moving to a bigger `data`. `required` is how much the caller would like to fit in total.
+             */
+            virtual void Grow(std::size_t required) = 0;
+
+            char* data;
+            std::size_t size = 0;
+            std::size_t capacity;
+        };
+
+        // Enough for most log lines, while keeping the buffers cheap to put on the stack.
+        inline constexpr std::size_t format_scratch_size = 256;
+
+        /**
+         * @brief Writes straight to a `char*`, up to `limit` characters, and then only counts.
+         */
+        class format_pointer_buffer final : public format_buffer
+        {
+        public:
+            format_pointer_buffer(char* out, std::size_t limit) noexcept;
+
+            // How many characters were formatted, including those that didn't fit.
+            std::size_t Count() const noexcept;
+
+        private:
+            void Grow(std::size_t required) override;
+
+            std::size_t discarded = 0;
+            char scratch[format_scratch_size];
+        };
+
+        /**
+         * @brief Writes to an output iterator, through a small array, up to `limit` characters, and then only counts.
+         */
+        template <class Out>
+        class format_iterator_buffer final : public format_buffer
+        {
+        public:
+            format_iterator_buffer(Out inOut, std::size_t inLimit);
+
+            std::size_t Count() const noexcept;
+            Out Finish();
+
+        private:
+            void Grow(std::size_t required) override;
+
+            Out out;
+            std::size_t limit;
+            std::size_t count = 0;
+            char scratch[format_scratch_size];
+        };
+
+        class format_counting_buffer final : public format_buffer
+        {
+        public:
+            format_counting_buffer() noexcept;
+
+            std::size_t Count() const noexcept;
+
+        private:
+            void Grow(std::size_t required) override;
+
+            std::size_t count = 0;
+            char scratch[format_scratch_size];
+        };
+
+        /**
+         * @brief Formats into a small array, and only moves to a `std::string` when that overflows, so short results
+         *        allocate once, at their exact size, or not at all.
+         */
+        class format_string_buffer final : public format_buffer
+        {
+        public:
+            format_string_buffer() noexcept;
+
+            std::string Finish();
+
+        private:
+            void Grow(std::size_t required) override;
+
+            std::string result;
+            char scratch[format_scratch_size];
+        };
+
+        /**
+         * @brief Formats into an array and writes it to the stream with one `fwrite` whenever it fills up.
+         */
+        class format_file_buffer final : public format_buffer
+        {
+        public:
+            explicit format_file_buffer(std::FILE* inStream) noexcept;
+
+            void Finish();
+
+        private:
+            void Grow(std::size_t required) override;
+
+            std::FILE* stream;
+            char scratch[2 * format_scratch_size];
+        };
+
+        /**
+         * @brief The output iterator of `format_context`, which appends to a `format_buffer`.
+         */
+        class format_buffer_iterator
+        {
+        public:
+            using iterator_category = std::output_iterator_tag;
+            using value_type = void;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = void;
+
+            format_buffer_iterator() noexcept = default;
+            explicit format_buffer_iterator(format_buffer& inBuffer) noexcept;
+
+            format_buffer_iterator& operator=(char c);
+            format_buffer_iterator& operator*() noexcept;
+            format_buffer_iterator& operator++() noexcept;
+            format_buffer_iterator operator++(int) noexcept;
+
+            format_buffer& Buffer() const noexcept;
+
+        private:
+            format_buffer* buffer = nullptr;
+        };
+
+        /**
+         * @brief Reaches into the private parts of the format classes, for the machinery in this namespace.
+         */
+        struct format_access;
+
+        template <class Context, class... Args>
+        class format_arg_store;
+
+        template <class CharT>
+        struct runtime_format_string
+        {
+            std::basic_string_view<CharT> str;
+        };
+    }
+
+    /**
+     * @brief The part of the format string that a formatter's `parse` looks at, and the automatic and manual argument
+     *        numbering, so that a formatter can take nested arguments of its own.
+     * @see https://eel.is/c++draft/format.parse.ctx
+     * @see https://cppreference.com/w/cpp/utility/format/basic_format_parse_context
+     * @note A feature from the C++20 standard. `check_dynamic_spec` and friends are features from the C++26 standard.
+     */
+    template <class CharT>
+    class basic_format_parse_context
+    {
+    public:
+        using char_type = CharT;
+        using const_iterator = const CharT*;
+        using iterator = const_iterator;
+
+        constexpr explicit basic_format_parse_context(std::basic_string_view<CharT> fmt) noexcept;
+
+        basic_format_parse_context(const basic_format_parse_context&) = delete;
+        basic_format_parse_context& operator=(const basic_format_parse_context&) = delete;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+        constexpr void advance_to(const_iterator it);
+
+        constexpr std::size_t next_arg_id();
+        constexpr void check_arg_id(std::size_t id);
+
+        template <class... Ts>
+        constexpr void check_dynamic_spec(std::size_t id);
+        constexpr void check_dynamic_spec_integral(std::size_t id);
+        constexpr void check_dynamic_spec_string(std::size_t id);
+
+    private:
+        friend struct Detail::format_access;
+
+        enum class indexing : unsigned char
+        {
+            unknown,
+            manual,
+            automatic
+        };
+
+        constexpr basic_format_parse_context(std::basic_string_view<CharT> fmt, std::size_t inNumArgs, const Detail::format_arg_type* inArgTypes) noexcept;
+
+        const CharT* first;
+        const CharT* last;
+        std::size_t next_id = 0;
+        std::size_t num_args;
+        indexing mode = indexing::unknown;
+
+        // The types of the arguments, while checking a format string at compile time, or null at runtime.
+        const Detail::format_arg_type* arg_types = nullptr;
+    };
+
+    using format_parse_context = basic_format_parse_context<char>;
+
+    /**
+     * @see https://eel.is/c++draft/format.context
+     * @see https://cppreference.com/w/cpp/utility/format/basic_format_context
+     * @note A feature from the C++20 standard. There's no `locale()`, since formatting always uses the "C" locale.
+     */
+    template <class Out, class CharT>
+    class basic_format_context
+    {
+    public:
+        using iterator = Out;
+        using char_type = CharT;
+
+        template <class T>
+        using formatter_type = formatter<T, CharT>;
+
+        basic_format_context(const basic_format_context&) = delete;
+        basic_format_context& operator=(const basic_format_context&) = delete;
+
+        basic_format_arg<basic_format_context> arg(std::size_t id) const noexcept;
+
+        iterator out();
+        void advance_to(iterator it);
+
+    private:
+        friend struct Detail::format_access;
+
+        basic_format_context(Out out, basic_format_args<basic_format_context> inArgs);
+
+        Out out_iterator;
+        basic_format_args<basic_format_context> args;
+    };
+
+    /**
+     * @brief The context of every formatter called by this library's functions. Its iterator appends to an internal
+     *        buffer, so that `format_to(ctx.out(), ...)` from a custom formatter writes to that buffer directly.
+     */
+    using format_context = basic_format_context<Detail::format_buffer_iterator, char>;
+
+    namespace Detail
+    {
+        template <class Context>
+        struct format_custom_value
+        {
+            const void* object;
+            void (*format)(basic_format_parse_context<typename Context::char_type>& parseContext, Context& formatContext, const void* object);
+        };
+
+        template <class Context>
+        union format_arg_value
+        {
+            std::monostate none_value;
+            bool bool_value;
+            char char_value;
+            int int_value;
+            unsigned int unsigned_value;
+            long long long_long_value;
+            unsigned long long unsigned_long_long_value;
+            float float_value;
+            double double_value;
+            const char* c_string_value;
+            struct
+            {
+                const char* data;
+                std::size_t size;
+            } string_value;
+            const void* pointer_value;
+            format_custom_value<Context> custom_value;
+        };
+    }
+
+    /**
+     * @brief A type-erased reference to one argument, holding the built in types by value and the rest as a pointer and
+     *        the function that formats them.
+     * @see https://eel.is/c++draft/format.arg
+     * @see https://cppreference.com/w/cpp/utility/format/basic_format_arg
+     * @note A feature from the C++20 standard. The member `visit` is a feature from the C++26 standard.
+     */
+    template <class Context>
+    class basic_format_arg
+    {
+    public:
+        class handle
+        {
+        public:
+            void format(basic_format_parse_context<typename Context::char_type>& parseContext, Context& formatContext) const;
+
+        private:
+            friend class basic_format_arg;
+
+            explicit handle(Detail::format_custom_value<Context> inValue) noexcept;
+
+            Detail::format_custom_value<Context> value;
+        };
+
+        basic_format_arg() noexcept;
+
+        explicit operator bool() const noexcept;
+
+        /**
+         * @brief Calls `vis` with `std::monostate`, `bool`, `char`, `int`, `unsigned int`, `long long`,
+         *        `unsigned long long`, `float`, `double`, `const char*`, `std::string_view`, `const void*`, or `handle`.
+         */
+        template <class Visitor>
+        decltype(auto) visit(Visitor&& vis) const;
+
+        template <class R, class Visitor>
+        R visit(Visitor&& vis) const;
+
+    private:
+        friend struct Detail::format_access;
+
+        Detail::format_arg_type type = Detail::format_arg_type::none;
+        Detail::format_arg_value<Context> value{};
+    };
+
+    /**
+     * @see https://eel.is/c++draft/format.args
+     * @see https://cppreference.com/w/cpp/utility/format/basic_format_args
+     * @note A feature from the C++20 standard.
+     */
+    template <class Context>
+    class basic_format_args
+    {
+    public:
+        basic_format_args() noexcept = default;
+
+        template <class... Args>
+        basic_format_args(const Detail::format_arg_store<Context, Args...>& store) noexcept;
+
+        basic_format_arg<Context> get(std::size_t i) const noexcept;
+
+    private:
+        friend struct Detail::format_access;
+
+        const basic_format_arg<Context>* args = nullptr;
+        std::size_t count = 0;
+    };
+
+    using format_args = basic_format_args<format_context>;
+
+    namespace Detail
+    {
+        template <class Context, class... Args>
+        class format_arg_store
+        {
+        private:
+            friend struct format_access;
+            friend class basic_format_args<Context>;
+
+            basic_format_arg<Context> args[sizeof...(Args) > 0 ? sizeof...(Args) : 1];
+        };
+    }
+
+    /**
+     * @see https://eel.is/c++draft/format.arg.store
+     * @see https://cppreference.com/w/cpp/utility/format/make_format_args
+     * @note A feature from the C++20 standard.
+     */
+    template <class Context = format_context, class... Args>
+    Detail::format_arg_store<Context, Args...> make_format_args(Args&... args);
+
+    /**
+     * @brief A format string checked against the argument types at compile time and compiled there into a list of
+     *        literal runs and parsed specs, so that formatting with the built in formatters doesn't parse anything.
+     *        There's room for twice as many replacement fields as arguments, plus two; longer format strings, and those
+     *        from `runtime_format`, are parsed at runtime, like `vformat`'s.
+     * @see https://eel.is/c++draft/format.fmt.string
+     * @see https://cppreference.com/w/cpp/utility/format/basic_format_string
+     * @note A feature from the C++20 standard.
+     */
+    template <class CharT, class... Args>
+    class basic_format_string
+    {
+    public:
+        template <class T>
+            requires std::convertible_to<const T&, std::basic_string_view<CharT>>
+        consteval basic_format_string(const T& s);
+
+        basic_format_string(Detail::runtime_format_string<CharT> s) noexcept;
+
+        constexpr std::basic_string_view<CharT> get() const noexcept;
+
+    private:
+        friend struct Detail::format_access;
+
+        static constexpr std::size_t piece_capacity = 2 * sizeof...(Args) + 2;
+
+        std::basic_string_view<CharT> str;
+        Detail::format_piece pieces[piece_capacity];
+        std::size_t piece_count = 0;
+        bool compiled = false;
+    };
+
+    template <class... Args>
+    using format_string = basic_format_string<char, std::type_identity_t<Args>...>;
+
+    /**
+     * @brief Marks a format string to be checked and parsed at runtime, throwing `format_error` if it's invalid.
+     * @see https://eel.is/c++draft/format.syn
+     * @see https://cppreference.com/w/cpp/utility/format/runtime_format
+     * @note A feature from the C++26 standard.
+     */
+    inline Detail::runtime_format_string<char> runtime_format(std::string_view fmt) noexcept;
+
+    /**
+     * @see https://eel.is/c++draft/format.formattable
+     * @see https://cppreference.com/w/cpp/utility/format/formattable
+     * @note A feature from the C++23 standard.
+     */
+    template <class T, class CharT>
+    concept formattable = std::semiregular<formatter<std::remove_cvref_t<T>, CharT>> &&
+        requires(formatter<std::remove_cvref_t<T>, CharT>& f, const formatter<std::remove_cvref_t<T>, CharT>& cf, T&& t,
+            basic_format_context<Detail::format_buffer_iterator, CharT> fc, basic_format_parse_context<CharT> pc)
+        {
+            { f.parse(pc) } -> std::same_as<typename basic_format_parse_context<CharT>::iterator>;
+            { cf.format(t, fc) } -> std::same_as<Detail::format_buffer_iterator>;
+        };
+
+    namespace Detail
+    {
+        /**
+         * @brief The formatter of the built in types. Its `parse` is the same one that compiles format strings, and
+         *        its `format` writes straight into the context's buffer when it's one of ours.
+         */
+        template <class T, format_arg_type Type>
+        struct format_builtin_formatter
+        {
+            constexpr typename basic_format_parse_context<char>::iterator parse(basic_format_parse_context<char>& ctx);
+
+            template <class FormatContext>
+            typename FormatContext::iterator format(const T& value, FormatContext& ctx) const;
+
+            format_spec spec;
+        };
+
+        template <class T>
+        concept format_standard_integer = std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> &&
+            !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char8_t> && !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t> &&
+            sizeof(T) <= sizeof(long long);
+
+        template <class T>
+        constexpr format_arg_type format_integer_arg_type() noexcept;
+    }
+
+    template <>
+    struct formatter<bool, char> : Detail::format_builtin_formatter<bool, Detail::format_arg_type::boolean>
+    {
+    };
+
+    template <>
+    struct formatter<char, char> : Detail::format_builtin_formatter<char, Detail::format_arg_type::character>
+    {
+    };
+
+    template <Detail::format_standard_integer T>
+    struct formatter<T, char> : Detail::format_builtin_formatter<T, Detail::format_integer_arg_type<T>()>
+    {
+    };
+
+    template <>
+    struct formatter<float, char> : Detail::format_builtin_formatter<float, Detail::format_arg_type::float_type>
+    {
+    };
+
+    template <>
+    struct formatter<double, char> : Detail::format_builtin_formatter<double, Detail::format_arg_type::double_type>
+    {
+    };
+
+    template <>
+    struct formatter<const char*, char> : Detail::format_builtin_formatter<const char*, Detail::format_arg_type::c_string>
+    {
+    };
+
+    template <>
+    struct formatter<char*, char> : Detail::format_builtin_formatter<char*, Detail::format_arg_type::c_string>
+    {
+    };
+
+    template <std::size_t N>
+    struct formatter<char[N], char> : Detail::format_builtin_formatter<char[N], Detail::format_arg_type::string>
+    {
+    };
+
+    template <class Traits, class Allocator>
+    struct formatter<std::basic_string<char, Traits, Allocator>, char>
+        : Detail::format_builtin_formatter<std::basic_string<char, Traits, Allocator>, Detail::format_arg_type::string>
+    {
+    };
+
+    template <class Traits>
+    struct formatter<std::basic_string_view<char, Traits>, char>
+        : Detail::format_builtin_formatter<std::basic_string_view<char, Traits>, Detail::format_arg_type::string>
+    {
+    };
+
+    template <>
+    struct formatter<void*, char> : Detail::format_builtin_formatter<void*, Detail::format_arg_type::pointer>
+    {
+    };
+
+    template <>
+    struct formatter<const void*, char> : Detail::format_builtin_formatter<const void*, Detail::format_arg_type::pointer>
+    {
+    };
+
+    template <>
+    struct formatter<std::nullptr_t, char> : Detail::format_builtin_formatter<std::nullptr_t, Detail::format_arg_type::pointer>
+    {
+    };
+
+    /**
+     * @see https://eel.is/c++draft/format.functions
+     * @see https://cppreference.com/w/cpp/utility/format/format_to_n
+     * @note A feature from the C++20 standard.
+     */
+    template <class Out>
+    struct format_to_n_result
+    {
+        Out out;
+        std::iter_difference_t<Out> size;
+    };
+
+    /**
+     * @brief Formats into a small array on the stack and only then into the returned string, which is allocated once,
+     *        at its final size, if the result is too long for its small string buffer.
+     * @see https://eel.is/c++draft/format.functions
+     * @see https://cppreference.com/w/cpp/utility/format/format
+     * @note A feature from the C++20 standard.
+     */
+    template <class... Args>
+    std::string format(format_string<Args...> fmt, Args&&... args);
+
+    inline std::string vformat(std::string_view fmt, format_args args);
+
+    /**
+     * @brief Writes straight through `out` when it's a `char*`, and through a small array on the stack otherwise, e.g.
+     *        for a `std::back_insert_iterator` of an `inplace_vector<char, N>`.
+     * @see https://eel.is/c++draft/format.functions
+     * @see https://cppreference.com/w/cpp/utility/format/format_to
+     * @note A feature from the C++20 standard.
+     */
+    template <std::output_iterator<const char&> Out, class... Args>
+    Out format_to(Out out, format_string<Args...> fmt, Args&&... args);
+
+    template <std::output_iterator<const char&> Out>
+    Out vformat_to(Out out, std::string_view fmt, format_args args);
+
+    /**
+     * @brief Writes at most `n` characters, and returns how many the whole result has. With a `char*`, which is how
+     *        to format into a fixed buffer, the characters are written straight into it.
+     * @see https://eel.is/c++draft/format.functions
+     * @see https://cppreference.com/w/cpp/utility/format/format_to_n
+     * @note A feature from the C++20 standard.
+     */
+    template <std::output_iterator<const char&> Out, class... Args>
+    format_to_n_result<Out> format_to_n(Out out, std::iter_difference_t<Out> n, format_string<Args...> fmt, Args&&... args);
+
+    /**
+     * @see https://eel.is/c++draft/format.functions
+     * @see https://cppreference.com/w/cpp/utility/format/formatted_size
+     * @note A feature from the C++20 standard.
+     */
+    template <class... Args>
+    std::size_t formatted_size(format_string<Args...> fmt, Args&&... args);
+
+    /**
+     * @brief Formats into an array on the stack and writes it with one `fwrite` when it's short enough, so output from
+     *        different threads doesn't interleave within a line. Throws `std::system_error` if the write fails.
+     * @see https://eel.is/c++draft/print.fun
+     * @see https://cppreference.com/w/cpp/io/print
+     * @note A feature from the C++23 standard. Text is written as is, without converting it for the Windows console.
+     */
+    template <class... Args>
+    void print(format_string<Args...> fmt, Args&&... args);
+
+    template <class... Args>
+    void print(std::FILE* stream, format_string<Args...> fmt, Args&&... args);
+
+    /**
+     * @see https://eel.is/c++draft/print.fun
+     * @see https://cppreference.com/w/cpp/io/println
+     * @note A feature from the C++23 standard. The overloads without a format string are a feature from the C++26
+     *       standard.
+     */
+    template <class... Args>
+    void println(format_string<Args...> fmt, Args&&... args);
+
+    template <class... Args>
+    void println(std::FILE* stream, format_string<Args...> fmt, Args&&... args);
+
+    inline void println();
+    inline void println(std::FILE* stream);
+
+    /**
+     * @see https://eel.is/c++draft/print.fun
+     * @see https://cppreference.com/w/cpp/io/vprint_unicode
+     * @note A feature from the C++23 standard.
+     */
+    inline void vprint_unicode(std::FILE* stream, std::string_view fmt, format_args args);
+    inline void vprint_unicode(std::string_view fmt, format_args args);
+    inline void vprint_nonunicode(std::FILE* stream, std::string_view fmt, format_args args);
+    inline void vprint_nonunicode(std::string_view fmt, format_args args);
+}
+
+#include <CppUtils/StdReimpl/format.inl>
@@ -0,0 +1,1909 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/format.h>
+#include <CppUtils/StdReimpl/charconv.h>
+#include <CppUtils/StdReimpl/functional.h>
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <system_error>
+#include <utility>
+
+namespace StdReimpl
+{
+    inline format_error::format_error(const std::string& what)
+        : std::runtime_error(what)
+    {
+    }
+
+    inline format_error::format_error(const char* what)
+        : std::runtime_error(what)
+    {
+    }
+
+    namespace Detail
+    {
+        // Not constexpr, so that reaching it while checking a format string at compile time is a compile error.
+        [[noreturn]] inline void format_throw_error(const char* message)
+        {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            throw format_error(message);
+#else
+            static_cast<void>(message);
+            std::abort();
+#endif
+        }
+
+        [[noreturn]] inline void format_throw_write_error()
+        {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            throw std::system_error(std::make_error_code(std::errc::io_error), "StdReimpl::print");
+#else
+            std::abort();
+#endif
+        }
+
+        template <class T>
+        struct format_is_string_type : std::false_type
+        {
+        };
+
+        template <class Traits, class Allocator>
+        struct format_is_string_type<std::basic_string<char, Traits, Allocator>> : std::true_type
+        {
+        };
+
+        template <class Traits>
+        struct format_is_string_type<std::basic_string_view<char, Traits>> : std::true_type
+        {
+        };
+
+        template <class T>
+        constexpr format_arg_type format_integer_arg_type() noexcept
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                return sizeof(T) <= sizeof(int) ? format_arg_type::int_type : format_arg_type::long_long_type;
+            }
+            else
+            {
+                return sizeof(T) <= sizeof(unsigned int) ? format_arg_type::unsigned_type : format_arg_type::unsigned_long_long_type;
+            }
+        }
+
+        /**
+         * @brief How an argument of type `T` is stored in a `basic_format_arg`.
+         */
+        template <class T>
+        constexpr format_arg_type format_arg_type_of() noexcept
+        {
+            using U = std::remove_cv_t<T>;
+            if constexpr (std::is_same_v<U, bool>)
+            {
+                return format_arg_type::boolean;
+            }
+            else if constexpr (std::is_same_v<U, char>)
+            {
+                return format_arg_type::character;
+            }
+            else if constexpr (format_standard_integer<U>)
+            {
+                return format_integer_arg_type<U>();
+            }
+            else if constexpr (std::is_same_v<U, float>)
+            {
+                return format_arg_type::float_type;
+            }
+            else if constexpr (std::is_same_v<U, double>)
+            {
+                return format_arg_type::double_type;
+            }
+            else if constexpr (std::is_same_v<U, char*> || std::is_same_v<U, const char*>)
+            {
+                return format_arg_type::c_string;
+            }
+            else if constexpr ((std::is_array_v<U> && std::is_same_v<std::remove_cv_t<std::remove_extent_t<U>>, char>) || format_is_string_type<U>::value)
+            {
+                return format_arg_type::string;
+            }
+            else if constexpr (std::is_same_v<U, void*> || std::is_same_v<U, const void*> || std::is_same_v<U, std::nullptr_t>)
+            {
+                return format_arg_type::pointer;
+            }
+            else
+            {
+                return format_arg_type::custom;
+            }
+        }
+
+        constexpr bool format_is_integer_type(format_arg_type type) noexcept
+        {
+            return type == format_arg_type::int_type || type == format_arg_type::unsigned_type || type == format_arg_type::long_long_type ||
+                type == format_arg_type::unsigned_long_long_type;
+        }
+
+        struct format_access
+        {
+            template <class CharT>
+            static constexpr basic_format_parse_context<CharT> MakeParseContext(std::basic_string_view<CharT> fmt, std::size_t numArgs,
+                const format_arg_type* argTypes) noexcept
+            {
+                return basic_format_parse_context<CharT>(fmt, numArgs, argTypes);
+            }
+
+            template <class CharT>
+            static constexpr std::size_t NextArgId(const basic_format_parse_context<CharT>& ctx) noexcept
+            {
+                return ctx.next_id;
+            }
+
+            template <class CharT>
+            static constexpr void SetNextArgId(basic_format_parse_context<CharT>& ctx, std::size_t id) noexcept
+            {
+                ctx.next_id = id;
+                if (id != 0)
+                {
+                    ctx.mode = basic_format_parse_context<CharT>::indexing::automatic;
+                }
+            }
+
+            template <class Context>
+            static Context MakeContext(typename Context::iterator out, basic_format_args<Context> args)
+            {
+                return Context(std::move(out), args);
+            }
+
+            template <class Context>
+            static format_arg_type Type(const basic_format_arg<Context>& arg) noexcept
+            {
+                return arg.type;
+            }
+
+            template <class Context>
+            static const format_arg_value<Context>& Value(const basic_format_arg<Context>& arg) noexcept
+            {
+                return arg.value;
+            }
+
+            template <class Context>
+            static std::size_t Size(const basic_format_args<Context>& args) noexcept
+            {
+                return args.count;
+            }
+
+            template <class Context, class T>
+            static basic_format_arg<Context> MakeArg(T& value) noexcept;
+
+            template <class Context, class... Args>
+            static format_arg_store<Context, Args...> MakeStore(Args&... args) noexcept
+            {
+                format_arg_store<Context, Args...> store;
+                std::size_t i = 0;
+                ((store.args[i++] = MakeArg<Context>(args)), ...);
+                return store;
+            }
+
+            template <class CharT, class... Args>
+            static constexpr bool Compiled(const basic_format_string<CharT, Args...>& fmt) noexcept
+            {
+                return fmt.compiled;
+            }
+
+            template <class CharT, class... Args>
+            static constexpr const format_piece* Pieces(const basic_format_string<CharT, Args...>& fmt) noexcept
+            {
+                return fmt.pieces;
+            }
+
+            template <class CharT, class... Args>
+            static constexpr std::size_t PieceCount(const basic_format_string<CharT, Args...>& fmt) noexcept
+            {
+                return fmt.piece_count;
+            }
+        };
+    }
+
+    //
+    // Parse context
+    //
+
+    template <class CharT>
+    constexpr basic_format_parse_context<CharT>::basic_format_parse_context(std::basic_string_view<CharT> fmt) noexcept
+        : first(fmt.data()),
+          last(fmt.data() + fmt.size()),
+          num_args(static_cast<std::size_t>(-1))
+    {
+    }
+
+    template <class CharT>
+    constexpr basic_format_parse_context<CharT>::basic_format_parse_context(std::basic_string_view<CharT> fmt, std::size_t inNumArgs,
+        const Detail::format_arg_type* inArgTypes) noexcept
+        : first(fmt.data()),
+          last(fmt.data() + fmt.size()),
+          num_args(inNumArgs),
+          arg_types(inArgTypes)
+    {
+    }
+
+    template <class CharT>
+    constexpr typename basic_format_parse_context<CharT>::const_iterator basic_format_parse_context<CharT>::begin() const noexcept
+    {
+        return first;
+    }
+
+    template <class CharT>
+    constexpr typename basic_format_parse_context<CharT>::const_iterator basic_format_parse_context<CharT>::end() const noexcept
+    {
+        return last;
+    }
+
+    template <class CharT>
+    constexpr void basic_format_parse_context<CharT>::advance_to(const_iterator it)
+    {
+        first = it;
+    }
+
+    template <class CharT>
+    constexpr std::size_t basic_format_parse_context<CharT>::next_arg_id()
+    {
+        if (mode == indexing::manual)
+        {
+            Detail::format_throw_error("cannot switch from manual to automatic argument indexing");
+        }
+        mode = indexing::automatic;
+        if (next_id >= num_args)
+        {
+            Detail::format_throw_error("argument index out of range");
+        }
+        return next_id++;
+    }
+
+    template <class CharT>
+    constexpr void basic_format_parse_context<CharT>::check_arg_id(std::size_t id)
+    {
+        if (mode == indexing::automatic)
+        {
+            Detail::format_throw_error("cannot switch from automatic to manual argument indexing");
+        }
+        mode = indexing::manual;
+        if (id >= num_args)
+        {
+            Detail::format_throw_error("argument index out of range");
+        }
+    }
+
+    template <class CharT>
+    template <class... Ts>
+    constexpr void basic_format_parse_context<CharT>::check_dynamic_spec(std::size_t id)
+    {
+        if (id >= num_args)
+        {
+            Detail::format_throw_error("argument index out of range");
+        }
+        if (arg_types != nullptr && ((arg_types[id] != Detail::format_arg_type_of<Ts>()) && ...))
+        {
+            Detail::format_throw_error("dynamic spec argument has the wrong type");
+        }
+    }
+
+    template <class CharT>
+    constexpr void basic_format_parse_context<CharT>::check_dynamic_spec_integral(std::size_t id)
+    {
+        check_dynamic_spec<int, unsigned int, long long, unsigned long long>(id);
+    }
+
+    template <class CharT>
+    constexpr void basic_format_parse_context<CharT>::check_dynamic_spec_string(std::size_t id)
+    {
+        check_dynamic_spec<const CharT*, std::basic_string_view<CharT>>(id);
+    }
+
+    //
+    // Arguments and context
+    //
+
+    template <class Context>
+    basic_format_arg<Context>::handle::handle(Detail::format_custom_value<Context> inValue) noexcept
+        : value(inValue)
+    {
+    }
+
+    template <class Context>
+    void basic_format_arg<Context>::handle::format(basic_format_parse_context<typename Context::char_type>& parseContext, Context& formatContext) const
+    {
+        value.format(parseContext, formatContext, value.object);
+    }
+
+    template <class Context>
+    basic_format_arg<Context>::basic_format_arg() noexcept
+    {
+    }
+
+    template <class Context>
+    basic_format_arg<Context>::operator bool() const noexcept
+    {
+        return type != Detail::format_arg_type::none;
+    }
+
+    template <class Context>
+    template <class Visitor>
+    decltype(auto) basic_format_arg<Context>::visit(Visitor&& vis) const
+    {
+        using Detail::format_arg_type;
+        switch (type)
+        {
+        case format_arg_type::boolean:
+            return std::forward<Visitor>(vis)(value.bool_value);
+        case format_arg_type::character:
+            return std::forward<Visitor>(vis)(value.char_value);
+        case format_arg_type::int_type:
+            return std::forward<Visitor>(vis)(value.int_value);
+        case format_arg_type::unsigned_type:
+            return std::forward<Visitor>(vis)(value.unsigned_value);
+        case format_arg_type::long_long_type:
+            return std::forward<Visitor>(vis)(value.long_long_value);
+        case format_arg_type::unsigned_long_long_type:
+            return std::forward<Visitor>(vis)(value.unsigned_long_long_value);
+        case format_arg_type::float_type:
+            return std::forward<Visitor>(vis)(value.float_value);
+        case format_arg_type::double_type:
+            return std::forward<Visitor>(vis)(value.double_value);
+        case format_arg_type::c_string:
+            return std::forward<Visitor>(vis)(value.c_string_value);
+        case format_arg_type::string:
+            return std::forward<Visitor>(vis)(std::basic_string_view<typename Context::char_type>(value.string_value.data, value.string_value.size));
+        case format_arg_type::pointer:
+            return std::forward<Visitor>(vis)(value.pointer_value);
+        case format_arg_type::custom:
+            return std::forward<Visitor>(vis)(handle(value.custom_value));
+        case format_arg_type::none:
+            break;
+        }
+        return std::forward<Visitor>(vis)(std::monostate{});
+    }
+
+    template <class Context>
+    template <class R, class Visitor>
+    R basic_format_arg<Context>::visit(Visitor&& vis) const
+    {
+        return visit([&vis](auto&& value) -> R
+            {
+                return StdReimpl::invoke_r<R>(std::forward<Visitor>(vis), std::forward<decltype(value)>(value));
+            });
+    }
+
+    template <class Context>
+    template <class... Args>
+    basic_format_args<Context>::basic_format_args(const Detail::format_arg_store<Context, Args...>& store) noexcept
+        : args(store.args),
+          count(sizeof...(Args))
+    {
+    }
+
+    template <class Context>
+    basic_format_arg<Context> basic_format_args<Context>::get(std::size_t i) const noexcept
+    {
+        return i < count ? args[i] : basic_format_arg<Context>();
+    }
+
+    template <class Out, class CharT>
+    basic_format_context<Out, CharT>::basic_format_context(Out out, basic_format_args<basic_format_context> inArgs)
+        : out_iterator(std::move(out)),
+          args(inArgs)
+    {
+    }
+
+    template <class Out, class CharT>
+    basic_format_arg<basic_format_context<Out, CharT>> basic_format_context<Out, CharT>::arg(std::size_t id) const noexcept
+    {
+        return args.get(id);
+    }
+
+    template <class Out, class CharT>
+    typename basic_format_context<Out, CharT>::iterator basic_format_context<Out, CharT>::out()
+    {
+        return out_iterator;
+    }
+
+    template <class Out, class CharT>
+    void basic_format_context<Out, CharT>::advance_to(iterator it)
+    {
+        out_iterator = std::move(it);
+    }
+
+    namespace Detail
+    {
+        //
+        // Buffers
+        //
+
+        inline format_buffer::format_buffer(char* inData, std::size_t inCapacity) noexcept
+            : data(inData),
+              capacity(inCapacity)
+        {
+        }
+
+        inline void format_buffer::PushBack(char c)
+        {
+            if (size == capacity)
+            {
+                Grow(size + 1);
+            }
+            data[size++] = c;
+        }
+
+        inline void format_buffer::Append(const char* first, const char* last)
+        {
+            while (first != last)
+            {
+                if (size == capacity)
+                {
+                    Grow(size + static_cast<std::size_t>(last - first));
+                }
+                const std::size_t count = std::min(capacity - size, static_cast<std::size_t>(last - first));
+                std::memcpy(data + size, first, count);
+                size += count;
+                first += count;
+            }
+        }
+
+        inline void format_buffer::Append(std::string_view text)
+        {
+            Append(text.data(), text.data() + text.size());
+        }
+
+        inline void format_buffer::Fill(std::size_t count, char c)
+        {
+            while (count != 0)
+            {
+                if (size == capacity)
+                {
+                    Grow(size + count);
+                }
+                const std::size_t n = std::min(capacity - size, count);
+                std::memset(data + size, c, n);
+                size += n;
+                count -= n;
+            }
+        }
+
+        inline void format_buffer::Fill(std::size_t count, const format_spec& spec)
+        {
+            if (spec.fill_size == 1)
+            {
+                Fill(count, spec.fill[0]);
+                return;
+            }
+            for (; count != 0; --count)
+            {
+                Append(spec.fill, spec.fill + spec.fill_size);
+            }
+        }
+
+        inline format_pointer_buffer::format_pointer_buffer(char* out, std::size_t limit) noexcept
+            : format_buffer(out, limit)
+        {
+        }
+
+        inline std::size_t format_pointer_buffer::Count() const noexcept
+        {
+            return discarded + size;
+        }
+
+        inline void format_pointer_buffer::Grow(std::size_t)
+        {
+            // Past the limit, so keep counting into our own array.
+            discarded += size;
+            data = scratch;
+            size = 0;
+            capacity = sizeof(scratch);
+        }
+
+        template <class Out>
+        format_iterator_buffer<Out>::format_iterator_buffer(Out inOut, std::size_t inLimit)
+            : format_buffer(scratch, format_scratch_size),
+              out(std::move(inOut)),
+              limit(inLimit)
+        {
+        }
+
+        template <class Out>
+        std::size_t format_iterator_buffer<Out>::Count() const noexcept
+        {
+            return count + size;
+        }
+
+        template <class Out>
+        Out format_iterator_buffer<Out>::Finish()
+        {
+            Grow(0);
+            return std::move(out);
+        }
+
+        template <class Out>
+        void format_iterator_buffer<Out>::Grow(std::size_t)
+        {
+            const std::size_t writable = count < limit ? std::min(size, limit - count) : 0;
+            for (std::size_t i = 0; i < writable; ++i)
+            {
+                *out = data[i];
+                ++out;
+            }
+            count += size;
+            size = 0;
+        }
+
+        inline format_counting_buffer::format_counting_buffer() noexcept
+            : format_buffer(scratch, format_scratch_size)
+        {
+        }
+
+        inline std::size_t format_counting_buffer::Count() const noexcept
+        {
+            return count + size;
+        }
+
+        inline void format_counting_buffer::Grow(std::size_t)
+        {
+            count += size;
+            size = 0;
+        }
+
+        inline format_string_buffer::format_string_buffer() noexcept
+            : format_buffer(scratch, format_scratch_size)
+        {
+        }
+
+        inline std::string format_string_buffer::Finish()
+        {
+            if (data == scratch)
+            {
+                return std::string(scratch, size);
+            }
+            result.resize(size);
+            return std::move(result);
+        }
+
+        inline void format_string_buffer::Grow(std::size_t required)
+        {
+            const bool wasScratch = data == scratch;
+            result.resize(std::max(required, 2 * capacity));
+            if (wasScratch)
+            {
+                std::memcpy(result.data(), scratch, size);
+            }
+            data = result.data();
+            capacity = result.size();
+        }
+
+        inline void format_write_to_file(std::FILE* stream, const char* data, std::size_t size)
+        {
+            if (size != 0 && std::fwrite(data, 1, size, stream) != size)
+            {
+                format_throw_write_error();
+            }
+        }
+
+        inline format_file_buffer::format_file_buffer(std::FILE* inStream) noexcept
+            : format_buffer(scratch, sizeof(scratch)),
+              stream(inStream)
+        {
+        }
+
+        inline void format_file_buffer::Finish()
+        {
+            Grow(0);
+        }
+
+        inline void format_file_buffer::Grow(std::size_t)
+        {
+            const std::size_t count = size;
+            size = 0;
+            format_write_to_file(stream, data, count);
+        }
+
+        inline format_buffer_iterator::format_buffer_iterator(format_buffer& inBuffer) noexcept
+            : buffer(&inBuffer)
+        {
+        }
+
+        inline format_buffer_iterator& format_buffer_iterator::operator=(char c)
+        {
+            buffer->PushBack(c);
+            return *this;
+        }
+
+        inline format_buffer_iterator& format_buffer_iterator::operator*() noexcept
+        {
+            return *this;
+        }
+
+        inline format_buffer_iterator& format_buffer_iterator::operator++() noexcept
+        {
+            return *this;
+        }
+
+        inline format_buffer_iterator format_buffer_iterator::operator++(int) noexcept
+        {
+            return *this;
+        }
+
+        inline format_buffer& format_buffer_iterator::Buffer() const noexcept
+        {
+            return *buffer;
+        }
+
+        //
+        // Arguments
+        //
+
+        template <class Context, class T>
+        format_arg_value<Context> format_make_value(const T& value) noexcept
+        {
+            constexpr format_arg_type type = format_arg_type_of<T>();
+            format_arg_value<Context> result{};
+            if constexpr (type == format_arg_type::boolean)
+            {
+                result.bool_value = value;
+            }
+            else if constexpr (type == format_arg_type::character)
+            {
+                result.char_value = value;
+            }
+            else if constexpr (type == format_arg_type::int_type)
+            {
+                result.int_value = static_cast<int>(value);
+            }
+            else if constexpr (type == format_arg_type::unsigned_type)
+            {
+                result.unsigned_value = static_cast<unsigned int>(value);
+            }
+            else if constexpr (type == format_arg_type::long_long_type)
+            {
+                result.long_long_value = static_cast<long long>(value);
+            }
+            else if constexpr (type == format_arg_type::unsigned_long_long_type)
+            {
+                result.unsigned_long_long_value = static_cast<unsigned long long>(value);
+            }
+            else if constexpr (type == format_arg_type::float_type)
+            {
+                result.float_value = value;
+            }
+            else if constexpr (type == format_arg_type::double_type)
+            {
+                result.double_value = value;
+            }
+            else if constexpr (type == format_arg_type::c_string)
+            {
+                result.c_string_value = value;
+            }
+            else if constexpr (type == format_arg_type::string)
+            {
+                if constexpr (std::is_array_v<T>)
+                {
+                    // A string literal, or an array that the string may not fill.
+                    const char* end = std::find(value, value + std::extent_v<T>, '\0');
+                    result.string_value = {value, static_cast<std::size_t>(end - value)};
+                }
+                else
+                {
+                    result.string_value = {value.data(), value.size()};
+                }
+            }
+            else if constexpr (type == format_arg_type::pointer)
+            {
+                result.pointer_value = static_cast<const void*>(value);
+            }
+            return result;
+        }
+
+        template <class Context, class T>
+        void format_custom_arg(basic_format_parse_context<typename Context::char_type>& parseContext, Context& formatContext, const void* object)
+        {
+            typename Context::template formatter_type<T> f;
+            parseContext.advance_to(f.parse(parseContext));
+            formatContext.advance_to(f.format(*static_cast<const T*>(object), formatContext));
+        }
+
+        template <class Context, class T>
+        basic_format_arg<Context> format_access::MakeArg(T& value) noexcept
+        {
+            using U = std::remove_cv_t<T>;
+            constexpr format_arg_type type = format_arg_type_of<U>();
+            basic_format_arg<Context> arg;
+            arg.type = type;
+            if constexpr (type == format_arg_type::custom)
+            {
+                static_assert(formattable<const U, typename Context::char_type>,
+                    "The argument's type has no StdReimpl::formatter specialization with a constexpr parse and a const format.");
+                arg.value.custom_value = {std::addressof(value), &format_custom_arg<Context, U>};
+            }
+            else
+            {
+                arg.value = format_make_value<Context, U>(value);
+            }
+            return arg;
+        }
+
+        //
+        // Parsing, shared by the compile time and runtime paths
+        //
+
+        constexpr bool format_is_digit(char c) noexcept
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        constexpr const char* format_parse_integer(const char* first, const char* last, int& value)
+        {
+            long long result = 0;
+            do
+            {
+                result = result * 10 + (*first - '0');
+                if (result > INT_MAX)
+                {
+                    format_throw_error("number is too big in format string");
+                }
+                ++first;
+            } while (first != last && format_is_digit(*first));
+            value = static_cast<int>(result);
+            return first;
+        }
+
+        /**
+         * @brief Parses the argument id that starts at `first`, just after a '{', or takes the next automatic one if
+         *        there's none.
+         */
+        constexpr const char* format_parse_arg_id(const char* first, const char* last, basic_format_parse_context<char>& ctx, std::size_t& id)
+        {
+            if (first != last && (*first == '}' || *first == ':'))
+            {
+                id = ctx.next_arg_id();
+                return first;
+            }
+            if (first == last || !format_is_digit(*first) || (*first == '0' && last - first > 1 && format_is_digit(first[1])))
+            {
+                format_throw_error("invalid argument id in format string");
+            }
+            int value = 0;
+            first = format_parse_integer(first, last, value);
+            id = static_cast<std::size_t>(value);
+            ctx.check_arg_id(id);
+            return first;
+        }
+
+        /**
+         * @brief Parses a nested `{}` or `{n}` width or precision, starting just after its '{'.
+         */
+        constexpr const char* format_parse_dynamic_spec(const char* first, const char* last, basic_format_parse_context<char>& ctx, int& argId)
+        {
+            std::size_t id = 0;
+            first = format_parse_arg_id(first, last, ctx, id);
+            if (first == last || *first != '}')
+            {
+                format_throw_error("invalid dynamic width or precision in format string");
+            }
+            ctx.check_dynamic_spec_integral(id);
+            argId = static_cast<int>(id);
+            return first + 1;
+        }
+
+        constexpr std::size_t format_code_point_length(char lead) noexcept
+        {
+            const auto byte = static_cast<unsigned char>(lead);
+            if (byte >= 0xF0 && byte <= 0xF7)
+            {
+                return 4;
+            }
+            if (byte >= 0xE0)
+            {
+                return byte <= 0xEF ? 3 : 1;
+            }
+            return byte >= 0xC0 ? 2 : 1;
+        }
+
+        constexpr format_align format_parse_align(char c) noexcept
+        {
+            switch (c)
+            {
+            case '<':
+                return format_align::left;
+            case '>':
+                return format_align::right;
+            case '^':
+                return format_align::center;
+            default:
+                return format_align::none;
+            }
+        }
+
+        /**
+         * @brief Parses `[[fill]align][sign][#][0][width][.precision][L][type]` from the context's position, and returns
+         *        where it stopped, which is the closing '}' of a valid replacement field.
+         */
+        constexpr const char* format_parse_standard_spec(basic_format_parse_context<char>& ctx, format_spec& spec)
+        {
+            const char* it = ctx.begin();
+            const char* const last = ctx.end();
+            if (it == last || *it == '}')
+            {
+                return it;
+            }
+
+            const std::size_t fillLength = format_code_point_length(*it);
+            if (static_cast<std::size_t>(last - it) > fillLength && format_parse_align(it[fillLength]) != format_align::none)
+            {
+                if (*it == '{')
+                {
+                    format_throw_error("invalid fill character '{' in format string");
+                }
+                for (std::size_t i = 0; i < fillLength; ++i)
+                {
+                    spec.fill[i] = it[i];
+                }
+                spec.fill_size = static_cast<unsigned char>(fillLength);
+                spec.align = format_parse_align(it[fillLength]);
+                it += fillLength + 1;
+            }
+            else if (format_parse_align(*it) != format_align::none)
+            {
+                spec.align = format_parse_align(*it);
+                ++it;
+            }
+
+            if (it != last && (*it == '+' || *it == '-' || *it == ' '))
+            {
+                spec.sign = *it == '+' ? format_sign::plus : *it == '-' ? format_sign::minus : format_sign::space;
+                ++it;
+            }
+            if (it != last && *it == '#')
+            {
+                spec.alternate = true;
+                ++it;
+            }
+            if (it != last && *it == '0')
+            {
+                spec.zero_pad = true;
+                ++it;
+            }
+
+            if (it != last && format_is_digit(*it))
+            {
+                it = format_parse_integer(it, last, spec.width);
+            }
+            else if (it != last && *it == '{')
+            {
+                it = format_parse_dynamic_spec(it + 1, last, ctx, spec.width_arg_id);
+            }
+
+            if (it != last && *it == '.')
+            {
+                ++it;
+                if (it != last && format_is_digit(*it))
+                {
+                    it = format_parse_integer(it, last, spec.precision);
+                }
+                else if (it != last && *it == '{')
+                {
+                    it = format_parse_dynamic_spec(it + 1, last, ctx, spec.precision_arg_id);
+                }
+                else
+                {
+                    format_throw_error("missing precision after '.' in format string");
+                }
+            }
+
+            if (it != last && *it == 'L')
+            {
+                spec.locale_specific = true;
+                ++it;
+            }
+            if (it != last && *it != '}')
+            {
+                spec.type = *it++;
+            }
+            return it;
+        }
+
+        /**
+         * @brief Checks that the spec makes sense for the type of its argument.
+         */
+        constexpr void format_check_spec(format_arg_type type, const format_spec& spec)
+        {
+            const char presentation = spec.type;
+            const bool integerPresentation = presentation == 'b' || presentation == 'B' || presentation == 'd' || presentation == 'o' ||
+                presentation == 'x' || presentation == 'X';
+            bool numeric = false;
+            bool allowsPrecision = false;
+            bool valid = false;
+            switch (type)
+            {
+            case format_arg_type::boolean:
+                valid = presentation == '\0' || presentation == 's' || integerPresentation;
+                numeric = integerPresentation;
+                break;
+            case format_arg_type::character:
+                valid = presentation == '\0' || presentation == 'c' || integerPresentation;
+                numeric = integerPresentation;
+                break;
+            case format_arg_type::int_type:
+            case format_arg_type::unsigned_type:
+            case format_arg_type::long_long_type:
+            case format_arg_type::unsigned_long_long_type:
+                valid = presentation == '\0' || presentation == 'c' || integerPresentation;
+                numeric = presentation != 'c';
+                break;
+            case format_arg_type::float_type:
+            case format_arg_type::double_type:
+                valid = presentation == '\0' || presentation == 'a' || presentation == 'A' || presentation == 'e' || presentation == 'E' ||
+                    presentation == 'f' || presentation == 'F' || presentation == 'g' || presentation == 'G';
+                numeric = true;
+                allowsPrecision = true;
+                break;
+            case format_arg_type::c_string:
+            case format_arg_type::string:
+                valid = presentation == '\0' || presentation == 's';
+                allowsPrecision = true;
+                break;
+            case format_arg_type::pointer:
+                valid = presentation == '\0' || presentation == 'p' || presentation == 'P';
+                if (spec.sign != format_sign::none || spec.alternate)
+                {
+                    format_throw_error("sign and '#' aren't allowed for pointers");
+                }
+                return;
+            case format_arg_type::none:
+            case format_arg_type::custom:
+                return;
+            }
+
+            if (!valid)
+            {
+                format_throw_error("invalid presentation type for the argument in format string");
+            }
+            if (!numeric && (spec.sign != format_sign::none || spec.alternate || spec.zero_pad))
+            {
+                format_throw_error("sign, '#' and '0' are only allowed for numeric presentations");
+            }
+            if (!allowsPrecision && (spec.precision >= 0 || spec.precision_arg_id >= 0))
+            {
+                format_throw_error("precision is only allowed for floating point and string arguments");
+            }
+        }
+
+        /**
+         * @brief Walks the format string, calling `handler.OnText` with each run of literal text and `handler.OnField` with
+         *        each argument id, with `ctx` at the start of its spec. `OnField` returns where the spec ended.
+         */
+        template <class Handler>
+        constexpr void format_scan(std::string_view fmt, basic_format_parse_context<char>& ctx, Handler& handler)
+        {
+            const char* it = fmt.data();
+            const char* const last = it + fmt.size();
+            const char* text = it;
+            while (it != last)
+            {
+                const char c = *it;
+                if (c == '{')
+                {
+                    if (last - it == 1)
+                    {
+                        format_throw_error("unmatched '{' in format string");
+                    }
+                    if (it[1] == '{')
+                    {
+                        handler.OnText(text, it + 1);
+                        it += 2;
+                        text = it;
+                        continue;
+                    }
+                    handler.OnText(text, it);
+
+                    std::size_t id = 0;
+                    it = format_parse_arg_id(it + 1, last, ctx, id);
+                    if (it != last && *it == ':')
+                    {
+                        ++it;
+                    }
+                    else if (it == last || *it != '}')
+                    {
+                        format_throw_error("invalid replacement field in format string");
+                    }
+                    ctx.advance_to(it);
+                    it = handler.OnField(id, ctx);
+                    if (it == last || *it != '}')
+                    {
+                        format_throw_error("missing '}' in format string");
+                    }
+                    ++it;
+                    text = it;
+                }
+                else if (c == '}')
+                {
+                    if (last - it == 1 || it[1] != '}')
+                    {
+                        format_throw_error("unmatched '}' in format string");
+                    }
+                    handler.OnText(text, it + 1);
+                    it += 2;
+                    text = it;
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+            handler.OnText(text, last);
+        }
+
+        using format_custom_parser = const char* (*)(basic_format_parse_context<char>& ctx);
+
+        template <class T>
+        constexpr const char* format_parse_custom(basic_format_parse_context<char>& ctx)
+        {
+            formatter<T, char> f;
+            return f.parse(ctx);
+        }
+
+        template <class T>
+        constexpr format_custom_parser format_custom_parser_of() noexcept
+        {
+            if constexpr (format_arg_type_of<T>() == format_arg_type::custom && formattable<const T, char>)
+            {
+                return &format_parse_custom<T>;
+            }
+            else
+            {
+                return nullptr;
+            }
+        }
+
+        /**
+         * @brief Records the pieces of a format string while checking it at compile time.
+         */
+        struct format_compile_handler
+        {
+            constexpr void OnText(const char* textFirst, const char* textLast)
+            {
+                if (textFirst == textLast)
+                {
+                    return;
+                }
+                // Two runs of text in a row, around an escaped brace, each get a piece.
+                if (pending.literal_size != 0)
+                {
+                    Push();
+                }
+                pending.literal_begin = static_cast<std::uint32_t>(textFirst - base);
+                pending.literal_size = static_cast<std::uint32_t>(textLast - textFirst);
+            }
+
+            constexpr const char* OnField(std::size_t id, basic_format_parse_context<char>& ctx)
+            {
+                const char* end = nullptr;
+                pending.arg_id = static_cast<int>(id);
+                if (arg_types[id] == format_arg_type::custom)
+                {
+                    pending.spec_begin = static_cast<std::uint32_t>(ctx.begin() - base);
+                    pending.next_arg_id = static_cast<std::uint32_t>(format_access::NextArgId(ctx));
+                    end = custom_parsers[id](ctx);
+                }
+                else
+                {
+                    end = format_parse_standard_spec(ctx, pending.spec);
+                    format_check_spec(arg_types[id], pending.spec);
+                }
+                Push();
+                return end;
+            }
+
+            constexpr void Push()
+            {
+                if (count < capacity)
+                {
+                    pieces[count] = pending;
+                }
+                ++count;
+                pending = format_piece{};
+            }
+
+            constexpr void Finish()
+            {
+                if (pending.literal_size != 0)
+                {
+                    Push();
+                }
+            }
+
+            const char* base;
+            format_piece* pieces;
+            std::size_t capacity;
+            const format_arg_type* arg_types;
+            const format_custom_parser* custom_parsers;
+            std::size_t count = 0;
+            format_piece pending{};
+        };
+
+        /**
+         * @brief Checks `fmt` against `Args` and compiles it into `pieces`. Returns how many pieces it has, which may be
+         *        more than `capacity`, in which case only the check is done.
+         */
+        template <class... Args>
+        constexpr std::size_t format_compile(std::string_view fmt, format_piece* pieces, std::size_t capacity)
+        {
+            constexpr format_arg_type argTypes[] = {format_arg_type_of<Args>()..., format_arg_type::none};
+            constexpr format_custom_parser customParsers[] = {format_custom_parser_of<Args>()..., nullptr};
+            basic_format_parse_context<char> ctx = format_access::MakeParseContext<char>(fmt, sizeof...(Args), argTypes);
+            format_compile_handler handler{fmt.data(), pieces, capacity, argTypes, customParsers};
+            format_scan(fmt, ctx, handler);
+            handler.Finish();
+            return handler.count;
+        }
+
+        //
+        // Writing
+        //
+
+        template <class Context>
+        int format_dynamic_spec_value(const basic_format_arg<Context>& arg)
+        {
+            const format_arg_value<Context>& value = format_access::Value(arg);
+            long long result = -1;
+            switch (format_access::Type(arg))
+            {
+            case format_arg_type::int_type:
+                result = value.int_value;
+                break;
+            case format_arg_type::unsigned_type:
+                result = value.unsigned_value;
+                break;
+            case format_arg_type::long_long_type:
+                result = value.long_long_value;
+                break;
+            case format_arg_type::unsigned_long_long_type:
+                result = value.unsigned_long_long_value > INT_MAX ? -1 : static_cast<long long>(value.unsigned_long_long_value);
+                break;
+            default:
+                format_throw_error("dynamic width or precision isn't an integer");
+            }
+            if (result < 0 || result > INT_MAX)
+            {
+                format_throw_error("dynamic width or precision is negative or too big");
+            }
+            return static_cast<int>(result);
+        }
+
+        template <class Context>
+        void format_resolve_dynamic_spec(format_spec& spec, const Context& ctx)
+        {
+            if (spec.width_arg_id >= 0)
+            {
+                spec.width = format_dynamic_spec_value(ctx.arg(static_cast<std::size_t>(spec.width_arg_id)));
+            }
+            if (spec.precision_arg_id >= 0)
+            {
+                spec.precision = format_dynamic_spec_value(ctx.arg(static_cast<std::size_t>(spec.precision_arg_id)));
+            }
+        }
+
+        inline void format_write_padded(format_buffer& buffer, const format_spec& spec, format_align defaultAlign, std::string_view content,
+            std::size_t contentWidth)
+        {
+            const auto width = static_cast<std::size_t>(spec.width);
+            if (width <= contentWidth)
+            {
+                buffer.Append(content);
+                return;
+            }
+            const std::size_t padding = width - contentWidth;
+            std::size_t before = 0;
+            switch (spec.align == format_align::none ? defaultAlign : spec.align)
+            {
+            case format_align::right:
+                before = padding;
+                break;
+            case format_align::center:
+                before = padding / 2;
+                break;
+            default:
+                break;
+            }
+            buffer.Fill(before, spec);
+            buffer.Append(content);
+            buffer.Fill(padding - before, spec);
+        }
+
+        /**
+         * @brief Writes a number from `[first, last)`, whose first `prefixSize` characters are its sign and base prefix,
+         *        which zero padding goes after.
+         */
+        inline void format_write_number(format_buffer& buffer, const format_spec& spec, const char* first, std::size_t prefixSize, const char* last,
+            bool allowZeroPad)
+        {
+            const auto size = static_cast<std::size_t>(last - first);
+            const auto width = static_cast<std::size_t>(spec.width);
+            if (width <= size)
+            {
+                buffer.Append(first, last);
+            }
+            else if (spec.zero_pad && allowZeroPad && spec.align == format_align::none)
+            {
+                buffer.Append(first, first + prefixSize);
+                buffer.Fill(width - size, '0');
+                buffer.Append(first + prefixSize, last);
+            }
+            else
+            {
+                format_write_padded(buffer, spec, format_align::right, std::string_view(first, size), size);
+            }
+        }
+
+        inline char* format_write_sign(char* first, bool negative, format_sign sign) noexcept
+        {
+            if (negative)
+            {
+                *--first = '-';
+            }
+            else if (sign == format_sign::plus)
+            {
+                *--first = '+';
+            }
+            else if (sign == format_sign::space)
+            {
+                *--first = ' ';
+            }
+            return first;
+        }
+
+        inline void format_to_upper(char* first, char* last) noexcept
+        {
+            for (; first != last; ++first)
+            {
+                if (*first >= 'a' && *first <= 'z')
+                {
+                    *first = static_cast<char>(*first - 'a' + 'A');
+                }
+            }
+        }
+
+        inline void format_write_char(format_buffer& buffer, char c, const format_spec& spec)
+        {
+            if (spec.width <= 1)
+            {
+                buffer.PushBack(c);
+                return;
+            }
+            format_write_padded(buffer, spec, format_align::left, std::string_view(&c, 1), 1);
+        }
+
+        inline void format_write_integer(format_buffer& buffer, unsigned long long magnitude, bool negative, const format_spec& spec)
+        {
+            if (spec.type == 'c')
+            {
+                constexpr auto charMax = static_cast<unsigned long long>(std::numeric_limits<char>::max());
+                constexpr auto charMinMagnitude = static_cast<unsigned long long>(-static_cast<long long>(std::numeric_limits<char>::min()));
+                if (negative ? magnitude > charMinMagnitude : magnitude > charMax)
+                {
+                    format_throw_error("integer value out of range for the 'c' presentation");
+                }
+                format_write_char(buffer, static_cast<char>(negative ? -static_cast<long long>(magnitude) : static_cast<long long>(magnitude)), spec);
+                return;
+            }
+
+            // Room for a sign and a two character prefix before 64 binary digits.
+            char storage[3 + 64];
+            char* const digits = storage + 3;
+            int base = 10;
+            switch (spec.type)
+            {
+            case 'b':
+            case 'B':
+                base = 2;
+                break;
+            case 'o':
+                base = 8;
+                break;
+            case 'x':
+            case 'X':
+                base = 16;
+                break;
+            default:
+                break;
+            }
+            char* const digitsEnd = StdReimpl::to_chars(digits, storage + sizeof(storage), magnitude, base).ptr;
+            if (spec.type == 'X')
+            {
+                format_to_upper(digits, digitsEnd);
+            }
+
+            char* first = digits;
+            if (spec.alternate)
+            {
+                if (base == 2 || base == 16)
+                {
+                    *--first = spec.type;
+                    *--first = '0';
+                }
+                else if (base == 8 && magnitude != 0)
+                {
+                    *--first = '0';
+                }
+            }
+            first = format_write_sign(first, negative, spec.sign);
+            format_write_number(buffer, spec, first, static_cast<std::size_t>(digits - first), digitsEnd, true);
+        }
+
+        template <class T>
+        void format_write_signed(format_buffer& buffer, T value, const format_spec& spec)
+        {
+            const bool negative = value < 0;
+            const auto magnitude = static_cast<unsigned long long>(value);
+            format_write_integer(buffer, negative ? 0 - magnitude : magnitude, negative, spec);
+        }
+
+        inline void format_write_bool(format_buffer& buffer, bool value, const format_spec& spec)
+        {
+            if (spec.type == '\0' || spec.type == 's')
+            {
+                const std::string_view text = value ? "true" : "false";
+                format_write_padded(buffer, spec, format_align::left, text, text.size());
+                return;
+            }
+            format_write_integer(buffer, value ? 1 : 0, false, spec);
+        }
+
+        inline void format_write_character(format_buffer& buffer, char value, const format_spec& spec)
+        {
+            if (spec.type == '\0' || spec.type == 'c')
+            {
+                format_write_char(buffer, value, spec);
+            }
+            else if (spec.type == 'd')
+            {
+                format_write_signed(buffer, static_cast<int>(value), spec);
+            }
+            else
+            {
+                format_write_integer(buffer, static_cast<unsigned char>(value), false, spec);
+            }
+        }
+
+        /**
+         * @brief Widths and precisions of strings count code points, which is the standard's estimate of the display
+         *        width without its table of wide East Asian characters.
+         */
+        inline std::size_t format_count_code_points(std::string_view text) noexcept
+        {
+            std::size_t count = 0;
+            for (const char c : text)
+            {
+                count += (static_cast<unsigned char>(c) & 0xC0) != 0x80;
+            }
+            return count;
+        }
+
+        inline void format_write_string(format_buffer& buffer, std::string_view text, const format_spec& spec)
+        {
+            if (spec.precision >= 0)
+            {
+                std::size_t codePoints = 0;
+                for (std::size_t i = 0; i < text.size(); ++i)
+                {
+                    if ((static_cast<unsigned char>(text[i]) & 0xC0) != 0x80 && codePoints++ == static_cast<std::size_t>(spec.precision))
+                    {
+                        text = text.substr(0, i);
+                        break;
+                    }
+                }
+            }
+            if (spec.width == 0)
+            {
+                buffer.Append(text);
+                return;
+            }
+            format_write_padded(buffer, spec, format_align::left, text, format_count_code_points(text));
+        }
+
+        inline void format_write_pointer(format_buffer& buffer, const void* value, const format_spec& spec)
+        {
+            char storage[2 + 2 * sizeof(std::uintptr_t)];
+            char* const digits = storage + 2;
+            char* const digitsEnd = StdReimpl::to_chars(digits, storage + sizeof(storage), reinterpret_cast<std::uintptr_t>(value), 16).ptr;
+            storage[0] = '0';
+            storage[1] = 'x';
+            if (spec.type == 'P')
+            {
+                format_to_upper(storage, digitsEnd);
+            }
+            format_write_number(buffer, spec, storage, 2, digitsEnd, true);
+        }
+
+        /**
+         * @brief Adds the decimal point that the alternate form always has and, when `significantDigits` isn't 0, the
+         *        trailing zeros that `%#g` keeps.
+         */
+        inline char* format_apply_alternate_form(char* first, char* last, char exponentChar, int significantDigits) noexcept
+        {
+            char* const exponent = std::find(first, last, exponentChar);
+            const bool hasPoint = std::find(first, exponent, '.') != exponent;
+
+            int digits = 0;
+            if (significantDigits != 0)
+            {
+                int allDigits = 0;
+                bool leading = true;
+                for (const char* it = first; it != exponent; ++it)
+                {
+                    if (*it == '.')
+                    {
+                        continue;
+                    }
+                    ++allDigits;
+                    leading = leading && *it == '0';
+                    digits += !leading;
+                }
+                // Zero itself has one significant digit.
+                if (digits == 0)
+                {
+                    digits = allDigits;
+                }
+            }
+
+            const std::size_t zeros = significantDigits > digits ? static_cast<std::size_t>(significantDigits - digits) : 0;
+            const std::size_t inserted = (hasPoint ? 0 : 1) + zeros;
+            std::memmove(exponent + inserted, exponent, static_cast<std::size_t>(last - exponent));
+            char* it = exponent;
+            if (!hasPoint)
+            {
+                *it++ = '.';
+            }
+            std::memset(it, '0', zeros);
+            return last + inserted;
+        }
+
+        template <class T>
+        void format_write_float(format_buffer& buffer, T value, const format_spec& spec)
+        {
+            const bool negative = std::signbit(value);
+            if (negative)
+            {
+                value = -value;
+            }
+
+            const char type = spec.type;
+            int precision = spec.precision;
+            chars_format fmt = chars_format::general;
+            switch (type)
+            {
+            case 'a':
+            case 'A':
+                fmt = chars_format::hex;
+                break;
+            case 'e':
+            case 'E':
+                fmt = chars_format::scientific;
+                precision = precision < 0 ? 6 : precision;
+                break;
+            case 'f':
+            case 'F':
+                fmt = chars_format::fixed;
+                precision = precision < 0 ? 6 : precision;
+                break;
+            case 'g':
+            case 'G':
+                precision = precision < 0 ? 6 : precision;
+                break;
+            default:
+                break;
+            }
+
+            // The longest is a fixed value with every integer digit, a point, and the precision's digits, which the
+            // alternate form can pad with as many zeros again. Only long precisions need the heap.
+            constexpr std::size_t localSize = 512;
+            const std::size_t needed = 1 + std::numeric_limits<T>::max_exponent10 + 16 + 2 * static_cast<std::size_t>(precision < 0 ? 0 : precision);
+            char local[localSize];
+            std::unique_ptr<char[]> heap;
+            char* storage = local;
+            if (needed > localSize)
+            {
+                heap.reset(new char[needed]);
+                storage = heap.get();
+            }
+
+            // Leaves room for the sign in front.
+            char* const first = storage + 1;
+            char* const last = storage + needed;
+            char* end = nullptr;
+            if (precision < 0)
+            {
+                end = type == '\0' ? StdReimpl::to_chars(first, last, value).ptr : StdReimpl::to_chars(first, last, value, fmt).ptr;
+            }
+            else
+            {
+                end = StdReimpl::to_chars(first, last, value, fmt, precision).ptr;
+            }
+
+            const bool finite = std::isfinite(value);
+            if (spec.alternate && finite)
+            {
+                const bool keepsZeros = type == 'g' || type == 'G' || (type == '\0' && precision >= 0);
+                end = format_apply_alternate_form(first, end, fmt == chars_format::hex ? 'p' : 'e', keepsZeros ? std::max(precision, 1) : 0);
+            }
+            if (type == 'A' || type == 'E' || type == 'F' || type == 'G')
+            {
+                format_to_upper(first, end);
+            }
+
+            char* const signedFirst = format_write_sign(first, negative, spec.sign);
+            format_write_number(buffer, spec, signedFirst, static_cast<std::size_t>(first - signedFirst), end, finite);
+        }
+
+        template <class Context>
+        void format_write_arg(format_buffer& buffer, format_arg_type type, const format_arg_value<Context>& value, const format_spec& spec)
+        {
+            switch (type)
+            {
+            case format_arg_type::boolean:
+                format_write_bool(buffer, value.bool_value, spec);
+                break;
+            case format_arg_type::character:
+                format_write_character(buffer, value.char_value, spec);
+                break;
+            case format_arg_type::int_type:
+                format_write_signed(buffer, value.int_value, spec);
+                break;
+            case format_arg_type::unsigned_type:
+                format_write_integer(buffer, value.unsigned_value, false, spec);
+                break;
+            case format_arg_type::long_long_type:
+                format_write_signed(buffer, value.long_long_value, spec);
+                break;
+            case format_arg_type::unsigned_long_long_type:
+                format_write_integer(buffer, value.unsigned_long_long_value, false, spec);
+                break;
+            case format_arg_type::float_type:
+                format_write_float(buffer, value.float_value, spec);
+                break;
+            case format_arg_type::double_type:
+                format_write_float(buffer, value.double_value, spec);
+                break;
+            case format_arg_type::c_string:
+                format_write_string(buffer, std::string_view(value.c_string_value), spec);
+                break;
+            case format_arg_type::string:
+                format_write_string(buffer, std::string_view(value.string_value.data, value.string_value.size), spec);
+                break;
+            case format_arg_type::pointer:
+                format_write_pointer(buffer, value.pointer_value, spec);
+                break;
+            case format_arg_type::none:
+            case format_arg_type::custom:
+                break;
+            }
+        }
+
+        //
+        // Formatting
+        //
+
+        /**
+         * @brief Formats a format string that wasn't compiled, parsing it as it goes.
+         */
+        struct format_runtime_handler
+        {
+            void OnText(const char* first, const char* last)
+            {
+                buffer.Append(first, last);
+            }
+
+            const char* OnField(std::size_t id, basic_format_parse_context<char>& ctx)
+            {
+                const basic_format_arg<format_context> arg = args.get(id);
+                const format_arg_type type = format_access::Type(arg);
+                const format_arg_value<format_context>& value = format_access::Value(arg);
+                if (type == format_arg_type::custom)
+                {
+                    value.custom_value.format(ctx, context, value.custom_value.object);
+                    return ctx.begin();
+                }
+                format_spec spec;
+                const char* end = format_parse_standard_spec(ctx, spec);
+                format_check_spec(type, spec);
+                format_resolve_dynamic_spec(spec, context);
+                format_write_arg(buffer, type, value, spec);
+                return end;
+            }
+
+            format_buffer& buffer;
+            format_args args;
+            format_context& context;
+        };
+
+        inline void format_vformat(format_buffer& buffer, std::string_view fmt, format_args args)
+        {
+            format_context context = format_access::MakeContext<format_context>(format_buffer_iterator(buffer), args);
+            basic_format_parse_context<char> ctx = format_access::MakeParseContext<char>(fmt, format_access::Size(args), nullptr);
+            format_runtime_handler handler{buffer, args, context};
+            format_scan(fmt, ctx, handler);
+        }
+
+        /**
+         * @brief Formats from the pieces compiled at compile time. Only the custom formatters parse anything.
+         */
+        inline void format_vformat_compiled(format_buffer& buffer, std::string_view fmt, const format_piece* pieces, std::size_t count, format_args args)
+        {
+            format_context context = format_access::MakeContext<format_context>(format_buffer_iterator(buffer), args);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const format_piece& piece = pieces[i];
+                if (piece.literal_size != 0)
+                {
+                    buffer.Append(fmt.data() + piece.literal_begin, fmt.data() + piece.literal_begin + piece.literal_size);
+                }
+                if (piece.arg_id < 0)
+                {
+                    continue;
+                }
+
+                const basic_format_arg<format_context> arg = args.get(static_cast<std::size_t>(piece.arg_id));
+                const format_arg_type type = format_access::Type(arg);
+                const format_arg_value<format_context>& value = format_access::Value(arg);
+                if (type == format_arg_type::custom)
+                {
+                    basic_format_parse_context<char> ctx = format_access::MakeParseContext<char>(fmt, format_access::Size(args), nullptr);
+                    ctx.advance_to(fmt.data() + piece.spec_begin);
+                    format_access::SetNextArgId(ctx, piece.next_arg_id);
+                    value.custom_value.format(ctx, context, value.custom_value.object);
+                }
+                else if (piece.spec.width_arg_id < 0 && piece.spec.precision_arg_id < 0)
+                {
+                    format_write_arg(buffer, type, value, piece.spec);
+                }
+                else
+                {
+                    format_spec spec = piece.spec;
+                    format_resolve_dynamic_spec(spec, context);
+                    format_write_arg(buffer, type, value, spec);
+                }
+            }
+        }
+
+        template <class... Args>
+        void format_to_buffer(format_buffer& buffer, const basic_format_string<char, Args...>& fmt, format_args args)
+        {
+            if (format_access::Compiled(fmt))
+            {
+                format_vformat_compiled(buffer, fmt.get(), format_access::Pieces(fmt), format_access::PieceCount(fmt), args);
+            }
+            else
+            {
+                format_vformat(buffer, fmt.get(), args);
+            }
+        }
+
+        /**
+         * @brief Runs `write` on the buffer that suits `Out`, and returns where the output ended and how long it was.
+         */
+        template <class Out, class Write>
+        format_to_n_result<Out> format_to_output(Out out, std::size_t limit, Write&& write)
+        {
+            using difference_type = std::iter_difference_t<Out>;
+            if constexpr (std::is_same_v<Out, char*>)
+            {
+                format_pointer_buffer buffer(out, limit);
+                write(static_cast<format_buffer&>(buffer));
+                const std::size_t count = buffer.Count();
+                return {out + std::min(count, limit), static_cast<difference_type>(count)};
+            }
+            else
+            {
+                format_iterator_buffer<Out> buffer(std::move(out), limit);
+                write(static_cast<format_buffer&>(buffer));
+                const std::size_t count = buffer.Count();
+                return {buffer.Finish(), static_cast<difference_type>(count)};
+            }
+        }
+
+        template <class Out, class Write>
+        Out format_to_iterator(Out out, Write&& write)
+        {
+            if constexpr (std::is_same_v<Out, format_buffer_iterator>)
+            {
+                // A custom formatter writing to its context, which is already a buffer.
+                write(out.Buffer());
+                return out;
+            }
+            else
+            {
+                return format_to_output(std::move(out), static_cast<std::size_t>(-1), std::forward<Write>(write)).out;
+            }
+        }
+
+        //
+        // Built in formatters
+        //
+
+        template <class T, format_arg_type Type>
+        constexpr typename basic_format_parse_context<char>::iterator format_builtin_formatter<T, Type>::parse(basic_format_parse_context<char>& ctx)
+        {
+            const char* end = format_parse_standard_spec(ctx, spec);
+            format_check_spec(Type, spec);
+            return end;
+        }
+
+        template <class T, format_arg_type Type>
+        template <class FormatContext>
+        typename FormatContext::iterator format_builtin_formatter<T, Type>::format(const T& value, FormatContext& ctx) const
+        {
+            format_spec resolved = spec;
+            format_resolve_dynamic_spec(resolved, ctx);
+            const format_arg_value<format_context> stored = format_make_value<format_context, T>(value);
+            return format_to_iterator(ctx.out(), [&](format_buffer& buffer)
+                {
+                    format_write_arg(buffer, Type, stored, resolved);
+                });
+        }
+    }
+
+    //
+    // Format strings
+    //
+
+    template <class CharT, class... Args>
+    template <class T>
+        requires std::convertible_to<const T&, std::basic_string_view<CharT>>
+    consteval basic_format_string<CharT, Args...>::basic_format_string(const T& s)
+        : str(s)
+    {
+        static_assert(std::is_same_v<CharT, char>, "Only char format strings are supported.");
+        piece_count = Detail::format_compile<std::remove_cvref_t<Args>...>(str, pieces, piece_capacity);
+        compiled = piece_count <= piece_capacity;
+    }
+
+    template <class CharT, class... Args>
+    basic_format_string<CharT, Args...>::basic_format_string(Detail::runtime_format_string<CharT> s) noexcept
+        : str(s.str)
+    {
+    }
+
+    template <class CharT, class... Args>
+    constexpr std::basic_string_view<CharT> basic_format_string<CharT, Args...>::get() const noexcept
+    {
+        return str;
+    }
+
+    inline Detail::runtime_format_string<char> runtime_format(std::string_view fmt) noexcept
+    {
+        return {fmt};
+    }
+
+    //
+    // Formatting functions
+    //
+
+    template <class Context, class... Args>
+    Detail::format_arg_store<Context, Args...> make_format_args(Args&... args)
+    {
+        return Detail::format_access::MakeStore<Context>(args...);
+    }
+
+    template <class... Args>
+    std::string format(format_string<Args...> fmt, Args&&... args)
+    {
+        Detail::format_string_buffer buffer;
+        Detail::format_to_buffer(buffer, fmt, StdReimpl::make_format_args(args...));
+        return buffer.Finish();
+    }
+
+    inline std::string vformat(std::string_view fmt, format_args args)
+    {
+        Detail::format_string_buffer buffer;
+        Detail::format_vformat(buffer, fmt, args);
+        return buffer.Finish();
+    }
+
+    template <std::output_iterator<const char&> Out, class... Args>
+    Out format_to(Out out, format_string<Args...> fmt, Args&&... args)
+    {
+        return Detail::format_to_iterator(std::move(out), [&](Detail::format_buffer& buffer)
+            {
+                Detail::format_to_buffer(buffer, fmt, StdReimpl::make_format_args(args...));
+            });
+    }
+
+    template <std::output_iterator<const char&> Out>
+    Out vformat_to(Out out, std::string_view fmt, format_args args)
+    {
+        return Detail::format_to_iterator(std::move(out), [&](Detail::format_buffer& buffer)
+            {
+                Detail::format_vformat(buffer, fmt, args);
+            });
+    }
+
+    template <std::output_iterator<const char&> Out, class... Args>
+    format_to_n_result<Out> format_to_n(Out out, std::iter_difference_t<Out> n, format_string<Args...> fmt, Args&&... args)
+    {
+        const std::size_t limit = n > 0 ? static_cast<std::size_t>(n) : 0;
+        return Detail::format_to_output(std::move(out), limit, [&](Detail::format_buffer& buffer)
+            {
+                Detail::format_to_buffer(buffer, fmt, StdReimpl::make_format_args(args...));
+            });
+    }
+
+    template <class... Args>
+    std::size_t formatted_size(format_string<Args...> fmt, Args&&... args)
+    {
+        Detail::format_counting_buffer buffer;
+        Detail::format_to_buffer(buffer, fmt, StdReimpl::make_format_args(args...));
+        return buffer.Count();
+    }
+
+    template <class... Args>
+    void print(format_string<Args...> fmt, Args&&... args)
+    {
+        StdReimpl::print(stdout, fmt, std::forward<Args>(args)...);
+    }
+
+    template <class... Args>
+    void print(std::FILE* stream, format_string<Args...> fmt, Args&&... args)
+    {
+        Detail::format_file_buffer buffer(stream);
+        Detail::format_to_buffer(buffer, fmt, StdReimpl::make_format_args(args...));
+        buffer.Finish();
+    }
+
+    template <class... Args>
+    void println(format_string<Args...> fmt, Args&&... args)
+    {
+        StdReimpl::println(stdout, fmt, std::forward<Args>(args)...);
+    }
+
+    template <class... Args>
+    void println(std::FILE* stream, format_string<Args...> fmt, Args&&... args)
+    {
+        Detail::format_file_buffer buffer(stream);
+        Detail::format_to_buffer(buffer, fmt, StdReimpl::make_format_args(args...));
+        buffer.PushBack('\n');
+        buffer.Finish();
+    }
+
+    inline void println()
+    {
+        StdReimpl::println(stdout);
+    }
+
+    inline void println(std::FILE* stream)
+    {
+        Detail::format_write_to_file(stream, "\n", 1);
+    }
+
+    inline void vprint_unicode(std::FILE* stream, std::string_view fmt, format_args args)
+    {
+        Detail::format_file_buffer buffer(stream);
+        Detail::format_vformat(buffer, fmt, args);
+        buffer.Finish();
+    }
+
+    inline void vprint_unicode(std::string_view fmt, format_args args)
+    {
+        StdReimpl::vprint_unicode(stdout, fmt, args);
+    }
+
+    inline void vprint_nonunicode(std::FILE* stream, std::string_view fmt, format_args args)
+    {
+        StdReimpl::vprint_unicode(stream, fmt, args);
+    }
+
+    inline void vprint_nonunicode(std::string_view fmt, format_args args)
+    {
+        StdReimpl::vprint_unicode(stdout, fmt, args);
+    }
+}
@@ -2,10 +2,38 @@
 
 #pragma once
 
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/concepts.h>
 #include <functional>
 #include <type_traits>
 #include <CppUtils/StdReimpl/utility.h>
 #include <memory>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief The default size, in bytes, of the buffer that `StdReimpl::move_only_function` stores callables in without
+ *        allocating. Define it before including this header to change it for the whole build. A single
+ *        `move_only_function` type can also pick its own size through its second template parameter.
+ */
+#ifndef CPPUTILS_STDREIMPL_MOVE_ONLY_FUNCTION_INLINE_CAPACITY
+#   define CPPUTILS_STDREIMPL_MOVE_ONLY_FUNCTION_INLINE_CAPACITY (3 * sizeof(void*))
+#endif
+
+/**
+ * @brief The default capacity, in bytes, of `StdReimpl::inplace_function`. Define it before including this header to
+ *        change it for the whole build.
+ */
+#ifndef CPPUTILS_STDREIMPL_INPLACE_FUNCTION_DEFAULT_CAPACITY
+#   define CPPUTILS_STDREIMPL_INPLACE_FUNCTION_DEFAULT_CAPACITY (4 * sizeof(void*))
+#endif
 
 namespace StdReimpl
 {
@@ -15,11 +43,35 @@ namespace StdReimpl
      * @see https://cppreference.com/w/cpp/utility/functional/invoke.html
      */
     template <class R, class F, class... Args>
-        requires (std::is_invocable_r_v<R, F, Args...>)
+        requires (StdReimpl::Detail::invocable_r<R, F, Args...>)
     constexpr R invoke_r(F&& f, Args&&... args)
-        noexcept(std::is_nothrow_invocable_r_v<R, F, Args...>)
+        noexcept(StdReimpl::Detail::nothrow_invocable_r<R, F, Args...>)
     {
-        if constexpr (std::is_void_v<R>)
+        // Every wrapper call goes through here, so plain calls, and pointers to members applied to objects or
+        // pointers, are made without instantiating `std::invoke`, or a `std::forward` per argument.
+        if constexpr (StdReimpl::Detail::invoke_is_call<F>)
+        {
+            if constexpr (std::is_void_v<R>)
+            {
+                static_cast<F&&>(f)(static_cast<Args&&>(args)...);
+            }
+            else
+            {
+                return static_cast<F&&>(f)(static_cast<Args&&>(args)...);
+            }
+        }
+        else if constexpr (StdReimpl::Detail::member_invoke<F, Args...>::is_direct)
+        {
+            if constexpr (std::is_void_v<R>)
+            {
+                StdReimpl::Detail::member_invoke<F, Args...>::Invoke(static_cast<F&&>(f), static_cast<Args&&>(args)...);
+            }
+            else
+            {
+                return StdReimpl::Detail::member_invoke<F, Args...>::Invoke(static_cast<F&&>(f), static_cast<Args&&>(args)...);
+            }
+        }
+        else if constexpr (std::is_void_v<R>)
         {
             std::invoke(std::forward<F>(f), std::forward<Args>(args)...);
         }
@@ -29,11 +81,178 @@ namespace StdReimpl
         }
     }
 
-    // Implementation of C++26 feature `std::function_ref`. TODO: Implement it properly and fix all the errors we get when we try using it. So far all that's implemented is what I read from the Working Draft. I wouldn't doubt there are mistakes in the starting point code I wrote below. I was especially unconfident with how I decided to use the "invoke" functions in the thunk lambdas.
-#if 0
-    // https://eel.is/c++draft/func.wrap.ref
+    namespace Detail
+    {
+        /**
+         * @brief `std::invoke`, with the same fast paths as `invoke_r`, for our call wrappers to forward through.
+         */
+        template <class F, class... Args>
+            requires (StdReimpl::Detail::invocable_r<void, F, Args...>)
+        constexpr decltype(auto) invoke(F&& f, Args&&... args)
+            noexcept(StdReimpl::Detail::nothrow_invocable_r<void, F, Args...>)
+        {
+            if constexpr (StdReimpl::Detail::invoke_is_call<F>)
+            {
+                return static_cast<F&&>(f)(static_cast<Args&&>(args)...);
+            }
+            else if constexpr (StdReimpl::Detail::member_invoke<F, Args...>::is_direct)
+            {
+                return StdReimpl::Detail::member_invoke<F, Args...>::Invoke(static_cast<F&&>(f), static_cast<Args&&>(args)...);
+            }
+            else
+            {
+                return std::invoke(std::forward<F>(f), std::forward<Args>(args)...);
+            }
+        }
+
+        template <class F, class... Args>
+        using invoke_result_t = decltype(StdReimpl::Detail::invoke(std::declval<F>(), std::declval<Args>()...));
+
+        /**
+         * @brief The bound entity of a `function_ref`. Holds either an object pointer or a function pointer, so that
+         *        `function_ref` is trivially copyable and exactly two pointers wide (this plus the thunk pointer).
+         */
+        union function_ref_bound_entity
+        {
+            constexpr function_ref_bound_entity() noexcept
+                : object_ptr{nullptr}
+            {
+            }
+
+            template <class T>
+                requires (std::is_object_v<T>)
+            constexpr function_ref_bound_entity(T* object) noexcept
+                : object_ptr{object}
+            {
+            }
+
+            template <class T>
+                requires (std::is_function_v<T>)
+            function_ref_bound_entity(T* function) noexcept
+                : function_ptr{reinterpret_cast<void (*)()>(function)}
+            {
+            }
+
+            template <class T>
+            T* get() const noexcept
+            {
+                if constexpr (std::is_function_v<T>)
+                {
+                    return reinterpret_cast<T*>(function_ptr);
+                }
+                else
+                {
+                    return static_cast<T*>(const_cast<void*>(object_ptr));
+                }
+            }
+
+            const void* object_ptr;
+            void (*function_ptr)();
+        };
+
+        /**
+         * @brief Computes the signature deduced by `function_ref(constant_arg_t<f>, T&&)`. Has no `type` member if
+         *        `F` is not of one of the forms listed by the standard, which removes the deduction guide.
+         * @see https://eel.is/c++draft/func.wrap.ref.deduct
+         */
+        template <class F, class T>
+        struct function_ref_deduce_signature
+        {
+        };
+
+        template <class R, class G, class... A, bool E, class T>
+        struct function_ref_deduce_signature<R (*)(G, A...) noexcept(E), T>
+        {
+            using type = R(A...) noexcept(E);
+        };
+
+        template <class M, class G, class T>
+            requires (std::is_object_v<M>)
+        struct function_ref_deduce_signature<M G::*, T>
+        {
+            using type = std::invoke_result_t<M G::*, T&>() noexcept;
+        };
+
+        template <class R, class G, class... A, bool E, class T>
+        struct function_ref_deduce_signature<R (G::*)(A...) noexcept(E), T>
+        {
+            using type = R(A...) noexcept(E);
+        };
+
+        template <class R, class G, class... A, bool E, class T>
+        struct function_ref_deduce_signature<R (G::*)(A...) & noexcept(E), T>
+        {
+            using type = R(A...) noexcept(E);
+        };
+
+        template <class R, class G, class... A, bool E, class T>
+        struct function_ref_deduce_signature<R (G::*)(A...) && noexcept(E), T>
+        {
+            using type = R(A...) noexcept(E);
+        };
+
+        template <class R, class G, class... A, bool E, class T>
+        struct function_ref_deduce_signature<R (G::*)(A...) const noexcept(E), T>
+        {
+            using type = R(A...) noexcept(E);
+        };
+
+        template <class R, class G, class... A, bool E, class T>
+        struct function_ref_deduce_signature<R (G::*)(A...) const & noexcept(E), T>
+        {
+            using type = R(A...) noexcept(E);
+        };
+
+        template <class R, class G, class... A, bool E, class T>
+        struct function_ref_deduce_signature<R (G::*)(A...) const && noexcept(E), T>
+        {
+            using type = R(A...) noexcept(E);
+        };
+
+        template <class R, class G, class... A, bool E, class T>
+        struct function_ref_deduce_signature<R (G::*)(A...) volatile noexcept(E), T>
+        {
+            using type = R(A...) noexcept(E);
+        };
+
+        template <class R, class G, class... A, bool E, class T>
+        struct function_ref_deduce_signature<R (G::*)(A...) volatile & noexcept(E), T>
+        {
+            using type = R(A...) noexcept(E);
+        };
+
+        template <class R, class G, class... A, bool E, class T>
+        struct function_ref_deduce_signature<R (G::*)(A...) volatile && noexcept(E), T>
+        {
+            using type = R(A...) noexcept(E);
+        };
+
+        template <class R, class G, class... A, bool E, class T>
+        struct function_ref_deduce_signature<R (G::*)(A...) const volatile noexcept(E), T>
+        {
+            using type = R(A...) noexcept(E);
+        };
+
+        template <class R, class G, class... A, bool E, class T>
+        struct function_ref_deduce_signature<R (G::*)(A...) const volatile & noexcept(E), T>
+        {
+            using type = R(A...) noexcept(E);
+        };
+
+        template <class R, class G, class... A, bool E, class T>
+        struct function_ref_deduce_signature<R (G::*)(A...) const volatile && noexcept(E), T>
+        {
+            using type = R(A...) noexcept(E);
+        };
+    }
 
-    // Primary template.
+    /**
+     * @brief A non-owning, type-erased reference to a callable. Unlike `std::function`, it never allocates and is
+     *        exactly two pointers wide, so it's cheap to pass by value through hot paths.
+     * @see https://eel.is/c++draft/func.wrap.ref
+     * @see https://cppreference.com/w/cpp/utility/functional/function_ref
+     * @note A feature from the C++26 standard.
+     */
     template <class>
     class function_ref;
 
@@ -41,10 +260,10 @@ namespace StdReimpl
     class function_ref<R(ArgTypes...) const noexcept(true)>
     {
     private:
-        using BoundEntityType = void*;
+        using BoundEntityType = StdReimpl::Detail::function_ref_bound_entity;
 
         template <class... T>
-        static constexpr bool is_invocable_using = std::is_nothrow_invocable_r_v<R, T..., ArgTypes...>;
+        static constexpr bool is_invocable_using = StdReimpl::Detail::is_nothrow_invocable_r_v<R, T..., ArgTypes...>;
 
     public:
         // [func.wrap.ref.ctor], constructors and assignment operators
@@ -54,9 +273,9 @@ namespace StdReimpl
         function_ref(F* f) noexcept
             : bound_entity{f}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                [](BoundEntityType bound_entity_param, ArgTypes&&... call_args) noexcept -> R
                 {
-                    StdReimpl::invoke_r<R>(*bound_entity_param, call_args...);
+                    return StdReimpl::invoke_r<R>(bound_entity_param.get<F>(), std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
@@ -67,18 +286,18 @@ namespace StdReimpl
         template <class F>
             requires (
                 !std::is_same_v<std::remove_cvref_t<F>, function_ref>
-                && !is_member_pointer_v<remove_reference_t<F>>
-                && is_invocable_using<std::add_lvalue_reference_t<const remove_reference_t<F>>>
+                && !std::is_member_pointer_v<std::remove_reference_t<F>>
+                && is_invocable_using<const std::remove_reference_t<F>&>
             )
         constexpr function_ref(F&& f) noexcept
             : bound_entity{std::addressof(f)}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                [](BoundEntityType bound_entity_param, ArgTypes&&... call_args) noexcept -> R
                 {
                     // Let T be remove_reference_t<F>.
                     using T = std::remove_reference_t<F>;
 
-                    StdReimpl::invoke_r<R>(static_cast<const T&>(*bound_entity_param), call_args...);
+                    return StdReimpl::invoke_r<R>(static_cast<const T&>(*bound_entity_param.get<T>()), std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
@@ -86,12 +305,13 @@ namespace StdReimpl
 
         template <auto f>
             requires (is_invocable_using<const decltype(f)&>)
-        constexpr function_ref(constant_arg_t<f>) noexcept
-            : bound_entity{nullptr}
+        constexpr function_ref(StdReimpl::constant_arg_t<f>) noexcept
+            : bound_entity{}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                // The callable is encoded in the type, so the thunk calls it directly and never reads the bound entity.
+                [](BoundEntityType, ArgTypes&&... call_args) noexcept -> R
                 {
-                    StdReimpl::invoke_r<R>(*bound_entity_param, call_args...);
+                    return StdReimpl::invoke_r<R>(f, std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
@@ -99,41 +319,47 @@ namespace StdReimpl
             using F = decltype(f);
 
             // Mandates: If is_pointer_v<F> || is_member_pointer_v<F> is true, then f != nullptr is true.
-            static_assert(!(std::is_pointer_v<F> || std::is_member_pointer_v<F>) || f != nullptr);
+            if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+            {
+                static_assert(f != nullptr);
+            }
         }
 
         template <auto f, class U>
             requires (
                 !std::is_rvalue_reference_v<U&&>
-                && is_invocable_using<const decltype(f)&, std::add_lvalue_reference_t<const std::remove_reference_t<U>>>
+                && is_invocable_using<const decltype(f)&, const std::remove_reference_t<U>&>
             )
-        constexpr function_ref(constant_arg_t<f>, U&& obj) noexcept
+        constexpr function_ref(StdReimpl::constant_arg_t<f>, U&& obj) noexcept
             : bound_entity{std::addressof(obj)}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                [](BoundEntityType bound_entity_param, ArgTypes&&... call_args) noexcept -> R
                 {
-                    // Let T be remove_reference_t<U> and F be decltype(f).
+                    // Let T be remove_reference_t<U>.
                     using T = std::remove_reference_t<U>;
 
-                    StdReimpl::invoke_r<R>(*bound_entity_param, static_cast<const T&>(*bound_entity_param), call_args...);
+                    return StdReimpl::invoke_r<R>(f, static_cast<const T&>(*bound_entity_param.get<T>()), std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
-            // Let T be remove_reference_t<U> and F be decltype(f).
+            // Let F be decltype(f).
             using F = decltype(f);
 
             // Mandates: If is_pointer_v<F> || is_member_pointer_v<F> is true, then f != nullptr is true.
-            static_assert(!(std::is_pointer_v<F> || std::is_member_pointer_v<F>) || f != nullptr);
+            if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+            {
+                static_assert(f != nullptr);
+            }
         }
 
         template <auto f, class T>
             requires (is_invocable_using<const decltype(f)&, const T*>)
-        constexpr function_ref(constant_arg_t<f>, const T* obj) noexcept
+        constexpr function_ref(StdReimpl::constant_arg_t<f>, const T* obj) noexcept
             : bound_entity{obj}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                [](BoundEntityType bound_entity_param, ArgTypes&&... call_args) noexcept -> R
                 {
-                    StdReimpl::invoke_r<R>(*bound_entity_param, bound_entity_param, call_args...);
+                    return StdReimpl::invoke_r<R>(f, static_cast<const T*>(bound_entity_param.get<T>()), std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
@@ -141,7 +367,10 @@ namespace StdReimpl
             using F = decltype(f);
 
             // Mandates: If is_pointer_v<F> || is_member_pointer_v<F> is true, then f != nullptr is true.
-            static_assert(!(std::is_pointer_v<F> || std::is_member_pointer_v<F>) || f != nullptr);
+            if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+            {
+                static_assert(f != nullptr);
+            }
 
             // Preconditions: If is_member_pointer_v<F> is true, obj is not a null pointer.
             assert(!std::is_member_pointer_v<F> || obj);
@@ -152,7 +381,11 @@ namespace StdReimpl
         constexpr function_ref& operator=(const function_ref&) noexcept = default;
 
         template <class T>
-            requires (!std::is_same_v<function_ref> && !std::is_pointer_v<T>) // TODO: Implement constraint: "T is not a specialization of constant_arg_t."
+            requires (
+                !std::is_same_v<T, function_ref>
+                && !std::is_pointer_v<T>
+                && !StdReimpl::Detail::is_constant_arg_t_v<T>
+            )
         function_ref& operator=(T) = delete;
 
         // [func.wrap.ref.inv], invocation
@@ -162,18 +395,18 @@ namespace StdReimpl
         }
 
     private:
+        BoundEntityType bound_entity;
         R (*thunk_ptr)(BoundEntityType, ArgTypes&&...) noexcept(true) = nullptr;
-        BoundEntityType bound_entity = nullptr;
     };
 
     template <class R, class... ArgTypes>
     class function_ref<R(ArgTypes...) const noexcept(false)>
     {
     private:
-        using BoundEntityType = void*;
+        using BoundEntityType = StdReimpl::Detail::function_ref_bound_entity;
 
         template <class... T>
-        static constexpr bool is_invocable_using = std::is_invocable_r_v<R, T..., ArgTypes...>;
+        static constexpr bool is_invocable_using = StdReimpl::Detail::is_invocable_r_v<R, T..., ArgTypes...>;
 
     public:
         // [func.wrap.ref.ctor], constructors and assignment operators
@@ -183,9 +416,9 @@ namespace StdReimpl
         function_ref(F* f) noexcept
             : bound_entity{f}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                [](BoundEntityType bound_entity_param, ArgTypes&&... call_args) -> R
                 {
-                    StdReimpl::invoke_r<R>(*bound_entity_param, call_args...);
+                    return StdReimpl::invoke_r<R>(bound_entity_param.get<F>(), std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
@@ -196,18 +429,18 @@ namespace StdReimpl
         template <class F>
             requires (
                 !std::is_same_v<std::remove_cvref_t<F>, function_ref>
-                && !is_member_pointer_v<remove_reference_t<F>>
-                && is_invocable_using<std::add_lvalue_reference_t<const remove_reference_t<F>>>
+                && !std::is_member_pointer_v<std::remove_reference_t<F>>
+                && is_invocable_using<const std::remove_reference_t<F>&>
             )
         constexpr function_ref(F&& f) noexcept
             : bound_entity{std::addressof(f)}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                [](BoundEntityType bound_entity_param, ArgTypes&&... call_args) -> R
                 {
                     // Let T be remove_reference_t<F>.
                     using T = std::remove_reference_t<F>;
 
-                    StdReimpl::invoke_r<R>(static_cast<const T&>(*bound_entity_param), call_args...);
+                    return StdReimpl::invoke_r<R>(static_cast<const T&>(*bound_entity_param.get<T>()), std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
@@ -215,12 +448,13 @@ namespace StdReimpl
 
         template <auto f>
             requires (is_invocable_using<const decltype(f)&>)
-        constexpr function_ref(constant_arg_t<f>) noexcept
-            : bound_entity{nullptr}
+        constexpr function_ref(StdReimpl::constant_arg_t<f>) noexcept
+            : bound_entity{}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                // The callable is encoded in the type, so the thunk calls it directly and never reads the bound entity.
+                [](BoundEntityType, ArgTypes&&... call_args) -> R
                 {
-                    StdReimpl::invoke_r<R>(*bound_entity_param, call_args...);
+                    return StdReimpl::invoke_r<R>(f, std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
@@ -228,41 +462,47 @@ namespace StdReimpl
             using F = decltype(f);
 
             // Mandates: If is_pointer_v<F> || is_member_pointer_v<F> is true, then f != nullptr is true.
-            static_assert(!(std::is_pointer_v<F> || std::is_member_pointer_v<F>) || f != nullptr);
+            if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+            {
+                static_assert(f != nullptr);
+            }
         }
 
         template <auto f, class U>
             requires (
                 !std::is_rvalue_reference_v<U&&>
-                && is_invocable_using<const decltype(f)&, std::add_lvalue_reference_t<const std::remove_reference_t<U>>>
+                && is_invocable_using<const decltype(f)&, const std::remove_reference_t<U>&>
             )
-        constexpr function_ref(constant_arg_t<f>, U&& obj) noexcept
+        constexpr function_ref(StdReimpl::constant_arg_t<f>, U&& obj) noexcept
             : bound_entity{std::addressof(obj)}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                [](BoundEntityType bound_entity_param, ArgTypes&&... call_args) -> R
                 {
-                    // Let T be remove_reference_t<U> and F be decltype(f).
+                    // Let T be remove_reference_t<U>.
                     using T = std::remove_reference_t<U>;
 
-                    StdReimpl::invoke_r<R>(*bound_entity_param, static_cast<const T&>(*bound_entity_param), call_args...);
+                    return StdReimpl::invoke_r<R>(f, static_cast<const T&>(*bound_entity_param.get<T>()), std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
-            // Let T be remove_reference_t<U> and F be decltype(f).
+            // Let F be decltype(f).
             using F = decltype(f);
 
             // Mandates: If is_pointer_v<F> || is_member_pointer_v<F> is true, then f != nullptr is true.
-            static_assert(!(std::is_pointer_v<F> || std::is_member_pointer_v<F>) || f != nullptr);
+            if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+            {
+                static_assert(f != nullptr);
+            }
         }
 
         template <auto f, class T>
             requires (is_invocable_using<const decltype(f)&, const T*>)
-        constexpr function_ref(constant_arg_t<f>, const T* obj) noexcept
+        constexpr function_ref(StdReimpl::constant_arg_t<f>, const T* obj) noexcept
             : bound_entity{obj}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                [](BoundEntityType bound_entity_param, ArgTypes&&... call_args) -> R
                 {
-                    StdReimpl::invoke_r<R>(*bound_entity_param, bound_entity_param, call_args...);
+                    return StdReimpl::invoke_r<R>(f, static_cast<const T*>(bound_entity_param.get<T>()), std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
@@ -270,7 +510,10 @@ namespace StdReimpl
             using F = decltype(f);
 
             // Mandates: If is_pointer_v<F> || is_member_pointer_v<F> is true, then f != nullptr is true.
-            static_assert(!(std::is_pointer_v<F> || std::is_member_pointer_v<F>) || f != nullptr);
+            if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+            {
+                static_assert(f != nullptr);
+            }
 
             // Preconditions: If is_member_pointer_v<F> is true, obj is not a null pointer.
             assert(!std::is_member_pointer_v<F> || obj);
@@ -281,7 +524,11 @@ namespace StdReimpl
         constexpr function_ref& operator=(const function_ref&) noexcept = default;
 
         template <class T>
-            requires (!std::is_same_v<function_ref> && !std::is_pointer_v<T>) // TODO: Implement constraint: "T is not a specialization of constant_arg_t."
+            requires (
+                !std::is_same_v<T, function_ref>
+                && !std::is_pointer_v<T>
+                && !StdReimpl::Detail::is_constant_arg_t_v<T>
+            )
         function_ref& operator=(T) = delete;
 
         // [func.wrap.ref.inv], invocation
@@ -291,18 +538,18 @@ namespace StdReimpl
         }
 
     private:
+        BoundEntityType bound_entity;
         R (*thunk_ptr)(BoundEntityType, ArgTypes&&...) noexcept(false) = nullptr;
-        BoundEntityType bound_entity = nullptr;
     };
 
     template <class R, class... ArgTypes>
     class function_ref<R(ArgTypes...) noexcept(true)>
     {
     private:
-        using BoundEntityType = void*;
+        using BoundEntityType = StdReimpl::Detail::function_ref_bound_entity;
 
         template <class... T>
-        static constexpr bool is_invocable_using = std::is_nothrow_invocable_r_v<R, T..., ArgTypes...>;
+        static constexpr bool is_invocable_using = StdReimpl::Detail::is_nothrow_invocable_r_v<R, T..., ArgTypes...>;
 
     public:
         // [func.wrap.ref.ctor], constructors and assignment operators
@@ -312,9 +559,9 @@ namespace StdReimpl
         function_ref(F* f) noexcept
             : bound_entity{f}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                [](BoundEntityType bound_entity_param, ArgTypes&&... call_args) noexcept -> R
                 {
-                    StdReimpl::invoke_r<R>(*bound_entity_param, call_args...);
+                    return StdReimpl::invoke_r<R>(bound_entity_param.get<F>(), std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
@@ -325,18 +572,18 @@ namespace StdReimpl
         template <class F>
             requires (
                 !std::is_same_v<std::remove_cvref_t<F>, function_ref>
-                && !is_member_pointer_v<remove_reference_t<F>>
-                && is_invocable_using<std::add_lvalue_reference_t<remove_reference_t<F>>>
+                && !std::is_member_pointer_v<std::remove_reference_t<F>>
+                && is_invocable_using<std::remove_reference_t<F>&>
             )
         constexpr function_ref(F&& f) noexcept
             : bound_entity{std::addressof(f)}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                [](BoundEntityType bound_entity_param, ArgTypes&&... call_args) noexcept -> R
                 {
                     // Let T be remove_reference_t<F>.
                     using T = std::remove_reference_t<F>;
 
-                    StdReimpl::invoke_r<R>(static_cast<T&>(*bound_entity_param), call_args...);
+                    return StdReimpl::invoke_r<R>(static_cast<T&>(*bound_entity_param.get<T>()), std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
@@ -344,12 +591,13 @@ namespace StdReimpl
 
         template <auto f>
             requires (is_invocable_using<const decltype(f)&>)
-        constexpr function_ref(constant_arg_t<f>) noexcept
-            : bound_entity{nullptr}
+        constexpr function_ref(StdReimpl::constant_arg_t<f>) noexcept
+            : bound_entity{}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                // The callable is encoded in the type, so the thunk calls it directly and never reads the bound entity.
+                [](BoundEntityType, ArgTypes&&... call_args) noexcept -> R
                 {
-                    StdReimpl::invoke_r<R>(*bound_entity_param, call_args...);
+                    return StdReimpl::invoke_r<R>(f, std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
@@ -357,41 +605,47 @@ namespace StdReimpl
             using F = decltype(f);
 
             // Mandates: If is_pointer_v<F> || is_member_pointer_v<F> is true, then f != nullptr is true.
-            static_assert(!(std::is_pointer_v<F> || std::is_member_pointer_v<F>) || f != nullptr);
+            if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+            {
+                static_assert(f != nullptr);
+            }
         }
 
         template <auto f, class U>
             requires (
                 !std::is_rvalue_reference_v<U&&>
-                && is_invocable_using<const decltype(f)&, std::add_lvalue_reference_t<std::remove_reference_t<U>>>
+                && is_invocable_using<const decltype(f)&, std::remove_reference_t<U>&>
             )
-        constexpr function_ref(constant_arg_t<f>, U&& obj) noexcept
+        constexpr function_ref(StdReimpl::constant_arg_t<f>, U&& obj) noexcept
             : bound_entity{std::addressof(obj)}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                [](BoundEntityType bound_entity_param, ArgTypes&&... call_args) noexcept -> R
                 {
-                    // Let T be remove_reference_t<U> and F be decltype(f).
+                    // Let T be remove_reference_t<U>.
                     using T = std::remove_reference_t<U>;
 
-                    StdReimpl::invoke_r<R>(*bound_entity_param, static_cast<T&>(*bound_entity_param), call_args...);
+                    return StdReimpl::invoke_r<R>(f, static_cast<T&>(*bound_entity_param.get<T>()), std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
-            // Let T be remove_reference_t<U> and F be decltype(f).
+            // Let F be decltype(f).
             using F = decltype(f);
 
             // Mandates: If is_pointer_v<F> || is_member_pointer_v<F> is true, then f != nullptr is true.
-            static_assert(!(std::is_pointer_v<F> || std::is_member_pointer_v<F>) || f != nullptr);
+            if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+            {
+                static_assert(f != nullptr);
+            }
         }
 
         template <auto f, class T>
             requires (is_invocable_using<const decltype(f)&, T*>)
-        constexpr function_ref(constant_arg_t<f>, T* obj) noexcept
+        constexpr function_ref(StdReimpl::constant_arg_t<f>, T* obj) noexcept
             : bound_entity{obj}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                [](BoundEntityType bound_entity_param, ArgTypes&&... call_args) noexcept -> R
                 {
-                    StdReimpl::invoke_r<R>(*bound_entity_param, bound_entity_param, call_args...);
+                    return StdReimpl::invoke_r<R>(f, static_cast<T*>(bound_entity_param.get<T>()), std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
@@ -399,7 +653,10 @@ namespace StdReimpl
             using F = decltype(f);
 
             // Mandates: If is_pointer_v<F> || is_member_pointer_v<F> is true, then f != nullptr is true.
-            static_assert(!(std::is_pointer_v<F> || std::is_member_pointer_v<F>) || f != nullptr);
+            if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+            {
+                static_assert(f != nullptr);
+            }
 
             // Preconditions: If is_member_pointer_v<F> is true, obj is not a null pointer.
             assert(!std::is_member_pointer_v<F> || obj);
@@ -410,7 +667,11 @@ namespace StdReimpl
         constexpr function_ref& operator=(const function_ref&) noexcept = default;
 
         template <class T>
-            requires (!std::is_same_v<function_ref> && !std::is_pointer_v<T>) // TODO: Implement constraint: "T is not a specialization of constant_arg_t."
+            requires (
+                !std::is_same_v<T, function_ref>
+                && !std::is_pointer_v<T>
+                && !StdReimpl::Detail::is_constant_arg_t_v<T>
+            )
         function_ref& operator=(T) = delete;
 
         // [func.wrap.ref.inv], invocation
@@ -420,18 +681,18 @@ namespace StdReimpl
         }
 
     private:
+        BoundEntityType bound_entity;
         R (*thunk_ptr)(BoundEntityType, ArgTypes&&...) noexcept(true) = nullptr;
-        BoundEntityType bound_entity = nullptr;
     };
 
     template <class R, class... ArgTypes>
     class function_ref<R(ArgTypes...) noexcept(false)>
     {
     private:
-        using BoundEntityType = void*;
+        using BoundEntityType = StdReimpl::Detail::function_ref_bound_entity;
 
         template <class... T>
-        static constexpr bool is_invocable_using = std::is_invocable_r_v<R, T..., ArgTypes...>;
+        static constexpr bool is_invocable_using = StdReimpl::Detail::is_invocable_r_v<R, T..., ArgTypes...>;
 
     public:
         // [func.wrap.ref.ctor], constructors and assignment operators
@@ -441,9 +702,9 @@ namespace StdReimpl
         function_ref(F* f) noexcept
             : bound_entity{f}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                [](BoundEntityType bound_entity_param, ArgTypes&&... call_args) -> R
                 {
-                    StdReimpl::invoke_r<R>(*bound_entity_param, call_args...);
+                    return StdReimpl::invoke_r<R>(bound_entity_param.get<F>(), std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
@@ -454,18 +715,18 @@ namespace StdReimpl
         template <class F>
             requires (
                 !std::is_same_v<std::remove_cvref_t<F>, function_ref>
-                && !is_member_pointer_v<remove_reference_t<F>>
-                && is_invocable_using<std::add_lvalue_reference_t<remove_reference_t<F>>>
+                && !std::is_member_pointer_v<std::remove_reference_t<F>>
+                && is_invocable_using<std::remove_reference_t<F>&>
             )
         constexpr function_ref(F&& f) noexcept
             : bound_entity{std::addressof(f)}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                [](BoundEntityType bound_entity_param, ArgTypes&&... call_args) -> R
                 {
                     // Let T be remove_reference_t<F>.
                     using T = std::remove_reference_t<F>;
 
-                    StdReimpl::invoke_r<R>(static_cast<T&>(*bound_entity_param), call_args...);
+                    return StdReimpl::invoke_r<R>(static_cast<T&>(*bound_entity_param.get<T>()), std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
@@ -473,12 +734,13 @@ namespace StdReimpl
 
         template <auto f>
             requires (is_invocable_using<const decltype(f)&>)
-        constexpr function_ref(constant_arg_t<f>) noexcept
-            : bound_entity{nullptr}
+        constexpr function_ref(StdReimpl::constant_arg_t<f>) noexcept
+            : bound_entity{}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                // The callable is encoded in the type, so the thunk calls it directly and never reads the bound entity.
+                [](BoundEntityType, ArgTypes&&... call_args) -> R
                 {
-                    StdReimpl::invoke_r<R>(*bound_entity_param, call_args...);
+                    return StdReimpl::invoke_r<R>(f, std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
@@ -486,41 +748,47 @@ namespace StdReimpl
             using F = decltype(f);
 
             // Mandates: If is_pointer_v<F> || is_member_pointer_v<F> is true, then f != nullptr is true.
-            static_assert(!(std::is_pointer_v<F> || std::is_member_pointer_v<F>) || f != nullptr);
+            if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+            {
+                static_assert(f != nullptr);
+            }
         }
 
         template <auto f, class U>
             requires (
                 !std::is_rvalue_reference_v<U&&>
-                && is_invocable_using<const decltype(f)&, std::add_lvalue_reference_t<std::remove_reference_t<U>>>
+                && is_invocable_using<const decltype(f)&, std::remove_reference_t<U>&>
             )
-        constexpr function_ref(constant_arg_t<f>, U&& obj) noexcept
+        constexpr function_ref(StdReimpl::constant_arg_t<f>, U&& obj) noexcept
             : bound_entity{std::addressof(obj)}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                [](BoundEntityType bound_entity_param, ArgTypes&&... call_args) -> R
                 {
-                    // Let T be remove_reference_t<U> and F be decltype(f).
+                    // Let T be remove_reference_t<U>.
                     using T = std::remove_reference_t<U>;
 
-                    StdReimpl::invoke_r<R>(*bound_entity_param, static_cast<T&>(*bound_entity_param), call_args...);
+                    return StdReimpl::invoke_r<R>(f, static_cast<T&>(*bound_entity_param.get<T>()), std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
-            // Let T be remove_reference_t<U> and F be decltype(f).
+            // Let F be decltype(f).
             using F = decltype(f);
 
             // Mandates: If is_pointer_v<F> || is_member_pointer_v<F> is true, then f != nullptr is true.
-            static_assert(!(std::is_pointer_v<F> || std::is_member_pointer_v<F>) || f != nullptr);
+            if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+            {
+                static_assert(f != nullptr);
+            }
         }
 
         template <auto f, class T>
             requires (is_invocable_using<const decltype(f)&, T*>)
-        constexpr function_ref(constant_arg_t<f>, T* obj) noexcept
+        constexpr function_ref(StdReimpl::constant_arg_t<f>, T* obj) noexcept
             : bound_entity{obj}
             , thunk_ptr{
-                [](BoundEntityType bound_entity_param, ArgTypes&& call_args)
+                [](BoundEntityType bound_entity_param, ArgTypes&&... call_args) -> R
                 {
-                    StdReimpl::invoke_r<R>(*bound_entity_param, bound_entity_param, call_args...);
+                    return StdReimpl::invoke_r<R>(f, static_cast<T*>(bound_entity_param.get<T>()), std::forward<ArgTypes>(call_args)...);
                 }
             }
         {
@@ -528,7 +796,10 @@ namespace StdReimpl
             using F = decltype(f);
 
             // Mandates: If is_pointer_v<F> || is_member_pointer_v<F> is true, then f != nullptr is true.
-            static_assert(!(std::is_pointer_v<F> || std::is_member_pointer_v<F>) || f != nullptr);
+            if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+            {
+                static_assert(f != nullptr);
+            }
 
             // Preconditions: If is_member_pointer_v<F> is true, obj is not a null pointer.
             assert(!std::is_member_pointer_v<F> || obj);
@@ -539,7 +810,11 @@ namespace StdReimpl
         constexpr function_ref& operator=(const function_ref&) noexcept = default;
 
         template <class T>
-            requires (!std::is_same_v<function_ref> && !std::is_pointer_v<T>) // TODO: Implement constraint: "T is not a specialization of constant_arg_t."
+            requires (
+                !std::is_same_v<T, function_ref>
+                && !std::is_pointer_v<T>
+                && !StdReimpl::Detail::is_constant_arg_t_v<T>
+            )
         function_ref& operator=(T) = delete;
 
         // [func.wrap.ref.inv], invocation
@@ -549,27 +824,1235 @@ namespace StdReimpl
         }
 
     private:
+        BoundEntityType bound_entity;
         R (*thunk_ptr)(BoundEntityType, ArgTypes&&...) noexcept(false) = nullptr;
-        BoundEntityType bound_entity = nullptr;
     };
 
     // [func.wrap.ref.deduct], deduction guides
 
-    // TODO: [todo] Implement https://eel.is/c++draft/func.wrap.ref.deduct.
-    // - Need to add template parameter constraints.
-    // - Need to implement the last deduction guide `function_ref(StdReimpl::constant_arg_t<f>, T&&)` which is a little complicated.
-
     template <class F>
+        requires (std::is_function_v<F>)
     function_ref(F*) -> function_ref<F>;
 
     template <auto f>
+        requires (std::is_function_v<std::remove_pointer_t<decltype(f)>>)
     function_ref(StdReimpl::constant_arg_t<f>) -> function_ref<std::remove_pointer_t<decltype(f)>>;
 
-#if 0
     template <auto f, class T>
-    function_ref(StdReimpl::constant_arg_t<f>, T&&) -> function_ref<R(A...) noexcept(E)>;
-#endif // #if 0
-#endif // #if 0
+    function_ref(StdReimpl::constant_arg_t<f>, T&&) -> function_ref<typename StdReimpl::Detail::function_ref_deduce_signature<decltype(f), T>::type>;
+    /**
+     * @brief An owning, type-erased, move-only callable wrapper. Callables that are nothrow move constructible and fit
+     *        in `InlineCapacity` bytes are stored inline and never allocate, which covers the common case of lambdas that
+     *        capture a few pointers or a `std::unique_ptr`. Larger callables fall back to the heap.
+     * @tparam InlineCapacity Size of the inline buffer. Not part of the standard. Defaults to
+     *         `CPPUTILS_STDREIMPL_MOVE_ONLY_FUNCTION_INLINE_CAPACITY`.
+     * @see https://eel.is/c++draft/func.wrap.move
+     * @see https://cppreference.com/w/cpp/utility/functional/move_only_function
+     * @note A feature from the C++23 standard.
+     */
+    template <class Signature, std::size_t InlineCapacity = CPPUTILS_STDREIMPL_MOVE_ONLY_FUNCTION_INLINE_CAPACITY>
+    class move_only_function;
+
+    /**
+     * @brief An owning, copyable, type-erased callable wrapper that never allocates. The callable is always stored in a
+     *        buffer of `Capacity` bytes aligned to `Alignment`, and a callable that doesn't fit fails to compile rather
+     *        than falling back to the heap. Stored callables must be copy constructible and nothrow move constructible.
+     *        Supports the same call signatures as `move_only_function`.
+     * @note Not part of the standard. Based on the SG14 `inplace_function` proposal.
+     */
+    template <
+        class Signature,
+        std::size_t Capacity = CPPUTILS_STDREIMPL_INPLACE_FUNCTION_DEFAULT_CAPACITY,
+        std::size_t Alignment = alignof(std::max_align_t)>
+    class inplace_function;
+
+    namespace Detail
+    {
+        /**
+         * @brief The "ref" part of a call signature's qualifiers.
+         */
+        enum class callable_ref_qualifier
+        {
+            none,
+            lvalue,
+            rvalue
+        };
+
+        /**
+         * @brief Applies a call signature's qualifiers to `T`. `type` is the standard's "cv ref" and `inv_type` is its
+         *        "inv-quals", i.e., "cv ref" if ref is present and "cv &" otherwise.
+         * @see https://eel.is/c++draft/func.wrap.move.class
+         */
+        template <class T, bool IsConst, callable_ref_qualifier RefQualifier>
+        struct apply_call_qualifiers
+        {
+        private:
+            using cv_type = std::conditional_t<IsConst, const T, T>;
+
+        public:
+            using type =
+                std::conditional_t<RefQualifier == callable_ref_qualifier::none, cv_type,
+                std::conditional_t<RefQualifier == callable_ref_qualifier::lvalue, cv_type&, cv_type&&>>;
+
+            using inv_type = std::conditional_t<RefQualifier == callable_ref_qualifier::rvalue, cv_type&&, cv_type&>;
+        };
+
+        template <class T>
+        inline constexpr bool is_in_place_type_t_v = false;
+
+        template <class T>
+        inline constexpr bool is_in_place_type_t_v<std::in_place_type_t<T>> = true;
+
+        /**
+         * @brief Whether `T` is one of our owning callable wrappers. Wrapping an empty one of these results in an empty
+         *        wrapper, just like wrapping a null function pointer does.
+         */
+        template <class T>
+        inline constexpr bool is_erased_callable_wrapper_v = false;
+
+        template <class Signature, std::size_t InlineCapacity>
+        inline constexpr bool is_erased_callable_wrapper_v<StdReimpl::move_only_function<Signature, InlineCapacity>> = true;
+
+        template <class Signature, std::size_t Capacity, std::size_t Alignment>
+        inline constexpr bool is_erased_callable_wrapper_v<StdReimpl::inplace_function<Signature, Capacity, Alignment>> = true;
+
+        /**
+         * @brief Describes how an `erased_callable_base` stores its callable.
+         */
+        template <std::size_t Capacity, std::size_t Alignment, bool AllowsHeap, bool IsCopyable>
+        struct erased_callable_policy
+        {
+            // When we can allocate, we always need room for a pointer to the heap allocated callable.
+            static constexpr std::size_t capacity =
+                (AllowsHeap && Capacity < sizeof(void*)) ? sizeof(void*) : (Capacity == 0 ? 1 : Capacity);
+            static constexpr std::size_t alignment = Alignment;
+            static constexpr bool allows_heap = AllowsHeap;
+            static constexpr bool is_copyable = IsCopyable;
+        };
+
+        /**
+         * @brief The table of operations of a type-erased owning callable. There is one instance per stored callable
+         *        type, so a call costs a load of `invoke` plus an indirect call, rather than a virtual call chain.
+         */
+        template <bool Noex, class R, class... ArgTypes>
+        struct erased_callable_vtable
+        {
+            R (*invoke)(void* storage, ArgTypes&&...) noexcept(Noex);
+
+            // Move constructs the callable into `destination` and destroys it in `source`. Null when copying the bytes
+            // of the storage does the same, e.g., for trivially copyable callables and heap allocated ones.
+            void (*relocate)(void* destination, void* source) noexcept;
+
+            // Copy constructs the callable into `destination`. Null when copying the bytes of the storage does the
+            // same, or when the wrapper isn't copyable.
+            void (*copy)(void* destination, const void* source);
+
+            // Null when there is nothing to destroy.
+            void (*destroy)(void* storage) noexcept;
+        };
+
+        /**
+         * @brief Everything about our owning callable wrappers that doesn't depend on the qualifiers of their call
+         *        operator. Each wrapper specialization derives from this and only adds its call operator.
+         * @tparam Policy A specialization of `erased_callable_policy`.
+         */
+        template <class Derived, class Policy, bool IsConst, callable_ref_qualifier RefQualifier, bool Noex, class R, class... ArgTypes>
+        class erased_callable_base
+        {
+        private:
+            using VTableType = StdReimpl::Detail::erased_callable_vtable<Noex, R, ArgTypes...>;
+
+            template <class VT>
+            using qualifiers = StdReimpl::Detail::apply_call_qualifiers<VT, IsConst, RefQualifier>;
+
+            template <class VT>
+            static constexpr bool is_callable_from = Noex
+                ? StdReimpl::Detail::nothrow_invocable_r<R, typename qualifiers<VT>::type, ArgTypes...> && StdReimpl::Detail::nothrow_invocable_r<R, typename qualifiers<VT>::inv_type, ArgTypes...>
+                : StdReimpl::Detail::invocable_r<R, typename qualifiers<VT>::type, ArgTypes...> && StdReimpl::Detail::invocable_r<R, typename qualifiers<VT>::inv_type, ArgTypes...>;
+
+            // The move constructor must not throw, since moving the wrapper relocates the stored callable.
+            template <class VT>
+            static constexpr bool fits_inline =
+                sizeof(VT) <= Policy::capacity && alignof(VT) <= Policy::alignment && std::is_nothrow_move_constructible_v<VT>;
+
+        public:
+            using result_type = R;
+
+            erased_callable_base() noexcept = default;
+
+            erased_callable_base(std::nullptr_t) noexcept
+            {
+            }
+
+            erased_callable_base(const erased_callable_base& other)
+                requires (Policy::is_copyable)
+            {
+                CopyFrom(other);
+            }
+
+            erased_callable_base(erased_callable_base&& other) noexcept
+            {
+                MoveFrom(other);
+            }
+
+            template <class F>
+                requires (
+                    !std::is_same_v<std::remove_cvref_t<F>, Derived>
+                    && !StdReimpl::Detail::is_in_place_type_t_v<std::remove_cvref_t<F>>
+                    && is_callable_from<std::decay_t<F>>
+                )
+            erased_callable_base(F&& f)
+            {
+                using VT = std::decay_t<F>;
+
+                // Mandates: is_constructible_v<VT, F> is true.
+                static_assert(std::is_constructible_v<VT, F>);
+
+                // Null function pointers, null member pointers, and empty wrappers result in an empty object.
+                if constexpr (
+                    std::is_function_v<std::remove_pointer_t<VT>>
+                    || std::is_member_pointer_v<VT>
+                    || StdReimpl::Detail::is_erased_callable_wrapper_v<VT>)
+                {
+                    if (!f)
+                    {
+                        return;
+                    }
+                }
+
+                Emplace<VT>(std::forward<F>(f));
+            }
+
+            template <class T, class... Args>
+                requires (std::is_constructible_v<T, Args...> && is_callable_from<T>)
+            explicit erased_callable_base(std::in_place_type_t<T>, Args&&... args)
+            {
+                // Mandates: T is the same type as decay_t<T>.
+                static_assert(std::is_same_v<T, std::decay_t<T>>);
+
+                Emplace<T>(std::forward<Args>(args)...);
+            }
+
+            template <class T, class U, class... Args>
+                requires (std::is_constructible_v<T, std::initializer_list<U>&, Args...> && is_callable_from<T>)
+            explicit erased_callable_base(std::in_place_type_t<T>, std::initializer_list<U> ilist, Args&&... args)
+            {
+                // Mandates: T is the same type as decay_t<T>.
+                static_assert(std::is_same_v<T, std::decay_t<T>>);
+
+                Emplace<T>(ilist, std::forward<Args>(args)...);
+            }
+
+            erased_callable_base& operator=(const erased_callable_base& other)
+                requires (Policy::is_copyable)
+            {
+                // Copy first, so that we're left untouched if copying throws.
+                erased_callable_base{other}.swap(*this);
+                return *this;
+            }
+
+            erased_callable_base& operator=(erased_callable_base&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    Reset();
+                    MoveFrom(other);
+                }
+
+                return *this;
+            }
+
+            Derived& operator=(std::nullptr_t) noexcept
+            {
+                Reset();
+                return static_cast<Derived&>(*this);
+            }
+
+            template <class F>
+                requires (std::is_constructible_v<Derived, F>)
+            Derived& operator=(F&& f)
+            {
+                Derived(std::forward<F>(f)).swap(static_cast<Derived&>(*this));
+                return static_cast<Derived&>(*this);
+            }
+
+            ~erased_callable_base()
+            {
+                Reset();
+            }
+
+            explicit operator bool() const noexcept
+            {
+                return vtable != nullptr;
+            }
+
+            void swap(erased_callable_base& other) noexcept
+            {
+                erased_callable_base temp{std::move(other)};
+                other.MoveFrom(*this);
+                MoveFrom(temp);
+            }
+
+            friend void swap(Derived& f1, Derived& f2) noexcept
+            {
+                f1.swap(f2);
+            }
+
+            friend bool operator==(const Derived& f, std::nullptr_t) noexcept
+            {
+                return !f;
+            }
+
+        protected:
+            R Invoke(ArgTypes&&... args) const noexcept(Noex)
+            {
+                // Preconditions: *this stores a callable object.
+                assert(vtable);
+
+                return vtable->invoke(const_cast<std::byte*>(storage), std::forward<ArgTypes>(args)...);
+            }
+
+        private:
+            template <class VT>
+            static VT& GetStored(void* storage_param) noexcept
+            {
+                if constexpr (fits_inline<VT>)
+                {
+                    return *std::launder(static_cast<VT*>(storage_param));
+                }
+                else
+                {
+                    return **static_cast<VT**>(storage_param);
+                }
+            }
+
+            template <class VT>
+            static R InvokeStored(void* storage_param, ArgTypes&&... args) noexcept(Noex)
+            {
+                using InvQualsType = typename qualifiers<VT>::inv_type;
+
+                return StdReimpl::invoke_r<R>(static_cast<InvQualsType>(GetStored<VT>(storage_param)), std::forward<ArgTypes>(args)...);
+            }
+
+            template <class VT>
+            static void RelocateStored(void* destination, void* source) noexcept
+            {
+                VT& sourceCallable = GetStored<VT>(source);
+                ::new (destination) VT(std::move(sourceCallable));
+                sourceCallable.~VT();
+            }
+
+            template <class VT>
+            static void CopyStored(void* destination, const void* source)
+            {
+                ::new (destination) VT(std::as_const(GetStored<VT>(const_cast<void*>(source))));
+            }
+
+            template <class VT>
+            static void DestroyStored(void* storage_param) noexcept
+            {
+                if constexpr (fits_inline<VT>)
+                {
+                    GetStored<VT>(storage_param).~VT();
+                }
+                else
+                {
+                    delete &GetStored<VT>(storage_param);
+                }
+            }
+
+            template <class VT>
+            static constexpr VTableType MakeVTable() noexcept
+            {
+                VTableType result{&InvokeStored<VT>, nullptr, nullptr, nullptr};
+
+                if constexpr (fits_inline<VT> && !std::is_trivially_copyable_v<VT>)
+                {
+                    result.relocate = &RelocateStored<VT>;
+                }
+
+                if constexpr (Policy::is_copyable && !std::is_trivially_copyable_v<VT>)
+                {
+                    result.copy = &CopyStored<VT>;
+                }
+
+                if constexpr (!fits_inline<VT> || !std::is_trivially_destructible_v<VT>)
+                {
+                    result.destroy = &DestroyStored<VT>;
+                }
+
+                return result;
+            }
+
+            template <class VT>
+            static constexpr VTableType vtable_for = MakeVTable<VT>();
+
+            template <class VT, class... Args>
+            void Emplace(Args&&... args)
+            {
+                if constexpr (Policy::is_copyable)
+                {
+                    static_assert(std::is_copy_constructible_v<VT>, "The callable must be copy constructible.");
+                }
+
+                if constexpr (fits_inline<VT>)
+                {
+                    ::new (static_cast<void*>(storage)) VT(std::forward<Args>(args)...);
+                }
+                else
+                {
+                    static_assert(Policy::allows_heap, "The callable is too big, too aligned, or not nothrow move constructible, so it can't be stored inline.");
+
+                    ::new (static_cast<void*>(storage)) VT*(new VT(std::forward<Args>(args)...));
+                }
+
+                vtable = &vtable_for<VT>;
+            }
+
+            // Preconditions: *this is empty.
+            void CopyFrom(const erased_callable_base& other)
+            {
+                if (other.vtable)
+                {
+                    if (other.vtable->copy)
+                    {
+                        other.vtable->copy(storage, other.storage);
+                    }
+                    else
+                    {
+                        std::memcpy(storage, other.storage, Policy::capacity);
+                    }
+
+                    vtable = other.vtable;
+                }
+            }
+
+            // Preconditions: *this is empty.
+            void MoveFrom(erased_callable_base& other) noexcept
+            {
+                vtable = std::exchange(other.vtable, nullptr);
+
+                if (vtable)
+                {
+                    if (vtable->relocate)
+                    {
+                        vtable->relocate(storage, other.storage);
+                    }
+                    else
+                    {
+                        std::memcpy(storage, other.storage, Policy::capacity);
+                    }
+                }
+            }
+
+            void Reset() noexcept
+            {
+                if (vtable && vtable->destroy)
+                {
+                    vtable->destroy(storage);
+                }
+
+                vtable = nullptr;
+            }
+
+            alignas(Policy::alignment) std::byte storage[Policy::capacity];
+            const VTableType* vtable = nullptr;
+        };
+    }
+
+    template <class R, class... ArgTypes, bool Noex, std::size_t InlineCapacity>
+    class move_only_function<R(ArgTypes...) noexcept(Noex), InlineCapacity>
+        : public StdReimpl::Detail::erased_callable_base<
+            move_only_function<R(ArgTypes...) noexcept(Noex), InlineCapacity>,
+            StdReimpl::Detail::erased_callable_policy<InlineCapacity, alignof(std::max_align_t), true, false>, false, StdReimpl::Detail::callable_ref_qualifier::none, Noex, R, ArgTypes...>
+    {
+    private:
+        using Base = StdReimpl::Detail::erased_callable_base<
+            move_only_function,
+            StdReimpl::Detail::erased_callable_policy<InlineCapacity, alignof(std::max_align_t), true, false>, false, StdReimpl::Detail::callable_ref_qualifier::none, Noex, R, ArgTypes...>;
+
+    public:
+        using Base::Base;
+        using Base::operator=;
+
+        // [func.wrap.move.inv], invocation
+        R operator()(ArgTypes... args) noexcept(Noex)
+        {
+            return this->Invoke(std::forward<ArgTypes>(args)...);
+        }
+    };
+
+    template <class R, class... ArgTypes, bool Noex, std::size_t InlineCapacity>
+    class move_only_function<R(ArgTypes...) & noexcept(Noex), InlineCapacity>
+        : public StdReimpl::Detail::erased_callable_base<
+            move_only_function<R(ArgTypes...) & noexcept(Noex), InlineCapacity>,
+            StdReimpl::Detail::erased_callable_policy<InlineCapacity, alignof(std::max_align_t), true, false>, false, StdReimpl::Detail::callable_ref_qualifier::lvalue, Noex, R, ArgTypes...>
+    {
+    private:
+        using Base = StdReimpl::Detail::erased_callable_base<
+            move_only_function,
+            StdReimpl::Detail::erased_callable_policy<InlineCapacity, alignof(std::max_align_t), true, false>, false, StdReimpl::Detail::callable_ref_qualifier::lvalue, Noex, R, ArgTypes...>;
+
+    public:
+        using Base::Base;
+        using Base::operator=;
+
+        // [func.wrap.move.inv], invocation
+        R operator()(ArgTypes... args) & noexcept(Noex)
+        {
+            return this->Invoke(std::forward<ArgTypes>(args)...);
+        }
+    };
+
+    template <class R, class... ArgTypes, bool Noex, std::size_t InlineCapacity>
+    class move_only_function<R(ArgTypes...) && noexcept(Noex), InlineCapacity>
+        : public StdReimpl::Detail::erased_callable_base<
+            move_only_function<R(ArgTypes...) && noexcept(Noex), InlineCapacity>,
+            StdReimpl::Detail::erased_callable_policy<InlineCapacity, alignof(std::max_align_t), true, false>, false, StdReimpl::Detail::callable_ref_qualifier::rvalue, Noex, R, ArgTypes...>
+    {
+    private:
+        using Base = StdReimpl::Detail::erased_callable_base<
+            move_only_function,
+            StdReimpl::Detail::erased_callable_policy<InlineCapacity, alignof(std::max_align_t), true, false>, false, StdReimpl::Detail::callable_ref_qualifier::rvalue, Noex, R, ArgTypes...>;
+
+    public:
+        using Base::Base;
+        using Base::operator=;
+
+        // [func.wrap.move.inv], invocation
+        R operator()(ArgTypes... args) && noexcept(Noex)
+        {
+            return this->Invoke(std::forward<ArgTypes>(args)...);
+        }
+    };
+
+    template <class R, class... ArgTypes, bool Noex, std::size_t InlineCapacity>
+    class move_only_function<R(ArgTypes...) const noexcept(Noex), InlineCapacity>
+        : public StdReimpl::Detail::erased_callable_base<
+            move_only_function<R(ArgTypes...) const noexcept(Noex), InlineCapacity>,
+            StdReimpl::Detail::erased_callable_policy<InlineCapacity, alignof(std::max_align_t), true, false>, true, StdReimpl::Detail::callable_ref_qualifier::none, Noex, R, ArgTypes...>
+    {
+    private:
+        using Base = StdReimpl::Detail::erased_callable_base<
+            move_only_function,
+            StdReimpl::Detail::erased_callable_policy<InlineCapacity, alignof(std::max_align_t), true, false>, true, StdReimpl::Detail::callable_ref_qualifier::none, Noex, R, ArgTypes...>;
+
+    public:
+        using Base::Base;
+        using Base::operator=;
+
+        // [func.wrap.move.inv], invocation
+        R operator()(ArgTypes... args) const noexcept(Noex)
+        {
+            return this->Invoke(std::forward<ArgTypes>(args)...);
+        }
+    };
+
+    template <class R, class... ArgTypes, bool Noex, std::size_t InlineCapacity>
+    class move_only_function<R(ArgTypes...) const & noexcept(Noex), InlineCapacity>
+        : public StdReimpl::Detail::erased_callable_base<
+            move_only_function<R(ArgTypes...) const & noexcept(Noex), InlineCapacity>,
+            StdReimpl::Detail::erased_callable_policy<InlineCapacity, alignof(std::max_align_t), true, false>, true, StdReimpl::Detail::callable_ref_qualifier::lvalue, Noex, R, ArgTypes...>
+    {
+    private:
+        using Base = StdReimpl::Detail::erased_callable_base<
+            move_only_function,
+            StdReimpl::Detail::erased_callable_policy<InlineCapacity, alignof(std::max_align_t), true, false>, true, StdReimpl::Detail::callable_ref_qualifier::lvalue, Noex, R, ArgTypes...>;
+
+    public:
+        using Base::Base;
+        using Base::operator=;
+
+        // [func.wrap.move.inv], invocation
+        R operator()(ArgTypes... args) const & noexcept(Noex)
+        {
+            return this->Invoke(std::forward<ArgTypes>(args)...);
+        }
+    };
+
+    template <class R, class... ArgTypes, bool Noex, std::size_t InlineCapacity>
+    class move_only_function<R(ArgTypes...) const && noexcept(Noex), InlineCapacity>
+        : public StdReimpl::Detail::erased_callable_base<
+            move_only_function<R(ArgTypes...) const && noexcept(Noex), InlineCapacity>,
+            StdReimpl::Detail::erased_callable_policy<InlineCapacity, alignof(std::max_align_t), true, false>, true, StdReimpl::Detail::callable_ref_qualifier::rvalue, Noex, R, ArgTypes...>
+    {
+    private:
+        using Base = StdReimpl::Detail::erased_callable_base<
+            move_only_function,
+            StdReimpl::Detail::erased_callable_policy<InlineCapacity, alignof(std::max_align_t), true, false>, true, StdReimpl::Detail::callable_ref_qualifier::rvalue, Noex, R, ArgTypes...>;
+
+    public:
+        using Base::Base;
+        using Base::operator=;
+
+        // [func.wrap.move.inv], invocation
+        R operator()(ArgTypes... args) const && noexcept(Noex)
+        {
+            return this->Invoke(std::forward<ArgTypes>(args)...);
+        }
+    };
+
+    template <class R, class... ArgTypes, bool Noex, std::size_t Capacity, std::size_t Alignment>
+    class inplace_function<R(ArgTypes...) noexcept(Noex), Capacity, Alignment>
+        : public StdReimpl::Detail::erased_callable_base<
+            inplace_function<R(ArgTypes...) noexcept(Noex), Capacity, Alignment>,
+            StdReimpl::Detail::erased_callable_policy<Capacity, Alignment, false, true>, false, StdReimpl::Detail::callable_ref_qualifier::none, Noex, R, ArgTypes...>
+    {
+    private:
+        using Base = StdReimpl::Detail::erased_callable_base<
+            inplace_function,
+            StdReimpl::Detail::erased_callable_policy<Capacity, Alignment, false, true>, false, StdReimpl::Detail::callable_ref_qualifier::none, Noex, R, ArgTypes...>;
+
+    public:
+        using Base::Base;
+        using Base::operator=;
+
+        // Invocation. Costs a load of the table entry plus an indirect call.
+        R operator()(ArgTypes... args) noexcept(Noex)
+        {
+            return this->Invoke(std::forward<ArgTypes>(args)...);
+        }
+    };
+
+    template <class R, class... ArgTypes, bool Noex, std::size_t Capacity, std::size_t Alignment>
+    class inplace_function<R(ArgTypes...) & noexcept(Noex), Capacity, Alignment>
+        : public StdReimpl::Detail::erased_callable_base<
+            inplace_function<R(ArgTypes...) & noexcept(Noex), Capacity, Alignment>,
+            StdReimpl::Detail::erased_callable_policy<Capacity, Alignment, false, true>, false, StdReimpl::Detail::callable_ref_qualifier::lvalue, Noex, R, ArgTypes...>
+    {
+    private:
+        using Base = StdReimpl::Detail::erased_callable_base<
+            inplace_function,
+            StdReimpl::Detail::erased_callable_policy<Capacity, Alignment, false, true>, false, StdReimpl::Detail::callable_ref_qualifier::lvalue, Noex, R, ArgTypes...>;
+
+    public:
+        using Base::Base;
+        using Base::operator=;
+
+        // Invocation. Costs a load of the table entry plus an indirect call.
+        R operator()(ArgTypes... args) & noexcept(Noex)
+        {
+            return this->Invoke(std::forward<ArgTypes>(args)...);
+        }
+    };
+
+    template <class R, class... ArgTypes, bool Noex, std::size_t Capacity, std::size_t Alignment>
+    class inplace_function<R(ArgTypes...) && noexcept(Noex), Capacity, Alignment>
+        : public StdReimpl::Detail::erased_callable_base<
+            inplace_function<R(ArgTypes...) && noexcept(Noex), Capacity, Alignment>,
+            StdReimpl::Detail::erased_callable_policy<Capacity, Alignment, false, true>, false, StdReimpl::Detail::callable_ref_qualifier::rvalue, Noex, R, ArgTypes...>
+    {
+    private:
+        using Base = StdReimpl::Detail::erased_callable_base<
+            inplace_function,
+            StdReimpl::Detail::erased_callable_policy<Capacity, Alignment, false, true>, false, StdReimpl::Detail::callable_ref_qualifier::rvalue, Noex, R, ArgTypes...>;
+
+    public:
+        using Base::Base;
+        using Base::operator=;
+
+        // Invocation. Costs a load of the table entry plus an indirect call.
+        R operator()(ArgTypes... args) && noexcept(Noex)
+        {
+            return this->Invoke(std::forward<ArgTypes>(args)...);
+        }
+    };
+
+    template <class R, class... ArgTypes, bool Noex, std::size_t Capacity, std::size_t Alignment>
+    class inplace_function<R(ArgTypes...) const noexcept(Noex), Capacity, Alignment>
+        : public StdReimpl::Detail::erased_callable_base<
+            inplace_function<R(ArgTypes...) const noexcept(Noex), Capacity, Alignment>,
+            StdReimpl::Detail::erased_callable_policy<Capacity, Alignment, false, true>, true, StdReimpl::Detail::callable_ref_qualifier::none, Noex, R, ArgTypes...>
+    {
+    private:
+        using Base = StdReimpl::Detail::erased_callable_base<
+            inplace_function,
+            StdReimpl::Detail::erased_callable_policy<Capacity, Alignment, false, true>, true, StdReimpl::Detail::callable_ref_qualifier::none, Noex, R, ArgTypes...>;
+
+    public:
+        using Base::Base;
+        using Base::operator=;
+
+        // Invocation. Costs a load of the table entry plus an indirect call.
+        R operator()(ArgTypes... args) const noexcept(Noex)
+        {
+            return this->Invoke(std::forward<ArgTypes>(args)...);
+        }
+    };
+
+    template <class R, class... ArgTypes, bool Noex, std::size_t Capacity, std::size_t Alignment>
+    class inplace_function<R(ArgTypes...) const & noexcept(Noex), Capacity, Alignment>
+        : public StdReimpl::Detail::erased_callable_base<
+            inplace_function<R(ArgTypes...) const & noexcept(Noex), Capacity, Alignment>,
+            StdReimpl::Detail::erased_callable_policy<Capacity, Alignment, false, true>, true, StdReimpl::Detail::callable_ref_qualifier::lvalue, Noex, R, ArgTypes...>
+    {
+    private:
+        using Base = StdReimpl::Detail::erased_callable_base<
+            inplace_function,
+            StdReimpl::Detail::erased_callable_policy<Capacity, Alignment, false, true>, true, StdReimpl::Detail::callable_ref_qualifier::lvalue, Noex, R, ArgTypes...>;
+
+    public:
+        using Base::Base;
+        using Base::operator=;
+
+        // Invocation. Costs a load of the table entry plus an indirect call.
+        R operator()(ArgTypes... args) const & noexcept(Noex)
+        {
+            return this->Invoke(std::forward<ArgTypes>(args)...);
+        }
+    };
+
+    template <class R, class... ArgTypes, bool Noex, std::size_t Capacity, std::size_t Alignment>
+    class inplace_function<R(ArgTypes...) const && noexcept(Noex), Capacity, Alignment>
+        : public StdReimpl::Detail::erased_callable_base<
+            inplace_function<R(ArgTypes...) const && noexcept(Noex), Capacity, Alignment>,
+            StdReimpl::Detail::erased_callable_policy<Capacity, Alignment, false, true>, true, StdReimpl::Detail::callable_ref_qualifier::rvalue, Noex, R, ArgTypes...>
+    {
+    private:
+        using Base = StdReimpl::Detail::erased_callable_base<
+            inplace_function,
+            StdReimpl::Detail::erased_callable_policy<Capacity, Alignment, false, true>, true, StdReimpl::Detail::callable_ref_qualifier::rvalue, Noex, R, ArgTypes...>;
+
+    public:
+        using Base::Base;
+        using Base::operator=;
+
+        // Invocation. Costs a load of the table entry plus an indirect call.
+        R operator()(ArgTypes... args) const && noexcept(Noex)
+        {
+            return this->Invoke(std::forward<ArgTypes>(args)...);
+        }
+    };
+
+    namespace Detail
+    {
+        template <class T>
+        concept searcher_byte = sizeof(T) == 1 && (std::is_integral_v<T> || std::is_same_v<T, std::byte>);
+
+        /**
+         * @brief Whether a search can compare the raw bytes of the pattern and the haystack, which is what the SIMD
+         *        filter does. Needs contiguous byte sequences of the same type, compared with `==`.
+         */
+        template <class PatternIterator, class Iterator, class BinaryPredicate>
+        concept searcher_contiguous_bytes = std::contiguous_iterator<PatternIterator> && std::contiguous_iterator<Iterator> &&
+            searcher_byte<std::iter_value_t<PatternIterator>> && std::is_same_v<std::iter_value_t<PatternIterator>, std::iter_value_t<Iterator>> &&
+            (std::is_same_v<BinaryPredicate, std::equal_to<>> || std::is_same_v<BinaryPredicate, std::equal_to<std::iter_value_t<Iterator>>>);
+
+        /**
+         * @brief The bad character table that both Boyer-Moore searchers use: how far the pattern can move when the
+         *        haystack character under its last position is `c`, which is the distance from the last occurrence of
+         *        `c` in the pattern, not counting its last position, to the end. Byte alphabets use an array of 256
+         *        entries, so constructing the searcher doesn't allocate; other types use a hash map, like the standard
+         *        library's.
+         */
+        template <class RandomAccessIterator, class Hash, class BinaryPredicate, bool = searcher_byte<std::iter_value_t<RandomAccessIterator>>>
+        class searcher_skip_table
+        {
+        public:
+            using value_type = std::iter_value_t<RandomAccessIterator>;
+            using difference_type = std::iter_difference_t<RandomAccessIterator>;
+
+            searcher_skip_table(RandomAccessIterator patternFirst, difference_type patternSize, const Hash& hash, const BinaryPredicate& pred);
+
+            difference_type Get(const value_type& c) const;
+
+        private:
+            std::unordered_map<value_type, difference_type, Hash, BinaryPredicate> skips;
+            difference_type default_skip;
+        };
+
+        template <class RandomAccessIterator, class Hash, class BinaryPredicate>
+        class searcher_skip_table<RandomAccessIterator, Hash, BinaryPredicate, true>
+        {
+        public:
+            using value_type = std::iter_value_t<RandomAccessIterator>;
+            using difference_type = std::iter_difference_t<RandomAccessIterator>;
+
+            searcher_skip_table(RandomAccessIterator patternFirst, difference_type patternSize, const Hash& hash, const BinaryPredicate& pred);
+
+            difference_type Get(const value_type& c) const noexcept;
+
+        private:
+            difference_type skips[256];
+        };
+    }
+
+    /**
+     * @brief Searches with `std::search`, except for contiguous byte sequences compared with `==`, which first find the
+     *        positions where both the first and last bytes of the pattern match, 16 or 32 at a time with SSE2, AVX2, or
+     *        NEON, and only compare the rest of the pattern there.
+     * @see https://eel.is/c++draft/func.search.default
+     * @see https://cppreference.com/w/cpp/utility/functional/default_searcher
+     * @note A feature from the C++17 standard.
+     */
+    template <class ForwardIterator1, class BinaryPredicate = std::equal_to<>>
+    class default_searcher
+    {
+    public:
+        constexpr default_searcher(ForwardIterator1 pat_first, ForwardIterator1 pat_last, BinaryPredicate pred = BinaryPredicate());
+
+        template <class ForwardIterator2>
+        constexpr std::pair<ForwardIterator2, ForwardIterator2> operator()(ForwardIterator2 first, ForwardIterator2 last) const;
+
+    private:
+        ForwardIterator1 pattern_first;
+        ForwardIterator1 pattern_last;
+        BinaryPredicate predicate;
+    };
+
+    /**
+     * @brief Skips through the haystack with the bad character and good suffix rules. Contiguous byte sequences
+     *        compared with `==` use `default_searcher`'s SIMD filter for short patterns, which is faster than skipping
+     *        until the pattern is long enough for the skips to be long too. Byte alphabets don't allocate a skip table;
+     *        the good suffix table, one entry per pattern element, is still allocated.
+     * @see https://eel.is/c++draft/func.search.bm
+     * @see https://cppreference.com/w/cpp/utility/functional/boyer_moore_searcher
+     * @note A feature from the C++17 standard.
+     */
+    template <class RandomAccessIterator1, class Hash = std::hash<std::iter_value_t<RandomAccessIterator1>>, class BinaryPredicate = std::equal_to<>>
+    class boyer_moore_searcher
+    {
+    public:
+        boyer_moore_searcher(RandomAccessIterator1 pat_first, RandomAccessIterator1 pat_last, Hash hf = Hash(), BinaryPredicate pred = BinaryPredicate());
+
+        template <class RandomAccessIterator2>
+        std::pair<RandomAccessIterator2, RandomAccessIterator2> operator()(RandomAccessIterator2 first, RandomAccessIterator2 last) const;
+
+    private:
+        using difference_type = std::iter_difference_t<RandomAccessIterator1>;
+
+        RandomAccessIterator1 pattern_first;
+        RandomAccessIterator1 pattern_last;
+        BinaryPredicate predicate;
+        StdReimpl::Detail::searcher_skip_table<RandomAccessIterator1, Hash, BinaryPredicate> bad_character;
+
+        // How far the pattern can move after a mismatch at each of its positions, given the suffix that matched.
+        std::vector<difference_type> good_suffix;
+    };
+
+    /**
+     * @brief Skips through the haystack with the bad character rule only. Contiguous byte sequences compared with `==`
+     *        use `default_searcher`'s SIMD filter for short patterns, like `boyer_moore_searcher`. Byte alphabets
+     *        don't allocate.
+     * @see https://eel.is/c++draft/func.search.bmh
+     * @see https://cppreference.com/w/cpp/utility/functional/boyer_moore_horspool_searcher
+     * @note A feature from the C++17 standard.
+     */
+    template <class RandomAccessIterator1, class Hash = std::hash<std::iter_value_t<RandomAccessIterator1>>, class BinaryPredicate = std::equal_to<>>
+    class boyer_moore_horspool_searcher
+    {
+    public:
+        boyer_moore_horspool_searcher(RandomAccessIterator1 pat_first, RandomAccessIterator1 pat_last, Hash hf = Hash(), BinaryPredicate pred = BinaryPredicate());
+
+        template <class RandomAccessIterator2>
+        std::pair<RandomAccessIterator2, RandomAccessIterator2> operator()(RandomAccessIterator2 first, RandomAccessIterator2 last) const;
+
+    private:
+        RandomAccessIterator1 pattern_first;
+        RandomAccessIterator1 pattern_last;
+        BinaryPredicate predicate;
+        StdReimpl::Detail::searcher_skip_table<RandomAccessIterator1, Hash, BinaryPredicate> bad_character;
+    };
+
+    namespace Detail
+    {
+        /**
+         * @brief Which end of the call's arguments a call wrapper puts its bound arguments at.
+         */
+        enum class bind_side
+        {
+            front,
+            back
+        };
+
+        /**
+         * @brief `T` with the const and reference qualifiers of `Self`, which is the reference type of a call wrapper
+         *        in one of its call operators, i.e., how the wrapper passes a state entity on to the call.
+         */
+        template <class Self, class T>
+        using bind_qualified_t = std::conditional_t<
+            std::is_lvalue_reference_v<Self>,
+            std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T, T>&,
+            std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T, T>&&
+        >;
+
+        /**
+         * @brief The class of a pointer to member.
+         */
+        template <class T>
+        struct bind_member_pointer_class;
+
+        template <class M, class C>
+        struct bind_member_pointer_class<M C::*>
+        {
+            using type = C;
+        };
+
+        template <class T>
+        inline constexpr bool bind_is_reference_wrapper_v = false;
+
+        template <class T>
+        inline constexpr bool bind_is_reference_wrapper_v<std::reference_wrapper<T>> = true;
+
+        /**
+         * @brief The object that INVOKE applies a pointer to a member of `C` to, given `t`: `t` itself, what it refers
+         *        to if it's a `reference_wrapper`, or else what it points to.
+         * @see https://eel.is/c++draft/func.require#1
+         */
+        template <class C, class T>
+        constexpr decltype(auto) bind_member_object(T&& t)
+        {
+            if constexpr (std::is_base_of_v<C, std::remove_cvref_t<T>>)
+            {
+                return std::forward<T>(t);
+            }
+            else if constexpr (StdReimpl::Detail::bind_is_reference_wrapper_v<std::remove_cvref_t<T>>)
+            {
+                return t.get();
+            }
+            else
+            {
+                return *std::forward<T>(t);
+            }
+        }
+
+        /**
+         * @brief The target object of a call wrapper made from a `constant_arg` or an `auto f` template argument. The
+         *        callable is encoded in the type, so this is empty and calls `f` directly rather than through a stored
+         *        function pointer or pointer to member.
+         */
+        template <auto f>
+        struct bind_constant_callable
+        {
+            template <class... Args>
+                requires (StdReimpl::Detail::is_invocable_v<const decltype(f)&, Args...>)
+            constexpr StdReimpl::Detail::invoke_result_t<const decltype(f)&, Args...> operator()(Args&&... args) const
+                noexcept(StdReimpl::Detail::is_nothrow_invocable_v<const decltype(f)&, Args...>)
+            {
+                if constexpr (std::is_member_pointer_v<decltype(f)>)
+                {
+                    return Call(std::forward<Args>(args)...);
+                }
+                else
+                {
+                    return f(std::forward<Args>(args)...);
+                }
+            }
+
+        private:
+            // Applies the pointer to member with `.*` on the template argument itself. GCC doesn't inline a pointer to
+            // member function that `std::invoke` takes by reference, even a constant one, so that would leave a call.
+            template <class T, class... Args>
+            static constexpr StdReimpl::Detail::invoke_result_t<const decltype(f)&, T, Args...> Call(T&& t, Args&&... args)
+            {
+                using C = typename StdReimpl::Detail::bind_member_pointer_class<decltype(f)>::type;
+
+                // Bound to a reference to `C` up front, since GCC warns about type punning when the conversion from a
+                // derived class happens in the same expression as `.*`.
+                auto&& object = StdReimpl::Detail::bind_member_object<C>(std::forward<T>(t));
+                using Object = StdReimpl::Detail::bind_qualified_t<decltype(object), C>;
+                std::remove_reference_t<Object>& base = object;
+
+                if constexpr (std::is_member_function_pointer_v<decltype(f)>)
+                {
+                    return (static_cast<Object>(base).*f)(std::forward<Args>(args)...);
+                }
+                else
+                {
+                    return (static_cast<Object>(base).*f);
+                }
+            }
+        };
+
+        /**
+         * @brief One bound argument of a `bind_partial_t`, tagged with its index so that equal types stay distinct bases.
+         */
+        template <std::size_t I, class T>
+        struct bind_bound_arg
+        {
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS T value;
+        };
+
+        /**
+         * @brief The bound arguments of a `bind_partial_t`. Used instead of `std::tuple`, which isn't trivially
+         *        copyable, so that a wrapper of trivially copyable arguments is too and can be stored as a callback
+         *        by `memcpy`.
+         */
+        template <class Indices, class... BoundArgs>
+        struct bind_bound_args;
+
+        template <std::size_t... I, class... BoundArgs>
+        struct bind_bound_args<std::index_sequence<I...>, BoundArgs...> : StdReimpl::Detail::bind_bound_arg<I, BoundArgs>...
+        {
+            template <class... Args>
+            constexpr explicit bind_bound_args(std::in_place_t, Args&&... args)
+                : StdReimpl::Detail::bind_bound_arg<I, BoundArgs>{std::forward<Args>(args)}...
+            {
+            }
+        };
+
+        /**
+         * @brief The perfect forwarding call wrapper that `bind_front` and `bind_back` return. Calls a copy of the
+         *        target object with copies of the bound arguments on the `Side` end of the call's arguments, all with
+         *        the value category and constness of the wrapper. Both are `[[no_unique_address]]`, so a wrapper of an
+         *        empty target object is exactly as big as its bound arguments.
+         * @see https://eel.is/c++draft/func.require#4
+         */
+        template <StdReimpl::Detail::bind_side Side, class FD, class... BoundArgs>
+        class bind_partial_t
+        {
+        private:
+            template <class Self, class... CallArgs>
+            static constexpr bool is_invocable_as = Side == StdReimpl::Detail::bind_side::front
+                ? StdReimpl::Detail::is_invocable_v<StdReimpl::Detail::bind_qualified_t<Self, FD>, StdReimpl::Detail::bind_qualified_t<Self, BoundArgs>..., CallArgs...>
+                : StdReimpl::Detail::is_invocable_v<StdReimpl::Detail::bind_qualified_t<Self, FD>, CallArgs..., StdReimpl::Detail::bind_qualified_t<Self, BoundArgs>...>;
+
+            template <class Self, class... CallArgs>
+            static constexpr bool is_nothrow_invocable_as = Side == StdReimpl::Detail::bind_side::front
+                ? StdReimpl::Detail::is_nothrow_invocable_v<StdReimpl::Detail::bind_qualified_t<Self, FD>, StdReimpl::Detail::bind_qualified_t<Self, BoundArgs>..., CallArgs...>
+                : StdReimpl::Detail::is_nothrow_invocable_v<StdReimpl::Detail::bind_qualified_t<Self, FD>, CallArgs..., StdReimpl::Detail::bind_qualified_t<Self, BoundArgs>...>;
+
+        public:
+            template <class F, class... Args>
+            constexpr explicit bind_partial_t(std::in_place_t, F&& f, Args&&... args)
+                : fd(std::forward<F>(f))
+                , bound_args(std::in_place, std::forward<Args>(args)...)
+            {
+            }
+
+            // The call operators. The standard deletes the ones whose call would be ill-formed, rather than leaving
+            // them out, so that e.g. calling an rvalue wrapper can't fall back to the const lvalue overload.
+
+            template <class... CallArgs>
+                requires (is_invocable_as<bind_partial_t&, CallArgs...>)
+            constexpr decltype(auto) operator()(CallArgs&&... call_args) &
+                noexcept(is_nothrow_invocable_as<bind_partial_t&, CallArgs...>)
+            {
+                return Call(*this, std::index_sequence_for<BoundArgs...>(), std::forward<CallArgs>(call_args)...);
+            }
+
+            template <class... CallArgs>
+                requires (is_invocable_as<const bind_partial_t&, CallArgs...>)
+            constexpr decltype(auto) operator()(CallArgs&&... call_args) const&
+                noexcept(is_nothrow_invocable_as<const bind_partial_t&, CallArgs...>)
+            {
+                return Call(*this, std::index_sequence_for<BoundArgs...>(), std::forward<CallArgs>(call_args)...);
+            }
+
+            template <class... CallArgs>
+                requires (is_invocable_as<bind_partial_t&&, CallArgs...>)
+            constexpr decltype(auto) operator()(CallArgs&&... call_args) &&
+                noexcept(is_nothrow_invocable_as<bind_partial_t&&, CallArgs...>)
+            {
+                return Call(std::move(*this), std::index_sequence_for<BoundArgs...>(), std::forward<CallArgs>(call_args)...);
+            }
+
+            template <class... CallArgs>
+                requires (is_invocable_as<const bind_partial_t&&, CallArgs...>)
+            constexpr decltype(auto) operator()(CallArgs&&... call_args) const&&
+                noexcept(is_nothrow_invocable_as<const bind_partial_t&&, CallArgs...>)
+            {
+                return Call(std::move(*this), std::index_sequence_for<BoundArgs...>(), std::forward<CallArgs>(call_args)...);
+            }
+
+            template <class... CallArgs>
+                requires (!is_invocable_as<bind_partial_t&, CallArgs...>)
+            void operator()(CallArgs&&... call_args) & = delete;
+
+            template <class... CallArgs>
+                requires (!is_invocable_as<const bind_partial_t&, CallArgs...>)
+            void operator()(CallArgs&&... call_args) const& = delete;
+
+            template <class... CallArgs>
+                requires (!is_invocable_as<bind_partial_t&&, CallArgs...>)
+            void operator()(CallArgs&&... call_args) && = delete;
+
+            template <class... CallArgs>
+                requires (!is_invocable_as<const bind_partial_t&&, CallArgs...>)
+            void operator()(CallArgs&&... call_args) const&& = delete;
+
+        private:
+            template <class Self, std::size_t... I, class... CallArgs>
+            static constexpr decltype(auto) Call(Self&& self, std::index_sequence<I...>, CallArgs&&... call_args)
+            {
+                if constexpr (Side == StdReimpl::Detail::bind_side::front)
+                {
+                    return StdReimpl::Detail::invoke(std::forward<Self>(self).fd,
+                        static_cast<StdReimpl::Detail::bind_qualified_t<Self, StdReimpl::Detail::bind_bound_arg<I, BoundArgs>>>(self.bound_args).value...,
+                        std::forward<CallArgs>(call_args)...);
+                }
+                else
+                {
+                    return StdReimpl::Detail::invoke(std::forward<Self>(self).fd,
+                        std::forward<CallArgs>(call_args)...,
+                        static_cast<StdReimpl::Detail::bind_qualified_t<Self, StdReimpl::Detail::bind_bound_arg<I, BoundArgs>>>(self.bound_args).value...);
+                }
+            }
+
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS FD fd;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS StdReimpl::Detail::bind_bound_args<std::index_sequence_for<BoundArgs...>, BoundArgs...> bound_args;
+        };
+
+        /**
+         * @brief The perfect forwarding call wrapper that `not_fn` returns. Calls a copy of the target object with the
+         *        value category and constness of the wrapper, and negates the result.
+         * @see https://eel.is/c++draft/func.not.fn
+         */
+        template <class FD>
+        class not_fn_t
+        {
+        private:
+            template <class Self, class... CallArgs>
+            static constexpr bool is_invocable_as = requires
+            {
+                !StdReimpl::Detail::invoke(std::declval<StdReimpl::Detail::bind_qualified_t<Self, FD>>(), std::declval<CallArgs>()...);
+            };
+
+            template <class Self, class... CallArgs>
+            static constexpr bool is_nothrow_invocable_as = requires
+            {
+                { !StdReimpl::Detail::invoke(std::declval<StdReimpl::Detail::bind_qualified_t<Self, FD>>(), std::declval<CallArgs>()...) } noexcept;
+            };
+
+        public:
+            template <class F>
+            constexpr explicit not_fn_t(std::in_place_t, F&& f)
+                : fd(std::forward<F>(f))
+            {
+            }
+
+            template <class... CallArgs>
+                requires (is_invocable_as<not_fn_t&, CallArgs...>)
+            constexpr decltype(auto) operator()(CallArgs&&... call_args) &
+                noexcept(is_nothrow_invocable_as<not_fn_t&, CallArgs...>)
+            {
+                return !StdReimpl::Detail::invoke(fd, std::forward<CallArgs>(call_args)...);
+            }
+
+            template <class... CallArgs>
+                requires (is_invocable_as<const not_fn_t&, CallArgs...>)
+            constexpr decltype(auto) operator()(CallArgs&&... call_args) const&
+                noexcept(is_nothrow_invocable_as<const not_fn_t&, CallArgs...>)
+            {
+                return !StdReimpl::Detail::invoke(fd, std::forward<CallArgs>(call_args)...);
+            }
+
+            template <class... CallArgs>
+                requires (is_invocable_as<not_fn_t&&, CallArgs...>)
+            constexpr decltype(auto) operator()(CallArgs&&... call_args) &&
+                noexcept(is_nothrow_invocable_as<not_fn_t&&, CallArgs...>)
+            {
+                return !StdReimpl::Detail::invoke(std::move(fd), std::forward<CallArgs>(call_args)...);
+            }
+
+            template <class... CallArgs>
+                requires (is_invocable_as<const not_fn_t&&, CallArgs...>)
+            constexpr decltype(auto) operator()(CallArgs&&... call_args) const&&
+                noexcept(is_nothrow_invocable_as<const not_fn_t&&, CallArgs...>)
+            {
+                return !StdReimpl::Detail::invoke(std::move(fd), std::forward<CallArgs>(call_args)...);
+            }
+
+            template <class... CallArgs>
+                requires (!is_invocable_as<not_fn_t&, CallArgs...>)
+            void operator()(CallArgs&&... call_args) & = delete;
+
+            template <class... CallArgs>
+                requires (!is_invocable_as<const not_fn_t&, CallArgs...>)
+            void operator()(CallArgs&&... call_args) const& = delete;
+
+            template <class... CallArgs>
+                requires (!is_invocable_as<not_fn_t&&, CallArgs...>)
+            void operator()(CallArgs&&... call_args) && = delete;
+
+            template <class... CallArgs>
+                requires (!is_invocable_as<const not_fn_t&&, CallArgs...>)
+            void operator()(CallArgs&&... call_args) const&& = delete;
+
+        private:
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS FD fd;
+        };
+    }
+
+    /**
+     * @brief Binds `args` to the front of `f`'s arguments. Unlike `std::bind_front`, the call operators are constrained
+     *        and `noexcept` exactly when the call they make is.
+     * @see https://eel.is/c++draft/func.bind.partial
+     * @see https://cppreference.com/w/cpp/utility/functional/bind_front.html
+     * @note A feature from the C++20 standard.
+     */
+    template <class F, class... Args>
+        requires (!StdReimpl::Detail::is_constant_arg_t_v<std::remove_cvref_t<F>>)
+    constexpr StdReimpl::Detail::bind_partial_t<StdReimpl::Detail::bind_side::front, std::decay_t<F>, std::decay_t<Args>...> bind_front(F&& f, Args&&... args);
+
+    /**
+     * @brief Binds `args` to the front of the arguments of `f`, which is a template argument, so the wrapper stores
+     *        only the bound arguments and calls `f` directly. E.g., `bind_front<&Widget::OnClick>(this)` is one
+     *        pointer wide and calls `OnClick` without loading a pointer to member, and `bind_front<&Compare>()` is
+     *        empty.
+     * @see https://eel.is/c++draft/func.bind.partial
+     * @see https://cppreference.com/w/cpp/utility/functional/bind_front.html
+     * @note A feature from the C++26 standard.
+     */
+    template <auto f, class... Args>
+    constexpr StdReimpl::Detail::bind_partial_t<StdReimpl::Detail::bind_side::front, StdReimpl::Detail::bind_constant_callable<f>, std::decay_t<Args>...> bind_front(Args&&... args);
+
+    /**
+     * @brief The same as `bind_front<f>(args...)`, spelled with a `constant_arg` like `function_ref`'s constructors.
+     */
+    template <auto f, class... Args>
+    constexpr StdReimpl::Detail::bind_partial_t<StdReimpl::Detail::bind_side::front, StdReimpl::Detail::bind_constant_callable<f>, std::decay_t<Args>...> bind_front(StdReimpl::constant_arg_t<f>, Args&&... args);
+
+    /**
+     * @brief Binds `args` to the back of `f`'s arguments.
+     * @see https://eel.is/c++draft/func.bind.partial
+     * @see https://cppreference.com/w/cpp/utility/functional/bind_back.html
+     * @note A feature from the C++23 standard.
+     */
+    template <class F, class... Args>
+        requires (!StdReimpl::Detail::is_constant_arg_t_v<std::remove_cvref_t<F>>)
+    constexpr StdReimpl::Detail::bind_partial_t<StdReimpl::Detail::bind_side::back, std::decay_t<F>, std::decay_t<Args>...> bind_back(F&& f, Args&&... args);
+
+    /**
+     * @brief Binds `args` to the back of the arguments of `f`, which is a template argument, so the wrapper stores only
+     *        the bound arguments and calls `f` directly.
+     * @see https://eel.is/c++draft/func.bind.partial
+     * @see https://cppreference.com/w/cpp/utility/functional/bind_back.html
+     * @note A feature from the C++26 standard.
+     */
+    template <auto f, class... Args>
+    constexpr StdReimpl::Detail::bind_partial_t<StdReimpl::Detail::bind_side::back, StdReimpl::Detail::bind_constant_callable<f>, std::decay_t<Args>...> bind_back(Args&&... args);
+
+    /**
+     * @brief The same as `bind_back<f>(args...)`, spelled with a `constant_arg` like `function_ref`'s constructors.
+     */
+    template <auto f, class... Args>
+    constexpr StdReimpl::Detail::bind_partial_t<StdReimpl::Detail::bind_side::back, StdReimpl::Detail::bind_constant_callable<f>, std::decay_t<Args>...> bind_back(StdReimpl::constant_arg_t<f>, Args&&... args);
+
+    /**
+     * @brief Wraps `f` in a call wrapper that negates its result.
+     * @see https://eel.is/c++draft/func.not.fn
+     * @see https://cppreference.com/w/cpp/utility/functional/not_fn.html
+     * @note A feature from the C++17 standard.
+     */
+    template <class F>
+        requires (!StdReimpl::Detail::is_constant_arg_t_v<std::remove_cvref_t<F>>)
+    constexpr StdReimpl::Detail::not_fn_t<std::decay_t<F>> not_fn(F&& f);
+
+    /**
+     * @brief Negates the result of `f`, which is a template argument, so the wrapper is empty.
+     * @see https://eel.is/c++draft/func.not.fn
+     * @see https://cppreference.com/w/cpp/utility/functional/not_fn.html
+     * @note A feature from the C++26 standard.
+     */
+    template <auto f>
+    constexpr StdReimpl::Detail::not_fn_t<StdReimpl::Detail::bind_constant_callable<f>> not_fn() noexcept;
+
+    /**
+     * @brief The same as `not_fn<f>()`, spelled with a `constant_arg` like `function_ref`'s constructors.
+     */
+    template <auto f>
+    constexpr StdReimpl::Detail::not_fn_t<StdReimpl::Detail::bind_constant_callable<f>> not_fn(StdReimpl::constant_arg_t<f>) noexcept;
 }
 
 #include <CppUtils/StdReimpl/functional.inl>
@@ -3,3 +3,490 @@
 #pragma once
 
 #include <CppUtils/StdReimpl/functional.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#   define CPPUTILS_STDREIMPL_FUNCTIONAL_USE_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define CPPUTILS_STDREIMPL_FUNCTIONAL_USE_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#   include <arm_neon.h>
+#   define CPPUTILS_STDREIMPL_FUNCTIONAL_USE_NEON 1
+#endif
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        /**
+         * @brief Pattern lengths up to which the Boyer-Moore searchers use the SIMD filter on contiguous bytes. Past it,
+         *        skipping up to a pattern's length at a time wins, further out the wider the vectors are.
+         */
+#if defined(CPPUTILS_STDREIMPL_FUNCTIONAL_USE_AVX2)
+        inline constexpr std::ptrdiff_t searcher_filter_max_pattern_size = 256;
+#else
+        inline constexpr std::ptrdiff_t searcher_filter_max_pattern_size = 64;
+#endif
+
+        /**
+         * @brief Whether the pattern matches at `candidate`, given that its first and last bytes already do.
+         */
+        inline bool searcher_matches_middle(const unsigned char* candidate, const unsigned char* pattern, std::size_t patternSize) noexcept
+        {
+            return patternSize <= 2 || std::memcmp(candidate + 1, pattern + 1, patternSize - 2) == 0;
+        }
+
+        /**
+         * @brief Finds the first occurrence of the pattern of `patternSize` bytes, which is at least 1, in `[first, last)`.
+         *        Compares the first and last bytes of the pattern with a block of positions at a time, and only
+         *        compares the rest at the positions where both match. Returns null if there's none.
+         */
+        inline const unsigned char* searcher_find_bytes(const unsigned char* first, const unsigned char* last, const unsigned char* pattern,
+            std::size_t patternSize) noexcept
+        {
+            const auto size = static_cast<std::size_t>(last - first);
+            if (size < patternSize)
+            {
+                return nullptr;
+            }
+            if (patternSize == 1)
+            {
+                return static_cast<const unsigned char*>(std::memchr(first, pattern[0], size));
+            }
+
+            // Positions at which the pattern can start.
+            const std::size_t positions = size - patternSize + 1;
+            std::size_t i = 0;
+#if defined(CPPUTILS_STDREIMPL_FUNCTIONAL_USE_AVX2)
+            const __m256i firstByte = _mm256_set1_epi8(static_cast<char>(pattern[0]));
+            const __m256i lastByte = _mm256_set1_epi8(static_cast<char>(pattern[patternSize - 1]));
+            for (; i + 32 <= positions; i += 32)
+            {
+                const __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i));
+                const __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i + patternSize - 1));
+                auto mask = static_cast<std::uint32_t>(
+                    _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, firstByte), _mm256_cmpeq_epi8(blockLast, lastByte))));
+                while (mask != 0)
+                {
+                    const std::size_t candidate = i + static_cast<std::size_t>(std::countr_zero(mask));
+                    if (searcher_matches_middle(first + candidate, pattern, patternSize))
+                    {
+                        return first + candidate;
+                    }
+                    mask &= mask - 1;
+                }
+            }
+#elif defined(CPPUTILS_STDREIMPL_FUNCTIONAL_USE_SSE2)
+            const __m128i firstByte = _mm_set1_epi8(static_cast<char>(pattern[0]));
+            const __m128i lastByte = _mm_set1_epi8(static_cast<char>(pattern[patternSize - 1]));
+            for (; i + 16 <= positions; i += 16)
+            {
+                const __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+                const __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i + patternSize - 1));
+                auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(blockFirst, firstByte), _mm_cmpeq_epi8(blockLast, lastByte))));
+                while (mask != 0)
+                {
+                    const std::size_t candidate = i + static_cast<std::size_t>(std::countr_zero(mask));
+                    if (searcher_matches_middle(first + candidate, pattern, patternSize))
+                    {
+                        return first + candidate;
+                    }
+                    mask &= mask - 1;
+                }
+            }
+#elif defined(CPPUTILS_STDREIMPL_FUNCTIONAL_USE_NEON)
+            const uint8x16_t firstByte = vdupq_n_u8(pattern[0]);
+            const uint8x16_t lastByte = vdupq_n_u8(pattern[patternSize - 1]);
+            for (; i + 16 <= positions; i += 16)
+            {
+                const uint8x16_t matches = vandq_u8(vceqq_u8(vld1q_u8(first + i), firstByte), vceqq_u8(vld1q_u8(first + i + patternSize - 1), lastByte));
+                // NEON has no movemask. Narrowing each 16-bit lane by 4 bits leaves 4 bits per byte.
+                std::uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+                while (mask != 0)
+                {
+                    const std::size_t candidate = i + static_cast<std::size_t>(std::countr_zero(mask)) / 4;
+                    if (searcher_matches_middle(first + candidate, pattern, patternSize))
+                    {
+                        return first + candidate;
+                    }
+                    mask &= ~(std::uint64_t{0xF} << (4 * (candidate - i)));
+                }
+            }
+#endif
+            for (; i < positions; ++i)
+            {
+                if (first[i] == pattern[0] && first[i + patternSize - 1] == pattern[patternSize - 1] && searcher_matches_middle(first + i, pattern, patternSize))
+                {
+                    return first + i;
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Searches contiguous bytes with the SIMD filter. The pattern is not empty.
+         */
+        template <class PatternIterator, class Iterator>
+        std::pair<Iterator, Iterator> searcher_find_contiguous(PatternIterator patternFirst, PatternIterator patternLast, Iterator first, Iterator last)
+        {
+            const auto* const haystack = reinterpret_cast<const unsigned char*>(std::to_address(first));
+            const auto* const pattern = reinterpret_cast<const unsigned char*>(std::to_address(patternFirst));
+            const auto patternSize = static_cast<std::size_t>(patternLast - patternFirst);
+            const unsigned char* const found = searcher_find_bytes(haystack, haystack + (last - first), pattern, patternSize);
+            if (found == nullptr)
+            {
+                return {last, last};
+            }
+            const Iterator match = first + (found - haystack);
+            return {match, match + static_cast<std::iter_difference_t<Iterator>>(patternSize)};
+        }
+
+        template <class RandomAccessIterator, class Hash, class BinaryPredicate, bool IsByte>
+        searcher_skip_table<RandomAccessIterator, Hash, BinaryPredicate, IsByte>::searcher_skip_table(RandomAccessIterator patternFirst,
+            difference_type patternSize, const Hash& hash, const BinaryPredicate& pred)
+            : skips(static_cast<std::size_t>(patternSize), hash, pred),
+              default_skip(patternSize)
+        {
+            for (difference_type i = 0; i + 1 < patternSize; ++i)
+            {
+                skips.insert_or_assign(patternFirst[i], patternSize - 1 - i);
+            }
+        }
+
+        template <class RandomAccessIterator, class Hash, class BinaryPredicate, bool IsByte>
+        typename searcher_skip_table<RandomAccessIterator, Hash, BinaryPredicate, IsByte>::difference_type
+            searcher_skip_table<RandomAccessIterator, Hash, BinaryPredicate, IsByte>::Get(const value_type& c) const
+        {
+            const auto it = skips.find(c);
+            return it == skips.end() ? default_skip : it->second;
+        }
+
+        template <class RandomAccessIterator, class Hash, class BinaryPredicate>
+        searcher_skip_table<RandomAccessIterator, Hash, BinaryPredicate, true>::searcher_skip_table(RandomAccessIterator patternFirst,
+            difference_type patternSize, const Hash&, const BinaryPredicate& pred)
+        {
+            std::fill(std::begin(skips), std::end(skips), patternSize);
+            if constexpr (std::is_same_v<BinaryPredicate, std::equal_to<>> || std::is_same_v<BinaryPredicate, std::equal_to<value_type>>)
+            {
+                for (difference_type i = 0; i + 1 < patternSize; ++i)
+                {
+                    skips[static_cast<unsigned char>(patternFirst[i])] = patternSize - 1 - i;
+                }
+            }
+            else
+            {
+                // The predicate may match several bytes to one pattern element, e.g. ignoring case, so each byte value
+                // is tried against the pattern.
+                for (unsigned int c = 0; c < 256; ++c)
+                {
+                    const auto value = static_cast<value_type>(c);
+                    for (difference_type i = 0; i + 1 < patternSize; ++i)
+                    {
+                        if (pred(value, patternFirst[i]))
+                        {
+                            skips[c] = patternSize - 1 - i;
+                        }
+                    }
+                }
+            }
+        }
+
+        template <class RandomAccessIterator, class Hash, class BinaryPredicate>
+        typename searcher_skip_table<RandomAccessIterator, Hash, BinaryPredicate, true>::difference_type
+            searcher_skip_table<RandomAccessIterator, Hash, BinaryPredicate, true>::Get(const value_type& c) const noexcept
+        {
+            return skips[static_cast<unsigned char>(c)];
+        }
+    }
+
+    template <class ForwardIterator1, class BinaryPredicate>
+    constexpr default_searcher<ForwardIterator1, BinaryPredicate>::default_searcher(ForwardIterator1 pat_first, ForwardIterator1 pat_last,
+        BinaryPredicate pred)
+        : pattern_first(std::move(pat_first)),
+          pattern_last(std::move(pat_last)),
+          predicate(std::move(pred))
+    {
+    }
+
+    template <class ForwardIterator1, class BinaryPredicate>
+    template <class ForwardIterator2>
+    constexpr std::pair<ForwardIterator2, ForwardIterator2> default_searcher<ForwardIterator1, BinaryPredicate>::operator()(ForwardIterator2 first,
+        ForwardIterator2 last) const
+    {
+        if constexpr (StdReimpl::Detail::searcher_contiguous_bytes<ForwardIterator1, ForwardIterator2, BinaryPredicate>)
+        {
+            if (!std::is_constant_evaluated() && pattern_first != pattern_last)
+            {
+                return StdReimpl::Detail::searcher_find_contiguous(pattern_first, pattern_last, first, last);
+            }
+        }
+
+        ForwardIterator2 match = std::search(first, last, pattern_first, pattern_last, predicate);
+        if (match == last)
+        {
+            return {last, last};
+        }
+        ForwardIterator2 matchEnd = match;
+        std::advance(matchEnd, std::distance(pattern_first, pattern_last));
+        return {match, matchEnd};
+    }
+
+    template <class RandomAccessIterator1, class Hash, class BinaryPredicate>
+    boyer_moore_searcher<RandomAccessIterator1, Hash, BinaryPredicate>::boyer_moore_searcher(RandomAccessIterator1 pat_first,
+        RandomAccessIterator1 pat_last, Hash hf, BinaryPredicate pred)
+        : pattern_first(pat_first),
+          pattern_last(pat_last),
+          predicate(pred),
+          bad_character(pat_first, pat_last - pat_first, hf, pred),
+          good_suffix(static_cast<std::size_t>(pat_last - pat_first))
+    {
+        // The good suffix rule, computed in linear time from the lengths of the longest suffixes of the pattern that end
+        // at each position. See Charras and Lecroq, "Handbook of Exact String Matching Algorithms".
+        const difference_type m = pat_last - pat_first;
+        if (m == 0)
+        {
+            return;
+        }
+        std::vector<difference_type> suffixes(static_cast<std::size_t>(m));
+        suffixes[static_cast<std::size_t>(m - 1)] = m;
+        difference_type g = m - 1;
+        difference_type f = m - 1;
+        for (difference_type i = m - 2; i >= 0; --i)
+        {
+            if (i > g && suffixes[static_cast<std::size_t>(i + m - 1 - f)] < i - g)
+            {
+                suffixes[static_cast<std::size_t>(i)] = suffixes[static_cast<std::size_t>(i + m - 1 - f)];
+            }
+            else
+            {
+                g = std::min(g, i);
+                f = i;
+                while (g >= 0 && predicate(pat_first[g], pat_first[g + m - 1 - f]))
+                {
+                    --g;
+                }
+                suffixes[static_cast<std::size_t>(i)] = f - g;
+            }
+        }
+
+        std::fill(good_suffix.begin(), good_suffix.end(), m);
+        difference_type j = 0;
+        for (difference_type i = m - 1; i >= 0; --i)
+        {
+            if (suffixes[static_cast<std::size_t>(i)] == i + 1)
+            {
+                for (; j < m - 1 - i; ++j)
+                {
+                    if (good_suffix[static_cast<std::size_t>(j)] == m)
+                    {
+                        good_suffix[static_cast<std::size_t>(j)] = m - 1 - i;
+                    }
+                }
+            }
+        }
+        for (difference_type i = 0; i + 1 < m; ++i)
+        {
+            good_suffix[static_cast<std::size_t>(m - 1 - suffixes[static_cast<std::size_t>(i)])] = m - 1 - i;
+        }
+    }
+
+    template <class RandomAccessIterator1, class Hash, class BinaryPredicate>
+    template <class RandomAccessIterator2>
+    std::pair<RandomAccessIterator2, RandomAccessIterator2> boyer_moore_searcher<RandomAccessIterator1, Hash, BinaryPredicate>::operator()(
+        RandomAccessIterator2 first, RandomAccessIterator2 last) const
+    {
+        static_assert(std::is_same_v<std::iter_value_t<RandomAccessIterator1>, std::iter_value_t<RandomAccessIterator2>>,
+            "The pattern and the haystack must have the same value type.");
+
+        const difference_type m = pattern_last - pattern_first;
+        if (m == 0)
+        {
+            return {first, first};
+        }
+        if constexpr (StdReimpl::Detail::searcher_contiguous_bytes<RandomAccessIterator1, RandomAccessIterator2, BinaryPredicate>)
+        {
+            if (m <= StdReimpl::Detail::searcher_filter_max_pattern_size)
+            {
+                return StdReimpl::Detail::searcher_find_contiguous(pattern_first, pattern_last, first, last);
+            }
+        }
+
+        const auto n = static_cast<difference_type>(last - first);
+        for (difference_type j = 0; j <= n - m;)
+        {
+            difference_type i = m - 1;
+            while (i >= 0 && predicate(first[j + i], pattern_first[i]))
+            {
+                --i;
+            }
+            if (i < 0)
+            {
+                return {first + j, first + j + m};
+            }
+            j += std::max(good_suffix[static_cast<std::size_t>(i)], bad_character.Get(first[j + i]) - m + 1 + i);
+        }
+        return {last, last};
+    }
+
+    template <class RandomAccessIterator1, class Hash, class BinaryPredicate>
+    boyer_moore_horspool_searcher<RandomAccessIterator1, Hash, BinaryPredicate>::boyer_moore_horspool_searcher(RandomAccessIterator1 pat_first,
+        RandomAccessIterator1 pat_last, Hash hf, BinaryPredicate pred)
+        : pattern_first(pat_first),
+          pattern_last(pat_last),
+          predicate(pred),
+          bad_character(pat_first, pat_last - pat_first, hf, pred)
+    {
+    }
+
+    template <class RandomAccessIterator1, class Hash, class BinaryPredicate>
+    template <class RandomAccessIterator2>
+    std::pair<RandomAccessIterator2, RandomAccessIterator2> boyer_moore_horspool_searcher<RandomAccessIterator1, Hash, BinaryPredicate>::operator()(
+        RandomAccessIterator2 first, RandomAccessIterator2 last) const
+    {
+        static_assert(std::is_same_v<std::iter_value_t<RandomAccessIterator1>, std::iter_value_t<RandomAccessIterator2>>,
+            "The pattern and the haystack must have the same value type.");
+
+        using difference_type = std::iter_difference_t<RandomAccessIterator1>;
+        const difference_type m = pattern_last - pattern_first;
+        if (m == 0)
+        {
+            return {first, first};
+        }
+        if constexpr (StdReimpl::Detail::searcher_contiguous_bytes<RandomAccessIterator1, RandomAccessIterator2, BinaryPredicate>)
+        {
+            if (m <= StdReimpl::Detail::searcher_filter_max_pattern_size)
+            {
+                return StdReimpl::Detail::searcher_find_contiguous(pattern_first, pattern_last, first, last);
+            }
+        }
+
+        const auto n = static_cast<difference_type>(last - first);
+        for (difference_type j = 0; j <= n - m;)
+        {
+            // The last element first, since it's what the skip depends on.
+            const auto& tail = first[j + m - 1];
+            if (predicate(tail, pattern_first[m - 1]))
+            {
+                difference_type i = m - 2;
+                while (i >= 0 && predicate(first[j + i], pattern_first[i]))
+                {
+                    --i;
+                }
+                if (i < 0)
+                {
+                    return {first + j, first + j + m};
+                }
+            }
+            j += bad_character.Get(tail);
+        }
+        return {last, last};
+    }
+
+    namespace Detail
+    {
+        /**
+         * @brief Checks the mandates that the `auto f` overloads of `bind_front`, `bind_back` and `not_fn` share.
+         */
+        template <auto f>
+        consteval void bind_check_constant_callable()
+        {
+            // Let F be decltype(f).
+            using F = decltype(f);
+
+            // Mandates: If is_pointer_v<F> || is_member_pointer_v<F> is true, then f != nullptr is true.
+            if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+            {
+                static_assert(f != nullptr);
+            }
+        }
+    }
+
+    template <class F, class... Args>
+        requires (!StdReimpl::Detail::is_constant_arg_t_v<std::remove_cvref_t<F>>)
+    constexpr StdReimpl::Detail::bind_partial_t<StdReimpl::Detail::bind_side::front, std::decay_t<F>, std::decay_t<Args>...> bind_front(F&& f, Args&&... args)
+    {
+        // Mandates: is_constructible_v<FD, F> && is_move_constructible_v<FD> && (is_constructible_v<BoundArgs, Args> && ...)
+        // && (is_move_constructible_v<BoundArgs> && ...) is true.
+        static_assert(std::is_constructible_v<std::decay_t<F>, F> && std::is_move_constructible_v<std::decay_t<F>>);
+        static_assert((std::is_constructible_v<std::decay_t<Args>, Args> && ...) && (std::is_move_constructible_v<std::decay_t<Args>> && ...));
+
+        return StdReimpl::Detail::bind_partial_t<StdReimpl::Detail::bind_side::front, std::decay_t<F>, std::decay_t<Args>...>(
+            std::in_place, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    template <auto f, class... Args>
+    constexpr StdReimpl::Detail::bind_partial_t<StdReimpl::Detail::bind_side::front, StdReimpl::Detail::bind_constant_callable<f>, std::decay_t<Args>...> bind_front(Args&&... args)
+    {
+        // Mandates: (is_constructible_v<BoundArgs, Args> && ...) && (is_move_constructible_v<BoundArgs> && ...) is true.
+        static_assert((std::is_constructible_v<std::decay_t<Args>, Args> && ...) && (std::is_move_constructible_v<std::decay_t<Args>> && ...));
+        StdReimpl::Detail::bind_check_constant_callable<f>();
+
+        return StdReimpl::Detail::bind_partial_t<StdReimpl::Detail::bind_side::front, StdReimpl::Detail::bind_constant_callable<f>, std::decay_t<Args>...>(
+            std::in_place, StdReimpl::Detail::bind_constant_callable<f>(), std::forward<Args>(args)...);
+    }
+
+    template <auto f, class... Args>
+    constexpr StdReimpl::Detail::bind_partial_t<StdReimpl::Detail::bind_side::front, StdReimpl::Detail::bind_constant_callable<f>, std::decay_t<Args>...> bind_front(StdReimpl::constant_arg_t<f>, Args&&... args)
+    {
+        return StdReimpl::bind_front<f>(std::forward<Args>(args)...);
+    }
+
+    template <class F, class... Args>
+        requires (!StdReimpl::Detail::is_constant_arg_t_v<std::remove_cvref_t<F>>)
+    constexpr StdReimpl::Detail::bind_partial_t<StdReimpl::Detail::bind_side::back, std::decay_t<F>, std::decay_t<Args>...> bind_back(F&& f, Args&&... args)
+    {
+        // Mandates: is_constructible_v<FD, F> && is_move_constructible_v<FD> && (is_constructible_v<BoundArgs, Args> && ...)
+        // && (is_move_constructible_v<BoundArgs> && ...) is true.
+        static_assert(std::is_constructible_v<std::decay_t<F>, F> && std::is_move_constructible_v<std::decay_t<F>>);
+        static_assert((std::is_constructible_v<std::decay_t<Args>, Args> && ...) && (std::is_move_constructible_v<std::decay_t<Args>> && ...));
+
+        return StdReimpl::Detail::bind_partial_t<StdReimpl::Detail::bind_side::back, std::decay_t<F>, std::decay_t<Args>...>(
+            std::in_place, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    template <auto f, class... Args>
+    constexpr StdReimpl::Detail::bind_partial_t<StdReimpl::Detail::bind_side::back, StdReimpl::Detail::bind_constant_callable<f>, std::decay_t<Args>...> bind_back(Args&&... args)
+    {
+        // Mandates: (is_constructible_v<BoundArgs, Args> && ...) && (is_move_constructible_v<BoundArgs> && ...) is true.
+        static_assert((std::is_constructible_v<std::decay_t<Args>, Args> && ...) && (std::is_move_constructible_v<std::decay_t<Args>> && ...));
+        StdReimpl::Detail::bind_check_constant_callable<f>();
+
+        return StdReimpl::Detail::bind_partial_t<StdReimpl::Detail::bind_side::back, StdReimpl::Detail::bind_constant_callable<f>, std::decay_t<Args>...>(
+            std::in_place, StdReimpl::Detail::bind_constant_callable<f>(), std::forward<Args>(args)...);
+    }
+
+    template <auto f, class... Args>
+    constexpr StdReimpl::Detail::bind_partial_t<StdReimpl::Detail::bind_side::back, StdReimpl::Detail::bind_constant_callable<f>, std::decay_t<Args>...> bind_back(StdReimpl::constant_arg_t<f>, Args&&... args)
+    {
+        return StdReimpl::bind_back<f>(std::forward<Args>(args)...);
+    }
+
+    template <class F>
+        requires (!StdReimpl::Detail::is_constant_arg_t_v<std::remove_cvref_t<F>>)
+    constexpr StdReimpl::Detail::not_fn_t<std::decay_t<F>> not_fn(F&& f)
+    {
+        // Mandates: is_constructible_v<FD, F> && is_move_constructible_v<FD> is true.
+        static_assert(std::is_constructible_v<std::decay_t<F>, F> && std::is_move_constructible_v<std::decay_t<F>>);
+
+        return StdReimpl::Detail::not_fn_t<std::decay_t<F>>(std::in_place, std::forward<F>(f));
+    }
+
+    template <auto f>
+    constexpr StdReimpl::Detail::not_fn_t<StdReimpl::Detail::bind_constant_callable<f>> not_fn() noexcept
+    {
+        StdReimpl::Detail::bind_check_constant_callable<f>();
+
+        return StdReimpl::Detail::not_fn_t<StdReimpl::Detail::bind_constant_callable<f>>(std::in_place, StdReimpl::Detail::bind_constant_callable<f>());
+    }
+
+    template <auto f>
+    constexpr StdReimpl::Detail::not_fn_t<StdReimpl::Detail::bind_constant_callable<f>> not_fn(StdReimpl::constant_arg_t<f>) noexcept
+    {
+        return StdReimpl::not_fn<f>();
+    }
+}
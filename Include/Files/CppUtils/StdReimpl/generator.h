@@ -0,0 +1,353 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace StdReimpl
+{
+    template <class Ref, class V = void, class Allocator = void>
+    class generator;
+
+    namespace ranges
+    {
+        /**
+         * @brief Wraps a range so that `co_yield` in a `generator` yields each of its elements, rather than the range
+         *        itself. Yielding another `generator` this way resumes it directly, without going through this one.
+         * @see https://eel.is/c++draft/range.elementsof
+         * @see https://cppreference.com/w/cpp/ranges/elements_of
+         * @note A feature from the C++23 standard.
+         */
+        template <std::ranges::range R, class Allocator = std::allocator<std::byte>>
+        struct elements_of
+        {
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS R range;
+            CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Allocator allocator = Allocator();
+        };
+
+        template <class R, class Allocator = std::allocator<std::byte>>
+        elements_of(R&&, Allocator = Allocator()) -> elements_of<R&&, Allocator>;
+    }
+
+    namespace Detail
+    {
+        /**
+         * @brief The unit that coroutine frames are allocated in, so that they get the alignment `operator new` would
+         *        give them.
+         */
+        struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) generator_frame_block
+        {
+            unsigned char bytes[__STDCPP_DEFAULT_NEW_ALIGNMENT__];
+        };
+
+        constexpr std::size_t generator_align_up(std::size_t size, std::size_t alignment) noexcept;
+
+        /**
+         * @brief The allocation functions of a generator's promise, which allocate the coroutine frame with `Allocator`
+         *        instead of the global `operator new`. The allocator is stored past the end of the frame, so that the
+         *        frame can be freed with it, unless it's stateless.
+         */
+        template <class Allocator>
+        class generator_promise_allocator
+        {
+            using block_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<generator_frame_block>;
+
+        public:
+            static void* operator new(std::size_t size)
+                requires std::default_initializable<block_allocator>;
+
+            template <class Alloc, class... Args>
+                requires std::convertible_to<const Alloc&, Allocator>
+            static void* operator new(std::size_t size, std::allocator_arg_t, const Alloc& alloc, const Args&...);
+
+            template <class This, class Alloc, class... Args>
+                requires std::convertible_to<const Alloc&, Allocator>
+            static void* operator new(std::size_t size, const This&, std::allocator_arg_t, const Alloc& alloc, const Args&...);
+
+            static void operator delete(void* pointer, std::size_t size) noexcept;
+
+        private:
+            static_assert(std::is_pointer_v<typename std::allocator_traits<block_allocator>::pointer>,
+                "generator's allocator must use raw pointers.");
+
+            static constexpr bool stores_allocator = !std::allocator_traits<block_allocator>::is_always_equal::value ||
+                !std::default_initializable<block_allocator>;
+
+            static void* Allocate(block_allocator alloc, std::size_t size);
+
+            static constexpr std::size_t AllocatorOffset(std::size_t size) noexcept;
+            static constexpr std::size_t BlockCount(std::size_t size) noexcept;
+        };
+
+        /**
+         * @brief With no `Allocator`, the coroutine frame is allocated with whichever allocator is passed after
+         *        `std::allocator_arg`, or with `std::allocator` if none is. The function that frees the frame is stored
+         *        past its end, followed by the allocator.
+         */
+        template <>
+        class generator_promise_allocator<void>
+        {
+        public:
+            static void* operator new(std::size_t size);
+
+            template <class Alloc, class... Args>
+            static void* operator new(std::size_t size, std::allocator_arg_t, const Alloc& alloc, const Args&...);
+
+            template <class This, class Alloc, class... Args>
+            static void* operator new(std::size_t size, const This&, std::allocator_arg_t, const Alloc& alloc, const Args&...);
+
+            static void operator delete(void* pointer, std::size_t size) noexcept;
+
+        private:
+            using deallocate_function = void (*)(void* pointer, std::size_t size) noexcept;
+
+            template <class Alloc>
+            static void* Allocate(const Alloc& alloc, std::size_t size);
+
+            template <class Alloc>
+            static void Deallocate(void* pointer, std::size_t size) noexcept;
+
+            static constexpr std::size_t DeallocateOffset(std::size_t size) noexcept;
+        };
+
+        template <class Yielded>
+        class generator_final_awaiter;
+
+        template <class Yielded>
+        class generator_copy_awaiter;
+
+        template <class Yielded, class Promise>
+        class generator_nested_awaiter;
+
+        /**
+         * @brief The part of a generator's promise that only depends on the type it yields.
+         *
+         * Generators that yield other generators with `elements_of` form a stack, with the outermost one at the bottom
+         * (the root). The root keeps track of the innermost generator that is running (the top), so that incrementing
+         * an iterator resumes the top directly, and every generator writes what it yields into the root. A nested
+         * generator that finishes transfers control straight back to its parent. So each element costs a single resume,
+         * no matter how deep the nesting is.
+         */
+        template <class Yielded>
+        class generator_promise_base
+        {
+        public:
+            std::suspend_always initial_suspend() const noexcept;
+            generator_final_awaiter<Yielded> final_suspend() noexcept;
+
+            std::suspend_always yield_value(Yielded val) noexcept;
+
+            generator_copy_awaiter<Yielded> yield_value(const std::remove_reference_t<Yielded>& lval)
+                requires (std::is_rvalue_reference_v<Yielded> &&
+                    std::constructible_from<std::remove_cvref_t<Yielded>, const std::remove_reference_t<Yielded>&>);
+
+            template <class U>
+            void await_transform(U&&) = delete;
+
+            void return_void() const noexcept;
+            void unhandled_exception();
+
+        protected:
+            template <class, class, class>
+            friend class StdReimpl::generator;
+
+            friend class generator_final_awaiter<Yielded>;
+            friend class generator_copy_awaiter<Yielded>;
+
+            template <class, class>
+            friend class generator_nested_awaiter;
+
+            // Only meaningful in the root: what was last yielded, and the innermost generator that is running.
+            std::add_pointer_t<Yielded> value = nullptr;
+            std::coroutine_handle<> top;
+
+            // Only meaningful in a nested generator: the generator that yielded it, and the exception that it exited
+            // with, which the parent rethrows.
+            generator_promise_base* parent = nullptr;
+            std::coroutine_handle<> parent_coroutine;
+            std::exception_ptr exception;
+
+            generator_promise_base* root = this;
+        };
+
+        /**
+         * @brief Resumes the parent of a nested generator when it finishes.
+         */
+        template <class Yielded>
+        class generator_final_awaiter
+        {
+        public:
+            bool await_ready() const noexcept;
+
+            template <class Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> coroutine) noexcept;
+
+            void await_resume() const noexcept;
+        };
+
+        /**
+         * @brief Yields a copy of an lvalue, for generators that yield rvalue references.
+         */
+        template <class Yielded>
+        class generator_copy_awaiter
+        {
+        public:
+            generator_copy_awaiter(const std::remove_reference_t<Yielded>& lval, generator_promise_base<Yielded>* inRoot);
+
+            bool await_ready() const noexcept;
+            void await_suspend(std::coroutine_handle<>) noexcept;
+            void await_resume() const noexcept;
+
+        private:
+            std::remove_cvref_t<Yielded> value;
+            generator_promise_base<Yielded>* root;
+        };
+
+        /**
+         * @brief Runs a nested generator in place of the one that yielded it, and owns its coroutine frame until the
+         *        parent resumes.
+         */
+        template <class Yielded, class Promise>
+        class generator_nested_awaiter
+        {
+        public:
+            template <class Ref, class V, class Allocator>
+            explicit generator_nested_awaiter(generator<Ref, V, Allocator>&& g) noexcept;
+
+            generator_nested_awaiter(const generator_nested_awaiter&) = delete;
+            generator_nested_awaiter& operator=(const generator_nested_awaiter&) = delete;
+            ~generator_nested_awaiter();
+
+            bool await_ready() const noexcept;
+
+            template <class ParentPromise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<ParentPromise> parentCoroutine) noexcept;
+
+            void await_resume();
+
+        private:
+            std::coroutine_handle<Promise> coroutine;
+        };
+    }
+
+    /**
+     * @brief A view of the values that a coroutine yields with `co_yield`, produced lazily as it's iterated.
+     *
+     * `co_yield ranges::elements_of(g)` yields every element of `g`. When `g` is another generator, it's resumed
+     * directly rather than through this one, so nesting generators doesn't make each element slower to get to.
+     *
+     * The coroutine frame is allocated with `Allocator`, or with the allocator that the coroutine is passed after
+     * `std::allocator_arg`, e.g., to put frames in an arena or pool rather than on the global heap.
+     *
+     * @see https://eel.is/c++draft/coro.generator
+     * @see https://cppreference.com/w/cpp/coroutine/generator
+     * @note A feature from the C++23 standard.
+     */
+    template <class Ref, class V, class Allocator>
+    class generator : public std::ranges::view_interface<generator<Ref, V, Allocator>>
+    {
+        using value = std::conditional_t<std::is_void_v<V>, std::remove_cvref_t<Ref>, V>;
+        using reference = std::conditional_t<std::is_void_v<V>, Ref&&, Ref>;
+        using yielded = std::conditional_t<std::is_reference_v<reference>, reference, const reference&>;
+
+        static_assert(std::same_as<std::remove_cvref_t<value>, value> && std::is_object_v<value>,
+            "generator's value type must be a cv-unqualified object type.");
+        static_assert(std::is_reference_v<reference> ||
+            (std::is_object_v<reference> && std::same_as<std::remove_cv_t<reference>, reference> &&
+                std::copy_constructible<reference>),
+            "generator's reference type must be a reference or a cv-unqualified, copyable object type.");
+        static_assert(std::common_reference_with<reference&&, value&> &&
+            std::common_reference_with<reference&&, const value&> &&
+            std::common_reference_with<const value&, const value&>,
+            "generator's reference and value types must have common references.");
+
+    public:
+        class promise_type;
+
+    private:
+        class iterator;
+
+    public:
+        generator(const generator&) = delete;
+        generator(generator&& other) noexcept;
+
+        ~generator();
+
+        generator& operator=(generator other) noexcept;
+
+        iterator begin();
+        std::default_sentinel_t end() const noexcept;
+
+    private:
+        template <class, class, class>
+        friend class generator;
+
+        template <class, class>
+        friend class Detail::generator_nested_awaiter;
+
+        explicit generator(std::coroutine_handle<promise_type> inCoroutine) noexcept;
+
+        std::coroutine_handle<promise_type> coroutine = nullptr;
+    };
+
+    template <class Ref, class V, class Allocator>
+    class generator<Ref, V, Allocator>::promise_type :
+        public Detail::generator_promise_base<yielded>,
+        public Detail::generator_promise_allocator<Allocator>
+    {
+    public:
+        generator get_return_object() noexcept;
+
+        using Detail::generator_promise_base<yielded>::yield_value;
+
+        template <class R2, class V2, class Alloc2, class Unused>
+            requires std::same_as<typename generator<R2, V2, Alloc2>::yielded, yielded>
+        Detail::generator_nested_awaiter<yielded, typename generator<R2, V2, Alloc2>::promise_type>
+            yield_value(ranges::elements_of<generator<R2, V2, Alloc2>&&, Unused> g) noexcept;
+
+        template <std::ranges::input_range R, class Alloc>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, yielded>
+        Detail::generator_nested_awaiter<yielded, typename generator<yielded, std::ranges::range_value_t<R>, Alloc>::promise_type>
+            yield_value(ranges::elements_of<R, Alloc> r);
+    };
+
+    template <class Ref, class V, class Allocator>
+    class generator<Ref, V, Allocator>::iterator
+    {
+    public:
+        using value_type = value;
+        using difference_type = std::ptrdiff_t;
+
+        iterator(iterator&& other) noexcept;
+        iterator& operator=(iterator&& other) noexcept;
+
+        reference operator*() const noexcept(std::is_nothrow_copy_constructible_v<reference>);
+
+        iterator& operator++();
+        void operator++(int);
+
+        friend bool operator==(const iterator& i, std::default_sentinel_t) noexcept
+        {
+            return i.coroutine.done();
+        }
+
+    private:
+        friend class generator;
+
+        explicit iterator(std::coroutine_handle<promise_type> inCoroutine) noexcept;
+
+        std::coroutine_handle<promise_type> coroutine;
+    };
+}
+
+#include <CppUtils/StdReimpl/generator.inl>
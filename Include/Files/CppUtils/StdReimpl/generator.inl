@@ -0,0 +1,412 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/generator.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <new>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        constexpr std::size_t generator_align_up(std::size_t size, std::size_t alignment) noexcept
+        {
+            return (size + alignment - 1) / alignment * alignment;
+        }
+
+        template <class Allocator>
+        void* generator_promise_allocator<Allocator>::operator new(std::size_t size)
+            requires std::default_initializable<block_allocator>
+        {
+            return Allocate(block_allocator(), size);
+        }
+
+        template <class Allocator>
+        template <class Alloc, class... Args>
+            requires std::convertible_to<const Alloc&, Allocator>
+        void* generator_promise_allocator<Allocator>::operator new(std::size_t size, std::allocator_arg_t, const Alloc& alloc, const Args&...)
+        {
+            return Allocate(block_allocator(static_cast<Allocator>(alloc)), size);
+        }
+
+        template <class Allocator>
+        template <class This, class Alloc, class... Args>
+            requires std::convertible_to<const Alloc&, Allocator>
+        void* generator_promise_allocator<Allocator>::operator new(std::size_t size, const This&, std::allocator_arg_t, const Alloc& alloc, const Args&...)
+        {
+            return Allocate(block_allocator(static_cast<Allocator>(alloc)), size);
+        }
+
+        template <class Allocator>
+        void generator_promise_allocator<Allocator>::operator delete(void* pointer, std::size_t size) noexcept
+        {
+            generator_frame_block* blocks = static_cast<generator_frame_block*>(pointer);
+            if constexpr (stores_allocator)
+            {
+                block_allocator& stored = *std::launder(reinterpret_cast<block_allocator*>(static_cast<unsigned char*>(pointer) + AllocatorOffset(size)));
+                block_allocator alloc(std::move(stored));
+                stored.~block_allocator();
+                std::allocator_traits<block_allocator>::deallocate(alloc, blocks, BlockCount(size));
+            }
+            else
+            {
+                block_allocator alloc;
+                std::allocator_traits<block_allocator>::deallocate(alloc, blocks, BlockCount(size));
+            }
+        }
+
+        template <class Allocator>
+        void* generator_promise_allocator<Allocator>::Allocate(block_allocator alloc, std::size_t size)
+        {
+            void* pointer = std::to_address(std::allocator_traits<block_allocator>::allocate(alloc, BlockCount(size)));
+            if constexpr (stores_allocator)
+            {
+                ::new (static_cast<unsigned char*>(pointer) + AllocatorOffset(size)) block_allocator(std::move(alloc));
+            }
+            return pointer;
+        }
+
+        template <class Allocator>
+        constexpr std::size_t generator_promise_allocator<Allocator>::AllocatorOffset(std::size_t size) noexcept
+        {
+            return generator_align_up(size, alignof(block_allocator));
+        }
+
+        template <class Allocator>
+        constexpr std::size_t generator_promise_allocator<Allocator>::BlockCount(std::size_t size) noexcept
+        {
+            const std::size_t bytes = stores_allocator ? AllocatorOffset(size) + sizeof(block_allocator) : size;
+            return generator_align_up(bytes, sizeof(generator_frame_block)) / sizeof(generator_frame_block);
+        }
+
+        inline void* generator_promise_allocator<void>::operator new(std::size_t size)
+        {
+            return Allocate(std::allocator<void>(), size);
+        }
+
+        template <class Alloc, class... Args>
+        void* generator_promise_allocator<void>::operator new(std::size_t size, std::allocator_arg_t, const Alloc& alloc, const Args&...)
+        {
+            return Allocate(alloc, size);
+        }
+
+        template <class This, class Alloc, class... Args>
+        void* generator_promise_allocator<void>::operator new(std::size_t size, const This&, std::allocator_arg_t, const Alloc& alloc, const Args&...)
+        {
+            return Allocate(alloc, size);
+        }
+
+        inline void generator_promise_allocator<void>::operator delete(void* pointer, std::size_t size) noexcept
+        {
+            const deallocate_function deallocate = *std::launder(reinterpret_cast<deallocate_function*>(static_cast<unsigned char*>(pointer) + DeallocateOffset(size)));
+            deallocate(pointer, size);
+        }
+
+        template <class Alloc>
+        void* generator_promise_allocator<void>::Allocate(const Alloc& alloc, std::size_t size)
+        {
+            using block_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<generator_frame_block>;
+            static_assert(std::is_pointer_v<typename std::allocator_traits<block_allocator>::pointer>,
+                "generator's allocator must use raw pointers.");
+
+            const std::size_t allocatorOffset = generator_align_up(DeallocateOffset(size) + sizeof(deallocate_function), alignof(block_allocator));
+            const std::size_t count = generator_align_up(allocatorOffset + sizeof(block_allocator), sizeof(generator_frame_block)) / sizeof(generator_frame_block);
+
+            block_allocator blockAlloc(alloc);
+            unsigned char* pointer = reinterpret_cast<unsigned char*>(std::allocator_traits<block_allocator>::allocate(blockAlloc, count));
+            ::new (pointer + DeallocateOffset(size)) deallocate_function(&Deallocate<block_allocator>);
+            ::new (pointer + allocatorOffset) block_allocator(std::move(blockAlloc));
+            return pointer;
+        }
+
+        template <class Alloc>
+        void generator_promise_allocator<void>::Deallocate(void* pointer, std::size_t size) noexcept
+        {
+            const std::size_t allocatorOffset = generator_align_up(DeallocateOffset(size) + sizeof(deallocate_function), alignof(Alloc));
+            const std::size_t count = generator_align_up(allocatorOffset + sizeof(Alloc), sizeof(generator_frame_block)) / sizeof(generator_frame_block);
+
+            Alloc& stored = *std::launder(reinterpret_cast<Alloc*>(static_cast<unsigned char*>(pointer) + allocatorOffset));
+            Alloc alloc(std::move(stored));
+            stored.~Alloc();
+            std::allocator_traits<Alloc>::deallocate(alloc, static_cast<generator_frame_block*>(pointer), count);
+        }
+
+        constexpr std::size_t generator_promise_allocator<void>::DeallocateOffset(std::size_t size) noexcept
+        {
+            return generator_align_up(size, alignof(deallocate_function));
+        }
+
+        template <class Yielded>
+        std::suspend_always generator_promise_base<Yielded>::initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        template <class Yielded>
+        generator_final_awaiter<Yielded> generator_promise_base<Yielded>::final_suspend() noexcept
+        {
+            return {};
+        }
+
+        template <class Yielded>
+        std::suspend_always generator_promise_base<Yielded>::yield_value(Yielded val) noexcept
+        {
+            root->value = std::addressof(val);
+            return {};
+        }
+
+        template <class Yielded>
+        generator_copy_awaiter<Yielded> generator_promise_base<Yielded>::yield_value(const std::remove_reference_t<Yielded>& lval)
+            requires (std::is_rvalue_reference_v<Yielded> &&
+                std::constructible_from<std::remove_cvref_t<Yielded>, const std::remove_reference_t<Yielded>&>)
+        {
+            return generator_copy_awaiter<Yielded>(lval, root);
+        }
+
+        template <class Yielded>
+        void generator_promise_base<Yielded>::return_void() const noexcept
+        {
+        }
+
+        template <class Yielded>
+        void generator_promise_base<Yielded>::unhandled_exception()
+        {
+            if (parent != nullptr)
+            {
+                // The parent rethrows it once this generator has finished and control is back in the parent.
+                exception = std::current_exception();
+                return;
+            }
+
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            throw;
+#else
+            std::abort();
+#endif
+        }
+
+        template <class Yielded>
+        bool generator_final_awaiter<Yielded>::await_ready() const noexcept
+        {
+            return false;
+        }
+
+        template <class Yielded>
+        template <class Promise>
+        std::coroutine_handle<> generator_final_awaiter<Yielded>::await_suspend(std::coroutine_handle<Promise> coroutine) noexcept
+        {
+            generator_promise_base<Yielded>& promise = coroutine.promise();
+            if (promise.parent == nullptr)
+            {
+                return std::noop_coroutine();
+            }
+
+            promise.root->top = promise.parent_coroutine;
+            return promise.parent_coroutine;
+        }
+
+        template <class Yielded>
+        void generator_final_awaiter<Yielded>::await_resume() const noexcept
+        {
+        }
+
+        template <class Yielded>
+        generator_copy_awaiter<Yielded>::generator_copy_awaiter(const std::remove_reference_t<Yielded>& lval, generator_promise_base<Yielded>* inRoot)
+            : value(lval), root(inRoot)
+        {
+        }
+
+        template <class Yielded>
+        bool generator_copy_awaiter<Yielded>::await_ready() const noexcept
+        {
+            return false;
+        }
+
+        template <class Yielded>
+        void generator_copy_awaiter<Yielded>::await_suspend(std::coroutine_handle<>) noexcept
+        {
+            root->value = std::addressof(value);
+        }
+
+        template <class Yielded>
+        void generator_copy_awaiter<Yielded>::await_resume() const noexcept
+        {
+        }
+
+        template <class Yielded, class Promise>
+        template <class Ref, class V, class Allocator>
+        generator_nested_awaiter<Yielded, Promise>::generator_nested_awaiter(generator<Ref, V, Allocator>&& g) noexcept
+            : coroutine(std::exchange(g.coroutine, nullptr))
+        {
+        }
+
+        template <class Yielded, class Promise>
+        generator_nested_awaiter<Yielded, Promise>::~generator_nested_awaiter()
+        {
+            if (coroutine)
+            {
+                coroutine.destroy();
+            }
+        }
+
+        template <class Yielded, class Promise>
+        bool generator_nested_awaiter<Yielded, Promise>::await_ready() const noexcept
+        {
+            return !coroutine;
+        }
+
+        template <class Yielded, class Promise>
+        template <class ParentPromise>
+        std::coroutine_handle<> generator_nested_awaiter<Yielded, Promise>::await_suspend(std::coroutine_handle<ParentPromise> parentCoroutine) noexcept
+        {
+            generator_promise_base<Yielded>& nested = coroutine.promise();
+            generator_promise_base<Yielded>& parent = parentCoroutine.promise();
+
+            nested.root = parent.root;
+            nested.parent = &parent;
+            nested.parent_coroutine = parentCoroutine;
+            parent.root->top = coroutine;
+            return coroutine;
+        }
+
+        template <class Yielded, class Promise>
+        void generator_nested_awaiter<Yielded, Promise>::await_resume()
+        {
+            if (coroutine)
+            {
+                generator_promise_base<Yielded>& nested = coroutine.promise();
+                if (nested.exception)
+                {
+                    std::rethrow_exception(std::move(nested.exception));
+                }
+            }
+        }
+    }
+
+    template <class Ref, class V, class Allocator>
+    generator<Ref, V, Allocator>::generator(generator&& other) noexcept
+        : coroutine(std::exchange(other.coroutine, nullptr))
+    {
+    }
+
+    template <class Ref, class V, class Allocator>
+    generator<Ref, V, Allocator>::generator(std::coroutine_handle<promise_type> inCoroutine) noexcept
+        : coroutine(inCoroutine)
+    {
+    }
+
+    template <class Ref, class V, class Allocator>
+    generator<Ref, V, Allocator>::~generator()
+    {
+        if (coroutine)
+        {
+            coroutine.destroy();
+        }
+    }
+
+    template <class Ref, class V, class Allocator>
+    generator<Ref, V, Allocator>& generator<Ref, V, Allocator>::operator=(generator other) noexcept
+    {
+        std::swap(coroutine, other.coroutine);
+        return *this;
+    }
+
+    template <class Ref, class V, class Allocator>
+    typename generator<Ref, V, Allocator>::iterator generator<Ref, V, Allocator>::begin()
+    {
+        assert(coroutine);
+
+        coroutine.resume();
+        return iterator(coroutine);
+    }
+
+    template <class Ref, class V, class Allocator>
+    std::default_sentinel_t generator<Ref, V, Allocator>::end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+
+    template <class Ref, class V, class Allocator>
+    generator<Ref, V, Allocator> generator<Ref, V, Allocator>::promise_type::get_return_object() noexcept
+    {
+        const std::coroutine_handle<promise_type> handle = std::coroutine_handle<promise_type>::from_promise(*this);
+        this->top = handle;
+        return generator(handle);
+    }
+
+    template <class Ref, class V, class Allocator>
+    template <class R2, class V2, class Alloc2, class Unused>
+        requires std::same_as<typename generator<R2, V2, Alloc2>::yielded, typename generator<Ref, V, Allocator>::yielded>
+    Detail::generator_nested_awaiter<typename generator<Ref, V, Allocator>::yielded, typename generator<R2, V2, Alloc2>::promise_type>
+        generator<Ref, V, Allocator>::promise_type::yield_value(ranges::elements_of<generator<R2, V2, Alloc2>&&, Unused> g) noexcept
+    {
+        return Detail::generator_nested_awaiter<yielded, typename generator<R2, V2, Alloc2>::promise_type>(std::move(g.range));
+    }
+
+    template <class Ref, class V, class Allocator>
+    template <std::ranges::input_range R, class Alloc>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, typename generator<Ref, V, Allocator>::yielded>
+    Detail::generator_nested_awaiter<typename generator<Ref, V, Allocator>::yielded,
+        typename generator<typename generator<Ref, V, Allocator>::yielded, std::ranges::range_value_t<R>, Alloc>::promise_type>
+        generator<Ref, V, Allocator>::promise_type::yield_value(ranges::elements_of<R, Alloc> r)
+    {
+        using nested_generator = generator<yielded, std::ranges::range_value_t<R>, Alloc>;
+
+        auto nested = [](std::allocator_arg_t, Alloc, std::ranges::iterator_t<R> i, std::ranges::sentinel_t<R> s) -> nested_generator
+        {
+            for (; i != s; ++i)
+            {
+                co_yield static_cast<yielded>(*i);
+            }
+        };
+        return Detail::generator_nested_awaiter<yielded, typename nested_generator::promise_type>(
+            nested(std::allocator_arg, r.allocator, std::ranges::begin(r.range), std::ranges::end(r.range)));
+    }
+
+    template <class Ref, class V, class Allocator>
+    generator<Ref, V, Allocator>::iterator::iterator(std::coroutine_handle<promise_type> inCoroutine) noexcept
+        : coroutine(inCoroutine)
+    {
+    }
+
+    template <class Ref, class V, class Allocator>
+    generator<Ref, V, Allocator>::iterator::iterator(iterator&& other) noexcept
+        : coroutine(std::exchange(other.coroutine, nullptr))
+    {
+    }
+
+    template <class Ref, class V, class Allocator>
+    typename generator<Ref, V, Allocator>::iterator& generator<Ref, V, Allocator>::iterator::operator=(iterator&& other) noexcept
+    {
+        coroutine = std::exchange(other.coroutine, nullptr);
+        return *this;
+    }
+
+    template <class Ref, class V, class Allocator>
+    typename generator<Ref, V, Allocator>::reference generator<Ref, V, Allocator>::iterator::operator*() const
+        noexcept(std::is_nothrow_copy_constructible_v<reference>)
+    {
+        assert(!coroutine.done());
+
+        return static_cast<reference>(*coroutine.promise().value);
+    }
+
+    template <class Ref, class V, class Allocator>
+    typename generator<Ref, V, Allocator>::iterator& generator<Ref, V, Allocator>::iterator::operator++()
+    {
+        assert(!coroutine.done());
+
+        // Resume the innermost generator directly, rather than each generator between it and this one.
+        coroutine.promise().top.resume();
+        return *this;
+    }
+
+    template <class Ref, class V, class Allocator>
+    void generator<Ref, V, Allocator>::iterator::operator++(int)
+    {
+        ++*this;
+    }
+}
@@ -0,0 +1,480 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/concepts.h>
+#include <CppUtils/StdReimpl/utility.h>
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+
+namespace StdReimpl
+{
+    template <class T, class Allocator = std::allocator<T>>
+    class hive;
+
+    /**
+     * @brief The least and most elements that a block of a `hive` may hold.
+     * @see https://eel.is/c++draft/hive.syn
+     * @note A feature from the C++26 standard.
+     */
+    struct hive_limits
+    {
+        std::size_t min;
+        std::size_t max;
+
+        constexpr hive_limits(std::size_t minimum, std::size_t maximum) noexcept
+            : min(minimum)
+            , max(maximum)
+        {
+        }
+    };
+
+    namespace Detail
+    {
+        /**
+         * @brief The type of a block's skipfield entries and of the indices in its free list, which is what limits a
+         *        block to 65535 elements.
+         */
+        using hive_skipfield_t = std::uint16_t;
+
+        /**
+         * @brief Ends a block's free list. Never an index, since a block's last index is at most 65534.
+         */
+        inline constexpr hive_skipfield_t hive_no_index = UINT16_MAX;
+
+        /**
+         * @brief What the first slot of an erased run holds instead of an element: the runs before and after it in
+         *        its block's free list.
+         */
+        struct hive_free_run
+        {
+            hive_skipfield_t previous;
+            hive_skipfield_t next;
+        };
+
+        /**
+         * @brief Storage for either an element or a `hive_free_run`.
+         */
+        template <class T>
+        struct hive_slot
+        {
+            alignas(T) alignas(hive_free_run) std::byte bytes[sizeof(T) < sizeof(hive_free_run) ? sizeof(hive_free_run) : sizeof(T)];
+        };
+
+        /**
+         * @brief A block of a `hive`'s elements, and the bookkeeping that lets it be iterated and reused.
+         *
+         *        The skipfield has an entry per slot, plus one past the end that is always zero. It's a low-complexity
+         *        jump-counting skipfield: an element's entry is zero, and the first and last entries of a run of erased
+         *        slots are the run's length. So moving forward from a slot means adding one plus the next entry, and
+         *        moving back means subtracting one plus the previous entry, however long the run of erased slots that's
+         *        jumped is. The entries inside a run are never read.
+         *
+         *        Each run of erased slots is in the block's free list, linked through its first slot.
+         */
+        template <class T>
+        struct hive_group
+        {
+            hive_slot<T>* slots;
+            hive_slot<T>* slots_end;
+            hive_skipfield_t* skipfield;
+            hive_group* previous;
+            hive_group* next;
+
+            // The blocks that have erased runs, which insertion reuses first.
+            hive_group* previous_with_erasures;
+            hive_group* next_with_erasures;
+
+            // Increases from the first block to the last, to order iterators in different blocks.
+            std::size_t number;
+            std::size_t capacity;
+            std::size_t size;
+            hive_skipfield_t free_list_head;
+
+            /**
+             * @brief The element in `slot`, which must have been constructed.
+             */
+            static T* Element(hive_slot<T>* slot) noexcept;
+
+            /**
+             * @brief The free-list links in the first slot of an erased run.
+             */
+            hive_free_run& FreeRun(std::size_t index) noexcept;
+
+            void SetFreeRun(std::size_t index, hive_free_run run) noexcept;
+        };
+
+        template <class T, bool IsConst>
+        class hive_iterator
+        {
+        public:
+            using iterator_concept = std::bidirectional_iterator_tag;
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<IsConst, const T*, T*>;
+            using reference = std::conditional_t<IsConst, const T&, T&>;
+
+            hive_iterator() noexcept = default;
+
+            template <bool OtherIsConst>
+                requires (IsConst && !OtherIsConst)
+            hive_iterator(const hive_iterator<T, OtherIsConst>& other) noexcept
+                : group(other.group)
+                , slot(other.slot)
+                , skip(other.skip)
+            {
+            }
+
+            reference operator*() const noexcept;
+            pointer operator->() const noexcept;
+
+            hive_iterator& operator++() noexcept;
+            hive_iterator operator++(int) noexcept;
+            hive_iterator& operator--() noexcept;
+            hive_iterator operator--(int) noexcept;
+
+            friend bool operator==(const hive_iterator& x, const hive_iterator& y) noexcept
+            {
+                return x.slot == y.slot;
+            }
+
+            friend std::strong_ordering operator<=>(const hive_iterator& x, const hive_iterator& y) noexcept
+            {
+                if (x.group != y.group)
+                {
+                    return x.group->number <=> y.group->number;
+                }
+                return std::compare_three_way()(x.slot, y.slot);
+            }
+
+        private:
+            template <class, class>
+            friend class StdReimpl::hive;
+            friend class hive_iterator<T, !IsConst>;
+
+            hive_iterator(hive_group<T>* inGroup, hive_slot<T>* inSlot, hive_skipfield_t* inSkip) noexcept;
+
+            hive_group<T>* group = nullptr;
+            hive_slot<T>* slot = nullptr;
+            hive_skipfield_t* skip = nullptr;
+        };
+
+        /**
+         * @brief Calls `rollback` when the scope exits through an exception, unless released first. How `hive` undoes
+         *        the bookkeeping it did ahead of constructing an element, when the construction throws.
+         */
+        template <class F>
+        class hive_rollback_guard
+        {
+        public:
+            explicit hive_rollback_guard(F inRollback) noexcept
+                : rollback(std::move(inRollback))
+            {
+            }
+
+            hive_rollback_guard(const hive_rollback_guard&) = delete;
+            hive_rollback_guard& operator=(const hive_rollback_guard&) = delete;
+
+            ~hive_rollback_guard()
+            {
+                if (active)
+                {
+                    rollback();
+                }
+            }
+
+            void Release() noexcept
+            {
+                active = false;
+            }
+
+        private:
+            F rollback;
+            bool active = true;
+        };
+
+        /**
+         * @brief Thrown when block capacity limits are outside the hard limits, or a block is outside the limits it's
+         *        spliced into. Aborts instead when exceptions are disabled.
+         */
+        [[noreturn]] inline void hive_throw_length_error(const char* message);
+    }
+
+    /**
+     * @brief A container of elements that keep their address for as long as they're in it, with O(1) insertion and
+     *        erasure. For pools of objects that come and go all the time, like entities and particles, where
+     *        `std::list` is slow to iterate and `std::vector` moves elements when erasing, which invalidates handles to
+     *        them.
+     *
+     *        Elements are stored in a list of blocks, which grow geometrically up to `block_capacity_limits().max`.
+     *        Erasing an element leaves its slot empty, and inserting fills an empty slot before growing, so where an
+     *        element is inserted is unspecified. Iteration jumps over each run of erased slots in one step, however
+     *        long it is, so it costs the same whatever was erased. See `Detail::hive_group`.
+     *
+     *        Blocks that erasure leaves empty are kept as reserved capacity, which `trim_capacity` frees.
+     * @see https://eel.is/c++draft/hive
+     * @see https://cppreference.com/w/cpp/container/hive
+     * @note A feature from the C++26 standard. `from_range_t` constructors are left out, since `std::from_range_t` is
+     *       from C++23; use `insert_range` instead. The allocator must use raw pointers.
+     */
+    template <class T, class Allocator>
+    class hive
+    {
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using pointer = typename std::allocator_traits<Allocator>::pointer;
+        using const_pointer = typename std::allocator_traits<Allocator>::const_pointer;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator = Detail::hive_iterator<T, false>;
+        using const_iterator = Detail::hive_iterator<T, true>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static_assert(std::is_same_v<typename std::allocator_traits<Allocator>::value_type, T>,
+            "hive's allocator must allocate T.");
+        static_assert(std::is_pointer_v<pointer>, "hive's allocator must use raw pointers.");
+
+        // Construct/copy/destroy.
+
+        hive() noexcept(noexcept(Allocator()));
+        explicit hive(const Allocator& alloc) noexcept;
+        explicit hive(hive_limits blockLimits, const Allocator& alloc = Allocator());
+        explicit hive(size_type n, const Allocator& alloc = Allocator());
+        hive(size_type n, hive_limits blockLimits, const Allocator& alloc = Allocator());
+        hive(size_type n, const T& value, const Allocator& alloc = Allocator());
+        hive(size_type n, const T& value, hive_limits blockLimits, const Allocator& alloc = Allocator());
+        template <std::input_iterator InputIterator>
+        hive(InputIterator first, InputIterator last, const Allocator& alloc = Allocator());
+        template <std::input_iterator InputIterator>
+        hive(InputIterator first, InputIterator last, hive_limits blockLimits, const Allocator& alloc = Allocator());
+        hive(std::initializer_list<T> il, const Allocator& alloc = Allocator());
+        hive(std::initializer_list<T> il, hive_limits blockLimits, const Allocator& alloc = Allocator());
+        hive(const hive& x);
+        hive(hive&& x) noexcept;
+        hive(const hive& x, const std::type_identity_t<Allocator>& alloc);
+        hive(hive&& x, const std::type_identity_t<Allocator>& alloc);
+        ~hive();
+
+        hive& operator=(const hive& x);
+        hive& operator=(hive&& x) noexcept(std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value
+            || std::allocator_traits<Allocator>::is_always_equal::value);
+        hive& operator=(std::initializer_list<T> il);
+
+        template <std::input_iterator InputIterator>
+        void assign(InputIterator first, InputIterator last);
+        template <Detail::container_compatible_range<T> R>
+        void assign_range(R&& rg);
+        void assign(size_type n, const T& value);
+        void assign(std::initializer_list<T> il);
+
+        allocator_type get_allocator() const noexcept;
+
+        // Iterators.
+
+        iterator begin() noexcept;
+        const_iterator begin() const noexcept;
+        iterator end() noexcept;
+        const_iterator end() const noexcept;
+        reverse_iterator rbegin() noexcept;
+        const_reverse_iterator rbegin() const noexcept;
+        reverse_iterator rend() noexcept;
+        const_reverse_iterator rend() const noexcept;
+
+        const_iterator cbegin() const noexcept;
+        const_iterator cend() const noexcept;
+        const_reverse_iterator crbegin() const noexcept;
+        const_reverse_iterator crend() const noexcept;
+
+        // Size/capacity.
+
+        bool empty() const noexcept;
+        size_type size() const noexcept;
+        size_type max_size() const noexcept;
+        size_type capacity() const noexcept;
+        void reserve(size_type n);
+        void shrink_to_fit();
+        void trim_capacity() noexcept;
+        void trim_capacity(size_type n) noexcept;
+        hive_limits block_capacity_limits() const noexcept;
+        static constexpr hive_limits block_capacity_default_limits() noexcept;
+        static constexpr hive_limits block_capacity_hard_limits() noexcept;
+        void reshape(hive_limits blockLimits);
+
+        // Modifiers.
+
+        template <class... Args>
+        iterator emplace(Args&&... args);
+        template <class... Args>
+        iterator emplace_hint(const_iterator hint, Args&&... args);
+        iterator insert(const T& x);
+        iterator insert(T&& x);
+        iterator insert(const_iterator hint, const T& x);
+        iterator insert(const_iterator hint, T&& x);
+        void insert(std::initializer_list<T> il);
+        template <Detail::container_compatible_range<T> R>
+        void insert_range(R&& rg);
+        template <std::input_iterator InputIterator>
+        void insert(InputIterator first, InputIterator last);
+        void insert(size_type n, const T& x);
+
+        iterator erase(const_iterator position);
+        iterator erase(const_iterator first, const_iterator last);
+        void swap(hive& x) noexcept(std::allocator_traits<Allocator>::propagate_on_container_swap::value
+            || std::allocator_traits<Allocator>::is_always_equal::value);
+        void clear() noexcept;
+
+        // Hive operations.
+
+        void splice(hive& x);
+        void splice(hive&& x);
+        template <class BinaryPredicate = std::equal_to<T>>
+        size_type unique(BinaryPredicate binaryPred = BinaryPredicate());
+        template <class Compare = std::less<T>>
+        void sort(Compare comp = Compare());
+
+        iterator get_iterator(const_pointer p) noexcept;
+        const_iterator get_iterator(const_pointer p) const noexcept;
+
+        friend void swap(hive& x, hive& y) noexcept(noexcept(x.swap(y)))
+        {
+            x.swap(y);
+        }
+
+    private:
+        using group_type = Detail::hive_group<T>;
+        using slot_type = Detail::hive_slot<T>;
+        using allocator_traits = std::allocator_traits<Allocator>;
+        using group_allocator = typename allocator_traits::template rebind_alloc<group_type>;
+        using slot_allocator = typename allocator_traits::template rebind_alloc<slot_type>;
+
+        static void CheckLimits(hive_limits blockLimits);
+
+        static iterator MutableIterator(const_iterator position) noexcept;
+
+        static iterator FirstIn(group_type* group) noexcept;
+
+        /**
+         * @brief The capacity of the next block to allocate, which is the size of the hive so far, so that the
+         *        capacity grows geometrically.
+         */
+        size_type NextGroupCapacity() const noexcept;
+
+        /**
+         * @brief The number of slots past a block's elements that its skipfield takes up, since both are allocated
+         *        together.
+         */
+        static constexpr size_type SkipfieldSlots(size_type capacity) noexcept;
+
+        /**
+         * @brief Allocates a block with a zeroed skipfield, which is counted in `capacity()` from then on.
+         */
+        group_type* AllocateGroup(size_type capacity);
+
+        void DeallocateGroup(group_type* group) noexcept;
+
+        /**
+         * @brief Takes a reserved block, or allocates one, for the next element to be appended to.
+         */
+        group_type* AcquireGroup();
+
+        /**
+         * @brief Makes a reserved block of `group`, whose elements must all have been destroyed.
+         */
+        void ReserveGroup(group_type* group) noexcept;
+
+        /**
+         * @brief Appends `group`, which has the single element in its first slot, as the last block.
+         */
+        void LinkBackGroup(group_type* group) noexcept;
+
+        /**
+         * @brief Unlinks `group`, whose last element was just erased, and reserves it.
+         */
+        void RetireGroup(group_type* group) noexcept;
+
+        void LinkWithErasures(group_type* group) noexcept;
+        void UnlinkWithErasures(group_type* group) noexcept;
+
+        /**
+         * @brief Takes the erased run that starts at `start` out of its block's free list.
+         */
+        void UnlinkRun(group_type* group, size_type start) noexcept;
+
+        /**
+         * @brief Marks `count` slots from `index`, whose elements were destroyed or never constructed, as erased. Joins
+         *        them with any erased runs right before and after them, and keeps the free list up to date.
+         */
+        void MarkErased(group_type* group, size_type index, size_type count) noexcept;
+
+        /**
+         * @brief Constructs an element in the last slot of the first erased run of the first block that has one.
+         */
+        template <class... Args>
+        iterator EmplaceIntoErased(Args&&... args);
+
+        /**
+         * @brief Constructs an element past the last one, in a new block if the last block is full.
+         */
+        template <class... Args>
+        iterator EmplaceBack(Args&&... args);
+
+        template <class... Args>
+        void ConstructAt(slot_type* slot, Args&&... args);
+
+        /**
+         * @brief Replaces our elements with `x`'s, moved one by one into blocks within our own limits.
+         */
+        void ReplaceWithMovedElements(hive& x);
+
+        /**
+         * @brief Moves the elements into new blocks within our limits, with no erased slots between them.
+         */
+        void Reallocate();
+
+        void DestroyElements() noexcept;
+
+        /**
+         * @brief Destroys the elements, frees all blocks, and leaves us empty.
+         */
+        void DeallocateAll() noexcept;
+
+        /**
+         * @brief Takes `x`'s blocks and limits, leaving it empty with no capacity.
+         */
+        void TakeBlocks(hive& x) noexcept;
+
+        iterator begin_iterator;
+        iterator end_iterator;
+        group_type* groups_with_erasures = nullptr;
+        group_type* reserved_groups = nullptr;
+        size_type stored_size = 0;
+        size_type stored_capacity = 0;
+        hive_limits limits = block_capacity_default_limits();
+        CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Allocator allocator;
+    };
+
+    /**
+     * @see https://eel.is/c++draft/hive.erasure
+     */
+    template <class T, class Allocator, class U = T>
+    typename hive<T, Allocator>::size_type erase(hive<T, Allocator>& c, const U& value);
+
+    template <class T, class Allocator, class Predicate>
+    typename hive<T, Allocator>::size_type erase_if(hive<T, Allocator>& c, Predicate pred);
+}
+
+#include <CppUtils/StdReimpl/hive.inl>
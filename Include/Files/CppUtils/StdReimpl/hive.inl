@@ -0,0 +1,1321 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/hive.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        template <class T>
+        T* hive_group<T>::Element(hive_slot<T>* slot) noexcept
+        {
+            return std::launder(reinterpret_cast<T*>(slot->bytes));
+        }
+
+        template <class T>
+        hive_free_run& hive_group<T>::FreeRun(std::size_t index) noexcept
+        {
+            return *std::launder(reinterpret_cast<hive_free_run*>(slots[index].bytes));
+        }
+
+        template <class T>
+        void hive_group<T>::SetFreeRun(std::size_t index, hive_free_run run) noexcept
+        {
+            std::construct_at(reinterpret_cast<hive_free_run*>(slots[index].bytes), run);
+        }
+
+        template <class T, bool IsConst>
+        hive_iterator<T, IsConst>::hive_iterator(hive_group<T>* inGroup, hive_slot<T>* inSlot, hive_skipfield_t* inSkip) noexcept
+            : group(inGroup)
+            , slot(inSlot)
+            , skip(inSkip)
+        {
+        }
+
+        template <class T, bool IsConst>
+        typename hive_iterator<T, IsConst>::reference hive_iterator<T, IsConst>::operator*() const noexcept
+        {
+            return *hive_group<T>::Element(slot);
+        }
+
+        template <class T, bool IsConst>
+        typename hive_iterator<T, IsConst>::pointer hive_iterator<T, IsConst>::operator->() const noexcept
+        {
+            return hive_group<T>::Element(slot);
+        }
+
+        template <class T, bool IsConst>
+        hive_iterator<T, IsConst>& hive_iterator<T, IsConst>::operator++() noexcept
+        {
+            // The next slot's entry is zero if it holds an element, or else the length of the erased run it starts, so
+            // this lands on the next element without looking at the slots in between.
+            const std::size_t jump = 1u + skip[1];
+            slot += jump;
+            skip += jump;
+
+            // Only the last block stops short of its end, at our end.
+            if (slot == group->slots_end && group->next != nullptr)
+            {
+                group = group->next;
+                const std::size_t first = group->skipfield[0];
+                slot = group->slots + first;
+                skip = group->skipfield + first;
+            }
+            return *this;
+        }
+
+        template <class T, bool IsConst>
+        hive_iterator<T, IsConst> hive_iterator<T, IsConst>::operator++(int) noexcept
+        {
+            hive_iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        template <class T, bool IsConst>
+        hive_iterator<T, IsConst>& hive_iterator<T, IsConst>::operator--() noexcept
+        {
+            // The previous slot's entry is zero if it holds an element, or else the length of the erased run it ends.
+            const std::size_t index = static_cast<std::size_t>(slot - group->slots);
+            if (index != 0)
+            {
+                const std::size_t jump = 1u + skip[-1];
+                if (jump <= index)
+                {
+                    slot -= jump;
+                    skip -= jump;
+                    return *this;
+                }
+            }
+
+            // Every block before the last is used up to its end, and has an element.
+            group = group->previous;
+            const std::size_t lastIndex = group->capacity - 1;
+            const std::size_t previous = lastIndex - group->skipfield[lastIndex];
+            slot = group->slots + previous;
+            skip = group->skipfield + previous;
+            return *this;
+        }
+
+        template <class T, bool IsConst>
+        hive_iterator<T, IsConst> hive_iterator<T, IsConst>::operator--(int) noexcept
+        {
+            hive_iterator old = *this;
+            --*this;
+            return old;
+        }
+
+        [[noreturn]] inline void hive_throw_length_error(const char* message)
+        {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            throw std::length_error(message);
+#else
+            static_cast<void>(message);
+            std::abort();
+#endif
+        }
+    }
+
+    template <class T, class Allocator>
+    hive<T, Allocator>::hive() noexcept(noexcept(Allocator()))
+        : hive(Allocator())
+    {
+    }
+
+    template <class T, class Allocator>
+    hive<T, Allocator>::hive(const Allocator& alloc) noexcept
+        : allocator(alloc)
+    {
+    }
+
+    // The constructors below delegate to the one taking an allocator so that, if they throw part way through, our
+    // destructor cleans up whatever was constructed.
+
+    template <class T, class Allocator>
+    hive<T, Allocator>::hive(hive_limits blockLimits, const Allocator& alloc)
+        : hive(alloc)
+    {
+        CheckLimits(blockLimits);
+        limits = blockLimits;
+    }
+
+    template <class T, class Allocator>
+    hive<T, Allocator>::hive(size_type n, const Allocator& alloc)
+        : hive(n, block_capacity_default_limits(), alloc)
+    {
+    }
+
+    template <class T, class Allocator>
+    hive<T, Allocator>::hive(size_type n, hive_limits blockLimits, const Allocator& alloc)
+        : hive(blockLimits, alloc)
+    {
+        reserve(n);
+        for (; n != 0; --n)
+        {
+            emplace();
+        }
+    }
+
+    template <class T, class Allocator>
+    hive<T, Allocator>::hive(size_type n, const T& value, const Allocator& alloc)
+        : hive(n, value, block_capacity_default_limits(), alloc)
+    {
+    }
+
+    template <class T, class Allocator>
+    hive<T, Allocator>::hive(size_type n, const T& value, hive_limits blockLimits, const Allocator& alloc)
+        : hive(blockLimits, alloc)
+    {
+        insert(n, value);
+    }
+
+    template <class T, class Allocator>
+    template <std::input_iterator InputIterator>
+    hive<T, Allocator>::hive(InputIterator first, InputIterator last, const Allocator& alloc)
+        : hive(first, last, block_capacity_default_limits(), alloc)
+    {
+    }
+
+    template <class T, class Allocator>
+    template <std::input_iterator InputIterator>
+    hive<T, Allocator>::hive(InputIterator first, InputIterator last, hive_limits blockLimits, const Allocator& alloc)
+        : hive(blockLimits, alloc)
+    {
+        insert(first, last);
+    }
+
+    template <class T, class Allocator>
+    hive<T, Allocator>::hive(std::initializer_list<T> il, const Allocator& alloc)
+        : hive(il, block_capacity_default_limits(), alloc)
+    {
+    }
+
+    template <class T, class Allocator>
+    hive<T, Allocator>::hive(std::initializer_list<T> il, hive_limits blockLimits, const Allocator& alloc)
+        : hive(blockLimits, alloc)
+    {
+        insert(il);
+    }
+
+    template <class T, class Allocator>
+    hive<T, Allocator>::hive(const hive& x)
+        : hive(x, allocator_traits::select_on_container_copy_construction(x.allocator))
+    {
+    }
+
+    template <class T, class Allocator>
+    hive<T, Allocator>::hive(hive&& x) noexcept
+        : allocator(std::move(x.allocator))
+    {
+        TakeBlocks(x);
+    }
+
+    template <class T, class Allocator>
+    hive<T, Allocator>::hive(const hive& x, const std::type_identity_t<Allocator>& alloc)
+        : hive(x.limits, alloc)
+    {
+        insert(x.begin(), x.end());
+    }
+
+    template <class T, class Allocator>
+    hive<T, Allocator>::hive(hive&& x, const std::type_identity_t<Allocator>& alloc)
+        : hive(alloc)
+    {
+        if (allocator == x.allocator)
+        {
+            TakeBlocks(x);
+        }
+        else
+        {
+            limits = x.limits;
+            ReplaceWithMovedElements(x);
+        }
+    }
+
+    template <class T, class Allocator>
+    hive<T, Allocator>::~hive()
+    {
+        DeallocateAll();
+    }
+
+    template <class T, class Allocator>
+    hive<T, Allocator>& hive<T, Allocator>::operator=(const hive& x)
+    {
+        if (this != &x)
+        {
+            if constexpr (allocator_traits::propagate_on_container_copy_assignment::value)
+            {
+                // Our blocks can only be freed by the allocator that allocated them.
+                if (allocator != x.allocator)
+                {
+                    DeallocateAll();
+                }
+                allocator = x.allocator;
+            }
+            assign(x.begin(), x.end());
+        }
+        return *this;
+    }
+
+    template <class T, class Allocator>
+    hive<T, Allocator>& hive<T, Allocator>::operator=(hive&& x)
+        noexcept(std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value
+            || std::allocator_traits<Allocator>::is_always_equal::value)
+    {
+        if (this != &x)
+        {
+            if constexpr (allocator_traits::propagate_on_container_move_assignment::value)
+            {
+                DeallocateAll();
+                allocator = std::move(x.allocator);
+                TakeBlocks(x);
+            }
+            else if constexpr (allocator_traits::is_always_equal::value)
+            {
+                DeallocateAll();
+                TakeBlocks(x);
+            }
+            else
+            {
+                if (allocator == x.allocator)
+                {
+                    DeallocateAll();
+                    TakeBlocks(x);
+                }
+                else
+                {
+                    ReplaceWithMovedElements(x);
+                }
+            }
+        }
+        return *this;
+    }
+
+    template <class T, class Allocator>
+    hive<T, Allocator>& hive<T, Allocator>::operator=(std::initializer_list<T> il)
+    {
+        assign(il);
+        return *this;
+    }
+
+    template <class T, class Allocator>
+    template <std::input_iterator InputIterator>
+    void hive<T, Allocator>::assign(InputIterator first, InputIterator last)
+    {
+        clear();
+        insert(first, last);
+    }
+
+    template <class T, class Allocator>
+    template <Detail::container_compatible_range<T> R>
+    void hive<T, Allocator>::assign_range(R&& rg)
+    {
+        clear();
+        insert_range(std::forward<R>(rg));
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::assign(size_type n, const T& value)
+    {
+        clear();
+        insert(n, value);
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::assign(std::initializer_list<T> il)
+    {
+        clear();
+        insert(il);
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::allocator_type hive<T, Allocator>::get_allocator() const noexcept
+    {
+        return allocator;
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::iterator hive<T, Allocator>::begin() noexcept
+    {
+        return begin_iterator;
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::const_iterator hive<T, Allocator>::begin() const noexcept
+    {
+        return begin_iterator;
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::iterator hive<T, Allocator>::end() noexcept
+    {
+        return end_iterator;
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::const_iterator hive<T, Allocator>::end() const noexcept
+    {
+        return end_iterator;
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::reverse_iterator hive<T, Allocator>::rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::const_reverse_iterator hive<T, Allocator>::rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::reverse_iterator hive<T, Allocator>::rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::const_reverse_iterator hive<T, Allocator>::rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::const_iterator hive<T, Allocator>::cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::const_iterator hive<T, Allocator>::cend() const noexcept
+    {
+        return end();
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::const_reverse_iterator hive<T, Allocator>::crbegin() const noexcept
+    {
+        return rbegin();
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::const_reverse_iterator hive<T, Allocator>::crend() const noexcept
+    {
+        return rend();
+    }
+
+    template <class T, class Allocator>
+    bool hive<T, Allocator>::empty() const noexcept
+    {
+        return stored_size == 0;
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::size_type hive<T, Allocator>::size() const noexcept
+    {
+        return stored_size;
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::size_type hive<T, Allocator>::max_size() const noexcept
+    {
+        return std::allocator_traits<slot_allocator>::max_size(slot_allocator(allocator));
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::size_type hive<T, Allocator>::capacity() const noexcept
+    {
+        return stored_capacity;
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::reserve(size_type n)
+    {
+        if (n <= stored_capacity)
+        {
+            return;
+        }
+        if (n > max_size())
+        {
+            Detail::hive_throw_length_error("hive::reserve");
+        }
+
+        while (stored_capacity < n)
+        {
+            group_type* group = AllocateGroup(std::clamp(n - stored_capacity, limits.min, limits.max));
+            group->next = reserved_groups;
+            reserved_groups = group;
+        }
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::shrink_to_fit()
+    {
+        trim_capacity();
+
+        // What `reserve` would allocate for our elements: full blocks of the largest capacity, and one for the rest.
+        const size_type remainder = stored_size % limits.max;
+        const size_type compactCapacity = stored_size - remainder + (remainder != 0 ? std::max(remainder, limits.min) : 0);
+        if (stored_capacity > compactCapacity)
+        {
+            Reallocate();
+        }
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::trim_capacity() noexcept
+    {
+        trim_capacity(0);
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::trim_capacity(size_type n) noexcept
+    {
+        group_type** link = &reserved_groups;
+        while (*link != nullptr && stored_capacity > n)
+        {
+            group_type* group = *link;
+            if (stored_capacity - group->capacity >= n)
+            {
+                *link = group->next;
+                DeallocateGroup(group);
+            }
+            else
+            {
+                link = &group->next;
+            }
+        }
+    }
+
+    template <class T, class Allocator>
+    hive_limits hive<T, Allocator>::block_capacity_limits() const noexcept
+    {
+        return limits;
+    }
+
+    template <class T, class Allocator>
+    constexpr hive_limits hive<T, Allocator>::block_capacity_default_limits() noexcept
+    {
+        return hive_limits(8, 8192);
+    }
+
+    template <class T, class Allocator>
+    constexpr hive_limits hive<T, Allocator>::block_capacity_hard_limits() noexcept
+    {
+        return hive_limits(1, Detail::hive_no_index);
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::reshape(hive_limits blockLimits)
+    {
+        CheckLimits(blockLimits);
+        limits = blockLimits;
+
+        const auto isOutsideLimits = [this](const group_type* group) noexcept
+        {
+            return group->capacity < limits.min || group->capacity > limits.max;
+        };
+
+        group_type** link = &reserved_groups;
+        while (*link != nullptr)
+        {
+            group_type* group = *link;
+            if (isOutsideLimits(group))
+            {
+                *link = group->next;
+                DeallocateGroup(group);
+            }
+            else
+            {
+                link = &group->next;
+            }
+        }
+
+        for (group_type* group = begin_iterator.group; group != nullptr; group = group->next)
+        {
+            if (isOutsideLimits(group))
+            {
+                Reallocate();
+                return;
+            }
+        }
+    }
+
+    template <class T, class Allocator>
+    template <class... Args>
+    typename hive<T, Allocator>::iterator hive<T, Allocator>::emplace(Args&&... args)
+    {
+        if (groups_with_erasures != nullptr)
+        {
+            return EmplaceIntoErased(std::forward<Args>(args)...);
+        }
+        return EmplaceBack(std::forward<Args>(args)...);
+    }
+
+    template <class T, class Allocator>
+    template <class... Args>
+    typename hive<T, Allocator>::iterator hive<T, Allocator>::emplace_hint(const_iterator, Args&&... args)
+    {
+        // Where an element goes is up to us, so the hint is of no use.
+        return emplace(std::forward<Args>(args)...);
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::iterator hive<T, Allocator>::insert(const T& x)
+    {
+        return emplace(x);
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::iterator hive<T, Allocator>::insert(T&& x)
+    {
+        return emplace(std::move(x));
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::iterator hive<T, Allocator>::insert(const_iterator, const T& x)
+    {
+        return emplace(x);
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::iterator hive<T, Allocator>::insert(const_iterator, T&& x)
+    {
+        return emplace(std::move(x));
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::insert(std::initializer_list<T> il)
+    {
+        insert(il.begin(), il.end());
+    }
+
+    template <class T, class Allocator>
+    template <Detail::container_compatible_range<T> R>
+    void hive<T, Allocator>::insert_range(R&& rg)
+    {
+        if constexpr (std::ranges::forward_range<R> || std::ranges::sized_range<R>)
+        {
+            reserve(stored_size + static_cast<size_type>(std::ranges::distance(rg)));
+        }
+        for (auto&& element : rg)
+        {
+            emplace(std::forward<decltype(element)>(element));
+        }
+    }
+
+    template <class T, class Allocator>
+    template <std::input_iterator InputIterator>
+    void hive<T, Allocator>::insert(InputIterator first, InputIterator last)
+    {
+        if constexpr (std::forward_iterator<InputIterator>)
+        {
+            reserve(stored_size + static_cast<size_type>(std::distance(first, last)));
+        }
+        for (; first != last; ++first)
+        {
+            emplace(*first);
+        }
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::insert(size_type n, const T& x)
+    {
+        reserve(stored_size + n);
+        for (; n != 0; --n)
+        {
+            emplace(x);
+        }
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::iterator hive<T, Allocator>::erase(const_iterator position)
+    {
+        // Preconditions: `position` is dereferenceable.
+        assert(position != cend());
+
+        group_type* group = position.group;
+        iterator next = MutableIterator(position);
+        ++next;
+        const bool nextIsEnd = next == end_iterator;
+
+        allocator_traits::destroy(allocator, group_type::Element(position.slot));
+        --stored_size;
+        if (--group->size == 0)
+        {
+            RetireGroup(group);
+            return nextIsEnd ? end_iterator : next;
+        }
+
+        MarkErased(group, static_cast<size_type>(position.slot - group->slots), 1);
+        if (position == begin_iterator)
+        {
+            begin_iterator = next;
+        }
+        return next;
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::iterator hive<T, Allocator>::erase(const_iterator first, const_iterator last)
+    {
+        // Erasing the last block's last element moves our end, which `last` would then no longer be.
+        if (last == cend())
+        {
+            while (first != cend())
+            {
+                first = erase(first);
+            }
+            return end_iterator;
+        }
+
+        while (first != last)
+        {
+            first = erase(first);
+        }
+        return MutableIterator(last);
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::swap(hive& x)
+        noexcept(std::allocator_traits<Allocator>::propagate_on_container_swap::value
+            || std::allocator_traits<Allocator>::is_always_equal::value)
+    {
+        if constexpr (allocator_traits::propagate_on_container_swap::value)
+        {
+            using std::swap;
+            swap(allocator, x.allocator);
+        }
+        else
+        {
+            // Preconditions: the allocators are equal.
+            assert(allocator == x.allocator);
+        }
+
+        std::swap(begin_iterator, x.begin_iterator);
+        std::swap(end_iterator, x.end_iterator);
+        std::swap(groups_with_erasures, x.groups_with_erasures);
+        std::swap(reserved_groups, x.reserved_groups);
+        std::swap(stored_size, x.stored_size);
+        std::swap(stored_capacity, x.stored_capacity);
+        std::swap(limits, x.limits);
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::clear() noexcept
+    {
+        DestroyElements();
+
+        group_type* group = begin_iterator.group;
+        while (group != nullptr)
+        {
+            group_type* next = group->next;
+            ReserveGroup(group);
+            group = next;
+        }
+
+        begin_iterator = iterator();
+        end_iterator = iterator();
+        groups_with_erasures = nullptr;
+        stored_size = 0;
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::splice(hive& x)
+    {
+        // Preconditions: the allocators are equal.
+        assert(allocator == x.allocator);
+
+        if (this == &x || x.empty())
+        {
+            return;
+        }
+
+        size_type splicedCapacity = 0;
+        for (group_type* group = x.begin_iterator.group; group != nullptr; group = group->next)
+        {
+            if (group->capacity < limits.min || group->capacity > limits.max)
+            {
+                Detail::hive_throw_length_error("hive::splice");
+            }
+            splicedCapacity += group->capacity;
+        }
+
+        group_type* back = end_iterator.group;
+        std::size_t number = 0;
+        if (back != nullptr)
+        {
+            // Only the last block may stop short of its end, so the slots our last block hasn't used yet are made an
+            // erased run, which iteration jumps over and insertion reuses.
+            const auto endIndex = static_cast<size_type>(end_iterator.slot - back->slots);
+            if (endIndex != back->capacity)
+            {
+                MarkErased(back, endIndex, back->capacity - endIndex);
+            }
+
+            back->next = x.begin_iterator.group;
+            x.begin_iterator.group->previous = back;
+            number = back->number + 1;
+        }
+        else
+        {
+            begin_iterator = x.begin_iterator;
+        }
+
+        for (group_type* group = x.begin_iterator.group; group != nullptr; group = group->next)
+        {
+            group->number = number++;
+        }
+        while (x.groups_with_erasures != nullptr)
+        {
+            group_type* group = x.groups_with_erasures;
+            x.UnlinkWithErasures(group);
+            LinkWithErasures(group);
+        }
+
+        end_iterator = x.end_iterator;
+        stored_size += x.stored_size;
+        stored_capacity += splicedCapacity;
+
+        x.begin_iterator = iterator();
+        x.end_iterator = iterator();
+        x.stored_size = 0;
+        x.stored_capacity -= splicedCapacity;
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::splice(hive&& x)
+    {
+        splice(x);
+    }
+
+    template <class T, class Allocator>
+    template <class BinaryPredicate>
+    typename hive<T, Allocator>::size_type hive<T, Allocator>::unique(BinaryPredicate binaryPred)
+    {
+        size_type removed = 0;
+        if (stored_size < 2)
+        {
+            return removed;
+        }
+
+        iterator previous = begin_iterator;
+        iterator current = std::next(previous);
+        while (current != end_iterator)
+        {
+            if (binaryPred(std::as_const(*previous), std::as_const(*current)))
+            {
+                current = erase(current);
+                ++removed;
+            }
+            else
+            {
+                previous = current;
+                ++current;
+            }
+        }
+        return removed;
+    }
+
+    template <class T, class Allocator>
+    template <class Compare>
+    void hive<T, Allocator>::sort(Compare comp)
+    {
+        if (stored_size < 2)
+        {
+            return;
+        }
+
+        // The elements stay in their slots, so they're sorted in contiguous memory and moved back in order.
+        std::vector<T, Allocator> sorted(allocator);
+        sorted.reserve(stored_size);
+        for (T& element : *this)
+        {
+            sorted.push_back(std::move(element));
+        }
+        std::sort(sorted.begin(), sorted.end(), comp);
+
+        auto source = sorted.begin();
+        for (T& element : *this)
+        {
+            element = std::move(*source);
+            ++source;
+        }
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::iterator hive<T, Allocator>::get_iterator(const_pointer p) noexcept
+    {
+        const auto* address = reinterpret_cast<const std::byte*>(p);
+        for (group_type* group = begin_iterator.group; group != nullptr; group = group->next)
+        {
+            const auto* first = reinterpret_cast<const std::byte*>(group->slots);
+            const auto* last = reinterpret_cast<const std::byte*>(group->slots_end);
+            if (!std::less<>()(address, first) && std::less<>()(address, last))
+            {
+                const auto index = static_cast<size_type>(address - first) / sizeof(slot_type);
+                return iterator(group, group->slots + index, group->skipfield + index);
+            }
+        }
+        return end_iterator;
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::const_iterator hive<T, Allocator>::get_iterator(const_pointer p) const noexcept
+    {
+        return const_cast<hive*>(this)->get_iterator(p);
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::CheckLimits(hive_limits blockLimits)
+    {
+        const hive_limits hardLimits = block_capacity_hard_limits();
+        if (blockLimits.min > blockLimits.max || blockLimits.min < hardLimits.min || blockLimits.max > hardLimits.max)
+        {
+            Detail::hive_throw_length_error("hive_limits outside of hive::block_capacity_hard_limits()");
+        }
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::iterator hive<T, Allocator>::MutableIterator(const_iterator position) noexcept
+    {
+        return iterator(position.group, position.slot, position.skip);
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::iterator hive<T, Allocator>::FirstIn(group_type* group) noexcept
+    {
+        const size_type first = group->skipfield[0];
+        return iterator(group, group->slots + first, group->skipfield + first);
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::size_type hive<T, Allocator>::NextGroupCapacity() const noexcept
+    {
+        return std::clamp(stored_size, limits.min, limits.max);
+    }
+
+    template <class T, class Allocator>
+    constexpr typename hive<T, Allocator>::size_type hive<T, Allocator>::SkipfieldSlots(size_type capacity) noexcept
+    {
+        return ((capacity + 1) * sizeof(Detail::hive_skipfield_t) + sizeof(slot_type) - 1) / sizeof(slot_type);
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::group_type* hive<T, Allocator>::AllocateGroup(size_type capacity)
+    {
+        group_allocator groupAllocator(allocator);
+        slot_allocator slotAllocator(allocator);
+
+        group_type* group = std::allocator_traits<group_allocator>::allocate(groupAllocator, 1);
+        Detail::hive_rollback_guard freeGroup([&]() noexcept
+        {
+            std::allocator_traits<group_allocator>::deallocate(groupAllocator, group, 1);
+        });
+        slot_type* slots = std::allocator_traits<slot_allocator>::allocate(slotAllocator, capacity + SkipfieldSlots(capacity));
+        freeGroup.Release();
+
+        // The skipfield follows the slots, which are at least as aligned as it is.
+        auto* skipfield = reinterpret_cast<Detail::hive_skipfield_t*>(slots + capacity);
+        std::uninitialized_fill_n(skipfield, capacity + 1, Detail::hive_skipfield_t(0));
+
+        std::construct_at(group, group_type{
+            .slots = slots,
+            .slots_end = slots + capacity,
+            .skipfield = skipfield,
+            .previous = nullptr,
+            .next = nullptr,
+            .previous_with_erasures = nullptr,
+            .next_with_erasures = nullptr,
+            .number = 0,
+            .capacity = capacity,
+            .size = 0,
+            .free_list_head = Detail::hive_no_index,
+        });
+        stored_capacity += capacity;
+        return group;
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::DeallocateGroup(group_type* group) noexcept
+    {
+        stored_capacity -= group->capacity;
+
+        slot_allocator slotAllocator(allocator);
+        std::allocator_traits<slot_allocator>::deallocate(slotAllocator, group->slots, group->capacity + SkipfieldSlots(group->capacity));
+
+        group_allocator groupAllocator(allocator);
+        std::destroy_at(group);
+        std::allocator_traits<group_allocator>::deallocate(groupAllocator, group, 1);
+    }
+
+    template <class T, class Allocator>
+    typename hive<T, Allocator>::group_type* hive<T, Allocator>::AcquireGroup()
+    {
+        if (reserved_groups != nullptr)
+        {
+            group_type* group = reserved_groups;
+            reserved_groups = group->next;
+            return group;
+        }
+        return AllocateGroup(NextGroupCapacity());
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::ReserveGroup(group_type* group) noexcept
+    {
+        std::fill_n(group->skipfield, group->capacity, Detail::hive_skipfield_t(0));
+        group->free_list_head = Detail::hive_no_index;
+        group->size = 0;
+        group->previous = nullptr;
+        group->previous_with_erasures = nullptr;
+        group->next_with_erasures = nullptr;
+
+        group->next = reserved_groups;
+        reserved_groups = group;
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::LinkBackGroup(group_type* group) noexcept
+    {
+        group_type* back = end_iterator.group;
+        group->previous = back;
+        group->next = nullptr;
+        if (back != nullptr)
+        {
+            group->number = back->number + 1;
+            back->next = group;
+        }
+        else
+        {
+            group->number = 0;
+            begin_iterator = iterator(group, group->slots, group->skipfield);
+        }
+        end_iterator = iterator(group, group->slots + 1, group->skipfield + 1);
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::RetireGroup(group_type* group) noexcept
+    {
+        if (group->free_list_head != Detail::hive_no_index)
+        {
+            UnlinkWithErasures(group);
+        }
+
+        group_type* previous = group->previous;
+        group_type* next = group->next;
+        if (previous != nullptr)
+        {
+            previous->next = next;
+        }
+        if (next != nullptr)
+        {
+            next->previous = previous;
+        }
+
+        if (group == begin_iterator.group)
+        {
+            begin_iterator = next != nullptr ? FirstIn(next) : iterator();
+        }
+        if (group == end_iterator.group)
+        {
+            // The block before is used up to its end, which is our end now.
+            end_iterator = previous != nullptr ? iterator(previous, previous->slots_end, previous->skipfield + previous->capacity) : iterator();
+        }
+
+        ReserveGroup(group);
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::LinkWithErasures(group_type* group) noexcept
+    {
+        group->previous_with_erasures = nullptr;
+        group->next_with_erasures = groups_with_erasures;
+        if (groups_with_erasures != nullptr)
+        {
+            groups_with_erasures->previous_with_erasures = group;
+        }
+        groups_with_erasures = group;
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::UnlinkWithErasures(group_type* group) noexcept
+    {
+        if (group->previous_with_erasures != nullptr)
+        {
+            group->previous_with_erasures->next_with_erasures = group->next_with_erasures;
+        }
+        else
+        {
+            groups_with_erasures = group->next_with_erasures;
+        }
+        if (group->next_with_erasures != nullptr)
+        {
+            group->next_with_erasures->previous_with_erasures = group->previous_with_erasures;
+        }
+        group->previous_with_erasures = nullptr;
+        group->next_with_erasures = nullptr;
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::UnlinkRun(group_type* group, size_type start) noexcept
+    {
+        const Detail::hive_free_run run = group->FreeRun(start);
+        if (run.previous != Detail::hive_no_index)
+        {
+            group->FreeRun(run.previous).next = run.next;
+        }
+        else
+        {
+            group->free_list_head = run.next;
+        }
+        if (run.next != Detail::hive_no_index)
+        {
+            group->FreeRun(run.next).previous = run.previous;
+        }
+
+        if (group->free_list_head == Detail::hive_no_index)
+        {
+            UnlinkWithErasures(group);
+        }
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::MarkErased(group_type* group, size_type index, size_type count) noexcept
+    {
+        Detail::hive_skipfield_t* skipfield = group->skipfield;
+        const size_type before = index != 0 ? skipfield[index - 1] : 0;
+        const size_type after = skipfield[index + count];
+        const size_type start = index - before;
+        const size_type length = before + count + after;
+
+        // Only the run's first and last entries need to be right, whatever the entries in between were.
+        skipfield[start] = static_cast<Detail::hive_skipfield_t>(length);
+        skipfield[start + length - 1] = static_cast<Detail::hive_skipfield_t>(length);
+
+        if (before == 0 && after == 0)
+        {
+            // A run of its own, which goes first in the free list.
+            const Detail::hive_skipfield_t head = group->free_list_head;
+            group->SetFreeRun(index, {Detail::hive_no_index, head});
+            if (head != Detail::hive_no_index)
+            {
+                group->FreeRun(head).previous = static_cast<Detail::hive_skipfield_t>(index);
+            }
+            else
+            {
+                LinkWithErasures(group);
+            }
+            group->free_list_head = static_cast<Detail::hive_skipfield_t>(index);
+        }
+        else if (before == 0)
+        {
+            // The run after starts here now, and keeps its place in the free list.
+            const Detail::hive_free_run run = group->FreeRun(index + count);
+            group->SetFreeRun(index, run);
+            if (run.previous != Detail::hive_no_index)
+            {
+                group->FreeRun(run.previous).next = static_cast<Detail::hive_skipfield_t>(index);
+            }
+            else
+            {
+                group->free_list_head = static_cast<Detail::hive_skipfield_t>(index);
+            }
+            if (run.next != Detail::hive_no_index)
+            {
+                group->FreeRun(run.next).previous = static_cast<Detail::hive_skipfield_t>(index);
+            }
+        }
+        else if (after != 0)
+        {
+            // The run after joins the run before, which already has a place in the free list.
+            UnlinkRun(group, index + count);
+        }
+    }
+
+    template <class T, class Allocator>
+    template <class... Args>
+    void hive<T, Allocator>::ConstructAt(slot_type* slot, Args&&... args)
+    {
+        allocator_traits::construct(allocator, reinterpret_cast<T*>(slot->bytes), std::forward<Args>(args)...);
+    }
+
+    template <class T, class Allocator>
+    template <class... Args>
+    typename hive<T, Allocator>::iterator hive<T, Allocator>::EmplaceIntoErased(Args&&... args)
+    {
+        group_type* group = groups_with_erasures;
+        Detail::hive_skipfield_t* skipfield = group->skipfield;
+        const size_type start = group->free_list_head;
+        const size_type length = skipfield[start];
+
+        // The run's last slot is taken, so its first slot, which holds its place in the free list, stays as it is.
+        const size_type index = start + length - 1;
+        slot_type* slot = group->slots + index;
+        if (length == 1)
+        {
+            // Unless it's the only one, whose place in the free list the element overwrites. So the run is taken out of
+            // the list first, and put back if constructing the element throws.
+            UnlinkRun(group, index);
+            skipfield[index] = 0;
+            Detail::hive_rollback_guard restoreRun([&]() noexcept
+            {
+                MarkErased(group, index, 1);
+            });
+            ConstructAt(slot, std::forward<Args>(args)...);
+            restoreRun.Release();
+        }
+        else
+        {
+            ConstructAt(slot, std::forward<Args>(args)...);
+            skipfield[index] = 0;
+            skipfield[start] = static_cast<Detail::hive_skipfield_t>(length - 1);
+            skipfield[index - 1] = static_cast<Detail::hive_skipfield_t>(length - 1);
+        }
+
+        ++group->size;
+        ++stored_size;
+
+        const iterator position(group, slot, skipfield + index);
+        if (group == begin_iterator.group && slot < begin_iterator.slot)
+        {
+            begin_iterator = position;
+        }
+        return position;
+    }
+
+    template <class T, class Allocator>
+    template <class... Args>
+    typename hive<T, Allocator>::iterator hive<T, Allocator>::EmplaceBack(Args&&... args)
+    {
+        group_type* back = end_iterator.group;
+        if (back != nullptr && end_iterator.slot != back->slots_end)
+        {
+            const iterator position = end_iterator;
+            ConstructAt(position.slot, std::forward<Args>(args)...);
+            ++end_iterator.slot;
+            ++end_iterator.skip;
+            ++back->size;
+            ++stored_size;
+            return position;
+        }
+
+        group_type* group = AcquireGroup();
+        Detail::hive_rollback_guard reserveGroup([&]() noexcept
+        {
+            ReserveGroup(group);
+        });
+        ConstructAt(group->slots, std::forward<Args>(args)...);
+        reserveGroup.Release();
+
+        group->size = 1;
+        ++stored_size;
+        LinkBackGroup(group);
+        return iterator(group, group->slots, group->skipfield);
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::ReplaceWithMovedElements(hive& x)
+    {
+        clear();
+        reserve(x.stored_size);
+        for (T& element : x)
+        {
+            emplace(std::move(element));
+        }
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::Reallocate()
+    {
+        hive reallocated(limits, allocator);
+        reallocated.ReplaceWithMovedElements(*this);
+        DeallocateAll();
+        TakeBlocks(reallocated);
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::DestroyElements() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T> || !std::is_same_v<Allocator, std::allocator<T>>)
+        {
+            for (iterator it = begin_iterator; it != end_iterator; ++it)
+            {
+                allocator_traits::destroy(allocator, std::addressof(*it));
+            }
+        }
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::DeallocateAll() noexcept
+    {
+        DestroyElements();
+
+        for (group_type* group = begin_iterator.group; group != nullptr;)
+        {
+            group_type* next = group->next;
+            DeallocateGroup(group);
+            group = next;
+        }
+        for (group_type* group = reserved_groups; group != nullptr;)
+        {
+            group_type* next = group->next;
+            DeallocateGroup(group);
+            group = next;
+        }
+
+        begin_iterator = iterator();
+        end_iterator = iterator();
+        groups_with_erasures = nullptr;
+        reserved_groups = nullptr;
+        stored_size = 0;
+    }
+
+    template <class T, class Allocator>
+    void hive<T, Allocator>::TakeBlocks(hive& x) noexcept
+    {
+        begin_iterator = std::exchange(x.begin_iterator, iterator());
+        end_iterator = std::exchange(x.end_iterator, iterator());
+        groups_with_erasures = std::exchange(x.groups_with_erasures, nullptr);
+        reserved_groups = std::exchange(x.reserved_groups, nullptr);
+        stored_size = std::exchange(x.stored_size, 0);
+        stored_capacity = std::exchange(x.stored_capacity, 0);
+        limits = x.limits;
+    }
+
+    template <class T, class Allocator, class U>
+    typename hive<T, Allocator>::size_type erase(hive<T, Allocator>& c, const U& value)
+    {
+        return erase_if(c, [&value](const T& element) { return element == value; });
+    }
+
+    template <class T, class Allocator, class Predicate>
+    typename hive<T, Allocator>::size_type erase_if(hive<T, Allocator>& c, Predicate pred)
+    {
+        typename hive<T, Allocator>::size_type removed = 0;
+        for (auto it = c.begin(); it != c.end();)
+        {
+            if (pred(std::as_const(*it)))
+            {
+                it = c.erase(it);
+                ++removed;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        return removed;
+    }
+}
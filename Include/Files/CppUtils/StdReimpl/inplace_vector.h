@@ -0,0 +1,288 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/concepts.h>
+#include <CppUtils/StdReimpl/utility.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        /**
+         * @brief The smallest unsigned integer that can count to `N`. Only used internally, to keep small
+         *        `inplace_vector`s small; the public `size_type` is always `std::size_t`.
+         */
+        template <std::size_t N>
+        using inplace_vector_size_t =
+            std::conditional_t<N <= UINT8_MAX, std::uint8_t,
+            std::conditional_t<N <= UINT16_MAX, std::uint16_t,
+            std::conditional_t<N <= UINT32_MAX, std::uint32_t,
+            std::size_t>>>;
+
+        /**
+         * @brief Uninitialized storage for `N` elements. A union so that no element is constructed until we construct it,
+         *        which also keeps this usable in constant evaluation. It's trivially copyable and destructible whenever
+         *        `T` is, which is what lets `inplace_vector` be too.
+         */
+        template <class T, std::size_t N>
+        union inplace_vector_storage
+        {
+            T elements[N];
+
+            constexpr inplace_vector_storage() noexcept {}
+
+            constexpr ~inplace_vector_storage() requires std::is_trivially_destructible_v<T> = default;
+            constexpr ~inplace_vector_storage() {}
+
+            constexpr T* data() noexcept { return elements; }
+            constexpr const T* data() const noexcept { return elements; }
+        };
+
+        template <class T>
+        union inplace_vector_storage<T, 0>
+        {
+            constexpr T* data() noexcept { return nullptr; }
+            constexpr const T* data() const noexcept { return nullptr; }
+        };
+
+        /**
+         * @brief Whether the element operations of `inplace_vector` may be done with `memcpy`/`memmove` at runtime.
+         */
+        template <class T>
+        inline constexpr bool inplace_vector_can_memcpy_v = std::is_trivially_copyable_v<T>;
+
+        /**
+         * @brief Thrown when an `inplace_vector` runs out of capacity, as the standard specifies. Aborts instead when
+         *        exceptions are disabled.
+         */
+        [[noreturn]] inline void inplace_vector_throw_bad_alloc();
+
+        /**
+         * @brief Thrown by `inplace_vector::at`. Aborts instead when exceptions are disabled.
+         */
+        [[noreturn]] inline void inplace_vector_throw_out_of_range();
+    }
+
+    /**
+     * @brief A dynamically-resizable array with capacity fixed at `N` and storage inside the object. It never allocates.
+     *        Growing past `N` throws `std::bad_alloc`, except through the `try_` (returns null) and `unchecked_`
+     *        (precondition) functions.
+     *
+     *        When `T` is trivially copyable, so is the `inplace_vector`, and insert, erase, and copy turn into
+     *        `memmove`/`memcpy` at runtime. Everything is constexpr.
+     * @see https://eel.is/c++draft/inplace.vector
+     * @see https://cppreference.com/w/cpp/container/inplace_vector
+     * @note A feature from the C++26 standard. `from_range_t` constructors are left out, since `std::from_range_t` is
+     *       from C++23; use `append_range` instead.
+     */
+    template <class T, std::size_t N>
+    class inplace_vector
+    {
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        // Construct/copy/destroy.
+
+        constexpr inplace_vector() noexcept;
+        constexpr explicit inplace_vector(size_type n);
+        constexpr inplace_vector(size_type n, const T& value);
+        template <std::input_iterator InputIterator>
+        constexpr inplace_vector(InputIterator first, InputIterator last);
+        constexpr inplace_vector(std::initializer_list<T> il);
+
+        constexpr inplace_vector(const inplace_vector&)
+            requires (N == 0 || std::is_trivially_copy_constructible_v<T>) = default;
+        constexpr inplace_vector(const inplace_vector& other);
+
+        constexpr inplace_vector(inplace_vector&&)
+            requires (N == 0 || std::is_trivially_move_constructible_v<T>) = default;
+        constexpr inplace_vector(inplace_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+        constexpr ~inplace_vector()
+            requires (N == 0 || std::is_trivially_destructible_v<T>) = default;
+        constexpr ~inplace_vector();
+
+        constexpr inplace_vector& operator=(const inplace_vector&)
+            requires (N == 0 || (std::is_trivially_destructible_v<T> && std::is_trivially_copy_constructible_v<T> && std::is_trivially_copy_assignable_v<T>)) = default;
+        constexpr inplace_vector& operator=(const inplace_vector& other);
+
+        constexpr inplace_vector& operator=(inplace_vector&&)
+            requires (N == 0 || (std::is_trivially_destructible_v<T> && std::is_trivially_move_constructible_v<T> && std::is_trivially_move_assignable_v<T>)) = default;
+        constexpr inplace_vector& operator=(inplace_vector&& other)
+            noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_move_constructible_v<T>);
+
+        constexpr inplace_vector& operator=(std::initializer_list<T> il);
+
+        template <std::input_iterator InputIterator>
+        constexpr void assign(InputIterator first, InputIterator last);
+        template <Detail::container_compatible_range<T> R>
+        constexpr void assign_range(R&& rg);
+        constexpr void assign(size_type n, const T& value);
+        constexpr void assign(std::initializer_list<T> il);
+
+        // Iterators.
+
+        constexpr iterator begin() noexcept;
+        constexpr const_iterator begin() const noexcept;
+        constexpr iterator end() noexcept;
+        constexpr const_iterator end() const noexcept;
+        constexpr reverse_iterator rbegin() noexcept;
+        constexpr const_reverse_iterator rbegin() const noexcept;
+        constexpr reverse_iterator rend() noexcept;
+        constexpr const_reverse_iterator rend() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+        constexpr const_reverse_iterator crbegin() const noexcept;
+        constexpr const_reverse_iterator crend() const noexcept;
+
+        // Size/capacity.
+
+        constexpr bool empty() const noexcept;
+        constexpr size_type size() const noexcept;
+        static constexpr size_type max_size() noexcept;
+        static constexpr size_type capacity() noexcept;
+        constexpr void resize(size_type sz);
+        constexpr void resize(size_type sz, const T& c);
+        static constexpr void reserve(size_type n);
+        static constexpr void shrink_to_fit() noexcept;
+
+        // Element access.
+
+        constexpr reference operator[](size_type n);
+        constexpr const_reference operator[](size_type n) const;
+        constexpr reference at(size_type n);
+        constexpr const_reference at(size_type n) const;
+        constexpr reference front();
+        constexpr const_reference front() const;
+        constexpr reference back();
+        constexpr const_reference back() const;
+
+        // Data access.
+
+        constexpr T* data() noexcept;
+        constexpr const T* data() const noexcept;
+
+        // Modifiers.
+
+        template <class... Args>
+        constexpr reference emplace_back(Args&&... args);
+        constexpr reference push_back(const T& x);
+        constexpr reference push_back(T&& x);
+        template <Detail::container_compatible_range<T> R>
+        constexpr void append_range(R&& rg);
+        constexpr void pop_back();
+
+        template <class... Args>
+        constexpr pointer try_emplace_back(Args&&... args);
+        constexpr pointer try_push_back(const T& x);
+        constexpr pointer try_push_back(T&& x);
+        template <Detail::container_compatible_range<T> R>
+        constexpr std::ranges::borrowed_iterator_t<R> try_append_range(R&& rg);
+
+        template <class... Args>
+        constexpr reference unchecked_emplace_back(Args&&... args);
+        constexpr reference unchecked_push_back(const T& x);
+        constexpr reference unchecked_push_back(T&& x);
+
+        template <class... Args>
+        constexpr iterator emplace(const_iterator position, Args&&... args);
+        constexpr iterator insert(const_iterator position, const T& x);
+        constexpr iterator insert(const_iterator position, T&& x);
+        constexpr iterator insert(const_iterator position, size_type n, const T& x);
+        template <std::input_iterator InputIterator>
+        constexpr iterator insert(const_iterator position, InputIterator first, InputIterator last);
+        template <Detail::container_compatible_range<T> R>
+        constexpr iterator insert_range(const_iterator position, R&& rg);
+        constexpr iterator insert(const_iterator position, std::initializer_list<T> il);
+        constexpr iterator erase(const_iterator position);
+        constexpr iterator erase(const_iterator first, const_iterator last);
+        constexpr void swap(inplace_vector& x)
+            noexcept(N == 0 || (std::is_nothrow_swappable_v<T> && std::is_nothrow_move_constructible_v<T>));
+        constexpr void clear() noexcept;
+
+        friend constexpr bool operator==(const inplace_vector& x, const inplace_vector& y)
+        {
+            return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
+        }
+
+        friend constexpr auto operator<=>(const inplace_vector& x, const inplace_vector& y)
+            requires requires (const T& t) { Detail::synth_three_way(t, t); }
+        {
+            return std::lexicographical_compare_three_way(x.begin(), x.end(), y.begin(), y.end(), Detail::synth_three_way);
+        }
+
+        friend constexpr void swap(inplace_vector& x, inplace_vector& y) noexcept(noexcept(x.swap(y)))
+        {
+            x.swap(y);
+        }
+
+    private:
+        constexpr void SetSize(size_type n) noexcept;
+
+        constexpr iterator MutableIterator(const_iterator position) noexcept;
+
+        /**
+         * @brief Destroys the elements in `[first, end())` and shrinks to `first`.
+         */
+        constexpr void DestroyFrom(iterator first) noexcept;
+
+        /**
+         * @brief Appends the elements of `[first, last)`, throwing `std::bad_alloc` with no effects if they don't fit.
+         */
+        template <class InputIterator, class Sentinel>
+        constexpr void AppendChecked(InputIterator first, Sentinel last);
+
+        /**
+         * @brief Inserts the elements of `[first, last)` at `position`, throwing `std::bad_alloc` with no effects if they
+         *        don't fit.
+         */
+        template <class InputIterator, class Sentinel>
+        constexpr iterator InsertChecked(iterator position, InputIterator first, Sentinel last);
+
+        /**
+         * @brief Opens a gap of `n` slots at `position` by moving the tail back, for trivially copyable `T` at runtime.
+         */
+        iterator OpenGapTrivially(iterator position, size_type n) noexcept;
+
+        /**
+         * @brief Moves the elements appended at `[oldEnd, end())` to `position`. This is how we insert elements that
+         *        aren't trivially copyable, since appending never has to move anything that's already in place.
+         */
+        constexpr iterator RotateAppendedInto(iterator position, iterator oldEnd);
+
+        Detail::inplace_vector_storage<T, N> storage;
+        Detail::inplace_vector_size_t<N> stored_size = 0;
+    };
+
+    /**
+     * @see https://eel.is/c++draft/inplace.vector.erasure
+     */
+    template <class T, std::size_t N, class U = T>
+    constexpr typename inplace_vector<T, N>::size_type erase(inplace_vector<T, N>& c, const U& value);
+
+    template <class T, std::size_t N, class Predicate>
+    constexpr typename inplace_vector<T, N>::size_type erase_if(inplace_vector<T, N>& c, Predicate pred);
+}
+
+#include <CppUtils/StdReimpl/inplace_vector.inl>
@@ -0,0 +1,789 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/inplace_vector.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        [[noreturn]] inline void inplace_vector_throw_bad_alloc()
+        {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            throw std::bad_alloc();
+#else
+            std::abort();
+#endif
+        }
+
+        [[noreturn]] inline void inplace_vector_throw_out_of_range()
+        {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            throw std::out_of_range("inplace_vector::at");
+#else
+            std::abort();
+#endif
+        }
+    }
+
+    template <class T, std::size_t N>
+    constexpr inplace_vector<T, N>::inplace_vector() noexcept
+    {
+    }
+
+    // The constructors below delegate to the default constructor so that, if they throw part way through, our destructor
+    // cleans up whatever was constructed.
+
+    template <class T, std::size_t N>
+    constexpr inplace_vector<T, N>::inplace_vector(size_type n)
+        : inplace_vector()
+    {
+        resize(n);
+    }
+
+    template <class T, std::size_t N>
+    constexpr inplace_vector<T, N>::inplace_vector(size_type n, const T& value)
+        : inplace_vector()
+    {
+        resize(n, value);
+    }
+
+    template <class T, std::size_t N>
+    template <std::input_iterator InputIterator>
+    constexpr inplace_vector<T, N>::inplace_vector(InputIterator first, InputIterator last)
+        : inplace_vector()
+    {
+        AppendChecked(first, last);
+    }
+
+    template <class T, std::size_t N>
+    constexpr inplace_vector<T, N>::inplace_vector(std::initializer_list<T> il)
+        : inplace_vector()
+    {
+        AppendChecked(il.begin(), il.end());
+    }
+
+    template <class T, std::size_t N>
+    constexpr inplace_vector<T, N>::inplace_vector(const inplace_vector& other)
+        : inplace_vector()
+    {
+        for (const T& element : other)
+        {
+            unchecked_emplace_back(element);
+        }
+    }
+
+    template <class T, std::size_t N>
+    constexpr inplace_vector<T, N>::inplace_vector(inplace_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : inplace_vector()
+    {
+        for (T& element : other)
+        {
+            unchecked_emplace_back(std::move(element));
+        }
+    }
+
+    template <class T, std::size_t N>
+    constexpr inplace_vector<T, N>::~inplace_vector()
+    {
+        std::destroy(begin(), end());
+    }
+
+    template <class T, std::size_t N>
+    constexpr inplace_vector<T, N>& inplace_vector<T, N>::operator=(const inplace_vector& other)
+    {
+        if (this != &other)
+        {
+            if (other.size() <= size())
+            {
+                DestroyFrom(std::copy(other.begin(), other.end(), begin()));
+            }
+            else
+            {
+                const_iterator otherMid = other.begin() + size();
+                std::copy(other.begin(), otherMid, begin());
+                AppendChecked(otherMid, other.end());
+            }
+        }
+        return *this;
+    }
+
+    template <class T, std::size_t N>
+    constexpr inplace_vector<T, N>& inplace_vector<T, N>::operator=(inplace_vector&& other)
+        noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            if (other.size() <= size())
+            {
+                DestroyFrom(std::move(other.begin(), other.end(), begin()));
+            }
+            else
+            {
+                iterator otherMid = other.begin() + size();
+                std::move(other.begin(), otherMid, begin());
+                AppendChecked(std::make_move_iterator(otherMid), std::make_move_iterator(other.end()));
+            }
+        }
+        return *this;
+    }
+
+    template <class T, std::size_t N>
+    constexpr inplace_vector<T, N>& inplace_vector<T, N>::operator=(std::initializer_list<T> il)
+    {
+        assign(il);
+        return *this;
+    }
+
+    template <class T, std::size_t N>
+    template <std::input_iterator InputIterator>
+    constexpr void inplace_vector<T, N>::assign(InputIterator first, InputIterator last)
+    {
+        if constexpr (std::forward_iterator<InputIterator>)
+        {
+            // Check before clearing, so that we don't have any effects if it doesn't fit.
+            if (static_cast<size_type>(std::distance(first, last)) > N)
+            {
+                Detail::inplace_vector_throw_bad_alloc();
+            }
+        }
+
+        clear();
+        AppendChecked(first, last);
+    }
+
+    template <class T, std::size_t N>
+    template <Detail::container_compatible_range<T> R>
+    constexpr void inplace_vector<T, N>::assign_range(R&& rg)
+    {
+        if constexpr (std::ranges::forward_range<R> || std::ranges::sized_range<R>)
+        {
+            if (static_cast<size_type>(std::ranges::distance(rg)) > N)
+            {
+                Detail::inplace_vector_throw_bad_alloc();
+            }
+        }
+
+        clear();
+        AppendChecked(std::ranges::begin(rg), std::ranges::end(rg));
+    }
+
+    template <class T, std::size_t N>
+    constexpr void inplace_vector<T, N>::assign(size_type n, const T& value)
+    {
+        if (n > N)
+        {
+            Detail::inplace_vector_throw_bad_alloc();
+        }
+
+        // Copy in case `value` is one of our elements.
+        const T copy = value;
+        clear();
+        resize(n, copy);
+    }
+
+    template <class T, std::size_t N>
+    constexpr void inplace_vector<T, N>::assign(std::initializer_list<T> il)
+    {
+        assign(il.begin(), il.end());
+    }
+
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::iterator inplace_vector<T, N>::begin() noexcept
+    {
+        return data();
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::const_iterator inplace_vector<T, N>::begin() const noexcept
+    {
+        return data();
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::iterator inplace_vector<T, N>::end() noexcept
+    {
+        return data() + size();
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::const_iterator inplace_vector<T, N>::end() const noexcept
+    {
+        return data() + size();
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::reverse_iterator inplace_vector<T, N>::rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::const_reverse_iterator inplace_vector<T, N>::rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::reverse_iterator inplace_vector<T, N>::rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::const_reverse_iterator inplace_vector<T, N>::rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::const_iterator inplace_vector<T, N>::cbegin() const noexcept
+    {
+        return begin();
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::const_iterator inplace_vector<T, N>::cend() const noexcept
+    {
+        return end();
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::const_reverse_iterator inplace_vector<T, N>::crbegin() const noexcept
+    {
+        return rbegin();
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::const_reverse_iterator inplace_vector<T, N>::crend() const noexcept
+    {
+        return rend();
+    }
+
+    template <class T, std::size_t N>
+    constexpr bool inplace_vector<T, N>::empty() const noexcept
+    {
+        return stored_size == 0;
+    }
+
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::size_type inplace_vector<T, N>::size() const noexcept
+    {
+        return stored_size;
+    }
+
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::size_type inplace_vector<T, N>::max_size() noexcept
+    {
+        return N;
+    }
+
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::size_type inplace_vector<T, N>::capacity() noexcept
+    {
+        return N;
+    }
+
+    template <class T, std::size_t N>
+    constexpr void inplace_vector<T, N>::resize(size_type sz)
+    {
+        if (sz > N)
+        {
+            Detail::inplace_vector_throw_bad_alloc();
+        }
+
+        if (sz < size())
+        {
+            DestroyFrom(begin() + sz);
+        }
+        else
+        {
+            while (size() < sz)
+            {
+                unchecked_emplace_back();
+            }
+        }
+    }
+
+    template <class T, std::size_t N>
+    constexpr void inplace_vector<T, N>::resize(size_type sz, const T& c)
+    {
+        if (sz > N)
+        {
+            Detail::inplace_vector_throw_bad_alloc();
+        }
+
+        if (sz < size())
+        {
+            DestroyFrom(begin() + sz);
+        }
+        else
+        {
+            // Growing never moves existing elements, so `c` stays valid even if it's one of them.
+            while (size() < sz)
+            {
+                unchecked_emplace_back(c);
+            }
+        }
+    }
+
+    template <class T, std::size_t N>
+    constexpr void inplace_vector<T, N>::reserve(size_type n)
+    {
+        if (n > N)
+        {
+            Detail::inplace_vector_throw_bad_alloc();
+        }
+    }
+
+    template <class T, std::size_t N>
+    constexpr void inplace_vector<T, N>::shrink_to_fit() noexcept
+    {
+    }
+
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::reference inplace_vector<T, N>::operator[](size_type n)
+    {
+        assert(n < size());
+        return data()[n];
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::const_reference inplace_vector<T, N>::operator[](size_type n) const
+    {
+        assert(n < size());
+        return data()[n];
+    }
+
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::reference inplace_vector<T, N>::at(size_type n)
+    {
+        if (n >= size())
+        {
+            Detail::inplace_vector_throw_out_of_range();
+        }
+        return data()[n];
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::const_reference inplace_vector<T, N>::at(size_type n) const
+    {
+        if (n >= size())
+        {
+            Detail::inplace_vector_throw_out_of_range();
+        }
+        return data()[n];
+    }
+
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::reference inplace_vector<T, N>::front()
+    {
+        assert(!empty());
+        return data()[0];
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::const_reference inplace_vector<T, N>::front() const
+    {
+        assert(!empty());
+        return data()[0];
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::reference inplace_vector<T, N>::back()
+    {
+        assert(!empty());
+        return data()[size() - 1];
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::const_reference inplace_vector<T, N>::back() const
+    {
+        assert(!empty());
+        return data()[size() - 1];
+    }
+
+    template <class T, std::size_t N>
+    constexpr T* inplace_vector<T, N>::data() noexcept
+    {
+        return storage.data();
+    }
+    template <class T, std::size_t N>
+    constexpr const T* inplace_vector<T, N>::data() const noexcept
+    {
+        return storage.data();
+    }
+
+    template <class T, std::size_t N>
+    template <class... Args>
+    constexpr typename inplace_vector<T, N>::reference inplace_vector<T, N>::emplace_back(Args&&... args)
+    {
+        if (size() == N)
+        {
+            Detail::inplace_vector_throw_bad_alloc();
+        }
+        return unchecked_emplace_back(std::forward<Args>(args)...);
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::reference inplace_vector<T, N>::push_back(const T& x)
+    {
+        return emplace_back(x);
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::reference inplace_vector<T, N>::push_back(T&& x)
+    {
+        return emplace_back(std::move(x));
+    }
+
+    template <class T, std::size_t N>
+    template <Detail::container_compatible_range<T> R>
+    constexpr void inplace_vector<T, N>::append_range(R&& rg)
+    {
+        AppendChecked(std::ranges::begin(rg), std::ranges::end(rg));
+    }
+
+    template <class T, std::size_t N>
+    constexpr void inplace_vector<T, N>::pop_back()
+    {
+        assert(!empty());
+        std::destroy_at(end() - 1);
+        SetSize(size() - 1);
+    }
+
+    template <class T, std::size_t N>
+    template <class... Args>
+    constexpr typename inplace_vector<T, N>::pointer inplace_vector<T, N>::try_emplace_back(Args&&... args)
+    {
+        if (size() == N)
+        {
+            return nullptr;
+        }
+        return std::addressof(unchecked_emplace_back(std::forward<Args>(args)...));
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::pointer inplace_vector<T, N>::try_push_back(const T& x)
+    {
+        return try_emplace_back(x);
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::pointer inplace_vector<T, N>::try_push_back(T&& x)
+    {
+        return try_emplace_back(std::move(x));
+    }
+
+    template <class T, std::size_t N>
+    template <Detail::container_compatible_range<T> R>
+    constexpr std::ranges::borrowed_iterator_t<R> inplace_vector<T, N>::try_append_range(R&& rg)
+    {
+        auto first = std::ranges::begin(rg);
+        const auto last = std::ranges::end(rg);
+        for (; size() != N && first != last; ++first)
+        {
+            unchecked_emplace_back(*first);
+        }
+
+        if constexpr (std::ranges::borrowed_range<R>)
+        {
+            return first;
+        }
+        else
+        {
+            return std::ranges::dangling{};
+        }
+    }
+
+    template <class T, std::size_t N>
+    template <class... Args>
+    constexpr typename inplace_vector<T, N>::reference inplace_vector<T, N>::unchecked_emplace_back(Args&&... args)
+    {
+        assert(size() < N);
+        T* element = std::construct_at(data() + size(), std::forward<Args>(args)...);
+        SetSize(size() + 1);
+        return *element;
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::reference inplace_vector<T, N>::unchecked_push_back(const T& x)
+    {
+        return unchecked_emplace_back(x);
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::reference inplace_vector<T, N>::unchecked_push_back(T&& x)
+    {
+        return unchecked_emplace_back(std::move(x));
+    }
+
+    template <class T, std::size_t N>
+    template <class... Args>
+    constexpr typename inplace_vector<T, N>::iterator inplace_vector<T, N>::emplace(const_iterator position, Args&&... args)
+    {
+        iterator pos = MutableIterator(position);
+        if (size() == N)
+        {
+            Detail::inplace_vector_throw_bad_alloc();
+        }
+
+        if constexpr (Detail::inplace_vector_can_memcpy_v<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                // Construct first, in case the arguments refer to elements that are about to move.
+                T value(std::forward<Args>(args)...);
+                iterator gap = OpenGapTrivially(pos, 1);
+                std::memcpy(static_cast<void*>(gap), std::addressof(value), sizeof(T));
+                return gap;
+            }
+        }
+
+        if (pos == end())
+        {
+            unchecked_emplace_back(std::forward<Args>(args)...);
+            return pos;
+        }
+
+        // Shift the tail back by one and move the new element into place. Cheaper than a rotate for a single element.
+        T value(std::forward<Args>(args)...);
+        unchecked_emplace_back(std::move(back()));
+        std::move_backward(pos, end() - 2, end() - 1);
+        *pos = std::move(value);
+        return pos;
+    }
+
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::iterator inplace_vector<T, N>::insert(const_iterator position, const T& x)
+    {
+        return emplace(position, x);
+    }
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::iterator inplace_vector<T, N>::insert(const_iterator position, T&& x)
+    {
+        return emplace(position, std::move(x));
+    }
+
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::iterator inplace_vector<T, N>::insert(const_iterator position, size_type n, const T& x)
+    {
+        iterator pos = MutableIterator(position);
+        if (n > N - size())
+        {
+            Detail::inplace_vector_throw_bad_alloc();
+        }
+
+        if constexpr (Detail::inplace_vector_can_memcpy_v<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const T value = x;
+                iterator gap = OpenGapTrivially(pos, n);
+                std::uninitialized_fill_n(gap, n, value);
+                return gap;
+            }
+        }
+
+        iterator oldEnd = end();
+        for (size_type i = 0; i < n; ++i)
+        {
+            unchecked_emplace_back(x);
+        }
+        return RotateAppendedInto(pos, oldEnd);
+    }
+
+    template <class T, std::size_t N>
+    template <std::input_iterator InputIterator>
+    constexpr typename inplace_vector<T, N>::iterator inplace_vector<T, N>::insert(const_iterator position, InputIterator first, InputIterator last)
+    {
+        return InsertChecked(MutableIterator(position), first, last);
+    }
+
+    template <class T, std::size_t N>
+    template <Detail::container_compatible_range<T> R>
+    constexpr typename inplace_vector<T, N>::iterator inplace_vector<T, N>::insert_range(const_iterator position, R&& rg)
+    {
+        return InsertChecked(MutableIterator(position), std::ranges::begin(rg), std::ranges::end(rg));
+    }
+
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::iterator inplace_vector<T, N>::insert(const_iterator position, std::initializer_list<T> il)
+    {
+        return InsertChecked(MutableIterator(position), il.begin(), il.end());
+    }
+
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::iterator inplace_vector<T, N>::erase(const_iterator position)
+    {
+        assert(position != end());
+        return erase(position, position + 1);
+    }
+
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::iterator inplace_vector<T, N>::erase(const_iterator first, const_iterator last)
+    {
+        iterator f = MutableIterator(first);
+        iterator l = MutableIterator(last);
+        assert(f <= l && l <= end());
+
+        if (f != l)
+        {
+            if constexpr (Detail::inplace_vector_can_memcpy_v<T>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    // Trivially copyable means trivially destructible, so there's nothing to destroy.
+                    std::memmove(static_cast<void*>(f), l, static_cast<std::size_t>(end() - l) * sizeof(T));
+                    SetSize(size() - static_cast<size_type>(l - f));
+                    return f;
+                }
+            }
+
+            DestroyFrom(std::move(l, end(), f));
+        }
+        return f;
+    }
+
+    template <class T, std::size_t N>
+    constexpr void inplace_vector<T, N>::swap(inplace_vector& x)
+        noexcept(N == 0 || (std::is_nothrow_swappable_v<T> && std::is_nothrow_move_constructible_v<T>))
+    {
+        inplace_vector& smaller = (size() < x.size()) ? *this : x;
+        inplace_vector& larger = (size() < x.size()) ? x : *this;
+
+        const size_type smallerSize = smaller.size();
+        std::swap_ranges(smaller.begin(), smaller.end(), larger.begin());
+        for (iterator it = larger.begin() + smallerSize; it != larger.end(); ++it)
+        {
+            smaller.unchecked_emplace_back(std::move(*it));
+        }
+        larger.DestroyFrom(larger.begin() + smallerSize);
+    }
+
+    template <class T, std::size_t N>
+    constexpr void inplace_vector<T, N>::clear() noexcept
+    {
+        DestroyFrom(begin());
+    }
+
+    template <class T, std::size_t N>
+    constexpr void inplace_vector<T, N>::SetSize(size_type n) noexcept
+    {
+        stored_size = static_cast<Detail::inplace_vector_size_t<N>>(n);
+    }
+
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::iterator inplace_vector<T, N>::MutableIterator(const_iterator position) noexcept
+    {
+        assert(cbegin() <= position && position <= cend());
+        return begin() + (position - cbegin());
+    }
+
+    template <class T, std::size_t N>
+    constexpr void inplace_vector<T, N>::DestroyFrom(iterator first) noexcept
+    {
+        std::destroy(first, end());
+        SetSize(static_cast<size_type>(first - begin()));
+    }
+
+    template <class T, std::size_t N>
+    template <class InputIterator, class Sentinel>
+    constexpr void inplace_vector<T, N>::AppendChecked(InputIterator first, Sentinel last)
+    {
+        if constexpr (std::forward_iterator<InputIterator>)
+        {
+            const size_type n = static_cast<size_type>(std::ranges::distance(first, last));
+            if (n > N - size())
+            {
+                Detail::inplace_vector_throw_bad_alloc();
+            }
+
+            if constexpr (Detail::inplace_vector_can_memcpy_v<T> &&
+                std::contiguous_iterator<InputIterator> &&
+                std::is_same_v<std::remove_cvref_t<std::iter_reference_t<InputIterator>>, T>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    if (n != 0)
+                    {
+                        std::memcpy(static_cast<void*>(end()), std::to_address(first), n * sizeof(T));
+                    }
+                    SetSize(size() + n);
+                    return;
+                }
+            }
+
+            for (; first != last; ++first)
+            {
+                unchecked_emplace_back(*first);
+            }
+        }
+        else
+        {
+            // We can't know the count up front, so undo what we appended if we run out of room.
+            const size_type oldSize = size();
+            for (; first != last; ++first)
+            {
+                if (size() == N)
+                {
+                    DestroyFrom(begin() + oldSize);
+                    Detail::inplace_vector_throw_bad_alloc();
+                }
+                unchecked_emplace_back(*first);
+            }
+        }
+    }
+
+    template <class T, std::size_t N>
+    template <class InputIterator, class Sentinel>
+    constexpr typename inplace_vector<T, N>::iterator inplace_vector<T, N>::InsertChecked(iterator position, InputIterator first, Sentinel last)
+    {
+        if constexpr (Detail::inplace_vector_can_memcpy_v<T> && std::forward_iterator<InputIterator>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const size_type n = static_cast<size_type>(std::ranges::distance(first, last));
+                if (n > N - size())
+                {
+                    Detail::inplace_vector_throw_bad_alloc();
+                }
+
+                iterator gap = OpenGapTrivially(position, n);
+                std::ranges::uninitialized_copy(first, last, gap, gap + n);
+                return gap;
+            }
+        }
+
+        iterator oldEnd = end();
+        AppendChecked(first, last);
+        return RotateAppendedInto(position, oldEnd);
+    }
+
+    template <class T, std::size_t N>
+    typename inplace_vector<T, N>::iterator inplace_vector<T, N>::OpenGapTrivially(iterator position, size_type n) noexcept
+    {
+        static_assert(Detail::inplace_vector_can_memcpy_v<T>);
+
+        if (n != 0)
+        {
+            std::memmove(static_cast<void*>(position + n), position, static_cast<std::size_t>(end() - position) * sizeof(T));
+            SetSize(size() + n);
+        }
+        return position;
+    }
+
+    template <class T, std::size_t N>
+    constexpr typename inplace_vector<T, N>::iterator inplace_vector<T, N>::RotateAppendedInto(iterator position, iterator oldEnd)
+    {
+        std::rotate(position, oldEnd, end());
+        return position;
+    }
+
+    template <class T, std::size_t N, class U>
+    constexpr typename inplace_vector<T, N>::size_type erase(inplace_vector<T, N>& c, const U& value)
+    {
+        auto newEnd = std::remove(c.begin(), c.end(), value);
+        const auto removed = static_cast<typename inplace_vector<T, N>::size_type>(c.end() - newEnd);
+        c.erase(newEnd, c.end());
+        return removed;
+    }
+
+    template <class T, std::size_t N, class Predicate>
+    constexpr typename inplace_vector<T, N>::size_type erase_if(inplace_vector<T, N>& c, Predicate pred)
+    {
+        auto newEnd = std::remove_if(c.begin(), c.end(), pred);
+        const auto removed = static_cast<typename inplace_vector<T, N>::size_type>(c.end() - newEnd);
+        c.erase(newEnd, c.end());
+        return removed;
+    }
+}
@@ -0,0 +1,45 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/atomic.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace StdReimpl
+{
+    /**
+     * @brief A single-use counter that threads block on until it reaches zero, e.g., to wait until a set of workers has
+     *        started up.
+     *
+     *        The counter is four bytes, so that waiting threads park on it directly with `futex(2)` on Linux, through the
+     *        same spin-then-park layer as `atomic_ref::wait`. Only the thread that brings it to zero wakes anyone.
+     * @see https://eel.is/c++draft/thread.latch
+     * @see https://cppreference.com/w/cpp/thread/latch
+     * @note A feature from the C++20 standard.
+     */
+    class latch
+    {
+    public:
+        static constexpr std::ptrdiff_t max() noexcept;
+
+        constexpr explicit latch(std::ptrdiff_t expected);
+        ~latch() = default;
+
+        latch(const latch&) = delete;
+        latch& operator=(const latch&) = delete;
+
+        void count_down(std::ptrdiff_t update = 1);
+        bool try_wait() const noexcept;
+        void wait() const;
+        void arrive_and_wait(std::ptrdiff_t update = 1);
+
+    private:
+        std::atomic<std::int32_t> counter;
+    };
+}
+
+#include <CppUtils/StdReimpl/latch.inl>
@@ -0,0 +1,57 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/latch.h>
+
+#include <cassert>
+#include <limits>
+
+namespace StdReimpl
+{
+    constexpr std::ptrdiff_t latch::max() noexcept
+    {
+        return std::numeric_limits<std::int32_t>::max();
+    }
+
+    constexpr latch::latch(std::ptrdiff_t expected)
+        : counter(static_cast<std::int32_t>(expected))
+    {
+        assert(expected >= 0 && expected <= max());
+    }
+
+    inline void latch::count_down(std::ptrdiff_t update)
+    {
+        const std::int32_t old = counter.fetch_sub(static_cast<std::int32_t>(update), std::memory_order_release);
+        assert(update >= 0 && update <= old);
+        if (old == update)
+        {
+            Detail::atomic_notify<Detail::atomic_wait_is_native_for_atomic<std::int32_t>>(&counter, true);
+        }
+    }
+
+    inline bool latch::try_wait() const noexcept
+    {
+        return counter.load(std::memory_order_acquire) == 0;
+    }
+
+    inline void latch::wait() const
+    {
+        while (true)
+        {
+            const std::int32_t current = counter.load(std::memory_order_acquire);
+            if (current == 0)
+            {
+                return;
+            }
+            Detail::atomic_wait<Detail::atomic_wait_is_native_for_atomic<std::int32_t>>(&counter, current,
+                [this]() { return counter.load(std::memory_order_acquire); });
+        }
+    }
+
+    inline void latch::arrive_and_wait(std::ptrdiff_t update)
+    {
+        count_down(update);
+        wait();
+    }
+}
@@ -0,0 +1,763 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/concepts.h>
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace StdReimpl
+{
+    /**
+     * @see https://eel.is/c++draft/views.multidim
+     */
+    using std::dynamic_extent;
+
+    namespace Detail
+    {
+        /**
+         * @brief The dynamic extents of an `extents`. Empty when there are none, so that fully static extents take no
+         *        storage.
+         */
+        template <class IndexType, std::size_t N>
+        struct extents_storage
+        {
+            IndexType values[N];
+
+            constexpr IndexType& operator[](std::size_t i) noexcept { return values[i]; }
+            constexpr IndexType operator[](std::size_t i) const noexcept { return values[i]; }
+        };
+
+        template <class IndexType>
+        struct extents_storage<IndexType, 0>
+        {
+            // Never called, since every extent is static. Only here so that code indexing by rank compiles.
+            constexpr IndexType operator[](std::size_t) const noexcept { return 0; }
+        };
+
+        template <class T>
+        inline constexpr bool is_extents_v = false;
+
+        /**
+         * @see https://eel.is/c++draft/mdspan.layout.reqmts
+         */
+        template <class M>
+        concept layout_mapping_alike = requires
+        {
+            requires is_extents_v<typename M::extents_type>;
+            { M::is_always_strided() } -> StdReimpl::same_as<bool>;
+            { M::is_always_exhaustive() } -> StdReimpl::same_as<bool>;
+            { M::is_always_unique() } -> StdReimpl::same_as<bool>;
+            std::bool_constant<M::is_always_strided()>::value;
+            std::bool_constant<M::is_always_exhaustive()>::value;
+            std::bool_constant<M::is_always_unique()>::value;
+        };
+
+        /**
+         * @brief Whether `Mapping` is `Layout`'s mapping of its own extents.
+         */
+        template <class Layout, class Mapping>
+        inline constexpr bool is_mapping_of_v =
+            std::is_same_v<typename Layout::template mapping<typename Mapping::extents_type>, Mapping>;
+
+        /**
+         * @brief The product of the extents in `[begin, end)`.
+         */
+        template <class Extents>
+        constexpr typename Extents::index_type extents_product(const Extents& exts, std::size_t begin, std::size_t end) noexcept;
+
+        /**
+         * @brief Whether the product of `exts`'s extents is representable as `IndexType`.
+         */
+        template <class IndexType, class Extents>
+        constexpr bool extents_product_fits(const Extents& exts) noexcept;
+
+        /**
+         * @brief `std::assume_aligned`, or the builtin it's made of where `<memory>` doesn't have it.
+         */
+        template <std::size_t N, class T>
+        [[nodiscard]] constexpr T* assume_aligned(T* ptr) noexcept;
+    }
+
+    /**
+     * @brief The extents of each dimension of a multidimensional index space, each of which is either known at compile
+     *        time or `dynamic_extent`. Only the dynamic ones are stored, so fully static extents are an empty class.
+     * @see https://eel.is/c++draft/mdspan.extents
+     * @see https://cppreference.com/w/cpp/container/mdspan/extents
+     * @note A feature from the C++23 standard.
+     */
+    template <class IndexType, std::size_t... Extents>
+    class extents
+    {
+        static_assert(StdReimpl::integral<IndexType> && !std::is_same_v<std::remove_cv_t<IndexType>, bool>,
+            "extents' index type must be a signed or unsigned integer type.");
+        static_assert(((Extents == dynamic_extent || std::in_range<IndexType>(Extents)) && ...),
+            "Each static extent must be representable as the index type.");
+
+    public:
+        using index_type = IndexType;
+        using size_type = std::make_unsigned_t<index_type>;
+        using rank_type = std::size_t;
+
+        static constexpr rank_type rank() noexcept { return rank_count; }
+        static constexpr rank_type rank_dynamic() noexcept { return rank_dynamic_count; }
+        static constexpr std::size_t static_extent(rank_type r) noexcept;
+        constexpr index_type extent(rank_type r) const noexcept;
+
+        constexpr extents() noexcept = default;
+
+        template <class OtherIndexType, std::size_t... OtherExtents>
+            requires (sizeof...(OtherExtents) == sizeof...(Extents) &&
+                ((OtherExtents == dynamic_extent || Extents == dynamic_extent || OtherExtents == Extents) && ...))
+        constexpr explicit(((Extents != dynamic_extent && OtherExtents == dynamic_extent) || ...) ||
+            (static_cast<std::make_unsigned_t<IndexType>>(std::numeric_limits<IndexType>::max()) <
+                static_cast<std::make_unsigned_t<OtherIndexType>>(std::numeric_limits<OtherIndexType>::max())))
+            extents(const extents<OtherIndexType, OtherExtents...>& other) noexcept;
+
+        template <class... OtherIndexTypes>
+        constexpr explicit extents(OtherIndexTypes... exts) noexcept
+            requires ((std::is_convertible_v<OtherIndexTypes, index_type> && ...) &&
+                (std::is_nothrow_constructible_v<index_type, OtherIndexTypes> && ...) &&
+                (sizeof...(OtherIndexTypes) == rank_dynamic() || sizeof...(OtherIndexTypes) == rank()));
+
+        template <class OtherIndexType, std::size_t N>
+        constexpr explicit(N != rank_dynamic()) extents(std::span<OtherIndexType, N> exts) noexcept
+            requires (std::is_convertible_v<const OtherIndexType&, index_type> &&
+                std::is_nothrow_constructible_v<index_type, const OtherIndexType&> &&
+                (N == rank_dynamic() || N == rank()));
+
+        template <class OtherIndexType, std::size_t N>
+        constexpr explicit(N != rank_dynamic()) extents(const std::array<OtherIndexType, N>& exts) noexcept
+            requires (std::is_convertible_v<const OtherIndexType&, index_type> &&
+                std::is_nothrow_constructible_v<index_type, const OtherIndexType&> &&
+                (N == rank_dynamic() || N == rank()));
+
+        template <class OtherIndexType, std::size_t... OtherExtents>
+        friend constexpr bool operator==(const extents& lhs, const extents<OtherIndexType, OtherExtents...>& rhs) noexcept
+        {
+            if constexpr (rank() != sizeof...(OtherExtents))
+            {
+                return false;
+            }
+            else
+            {
+                for (rank_type r = 0; r < rank(); ++r)
+                {
+                    if (std::cmp_not_equal(lhs.extent(r), rhs.extent(r)))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }
+
+    private:
+        template <class, std::size_t...>
+        friend class extents;
+
+        // Not `rank()` and `rank_dynamic()`, which can't be called until the class is complete.
+        static constexpr rank_type rank_count = sizeof...(Extents);
+        static constexpr rank_type rank_dynamic_count = ((Extents == dynamic_extent) + ... + 0);
+
+        static constexpr std::size_t static_extents[rank_count + 1] = {Extents..., 0};
+
+        /**
+         * @brief For each rank, its index in `dynamic_extents`, if it's dynamic.
+         */
+        static constexpr std::array<rank_type, rank_count + 1> dynamic_index = []()
+            {
+                std::array<rank_type, rank_count + 1> result{};
+                rank_type count = 0;
+                for (rank_type r = 0; r < rank_count; ++r)
+                {
+                    result[r] = count;
+                    count += static_extents[r] == dynamic_extent;
+                }
+                result[rank_count] = count;
+                return result;
+            }();
+
+        /**
+         * @brief Sets the dynamic extents from `N` extents, which are either all of them or only the dynamic ones.
+         */
+        template <std::size_t N, class OtherIndexType>
+        constexpr void InitializeFrom(const OtherIndexType* exts) noexcept;
+
+        CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Detail::extents_storage<index_type, rank_dynamic_count> dynamic_extents{};
+    };
+
+    namespace Detail
+    {
+        template <class IndexType, std::size_t... Extents>
+        inline constexpr bool is_extents_v<StdReimpl::extents<IndexType, Extents...>> = true;
+
+        template <class IndexType, class Sequence>
+        struct make_dextents;
+
+        template <class IndexType, std::size_t... I>
+        struct make_dextents<IndexType, std::index_sequence<I...>>
+        {
+            using type = StdReimpl::extents<IndexType, ((void)I, dynamic_extent)...>;
+        };
+    }
+
+    template <class... Integrals>
+        requires (std::is_convertible_v<Integrals, std::size_t> && ...)
+    explicit extents(Integrals...) -> extents<std::size_t, ((void)sizeof(Integrals), dynamic_extent)...>;
+
+    /**
+     * @see https://eel.is/c++draft/mdspan.extents.dextents
+     * @note A feature from the C++23 standard.
+     */
+    template <class IndexType, std::size_t Rank>
+    using dextents = typename Detail::make_dextents<IndexType, std::make_index_sequence<Rank>>::type;
+
+    /**
+     * @see https://eel.is/c++draft/mdspan.extents.dims
+     * @note A feature from the C++26 standard.
+     */
+    template <std::size_t Rank, class IndexType = std::size_t>
+    using dims = dextents<IndexType, Rank>;
+
+    /**
+     * @brief Column major: the leftmost index is contiguous, as in Fortran and most BLAS.
+     * @see https://eel.is/c++draft/mdspan.layout.left
+     * @note A feature from the C++23 standard.
+     */
+    struct layout_left
+    {
+        template <class Extents>
+        class mapping;
+    };
+
+    /**
+     * @brief Row major: the rightmost index is contiguous, as in C arrays.
+     * @see https://eel.is/c++draft/mdspan.layout.right
+     * @note A feature from the C++23 standard.
+     */
+    struct layout_right
+    {
+        template <class Extents>
+        class mapping;
+    };
+
+    /**
+     * @brief An arbitrary stride per dimension, e.g., for a sub-image of a larger image.
+     * @see https://eel.is/c++draft/mdspan.layout.stride
+     * @note A feature from the C++23 standard.
+     */
+    struct layout_stride
+    {
+        template <class Extents>
+        class mapping;
+    };
+
+    /**
+     * @see https://eel.is/c++draft/mdspan.layout.left.overview
+     * @note A feature from the C++23 standard.
+     */
+    template <class Extents>
+    class layout_left::mapping
+    {
+        static_assert(Detail::is_extents_v<Extents>, "layout_left::mapping requires an extents.");
+
+    public:
+        using extents_type = Extents;
+        using index_type = typename extents_type::index_type;
+        using size_type = typename extents_type::size_type;
+        using rank_type = typename extents_type::rank_type;
+        using layout_type = layout_left;
+
+        constexpr mapping() noexcept = default;
+        constexpr mapping(const mapping&) noexcept = default;
+        constexpr mapping(const extents_type& e) noexcept;
+
+        template <class OtherExtents>
+            requires std::is_constructible_v<extents_type, OtherExtents>
+        constexpr explicit(!std::is_convertible_v<OtherExtents, extents_type>) mapping(const mapping<OtherExtents>& other) noexcept;
+
+        template <class OtherExtents>
+            requires (extents_type::rank() <= 1 && std::is_constructible_v<extents_type, OtherExtents>)
+        constexpr explicit(!std::is_convertible_v<OtherExtents, extents_type>)
+            mapping(const layout_right::mapping<OtherExtents>& other) noexcept;
+
+        template <class OtherExtents>
+            requires std::is_constructible_v<extents_type, OtherExtents>
+        constexpr explicit(extents_type::rank() > 0) mapping(const layout_stride::mapping<OtherExtents>& other) noexcept;
+
+        constexpr mapping& operator=(const mapping&) noexcept = default;
+
+        constexpr const extents_type& extents() const noexcept { return exts; }
+        constexpr index_type required_span_size() const noexcept;
+
+        template <class... Indices>
+            requires (sizeof...(Indices) == extents_type::rank() &&
+                (std::is_convertible_v<Indices, index_type> && ...) &&
+                (std::is_nothrow_constructible_v<index_type, Indices> && ...))
+        constexpr index_type operator()(Indices... indices) const noexcept;
+
+        static constexpr bool is_always_unique() noexcept { return true; }
+        static constexpr bool is_always_exhaustive() noexcept { return true; }
+        static constexpr bool is_always_strided() noexcept { return true; }
+        static constexpr bool is_unique() noexcept { return true; }
+        static constexpr bool is_exhaustive() noexcept { return true; }
+        static constexpr bool is_strided() noexcept { return true; }
+
+        constexpr index_type stride(rank_type r) const noexcept
+            requires (extents_type::rank() > 0);
+
+        template <class OtherExtents>
+            requires (OtherExtents::rank() == extents_type::rank())
+        friend constexpr bool operator==(const mapping& x, const mapping<OtherExtents>& y) noexcept
+        {
+            return x.extents() == y.extents();
+        }
+
+    private:
+        template <std::size_t... R, class... Indices>
+        constexpr index_type Offset(std::index_sequence<R...>, Indices... indices) const noexcept;
+
+        CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS extents_type exts{};
+    };
+
+    /**
+     * @see https://eel.is/c++draft/mdspan.layout.right.overview
+     * @note A feature from the C++23 standard.
+     */
+    template <class Extents>
+    class layout_right::mapping
+    {
+        static_assert(Detail::is_extents_v<Extents>, "layout_right::mapping requires an extents.");
+
+    public:
+        using extents_type = Extents;
+        using index_type = typename extents_type::index_type;
+        using size_type = typename extents_type::size_type;
+        using rank_type = typename extents_type::rank_type;
+        using layout_type = layout_right;
+
+        constexpr mapping() noexcept = default;
+        constexpr mapping(const mapping&) noexcept = default;
+        constexpr mapping(const extents_type& e) noexcept;
+
+        template <class OtherExtents>
+            requires std::is_constructible_v<extents_type, OtherExtents>
+        constexpr explicit(!std::is_convertible_v<OtherExtents, extents_type>) mapping(const mapping<OtherExtents>& other) noexcept;
+
+        template <class OtherExtents>
+            requires (extents_type::rank() <= 1 && std::is_constructible_v<extents_type, OtherExtents>)
+        constexpr explicit(!std::is_convertible_v<OtherExtents, extents_type>)
+            mapping(const layout_left::mapping<OtherExtents>& other) noexcept;
+
+        template <class OtherExtents>
+            requires std::is_constructible_v<extents_type, OtherExtents>
+        constexpr explicit(extents_type::rank() > 0) mapping(const layout_stride::mapping<OtherExtents>& other) noexcept;
+
+        constexpr mapping& operator=(const mapping&) noexcept = default;
+
+        constexpr const extents_type& extents() const noexcept { return exts; }
+        constexpr index_type required_span_size() const noexcept;
+
+        template <class... Indices>
+            requires (sizeof...(Indices) == extents_type::rank() &&
+                (std::is_convertible_v<Indices, index_type> && ...) &&
+                (std::is_nothrow_constructible_v<index_type, Indices> && ...))
+        constexpr index_type operator()(Indices... indices) const noexcept;
+
+        static constexpr bool is_always_unique() noexcept { return true; }
+        static constexpr bool is_always_exhaustive() noexcept { return true; }
+        static constexpr bool is_always_strided() noexcept { return true; }
+        static constexpr bool is_unique() noexcept { return true; }
+        static constexpr bool is_exhaustive() noexcept { return true; }
+        static constexpr bool is_strided() noexcept { return true; }
+
+        constexpr index_type stride(rank_type r) const noexcept
+            requires (extents_type::rank() > 0);
+
+        template <class OtherExtents>
+            requires (OtherExtents::rank() == extents_type::rank())
+        friend constexpr bool operator==(const mapping& x, const mapping<OtherExtents>& y) noexcept
+        {
+            return x.extents() == y.extents();
+        }
+
+    private:
+        template <std::size_t... R, class... Indices>
+        constexpr index_type Offset(std::index_sequence<R...>, Indices... indices) const noexcept;
+
+        CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS extents_type exts{};
+    };
+
+    /**
+     * @see https://eel.is/c++draft/mdspan.layout.stride.overview
+     * @note A feature from the C++23 standard.
+     */
+    template <class Extents>
+    class layout_stride::mapping
+    {
+        static_assert(Detail::is_extents_v<Extents>, "layout_stride::mapping requires an extents.");
+
+    public:
+        using extents_type = Extents;
+        using index_type = typename extents_type::index_type;
+        using size_type = typename extents_type::size_type;
+        using rank_type = typename extents_type::rank_type;
+        using layout_type = layout_stride;
+
+        /**
+         * @brief Has the strides of `layout_right`.
+         */
+        constexpr mapping() noexcept;
+        constexpr mapping(const mapping&) noexcept = default;
+
+        template <class OtherIndexType>
+            requires (std::is_convertible_v<const OtherIndexType&, index_type> &&
+                std::is_nothrow_constructible_v<index_type, const OtherIndexType&>)
+        constexpr mapping(const extents_type& e, std::span<OtherIndexType, extents_type::rank()> s) noexcept;
+
+        template <class OtherIndexType>
+            requires (std::is_convertible_v<const OtherIndexType&, index_type> &&
+                std::is_nothrow_constructible_v<index_type, const OtherIndexType&>)
+        constexpr mapping(const extents_type& e, const std::array<OtherIndexType, extents_type::rank()>& s) noexcept;
+
+        template <class StridedLayoutMapping>
+            requires (Detail::layout_mapping_alike<StridedLayoutMapping> &&
+                std::is_constructible_v<extents_type, typename StridedLayoutMapping::extents_type> &&
+                StridedLayoutMapping::is_always_unique() && StridedLayoutMapping::is_always_strided())
+        constexpr explicit(!(std::is_convertible_v<typename StridedLayoutMapping::extents_type, extents_type> &&
+            (Detail::is_mapping_of_v<layout_left, StridedLayoutMapping> ||
+                Detail::is_mapping_of_v<layout_right, StridedLayoutMapping> ||
+                Detail::is_mapping_of_v<layout_stride, StridedLayoutMapping>)))
+            mapping(const StridedLayoutMapping& other) noexcept;
+
+        constexpr mapping& operator=(const mapping&) noexcept = default;
+
+        constexpr const extents_type& extents() const noexcept { return exts; }
+        constexpr std::array<index_type, extents_type::rank()> strides() const noexcept { return strides_array; }
+        constexpr index_type required_span_size() const noexcept;
+
+        template <class... Indices>
+            requires (sizeof...(Indices) == extents_type::rank() &&
+                (std::is_convertible_v<Indices, index_type> && ...) &&
+                (std::is_nothrow_constructible_v<index_type, Indices> && ...))
+        constexpr index_type operator()(Indices... indices) const noexcept;
+
+        static constexpr bool is_always_unique() noexcept { return true; }
+        static constexpr bool is_always_exhaustive() noexcept { return false; }
+        static constexpr bool is_always_strided() noexcept { return true; }
+        static constexpr bool is_unique() noexcept { return true; }
+        constexpr bool is_exhaustive() const noexcept;
+        static constexpr bool is_strided() noexcept { return true; }
+
+        constexpr index_type stride(rank_type r) const noexcept { return strides_array[r]; }
+
+        template <class OtherMapping>
+            requires (Detail::layout_mapping_alike<OtherMapping> &&
+                OtherMapping::extents_type::rank() == extents_type::rank() && OtherMapping::is_always_strided())
+        friend constexpr bool operator==(const mapping& x, const OtherMapping& y) noexcept
+        {
+            if (x.extents() != y.extents() || !mapping::IsZeroOffset(y))
+            {
+                return false;
+            }
+            if constexpr (extents_type::rank() > 0)
+            {
+                for (rank_type r = 0; r < extents_type::rank(); ++r)
+                {
+                    if (std::cmp_not_equal(x.stride(r), y.stride(r)))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+    private:
+        /**
+         * @brief Whether `m` maps the zero multidimensional index to zero.
+         */
+        template <class OtherMapping>
+        static constexpr bool IsZeroOffset(const OtherMapping& m) noexcept;
+
+        template <std::size_t... R, class... Indices>
+        constexpr index_type Offset(std::index_sequence<R...>, Indices... indices) const noexcept;
+
+        CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS extents_type exts{};
+        std::array<index_type, extents_type::rank()> strides_array{};
+    };
+
+    /**
+     * @see https://eel.is/c++draft/mdspan.accessor.default
+     * @note A feature from the C++23 standard.
+     */
+    template <class ElementType>
+    struct default_accessor
+    {
+        static_assert(!std::is_array_v<ElementType> && !std::is_abstract_v<ElementType>,
+            "default_accessor's element type must be a complete object type that's not abstract or an array.");
+
+        using offset_policy = default_accessor;
+        using element_type = ElementType;
+        using reference = ElementType&;
+        using data_handle_type = ElementType*;
+
+        constexpr default_accessor() noexcept = default;
+
+        template <class OtherElementType>
+            requires std::is_convertible_v<OtherElementType(*)[], element_type(*)[]>
+        constexpr default_accessor(default_accessor<OtherElementType>) noexcept {}
+
+        constexpr reference access(data_handle_type p, std::size_t i) const noexcept { return p[i]; }
+        constexpr data_handle_type offset(data_handle_type p, std::size_t i) const noexcept { return p + i; }
+    };
+
+    /**
+     * @brief Like `default_accessor`, but the data handle is aligned to `ByteAlignment`, and the compiler is told so on
+     *        every access. That lets it use aligned vector loads and stores in loops over an `mdspan`, e.g., over the
+     *        rows of an image whose width is a multiple of the vector width, without peeling off a prologue.
+     * @see https://eel.is/c++draft/mdspan.accessor.aligned
+     * @see https://cppreference.com/w/cpp/container/mdspan/aligned_accessor
+     * @note A feature from the C++26 standard. It's a precondition that the data handle is aligned; check it with
+     *       `is_sufficiently_aligned`.
+     */
+    template <class ElementType, std::size_t ByteAlignment>
+    struct aligned_accessor
+    {
+        static_assert(ByteAlignment != 0 && (ByteAlignment & (ByteAlignment - 1)) == 0,
+            "aligned_accessor's byte alignment must be a power of two.");
+        static_assert(ByteAlignment >= alignof(ElementType),
+            "aligned_accessor's byte alignment must be at least the element type's alignment.");
+
+        using offset_policy = default_accessor<ElementType>;
+        using element_type = ElementType;
+        using reference = ElementType&;
+        using data_handle_type = ElementType*;
+
+        static constexpr std::size_t byte_alignment = ByteAlignment;
+
+        constexpr aligned_accessor() noexcept = default;
+
+        template <class OtherElementType, std::size_t OtherByteAlignment>
+            requires (std::is_convertible_v<OtherElementType(*)[], element_type(*)[]> && OtherByteAlignment >= byte_alignment)
+        constexpr aligned_accessor(aligned_accessor<OtherElementType, OtherByteAlignment>) noexcept {}
+
+        template <class OtherElementType>
+            requires std::is_convertible_v<OtherElementType(*)[], element_type(*)[]>
+        constexpr explicit aligned_accessor(default_accessor<OtherElementType>) noexcept {}
+
+        template <class OtherElementType>
+            requires std::is_convertible_v<element_type(*)[], OtherElementType(*)[]>
+        constexpr operator default_accessor<OtherElementType>() const noexcept { return {}; }
+
+        constexpr reference access(data_handle_type p, std::size_t i) const noexcept;
+        constexpr typename offset_policy::data_handle_type offset(data_handle_type p, std::size_t i) const noexcept { return p + i; }
+    };
+
+    /**
+     * @brief Whether `ptr` is aligned to `Alignment`, e.g., to check the precondition of `aligned_accessor`.
+     * @see https://eel.is/c++draft/ptr.align
+     * @note A feature from the C++26 standard.
+     */
+    template <std::size_t Alignment, class T>
+    bool is_sufficiently_aligned(T* ptr);
+
+    /**
+     * @brief A non-owning multidimensional view of a contiguous, or strided, array. The layout maps a multidimensional
+     *        index to an offset, and the accessor turns the data handle and offset into a reference.
+     *
+     *        Static extents, empty layouts, and empty accessors take no storage, so, e.g.,
+     *        `mdspan<float, extents<int, 4, 4>>` is one pointer, and indexing it is the same math as a hand-written
+     *        `p[i * 4 + j]`.
+     * @see https://eel.is/c++draft/mdspan.mdspan
+     * @see https://cppreference.com/w/cpp/container/mdspan
+     * @note A feature from the C++23 standard. Since multidimensional `operator[]` is from the C++23 standard too,
+     *       `operator()` is provided as well, which is not part of the standard.
+     */
+    template <class ElementType, class Extents, class LayoutPolicy = layout_right, class AccessorPolicy = default_accessor<ElementType>>
+    class mdspan
+    {
+        static_assert(!std::is_array_v<ElementType> && !std::is_abstract_v<ElementType>,
+            "mdspan's element type must be a complete object type that's not abstract or an array.");
+        static_assert(Detail::is_extents_v<Extents>, "mdspan requires an extents.");
+        static_assert(std::is_same_v<ElementType, typename AccessorPolicy::element_type>,
+            "mdspan's element type must be the same as its accessor's.");
+
+    public:
+        using extents_type = Extents;
+        using layout_type = LayoutPolicy;
+        using accessor_type = AccessorPolicy;
+        using mapping_type = typename layout_type::template mapping<extents_type>;
+        using element_type = ElementType;
+        using value_type = std::remove_cv_t<element_type>;
+        using index_type = typename extents_type::index_type;
+        using size_type = typename extents_type::size_type;
+        using rank_type = typename extents_type::rank_type;
+        using data_handle_type = typename accessor_type::data_handle_type;
+        using reference = typename accessor_type::reference;
+
+        static constexpr rank_type rank() noexcept { return extents_type::rank(); }
+        static constexpr rank_type rank_dynamic() noexcept { return extents_type::rank_dynamic(); }
+        static constexpr std::size_t static_extent(rank_type r) noexcept { return extents_type::static_extent(r); }
+        constexpr index_type extent(rank_type r) const noexcept { return extents().extent(r); }
+
+        // Constructors.
+
+        constexpr mdspan()
+            requires (rank_dynamic() > 0 && std::is_default_constructible_v<data_handle_type> &&
+                std::is_default_constructible_v<mapping_type> && std::is_default_constructible_v<accessor_type>) = default;
+        constexpr mdspan(const mdspan&) = default;
+        constexpr mdspan(mdspan&&) = default;
+
+        template <class... OtherIndexTypes>
+        constexpr explicit mdspan(data_handle_type p, OtherIndexTypes... exts)
+            requires ((std::is_convertible_v<OtherIndexTypes, index_type> && ...) &&
+                (std::is_nothrow_constructible_v<index_type, OtherIndexTypes> && ...) &&
+                (sizeof...(OtherIndexTypes) == rank() || sizeof...(OtherIndexTypes) == rank_dynamic()) &&
+                std::is_constructible_v<mapping_type, extents_type> && std::is_default_constructible_v<accessor_type>);
+
+        template <class OtherIndexType, std::size_t N>
+        constexpr explicit(N != rank_dynamic()) mdspan(data_handle_type p, std::span<OtherIndexType, N> exts)
+            requires (std::is_convertible_v<const OtherIndexType&, index_type> &&
+                std::is_nothrow_constructible_v<index_type, const OtherIndexType&> &&
+                (N == rank() || N == rank_dynamic()) &&
+                std::is_constructible_v<mapping_type, extents_type> && std::is_default_constructible_v<accessor_type>);
+
+        template <class OtherIndexType, std::size_t N>
+        constexpr explicit(N != rank_dynamic()) mdspan(data_handle_type p, const std::array<OtherIndexType, N>& exts)
+            requires (std::is_convertible_v<const OtherIndexType&, index_type> &&
+                std::is_nothrow_constructible_v<index_type, const OtherIndexType&> &&
+                (N == rank() || N == rank_dynamic()) &&
+                std::is_constructible_v<mapping_type, extents_type> && std::is_default_constructible_v<accessor_type>);
+
+        constexpr mdspan(data_handle_type p, const extents_type& ext)
+            requires (std::is_constructible_v<mapping_type, const extents_type&> && std::is_default_constructible_v<accessor_type>);
+
+        constexpr mdspan(data_handle_type p, const mapping_type& m)
+            requires std::is_default_constructible_v<accessor_type>;
+
+        constexpr mdspan(data_handle_type p, const mapping_type& m, const accessor_type& a);
+
+        template <class OtherElementType, class OtherExtents, class OtherLayoutPolicy, class OtherAccessor>
+            requires (std::is_constructible_v<mapping_type, const typename OtherLayoutPolicy::template mapping<OtherExtents>&> &&
+                std::is_constructible_v<accessor_type, const OtherAccessor&>)
+        constexpr explicit(!std::is_convertible_v<const typename OtherLayoutPolicy::template mapping<OtherExtents>&, mapping_type> ||
+            !std::is_convertible_v<const OtherAccessor&, accessor_type>)
+            mdspan(const mdspan<OtherElementType, OtherExtents, OtherLayoutPolicy, OtherAccessor>& other);
+
+        constexpr mdspan& operator=(const mdspan&) = default;
+        constexpr mdspan& operator=(mdspan&&) = default;
+
+        // Element access.
+
+#if defined(__cpp_multidimensional_subscript)
+        template <class... OtherIndexTypes>
+        constexpr reference operator[](OtherIndexTypes... indices) const
+            requires ((std::is_convertible_v<OtherIndexTypes, index_type> && ...) &&
+                (std::is_nothrow_constructible_v<index_type, OtherIndexTypes> && ...) &&
+                sizeof...(OtherIndexTypes) == rank());
+#else
+        template <class OtherIndexType>
+        constexpr reference operator[](OtherIndexType index) const
+            requires (std::is_convertible_v<OtherIndexType, index_type> &&
+                std::is_nothrow_constructible_v<index_type, OtherIndexType> &&
+                rank() == 1);
+#endif
+
+        template <class OtherIndexType>
+        constexpr reference operator[](std::span<OtherIndexType, rank()> indices) const
+            requires (std::is_convertible_v<const OtherIndexType&, index_type> &&
+                std::is_nothrow_constructible_v<index_type, const OtherIndexType&>);
+
+        template <class OtherIndexType>
+        constexpr reference operator[](const std::array<OtherIndexType, rank()>& indices) const
+            requires (std::is_convertible_v<const OtherIndexType&, index_type> &&
+                std::is_nothrow_constructible_v<index_type, const OtherIndexType&>);
+
+        /**
+         * @brief The same as the multidimensional `operator[]`, for compilers without it.
+         * @note Not part of the standard.
+         */
+        template <class... OtherIndexTypes>
+        constexpr reference operator()(OtherIndexTypes... indices) const
+            requires ((std::is_convertible_v<OtherIndexTypes, index_type> && ...) &&
+                (std::is_nothrow_constructible_v<index_type, OtherIndexTypes> && ...) &&
+                sizeof...(OtherIndexTypes) == rank());
+
+        // Observers.
+
+        constexpr size_type size() const noexcept;
+        [[nodiscard]] constexpr bool empty() const noexcept;
+
+        friend constexpr void swap(mdspan& x, mdspan& y) noexcept
+        {
+            using std::swap;
+            swap(x.ptr, y.ptr);
+            swap(x.map, y.map);
+            swap(x.acc, y.acc);
+        }
+
+        constexpr const extents_type& extents() const noexcept { return map.extents(); }
+        constexpr const data_handle_type& data_handle() const noexcept { return ptr; }
+        constexpr const mapping_type& mapping() const noexcept { return map; }
+        constexpr const accessor_type& accessor() const noexcept { return acc; }
+
+        static constexpr bool is_always_unique() { return mapping_type::is_always_unique(); }
+        static constexpr bool is_always_exhaustive() { return mapping_type::is_always_exhaustive(); }
+        static constexpr bool is_always_strided() { return mapping_type::is_always_strided(); }
+
+        constexpr bool is_unique() const { return map.is_unique(); }
+        constexpr bool is_exhaustive() const { return map.is_exhaustive(); }
+        constexpr bool is_strided() const { return map.is_strided(); }
+        constexpr index_type stride(rank_type r) const { return map.stride(r); }
+
+    private:
+        template <class, class, class, class>
+        friend class mdspan;
+
+        template <std::size_t... R, class OtherIndexType>
+        constexpr reference AccessArray(std::index_sequence<R...>, const OtherIndexType* indices) const;
+
+        CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS accessor_type acc{};
+        CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS mapping_type map{};
+        data_handle_type ptr{};
+    };
+
+    template <class CArray>
+        requires (std::is_array_v<CArray> && std::rank_v<CArray> == 1)
+    mdspan(CArray&) -> mdspan<std::remove_all_extents_t<CArray>, extents<std::size_t, std::extent_v<CArray, 0>>>;
+
+    template <class Pointer>
+        requires std::is_pointer_v<std::remove_reference_t<Pointer>>
+    mdspan(Pointer&&) -> mdspan<std::remove_pointer_t<std::remove_reference_t<Pointer>>, extents<std::size_t>>;
+
+    template <class ElementType, class... Integrals>
+        requires ((std::is_convertible_v<Integrals, std::size_t> && ...) && sizeof...(Integrals) > 0)
+    explicit mdspan(ElementType*, Integrals...) -> mdspan<ElementType, dextents<std::size_t, sizeof...(Integrals)>>;
+
+    template <class ElementType, class OtherIndexType, std::size_t N>
+    mdspan(ElementType*, std::span<OtherIndexType, N>) -> mdspan<ElementType, dextents<std::size_t, N>>;
+
+    template <class ElementType, class OtherIndexType, std::size_t N>
+    mdspan(ElementType*, const std::array<OtherIndexType, N>&) -> mdspan<ElementType, dextents<std::size_t, N>>;
+
+    template <class ElementType, class IndexType, std::size_t... ExtentsPack>
+    mdspan(ElementType*, const extents<IndexType, ExtentsPack...>&) -> mdspan<ElementType, extents<IndexType, ExtentsPack...>>;
+
+    template <class ElementType, class MappingType>
+    mdspan(ElementType*, const MappingType&)
+        -> mdspan<ElementType, typename MappingType::extents_type, typename MappingType::layout_type>;
+
+    template <class MappingType, class AccessorType>
+    mdspan(const typename AccessorType::data_handle_type&, const MappingType&, const AccessorType&)
+        -> mdspan<typename AccessorType::element_type, typename MappingType::extents_type, typename MappingType::layout_type, AccessorType>;
+}
+
+#include <CppUtils/StdReimpl/mdspan.inl>
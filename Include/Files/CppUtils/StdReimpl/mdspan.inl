@@ -0,0 +1,575 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/mdspan.h>
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        template <class Extents>
+        constexpr typename Extents::index_type extents_product(const Extents& exts, std::size_t begin, std::size_t end) noexcept
+        {
+            typename Extents::index_type result = 1;
+            for (std::size_t r = begin; r < end; ++r)
+            {
+                result *= exts.extent(r);
+            }
+            return result;
+        }
+
+        template <class IndexType, class Extents>
+        constexpr bool extents_product_fits(const Extents& exts) noexcept
+        {
+            using unsigned_type = std::make_unsigned_t<IndexType>;
+            constexpr unsigned_type max = static_cast<unsigned_type>(std::numeric_limits<IndexType>::max());
+
+            unsigned_type product = 1;
+            for (std::size_t r = 0; r < Extents::rank(); ++r)
+            {
+                const unsigned_type extent = static_cast<unsigned_type>(exts.extent(r));
+                if (extent == 0)
+                {
+                    return true;
+                }
+                if (product > max / extent)
+                {
+                    return false;
+                }
+                product *= extent;
+            }
+            return true;
+        }
+
+        template <std::size_t N, class T>
+        constexpr T* assume_aligned(T* ptr) noexcept
+        {
+#if defined(__cpp_lib_assume_aligned)
+            return std::assume_aligned<N>(ptr);
+#elif defined(__GNUC__) || defined(__clang__)
+            if (std::is_constant_evaluated())
+            {
+                return ptr;
+            }
+            return static_cast<T*>(__builtin_assume_aligned(ptr, N));
+#else
+            return ptr;
+#endif
+        }
+    }
+
+    template <class IndexType, std::size_t... Extents>
+    constexpr std::size_t extents<IndexType, Extents...>::static_extent(rank_type r) noexcept
+    {
+        assert(r < rank());
+        return static_extents[r];
+    }
+
+    template <class IndexType, std::size_t... Extents>
+    constexpr typename extents<IndexType, Extents...>::index_type extents<IndexType, Extents...>::extent(rank_type r) const noexcept
+    {
+        assert(r < rank());
+        if constexpr (rank_dynamic_count == 0)
+        {
+            return static_cast<index_type>(static_extents[r]);
+        }
+        else
+        {
+            return static_extents[r] == dynamic_extent ? dynamic_extents[dynamic_index[r]] : static_cast<index_type>(static_extents[r]);
+        }
+    }
+
+    template <class IndexType, std::size_t... Extents>
+    template <class OtherIndexType, std::size_t... OtherExtents>
+        requires (sizeof...(OtherExtents) == sizeof...(Extents) &&
+            ((OtherExtents == dynamic_extent || Extents == dynamic_extent || OtherExtents == Extents) && ...))
+    constexpr extents<IndexType, Extents...>::extents(const extents<OtherIndexType, OtherExtents...>& other) noexcept
+    {
+        for (rank_type r = 0; r < rank_count; ++r)
+        {
+            assert(std::in_range<index_type>(other.extent(r)));
+            assert(static_extents[r] == dynamic_extent || std::cmp_equal(other.extent(r), static_extents[r]));
+            if constexpr (rank_dynamic_count > 0)
+            {
+                if (static_extents[r] == dynamic_extent)
+                {
+                    dynamic_extents[dynamic_index[r]] = static_cast<index_type>(other.extent(r));
+                }
+            }
+        }
+    }
+
+    template <class IndexType, std::size_t... Extents>
+    template <class... OtherIndexTypes>
+    constexpr extents<IndexType, Extents...>::extents(OtherIndexTypes... exts) noexcept
+        requires ((std::is_convertible_v<OtherIndexTypes, index_type> && ...) &&
+            (std::is_nothrow_constructible_v<index_type, OtherIndexTypes> && ...) &&
+            (sizeof...(OtherIndexTypes) == rank_dynamic() || sizeof...(OtherIndexTypes) == rank()))
+    {
+        const std::array<index_type, sizeof...(OtherIndexTypes)> values = {static_cast<index_type>(std::move(exts))...};
+        InitializeFrom<sizeof...(OtherIndexTypes)>(values.data());
+    }
+
+    template <class IndexType, std::size_t... Extents>
+    template <class OtherIndexType, std::size_t N>
+    constexpr extents<IndexType, Extents...>::extents(std::span<OtherIndexType, N> exts) noexcept
+        requires (std::is_convertible_v<const OtherIndexType&, index_type> &&
+            std::is_nothrow_constructible_v<index_type, const OtherIndexType&> &&
+            (N == rank_dynamic() || N == rank()))
+    {
+        InitializeFrom<N>(static_cast<const OtherIndexType*>(exts.data()));
+    }
+
+    template <class IndexType, std::size_t... Extents>
+    template <class OtherIndexType, std::size_t N>
+    constexpr extents<IndexType, Extents...>::extents(const std::array<OtherIndexType, N>& exts) noexcept
+        requires (std::is_convertible_v<const OtherIndexType&, index_type> &&
+            std::is_nothrow_constructible_v<index_type, const OtherIndexType&> &&
+            (N == rank_dynamic() || N == rank()))
+    {
+        InitializeFrom<N>(exts.data());
+    }
+
+    template <class IndexType, std::size_t... Extents>
+    template <std::size_t N, class OtherIndexType>
+    constexpr void extents<IndexType, Extents...>::InitializeFrom(const OtherIndexType* exts) noexcept
+    {
+        for (rank_type r = 0; r < rank_count; ++r)
+        {
+            if (static_extents[r] == dynamic_extent)
+            {
+                if constexpr (rank_dynamic_count > 0)
+                {
+                    const index_type value = static_cast<index_type>(exts[N == rank_count ? r : dynamic_index[r]]);
+                    assert(!std::cmp_less(value, 0));
+                    dynamic_extents[dynamic_index[r]] = value;
+                }
+            }
+            else if constexpr (N == rank_count)
+            {
+                assert(std::cmp_equal(static_cast<index_type>(exts[r]), static_extents[r]));
+            }
+        }
+    }
+
+    template <class Extents>
+    constexpr layout_left::mapping<Extents>::mapping(const extents_type& e) noexcept
+        : exts(e)
+    {
+        assert(Detail::extents_product_fits<index_type>(e));
+    }
+
+    template <class Extents>
+    template <class OtherExtents>
+        requires std::is_constructible_v<Extents, OtherExtents>
+    constexpr layout_left::mapping<Extents>::mapping(const mapping<OtherExtents>& other) noexcept
+        : exts(other.extents())
+    {
+        assert(Detail::extents_product_fits<index_type>(other.extents()));
+    }
+
+    template <class Extents>
+    template <class OtherExtents>
+        requires (Extents::rank() <= 1 && std::is_constructible_v<Extents, OtherExtents>)
+    constexpr layout_left::mapping<Extents>::mapping(const layout_right::mapping<OtherExtents>& other) noexcept
+        : exts(other.extents())
+    {
+        assert(Detail::extents_product_fits<index_type>(other.extents()));
+    }
+
+    template <class Extents>
+    template <class OtherExtents>
+        requires std::is_constructible_v<Extents, OtherExtents>
+    constexpr layout_left::mapping<Extents>::mapping(const layout_stride::mapping<OtherExtents>& other) noexcept
+        : exts(other.extents())
+    {
+        for (rank_type r = 0; r < extents_type::rank(); ++r)
+        {
+            assert(std::cmp_equal(other.stride(r), Detail::extents_product(exts, 0, r)));
+        }
+    }
+
+    template <class Extents>
+    constexpr typename layout_left::mapping<Extents>::index_type layout_left::mapping<Extents>::required_span_size() const noexcept
+    {
+        return Detail::extents_product(exts, 0, extents_type::rank());
+    }
+
+    template <class Extents>
+    template <class... Indices>
+        requires (sizeof...(Indices) == Extents::rank() &&
+            (std::is_convertible_v<Indices, typename Extents::index_type> && ...) &&
+            (std::is_nothrow_constructible_v<typename Extents::index_type, Indices> && ...))
+    constexpr typename layout_left::mapping<Extents>::index_type layout_left::mapping<Extents>::operator()(Indices... indices) const noexcept
+    {
+        return Offset(std::make_index_sequence<extents_type::rank()>(), static_cast<index_type>(std::move(indices))...);
+    }
+
+    template <class Extents>
+    constexpr typename layout_left::mapping<Extents>::index_type layout_left::mapping<Extents>::stride(rank_type r) const noexcept
+        requires (Extents::rank() > 0)
+    {
+        return Detail::extents_product(exts, 0, r);
+    }
+
+    template <class Extents>
+    template <std::size_t... R, class... Indices>
+    constexpr typename layout_left::mapping<Extents>::index_type layout_left::mapping<Extents>::Offset(std::index_sequence<R...>, Indices... indices) const noexcept
+    {
+        assert(((!std::cmp_less(indices, 0) && std::cmp_less(indices, exts.extent(R))) && ...));
+
+        // The leftmost index has stride 1, and each stride is the previous one times the previous extent.
+        index_type result = 0;
+        [[maybe_unused]] index_type stride = 1;
+        ((result += indices * stride, stride *= exts.extent(R)), ...);
+        return result;
+    }
+
+    template <class Extents>
+    constexpr layout_right::mapping<Extents>::mapping(const extents_type& e) noexcept
+        : exts(e)
+    {
+        assert(Detail::extents_product_fits<index_type>(e));
+    }
+
+    template <class Extents>
+    template <class OtherExtents>
+        requires std::is_constructible_v<Extents, OtherExtents>
+    constexpr layout_right::mapping<Extents>::mapping(const mapping<OtherExtents>& other) noexcept
+        : exts(other.extents())
+    {
+        assert(Detail::extents_product_fits<index_type>(other.extents()));
+    }
+
+    template <class Extents>
+    template <class OtherExtents>
+        requires (Extents::rank() <= 1 && std::is_constructible_v<Extents, OtherExtents>)
+    constexpr layout_right::mapping<Extents>::mapping(const layout_left::mapping<OtherExtents>& other) noexcept
+        : exts(other.extents())
+    {
+        assert(Detail::extents_product_fits<index_type>(other.extents()));
+    }
+
+    template <class Extents>
+    template <class OtherExtents>
+        requires std::is_constructible_v<Extents, OtherExtents>
+    constexpr layout_right::mapping<Extents>::mapping(const layout_stride::mapping<OtherExtents>& other) noexcept
+        : exts(other.extents())
+    {
+        for (rank_type r = 0; r < extents_type::rank(); ++r)
+        {
+            assert(std::cmp_equal(other.stride(r), Detail::extents_product(exts, r + 1, extents_type::rank())));
+        }
+    }
+
+    template <class Extents>
+    constexpr typename layout_right::mapping<Extents>::index_type layout_right::mapping<Extents>::required_span_size() const noexcept
+    {
+        return Detail::extents_product(exts, 0, extents_type::rank());
+    }
+
+    template <class Extents>
+    template <class... Indices>
+        requires (sizeof...(Indices) == Extents::rank() &&
+            (std::is_convertible_v<Indices, typename Extents::index_type> && ...) &&
+            (std::is_nothrow_constructible_v<typename Extents::index_type, Indices> && ...))
+    constexpr typename layout_right::mapping<Extents>::index_type layout_right::mapping<Extents>::operator()(Indices... indices) const noexcept
+    {
+        return Offset(std::make_index_sequence<extents_type::rank()>(), static_cast<index_type>(std::move(indices))...);
+    }
+
+    template <class Extents>
+    constexpr typename layout_right::mapping<Extents>::index_type layout_right::mapping<Extents>::stride(rank_type r) const noexcept
+        requires (Extents::rank() > 0)
+    {
+        return Detail::extents_product(exts, r + 1, extents_type::rank());
+    }
+
+    template <class Extents>
+    template <std::size_t... R, class... Indices>
+    constexpr typename layout_right::mapping<Extents>::index_type layout_right::mapping<Extents>::Offset(std::index_sequence<R...>, Indices... indices) const noexcept
+    {
+        assert(((!std::cmp_less(indices, 0) && std::cmp_less(indices, exts.extent(R))) && ...));
+
+        // Horner's method, so there's one multiply per rank and no strides to compute: `((i0 * e1 + i1) * e2 + i2)...`.
+        index_type result = 0;
+        ((result = result * exts.extent(R) + indices), ...);
+        return result;
+    }
+
+    template <class Extents>
+    constexpr layout_stride::mapping<Extents>::mapping() noexcept
+    {
+        for (rank_type r = 0; r < extents_type::rank(); ++r)
+        {
+            strides_array[r] = Detail::extents_product(exts, r + 1, extents_type::rank());
+        }
+    }
+
+    template <class Extents>
+    template <class OtherIndexType>
+        requires (std::is_convertible_v<const OtherIndexType&, typename Extents::index_type> &&
+            std::is_nothrow_constructible_v<typename Extents::index_type, const OtherIndexType&>)
+    constexpr layout_stride::mapping<Extents>::mapping(const extents_type& e, std::span<OtherIndexType, Extents::rank()> s) noexcept
+        : exts(e)
+    {
+        for (rank_type r = 0; r < extents_type::rank(); ++r)
+        {
+            strides_array[r] = static_cast<index_type>(std::as_const(s[r]));
+            assert(strides_array[r] > 0);
+        }
+    }
+
+    template <class Extents>
+    template <class OtherIndexType>
+        requires (std::is_convertible_v<const OtherIndexType&, typename Extents::index_type> &&
+            std::is_nothrow_constructible_v<typename Extents::index_type, const OtherIndexType&>)
+    constexpr layout_stride::mapping<Extents>::mapping(const extents_type& e, const std::array<OtherIndexType, Extents::rank()>& s) noexcept
+        : exts(e)
+    {
+        for (rank_type r = 0; r < extents_type::rank(); ++r)
+        {
+            strides_array[r] = static_cast<index_type>(s[r]);
+            assert(strides_array[r] > 0);
+        }
+    }
+
+    template <class Extents>
+    template <class StridedLayoutMapping>
+        requires (Detail::layout_mapping_alike<StridedLayoutMapping> &&
+            std::is_constructible_v<Extents, typename StridedLayoutMapping::extents_type> &&
+            StridedLayoutMapping::is_always_unique() && StridedLayoutMapping::is_always_strided())
+    constexpr layout_stride::mapping<Extents>::mapping(const StridedLayoutMapping& other) noexcept
+        : exts(other.extents())
+    {
+        assert(IsZeroOffset(other));
+        for (rank_type r = 0; r < extents_type::rank(); ++r)
+        {
+            strides_array[r] = static_cast<index_type>(other.stride(r));
+        }
+    }
+
+    template <class Extents>
+    constexpr typename layout_stride::mapping<Extents>::index_type layout_stride::mapping<Extents>::required_span_size() const noexcept
+    {
+        index_type result = 1;
+        for (rank_type r = 0; r < extents_type::rank(); ++r)
+        {
+            if (exts.extent(r) == 0)
+            {
+                return 0;
+            }
+            result += (exts.extent(r) - 1) * strides_array[r];
+        }
+        return result;
+    }
+
+    template <class Extents>
+    template <class... Indices>
+        requires (sizeof...(Indices) == Extents::rank() &&
+            (std::is_convertible_v<Indices, typename Extents::index_type> && ...) &&
+            (std::is_nothrow_constructible_v<typename Extents::index_type, Indices> && ...))
+    constexpr typename layout_stride::mapping<Extents>::index_type layout_stride::mapping<Extents>::operator()(Indices... indices) const noexcept
+    {
+        return Offset(std::make_index_sequence<extents_type::rank()>(), static_cast<index_type>(std::move(indices))...);
+    }
+
+    template <class Extents>
+    constexpr bool layout_stride::mapping<Extents>::is_exhaustive() const noexcept
+    {
+        // The mapping is unique, so it hits every offset below the required span size exactly when there are that many
+        // indices.
+        return required_span_size() == Detail::extents_product(exts, 0, extents_type::rank());
+    }
+
+    template <class Extents>
+    template <class OtherMapping>
+    constexpr bool layout_stride::mapping<Extents>::IsZeroOffset(const OtherMapping& m) noexcept
+    {
+        if constexpr (OtherMapping::extents_type::rank() == 0)
+        {
+            return m() == 0;
+        }
+        else
+        {
+            if (m.required_span_size() == 0)
+            {
+                return true;
+            }
+            return [&m]<std::size_t... R>(std::index_sequence<R...>)
+                {
+                    return m(((void)R, typename OtherMapping::index_type(0))...) == 0;
+                }(std::make_index_sequence<OtherMapping::extents_type::rank()>());
+        }
+    }
+
+    template <class Extents>
+    template <std::size_t... R, class... Indices>
+    constexpr typename layout_stride::mapping<Extents>::index_type layout_stride::mapping<Extents>::Offset(std::index_sequence<R...>, Indices... indices) const noexcept
+    {
+        assert(((!std::cmp_less(indices, 0) && std::cmp_less(indices, exts.extent(R))) && ...));
+
+        return ((indices * strides_array[R]) + ... + index_type(0));
+    }
+
+    template <class ElementType, std::size_t ByteAlignment>
+    constexpr typename aligned_accessor<ElementType, ByteAlignment>::reference aligned_accessor<ElementType, ByteAlignment>::access(data_handle_type p, std::size_t i) const noexcept
+    {
+        return Detail::assume_aligned<byte_alignment>(p)[i];
+    }
+
+    template <std::size_t Alignment, class T>
+    bool is_sufficiently_aligned(T* ptr)
+    {
+        static_assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0, "The alignment must be a power of two.");
+
+        return reinterpret_cast<std::uintptr_t>(ptr) % Alignment == 0;
+    }
+
+    template <class ElementType, class Extents, class LayoutPolicy, class AccessorPolicy>
+    template <class... OtherIndexTypes>
+    constexpr mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::mdspan(data_handle_type p, OtherIndexTypes... exts)
+        requires ((std::is_convertible_v<OtherIndexTypes, index_type> && ...) &&
+            (std::is_nothrow_constructible_v<index_type, OtherIndexTypes> && ...) &&
+            (sizeof...(OtherIndexTypes) == rank() || sizeof...(OtherIndexTypes) == rank_dynamic()) &&
+            std::is_constructible_v<mapping_type, extents_type> && std::is_default_constructible_v<accessor_type>)
+        : map(extents_type(static_cast<index_type>(std::move(exts))...)), ptr(std::move(p))
+    {
+    }
+
+    template <class ElementType, class Extents, class LayoutPolicy, class AccessorPolicy>
+    template <class OtherIndexType, std::size_t N>
+    constexpr mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::mdspan(data_handle_type p, std::span<OtherIndexType, N> exts)
+        requires (std::is_convertible_v<const OtherIndexType&, index_type> &&
+            std::is_nothrow_constructible_v<index_type, const OtherIndexType&> &&
+            (N == rank() || N == rank_dynamic()) &&
+            std::is_constructible_v<mapping_type, extents_type> && std::is_default_constructible_v<accessor_type>)
+        : map(extents_type(exts)), ptr(std::move(p))
+    {
+    }
+
+    template <class ElementType, class Extents, class LayoutPolicy, class AccessorPolicy>
+    template <class OtherIndexType, std::size_t N>
+    constexpr mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::mdspan(data_handle_type p, const std::array<OtherIndexType, N>& exts)
+        requires (std::is_convertible_v<const OtherIndexType&, index_type> &&
+            std::is_nothrow_constructible_v<index_type, const OtherIndexType&> &&
+            (N == rank() || N == rank_dynamic()) &&
+            std::is_constructible_v<mapping_type, extents_type> && std::is_default_constructible_v<accessor_type>)
+        : map(extents_type(exts)), ptr(std::move(p))
+    {
+    }
+
+    template <class ElementType, class Extents, class LayoutPolicy, class AccessorPolicy>
+    constexpr mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::mdspan(data_handle_type p, const extents_type& ext)
+        requires (std::is_constructible_v<typename LayoutPolicy::template mapping<Extents>, const Extents&> &&
+            std::is_default_constructible_v<AccessorPolicy>)
+        : map(ext), ptr(std::move(p))
+    {
+    }
+
+    template <class ElementType, class Extents, class LayoutPolicy, class AccessorPolicy>
+    constexpr mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::mdspan(data_handle_type p, const mapping_type& m)
+        requires std::is_default_constructible_v<AccessorPolicy>
+        : map(m), ptr(std::move(p))
+    {
+    }
+
+    template <class ElementType, class Extents, class LayoutPolicy, class AccessorPolicy>
+    constexpr mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::mdspan(data_handle_type p, const mapping_type& m, const accessor_type& a)
+        : acc(a), map(m), ptr(std::move(p))
+    {
+    }
+
+    template <class ElementType, class Extents, class LayoutPolicy, class AccessorPolicy>
+    template <class OtherElementType, class OtherExtents, class OtherLayoutPolicy, class OtherAccessor>
+        requires (std::is_constructible_v<typename LayoutPolicy::template mapping<Extents>, const typename OtherLayoutPolicy::template mapping<OtherExtents>&> &&
+            std::is_constructible_v<AccessorPolicy, const OtherAccessor&>)
+    constexpr mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::mdspan(const mdspan<OtherElementType, OtherExtents, OtherLayoutPolicy, OtherAccessor>& other)
+        : acc(other.acc), map(other.map), ptr(other.ptr)
+    {
+        static_assert(std::is_constructible_v<data_handle_type, const typename OtherAccessor::data_handle_type&>,
+            "mdspan's data handle must be constructible from the other mdspan's.");
+        static_assert(std::is_constructible_v<extents_type, OtherExtents>, "mdspan's extents must be constructible from the other mdspan's.");
+    }
+
+#if defined(__cpp_multidimensional_subscript)
+    template <class ElementType, class Extents, class LayoutPolicy, class AccessorPolicy>
+    template <class... OtherIndexTypes>
+    constexpr typename mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::reference mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::operator[](OtherIndexTypes... indices) const
+        requires ((std::is_convertible_v<OtherIndexTypes, index_type> && ...) &&
+            (std::is_nothrow_constructible_v<index_type, OtherIndexTypes> && ...) &&
+            sizeof...(OtherIndexTypes) == rank())
+    {
+        return acc.access(ptr, static_cast<std::size_t>(map(static_cast<index_type>(std::move(indices))...)));
+    }
+#else
+    template <class ElementType, class Extents, class LayoutPolicy, class AccessorPolicy>
+    template <class OtherIndexType>
+    constexpr typename mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::reference mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::operator[](OtherIndexType index) const
+        requires (std::is_convertible_v<OtherIndexType, index_type> &&
+            std::is_nothrow_constructible_v<index_type, OtherIndexType> &&
+            rank() == 1)
+    {
+        return acc.access(ptr, static_cast<std::size_t>(map(static_cast<index_type>(std::move(index)))));
+    }
+#endif
+
+    template <class ElementType, class Extents, class LayoutPolicy, class AccessorPolicy>
+    template <class OtherIndexType>
+    constexpr typename mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::reference mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::operator[](std::span<OtherIndexType, rank()> indices) const
+        requires (std::is_convertible_v<const OtherIndexType&, index_type> &&
+            std::is_nothrow_constructible_v<index_type, const OtherIndexType&>)
+    {
+        return AccessArray(std::make_index_sequence<rank()>(), static_cast<const OtherIndexType*>(indices.data()));
+    }
+
+    template <class ElementType, class Extents, class LayoutPolicy, class AccessorPolicy>
+    template <class OtherIndexType>
+    constexpr typename mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::reference mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::operator[](const std::array<OtherIndexType, rank()>& indices) const
+        requires (std::is_convertible_v<const OtherIndexType&, index_type> &&
+            std::is_nothrow_constructible_v<index_type, const OtherIndexType&>)
+    {
+        return AccessArray(std::make_index_sequence<rank()>(), indices.data());
+    }
+
+    template <class ElementType, class Extents, class LayoutPolicy, class AccessorPolicy>
+    template <class... OtherIndexTypes>
+    constexpr typename mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::reference mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::operator()(OtherIndexTypes... indices) const
+        requires ((std::is_convertible_v<OtherIndexTypes, index_type> && ...) &&
+            (std::is_nothrow_constructible_v<index_type, OtherIndexTypes> && ...) &&
+            sizeof...(OtherIndexTypes) == rank())
+    {
+        return acc.access(ptr, static_cast<std::size_t>(map(static_cast<index_type>(std::move(indices))...)));
+    }
+
+    template <class ElementType, class Extents, class LayoutPolicy, class AccessorPolicy>
+    template <std::size_t... R, class OtherIndexType>
+    constexpr typename mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::reference mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::AccessArray(std::index_sequence<R...>, const OtherIndexType* indices) const
+    {
+        return acc.access(ptr, static_cast<std::size_t>(map(static_cast<index_type>(indices[R])...)));
+    }
+
+    template <class ElementType, class Extents, class LayoutPolicy, class AccessorPolicy>
+    constexpr typename mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::size_type mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::size() const noexcept
+    {
+        return static_cast<size_type>(Detail::extents_product(extents(), 0, rank()));
+    }
+
+    template <class ElementType, class Extents, class LayoutPolicy, class AccessorPolicy>
+    constexpr bool mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>::empty() const noexcept
+    {
+        for (rank_type r = 0; r < rank(); ++r)
+        {
+            if (extent(r) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
@@ -0,0 +1,523 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace StdReimpl
+{
+    namespace pmr
+    {
+        /**
+         * @brief The interface of an allocation strategy, which `polymorphic_allocator` allocates through.
+         * @see https://eel.is/c++draft/mem.res.class
+         * @see https://cppreference.com/w/cpp/memory/memory_resource
+         * @note A feature from the C++17 standard.
+         */
+        class memory_resource
+        {
+        public:
+            memory_resource() = default;
+            memory_resource(const memory_resource&) = default;
+            virtual ~memory_resource();
+
+            memory_resource& operator=(const memory_resource&) = default;
+
+            [[nodiscard]] void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+            void deallocate(void* p, std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+
+            bool is_equal(const memory_resource& other) const noexcept;
+
+        private:
+            virtual void* do_allocate(std::size_t bytes, std::size_t alignment) = 0;
+            virtual void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) = 0;
+
+            virtual bool do_is_equal(const memory_resource& other) const noexcept = 0;
+        };
+
+        bool operator==(const memory_resource& a, const memory_resource& b) noexcept;
+
+        /**
+         * @brief An allocator that allocates through a `memory_resource`, so that containers using different
+         *        allocation strategies have the same type.
+         * @see https://eel.is/c++draft/mem.poly.allocator.class
+         * @see https://cppreference.com/w/cpp/memory/polymorphic_allocator
+         * @note A feature from the C++17 standard, with the additions from C++20.
+         */
+        template <class Tp = std::byte>
+        class polymorphic_allocator
+        {
+        public:
+            using value_type = Tp;
+
+            polymorphic_allocator() noexcept;
+            polymorphic_allocator(memory_resource* r);
+
+            polymorphic_allocator(const polymorphic_allocator& other) = default;
+
+            template <class U>
+            polymorphic_allocator(const polymorphic_allocator<U>& other) noexcept;
+
+            polymorphic_allocator& operator=(const polymorphic_allocator&) = delete;
+
+            [[nodiscard]] Tp* allocate(std::size_t n);
+            void deallocate(Tp* p, std::size_t n);
+
+            [[nodiscard]] void* allocate_bytes(std::size_t nbytes, std::size_t alignment = alignof(std::max_align_t));
+            void deallocate_bytes(void* p, std::size_t nbytes, std::size_t alignment = alignof(std::max_align_t));
+
+            template <class T>
+            [[nodiscard]] T* allocate_object(std::size_t n = 1);
+            template <class T>
+            void deallocate_object(T* p, std::size_t n = 1);
+
+            template <class T, class... CtorArgs>
+            [[nodiscard]] T* new_object(CtorArgs&&... ctor_args);
+            template <class T>
+            void delete_object(T* p);
+
+            template <class T, class... Args>
+            void construct(T* p, Args&&... args);
+
+            polymorphic_allocator select_on_container_copy_construction() const;
+
+            memory_resource* resource() const;
+
+            friend bool operator==(const polymorphic_allocator& a, const polymorphic_allocator& b) noexcept
+            {
+                return *a.resource() == *b.resource();
+            }
+
+        private:
+            memory_resource* memory_rsrc;
+        };
+
+        template <class T1, class T2>
+        bool operator==(const polymorphic_allocator<T1>& a, const polymorphic_allocator<T2>& b) noexcept;
+
+        /**
+         * @brief A resource that allocates with the global `operator new` and frees with `operator delete`.
+         * @note The returned resource is the initial default resource.
+         */
+        memory_resource* new_delete_resource() noexcept;
+
+        /**
+         * @brief A resource whose allocations always fail, e.g., to be the upstream of a `monotonic_buffer_resource` that
+         *        must never go past its initial buffer.
+         */
+        memory_resource* null_memory_resource() noexcept;
+
+        memory_resource* set_default_resource(memory_resource* r) noexcept;
+        memory_resource* get_default_resource() noexcept;
+
+        /**
+         * @brief How a pool resource sizes its pools.
+         * @see https://eel.is/c++draft/mem.res.pool.options
+         * @note A feature from the C++17 standard.
+         */
+        struct pool_options
+        {
+            // The most blocks that a pool gets from the upstream resource at once. Zero picks a default.
+            std::size_t max_blocks_per_chunk = 0;
+
+            // The largest allocation that is served from a pool. Larger ones go straight to the upstream resource. Zero
+            // picks a default.
+            std::size_t largest_required_pool_block = 0;
+        };
+    }
+
+    namespace Detail
+    {
+        class new_delete_memory_resource final : public pmr::memory_resource
+        {
+        private:
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+            void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+
+            bool do_is_equal(const pmr::memory_resource& other) const noexcept override;
+        };
+
+        class null_memory_resource final : public pmr::memory_resource
+        {
+        private:
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+            void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+
+            bool do_is_equal(const pmr::memory_resource& other) const noexcept override;
+        };
+
+        std::atomic<pmr::memory_resource*>& default_memory_resource() noexcept;
+
+        constexpr std::size_t pmr_align_up(std::size_t size, std::size_t alignment) noexcept;
+        constexpr std::size_t pmr_grow_size(std::size_t size) noexcept;
+
+        // Pool blocks are powers of two from `pool_min_block` to `pool_max_block`. A free block holds the next free
+        // block, and the next batch of free blocks in the synchronized pool's depot, so it must fit two pointers.
+        inline constexpr std::size_t pool_min_block = 2 * sizeof(void*);
+        inline constexpr std::size_t pool_max_block = std::size_t{1} << 20;
+        inline constexpr std::size_t pool_max_count = 21 - (sizeof(void*) == 8 ? 4 : 3);
+
+        inline constexpr std::size_t pool_default_largest_block = 4096;
+        inline constexpr std::size_t pool_default_max_blocks_per_chunk = 1024;
+        inline constexpr std::size_t pool_max_blocks_per_chunk = std::size_t{1} << 16;
+
+        inline constexpr std::size_t pool_npos = static_cast<std::size_t>(-1);
+
+        pmr::pool_options pool_normalize_options(const pmr::pool_options& opts) noexcept;
+
+        /**
+         * @brief The index of the pool that serves an allocation, or `pool_npos` if it's too big for any of them.
+         */
+        std::size_t pool_index(std::size_t bytes, std::size_t alignment, std::size_t largestBlock) noexcept;
+
+        struct pool_free_block
+        {
+            pool_free_block* next;
+            pool_free_block* next_batch;
+        };
+
+        /**
+         * @brief Memory that a resource got from its upstream resource, to be given back all at once. Each chunk's
+         *        bookkeeping is at its end, so that the start keeps the alignment it was allocated with.
+         */
+        class pool_chunk_list
+        {
+        public:
+            void* Allocate(pmr::memory_resource* upstream, std::size_t bytes, std::size_t alignment);
+            void Release(pmr::memory_resource* upstream) noexcept;
+
+        private:
+            struct footer
+            {
+                footer* next;
+                void* begin;
+                std::size_t bytes;
+                std::size_t alignment;
+            };
+
+            footer* head = nullptr;
+        };
+
+        /**
+         * @brief Allocations too big for any pool, which are given back to the upstream resource one at a time, or all
+         *        at once on release. Each has a header before it that links it into a list.
+         */
+        class pool_oversized_list
+        {
+        public:
+            void* Allocate(pmr::memory_resource* upstream, std::size_t bytes, std::size_t alignment);
+            void Deallocate(pmr::memory_resource* upstream, void* p, std::size_t bytes, std::size_t alignment) noexcept;
+            void Release(pmr::memory_resource* upstream) noexcept;
+
+        private:
+            struct header
+            {
+                header* prev;
+                header* next;
+                std::size_t bytes;
+                std::size_t alignment;
+            };
+
+            static std::size_t HeaderSize(std::size_t alignment) noexcept;
+
+            header* head = nullptr;
+        };
+
+        /**
+         * @brief Blocks of a single size, carved out of chunks that grow geometrically, and reused through a free list.
+         */
+        class pool
+        {
+        public:
+            void Initialize(std::size_t inBlockSize, std::size_t maxBlocksPerChunk) noexcept;
+
+            void* Allocate(pmr::memory_resource* upstream, pool_chunk_list& chunks);
+            void Deallocate(void* p) noexcept;
+
+            /**
+             * @brief Links `count` blocks into a list, for a thread cache to allocate from without coming back here.
+             */
+            pool_free_block* AllocateBatch(pmr::memory_resource* upstream, pool_chunk_list& chunks, std::size_t count);
+
+            // Forgets every block. The chunks are given back by their `pool_chunk_list`.
+            void Release() noexcept;
+
+            std::size_t BlockSize() const noexcept;
+
+        private:
+            void AllocateChunk(pmr::memory_resource* upstream, pool_chunk_list& chunks);
+
+            pool_free_block* free_list = nullptr;
+            std::byte* next_block = nullptr;
+            std::byte* chunk_end = nullptr;
+
+            std::size_t block_size = 0;
+            std::size_t next_chunk_blocks = 0;
+            std::size_t max_blocks_per_chunk = 0;
+        };
+
+        /**
+         * @brief One thread's free blocks for one `synchronized_pool_resource`, so that most allocations and
+         *        deallocations don't synchronize with other threads at all.
+         */
+        struct pool_thread_cache
+        {
+            struct freed_list
+            {
+                pool_free_block* head = nullptr;
+                std::size_t count = 0;
+            };
+
+            // Blocks from the depot or carved from a pool, as the batch being allocated from and the batches after it.
+            std::array<pool_free_block*, pool_max_count> current{};
+            std::array<pool_free_block*, pool_max_count> batches{};
+
+            // Blocks that this thread freed, given to the depot as a batch once there are enough of them.
+            std::array<freed_list, pool_max_count> freed{};
+
+            pool_thread_cache* next = nullptr;
+        };
+
+        /**
+         * @brief The state of a `synchronized_pool_resource`, which lives as long as any thread might still give its
+         *        cache back to it.
+         */
+        class synchronized_pool_state
+        {
+        public:
+            synchronized_pool_state(const pmr::pool_options& opts, pmr::memory_resource* upstream);
+
+            void* Allocate(pool_thread_cache& cache, std::size_t index);
+            void Deallocate(pool_thread_cache& cache, std::size_t index, void* p) noexcept;
+
+            // For threads whose registry was already destroyed, e.g., in other `thread_local` destructors.
+            void* AllocateLocked(std::size_t index);
+            void DeallocateLocked(std::size_t index, void* p) noexcept;
+
+            void* AllocateOversized(std::size_t bytes, std::size_t alignment);
+            void DeallocateOversized(void* p, std::size_t bytes, std::size_t alignment) noexcept;
+
+            pool_thread_cache* CreateCache();
+
+            // Gives a cache's blocks to the depot when its thread exits, unless the resource is already gone.
+            void RetireCache(pool_thread_cache* cache) noexcept;
+
+            void Release() noexcept;
+
+            // Releases everything, and makes threads that exit later leave their caches alone.
+            void Destroy() noexcept;
+
+            pmr::pool_options options;
+            pmr::memory_resource* upstream_rsrc;
+            const std::uint64_t id;
+
+        private:
+            void* Refill(pool_thread_cache& cache, std::size_t index);
+            void ReleaseLocked() noexcept;
+
+            void PushBatches(std::size_t index, pool_free_block* first, pool_free_block* last) noexcept;
+            pool_free_block* PopBatches(std::size_t index) noexcept;
+
+            static std::size_t BatchSize(std::size_t blockSize) noexcept;
+            static std::uint64_t NextId() noexcept;
+
+            // Free blocks that any thread can take, as a lock-free stack of batches per pool. Threads only ever take the
+            // whole stack at once, which is what keeps it free of ABA problems without a double-width compare-and-swap.
+            std::array<std::atomic<pool_free_block*>, pool_max_count> depots{};
+
+            // Everything below is guarded by `mutex`.
+            std::mutex mutex;
+            std::array<pool, pool_max_count> pools;
+            pool_chunk_list chunks;
+            pool_oversized_list oversized;
+            pool_thread_cache* caches = nullptr;
+            bool alive = true;
+        };
+
+        /**
+         * @brief The caches that the current thread has for each `synchronized_pool_resource` it has used. They're
+         *        given back to their resources when the thread exits.
+         */
+        class pool_thread_registry
+        {
+        public:
+            explicit pool_thread_registry(bool& inDestroyed) noexcept;
+            pool_thread_registry(const pool_thread_registry&) = delete;
+            pool_thread_registry& operator=(const pool_thread_registry&) = delete;
+            ~pool_thread_registry();
+
+            pool_thread_cache& Find(const std::shared_ptr<synchronized_pool_state>& state);
+
+            /**
+             * @brief The current thread's registry, or null once it's been destroyed.
+             */
+            static pool_thread_registry* Get() noexcept;
+
+        private:
+            struct entry
+            {
+                std::uint64_t id;
+                pool_thread_cache* cache;
+                std::weak_ptr<synchronized_pool_state> state;
+            };
+
+            pool_thread_cache& Add(const std::shared_ptr<synchronized_pool_state>& state);
+
+            std::vector<entry> entries;
+            std::uint64_t last_id = 0;
+            pool_thread_cache* last_cache = nullptr;
+            bool* destroyed;
+        };
+    }
+
+    namespace pmr
+    {
+        /**
+         * @brief Hands out memory by bumping a pointer through a buffer, and frees nothing until it's released or
+         *        destroyed. When the buffer runs out, it gets a bigger one from the upstream resource.
+         *
+         *        Given an initial buffer that's big enough, e.g., for one frame or one request, allocation is a pointer
+         *        bump and `release()` is O(1).
+         * @see https://eel.is/c++draft/mem.res.monotonic.buffer
+         * @see https://cppreference.com/w/cpp/memory/monotonic_buffer_resource
+         * @note A feature from the C++17 standard.
+         */
+        class monotonic_buffer_resource : public memory_resource
+        {
+        public:
+            explicit monotonic_buffer_resource(memory_resource* upstream);
+            monotonic_buffer_resource(std::size_t initial_size, memory_resource* upstream);
+            monotonic_buffer_resource(void* buffer, std::size_t buffer_size, memory_resource* upstream);
+
+            monotonic_buffer_resource();
+            explicit monotonic_buffer_resource(std::size_t initial_size);
+            monotonic_buffer_resource(void* buffer, std::size_t buffer_size);
+
+            monotonic_buffer_resource(const monotonic_buffer_resource&) = delete;
+
+            ~monotonic_buffer_resource() override;
+
+            monotonic_buffer_resource& operator=(const monotonic_buffer_resource&) = delete;
+
+            void release();
+
+            memory_resource* upstream_resource() const;
+
+        protected:
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+            void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+
+            bool do_is_equal(const memory_resource& other) const noexcept override;
+
+        private:
+            static constexpr std::size_t default_size = 1024;
+
+            memory_resource* upstream_rsrc;
+            void* initial_buffer;
+            std::size_t initial_size;
+
+            std::byte* current;
+            std::size_t space;
+            std::size_t next_buffer_size;
+
+            Detail::pool_chunk_list chunks;
+        };
+
+        /**
+         * @brief Serves allocations from pools of blocks of each power-of-two size, for a single thread.
+         * @see https://eel.is/c++draft/mem.res.pool
+         * @see https://cppreference.com/w/cpp/memory/unsynchronized_pool_resource
+         * @note A feature from the C++17 standard.
+         */
+        class unsynchronized_pool_resource : public memory_resource
+        {
+        public:
+            unsynchronized_pool_resource(const pool_options& opts, memory_resource* upstream);
+
+            unsynchronized_pool_resource();
+            explicit unsynchronized_pool_resource(memory_resource* upstream);
+            explicit unsynchronized_pool_resource(const pool_options& opts);
+
+            unsynchronized_pool_resource(const unsynchronized_pool_resource&) = delete;
+
+            ~unsynchronized_pool_resource() override;
+
+            unsynchronized_pool_resource& operator=(const unsynchronized_pool_resource&) = delete;
+
+            void release();
+
+            memory_resource* upstream_resource() const;
+            pool_options options() const;
+
+        protected:
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+            void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+
+            bool do_is_equal(const memory_resource& other) const noexcept override;
+
+        private:
+            pool_options opts;
+            memory_resource* upstream_rsrc;
+
+            std::array<Detail::pool, Detail::pool_max_count> pools;
+            Detail::pool_chunk_list chunks;
+            Detail::pool_oversized_list oversized;
+        };
+
+        /**
+         * @brief Serves allocations from pools of blocks of each power-of-two size, for any number of threads.
+         *
+         *        Each thread keeps its own free blocks of each size, so allocating and deallocating usually touch no
+         *        shared state. A thread whose blocks run out takes every batch that other threads have given to a
+         *        shared depot with a single atomic exchange, and a thread that has freed enough blocks gives them to the
+         *        depot as a batch with a compare-and-swap. Only growing the pools and allocations too big for any pool
+         *        take a lock.
+         *
+         *        `release()` and destruction must not happen concurrently with any other use of the resource.
+         * @see https://eel.is/c++draft/mem.res.pool
+         * @see https://cppreference.com/w/cpp/memory/synchronized_pool_resource
+         * @note A feature from the C++17 standard.
+         */
+        class synchronized_pool_resource : public memory_resource
+        {
+        public:
+            synchronized_pool_resource(const pool_options& opts, memory_resource* upstream);
+
+            synchronized_pool_resource();
+            explicit synchronized_pool_resource(memory_resource* upstream);
+            explicit synchronized_pool_resource(const pool_options& opts);
+
+            synchronized_pool_resource(const synchronized_pool_resource&) = delete;
+
+            ~synchronized_pool_resource() override;
+
+            synchronized_pool_resource& operator=(const synchronized_pool_resource&) = delete;
+
+            void release();
+
+            memory_resource* upstream_resource() const;
+            pool_options options() const;
+
+        protected:
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+            void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+
+            bool do_is_equal(const memory_resource& other) const noexcept override;
+
+        private:
+            std::shared_ptr<Detail::synchronized_pool_state> state;
+        };
+    }
+}
+
+#include <CppUtils/StdReimpl/memory_resource.inl>
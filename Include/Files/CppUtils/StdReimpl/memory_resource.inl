@@ -0,0 +1,949 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/memory_resource.h>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        [[noreturn]] inline void pmr_throw_bad_alloc()
+        {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            throw std::bad_alloc();
+#else
+            std::abort();
+#endif
+        }
+
+        [[noreturn]] inline void pmr_throw_bad_array_new_length()
+        {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            throw std::bad_array_new_length();
+#else
+            std::abort();
+#endif
+        }
+    }
+
+    namespace pmr
+    {
+        inline memory_resource::~memory_resource() = default;
+
+        inline void* memory_resource::allocate(std::size_t bytes, std::size_t alignment)
+        {
+            return do_allocate(bytes, alignment);
+        }
+
+        inline void memory_resource::deallocate(void* p, std::size_t bytes, std::size_t alignment)
+        {
+            do_deallocate(p, bytes, alignment);
+        }
+
+        inline bool memory_resource::is_equal(const memory_resource& other) const noexcept
+        {
+            return do_is_equal(other);
+        }
+
+        inline bool operator==(const memory_resource& a, const memory_resource& b) noexcept
+        {
+            return &a == &b || a.is_equal(b);
+        }
+
+        template <class Tp>
+        polymorphic_allocator<Tp>::polymorphic_allocator() noexcept
+            : memory_rsrc(get_default_resource())
+        {
+        }
+
+        template <class Tp>
+        polymorphic_allocator<Tp>::polymorphic_allocator(memory_resource* r)
+            : memory_rsrc(r)
+        {
+            assert(r != nullptr);
+        }
+
+        template <class Tp>
+        template <class U>
+        polymorphic_allocator<Tp>::polymorphic_allocator(const polymorphic_allocator<U>& other) noexcept
+            : memory_rsrc(other.resource())
+        {
+        }
+
+        template <class Tp>
+        Tp* polymorphic_allocator<Tp>::allocate(std::size_t n)
+        {
+            if (n > std::numeric_limits<std::size_t>::max() / sizeof(Tp))
+            {
+                Detail::pmr_throw_bad_array_new_length();
+            }
+            return static_cast<Tp*>(memory_rsrc->allocate(n * sizeof(Tp), alignof(Tp)));
+        }
+
+        template <class Tp>
+        void polymorphic_allocator<Tp>::deallocate(Tp* p, std::size_t n)
+        {
+            memory_rsrc->deallocate(p, n * sizeof(Tp), alignof(Tp));
+        }
+
+        template <class Tp>
+        void* polymorphic_allocator<Tp>::allocate_bytes(std::size_t nbytes, std::size_t alignment)
+        {
+            return memory_rsrc->allocate(nbytes, alignment);
+        }
+
+        template <class Tp>
+        void polymorphic_allocator<Tp>::deallocate_bytes(void* p, std::size_t nbytes, std::size_t alignment)
+        {
+            memory_rsrc->deallocate(p, nbytes, alignment);
+        }
+
+        template <class Tp>
+        template <class T>
+        T* polymorphic_allocator<Tp>::allocate_object(std::size_t n)
+        {
+            if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            {
+                Detail::pmr_throw_bad_array_new_length();
+            }
+            return static_cast<T*>(allocate_bytes(n * sizeof(T), alignof(T)));
+        }
+
+        template <class Tp>
+        template <class T>
+        void polymorphic_allocator<Tp>::deallocate_object(T* p, std::size_t n)
+        {
+            deallocate_bytes(p, n * sizeof(T), alignof(T));
+        }
+
+        template <class Tp>
+        template <class T, class... CtorArgs>
+        T* polymorphic_allocator<Tp>::new_object(CtorArgs&&... ctor_args)
+        {
+            // Gives the memory back if the constructor throws.
+            struct deallocate_guard
+            {
+                polymorphic_allocator* allocator;
+                T* p;
+
+                ~deallocate_guard()
+                {
+                    if (p != nullptr)
+                    {
+                        allocator->deallocate_object(p);
+                    }
+                }
+            };
+
+            deallocate_guard guard{this, allocate_object<T>()};
+            construct(guard.p, std::forward<CtorArgs>(ctor_args)...);
+            return std::exchange(guard.p, nullptr);
+        }
+
+        template <class Tp>
+        template <class T>
+        void polymorphic_allocator<Tp>::delete_object(T* p)
+        {
+            std::allocator_traits<polymorphic_allocator>::destroy(*this, p);
+            deallocate_object(p);
+        }
+
+        template <class Tp>
+        template <class T, class... Args>
+        void polymorphic_allocator<Tp>::construct(T* p, Args&&... args)
+        {
+            std::uninitialized_construct_using_allocator(p, *this, std::forward<Args>(args)...);
+        }
+
+        template <class Tp>
+        polymorphic_allocator<Tp> polymorphic_allocator<Tp>::select_on_container_copy_construction() const
+        {
+            return polymorphic_allocator();
+        }
+
+        template <class Tp>
+        memory_resource* polymorphic_allocator<Tp>::resource() const
+        {
+            return memory_rsrc;
+        }
+
+        template <class T1, class T2>
+        bool operator==(const polymorphic_allocator<T1>& a, const polymorphic_allocator<T2>& b) noexcept
+        {
+            return *a.resource() == *b.resource();
+        }
+
+        inline memory_resource* new_delete_resource() noexcept
+        {
+            static Detail::new_delete_memory_resource resource;
+            return &resource;
+        }
+
+        inline memory_resource* null_memory_resource() noexcept
+        {
+            static Detail::null_memory_resource resource;
+            return &resource;
+        }
+
+        inline memory_resource* set_default_resource(memory_resource* r) noexcept
+        {
+            return Detail::default_memory_resource().exchange(r != nullptr ? r : new_delete_resource(), std::memory_order_acq_rel);
+        }
+
+        inline memory_resource* get_default_resource() noexcept
+        {
+            return Detail::default_memory_resource().load(std::memory_order_acquire);
+        }
+    }
+
+    namespace Detail
+    {
+        inline void* new_delete_memory_resource::do_allocate(std::size_t bytes, std::size_t alignment)
+        {
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                return ::operator new(bytes, std::align_val_t(alignment));
+            }
+            return ::operator new(bytes);
+        }
+
+        inline void new_delete_memory_resource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment)
+        {
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                ::operator delete(p, bytes, std::align_val_t(alignment));
+            }
+            else
+            {
+                ::operator delete(p, bytes);
+            }
+        }
+
+        inline bool new_delete_memory_resource::do_is_equal(const pmr::memory_resource& other) const noexcept
+        {
+            return this == &other;
+        }
+
+        inline void* null_memory_resource::do_allocate(std::size_t, std::size_t)
+        {
+            pmr_throw_bad_alloc();
+        }
+
+        inline void null_memory_resource::do_deallocate(void*, std::size_t, std::size_t)
+        {
+        }
+
+        inline bool null_memory_resource::do_is_equal(const pmr::memory_resource& other) const noexcept
+        {
+            return this == &other;
+        }
+
+        inline std::atomic<pmr::memory_resource*>& default_memory_resource() noexcept
+        {
+            static std::atomic<pmr::memory_resource*> resource{pmr::new_delete_resource()};
+            return resource;
+        }
+
+        constexpr std::size_t pmr_align_up(std::size_t size, std::size_t alignment) noexcept
+        {
+            return (size + alignment - 1) & ~(alignment - 1);
+        }
+
+        constexpr std::size_t pmr_grow_size(std::size_t size) noexcept
+        {
+            return size > std::numeric_limits<std::size_t>::max() / 2 ? std::numeric_limits<std::size_t>::max() : size * 2;
+        }
+
+        inline pmr::pool_options pool_normalize_options(const pmr::pool_options& opts) noexcept
+        {
+            pmr::pool_options result = opts;
+
+            if (result.max_blocks_per_chunk == 0)
+            {
+                result.max_blocks_per_chunk = pool_default_max_blocks_per_chunk;
+            }
+            result.max_blocks_per_chunk = std::min(result.max_blocks_per_chunk, pool_max_blocks_per_chunk);
+
+            if (result.largest_required_pool_block == 0)
+            {
+                result.largest_required_pool_block = pool_default_largest_block;
+            }
+            result.largest_required_pool_block = std::clamp(result.largest_required_pool_block, pool_min_block, pool_max_block);
+            result.largest_required_pool_block = std::bit_ceil(result.largest_required_pool_block);
+
+            return result;
+        }
+
+        inline std::size_t pool_index(std::size_t bytes, std::size_t alignment, std::size_t largestBlock) noexcept
+        {
+            const std::size_t size = std::max({bytes, alignment, pool_min_block});
+            if (size > largestBlock)
+            {
+                return pool_npos;
+            }
+            return static_cast<std::size_t>(std::bit_width(size - 1) - std::countr_zero(pool_min_block));
+        }
+
+        inline void* pool_chunk_list::Allocate(pmr::memory_resource* upstream, std::size_t bytes, std::size_t alignment)
+        {
+            const std::size_t footerOffset = pmr_align_up(bytes, alignof(footer));
+            const std::size_t chunkBytes = footerOffset + sizeof(footer);
+            const std::size_t chunkAlignment = std::max(alignment, alignof(footer));
+
+            void* begin = upstream->allocate(chunkBytes, chunkAlignment);
+            head = ::new (static_cast<std::byte*>(begin) + footerOffset) footer{head, begin, chunkBytes, chunkAlignment};
+            return begin;
+        }
+
+        inline void pool_chunk_list::Release(pmr::memory_resource* upstream) noexcept
+        {
+            while (head != nullptr)
+            {
+                const footer chunk = *head;
+                upstream->deallocate(chunk.begin, chunk.bytes, chunk.alignment);
+                head = chunk.next;
+            }
+        }
+
+        inline void* pool_oversized_list::Allocate(pmr::memory_resource* upstream, std::size_t bytes, std::size_t alignment)
+        {
+            const std::size_t headerSize = HeaderSize(alignment);
+            const std::size_t totalAlignment = std::max(alignment, alignof(header));
+            if (bytes > std::numeric_limits<std::size_t>::max() - headerSize)
+            {
+                pmr_throw_bad_alloc();
+            }
+
+            std::byte* begin = static_cast<std::byte*>(upstream->allocate(headerSize + bytes, totalAlignment));
+            std::byte* p = begin + headerSize;
+
+            header* node = ::new (p - sizeof(header)) header{nullptr, head, headerSize + bytes, totalAlignment};
+            if (head != nullptr)
+            {
+                head->prev = node;
+            }
+            head = node;
+
+            return p;
+        }
+
+        inline void pool_oversized_list::Deallocate(pmr::memory_resource* upstream, void* p, std::size_t, std::size_t alignment) noexcept
+        {
+            header* node = std::launder(reinterpret_cast<header*>(static_cast<std::byte*>(p) - sizeof(header)));
+            (node->prev != nullptr ? node->prev->next : head) = node->next;
+            if (node->next != nullptr)
+            {
+                node->next->prev = node->prev;
+            }
+
+            upstream->deallocate(static_cast<std::byte*>(p) - HeaderSize(alignment), node->bytes, node->alignment);
+        }
+
+        inline void pool_oversized_list::Release(pmr::memory_resource* upstream) noexcept
+        {
+            while (head != nullptr)
+            {
+                const header node = *head;
+                upstream->deallocate(reinterpret_cast<std::byte*>(head + 1) - HeaderSize(node.alignment), node.bytes, node.alignment);
+                head = node.next;
+            }
+        }
+
+        inline std::size_t pool_oversized_list::HeaderSize(std::size_t alignment) noexcept
+        {
+            return pmr_align_up(sizeof(header), std::max(alignment, alignof(header)));
+        }
+
+        inline void pool::Initialize(std::size_t inBlockSize, std::size_t maxBlocksPerChunk) noexcept
+        {
+            free_list = nullptr;
+            next_block = nullptr;
+            chunk_end = nullptr;
+
+            // Start with chunks of about a kilobyte, and double them up to the maximum.
+            block_size = inBlockSize;
+            max_blocks_per_chunk = maxBlocksPerChunk;
+            next_chunk_blocks = std::clamp(std::size_t{1024} / block_size, std::size_t{1}, max_blocks_per_chunk);
+        }
+
+        inline void* pool::Allocate(pmr::memory_resource* upstream, pool_chunk_list& chunks)
+        {
+            if (free_list != nullptr)
+            {
+                return std::exchange(free_list, free_list->next);
+            }
+
+            if (next_block == chunk_end)
+            {
+                AllocateChunk(upstream, chunks);
+            }
+            return std::exchange(next_block, next_block + block_size);
+        }
+
+        inline void pool::Deallocate(void* p) noexcept
+        {
+            free_list = ::new (p) pool_free_block{free_list, nullptr};
+        }
+
+        inline pool_free_block* pool::AllocateBatch(pmr::memory_resource* upstream, pool_chunk_list& chunks, std::size_t count)
+        {
+            pool_free_block* batch = nullptr;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                // Only go upstream for an empty batch, so that a failure doesn't lose the blocks gathered so far.
+                if (batch != nullptr && free_list == nullptr && next_block == chunk_end)
+                {
+                    break;
+                }
+                batch = ::new (Allocate(upstream, chunks)) pool_free_block{batch, nullptr};
+            }
+            return batch;
+        }
+
+        inline void pool::Release() noexcept
+        {
+            Initialize(block_size, max_blocks_per_chunk);
+        }
+
+        inline std::size_t pool::BlockSize() const noexcept
+        {
+            return block_size;
+        }
+
+        inline void pool::AllocateChunk(pmr::memory_resource* upstream, pool_chunk_list& chunks)
+        {
+            const std::size_t bytes = next_chunk_blocks * block_size;
+            next_block = static_cast<std::byte*>(chunks.Allocate(upstream, bytes, block_size));
+            chunk_end = next_block + bytes;
+            next_chunk_blocks = std::min(next_chunk_blocks * 2, max_blocks_per_chunk);
+        }
+
+        inline synchronized_pool_state::synchronized_pool_state(const pmr::pool_options& opts, pmr::memory_resource* upstream)
+            : options(opts), upstream_rsrc(upstream), id(NextId())
+        {
+            for (std::size_t i = 0; i < pool_max_count; ++i)
+            {
+                pools[i].Initialize(pool_min_block << i, options.max_blocks_per_chunk);
+            }
+        }
+
+        inline void* synchronized_pool_state::Allocate(pool_thread_cache& cache, std::size_t index)
+        {
+            pool_thread_cache::freed_list& freed = cache.freed[index];
+            if (freed.head != nullptr)
+            {
+                --freed.count;
+                return std::exchange(freed.head, freed.head->next);
+            }
+
+            pool_free_block*& current = cache.current[index];
+            if (current == nullptr)
+            {
+                current = cache.batches[index];
+                if (current == nullptr)
+                {
+                    return Refill(cache, index);
+                }
+                cache.batches[index] = current->next_batch;
+            }
+            return std::exchange(current, current->next);
+        }
+
+        inline void synchronized_pool_state::Deallocate(pool_thread_cache& cache, std::size_t index, void* p) noexcept
+        {
+            pool_thread_cache::freed_list& freed = cache.freed[index];
+            freed.head = ::new (p) pool_free_block{freed.head, nullptr};
+
+            if (++freed.count >= BatchSize(pool_min_block << index))
+            {
+                PushBatches(index, freed.head, freed.head);
+                freed = {};
+            }
+        }
+
+        inline void* synchronized_pool_state::AllocateLocked(std::size_t index)
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            return pools[index].Allocate(upstream_rsrc, chunks);
+        }
+
+        inline void synchronized_pool_state::DeallocateLocked(std::size_t index, void* p) noexcept
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            pools[index].Deallocate(p);
+        }
+
+        inline void* synchronized_pool_state::AllocateOversized(std::size_t bytes, std::size_t alignment)
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            return oversized.Allocate(upstream_rsrc, bytes, alignment);
+        }
+
+        inline void synchronized_pool_state::DeallocateOversized(void* p, std::size_t bytes, std::size_t alignment) noexcept
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            oversized.Deallocate(upstream_rsrc, p, bytes, alignment);
+        }
+
+        inline pool_thread_cache* synchronized_pool_state::CreateCache()
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+
+            pool_thread_cache* cache = ::new (upstream_rsrc->allocate(sizeof(pool_thread_cache), alignof(pool_thread_cache))) pool_thread_cache();
+            cache->next = caches;
+            caches = cache;
+            return cache;
+        }
+
+        inline void synchronized_pool_state::RetireCache(pool_thread_cache* cache) noexcept
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            if (!alive)
+            {
+                return;
+            }
+
+            for (std::size_t i = 0; i < pool_max_count; ++i)
+            {
+                if (cache->freed[i].head != nullptr)
+                {
+                    PushBatches(i, cache->freed[i].head, cache->freed[i].head);
+                }
+
+                if (pool_free_block* current = cache->current[i])
+                {
+                    current->next_batch = cache->batches[i];
+                    cache->batches[i] = current;
+                }
+                if (pool_free_block* first = cache->batches[i])
+                {
+                    pool_free_block* last = first;
+                    while (last->next_batch != nullptr)
+                    {
+                        last = last->next_batch;
+                    }
+                    PushBatches(i, first, last);
+                }
+            }
+
+            pool_thread_cache** link = &caches;
+            while (*link != cache)
+            {
+                link = &(*link)->next;
+            }
+            *link = cache->next;
+
+            cache->~pool_thread_cache();
+            upstream_rsrc->deallocate(cache, sizeof(pool_thread_cache), alignof(pool_thread_cache));
+        }
+
+        inline void synchronized_pool_state::Release() noexcept
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            ReleaseLocked();
+        }
+
+        inline void synchronized_pool_state::Destroy() noexcept
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            ReleaseLocked();
+
+            while (caches != nullptr)
+            {
+                pool_thread_cache* cache = std::exchange(caches, caches->next);
+                cache->~pool_thread_cache();
+                upstream_rsrc->deallocate(cache, sizeof(pool_thread_cache), alignof(pool_thread_cache));
+            }
+            alive = false;
+        }
+
+        inline void* synchronized_pool_state::Refill(pool_thread_cache& cache, std::size_t index)
+        {
+            pool_free_block* batches = PopBatches(index);
+            if (batches == nullptr)
+            {
+                const std::lock_guard<std::mutex> lock(mutex);
+                batches = pools[index].AllocateBatch(upstream_rsrc, chunks, BatchSize(pools[index].BlockSize()));
+            }
+
+            cache.current[index] = batches->next;
+            cache.batches[index] = batches->next_batch;
+            return batches;
+        }
+
+        inline void synchronized_pool_state::ReleaseLocked() noexcept
+        {
+            for (pool_thread_cache* cache = caches; cache != nullptr; cache = cache->next)
+            {
+                cache->current = {};
+                cache->batches = {};
+                cache->freed = {};
+            }
+            for (std::atomic<pool_free_block*>& depot : depots)
+            {
+                depot.store(nullptr, std::memory_order_relaxed);
+            }
+
+            for (pool& p : pools)
+            {
+                p.Release();
+            }
+            chunks.Release(upstream_rsrc);
+            oversized.Release(upstream_rsrc);
+        }
+
+        inline void synchronized_pool_state::PushBatches(std::size_t index, pool_free_block* first, pool_free_block* last) noexcept
+        {
+            pool_free_block* top = depots[index].load(std::memory_order_relaxed);
+            do
+            {
+                last->next_batch = top;
+            }
+            while (!depots[index].compare_exchange_weak(top, first, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        inline pool_free_block* synchronized_pool_state::PopBatches(std::size_t index) noexcept
+        {
+            // Take every batch, rather than popping one, so that a batch can't be popped, reused, and pushed again between
+            // reading the top and swapping it out.
+            if (depots[index].load(std::memory_order_relaxed) == nullptr)
+            {
+                return nullptr;
+            }
+            return depots[index].exchange(nullptr, std::memory_order_acquire);
+        }
+
+        inline std::size_t synchronized_pool_state::BatchSize(std::size_t blockSize) noexcept
+        {
+            // About 16 kilobytes of blocks at a time.
+            return std::clamp(std::size_t{16384} / blockSize, std::size_t{1}, std::size_t{256});
+        }
+
+        inline std::uint64_t synchronized_pool_state::NextId() noexcept
+        {
+            static std::atomic<std::uint64_t> nextId{1};
+            return nextId.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        inline pool_thread_registry::pool_thread_registry(bool& inDestroyed) noexcept
+            : destroyed(&inDestroyed)
+        {
+        }
+
+        inline pool_thread_registry::~pool_thread_registry()
+        {
+            *destroyed = true;
+            for (const entry& e : entries)
+            {
+                if (const std::shared_ptr<synchronized_pool_state> state = e.state.lock())
+                {
+                    state->RetireCache(e.cache);
+                }
+            }
+        }
+
+        inline pool_thread_cache& pool_thread_registry::Find(const std::shared_ptr<synchronized_pool_state>& state)
+        {
+            if (state->id == last_id)
+            {
+                return *last_cache;
+            }
+
+            for (const entry& e : entries)
+            {
+                if (e.id == state->id)
+                {
+                    last_id = e.id;
+                    last_cache = e.cache;
+                    return *e.cache;
+                }
+            }
+            return Add(state);
+        }
+
+        inline pool_thread_registry* pool_thread_registry::Get() noexcept
+        {
+            // Trivially destructible, so it can still be read after the registry is destroyed.
+            thread_local bool registryDestroyed = false;
+            thread_local pool_thread_registry registry(registryDestroyed);
+            return registryDestroyed ? nullptr : &registry;
+        }
+
+        inline pool_thread_cache& pool_thread_registry::Add(const std::shared_ptr<synchronized_pool_state>& state)
+        {
+            // Forget the resources that have been destroyed since.
+            std::erase_if(entries, [](const entry& e) { return e.state.expired(); });
+
+            entries.reserve(entries.size() + 1);
+            pool_thread_cache* cache = state->CreateCache();
+            entries.push_back({state->id, cache, state});
+
+            last_id = state->id;
+            last_cache = cache;
+            return *cache;
+        }
+    }
+
+    namespace pmr
+    {
+        inline monotonic_buffer_resource::monotonic_buffer_resource(memory_resource* upstream)
+            : monotonic_buffer_resource(nullptr, 0, upstream)
+        {
+        }
+
+        inline monotonic_buffer_resource::monotonic_buffer_resource(std::size_t initial_size, memory_resource* upstream)
+            : upstream_rsrc(upstream), initial_buffer(nullptr), initial_size(std::max(initial_size, std::size_t{1}))
+        {
+            assert(upstream != nullptr);
+
+            release();
+        }
+
+        inline monotonic_buffer_resource::monotonic_buffer_resource(void* buffer, std::size_t buffer_size, memory_resource* upstream)
+            : upstream_rsrc(upstream), initial_buffer(buffer), initial_size(buffer != nullptr ? buffer_size : default_size)
+        {
+            assert(upstream != nullptr);
+
+            release();
+        }
+
+        inline monotonic_buffer_resource::monotonic_buffer_resource()
+            : monotonic_buffer_resource(get_default_resource())
+        {
+        }
+
+        inline monotonic_buffer_resource::monotonic_buffer_resource(std::size_t initial_size)
+            : monotonic_buffer_resource(initial_size, get_default_resource())
+        {
+        }
+
+        inline monotonic_buffer_resource::monotonic_buffer_resource(void* buffer, std::size_t buffer_size)
+            : monotonic_buffer_resource(buffer, buffer_size, get_default_resource())
+        {
+        }
+
+        inline monotonic_buffer_resource::~monotonic_buffer_resource()
+        {
+            chunks.Release(upstream_rsrc);
+        }
+
+        inline void monotonic_buffer_resource::release()
+        {
+            chunks.Release(upstream_rsrc);
+
+            current = static_cast<std::byte*>(initial_buffer);
+            if (initial_buffer != nullptr)
+            {
+                space = initial_size;
+                next_buffer_size = Detail::pmr_grow_size(std::max(initial_size, std::size_t{1}));
+            }
+            else
+            {
+                space = 0;
+                next_buffer_size = initial_size;
+            }
+        }
+
+        inline memory_resource* monotonic_buffer_resource::upstream_resource() const
+        {
+            return upstream_rsrc;
+        }
+
+        inline void* monotonic_buffer_resource::do_allocate(std::size_t bytes, std::size_t alignment)
+        {
+            bytes = std::max(bytes, std::size_t{1});
+
+            const std::size_t padding = static_cast<std::size_t>(-reinterpret_cast<std::uintptr_t>(current)) & (alignment - 1);
+            if (padding <= space && bytes <= space - padding)
+            {
+                std::byte* p = current + padding;
+                current = p + bytes;
+                space -= padding + bytes;
+                return p;
+            }
+
+            // Buffers from upstream are aligned for this allocation, so it goes at their start.
+            const std::size_t size = std::max(next_buffer_size, bytes);
+            std::byte* buffer = static_cast<std::byte*>(chunks.Allocate(upstream_rsrc, size, std::max(alignment, alignof(std::max_align_t))));
+            next_buffer_size = Detail::pmr_grow_size(size);
+
+            current = buffer + bytes;
+            space = size - bytes;
+            return buffer;
+        }
+
+        inline void monotonic_buffer_resource::do_deallocate(void*, std::size_t, std::size_t)
+        {
+        }
+
+        inline bool monotonic_buffer_resource::do_is_equal(const memory_resource& other) const noexcept
+        {
+            return this == &other;
+        }
+
+        inline unsynchronized_pool_resource::unsynchronized_pool_resource(const pool_options& opts, memory_resource* upstream)
+            : opts(Detail::pool_normalize_options(opts)), upstream_rsrc(upstream)
+        {
+            assert(upstream != nullptr);
+
+            for (std::size_t i = 0; i < Detail::pool_max_count; ++i)
+            {
+                pools[i].Initialize(Detail::pool_min_block << i, this->opts.max_blocks_per_chunk);
+            }
+        }
+
+        inline unsynchronized_pool_resource::unsynchronized_pool_resource()
+            : unsynchronized_pool_resource(pool_options(), get_default_resource())
+        {
+        }
+
+        inline unsynchronized_pool_resource::unsynchronized_pool_resource(memory_resource* upstream)
+            : unsynchronized_pool_resource(pool_options(), upstream)
+        {
+        }
+
+        inline unsynchronized_pool_resource::unsynchronized_pool_resource(const pool_options& opts)
+            : unsynchronized_pool_resource(opts, get_default_resource())
+        {
+        }
+
+        inline unsynchronized_pool_resource::~unsynchronized_pool_resource()
+        {
+            release();
+        }
+
+        inline void unsynchronized_pool_resource::release()
+        {
+            for (Detail::pool& p : pools)
+            {
+                p.Release();
+            }
+            chunks.Release(upstream_rsrc);
+            oversized.Release(upstream_rsrc);
+        }
+
+        inline memory_resource* unsynchronized_pool_resource::upstream_resource() const
+        {
+            return upstream_rsrc;
+        }
+
+        inline pool_options unsynchronized_pool_resource::options() const
+        {
+            return opts;
+        }
+
+        inline void* unsynchronized_pool_resource::do_allocate(std::size_t bytes, std::size_t alignment)
+        {
+            const std::size_t index = Detail::pool_index(bytes, alignment, opts.largest_required_pool_block);
+            if (index == Detail::pool_npos)
+            {
+                return oversized.Allocate(upstream_rsrc, bytes, alignment);
+            }
+            return pools[index].Allocate(upstream_rsrc, chunks);
+        }
+
+        inline void unsynchronized_pool_resource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment)
+        {
+            const std::size_t index = Detail::pool_index(bytes, alignment, opts.largest_required_pool_block);
+            if (index == Detail::pool_npos)
+            {
+                oversized.Deallocate(upstream_rsrc, p, bytes, alignment);
+            }
+            else
+            {
+                pools[index].Deallocate(p);
+            }
+        }
+
+        inline bool unsynchronized_pool_resource::do_is_equal(const memory_resource& other) const noexcept
+        {
+            return this == &other;
+        }
+
+        inline synchronized_pool_resource::synchronized_pool_resource(const pool_options& opts, memory_resource* upstream)
+            : state(std::make_shared<Detail::synchronized_pool_state>(Detail::pool_normalize_options(opts), upstream))
+        {
+            assert(upstream != nullptr);
+        }
+
+        inline synchronized_pool_resource::synchronized_pool_resource()
+            : synchronized_pool_resource(pool_options(), get_default_resource())
+        {
+        }
+
+        inline synchronized_pool_resource::synchronized_pool_resource(memory_resource* upstream)
+            : synchronized_pool_resource(pool_options(), upstream)
+        {
+        }
+
+        inline synchronized_pool_resource::synchronized_pool_resource(const pool_options& opts)
+            : synchronized_pool_resource(opts, get_default_resource())
+        {
+        }
+
+        inline synchronized_pool_resource::~synchronized_pool_resource()
+        {
+            state->Destroy();
+        }
+
+        inline void synchronized_pool_resource::release()
+        {
+            state->Release();
+        }
+
+        inline memory_resource* synchronized_pool_resource::upstream_resource() const
+        {
+            return state->upstream_rsrc;
+        }
+
+        inline pool_options synchronized_pool_resource::options() const
+        {
+            return state->options;
+        }
+
+        inline void* synchronized_pool_resource::do_allocate(std::size_t bytes, std::size_t alignment)
+        {
+            const std::size_t index = Detail::pool_index(bytes, alignment, state->options.largest_required_pool_block);
+            if (index == Detail::pool_npos)
+            {
+                return state->AllocateOversized(bytes, alignment);
+            }
+
+            if (Detail::pool_thread_registry* registry = Detail::pool_thread_registry::Get())
+            {
+                return state->Allocate(registry->Find(state), index);
+            }
+            return state->AllocateLocked(index);
+        }
+
+        inline void synchronized_pool_resource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment)
+        {
+            const std::size_t index = Detail::pool_index(bytes, alignment, state->options.largest_required_pool_block);
+            if (index == Detail::pool_npos)
+            {
+                state->DeallocateOversized(p, bytes, alignment);
+            }
+            else if (Detail::pool_thread_registry* registry = Detail::pool_thread_registry::Get())
+            {
+                state->Deallocate(registry->Find(state), index, p);
+            }
+            else
+            {
+                state->DeallocateLocked(index, p);
+            }
+        }
+
+        inline bool synchronized_pool_resource::do_is_equal(const memory_resource& other) const noexcept
+        {
+            return this == &other;
+        }
+    }
+}
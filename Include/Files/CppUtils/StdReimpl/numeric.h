@@ -0,0 +1,74 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/execution.h>
+
+#include <iterator>
+#include <type_traits>
+
+namespace StdReimpl
+{
+    //
+    // The overloads that take an execution policy. With `execution::par` or `execution::par_unseq` and random access
+    // iterators, the range is split into chunks that the threads of the policy's pool take in turn, and the results of
+    // the chunks are combined in order on the calling thread. Otherwise they call the sequential algorithm from the
+    // standard library.
+    //
+
+    /**
+     * @brief In parallel, the operation must be associative and commutative, as with `std::reduce`.
+     * @see https://eel.is/c++draft/reduce
+     * @note A feature from the C++17 standard.
+     */
+    template <class ExecutionPolicy, class ForwardIt>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    std::iter_value_t<ForwardIt> reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last);
+
+    template <class ExecutionPolicy, class ForwardIt, class T>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    T reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, T init);
+
+    template <class ExecutionPolicy, class ForwardIt, class T, class BinaryOperation>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    T reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, T init, BinaryOperation binary_op);
+
+    /**
+     * @see https://eel.is/c++draft/transform.reduce
+     * @note A feature from the C++17 standard.
+     */
+    template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class T>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    T transform_reduce(ExecutionPolicy&& policy, ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 first2, T init);
+
+    template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class T, class BinaryReductionOp, class BinaryTransformOp>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    T transform_reduce(ExecutionPolicy&& policy, ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 first2, T init, BinaryReductionOp reduce,
+        BinaryTransformOp transform);
+
+    template <class ExecutionPolicy, class ForwardIt, class T, class BinaryReductionOp, class UnaryTransformOp>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    T transform_reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, T init, BinaryReductionOp reduce, UnaryTransformOp transform);
+
+    /**
+     * @brief In parallel, each chunk but the last is summed first, then the sums are scanned on the calling thread, and
+     *        then each chunk is scanned again starting from the sum of everything before it. So the operation is called
+     *        about twice per element, and must be associative.
+     * @see https://eel.is/c++draft/inclusive.scan
+     * @note A feature from the C++17 standard.
+     */
+    template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    ForwardIt2 inclusive_scan(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first);
+
+    template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class BinaryOperation>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    ForwardIt2 inclusive_scan(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first, BinaryOperation binary_op);
+
+    template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class BinaryOperation, class T>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    ForwardIt2 inclusive_scan(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first, BinaryOperation binary_op, T init);
+}
+
+#include <CppUtils/StdReimpl/numeric.inl>
@@ -0,0 +1,214 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/numeric.h>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <optional>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        /**
+         * @brief Reduces `read(i)` for every `i` in `[0, count)` with `chunkCount` chunks of at least two elements, so
+         *        that each chunk starts from `reduce` of its first two and nothing needs to be default constructed.
+         */
+        template <class T, class Reduce, class Read>
+        T numeric_parallel_reduce(execution::static_thread_pool& pool, std::size_t count, std::size_t chunkCount, T init, Reduce& reduce,
+            Read& read)
+        {
+            std::array<std::optional<T>, execution_max_chunks> partials;
+
+            auto body = [&](std::size_t index)
+            {
+                const auto [begin, end] = Detail::execution_chunk(count, chunkCount, index);
+                T partial = reduce(read(begin), read(begin + 1));
+                for (std::size_t i = begin + 2; i < end; ++i)
+                {
+                    partial = reduce(std::move(partial), read(i));
+                }
+                partials[index].emplace(std::move(partial));
+            };
+            Detail::execution_parallel_for(pool, chunkCount, body);
+
+            for (std::size_t index = 0; index < chunkCount; ++index)
+            {
+                init = reduce(std::move(init), std::move(*partials[index]));
+            }
+            return init;
+        }
+    }
+
+    template <class ExecutionPolicy, class ForwardIt>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    std::iter_value_t<ForwardIt> reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last)
+    {
+        return StdReimpl::reduce(std::forward<ExecutionPolicy>(policy), first, last, std::iter_value_t<ForwardIt>{}, std::plus<>());
+    }
+
+    template <class ExecutionPolicy, class ForwardIt, class T>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    T reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, T init)
+    {
+        return StdReimpl::reduce(std::forward<ExecutionPolicy>(policy), first, last, std::move(init), std::plus<>());
+    }
+
+    template <class ExecutionPolicy, class ForwardIt, class T, class BinaryOperation>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    T reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, T init, BinaryOperation binary_op)
+    {
+        if constexpr (Detail::execution_parallel_iterators<ExecutionPolicy, ForwardIt>)
+        {
+            execution::static_thread_pool& pool = policy.get_pool();
+            const std::size_t count = static_cast<std::size_t>(last - first);
+            const std::size_t chunkCount = Detail::execution_chunk_count(pool, count, 2);
+            if (chunkCount > 1)
+            {
+                auto read = [first](std::size_t i) -> decltype(auto) { return *Detail::execution_next(first, i); };
+                return Detail::numeric_parallel_reduce(pool, count, chunkCount, std::move(init), binary_op, read);
+            }
+        }
+        return std::reduce(first, last, std::move(init), std::move(binary_op));
+    }
+
+    template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class T>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    T transform_reduce(ExecutionPolicy&& policy, ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 first2, T init)
+    {
+        return StdReimpl::transform_reduce(std::forward<ExecutionPolicy>(policy), first1, last1, first2, std::move(init), std::plus<>(),
+            std::multiplies<>());
+    }
+
+    template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class T, class BinaryReductionOp, class BinaryTransformOp>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    T transform_reduce(ExecutionPolicy&& policy, ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 first2, T init, BinaryReductionOp reduce,
+        BinaryTransformOp transform)
+    {
+        if constexpr (Detail::execution_parallel_iterators<ExecutionPolicy, ForwardIt1, ForwardIt2>)
+        {
+            execution::static_thread_pool& pool = policy.get_pool();
+            const std::size_t count = static_cast<std::size_t>(last1 - first1);
+            const std::size_t chunkCount = Detail::execution_chunk_count(pool, count, 2);
+            if (chunkCount > 1)
+            {
+                auto read = [first1, first2, &transform](std::size_t i) -> decltype(auto)
+                {
+                    return transform(*Detail::execution_next(first1, i), *Detail::execution_next(first2, i));
+                };
+                return Detail::numeric_parallel_reduce(pool, count, chunkCount, std::move(init), reduce, read);
+            }
+        }
+        return std::transform_reduce(first1, last1, first2, std::move(init), std::move(reduce), std::move(transform));
+    }
+
+    template <class ExecutionPolicy, class ForwardIt, class T, class BinaryReductionOp, class UnaryTransformOp>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    T transform_reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, T init, BinaryReductionOp reduce, UnaryTransformOp transform)
+    {
+        if constexpr (Detail::execution_parallel_iterators<ExecutionPolicy, ForwardIt>)
+        {
+            execution::static_thread_pool& pool = policy.get_pool();
+            const std::size_t count = static_cast<std::size_t>(last - first);
+            const std::size_t chunkCount = Detail::execution_chunk_count(pool, count, 2);
+            if (chunkCount > 1)
+            {
+                auto read = [first, &transform](std::size_t i) -> decltype(auto) { return transform(*Detail::execution_next(first, i)); };
+                return Detail::numeric_parallel_reduce(pool, count, chunkCount, std::move(init), reduce, read);
+            }
+        }
+        return std::transform_reduce(first, last, std::move(init), std::move(reduce), std::move(transform));
+    }
+
+    template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    ForwardIt2 inclusive_scan(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first)
+    {
+        return StdReimpl::inclusive_scan(std::forward<ExecutionPolicy>(policy), first, last, d_first, std::plus<>());
+    }
+
+    template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class BinaryOperation>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    ForwardIt2 inclusive_scan(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first, BinaryOperation binary_op)
+    {
+        if constexpr (Detail::execution_parallel_iterators<ExecutionPolicy, ForwardIt1, ForwardIt2>)
+        {
+            if (first == last)
+            {
+                return d_first;
+            }
+
+            // The first element starts the sum, which leaves the overload with an initial value for the rest.
+            std::iter_value_t<ForwardIt1> init = *first;
+            *d_first = init;
+            return StdReimpl::inclusive_scan(std::forward<ExecutionPolicy>(policy), std::next(first), last, std::next(d_first), std::move(binary_op),
+                std::move(init));
+        }
+        else
+        {
+            return std::inclusive_scan(first, last, d_first, std::move(binary_op));
+        }
+    }
+
+    template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class BinaryOperation, class T>
+        requires is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    ForwardIt2 inclusive_scan(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first, BinaryOperation binary_op, T init)
+    {
+        if constexpr (Detail::execution_parallel_iterators<ExecutionPolicy, ForwardIt1, ForwardIt2>)
+        {
+            execution::static_thread_pool& pool = policy.get_pool();
+            const std::size_t count = static_cast<std::size_t>(last - first);
+            const std::size_t chunkCount = Detail::execution_chunk_count(pool, count, 2);
+            if (chunkCount > 1)
+            {
+                // The sum of each chunk but the last, which then become the sum of everything before each chunk.
+                std::array<std::optional<T>, Detail::execution_max_chunks> sums;
+
+                auto sumChunk = [&](std::size_t index)
+                {
+                    const auto [begin, end] = Detail::execution_chunk(count, chunkCount, index);
+                    ForwardIt1 it = Detail::execution_next(first, begin);
+                    T sum = binary_op(*it, *std::next(it));
+                    std::advance(it, 2);
+                    for (std::size_t i = begin + 2; i < end; ++i, ++it)
+                    {
+                        sum = binary_op(std::move(sum), *it);
+                    }
+                    sums[index].emplace(std::move(sum));
+                };
+                Detail::execution_parallel_for(pool, chunkCount - 1, sumChunk);
+
+                for (std::size_t index = 0; index < chunkCount; ++index)
+                {
+                    std::optional<T> sum = std::move(sums[index]);
+                    sums[index].emplace(init);
+                    if (sum.has_value())
+                    {
+                        init = binary_op(std::move(init), std::move(*sum));
+                    }
+                }
+
+                auto scanChunk = [&](std::size_t index)
+                {
+                    const auto [begin, end] = Detail::execution_chunk(count, chunkCount, index);
+                    ForwardIt1 it = Detail::execution_next(first, begin);
+                    ForwardIt2 out = Detail::execution_next(d_first, begin);
+                    T sum = binary_op(*sums[index], *it);
+                    *out = sum;
+                    for (std::size_t i = begin + 1; i < end; ++i)
+                    {
+                        sum = binary_op(std::move(sum), *++it);
+                        *++out = sum;
+                    }
+                };
+                Detail::execution_parallel_for(pool, chunkCount, scanChunk);
+                return Detail::execution_next(d_first, count);
+            }
+        }
+        return std::inclusive_scan(first, last, d_first, std::move(binary_op), std::move(init));
+    }
+}
@@ -0,0 +1,84 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/atomic.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        /**
+         * @brief The top bit of a semaphore's word, set by a thread before it parks, so that `release` knows from the
+         *        result of its one read-modify-write whether it has to wake anyone.
+         */
+        inline constexpr std::uint32_t semaphore_waiters_bit = std::uint32_t{1} << 31;
+
+        /**
+         * @brief The largest count a semaphore can hold, below the waiters bit.
+         */
+        inline constexpr std::ptrdiff_t semaphore_max = static_cast<std::ptrdiff_t>(semaphore_waiters_bit - 1);
+    }
+
+    /**
+     * @brief A count of available resources that threads block on while it is zero.
+     *
+     *        `acquire()` and `release()` are a single read-modify-write each when no thread has to wait. A thread that
+     *        finds the count at zero spins for a while before it sets a bit in the counter and parks on it, with
+     *        `futex(2)` on Linux, through the same spin-then-park layer as `atomic_ref::wait`; `release()` only wakes
+     *        threads when that bit was set.
+     * @see https://eel.is/c++draft/thread.sema.cnt
+     * @see https://cppreference.com/w/cpp/thread/counting_semaphore
+     * @note A feature from the C++20 standard.
+     */
+    template <std::ptrdiff_t LeastMaxValue = Detail::semaphore_max>
+    class counting_semaphore
+    {
+        static_assert(LeastMaxValue >= 0 && LeastMaxValue <= Detail::semaphore_max,
+            "counting_semaphore can't count beyond 2^31 - 1.");
+
+    public:
+        static constexpr std::ptrdiff_t max() noexcept;
+
+        constexpr explicit counting_semaphore(std::ptrdiff_t desired);
+        ~counting_semaphore() = default;
+
+        counting_semaphore(const counting_semaphore&) = delete;
+        counting_semaphore& operator=(const counting_semaphore&) = delete;
+
+        void release(std::ptrdiff_t update = 1);
+        void acquire();
+        bool try_acquire() noexcept;
+
+        template <class Rep, class Period>
+        bool try_acquire_for(const std::chrono::duration<Rep, Period>& rel_time);
+
+        template <class Clock, class Duration>
+        bool try_acquire_until(const std::chrono::time_point<Clock, Duration>& abs_time);
+
+    private:
+        /**
+         * @brief Parks until the count may be positive, or until `park` gives up. Sets the waiters bit first.
+         */
+        template <class Park>
+        bool AcquireSlow(Park park);
+
+        std::atomic<std::uint32_t> counter;
+    };
+
+    /**
+     * @brief A semaphore that is either available or not, e.g., to signal from one thread to another.
+     * @see https://eel.is/c++draft/thread.sema.cnt
+     * @see https://cppreference.com/w/cpp/thread/counting_semaphore
+     * @note A feature from the C++20 standard.
+     */
+    using binary_semaphore = counting_semaphore<1>;
+}
+
+#include <CppUtils/StdReimpl/semaphore.inl>
@@ -0,0 +1,141 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/semaphore.h>
+
+#include <cassert>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        inline constexpr bool semaphore_wait_is_native = Detail::atomic_wait_is_native_for_atomic<std::uint32_t>;
+    }
+
+    template <std::ptrdiff_t LeastMaxValue>
+    constexpr std::ptrdiff_t counting_semaphore<LeastMaxValue>::max() noexcept
+    {
+        return LeastMaxValue;
+    }
+
+    template <std::ptrdiff_t LeastMaxValue>
+    constexpr counting_semaphore<LeastMaxValue>::counting_semaphore(std::ptrdiff_t desired)
+        : counter(static_cast<std::uint32_t>(desired))
+    {
+        assert(desired >= 0 && desired <= max());
+    }
+
+    template <std::ptrdiff_t LeastMaxValue>
+    void counting_semaphore<LeastMaxValue>::release(std::ptrdiff_t update)
+    {
+        const std::uint32_t old = counter.fetch_add(static_cast<std::uint32_t>(update), std::memory_order_release);
+        assert(update >= 0 && static_cast<std::ptrdiff_t>(old & ~Detail::semaphore_waiters_bit) <= max() - update);
+
+        if ((old & Detail::semaphore_waiters_bit) != 0)
+        {
+            // Everyone parked is woken and competes for the count again; a thread that loses sets the bit again before
+            // parking, so clearing it here can't strand anyone.
+            counter.fetch_and(~Detail::semaphore_waiters_bit, std::memory_order_relaxed);
+            Detail::atomic_notify<Detail::semaphore_wait_is_native>(&counter, true);
+        }
+    }
+
+    template <std::ptrdiff_t LeastMaxValue>
+    bool counting_semaphore<LeastMaxValue>::try_acquire() noexcept
+    {
+        std::uint32_t current = counter.load(std::memory_order_relaxed);
+        while ((current & ~Detail::semaphore_waiters_bit) != 0)
+        {
+            if (counter.compare_exchange_weak(current, current - 1, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <std::ptrdiff_t LeastMaxValue>
+    void counting_semaphore<LeastMaxValue>::acquire()
+    {
+        if (try_acquire())
+        {
+            return;
+        }
+
+        AcquireSlow([this](const auto& changed)
+        {
+            Detail::atomic_park<Detail::semaphore_wait_is_native>(&counter, Detail::semaphore_waiters_bit, changed, nullptr);
+            return true;
+        });
+    }
+
+    template <std::ptrdiff_t LeastMaxValue>
+    template <class Rep, class Period>
+    bool counting_semaphore<LeastMaxValue>::try_acquire_for(const std::chrono::duration<Rep, Period>& rel_time)
+    {
+        return try_acquire_until(std::chrono::steady_clock::now() + rel_time);
+    }
+
+    template <std::ptrdiff_t LeastMaxValue>
+    template <class Clock, class Duration>
+    bool counting_semaphore<LeastMaxValue>::try_acquire_until(const std::chrono::time_point<Clock, Duration>& abs_time)
+    {
+        if (try_acquire())
+        {
+            return true;
+        }
+
+        return AcquireSlow([this, &abs_time](const auto& changed)
+        {
+            const auto now = Clock::now();
+            if (now >= abs_time)
+            {
+                return false;
+            }
+            const auto timeout = std::chrono::ceil<std::chrono::nanoseconds>(abs_time - now);
+            Detail::atomic_park<Detail::semaphore_wait_is_native>(&counter, Detail::semaphore_waiters_bit, changed, &timeout);
+            return true;
+        });
+    }
+
+    template <std::ptrdiff_t LeastMaxValue>
+    template <class Park>
+    bool counting_semaphore<LeastMaxValue>::AcquireSlow(Park park)
+    {
+        // A release that comes in while spinning costs neither side a system call.
+        if (Detail::atomic_spin([this]() { return try_acquire(); }))
+        {
+            return true;
+        }
+
+        const auto changed = [this]()
+        {
+            return counter.load(std::memory_order_relaxed) != Detail::semaphore_waiters_bit;
+        };
+
+        while (true)
+        {
+            std::uint32_t current = counter.load(std::memory_order_relaxed);
+            if ((current & ~Detail::semaphore_waiters_bit) != 0)
+            {
+                if (counter.compare_exchange_weak(current, current - 1, std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+                continue;
+            }
+
+            // The bit can only be set while the count is zero, so a release that has already come in makes this fail.
+            if (current == 0 && !counter.compare_exchange_weak(current, Detail::semaphore_waiters_bit, std::memory_order_relaxed))
+            {
+                continue;
+            }
+
+            if (!park(changed))
+            {
+                return try_acquire();
+            }
+        }
+    }
+}
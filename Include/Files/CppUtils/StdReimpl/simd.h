@@ -0,0 +1,774 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/concepts.h>
+#include <CppUtils/StdReimpl/cstdlib.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief The width in bytes of `simd_abi::native<T>`: 64 with AVX-512, 32 with AVX, and 16 otherwise, which is SSE2 or
+ *        NEON where there are vectors at all. Define it before including this header to change it for the whole build.
+ *        A width beyond the target's registers still works, since the compiler splits such vectors into native ones.
+ */
+#ifndef CPPUTILS_STDREIMPL_SIMD_NATIVE_BYTES
+#   if defined(__AVX512F__)
+#       define CPPUTILS_STDREIMPL_SIMD_NATIVE_BYTES 64
+#   elif defined(__AVX__)
+#       define CPPUTILS_STDREIMPL_SIMD_NATIVE_BYTES 32
+#   else
+#       define CPPUTILS_STDREIMPL_SIMD_NATIVE_BYTES 16
+#   endif
+#endif
+
+// GCC and Clang have vector types whose operators the compiler maps onto whatever vector instructions the target has.
+// Elsewhere, every operation is a loop over an array.
+#if defined(__GNUC__) || defined(__clang__)
+#   define CPPUTILS_STDREIMPL_SIMD_USE_VECTOR_EXTENSIONS 1
+#endif
+
+namespace StdReimpl
+{
+    namespace simd_abi
+    {
+        /**
+         * @brief A single element, stored and operated on as a plain value.
+         * @see https://cppreference.com/w/cpp/experimental/simd/scalar
+         * @note A feature from the Parallelism TS v2.
+         */
+        struct scalar
+        {
+        };
+
+        /**
+         * @brief `N` elements. Stored as a vector type when that is 16, 32 or 64 bytes and the compiler has vector types,
+         *        and otherwise as an array.
+         * @see https://cppreference.com/w/cpp/experimental/simd/fixed_size
+         * @note A feature from the Parallelism TS v2.
+         */
+        template <int N>
+        struct fixed_size
+        {
+        };
+
+        template <class T>
+        inline constexpr int max_fixed_size = 64;
+
+        /**
+         * @brief As many elements as fit in `CPPUTILS_STDREIMPL_SIMD_NATIVE_BYTES`.
+         * @see https://cppreference.com/w/cpp/experimental/simd/native
+         * @note A feature from the Parallelism TS v2.
+         */
+        template <class T>
+        using native = fixed_size<static_cast<int>(CPPUTILS_STDREIMPL_SIMD_NATIVE_BYTES / sizeof(T) > 0 ? CPPUTILS_STDREIMPL_SIMD_NATIVE_BYTES / sizeof(T) : 1)>;
+
+        template <class T>
+        using compatible = native<T>;
+    }
+
+    /**
+     * @brief The tags for loads and stores, which say how the memory is aligned.
+     * @see https://cppreference.com/w/cpp/experimental/simd/element_aligned_tag
+     * @note A feature from the Parallelism TS v2.
+     */
+    struct element_aligned_tag
+    {
+    };
+
+    struct vector_aligned_tag
+    {
+    };
+
+    template <std::size_t N>
+    struct overaligned_tag
+    {
+    };
+
+    inline constexpr element_aligned_tag element_aligned{};
+    inline constexpr vector_aligned_tag vector_aligned{};
+
+    template <std::size_t N>
+    inline constexpr overaligned_tag<N> overaligned{};
+
+    template <class T, class Abi = simd_abi::native<T>>
+    class simd;
+
+    template <class T, class Abi = simd_abi::native<T>>
+    class simd_mask;
+
+    template <class T>
+    using native_simd = simd<T, simd_abi::native<T>>;
+
+    template <class T>
+    using native_simd_mask = simd_mask<T, simd_abi::native<T>>;
+
+    template <class T, int N>
+    using fixed_size_simd = simd<T, simd_abi::fixed_size<N>>;
+
+    template <class T, int N>
+    using fixed_size_simd_mask = simd_mask<T, simd_abi::fixed_size<N>>;
+
+    namespace Detail
+    {
+        /**
+         * @brief The element types that a `simd` can hold: the arithmetic types other than `bool`.
+         */
+        template <class T>
+        concept simd_vectorizable = std::is_arithmetic_v<T> && !StdReimpl::same_as<T, bool> && StdReimpl::same_as<T, std::remove_cv_t<T>>;
+
+        template <class Abi>
+        struct simd_abi_size;
+
+        template <>
+        struct simd_abi_size<simd_abi::scalar> : std::integral_constant<std::size_t, 1>
+        {
+        };
+
+        template <int N>
+        struct simd_abi_size<simd_abi::fixed_size<N>> : std::integral_constant<std::size_t, static_cast<std::size_t>(N)>
+        {
+            static_assert(N > 0 && N <= 64, "A simd holds 1 to 64 elements.");
+        };
+
+        template <class T>
+        struct simd_is_flag : std::false_type
+        {
+        };
+
+        template <>
+        struct simd_is_flag<element_aligned_tag> : std::true_type
+        {
+        };
+
+        template <>
+        struct simd_is_flag<vector_aligned_tag> : std::true_type
+        {
+        };
+
+        template <std::size_t N>
+        struct simd_is_flag<overaligned_tag<N>> : std::true_type
+        {
+        };
+
+        template <class Flags>
+        concept simd_flag = simd_is_flag<Flags>::value;
+
+        /**
+         * @brief Whether broadcasting a `From` to a `simd<To>` keeps every value. `int` is always allowed, so that
+         *        literals work, as is `unsigned int` for unsigned elements.
+         */
+        template <class From, class To>
+        concept simd_value_preserving = std::is_arithmetic_v<From> &&
+            (StdReimpl::same_as<From, To> || StdReimpl::same_as<From, int> || (StdReimpl::same_as<From, unsigned int> && std::is_unsigned_v<To>) ||
+            (std::is_floating_point_v<To> && std::numeric_limits<From>::digits <= std::numeric_limits<To>::digits &&
+                std::numeric_limits<From>::max_exponent <= std::numeric_limits<To>::max_exponent) ||
+            (std::is_integral_v<From> && std::is_integral_v<To> && std::is_signed_v<From> == std::is_signed_v<To> &&
+                std::numeric_limits<From>::digits <= std::numeric_limits<To>::digits));
+
+        /**
+         * @brief How a `simd<T, Abi>` and its mask are stored. A vector type where there is one no wider than the native
+         *        registers, whose mask is the vector that comparing two of them gives (each element all ones or all
+         *        zeros), or else arrays.
+         */
+        template <class T, class Abi>
+        struct simd_storage
+        {
+            static constexpr std::size_t size = simd_abi_size<Abi>::value;
+            static constexpr bool is_vector = false;
+
+            using type = std::array<T, size>;
+            using mask_type = std::array<bool, size>;
+            using mask_element = bool;
+        };
+
+#if defined(CPPUTILS_STDREIMPL_SIMD_USE_VECTOR_EXTENSIONS)
+        template <class T, std::size_t Bytes>
+        struct simd_vector
+        {
+            using type [[gnu::vector_size(Bytes)]] = T;
+        };
+
+        template <class T, class Abi>
+        inline constexpr std::size_t simd_vector_bytes = sizeof(T) * simd_abi_size<Abi>::value;
+
+        template <class T, class Abi>
+        concept simd_has_vector = !StdReimpl::same_as<Abi, simd_abi::scalar> &&
+            (StdReimpl::integral<T> || StdReimpl::same_as<T, float> || StdReimpl::same_as<T, double>) &&
+            (simd_vector_bytes<T, Abi> == 16 || simd_vector_bytes<T, Abi> == 32 || simd_vector_bytes<T, Abi> == 64) &&
+            simd_vector_bytes<T, Abi> <= CPPUTILS_STDREIMPL_SIMD_NATIVE_BYTES;
+
+        template <class T, class Abi>
+            requires simd_has_vector<T, Abi>
+        struct simd_storage<T, Abi>
+        {
+            static constexpr std::size_t size = simd_abi_size<Abi>::value;
+            static constexpr bool is_vector = true;
+
+            using type = typename simd_vector<T, simd_vector_bytes<T, Abi>>::type;
+            using mask_type = decltype(std::declval<type>() < std::declval<type>());
+            using mask_element = std::remove_cvref_t<decltype(std::declval<mask_type>()[0])>;
+        };
+#endif
+
+        /**
+         * @brief Lets the free functions get at the storage of a `simd` or a `simd_mask`, and make one from storage.
+         */
+        struct simd_access
+        {
+            template <class V>
+            static constexpr auto& data(V& v) noexcept;
+
+            template <class V>
+            static constexpr const auto& data(const V& v) noexcept;
+
+            template <class V, class Storage>
+            static constexpr V make(const Storage& storage) noexcept;
+        };
+
+        /**
+         * @brief The value that `binary_op` leaves other values alone with, for the masked `reduce`.
+         */
+        template <class T, class BinaryOperation>
+        constexpr T simd_identity() noexcept;
+    }
+
+    /**
+     * @see https://cppreference.com/w/cpp/experimental/simd/is_simd
+     * @note A feature from the Parallelism TS v2.
+     */
+    template <class T>
+    struct is_simd : std::false_type
+    {
+    };
+
+    template <class T, class Abi>
+    struct is_simd<simd<T, Abi>> : std::true_type
+    {
+    };
+
+    template <class T>
+    inline constexpr bool is_simd_v = is_simd<T>::value;
+
+    template <class T>
+    struct is_simd_mask : std::false_type
+    {
+    };
+
+    template <class T, class Abi>
+    struct is_simd_mask<simd_mask<T, Abi>> : std::true_type
+    {
+    };
+
+    template <class T>
+    inline constexpr bool is_simd_mask_v = is_simd_mask<T>::value;
+
+    template <class T, class Abi = simd_abi::native<T>>
+    struct simd_size : std::integral_constant<std::size_t, Detail::simd_abi_size<Abi>::value>
+    {
+    };
+
+    template <class T, class Abi = simd_abi::native<T>>
+    inline constexpr std::size_t simd_size_v = simd_size<T, Abi>::value;
+
+    /**
+     * @brief The alignment that `vector_aligned` loads and stores of a `V` need.
+     * @see https://cppreference.com/w/cpp/experimental/simd/memory_alignment
+     * @note A feature from the Parallelism TS v2.
+     */
+    template <class V>
+    struct memory_alignment : std::integral_constant<std::size_t, alignof(typename Detail::simd_storage<typename V::value_type, typename V::abi_type>::type)>
+    {
+    };
+
+    template <class V>
+    inline constexpr std::size_t memory_alignment_v = memory_alignment<V>::value;
+
+    /**
+     * @brief A mask of `simd_size_v<T, Abi>` booleans, as comparing two `simd<T, Abi>` gives.
+     * @see https://eel.is/c++draft/simd.mask.class
+     * @see https://cppreference.com/w/cpp/experimental/simd/simd_mask
+     * @note A feature from the C++26 standard, with the names of the Parallelism TS v2.
+     */
+    template <class T, class Abi>
+    class simd_mask
+    {
+        static_assert(Detail::simd_vectorizable<T>, "A simd_mask is for the elements of a simd.");
+
+        using storage = Detail::simd_storage<T, Abi>;
+
+    public:
+        using value_type = bool;
+        using simd_type = simd<T, Abi>;
+        using abi_type = Abi;
+
+        static constexpr std::size_t size() noexcept;
+
+        simd_mask() noexcept = default;
+
+        /**
+         * @brief Every element `value`.
+         */
+        constexpr explicit simd_mask(bool value) noexcept;
+
+        template <Detail::simd_flag Flags>
+        constexpr simd_mask(const bool* mem, Flags flags);
+
+        template <Detail::simd_flag Flags>
+        constexpr void copy_from(const bool* mem, Flags flags);
+
+        template <Detail::simd_flag Flags>
+        constexpr void copy_to(bool* mem, Flags flags) const;
+
+        constexpr bool operator[](std::size_t i) const;
+
+        constexpr simd_mask operator!() const noexcept;
+
+        friend constexpr simd_mask operator&&(const simd_mask& x, const simd_mask& y) noexcept
+        {
+            return x & y;
+        }
+
+        friend constexpr simd_mask operator||(const simd_mask& x, const simd_mask& y) noexcept
+        {
+            return x | y;
+        }
+
+        friend constexpr simd_mask operator&(const simd_mask& x, const simd_mask& y) noexcept
+        {
+            return simd_mask::Combine(x, y, [](const auto& a, const auto& b) { return a & b; });
+        }
+
+        friend constexpr simd_mask operator|(const simd_mask& x, const simd_mask& y) noexcept
+        {
+            return simd_mask::Combine(x, y, [](const auto& a, const auto& b) { return a | b; });
+        }
+
+        friend constexpr simd_mask operator^(const simd_mask& x, const simd_mask& y) noexcept
+        {
+            return simd_mask::Combine(x, y, [](const auto& a, const auto& b) { return a ^ b; });
+        }
+
+        friend constexpr simd_mask operator==(const simd_mask& x, const simd_mask& y) noexcept
+        {
+            return !(x ^ y);
+        }
+
+        friend constexpr simd_mask operator!=(const simd_mask& x, const simd_mask& y) noexcept
+        {
+            return x ^ y;
+        }
+
+        friend constexpr simd_mask& operator&=(simd_mask& x, const simd_mask& y) noexcept
+        {
+            return x = x & y;
+        }
+
+        friend constexpr simd_mask& operator|=(simd_mask& x, const simd_mask& y) noexcept
+        {
+            return x = x | y;
+        }
+
+        friend constexpr simd_mask& operator^=(simd_mask& x, const simd_mask& y) noexcept
+        {
+            return x = x ^ y;
+        }
+
+    private:
+        friend struct Detail::simd_access;
+
+        /**
+         * @brief `op` on the storage of both masks, which for masks of all ones and all zeros is the same as on each
+         *        element.
+         */
+        template <class Op>
+        static constexpr simd_mask Combine(const simd_mask& x, const simd_mask& y, Op op) noexcept;
+
+        typename storage::mask_type data;
+    };
+
+    /**
+     * @brief `simd_size_v<T, Abi>` elements of `T`, whose operators work on each element at once. Stored in a vector
+     *        register where the compiler has vector types, and as an array elsewhere. During constant evaluation, every
+     *        operation works one element at a time.
+     * @see https://eel.is/c++draft/simd.class
+     * @see https://cppreference.com/w/cpp/experimental/simd/simd
+     * @note A feature from the C++26 standard, with the names of the Parallelism TS v2.
+     */
+    template <class T, class Abi>
+    class simd
+    {
+        static_assert(Detail::simd_vectorizable<T>, "A simd holds arithmetic types other than bool.");
+
+        using storage = Detail::simd_storage<T, Abi>;
+
+    public:
+        using value_type = T;
+        using mask_type = simd_mask<T, Abi>;
+        using abi_type = Abi;
+
+        static constexpr std::size_t size() noexcept;
+
+        simd() noexcept = default;
+
+        /**
+         * @brief Every element `value`. Only from types that hold no values that `T` can't, and from `int`.
+         */
+        template <class U>
+            requires Detail::simd_value_preserving<std::remove_cvref_t<U>, T>
+        constexpr simd(U&& value) noexcept;
+
+        /**
+         * @brief Converts each element of a `simd` of the same size. Implicit only when every value is kept.
+         */
+        template <class U, class UAbi>
+            requires (simd_size_v<U, UAbi> == simd_size_v<T, Abi> && !StdReimpl::same_as<simd<U, UAbi>, simd>)
+        constexpr explicit(!Detail::simd_value_preserving<U, T>) simd(const simd<U, UAbi>& x) noexcept;
+
+        /**
+         * @brief Element `i` is `gen(std::integral_constant<std::size_t, i>())`.
+         */
+        template <class G>
+            requires std::is_invocable_v<G&, std::integral_constant<std::size_t, 0>>
+        constexpr explicit simd(G&& gen);
+
+        /**
+         * @brief Loads `size()` elements from `mem`, converting each to `T`.
+         */
+        template <class U, Detail::simd_flag Flags>
+        constexpr simd(const U* mem, Flags flags);
+
+        template <class U, Detail::simd_flag Flags>
+        constexpr void copy_from(const U* mem, Flags flags);
+
+        template <class U, Detail::simd_flag Flags>
+        constexpr void copy_to(U* mem, Flags flags) const;
+
+        constexpr T operator[](std::size_t i) const;
+
+        constexpr simd& operator++() noexcept;
+        constexpr simd operator++(int) noexcept;
+        constexpr simd& operator--() noexcept;
+        constexpr simd operator--(int) noexcept;
+
+        constexpr mask_type operator!() const noexcept;
+        constexpr simd operator+() const noexcept;
+        constexpr simd operator-() const noexcept;
+
+        constexpr simd operator~() const noexcept
+            requires StdReimpl::integral<T>;
+
+        friend constexpr simd operator+(const simd& x, const simd& y) noexcept
+        {
+            return simd::Combine(x, y, [](const auto& a, const auto& b) { return a + b; });
+        }
+
+        friend constexpr simd operator-(const simd& x, const simd& y) noexcept
+        {
+            return simd::Combine(x, y, [](const auto& a, const auto& b) { return a - b; });
+        }
+
+        friend constexpr simd operator*(const simd& x, const simd& y) noexcept
+        {
+            return simd::Combine(x, y, [](const auto& a, const auto& b) { return a * b; });
+        }
+
+        friend constexpr simd operator/(const simd& x, const simd& y) noexcept
+        {
+            return simd::Combine(x, y, [](const auto& a, const auto& b) { return a / b; });
+        }
+
+        friend constexpr simd operator%(const simd& x, const simd& y) noexcept
+            requires StdReimpl::integral<T>
+        {
+            return simd::Combine(x, y, [](const auto& a, const auto& b) { return a % b; });
+        }
+
+        friend constexpr simd operator&(const simd& x, const simd& y) noexcept
+            requires StdReimpl::integral<T>
+        {
+            return simd::Combine(x, y, [](const auto& a, const auto& b) { return a & b; });
+        }
+
+        friend constexpr simd operator|(const simd& x, const simd& y) noexcept
+            requires StdReimpl::integral<T>
+        {
+            return simd::Combine(x, y, [](const auto& a, const auto& b) { return a | b; });
+        }
+
+        friend constexpr simd operator^(const simd& x, const simd& y) noexcept
+            requires StdReimpl::integral<T>
+        {
+            return simd::Combine(x, y, [](const auto& a, const auto& b) { return a ^ b; });
+        }
+
+        friend constexpr simd operator<<(const simd& x, const simd& y) noexcept
+            requires StdReimpl::integral<T>
+        {
+            return simd::Combine(x, y, [](const auto& a, const auto& b) { return a << b; });
+        }
+
+        friend constexpr simd operator>>(const simd& x, const simd& y) noexcept
+            requires StdReimpl::integral<T>
+        {
+            return simd::Combine(x, y, [](const auto& a, const auto& b) { return a >> b; });
+        }
+
+        friend constexpr simd& operator+=(simd& x, const simd& y) noexcept
+        {
+            return x = x + y;
+        }
+
+        friend constexpr simd& operator-=(simd& x, const simd& y) noexcept
+        {
+            return x = x - y;
+        }
+
+        friend constexpr simd& operator*=(simd& x, const simd& y) noexcept
+        {
+            return x = x * y;
+        }
+
+        friend constexpr simd& operator/=(simd& x, const simd& y) noexcept
+        {
+            return x = x / y;
+        }
+
+        friend constexpr simd& operator%=(simd& x, const simd& y) noexcept
+            requires StdReimpl::integral<T>
+        {
+            return x = x % y;
+        }
+
+        friend constexpr simd& operator&=(simd& x, const simd& y) noexcept
+            requires StdReimpl::integral<T>
+        {
+            return x = x & y;
+        }
+
+        friend constexpr simd& operator|=(simd& x, const simd& y) noexcept
+            requires StdReimpl::integral<T>
+        {
+            return x = x | y;
+        }
+
+        friend constexpr simd& operator^=(simd& x, const simd& y) noexcept
+            requires StdReimpl::integral<T>
+        {
+            return x = x ^ y;
+        }
+
+        friend constexpr simd& operator<<=(simd& x, const simd& y) noexcept
+            requires StdReimpl::integral<T>
+        {
+            return x = x << y;
+        }
+
+        friend constexpr simd& operator>>=(simd& x, const simd& y) noexcept
+            requires StdReimpl::integral<T>
+        {
+            return x = x >> y;
+        }
+
+        friend constexpr mask_type operator==(const simd& x, const simd& y) noexcept
+        {
+            return simd::Compare(x, y, [](const auto& a, const auto& b) { return a == b; });
+        }
+
+        friend constexpr mask_type operator!=(const simd& x, const simd& y) noexcept
+        {
+            return simd::Compare(x, y, [](const auto& a, const auto& b) { return a != b; });
+        }
+
+        friend constexpr mask_type operator<(const simd& x, const simd& y) noexcept
+        {
+            return simd::Compare(x, y, [](const auto& a, const auto& b) { return a < b; });
+        }
+
+        friend constexpr mask_type operator<=(const simd& x, const simd& y) noexcept
+        {
+            return simd::Compare(x, y, [](const auto& a, const auto& b) { return a <= b; });
+        }
+
+        friend constexpr mask_type operator>(const simd& x, const simd& y) noexcept
+        {
+            return simd::Compare(x, y, [](const auto& a, const auto& b) { return a > b; });
+        }
+
+        friend constexpr mask_type operator>=(const simd& x, const simd& y) noexcept
+        {
+            return simd::Compare(x, y, [](const auto& a, const auto& b) { return a >= b; });
+        }
+
+    private:
+        friend struct Detail::simd_access;
+
+        /**
+         * @brief `op` on the vectors at runtime, and on each pair of elements otherwise.
+         */
+        template <class Op>
+        static constexpr simd Combine(const simd& x, const simd& y, Op op) noexcept;
+
+        template <class Op>
+        static constexpr mask_type Compare(const simd& x, const simd& y, Op op) noexcept;
+
+        typename storage::type data;
+    };
+
+    /**
+     * @brief Assigns to, loads into, or stores the elements of a `simd` that a mask selects, and leaves the rest alone.
+     *        Made by `where`.
+     * @see https://cppreference.com/w/cpp/experimental/simd/where_expression
+     * @note A feature from the Parallelism TS v2.
+     */
+    template <class M, class V>
+    class const_where_expression
+    {
+    public:
+        constexpr const_where_expression(const M& inMask, V& inValue) noexcept;
+
+        const_where_expression(const const_where_expression&) = delete;
+        const_where_expression& operator=(const const_where_expression&) = delete;
+
+        /**
+         * @brief Stores only the selected elements. The others in `mem` aren't touched.
+         */
+        template <class U, Detail::simd_flag Flags>
+        constexpr void copy_to(U* mem, Flags flags) const&&;
+
+    protected:
+        const M& mask;
+        V& value;
+    };
+
+    template <class M, class V>
+    class where_expression : public const_where_expression<M, V>
+    {
+    public:
+        using const_where_expression<M, V>::const_where_expression;
+
+        template <class U>
+            requires std::is_convertible_v<U, V>
+        constexpr void operator=(U&& x) && noexcept;
+
+        template <class U>
+            requires std::is_convertible_v<U, V>
+        constexpr void operator+=(U&& x) && noexcept;
+
+        template <class U>
+            requires std::is_convertible_v<U, V>
+        constexpr void operator-=(U&& x) && noexcept;
+
+        template <class U>
+            requires std::is_convertible_v<U, V>
+        constexpr void operator*=(U&& x) && noexcept;
+
+        template <class U>
+            requires std::is_convertible_v<U, V>
+        constexpr void operator/=(U&& x) && noexcept;
+
+        /**
+         * @brief Loads only the selected elements. The others in `mem` aren't read, so they needn't exist.
+         */
+        template <class U, Detail::simd_flag Flags>
+        constexpr void copy_from(const U* mem, Flags flags) &&;
+    };
+
+    /**
+     * @see https://cppreference.com/w/cpp/experimental/simd/where
+     * @note A feature from the Parallelism TS v2.
+     */
+    template <class T, class Abi>
+    constexpr where_expression<simd_mask<T, Abi>, simd<T, Abi>> where(const typename simd<T, Abi>::mask_type& mask, simd<T, Abi>& value) noexcept;
+
+    template <class T, class Abi>
+    constexpr const_where_expression<simd_mask<T, Abi>, const simd<T, Abi>> where(const typename simd<T, Abi>::mask_type& mask,
+        const simd<T, Abi>& value) noexcept;
+
+    /**
+     * @brief Element `i` is `x[i]` where `mask[i]`, and `y[i]` elsewhere.
+     * @see https://eel.is/c++draft/simd.mask.cond
+     * @note A feature from the C++26 standard.
+     */
+    template <class T, class Abi>
+    constexpr simd<T, Abi> select(const simd_mask<T, Abi>& mask, const simd<T, Abi>& x, const simd<T, Abi>& y) noexcept;
+
+    /**
+     * @brief Combines all elements with `binary_op`, which must be associative and is called with `simd`s of any size.
+     *        Halves the vector at each step, so there are only log2 of the size steps at runtime.
+     * @see https://eel.is/c++draft/simd.reductions
+     * @note A feature from the C++26 standard.
+     */
+    template <class T, class Abi, class BinaryOperation = std::plus<>>
+    constexpr T reduce(const simd<T, Abi>& x, BinaryOperation binary_op = {});
+
+    /**
+     * @brief Combines the selected elements, or returns `identity_element` if there are none. It defaults to the identity
+     *        of `std::plus`, `std::multiplies`, `std::bit_and`, `std::bit_or` and `std::bit_xor`.
+     */
+    template <class T, class Abi, class BinaryOperation = std::plus<>>
+    constexpr T reduce(const simd<T, Abi>& x, const typename simd<T, Abi>::mask_type& mask, BinaryOperation binary_op = {},
+        std::type_identity_t<T> identity_element = Detail::simd_identity<T, BinaryOperation>());
+
+    template <class T, class Abi>
+    constexpr T reduce_min(const simd<T, Abi>& x) noexcept;
+
+    template <class T, class Abi>
+    constexpr T reduce_min(const simd<T, Abi>& x, const typename simd<T, Abi>::mask_type& mask) noexcept;
+
+    template <class T, class Abi>
+    constexpr T reduce_max(const simd<T, Abi>& x) noexcept;
+
+    template <class T, class Abi>
+    constexpr T reduce_max(const simd<T, Abi>& x, const typename simd<T, Abi>::mask_type& mask) noexcept;
+
+    /**
+     * @brief Reductions of masks. On x86, the mask becomes an integer with one bit per element in a single instruction.
+     * @see https://eel.is/c++draft/simd.mask.reductions
+     * @note A feature from the C++26 standard.
+     */
+    template <class T, class Abi>
+    constexpr bool all_of(const simd_mask<T, Abi>& mask) noexcept;
+
+    template <class T, class Abi>
+    constexpr bool any_of(const simd_mask<T, Abi>& mask) noexcept;
+
+    template <class T, class Abi>
+    constexpr bool none_of(const simd_mask<T, Abi>& mask) noexcept;
+
+    template <class T, class Abi>
+    constexpr int reduce_count(const simd_mask<T, Abi>& mask) noexcept;
+
+    /**
+     * @brief The index of the first or last selected element. At least one must be selected.
+     */
+    template <class T, class Abi>
+    constexpr int reduce_min_index(const simd_mask<T, Abi>& mask);
+
+    template <class T, class Abi>
+    constexpr int reduce_max_index(const simd_mask<T, Abi>& mask);
+
+    /**
+     * @brief Element-wise `std::min`, `std::max` and `std::clamp`, including which argument is returned for NaNs. See
+     *        `abs` in `cstdlib.h` for the element-wise `abs`.
+     * @see https://eel.is/c++draft/simd.alg
+     * @note A feature from the C++26 standard.
+     */
+    template <class T, class Abi>
+    constexpr simd<T, Abi> min(const simd<T, Abi>& a, const simd<T, Abi>& b) noexcept;
+
+    template <class T, class Abi>
+    constexpr simd<T, Abi> max(const simd<T, Abi>& a, const simd<T, Abi>& b) noexcept;
+
+    template <class T, class Abi>
+    constexpr simd<T, Abi> clamp(const simd<T, Abi>& v, const simd<T, Abi>& lo, const simd<T, Abi>& hi);
+}
+
+#include <CppUtils/StdReimpl/simd.inl>
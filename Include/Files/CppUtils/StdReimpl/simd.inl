@@ -0,0 +1,682 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/simd.h>
+#include <CppUtils/StdReimpl/bit.h>
+
+#include <cassert>
+#include <cstring>
+#include <memory>
+
+#if defined(CPPUTILS_STDREIMPL_SIMD_USE_VECTOR_EXTENSIONS) && (defined(__SSE2__) || defined(_M_X64))
+#   include <immintrin.h>
+#   define CPPUTILS_STDREIMPL_SIMD_USE_SSE2 1
+#   if defined(__AVX__)
+#       define CPPUTILS_STDREIMPL_SIMD_USE_AVX 1
+#   endif
+#endif
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        template <class V>
+        constexpr auto& simd_access::data(V& v) noexcept
+        {
+            return v.data;
+        }
+
+        template <class V>
+        constexpr const auto& simd_access::data(const V& v) noexcept
+        {
+            return v.data;
+        }
+
+        template <class V, class Storage>
+        constexpr V simd_access::make(const Storage& storage) noexcept
+        {
+            V v;
+            v.data = storage;
+            return v;
+        }
+
+        /**
+         * @brief Storage whose element `i` is `fn(i)`, made in one go, since the elements of a vector type can't be
+         *        assigned one at a time during constant evaluation.
+         */
+        template <class Storage, std::size_t N, class Fn>
+        constexpr Storage simd_generate(Fn&& fn)
+        {
+            return [&fn]<std::size_t... I>(std::index_sequence<I...>) { return Storage{fn(I)...}; }(std::make_index_sequence<N>());
+        }
+
+        template <class Flags, std::size_t VectorAlignment, class U>
+        constexpr U* simd_aligned(U* mem) noexcept
+        {
+            if constexpr (StdReimpl::same_as<Flags, vector_aligned_tag>)
+            {
+                return std::assume_aligned<VectorAlignment>(mem);
+            }
+            else if constexpr (!StdReimpl::same_as<Flags, element_aligned_tag>)
+            {
+                return [mem]<std::size_t N>(overaligned_tag<N>) { return std::assume_aligned<N>(mem); }(Flags());
+            }
+            else
+            {
+                return mem;
+            }
+        }
+
+        template <class T, class BinaryOperation>
+        constexpr T simd_identity() noexcept
+        {
+            if constexpr (StdReimpl::same_as<BinaryOperation, std::plus<>> || StdReimpl::same_as<BinaryOperation, std::plus<T>> ||
+                StdReimpl::same_as<BinaryOperation, std::bit_or<>> || StdReimpl::same_as<BinaryOperation, std::bit_or<T>> ||
+                StdReimpl::same_as<BinaryOperation, std::bit_xor<>> || StdReimpl::same_as<BinaryOperation, std::bit_xor<T>>)
+            {
+                return T(0);
+            }
+            else if constexpr (StdReimpl::same_as<BinaryOperation, std::multiplies<>> || StdReimpl::same_as<BinaryOperation, std::multiplies<T>>)
+            {
+                return T(1);
+            }
+            else if constexpr (StdReimpl::same_as<BinaryOperation, std::bit_and<>> || StdReimpl::same_as<BinaryOperation, std::bit_and<T>>)
+            {
+                return static_cast<T>(~T(0));
+            }
+            else
+            {
+                static_assert(sizeof(BinaryOperation) == 0, "Pass the identity element of this operation to reduce.");
+            }
+        }
+
+        /**
+         * @brief The mask as an integer, with bit `i` set if element `i` is. One instruction on SSE2 and AVX for masks of
+         *        1, 4 or 8 byte elements.
+         */
+        template <class T, class Abi>
+        constexpr std::uint64_t simd_mask_bits(const simd_mask<T, Abi>& mask) noexcept
+        {
+            using storage = simd_storage<T, Abi>;
+            const auto& data = simd_access::data(mask);
+
+#if defined(CPPUTILS_STDREIMPL_SIMD_USE_SSE2)
+            if constexpr (storage::is_vector && sizeof(data) == 16 && (sizeof(T) == 1 || sizeof(T) == 4 || sizeof(T) == 8))
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    const __m128i bits = StdReimpl::bit_cast<__m128i>(data);
+                    if constexpr (sizeof(T) == 1)
+                    {
+                        return static_cast<std::uint32_t>(_mm_movemask_epi8(bits));
+                    }
+                    else if constexpr (sizeof(T) == 4)
+                    {
+                        return static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(bits)));
+                    }
+                    else
+                    {
+                        return static_cast<std::uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(bits)));
+                    }
+                }
+            }
+#endif
+#if defined(CPPUTILS_STDREIMPL_SIMD_USE_AVX)
+            if constexpr (storage::is_vector && sizeof(data) == 32 && (sizeof(T) == 4 || sizeof(T) == 8))
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    if constexpr (sizeof(T) == 4)
+                    {
+                        return static_cast<std::uint32_t>(_mm256_movemask_ps(StdReimpl::bit_cast<__m256>(data)));
+                    }
+                    else
+                    {
+                        return static_cast<std::uint32_t>(_mm256_movemask_pd(StdReimpl::bit_cast<__m256d>(data)));
+                    }
+                }
+            }
+#endif
+
+            std::uint64_t bits = 0;
+            for (std::size_t i = 0; i < storage::size; ++i)
+            {
+                bits |= static_cast<std::uint64_t>(data[i] != 0) << i;
+            }
+            return bits;
+        }
+    }
+
+    //
+    // simd_mask
+    //
+
+    template <class T, class Abi>
+    constexpr std::size_t simd_mask<T, Abi>::size() noexcept
+    {
+        return storage::size;
+    }
+
+    template <class T, class Abi>
+    constexpr simd_mask<T, Abi>::simd_mask(bool value) noexcept
+        : data(Detail::simd_generate<typename storage::mask_type, storage::size>([value](std::size_t)
+        {
+            return static_cast<typename storage::mask_element>(value ? -1 : 0);
+        }))
+    {
+    }
+
+    template <class T, class Abi>
+    template <Detail::simd_flag Flags>
+    constexpr simd_mask<T, Abi>::simd_mask(const bool* mem, Flags flags)
+    {
+        copy_from(mem, flags);
+    }
+
+    template <class T, class Abi>
+    template <Detail::simd_flag Flags>
+    constexpr void simd_mask<T, Abi>::copy_from(const bool* mem, Flags)
+    {
+        data = Detail::simd_generate<typename storage::mask_type, storage::size>([mem](std::size_t i)
+        {
+            return static_cast<typename storage::mask_element>(mem[i] ? -1 : 0);
+        });
+    }
+
+    template <class T, class Abi>
+    template <Detail::simd_flag Flags>
+    constexpr void simd_mask<T, Abi>::copy_to(bool* mem, Flags) const
+    {
+        for (std::size_t i = 0; i < storage::size; ++i)
+        {
+            mem[i] = (*this)[i];
+        }
+    }
+
+    template <class T, class Abi>
+    constexpr bool simd_mask<T, Abi>::operator[](std::size_t i) const
+    {
+        assert(i < storage::size);
+        return data[i] != 0;
+    }
+
+    template <class T, class Abi>
+    constexpr simd_mask<T, Abi> simd_mask<T, Abi>::operator!() const noexcept
+    {
+        return *this ^ simd_mask(true);
+    }
+
+    template <class T, class Abi>
+    template <class Op>
+    constexpr simd_mask<T, Abi> simd_mask<T, Abi>::Combine(const simd_mask& x, const simd_mask& y, Op op) noexcept
+    {
+        if constexpr (storage::is_vector)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Detail::simd_access::make<simd_mask>(op(x.data, y.data));
+            }
+        }
+        return Detail::simd_access::make<simd_mask>(Detail::simd_generate<typename storage::mask_type, storage::size>([&](std::size_t i)
+        {
+            return static_cast<typename storage::mask_element>(op(x.data[i], y.data[i]));
+        }));
+    }
+
+    //
+    // simd
+    //
+
+    template <class T, class Abi>
+    constexpr std::size_t simd<T, Abi>::size() noexcept
+    {
+        return storage::size;
+    }
+
+    template <class T, class Abi>
+    template <class U>
+        requires Detail::simd_value_preserving<std::remove_cvref_t<U>, T>
+    constexpr simd<T, Abi>::simd(U&& value) noexcept
+        : data(Detail::simd_generate<typename storage::type, storage::size>([converted = static_cast<T>(value)](std::size_t) { return converted; }))
+    {
+    }
+
+    template <class T, class Abi>
+    template <class U, class UAbi>
+        requires (simd_size_v<U, UAbi> == simd_size_v<T, Abi> && !StdReimpl::same_as<simd<U, UAbi>, simd<T, Abi>>)
+    constexpr simd<T, Abi>::simd(const simd<U, UAbi>& x) noexcept
+    {
+#if defined(CPPUTILS_STDREIMPL_SIMD_USE_VECTOR_EXTENSIONS)
+        if constexpr (storage::is_vector && Detail::simd_storage<U, UAbi>::is_vector)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                data = __builtin_convertvector(Detail::simd_access::data(x), typename storage::type);
+                return;
+            }
+        }
+#endif
+        data = Detail::simd_generate<typename storage::type, storage::size>([&x](std::size_t i) { return static_cast<T>(x[i]); });
+    }
+
+    template <class T, class Abi>
+    template <class G>
+        requires std::is_invocable_v<G&, std::integral_constant<std::size_t, 0>>
+    constexpr simd<T, Abi>::simd(G&& gen)
+        : data([&gen]<std::size_t... I>(std::index_sequence<I...>)
+        {
+            return typename storage::type{static_cast<T>(gen(std::integral_constant<std::size_t, I>()))...};
+        }(std::make_index_sequence<storage::size>()))
+    {
+    }
+
+    template <class T, class Abi>
+    template <class U, Detail::simd_flag Flags>
+    constexpr simd<T, Abi>::simd(const U* mem, Flags flags)
+    {
+        copy_from(mem, flags);
+    }
+
+    template <class T, class Abi>
+    template <class U, Detail::simd_flag Flags>
+    constexpr void simd<T, Abi>::copy_from(const U* mem, Flags)
+    {
+        mem = Detail::simd_aligned<Flags, alignof(typename storage::type)>(mem);
+        if constexpr (StdReimpl::same_as<U, T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                std::memcpy(&data, mem, sizeof(data));
+                return;
+            }
+        }
+        data = Detail::simd_generate<typename storage::type, storage::size>([mem](std::size_t i) { return static_cast<T>(mem[i]); });
+    }
+
+    template <class T, class Abi>
+    template <class U, Detail::simd_flag Flags>
+    constexpr void simd<T, Abi>::copy_to(U* mem, Flags) const
+    {
+        mem = Detail::simd_aligned<Flags, alignof(typename storage::type)>(mem);
+        if constexpr (StdReimpl::same_as<U, T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                std::memcpy(mem, &data, sizeof(data));
+                return;
+            }
+        }
+        for (std::size_t i = 0; i < storage::size; ++i)
+        {
+            mem[i] = static_cast<U>(data[i]);
+        }
+    }
+
+    template <class T, class Abi>
+    constexpr T simd<T, Abi>::operator[](std::size_t i) const
+    {
+        assert(i < storage::size);
+        return data[i];
+    }
+
+    template <class T, class Abi>
+    constexpr simd<T, Abi>& simd<T, Abi>::operator++() noexcept
+    {
+        return *this += T(1);
+    }
+
+    template <class T, class Abi>
+    constexpr simd<T, Abi> simd<T, Abi>::operator++(int) noexcept
+    {
+        const simd old = *this;
+        *this += T(1);
+        return old;
+    }
+
+    template <class T, class Abi>
+    constexpr simd<T, Abi>& simd<T, Abi>::operator--() noexcept
+    {
+        return *this -= T(1);
+    }
+
+    template <class T, class Abi>
+    constexpr simd<T, Abi> simd<T, Abi>::operator--(int) noexcept
+    {
+        const simd old = *this;
+        *this -= T(1);
+        return old;
+    }
+
+    template <class T, class Abi>
+    constexpr typename simd<T, Abi>::mask_type simd<T, Abi>::operator!() const noexcept
+    {
+        return *this == simd(T(0));
+    }
+
+    template <class T, class Abi>
+    constexpr simd<T, Abi> simd<T, Abi>::operator+() const noexcept
+    {
+        return *this;
+    }
+
+    template <class T, class Abi>
+    constexpr simd<T, Abi> simd<T, Abi>::operator-() const noexcept
+    {
+        return simd(T(0)) - *this;
+    }
+
+    template <class T, class Abi>
+    constexpr simd<T, Abi> simd<T, Abi>::operator~() const noexcept
+        requires StdReimpl::integral<T>
+    {
+        return *this ^ simd(static_cast<T>(~T(0)));
+    }
+
+    template <class T, class Abi>
+    template <class Op>
+    constexpr simd<T, Abi> simd<T, Abi>::Combine(const simd& x, const simd& y, Op op) noexcept
+    {
+        if constexpr (storage::is_vector)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Detail::simd_access::make<simd>(static_cast<typename storage::type>(op(x.data, y.data)));
+            }
+        }
+        return Detail::simd_access::make<simd>(Detail::simd_generate<typename storage::type, storage::size>([&](std::size_t i)
+        {
+            return static_cast<T>(op(x.data[i], y.data[i]));
+        }));
+    }
+
+    template <class T, class Abi>
+    template <class Op>
+    constexpr typename simd<T, Abi>::mask_type simd<T, Abi>::Compare(const simd& x, const simd& y, Op op) noexcept
+    {
+        if constexpr (storage::is_vector)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Detail::simd_access::make<mask_type>(op(x.data, y.data));
+            }
+        }
+        return Detail::simd_access::make<mask_type>(Detail::simd_generate<typename storage::mask_type, storage::size>([&](std::size_t i)
+        {
+            return static_cast<typename storage::mask_element>(op(x.data[i], y.data[i]) ? -1 : 0);
+        }));
+    }
+
+    //
+    // where
+    //
+
+    template <class M, class V>
+    constexpr const_where_expression<M, V>::const_where_expression(const M& inMask, V& inValue) noexcept
+        : mask(inMask),
+          value(inValue)
+    {
+    }
+
+    template <class M, class V>
+    template <class U, Detail::simd_flag Flags>
+    constexpr void const_where_expression<M, V>::copy_to(U* mem, Flags) const&&
+    {
+        for (std::size_t i = 0; i < M::size(); ++i)
+        {
+            if (mask[i])
+            {
+                mem[i] = static_cast<U>(value[i]);
+            }
+        }
+    }
+
+    template <class M, class V>
+    template <class U>
+        requires std::is_convertible_v<U, V>
+    constexpr void where_expression<M, V>::operator=(U&& x) && noexcept
+    {
+        this->value = StdReimpl::select(this->mask, V(std::forward<U>(x)), this->value);
+    }
+
+    template <class M, class V>
+    template <class U>
+        requires std::is_convertible_v<U, V>
+    constexpr void where_expression<M, V>::operator+=(U&& x) && noexcept
+    {
+        this->value = StdReimpl::select(this->mask, this->value + V(std::forward<U>(x)), this->value);
+    }
+
+    template <class M, class V>
+    template <class U>
+        requires std::is_convertible_v<U, V>
+    constexpr void where_expression<M, V>::operator-=(U&& x) && noexcept
+    {
+        this->value = StdReimpl::select(this->mask, this->value - V(std::forward<U>(x)), this->value);
+    }
+
+    template <class M, class V>
+    template <class U>
+        requires std::is_convertible_v<U, V>
+    constexpr void where_expression<M, V>::operator*=(U&& x) && noexcept
+    {
+        this->value = StdReimpl::select(this->mask, this->value * V(std::forward<U>(x)), this->value);
+    }
+
+    template <class M, class V>
+    template <class U>
+        requires std::is_convertible_v<U, V>
+    constexpr void where_expression<M, V>::operator/=(U&& x) && noexcept
+    {
+        // The elements that aren't selected divide by 1, so that a 0 there can't trap.
+        using T = typename V::value_type;
+        this->value = StdReimpl::select(this->mask, this->value / StdReimpl::select(this->mask, V(std::forward<U>(x)), V(T(1))), this->value);
+    }
+
+    template <class M, class V>
+    template <class U, Detail::simd_flag Flags>
+    constexpr void where_expression<M, V>::copy_from(const U* mem, Flags) &&
+    {
+        using T = typename V::value_type;
+        using storage = Detail::simd_storage<T, typename V::abi_type>;
+        const M& selected = this->mask;
+        const V& old = this->value;
+        this->value = Detail::simd_access::make<V>(Detail::simd_generate<typename storage::type, storage::size>([&](std::size_t i)
+        {
+            return selected[i] ? static_cast<T>(mem[i]) : old[i];
+        }));
+    }
+
+    template <class T, class Abi>
+    constexpr where_expression<simd_mask<T, Abi>, simd<T, Abi>> where(const typename simd<T, Abi>::mask_type& mask, simd<T, Abi>& value) noexcept
+    {
+        return where_expression<simd_mask<T, Abi>, simd<T, Abi>>(mask, value);
+    }
+
+    template <class T, class Abi>
+    constexpr const_where_expression<simd_mask<T, Abi>, const simd<T, Abi>> where(const typename simd<T, Abi>::mask_type& mask,
+        const simd<T, Abi>& value) noexcept
+    {
+        return const_where_expression<simd_mask<T, Abi>, const simd<T, Abi>>(mask, value);
+    }
+
+    template <class T, class Abi>
+    constexpr simd<T, Abi> select(const simd_mask<T, Abi>& mask, const simd<T, Abi>& x, const simd<T, Abi>& y) noexcept
+    {
+        using storage = Detail::simd_storage<T, Abi>;
+        const auto& m = Detail::simd_access::data(mask);
+        const auto& a = Detail::simd_access::data(x);
+        const auto& b = Detail::simd_access::data(y);
+
+        if constexpr (storage::is_vector)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                // Lets the compiler see a compare and select as a single min or max instruction, where there is one.
+                return Detail::simd_access::make<simd<T, Abi>>(m ? a : b);
+            }
+        }
+        return Detail::simd_access::make<simd<T, Abi>>(Detail::simd_generate<typename storage::type, storage::size>([&](std::size_t i)
+        {
+            return m[i] ? a[i] : b[i];
+        }));
+    }
+
+    //
+    // Reductions
+    //
+
+    template <class T, class Abi, class BinaryOperation>
+    constexpr T reduce(const simd<T, Abi>& x, BinaryOperation binary_op)
+    {
+        constexpr std::size_t size = simd_size_v<T, Abi>;
+
+        if constexpr (Detail::simd_storage<T, Abi>::is_vector && size % 2 == 0)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                using half = simd<T, simd_abi::fixed_size<static_cast<int>(size / 2)>>;
+
+                half low;
+                half high;
+                const auto* bytes = reinterpret_cast<const unsigned char*>(&Detail::simd_access::data(x));
+                std::memcpy(&Detail::simd_access::data(low), bytes, sizeof(T) * (size / 2));
+                std::memcpy(&Detail::simd_access::data(high), bytes + sizeof(T) * (size / 2), sizeof(T) * (size / 2));
+                return StdReimpl::reduce(half(binary_op(low, high)), binary_op);
+            }
+        }
+
+        simd<T, simd_abi::scalar> result(x[0]);
+        for (std::size_t i = 1; i < size; ++i)
+        {
+            result = binary_op(result, simd<T, simd_abi::scalar>(x[i]));
+        }
+        return result[0];
+    }
+
+    template <class T, class Abi, class BinaryOperation>
+    constexpr T reduce(const simd<T, Abi>& x, const typename simd<T, Abi>::mask_type& mask, BinaryOperation binary_op,
+        std::type_identity_t<T> identity_element)
+    {
+        return StdReimpl::reduce(StdReimpl::select(mask, x, simd<T, Abi>(identity_element)), binary_op);
+    }
+
+    template <class T, class Abi>
+    constexpr T reduce_min(const simd<T, Abi>& x) noexcept
+    {
+        return StdReimpl::reduce(x, [](const auto& a, const auto& b) { return StdReimpl::min(a, b); });
+    }
+
+    template <class T, class Abi>
+    constexpr T reduce_min(const simd<T, Abi>& x, const typename simd<T, Abi>::mask_type& mask) noexcept
+    {
+        return StdReimpl::reduce_min(StdReimpl::select(mask, x, simd<T, Abi>(std::numeric_limits<T>::max())));
+    }
+
+    template <class T, class Abi>
+    constexpr T reduce_max(const simd<T, Abi>& x) noexcept
+    {
+        return StdReimpl::reduce(x, [](const auto& a, const auto& b) { return StdReimpl::max(a, b); });
+    }
+
+    template <class T, class Abi>
+    constexpr T reduce_max(const simd<T, Abi>& x, const typename simd<T, Abi>::mask_type& mask) noexcept
+    {
+        return StdReimpl::reduce_max(StdReimpl::select(mask, x, simd<T, Abi>(std::numeric_limits<T>::lowest())));
+    }
+
+    template <class T, class Abi>
+    constexpr bool all_of(const simd_mask<T, Abi>& mask) noexcept
+    {
+        constexpr std::size_t size = simd_size_v<T, Abi>;
+        constexpr std::uint64_t all = size == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << size) - 1;
+        return Detail::simd_mask_bits(mask) == all;
+    }
+
+    template <class T, class Abi>
+    constexpr bool any_of(const simd_mask<T, Abi>& mask) noexcept
+    {
+        return Detail::simd_mask_bits(mask) != 0;
+    }
+
+    template <class T, class Abi>
+    constexpr bool none_of(const simd_mask<T, Abi>& mask) noexcept
+    {
+        return Detail::simd_mask_bits(mask) == 0;
+    }
+
+    template <class T, class Abi>
+    constexpr int reduce_count(const simd_mask<T, Abi>& mask) noexcept
+    {
+        return StdReimpl::popcount(Detail::simd_mask_bits(mask));
+    }
+
+    template <class T, class Abi>
+    constexpr int reduce_min_index(const simd_mask<T, Abi>& mask)
+    {
+        const std::uint64_t bits = Detail::simd_mask_bits(mask);
+        assert(bits != 0);
+        return StdReimpl::countr_zero(bits);
+    }
+
+    template <class T, class Abi>
+    constexpr int reduce_max_index(const simd_mask<T, Abi>& mask)
+    {
+        const std::uint64_t bits = Detail::simd_mask_bits(mask);
+        assert(bits != 0);
+        return 63 - StdReimpl::countl_zero(bits);
+    }
+
+    //
+    // Math
+    //
+
+    template <class T, class Abi>
+    constexpr simd<T, Abi> min(const simd<T, Abi>& a, const simd<T, Abi>& b) noexcept
+    {
+        return StdReimpl::select(b < a, b, a);
+    }
+
+    template <class T, class Abi>
+    constexpr simd<T, Abi> max(const simd<T, Abi>& a, const simd<T, Abi>& b) noexcept
+    {
+        return StdReimpl::select(a < b, b, a);
+    }
+
+    template <class T, class Abi>
+    constexpr simd<T, Abi> clamp(const simd<T, Abi>& v, const simd<T, Abi>& lo, const simd<T, Abi>& hi)
+    {
+        assert(StdReimpl::none_of(hi < lo));
+        return StdReimpl::select(v < lo, lo, StdReimpl::select(hi < v, hi, v));
+    }
+
+    template <class T, class Abi>
+        requires StdReimpl::signed_integral<T> || StdReimpl::floating_point<T>
+    constexpr simd<T, Abi> abs(const simd<T, Abi>& j)
+    {
+        using storage = Detail::simd_storage<T, Abi>;
+        const auto& data = Detail::simd_access::data(j);
+
+        if constexpr (storage::is_vector)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                if constexpr (StdReimpl::floating_point<T>)
+                {
+                    // Clears the sign bits, which is exact for -0, infinities, and NaNs, as the scalar `abs` is.
+                    using bits_type = typename storage::mask_type;
+                    return Detail::simd_access::make<simd<T, Abi>>(
+                        (typename storage::type)((bits_type)data & std::numeric_limits<typename storage::mask_element>::max()));
+                }
+                else
+                {
+                    return StdReimpl::select(j < simd<T, Abi>(T(0)), -j, j);
+                }
+            }
+        }
+        return Detail::simd_access::make<simd<T, Abi>>(Detail::simd_generate<typename storage::type, storage::size>([&data](std::size_t i)
+        {
+            return static_cast<T>(StdReimpl::abs(data[i]));
+        }));
+    }
+}
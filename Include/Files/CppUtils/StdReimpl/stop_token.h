@@ -0,0 +1,249 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/atomic.h>
+#include <CppUtils/StdReimpl/functional.h>
+
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        struct stop_state;
+
+        /**
+         * @brief The part of a `stop_callback` that the stop state links into its list of callbacks, so that registering
+         *        one allocates nothing.
+         */
+        struct stop_callback_node
+        {
+            using invoke_type = void (*)(stop_callback_node* self) noexcept;
+
+            explicit stop_callback_node(invoke_type inInvoke) noexcept;
+
+            invoke_type invoke;
+
+            // The next older callback. Written before this node is published, and then only with the state locked.
+            stop_callback_node* next = nullptr;
+
+            // The next newer callback, or null at the head of the list. Written by the thread that registers the newer
+            // one, right after it publishes it.
+            std::atomic<stop_callback_node*> prev{nullptr};
+
+            // Set, with the state locked, once `request_stop` has taken the node off the list to run it.
+            bool removed = false;
+
+            // Points into the frame of `request_stop` while the callback runs, so that it can tell if the callback
+            // destroyed its own `stop_callback`.
+            bool* destroyed = nullptr;
+
+            // Set once the callback has returned, for a `stop_callback` destroyed on another thread meanwhile.
+            std::atomic<std::uint32_t> done{0};
+        };
+
+        /**
+         * @brief The state that a `stop_source` and its `stop_token`s and `stop_callback`s share, reference counted by
+         *        them directly rather than through a `shared_ptr` and its separate control block.
+         *
+         *        A single word holds the newest registered callback, a bit for whether stop was requested, and a bit
+         *        that serializes the operations that take callbacks off the list. Registering a callback is a single
+         *        compare-and-swap on it that never waits for that bit.
+         */
+        struct stop_state
+        {
+            static constexpr std::uintptr_t stop_requested_bit = 1;
+            static constexpr std::uintptr_t locked_bit = 2;
+            static constexpr std::uintptr_t pointer_mask = ~(stop_requested_bit | locked_bit);
+
+            bool stop_requested() const noexcept;
+
+            /**
+             * @brief Whether a stop may still be requested, i.e., whether it has been already or a `stop_source` is left.
+             */
+            bool stop_possible() const noexcept;
+
+            bool request_stop() noexcept;
+
+            /**
+             * @brief Adds `node` to the list. Returns false, leaving it out, if stop was already requested, in which case
+             *        the caller runs the callback itself.
+             */
+            bool add_callback(stop_callback_node* node) noexcept;
+
+            /**
+             * @brief Takes `node` off the list, or waits for its callback to return if another thread is running it.
+             */
+            void remove_callback(stop_callback_node* node) noexcept;
+
+            std::uintptr_t lock() noexcept;
+            void unlock() noexcept;
+
+            std::atomic<std::uintptr_t> head{0};
+
+            // The `stop_source`s, `stop_token`s and `stop_callback`s that share this state.
+            std::atomic<std::uint32_t> references{1};
+
+            // The `stop_source`s alone.
+            std::atomic<std::uint32_t> sources{1};
+
+            // The thread running `request_stop`, written before any callback is taken off the list.
+            std::thread::id requester;
+        };
+
+        void stop_state_add_reference(stop_state* state) noexcept;
+        void stop_state_release(stop_state* state) noexcept;
+    }
+
+    /**
+     * @brief The view that a cancellable task has of whether it has been asked to stop.
+     *
+     *        `stop_requested()` is a single load of the shared state, since it is usually polled in a loop.
+     * @see https://eel.is/c++draft/stoptoken
+     * @see https://cppreference.com/w/cpp/thread/stop_token
+     * @note A feature from the C++20 standard.
+     */
+    class stop_token
+    {
+    public:
+        stop_token() noexcept = default;
+        stop_token(const stop_token& rhs) noexcept;
+        stop_token(stop_token&& rhs) noexcept;
+        ~stop_token();
+
+        stop_token& operator=(const stop_token& rhs) noexcept;
+        stop_token& operator=(stop_token&& rhs) noexcept;
+
+        void swap(stop_token& rhs) noexcept;
+
+        [[nodiscard]] bool stop_requested() const noexcept;
+        [[nodiscard]] bool stop_possible() const noexcept;
+
+        [[nodiscard]] friend bool operator==(const stop_token& lhs, const stop_token& rhs) noexcept
+        {
+            return lhs.state == rhs.state;
+        }
+
+        friend void swap(stop_token& lhs, stop_token& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+    private:
+        friend class stop_source;
+
+        template <class Callback>
+        friend class stop_callback;
+
+        explicit stop_token(Detail::stop_state* inState) noexcept;
+
+        Detail::stop_state* state = nullptr;
+    };
+
+    /**
+     * @brief The tag that makes a `stop_source` without a stop state, which costs no allocation.
+     * @see https://eel.is/c++draft/stopsource
+     * @see https://cppreference.com/w/cpp/thread/stop_source/nostopstate_t
+     * @note A feature from the C++20 standard.
+     */
+    struct nostopstate_t
+    {
+        explicit nostopstate_t() = default;
+    };
+
+    inline constexpr nostopstate_t nostopstate{};
+
+    /**
+     * @brief The side of a stop state that asks for a stop.
+     * @see https://eel.is/c++draft/stopsource
+     * @see https://cppreference.com/w/cpp/thread/stop_source
+     * @note A feature from the C++20 standard.
+     */
+    class stop_source
+    {
+    public:
+        stop_source();
+        explicit stop_source(nostopstate_t) noexcept;
+        stop_source(const stop_source& rhs) noexcept;
+        stop_source(stop_source&& rhs) noexcept;
+        ~stop_source();
+
+        stop_source& operator=(const stop_source& rhs) noexcept;
+        stop_source& operator=(stop_source&& rhs) noexcept;
+
+        void swap(stop_source& rhs) noexcept;
+
+        [[nodiscard]] stop_token get_token() const noexcept;
+        [[nodiscard]] bool stop_possible() const noexcept;
+        [[nodiscard]] bool stop_requested() const noexcept;
+        bool request_stop() noexcept;
+
+        [[nodiscard]] friend bool operator==(const stop_source& lhs, const stop_source& rhs) noexcept
+        {
+            return lhs.state == rhs.state;
+        }
+
+        friend void swap(stop_source& lhs, stop_source& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+    private:
+        Detail::stop_state* state;
+    };
+
+    /**
+     * @brief Runs a callback when a stop is requested, or right away if it already was, for as long as it exists.
+     *
+     *        The callback is stored in place and linked into the stop state's list without allocating, and it is run
+     *        through `invoke_r`, so that a `function_ref`, including one bound to a `constant_arg`, can be the callback
+     *        type directly.
+     * @see https://eel.is/c++draft/stopcallback
+     * @see https://cppreference.com/w/cpp/thread/stop_callback
+     * @note A feature from the C++20 standard.
+     */
+    template <class Callback>
+    class stop_callback : private Detail::stop_callback_node
+    {
+        static_assert(std::is_invocable_v<Callback> && std::destructible<Callback>,
+            "stop_callback requires a destructible callback that can be invoked without arguments.");
+
+    public:
+        using callback_type = Callback;
+
+        template <class C>
+            requires std::constructible_from<Callback, C>
+        explicit stop_callback(const stop_token& st, C&& cb) noexcept(std::is_nothrow_constructible_v<Callback, C>);
+
+        template <class C>
+            requires std::constructible_from<Callback, C>
+        explicit stop_callback(stop_token&& st, C&& cb) noexcept(std::is_nothrow_constructible_v<Callback, C>);
+
+        ~stop_callback();
+
+        stop_callback(const stop_callback&) = delete;
+        stop_callback(stop_callback&&) = delete;
+        stop_callback& operator=(const stop_callback&) = delete;
+        stop_callback& operator=(stop_callback&&) = delete;
+
+    private:
+        static void Invoke(Detail::stop_callback_node* self) noexcept;
+
+        void Register() noexcept;
+
+        // Null if the callback isn't registered, i.e., if it already ran or a stop can never be requested.
+        Detail::stop_state* state;
+        CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS Callback callback;
+    };
+
+    template <class Callback>
+    stop_callback(stop_token, Callback) -> stop_callback<Callback>;
+}
+
+#include <CppUtils/StdReimpl/stop_token.inl>
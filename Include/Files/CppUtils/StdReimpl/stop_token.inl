@@ -0,0 +1,425 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/stop_token.h>
+
+#include <utility>
+
+namespace StdReimpl
+{
+    namespace Detail
+    {
+        inline constexpr bool stop_callback_wait_is_native = Detail::atomic_wait_is_native_for_atomic<std::uint32_t>;
+
+        static_assert(alignof(stop_callback_node) > (stop_state::stop_requested_bit | stop_state::locked_bit),
+            "The low bits of a stop_callback_node's address hold the state's flags.");
+
+        inline stop_callback_node* stop_state_pointer(std::uintptr_t word) noexcept
+        {
+            return reinterpret_cast<stop_callback_node*>(word & stop_state::pointer_mask);
+        }
+
+        /**
+         * @brief Waits a little for the thread holding a stop state's lock, which only ever holds it for a few stores.
+         *        Yields rather than spins once it has spun for a while, or right away with a single hardware thread.
+         */
+        inline void stop_state_backoff(int& spins) noexcept
+        {
+            if (spins < 64 && Detail::atomic_wait_can_spin())
+            {
+                ++spins;
+                Detail::atomic_pause();
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        inline stop_callback_node::stop_callback_node(invoke_type inInvoke) noexcept
+            : invoke(inInvoke)
+        {
+        }
+
+        inline bool stop_state::stop_requested() const noexcept
+        {
+            return (head.load(std::memory_order_acquire) & stop_requested_bit) != 0;
+        }
+
+        inline bool stop_state::stop_possible() const noexcept
+        {
+            return stop_requested() || sources.load(std::memory_order_acquire) != 0;
+        }
+
+        inline std::uintptr_t stop_state::lock() noexcept
+        {
+            int spins = 0;
+            std::uintptr_t word = head.load(std::memory_order_relaxed);
+            while (true)
+            {
+                if ((word & locked_bit) == 0)
+                {
+                    if (head.compare_exchange_weak(word, word | locked_bit, std::memory_order_acquire, std::memory_order_relaxed))
+                    {
+                        return word | locked_bit;
+                    }
+                    continue;
+                }
+                Detail::stop_state_backoff(spins);
+                word = head.load(std::memory_order_relaxed);
+            }
+        }
+
+        inline void stop_state::unlock() noexcept
+        {
+            head.fetch_and(~locked_bit, std::memory_order_release);
+        }
+
+        inline bool stop_state::request_stop() noexcept
+        {
+            // Sets the stop bit and takes the lock at once. From then on, no callback is added to the list, so it only
+            // shrinks.
+            int spins = 0;
+            std::uintptr_t word = head.load(std::memory_order_relaxed);
+            while (true)
+            {
+                if ((word & stop_requested_bit) != 0)
+                {
+                    return false;
+                }
+                if ((word & locked_bit) == 0)
+                {
+                    if (head.compare_exchange_weak(word, word | stop_requested_bit | locked_bit, std::memory_order_acq_rel, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                    continue;
+                }
+                Detail::stop_state_backoff(spins);
+                word = head.load(std::memory_order_relaxed);
+            }
+
+            requester = std::this_thread::get_id();
+            while (true)
+            {
+                stop_callback_node* const node = Detail::stop_state_pointer(head.load(std::memory_order_relaxed));
+                if (node == nullptr)
+                {
+                    unlock();
+                    return true;
+                }
+
+                stop_callback_node* const next = node->next;
+                head.store(reinterpret_cast<std::uintptr_t>(next) | stop_requested_bit | locked_bit, std::memory_order_relaxed);
+                if (next != nullptr)
+                {
+                    // The thread that added `node` may not have linked `next` back to it yet, and mustn't write to it
+                    // once it could be gone.
+                    while (next->prev.load(std::memory_order_acquire) != node)
+                    {
+                        Detail::atomic_pause();
+                    }
+                    next->prev.store(nullptr, std::memory_order_relaxed);
+                }
+
+                // The callback runs without the lock, so that it can destroy its own `stop_callback`, or others.
+                bool destroyed = false;
+                node->removed = true;
+                node->destroyed = &destroyed;
+                unlock();
+
+                node->invoke(node);
+
+                if (!destroyed)
+                {
+                    node->destroyed = nullptr;
+                    node->done.store(1, std::memory_order_release);
+                    Detail::atomic_notify<Detail::stop_callback_wait_is_native>(&node->done, true);
+                }
+
+                static_cast<void>(lock());
+            }
+        }
+
+        inline bool stop_state::add_callback(stop_callback_node* node) noexcept
+        {
+            std::uintptr_t word = head.load(std::memory_order_acquire);
+            do
+            {
+                if ((word & stop_requested_bit) != 0)
+                {
+                    return false;
+                }
+                node->next = Detail::stop_state_pointer(word);
+            }
+            while (!head.compare_exchange_weak(word, reinterpret_cast<std::uintptr_t>(node) | (word & locked_bit),
+                std::memory_order_release, std::memory_order_acquire));
+
+            if (node->next != nullptr)
+            {
+                node->next->prev.store(node, std::memory_order_release);
+            }
+            return true;
+        }
+
+        inline void stop_state::remove_callback(stop_callback_node* node) noexcept
+        {
+            std::uintptr_t word = lock();
+
+            if (node->removed)
+            {
+                const bool onRequester = requester == std::this_thread::get_id();
+                unlock();
+
+                if (node->done.load(std::memory_order_acquire) != 0)
+                {
+                    return;
+                }
+                if (onRequester)
+                {
+                    // The callback is destroying its own `stop_callback`, so `request_stop` mustn't touch it afterwards.
+                    *node->destroyed = true;
+                    return;
+                }
+                Detail::atomic_wait<Detail::stop_callback_wait_is_native>(&node->done, std::uint32_t{0},
+                    [node]() { return node->done.load(std::memory_order_acquire); });
+                return;
+            }
+
+            stop_callback_node* const next = node->next;
+            while (true)
+            {
+                stop_callback_node* const prev = node->prev.load(std::memory_order_acquire);
+                if (prev != nullptr)
+                {
+                    prev->next = next;
+                    if (next != nullptr)
+                    {
+                        next->prev.store(prev, std::memory_order_release);
+                    }
+                    break;
+                }
+
+                if (Detail::stop_state_pointer(word) == node)
+                {
+                    if (head.compare_exchange_weak(word, reinterpret_cast<std::uintptr_t>(next) | (word & ~pointer_mask),
+                        std::memory_order_relaxed, std::memory_order_relaxed))
+                    {
+                        if (next != nullptr)
+                        {
+                            // Unless a newer callback has become its `prev` meanwhile.
+                            stop_callback_node* expected = node;
+                            next->prev.compare_exchange_strong(expected, nullptr, std::memory_order_relaxed);
+                        }
+                        break;
+                    }
+                    continue;
+                }
+
+                // A newer callback has been added in front of `node`, and is about to link it back.
+                Detail::atomic_pause();
+                word = head.load(std::memory_order_relaxed);
+            }
+
+            unlock();
+        }
+
+        inline void stop_state_add_reference(stop_state* state) noexcept
+        {
+            state->references.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        inline void stop_state_release(stop_state* state) noexcept
+        {
+            if (state->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                delete state;
+            }
+        }
+    }
+
+    inline stop_token::stop_token(Detail::stop_state* inState) noexcept
+        : state(inState)
+    {
+        if (state != nullptr)
+        {
+            Detail::stop_state_add_reference(state);
+        }
+    }
+
+    inline stop_token::stop_token(const stop_token& rhs) noexcept
+        : stop_token(rhs.state)
+    {
+    }
+
+    inline stop_token::stop_token(stop_token&& rhs) noexcept
+        : state(std::exchange(rhs.state, nullptr))
+    {
+    }
+
+    inline stop_token::~stop_token()
+    {
+        if (state != nullptr)
+        {
+            Detail::stop_state_release(state);
+        }
+    }
+
+    inline stop_token& stop_token::operator=(const stop_token& rhs) noexcept
+    {
+        stop_token(rhs).swap(*this);
+        return *this;
+    }
+
+    inline stop_token& stop_token::operator=(stop_token&& rhs) noexcept
+    {
+        stop_token(std::move(rhs)).swap(*this);
+        return *this;
+    }
+
+    inline void stop_token::swap(stop_token& rhs) noexcept
+    {
+        std::swap(state, rhs.state);
+    }
+
+    inline bool stop_token::stop_requested() const noexcept
+    {
+        return state != nullptr && state->stop_requested();
+    }
+
+    inline bool stop_token::stop_possible() const noexcept
+    {
+        return state != nullptr && state->stop_possible();
+    }
+
+    inline stop_source::stop_source()
+        : state(new Detail::stop_state())
+    {
+    }
+
+    inline stop_source::stop_source(nostopstate_t) noexcept
+        : state(nullptr)
+    {
+    }
+
+    inline stop_source::stop_source(const stop_source& rhs) noexcept
+        : state(rhs.state)
+    {
+        if (state != nullptr)
+        {
+            state->sources.fetch_add(1, std::memory_order_relaxed);
+            Detail::stop_state_add_reference(state);
+        }
+    }
+
+    inline stop_source::stop_source(stop_source&& rhs) noexcept
+        : state(std::exchange(rhs.state, nullptr))
+    {
+    }
+
+    inline stop_source::~stop_source()
+    {
+        if (state != nullptr)
+        {
+            state->sources.fetch_sub(1, std::memory_order_release);
+            Detail::stop_state_release(state);
+        }
+    }
+
+    inline stop_source& stop_source::operator=(const stop_source& rhs) noexcept
+    {
+        stop_source(rhs).swap(*this);
+        return *this;
+    }
+
+    inline stop_source& stop_source::operator=(stop_source&& rhs) noexcept
+    {
+        stop_source(std::move(rhs)).swap(*this);
+        return *this;
+    }
+
+    inline void stop_source::swap(stop_source& rhs) noexcept
+    {
+        std::swap(state, rhs.state);
+    }
+
+    inline stop_token stop_source::get_token() const noexcept
+    {
+        return stop_token(state);
+    }
+
+    inline bool stop_source::stop_possible() const noexcept
+    {
+        return state != nullptr;
+    }
+
+    inline bool stop_source::stop_requested() const noexcept
+    {
+        return state != nullptr && state->stop_requested();
+    }
+
+    inline bool stop_source::request_stop() noexcept
+    {
+        return state != nullptr && state->request_stop();
+    }
+
+    template <class Callback>
+    template <class C>
+        requires std::constructible_from<Callback, C>
+    stop_callback<Callback>::stop_callback(const stop_token& st, C&& cb) noexcept(std::is_nothrow_constructible_v<Callback, C>)
+        : Detail::stop_callback_node(&Invoke), state(st.state), callback(std::forward<C>(cb))
+    {
+        if (state != nullptr)
+        {
+            Detail::stop_state_add_reference(state);
+        }
+        Register();
+    }
+
+    template <class Callback>
+    template <class C>
+        requires std::constructible_from<Callback, C>
+    stop_callback<Callback>::stop_callback(stop_token&& st, C&& cb) noexcept(std::is_nothrow_constructible_v<Callback, C>)
+        : Detail::stop_callback_node(&Invoke), state(std::exchange(st.state, nullptr)), callback(std::forward<C>(cb))
+    {
+        Register();
+    }
+
+    template <class Callback>
+    stop_callback<Callback>::~stop_callback()
+    {
+        if (state != nullptr)
+        {
+            state->remove_callback(this);
+            Detail::stop_state_release(state);
+        }
+    }
+
+    template <class Callback>
+    void stop_callback<Callback>::Invoke(Detail::stop_callback_node* self) noexcept
+    {
+        StdReimpl::invoke_r<void>(std::move(static_cast<stop_callback*>(self)->callback));
+    }
+
+    template <class Callback>
+    void stop_callback<Callback>::Register() noexcept
+    {
+        if (state == nullptr)
+        {
+            return;
+        }
+
+        if (!state->stop_possible())
+        {
+            Detail::stop_state_release(std::exchange(state, nullptr));
+            return;
+        }
+
+        if (!state->add_callback(this))
+        {
+            Detail::stop_state_release(std::exchange(state, nullptr));
+            StdReimpl::invoke_r<void>(std::move(callback));
+        }
+    }
+}
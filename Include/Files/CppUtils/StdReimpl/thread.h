@@ -0,0 +1,71 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils_StdReimpl_Export.h>
+#include <CppUtils/StdReimpl/stop_token.h>
+
+#include <thread>
+#include <type_traits>
+
+namespace StdReimpl
+{
+    /**
+     * @brief A thread that is asked to stop and joined when it is destroyed, rather than terminating the program.
+     *
+     *        The function is passed a `stop_token` first if it takes one.
+     * @see https://eel.is/c++draft/thread.jthread.class
+     * @see https://cppreference.com/w/cpp/thread/jthread
+     * @note A feature from the C++20 standard.
+     */
+    class jthread
+    {
+    public:
+        using id = std::thread::id;
+        using native_handle_type = std::thread::native_handle_type;
+
+        jthread() noexcept;
+
+        template <class F, class... Args>
+            requires (!std::is_same_v<std::remove_cvref_t<F>, jthread>)
+        explicit jthread(F&& f, Args&&... args);
+
+        ~jthread();
+
+        jthread(const jthread&) = delete;
+        jthread(jthread&& x) noexcept;
+        jthread& operator=(const jthread&) = delete;
+        jthread& operator=(jthread&& x) noexcept;
+
+        void swap(jthread& x) noexcept;
+
+        [[nodiscard]] bool joinable() const noexcept;
+        void join();
+        void detach();
+
+        [[nodiscard]] id get_id() const noexcept;
+        [[nodiscard]] native_handle_type native_handle();
+
+        [[nodiscard]] stop_source get_stop_source() noexcept;
+        [[nodiscard]] stop_token get_stop_token() const noexcept;
+        bool request_stop() noexcept;
+
+        friend void swap(jthread& lhs, jthread& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+        [[nodiscard]] static unsigned int hardware_concurrency() noexcept;
+
+    private:
+        /**
+         * @brief Asks the thread to stop and waits for it, if there is one.
+         */
+        void StopAndJoin();
+
+        stop_source ssource;
+        std::thread thread;
+    };
+}
+
+#include <CppUtils/StdReimpl/thread.inl>
@@ -0,0 +1,111 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/StdReimpl/thread.h>
+
+#include <utility>
+
+namespace StdReimpl
+{
+    inline jthread::jthread() noexcept
+        : ssource(nostopstate)
+    {
+    }
+
+    template <class F, class... Args>
+        requires (!std::is_same_v<std::remove_cvref_t<F>, jthread>)
+    jthread::jthread(F&& f, Args&&... args)
+    {
+        // `std::thread` decays and copies the function and its arguments, and invokes them on the new thread.
+        if constexpr (std::is_invocable_v<std::decay_t<F>, stop_token, std::decay_t<Args>...>)
+        {
+            thread = std::thread(std::forward<F>(f), ssource.get_token(), std::forward<Args>(args)...);
+        }
+        else
+        {
+            thread = std::thread(std::forward<F>(f), std::forward<Args>(args)...);
+        }
+    }
+
+    inline jthread::~jthread()
+    {
+        StopAndJoin();
+    }
+
+    inline jthread::jthread(jthread&& x) noexcept
+        : ssource(std::move(x.ssource)), thread(std::move(x.thread))
+    {
+    }
+
+    inline jthread& jthread::operator=(jthread&& x) noexcept
+    {
+        if (this != &x)
+        {
+            StopAndJoin();
+            ssource = std::move(x.ssource);
+            thread = std::move(x.thread);
+        }
+        return *this;
+    }
+
+    inline void jthread::swap(jthread& x) noexcept
+    {
+        ssource.swap(x.ssource);
+        thread.swap(x.thread);
+    }
+
+    inline bool jthread::joinable() const noexcept
+    {
+        return thread.joinable();
+    }
+
+    inline void jthread::join()
+    {
+        thread.join();
+    }
+
+    inline void jthread::detach()
+    {
+        thread.detach();
+    }
+
+    inline jthread::id jthread::get_id() const noexcept
+    {
+        return thread.get_id();
+    }
+
+    inline jthread::native_handle_type jthread::native_handle()
+    {
+        return thread.native_handle();
+    }
+
+    inline stop_source jthread::get_stop_source() noexcept
+    {
+        return ssource;
+    }
+
+    inline stop_token jthread::get_stop_token() const noexcept
+    {
+        return ssource.get_token();
+    }
+
+    inline bool jthread::request_stop() noexcept
+    {
+        return ssource.request_stop();
+    }
+
+    inline unsigned int jthread::hardware_concurrency() noexcept
+    {
+        return std::thread::hardware_concurrency();
+    }
+
+    inline void jthread::StopAndJoin()
+    {
+        if (thread.joinable())
+        {
+            ssource.request_stop();
+            thread.join();
+        }
+    }
+}
@@ -2,6 +2,9 @@
 
 #pragma once
 
+#include <compare>
+#include <concepts>
+#include <ranges>
 #include <type_traits>
 
 namespace StdReimpl
@@ -35,6 +38,56 @@ namespace StdReimpl
      */
     template <auto V>
     constexpr constant_arg_t<V> constant_arg{};
+
+    namespace Detail
+    {
+        /**
+         * @brief Whether `T` is a specialization of `StdReimpl::constant_arg_t`. Used by constraints in the standard that
+         *        exclude `constant_arg_t` arguments, e.g., the deleted assignment operator of `function_ref`.
+         */
+        template <class T>
+        inline constexpr bool is_constant_arg_t_v = false;
+
+        template <auto V>
+        inline constexpr bool is_constant_arg_t_v<StdReimpl::constant_arg_t<V>> = true;
+
+        /**
+         * @see https://eel.is/c++draft/container.reqmts#concept:container-compatible-range
+         */
+        template <class R, class T>
+        concept container_compatible_range =
+            std::ranges::input_range<R> && std::convertible_to<std::ranges::range_reference_t<R>, T>;
+
+        /**
+         * @see https://eel.is/c++draft/expos.only.entity#lib:synth-three-way
+         */
+        struct synth_three_way_fn
+        {
+            template <class T, class U>
+            constexpr auto operator()(const T& t, const U& u) const
+                requires requires { { t < u } -> std::convertible_to<bool>; { u < t } -> std::convertible_to<bool>; }
+            {
+                if constexpr (std::three_way_comparable_with<T, U>)
+                {
+                    return t <=> u;
+                }
+                else
+                {
+                    if (t < u)
+                    {
+                        return std::weak_ordering::less;
+                    }
+                    if (u < t)
+                    {
+                        return std::weak_ordering::greater;
+                    }
+                    return std::weak_ordering::equivalent;
+                }
+            }
+        };
+
+        inline constexpr synth_three_way_fn synth_three_way{};
+    }
 }
 
 #include <CppUtils/StdReimpl/utility.inl>
@@ -36,4 +36,15 @@
 #   undef CPPUTILS_STDREIMPL_NO_DEPRECATED
 #endif
 
+// Attributes that the headers use, spelled for each compiler.
+
+// `[[no_unique_address]]`, spelled so that MSVC honors it too.
+#ifndef CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS
+#   if defined(_MSC_VER) && !defined(__clang__)
+#       define CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#   else
+#       define CPPUTILS_STDREIMPL_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#   endif
+#endif
+
 #endif // #ifndef CPPUTILS_STDREIMPL_EXPORT_H
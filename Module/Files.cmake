@@ -0,0 +1,7 @@
+# Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+# Set this variable for the person including us to use.
+set(FILES_CMAKE_RESULT
+  # List out all our module interface units.
+  "${CMAKE_CURRENT_SOURCE_DIR}/Files/${MY_BASE_PROJECT_NAME_NAMESPACE}/${MY_BASE_PROJECT_NAME_LEAFNAME}.cppm"
+  )
@@ -0,0 +1,362 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+//
+// The `CppUtils.StdReimpl` module, which exports the whole public API of our headers.
+//
+// The headers are included in the global module fragment and their public names are exported with using-declarations,
+// the way the standard library's own `std` module is put together. So the declarations are the same entities whether
+// a translation unit includes the headers or imports the module, and the two can be mixed in one program. What isn't
+// exported is the `Detail` namespace and the macros. The configuration macros, like
+// `CPPUTILS_STDREIMPL_MOVE_ONLY_FUNCTION_INLINE_CAPACITY`, take effect when they're defined for the module's own build.
+//
+// When adding a public name to a header, export it here too. Names found only through ADL, like the operators of
+// `chars_format`, must be exported as well, since an importer can't see anything of the global module fragment that
+// isn't.
+//
+
+module;
+
+#include <CppUtils/StdReimpl/algorithm.h>
+#include <CppUtils/StdReimpl/atomic.h>
+#include <CppUtils/StdReimpl/barrier.h>
+#include <CppUtils/StdReimpl/bit.h>
+#include <CppUtils/StdReimpl/charconv.h>
+#include <CppUtils/StdReimpl/cmath.h>
+#include <CppUtils/StdReimpl/concepts.h>
+#include <CppUtils/StdReimpl/cstdlib.h>
+#include <CppUtils/StdReimpl/execution.h>
+#include <CppUtils/StdReimpl/expected.h>
+#include <CppUtils/StdReimpl/flat_map.h>
+#include <CppUtils/StdReimpl/flat_set.h>
+#include <CppUtils/StdReimpl/flat_tree.h>
+#include <CppUtils/StdReimpl/format.h>
+#include <CppUtils/StdReimpl/functional.h>
+#include <CppUtils/StdReimpl/generator.h>
+#include <CppUtils/StdReimpl/hive.h>
+#include <CppUtils/StdReimpl/inplace_vector.h>
+#include <CppUtils/StdReimpl/latch.h>
+#include <CppUtils/StdReimpl/mdspan.h>
+#include <CppUtils/StdReimpl/memory_resource.h>
+#include <CppUtils/StdReimpl/numeric.h>
+#include <CppUtils/StdReimpl/semaphore.h>
+#include <CppUtils/StdReimpl/simd.h>
+#include <CppUtils/StdReimpl/stop_token.h>
+#include <CppUtils/StdReimpl/thread.h>
+#include <CppUtils/StdReimpl/utility.h>
+
+export module CppUtils.StdReimpl;
+
+export namespace StdReimpl
+{
+    // algorithm.h
+    using StdReimpl::copy_if;
+    using StdReimpl::for_each;
+    using StdReimpl::sort;
+    using StdReimpl::transform;
+
+    // atomic.h
+    using StdReimpl::atomic_notify_all;
+    using StdReimpl::atomic_notify_one;
+    using StdReimpl::atomic_ref;
+    using StdReimpl::atomic_wait;
+    using StdReimpl::atomic_wait_explicit;
+
+    // barrier.h
+    using StdReimpl::barrier;
+
+    // bit.h
+    using StdReimpl::bit_cast;
+    using StdReimpl::bit_ceil;
+    using StdReimpl::bit_floor;
+    using StdReimpl::bit_width;
+    using StdReimpl::byteswap;
+    using StdReimpl::countl_one;
+    using StdReimpl::countl_zero;
+    using StdReimpl::countr_one;
+    using StdReimpl::countr_zero;
+    using StdReimpl::endian;
+    using StdReimpl::has_single_bit;
+    using StdReimpl::popcount;
+    using StdReimpl::rotl;
+    using StdReimpl::rotr;
+
+    // charconv.h
+    using StdReimpl::chars_format;
+    using StdReimpl::from_chars;
+    using StdReimpl::from_chars_result;
+    using StdReimpl::to_chars;
+    using StdReimpl::to_chars_result;
+    using StdReimpl::operator|;
+    using StdReimpl::operator&;
+    using StdReimpl::operator^;
+    using StdReimpl::operator~;
+    using StdReimpl::operator|=;
+    using StdReimpl::operator&=;
+    using StdReimpl::operator^=;
+
+    // cmath.h
+    using StdReimpl::copysign;
+    using StdReimpl::fabs;
+    using StdReimpl::fpclassify;
+    using StdReimpl::signbit;
+
+    // concepts.h
+    using StdReimpl::derived_from;
+    using StdReimpl::floating_point;
+    using StdReimpl::integral;
+    using StdReimpl::invocable;
+    using StdReimpl::regular_invocable;
+    using StdReimpl::same_as;
+    using StdReimpl::signed_integral;
+    using StdReimpl::unsigned_integral;
+
+    // cstdlib.h
+    using StdReimpl::abs;
+
+    // execution.h
+    using StdReimpl::is_execution_policy;
+    using StdReimpl::is_execution_policy_v;
+
+    namespace execution
+    {
+        using StdReimpl::execution::bulk;
+        using StdReimpl::execution::bulk_t;
+        using StdReimpl::execution::completion_signatures;
+        using StdReimpl::execution::completion_signatures_of_t;
+        using StdReimpl::execution::connect;
+        using StdReimpl::execution::connect_result_t;
+        using StdReimpl::execution::connect_t;
+        using StdReimpl::execution::continues_on;
+        using StdReimpl::execution::continues_on_t;
+        using StdReimpl::execution::empty_env;
+        using StdReimpl::execution::env_of_t;
+        using StdReimpl::execution::error_types_of_t;
+        using StdReimpl::execution::get_completion_scheduler;
+        using StdReimpl::execution::get_completion_scheduler_t;
+        using StdReimpl::execution::get_env;
+        using StdReimpl::execution::get_env_t;
+        using StdReimpl::execution::just;
+        using StdReimpl::execution::just_t;
+        using StdReimpl::execution::let_value;
+        using StdReimpl::execution::let_value_t;
+        using StdReimpl::execution::operation_state;
+        using StdReimpl::execution::operation_state_t;
+        using StdReimpl::execution::par;
+        using StdReimpl::execution::par_unseq;
+        using StdReimpl::execution::parallel_policy;
+        using StdReimpl::execution::parallel_unsequenced_policy;
+        using StdReimpl::execution::receiver;
+        using StdReimpl::execution::receiver_t;
+        using StdReimpl::execution::schedule;
+        using StdReimpl::execution::schedule_result_t;
+        using StdReimpl::execution::schedule_t;
+        using StdReimpl::execution::scheduler;
+        using StdReimpl::execution::scheduler_t;
+        using StdReimpl::execution::sender;
+        using StdReimpl::execution::sender_t;
+        using StdReimpl::execution::sender_to;
+        using StdReimpl::execution::sends_stopped;
+        using StdReimpl::execution::seq;
+        using StdReimpl::execution::sequenced_policy;
+        using StdReimpl::execution::set_error;
+        using StdReimpl::execution::set_error_t;
+        using StdReimpl::execution::set_stopped;
+        using StdReimpl::execution::set_stopped_t;
+        using StdReimpl::execution::set_value;
+        using StdReimpl::execution::set_value_t;
+        using StdReimpl::execution::start;
+        using StdReimpl::execution::start_t;
+        using StdReimpl::execution::starts_on;
+        using StdReimpl::execution::starts_on_t;
+        using StdReimpl::execution::static_thread_pool;
+        using StdReimpl::execution::then;
+        using StdReimpl::execution::then_t;
+        using StdReimpl::execution::unseq;
+        using StdReimpl::execution::unsequenced_policy;
+        using StdReimpl::execution::value_types_of_t;
+        using StdReimpl::execution::when_all;
+        using StdReimpl::execution::when_all_t;
+    }
+
+    namespace this_thread
+    {
+        using StdReimpl::this_thread::sync_wait;
+        using StdReimpl::this_thread::sync_wait_t;
+    }
+
+    // expected.h
+    using StdReimpl::bad_expected_access;
+    using StdReimpl::expected;
+    using StdReimpl::expected_niche;
+    using StdReimpl::unexpect;
+    using StdReimpl::unexpect_t;
+    using StdReimpl::unexpected;
+
+    // flat_map.h, flat_set.h and flat_tree.h
+    using StdReimpl::erase_if;
+    using StdReimpl::flat_map;
+    using StdReimpl::flat_multimap;
+    using StdReimpl::flat_multiset;
+    using StdReimpl::flat_search_mode;
+    using StdReimpl::flat_set;
+    using StdReimpl::sorted_equivalent;
+    using StdReimpl::sorted_equivalent_t;
+    using StdReimpl::sorted_unique;
+    using StdReimpl::sorted_unique_t;
+
+    // format.h
+    using StdReimpl::basic_format_arg;
+    using StdReimpl::basic_format_args;
+    using StdReimpl::basic_format_context;
+    using StdReimpl::basic_format_parse_context;
+    using StdReimpl::basic_format_string;
+    using StdReimpl::format;
+    using StdReimpl::format_args;
+    using StdReimpl::format_context;
+    using StdReimpl::format_error;
+    using StdReimpl::format_parse_context;
+    using StdReimpl::format_string;
+    using StdReimpl::format_to;
+    using StdReimpl::format_to_n;
+    using StdReimpl::format_to_n_result;
+    using StdReimpl::formattable;
+    using StdReimpl::formatted_size;
+    using StdReimpl::formatter;
+    using StdReimpl::make_format_args;
+    using StdReimpl::print;
+    using StdReimpl::println;
+    using StdReimpl::runtime_format;
+    using StdReimpl::vformat;
+    using StdReimpl::vformat_to;
+    using StdReimpl::vprint_nonunicode;
+    using StdReimpl::vprint_unicode;
+
+    // functional.h
+    using StdReimpl::bind_back;
+    using StdReimpl::bind_front;
+    using StdReimpl::boyer_moore_horspool_searcher;
+    using StdReimpl::boyer_moore_searcher;
+    using StdReimpl::default_searcher;
+    using StdReimpl::function_ref;
+    using StdReimpl::inplace_function;
+    using StdReimpl::invoke_r;
+    using StdReimpl::move_only_function;
+    using StdReimpl::not_fn;
+
+    // generator.h
+    using StdReimpl::generator;
+
+    namespace ranges
+    {
+        using StdReimpl::ranges::elements_of;
+    }
+
+    // hive.h
+    using StdReimpl::hive;
+    using StdReimpl::hive_limits;
+
+    // inplace_vector.h
+    using StdReimpl::erase;
+    using StdReimpl::inplace_vector;
+
+    // latch.h
+    using StdReimpl::latch;
+
+    // mdspan.h
+    using StdReimpl::aligned_accessor;
+    using StdReimpl::default_accessor;
+    using StdReimpl::dextents;
+    using StdReimpl::dims;
+    using StdReimpl::extents;
+    using StdReimpl::is_sufficiently_aligned;
+    using StdReimpl::layout_left;
+    using StdReimpl::layout_right;
+    using StdReimpl::layout_stride;
+    using StdReimpl::mdspan;
+
+    // memory_resource.h
+    namespace pmr
+    {
+        using StdReimpl::pmr::get_default_resource;
+        using StdReimpl::pmr::memory_resource;
+        using StdReimpl::pmr::monotonic_buffer_resource;
+        using StdReimpl::pmr::new_delete_resource;
+        using StdReimpl::pmr::null_memory_resource;
+        using StdReimpl::pmr::polymorphic_allocator;
+        using StdReimpl::pmr::pool_options;
+        using StdReimpl::pmr::set_default_resource;
+        using StdReimpl::pmr::synchronized_pool_resource;
+        using StdReimpl::pmr::unsynchronized_pool_resource;
+        using StdReimpl::pmr::operator==;
+    }
+
+    // numeric.h
+    using StdReimpl::inclusive_scan;
+    using StdReimpl::reduce;
+    using StdReimpl::transform_reduce;
+
+    // semaphore.h
+    using StdReimpl::binary_semaphore;
+    using StdReimpl::counting_semaphore;
+
+    // simd.h
+    namespace simd_abi
+    {
+        using StdReimpl::simd_abi::compatible;
+        using StdReimpl::simd_abi::fixed_size;
+        using StdReimpl::simd_abi::max_fixed_size;
+        using StdReimpl::simd_abi::native;
+        using StdReimpl::simd_abi::scalar;
+    }
+
+    using StdReimpl::all_of;
+    using StdReimpl::any_of;
+    using StdReimpl::clamp;
+    using StdReimpl::const_where_expression;
+    using StdReimpl::element_aligned;
+    using StdReimpl::element_aligned_tag;
+    using StdReimpl::fixed_size_simd;
+    using StdReimpl::fixed_size_simd_mask;
+    using StdReimpl::is_simd;
+    using StdReimpl::is_simd_mask;
+    using StdReimpl::is_simd_mask_v;
+    using StdReimpl::is_simd_v;
+    using StdReimpl::max;
+    using StdReimpl::memory_alignment;
+    using StdReimpl::memory_alignment_v;
+    using StdReimpl::min;
+    using StdReimpl::native_simd;
+    using StdReimpl::native_simd_mask;
+    using StdReimpl::none_of;
+    using StdReimpl::overaligned;
+    using StdReimpl::overaligned_tag;
+    using StdReimpl::reduce_count;
+    using StdReimpl::reduce_max;
+    using StdReimpl::reduce_max_index;
+    using StdReimpl::reduce_min;
+    using StdReimpl::reduce_min_index;
+    using StdReimpl::select;
+    using StdReimpl::simd;
+    using StdReimpl::simd_mask;
+    using StdReimpl::simd_size;
+    using StdReimpl::simd_size_v;
+    using StdReimpl::vector_aligned;
+    using StdReimpl::vector_aligned_tag;
+    using StdReimpl::where;
+    using StdReimpl::where_expression;
+
+    // stop_token.h
+    using StdReimpl::nostopstate;
+    using StdReimpl::nostopstate_t;
+    using StdReimpl::stop_callback;
+    using StdReimpl::stop_source;
+    using StdReimpl::stop_token;
+
+    // thread.h
+    using StdReimpl::jthread;
+
+    // utility.h
+    using StdReimpl::constant_arg;
+    using StdReimpl::constant_arg_t;
+    using StdReimpl::to_underlying;
+}
@@ -9,4 +9,26 @@ set(FILES_CMAKE_RESULT
   "functional.cpp"
   "utility.cpp"
   "cstdlib.cpp"
+  "cmath.cpp"
+  "inplace_vector.cpp"
+  "flat_tree.cpp"
+  "flat_map.cpp"
+  "flat_set.cpp"
+  "expected.cpp"
+  "mdspan.cpp"
+  "generator.cpp"
+  "memory_resource.cpp"
+  "atomic.cpp"
+  "latch.cpp"
+  "barrier.cpp"
+  "semaphore.cpp"
+  "stop_token.cpp"
+  "thread.cpp"
+  "execution.cpp"
+  "algorithm.cpp"
+  "numeric.cpp"
+  "simd.cpp"
+  "bit.cpp"
+  "charconv.cpp"
+  "format.cpp"
   )
@@ -0,0 +1,4 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/barrier.h>
+#include <CppUtils/StdReimpl/barrier.inl>
@@ -0,0 +1,214 @@
+# Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#
+# Measures what our templates cost to instantiate, and fails when that's more than the recorded baseline for the
+# compiler. Run by CTest in script mode, with these variables defined:
+#   BINARY_DIR         The binary directory the compile-cost targets were configured in.
+#   SOURCE_FILE        The source file both targets build, which is touched so that they rebuild.
+#   TARGET             The target building the source with `SIGNATURES` signatures.
+#   REFERENCE_TARGET   The target building the source with none, which only pays for the includes.
+#   SIGNATURES         The number of signatures `TARGET` instantiates.
+#   COMPILER_ID        `CMAKE_CXX_COMPILER_ID`, either "GNU" or "Clang".
+#   COMPILER_VERSION   `CMAKE_CXX_COMPILER_VERSION`.
+#   BASELINES_FILE     The JSON file of baselines, keyed by compiler id and major version.
+#   UPDATE_BASELINES   If true, records the measurements as the compiler's baseline instead of checking them.
+#
+# GCC reports its time and memory with `-ftime-report`. Clang writes its time to a JSON file next to the object file
+# with `-ftime-trace`, but doesn't report memory, so only time is checked with Clang.
+#
+# The measurements are made independent of how many signatures there are and how fast the machine is:
+#   instantiation_time_percent  The time spent instantiating templates per 100 signatures, in percent of the time it
+#                               takes to compile the reference, i.e., to just include our headers.
+#   memory_kb                   The memory the compiler allocates per 100 signatures.
+#
+
+foreach(MyVariable IN ITEMS BINARY_DIR SOURCE_FILE TARGET REFERENCE_TARGET SIGNATURES COMPILER_ID COMPILER_VERSION BASELINES_FILE)
+  if(NOT DEFINED ${MyVariable})
+    message(FATAL_ERROR "The compile-cost test needs the variable `${MyVariable}` defined.")
+  endif()
+endforeach()
+
+# Time varies with whatever else the machine is doing, whereas memory only changes when the code does.
+set(MyTimeTolerancePercent 25)
+set(MyMemoryTolerancePercent 5)
+
+#
+# Converts a number of seconds with two decimals, as GCC reports them, to centiseconds, since `math` only does
+# integers.
+#
+function(my_seconds_to_centiseconds SECONDS OUT_CENTISECONDS)
+  string(REGEX MATCH "^([0-9]+)\\.([0-9][0-9])$" MyMatch "${SECONDS}")
+  if(NOT MyMatch)
+    message(FATAL_ERROR "Couldn't read \"${SECONDS}\" as seconds.")
+  endif()
+  math(EXPR MyCentiseconds "${CMAKE_MATCH_1} * 100 + ${CMAKE_MATCH_2}")
+  set(${OUT_CENTISECONDS} ${MyCentiseconds} PARENT_SCOPE)
+endfunction()
+
+#
+# Converts an amount of memory as GCC reports it, e.g. "640M", to kilobytes.
+#
+function(my_memory_to_kilobytes MEMORY OUT_KILOBYTES)
+  string(REGEX MATCH "^([0-9]+)([kMG]?)$" MyMatch "${MEMORY}")
+  if(NOT MyMatch)
+    message(FATAL_ERROR "Couldn't read \"${MEMORY}\" as an amount of memory.")
+  endif()
+  if(CMAKE_MATCH_2 STREQUAL "G")
+    math(EXPR MyKilobytes "${CMAKE_MATCH_1} * 1024 * 1024")
+  elseif(CMAKE_MATCH_2 STREQUAL "M")
+    math(EXPR MyKilobytes "${CMAKE_MATCH_1} * 1024")
+  elseif(CMAKE_MATCH_2 STREQUAL "k")
+    set(MyKilobytes ${CMAKE_MATCH_1})
+  else()
+    math(EXPR MyKilobytes "${CMAKE_MATCH_1} / 1024")
+  endif()
+  set(${OUT_KILOBYTES} ${MyKilobytes} PARENT_SCOPE)
+endfunction()
+
+#
+# Rebuilds the target, and sets `<OUT_PREFIX>_TOTAL_US` and `<OUT_PREFIX>_INSTANTIATION_US` to the time it took to
+# compile and the part of it spent instantiating templates, in microseconds. With GCC, also sets
+# `<OUT_PREFIX>_MEMORY_KB` to the memory the compiler allocated.
+#
+function(my_measure_target TARGET_NAME OUT_PREFIX)
+  set(MyObjectDir "${BINARY_DIR}/CMakeFiles/${TARGET_NAME}.dir")
+  if(COMPILER_ID STREQUAL "Clang")
+    file(GLOB_RECURSE MyOldTraces "${MyObjectDir}/*.json")
+    if(MyOldTraces)
+      file(REMOVE ${MyOldTraces})
+    endif()
+  endif()
+
+  file(TOUCH "${SOURCE_FILE}")
+  execute_process(
+    COMMAND ${CMAKE_COMMAND} --build "${BINARY_DIR}" --target ${TARGET_NAME}
+    RESULT_VARIABLE MyResult
+    OUTPUT_VARIABLE MyOutput
+    ERROR_VARIABLE MyOutput
+    )
+  if(NOT MyResult EQUAL 0)
+    message(FATAL_ERROR "Building `${TARGET_NAME}` failed:\n${MyOutput}")
+  endif()
+
+  if(COMPILER_ID STREQUAL "GNU")
+    # The columns are user, system and wall time, then memory. User time is the least affected by other processes.
+    string(REGEX MATCH " TOTAL +: +([0-9.]+) +[0-9.]+ +[0-9.]+ +([0-9]+[kMG]?)" MyMatch "${MyOutput}")
+    if(NOT MyMatch)
+      message(FATAL_ERROR "Couldn't find GCC's time report in the output of building `${TARGET_NAME}`:\n${MyOutput}")
+    endif()
+    my_seconds_to_centiseconds(${CMAKE_MATCH_1} MyTotal)
+    my_memory_to_kilobytes(${CMAKE_MATCH_2} MyMemory)
+
+    string(REGEX MATCH " template instantiation +: +([0-9.]+)" MyMatch "${MyOutput}")
+    if(MyMatch)
+      my_seconds_to_centiseconds(${CMAKE_MATCH_1} MyInstantiation)
+    else()
+      set(MyInstantiation 0)
+    endif()
+
+    math(EXPR MyTotal "${MyTotal} * 10000")
+    math(EXPR MyInstantiation "${MyInstantiation} * 10000")
+    set(${OUT_PREFIX}_MEMORY_KB ${MyMemory} PARENT_SCOPE)
+  elseif(COMPILER_ID STREQUAL "Clang")
+    file(GLOB_RECURSE MyTraces "${MyObjectDir}/*.json")
+    if(NOT MyTraces)
+      message(FATAL_ERROR "Couldn't find Clang's time trace under \"${MyObjectDir}\".")
+    endif()
+    list(GET MyTraces 0 MyTrace)
+    file(READ "${MyTrace}" MyTraceContents)
+
+    # The totals are events of their own, each an object without nested objects but its arguments.
+    set(MyInstantiation 0)
+    foreach(MyEvent IN ITEMS "Total InstantiateClass" "Total InstantiateFunction" "Total ExecuteCompiler")
+      string(REGEX MATCH "\"dur\":([0-9]+),\"name\":\"${MyEvent}\"" MyMatch "${MyTraceContents}")
+      if(NOT MyMatch)
+        string(REGEX MATCH "\"name\":\"${MyEvent}\"[^}]*\"dur\":([0-9]+)" MyMatch "${MyTraceContents}")
+      endif()
+      if(NOT MyMatch)
+        set(CMAKE_MATCH_1 0)
+      endif()
+      if(MyEvent STREQUAL "Total ExecuteCompiler")
+        set(MyTotal ${CMAKE_MATCH_1})
+      else()
+        math(EXPR MyInstantiation "${MyInstantiation} + ${CMAKE_MATCH_1}")
+      endif()
+    endforeach()
+  else()
+    message(FATAL_ERROR "The compile-cost test doesn't support the compiler \"${COMPILER_ID}\".")
+  endif()
+
+  set(${OUT_PREFIX}_TOTAL_US ${MyTotal} PARENT_SCOPE)
+  set(${OUT_PREFIX}_INSTANTIATION_US ${MyInstantiation} PARENT_SCOPE)
+endfunction()
+
+my_measure_target(${REFERENCE_TARGET} MyReference)
+my_measure_target(${TARGET} MyMeasured)
+
+if(MyReference_TOTAL_US LESS_EQUAL 0)
+  message(FATAL_ERROR "The reference compiled too fast to measure.")
+endif()
+
+math(EXPR MyTimePercent
+  "(${MyMeasured_INSTANTIATION_US} - ${MyReference_INSTANTIATION_US}) * 100 * 100 / (${MyReference_TOTAL_US} * ${SIGNATURES})")
+set(MyMeasurements "{}")
+string(JSON MyMeasurements SET "${MyMeasurements}" "instantiation_time_percent" ${MyTimePercent})
+message(STATUS "compile_cost/${SIGNATURES}_signatures")
+message(STATUS "  instantiation time per 100 signatures: ${MyTimePercent}% of compiling the includes")
+if(DEFINED MyMeasured_MEMORY_KB)
+  math(EXPR MyMemoryKilobytes "(${MyMeasured_MEMORY_KB} - ${MyReference_MEMORY_KB}) * 100 / ${SIGNATURES}")
+  string(JSON MyMeasurements SET "${MyMeasurements}" "memory_kb" ${MyMemoryKilobytes})
+  message(STATUS "  compiler memory per 100 signatures: ${MyMemoryKilobytes} kB")
+endif()
+
+string(REGEX MATCH "^[0-9]+" MyCompilerMajorVersion "${COMPILER_VERSION}")
+set(MyBaselineKey "${COMPILER_ID}-${MyCompilerMajorVersion}")
+
+if(EXISTS "${BASELINES_FILE}")
+  file(READ "${BASELINES_FILE}" MyBaselines)
+else()
+  set(MyBaselines "{}")
+endif()
+
+if(UPDATE_BASELINES)
+  string(JSON MyBaselines SET "${MyBaselines}" "${MyBaselineKey}" "${MyMeasurements}")
+  file(WRITE "${BASELINES_FILE}" "${MyBaselines}\n")
+  message(STATUS "Recorded these as the baseline for ${MyBaselineKey} in \"${BASELINES_FILE}\".")
+  return()
+endif()
+
+string(JSON MyBaseline ERROR_VARIABLE MyError GET "${MyBaselines}" "${MyBaselineKey}")
+if(MyError)
+  message(STATUS "There's no baseline for ${MyBaselineKey} to check against. Record one by configuring with "
+    "-D CPPUTILS_STDREIMPL_UPDATE_COMPILE_COST_BASELINES=ON and running this test.")
+  return()
+endif()
+
+set(MyFailures "")
+string(JSON MyMetricCount LENGTH "${MyMeasurements}")
+math(EXPR MyLastMetric "${MyMetricCount} - 1")
+foreach(MyMetricIndex RANGE ${MyLastMetric})
+  string(JSON MyMetric MEMBER "${MyMeasurements}" ${MyMetricIndex})
+  string(JSON MyBaselineValue ERROR_VARIABLE MyError GET "${MyBaseline}" "${MyMetric}")
+  if(MyError)
+    continue()
+  endif()
+  string(JSON MyValue GET "${MyMeasurements}" "${MyMetric}")
+
+  if(MyMetric STREQUAL "memory_kb")
+    set(MyTolerance ${MyMemoryTolerancePercent})
+  else()
+    set(MyTolerance ${MyTimeTolerancePercent})
+  endif()
+  math(EXPR MyLimit "${MyBaselineValue} * (100 + ${MyTolerance}) / 100")
+  message(STATUS "  ${MyMetric}: ${MyValue}, baseline ${MyBaselineValue}, limit ${MyLimit}")
+  if(MyValue GREATER MyLimit)
+    list(APPEND MyFailures "${MyMetric} is ${MyValue}, more than ${MyTolerance}% over the baseline of ${MyBaselineValue}")
+  endif()
+endforeach()
+
+if(MyFailures)
+  list(JOIN MyFailures "\n  " MyFailures)
+  message(FATAL_ERROR "Our templates cost more to compile than the baseline for ${MyBaselineKey}:\n  ${MyFailures}\n"
+    "If that's expected, record a new baseline by configuring with -D CPPUTILS_STDREIMPL_UPDATE_COMPILE_COST_BASELINES=ON "
+    "and running this test.")
+endif()
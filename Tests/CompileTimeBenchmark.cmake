@@ -0,0 +1,103 @@
+# Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#
+# Times building the compile-time benchmark's translation units by including our headers, against by importing our
+# module, and reports the difference. Run by CTest in script mode, with these variables defined:
+#   BINARY_DIR         The binary directory the benchmark's targets were configured in.
+#   GENERATED_DIR      Where the benchmark's translation units were generated, one directory per variant.
+#   INCLUDE_TARGET     The target building the translation units that include our headers.
+#   IMPORT_TARGET      The target building the translation units that import our module.
+#   TRANSLATION_UNITS  The number of translation units each target builds.
+#   RESULTS_FILE       Where to write the results as JSON.
+#
+# Each build is repeated a few times and the fastest one is kept, as the microbenchmarks do, since anything else
+# running on the machine only ever makes a build slower. The module itself is built by the warm-up, and not timed
+# after, like a precompiled header is built once for a whole project.
+#
+
+foreach(MyVariable IN ITEMS BINARY_DIR GENERATED_DIR INCLUDE_TARGET IMPORT_TARGET TRANSLATION_UNITS RESULTS_FILE)
+  if(NOT DEFINED ${MyVariable})
+    message(FATAL_ERROR "The compile-time benchmark needs the variable `${MyVariable}` defined.")
+  endif()
+endforeach()
+
+set(MyRepetitions 3)
+
+#
+# Builds the target, failing the benchmark if the build does.
+#
+function(my_build_target TARGET_NAME)
+  execute_process(
+    COMMAND ${CMAKE_COMMAND} --build "${BINARY_DIR}" --target ${TARGET_NAME} --parallel
+    RESULT_VARIABLE MyResult
+    OUTPUT_VARIABLE MyOutput
+    ERROR_VARIABLE MyOutput
+    )
+  if(NOT MyResult EQUAL 0)
+    message(FATAL_ERROR "Building `${TARGET_NAME}` failed:\n${MyOutput}")
+  endif()
+endfunction()
+
+#
+# Sets `OUT_MICROSECONDS` to the fastest of our repetitions of rebuilding all of a variant's translation units.
+#
+function(my_time_rebuild VARIANT TARGET_NAME OUT_MICROSECONDS)
+  file(GLOB MySources "${GENERATED_DIR}/${VARIANT}/*.cpp")
+
+  set(MyFastest "")
+  foreach(MyRepetition RANGE 1 ${MyRepetitions})
+    # Touching the sources makes them all out of date, without touching anything they depend on.
+    file(TOUCH ${MySources})
+
+    string(TIMESTAMP MyStart "%s%f" UTC)
+    my_build_target(${TARGET_NAME})
+    string(TIMESTAMP MyEnd "%s%f" UTC)
+
+    math(EXPR MyElapsed "${MyEnd} - ${MyStart}")
+    if(MyFastest STREQUAL "" OR MyElapsed LESS MyFastest)
+      set(MyFastest ${MyElapsed})
+    endif()
+  endforeach()
+
+  set(${OUT_MICROSECONDS} ${MyFastest} PARENT_SCOPE)
+endfunction()
+
+# Warm up, which builds everything the translation units depend on, our module included.
+my_build_target(${INCLUDE_TARGET})
+my_build_target(${IMPORT_TARGET})
+
+my_time_rebuild(Include ${INCLUDE_TARGET} MyIncludeMicroseconds)
+my_time_rebuild(Import ${IMPORT_TARGET} MyImportMicroseconds)
+
+math(EXPR MyIncludeMilliseconds "${MyIncludeMicroseconds} / 1000")
+math(EXPR MyImportMilliseconds "${MyImportMicroseconds} / 1000")
+math(EXPR MyIncludeMillisecondsPerUnit "${MyIncludeMicroseconds} / 1000 / ${TRANSLATION_UNITS}")
+math(EXPR MyImportMillisecondsPerUnit "${MyImportMicroseconds} / 1000 / ${TRANSLATION_UNITS}")
+math(EXPR MySavedMilliseconds "(${MyIncludeMicroseconds} - ${MyImportMicroseconds}) / 1000")
+
+# The speedup with two decimals, since `math` only does integers.
+if(MyImportMicroseconds GREATER 0)
+  math(EXPR MySpeedupHundredths "${MyIncludeMicroseconds} * 100 / ${MyImportMicroseconds}")
+else()
+  set(MySpeedupHundredths 0)
+endif()
+math(EXPR MySpeedupWhole "${MySpeedupHundredths} / 100")
+math(EXPR MySpeedupFraction "${MySpeedupHundredths} % 100")
+if(MySpeedupFraction LESS 10)
+  set(MySpeedupFraction "0${MySpeedupFraction}")
+endif()
+set(MySpeedup "${MySpeedupWhole}.${MySpeedupFraction}")
+
+message(STATUS "compile_time/${TRANSLATION_UNITS}_translation_units")
+message(STATUS "  include: ${MyIncludeMilliseconds} ms (${MyIncludeMillisecondsPerUnit} ms per translation unit)")
+message(STATUS "  import:  ${MyImportMilliseconds} ms (${MyImportMillisecondsPerUnit} ms per translation unit)")
+message(STATUS "  import saves ${MySavedMilliseconds} ms, building ${MySpeedup}x as fast")
+
+file(WRITE "${RESULTS_FILE}" "{
+  \"translation_units\": ${TRANSLATION_UNITS},
+  \"include_ms\": ${MyIncludeMilliseconds},
+  \"import_ms\": ${MyImportMilliseconds},
+  \"saved_ms\": ${MySavedMilliseconds},
+  \"speedup\": ${MySpeedup}
+}
+")
@@ -0,0 +1,157 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/algorithm.h>
+
+#include "TestCheck.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    namespace ex = StdReimpl::execution;
+
+    static_assert(StdReimpl::is_execution_policy_v<ex::sequenced_policy> && StdReimpl::is_execution_policy_v<ex::parallel_policy>);
+    static_assert(StdReimpl::is_execution_policy_v<ex::parallel_unsequenced_policy> && StdReimpl::is_execution_policy_v<ex::unsequenced_policy>);
+    static_assert(!StdReimpl::is_execution_policy_v<int> && !StdReimpl::is_execution_policy_v<const ex::parallel_policy>);
+
+    // Sizes around the chunking thresholds, including ones too small to split.
+    constexpr std::size_t Sizes[] = {0, 1, 2, 3, 7, 64, 1000, 4099, 100003};
+
+    std::vector<int> Iota(std::size_t count)
+    {
+        std::vector<int> values(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            values[i] = static_cast<int>((i * 7919) % 1009);
+        }
+        return values;
+    }
+
+    template <class Policy>
+    void TestForEachTransform(const Policy& policy)
+    {
+        for (std::size_t count : Sizes)
+        {
+            std::vector<std::atomic<int>> visits(count);
+            StdReimpl::for_each(policy, visits.begin(), visits.end(), [](std::atomic<int>& visit) { visit.fetch_add(1); });
+            CPPUTILS_STDREIMPL_TEST_CHECK(std::all_of(visits.begin(), visits.end(), [](const std::atomic<int>& visit) { return visit.load() == 1; }));
+
+            const std::vector<int> values = Iota(count);
+            std::vector<int> doubled(count);
+            const auto end = StdReimpl::transform(policy, values.begin(), values.end(), doubled.begin(), [](int i) { return i * 2; });
+            CPPUTILS_STDREIMPL_TEST_CHECK(end == doubled.end());
+            CPPUTILS_STDREIMPL_TEST_CHECK(std::equal(values.begin(), values.end(), doubled.begin(), [](int a, int b) { return b == a * 2; }));
+
+            std::vector<int> sums(count);
+            StdReimpl::transform(policy, values.begin(), values.end(), doubled.begin(), sums.begin(), std::plus<>());
+            CPPUTILS_STDREIMPL_TEST_CHECK(std::equal(values.begin(), values.end(), sums.begin(), [](int a, int b) { return b == a * 3; }));
+        }
+    }
+
+    template <class Policy>
+    void TestSort(const Policy& policy)
+    {
+        for (std::size_t count : Sizes)
+        {
+            std::vector<int> values = Iota(count);
+            std::vector<int> expected = values;
+            std::sort(expected.begin(), expected.end());
+            StdReimpl::sort(policy, values.begin(), values.end());
+            CPPUTILS_STDREIMPL_TEST_CHECK(values == expected);
+
+            StdReimpl::sort(policy, values.begin(), values.end(), std::greater<>());
+            CPPUTILS_STDREIMPL_TEST_CHECK(std::equal(values.begin(), values.end(), expected.rbegin()));
+        }
+
+        std::vector<std::string> strings;
+        for (int i = 0; i < 5000; ++i)
+        {
+            strings.push_back(std::to_string((i * 7919) % 5003));
+        }
+        std::vector<std::string> expected = strings;
+        std::sort(expected.begin(), expected.end());
+        StdReimpl::sort(policy, strings.begin(), strings.end());
+        CPPUTILS_STDREIMPL_TEST_CHECK(strings == expected);
+    }
+
+    template <class Policy>
+    void TestCopyIf(const Policy& policy)
+    {
+        for (std::size_t count : Sizes)
+        {
+            const std::vector<int> values = Iota(count);
+            std::vector<int> expected;
+            std::copy_if(values.begin(), values.end(), std::back_inserter(expected), [](int i) { return i % 3 == 0; });
+
+            // The predicate is called exactly once per element.
+            std::atomic<std::size_t> calls{0};
+            std::vector<int> result(count, -1);
+            const auto end = StdReimpl::copy_if(policy, values.begin(), values.end(), result.begin(), [&calls](int i)
+            {
+                calls.fetch_add(1, std::memory_order_relaxed);
+                return i % 3 == 0;
+            });
+            CPPUTILS_STDREIMPL_TEST_CHECK(calls.load() == count);
+            CPPUTILS_STDREIMPL_TEST_CHECK(static_cast<std::size_t>(end - result.begin()) == expected.size());
+            CPPUTILS_STDREIMPL_TEST_CHECK(std::equal(expected.begin(), expected.end(), result.begin()));
+            CPPUTILS_STDREIMPL_TEST_CHECK(std::all_of(end, result.end(), [](int i) { return i == -1; }));
+        }
+    }
+
+    template <class Policy>
+    void TestPolicy(const Policy& policy)
+    {
+        TestForEachTransform(policy);
+        TestSort(policy);
+        TestCopyIf(policy);
+    }
+
+    void TestSequentialIterators()
+    {
+        // Iterators that can't be split run sequentially, even with a parallel policy.
+        std::list<int> values{3, 1, 2};
+        std::vector<int> result(3);
+        StdReimpl::transform(ex::par, values.begin(), values.end(), result.begin(), [](int i) { return i + 1; });
+        CPPUTILS_STDREIMPL_TEST_CHECK((result == std::vector<int>{4, 2, 3}));
+
+        int sum = 0;
+        StdReimpl::for_each(ex::par, values.begin(), values.end(), [&sum](int i) { sum += i; });
+        CPPUTILS_STDREIMPL_TEST_CHECK(sum == 6);
+    }
+
+    void TestNested()
+    {
+        // An algorithm called from a worker of the same pool runs on that worker alone instead of waiting on its pool.
+        ex::static_thread_pool pool(2);
+        std::vector<std::vector<int>> rows(16, Iota(1000));
+        StdReimpl::for_each(ex::par.on(pool), rows.begin(), rows.end(), [&pool](std::vector<int>& row)
+        {
+            StdReimpl::sort(ex::par.on(pool), row.begin(), row.end());
+        });
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::all_of(rows.begin(), rows.end(), [](const std::vector<int>& row) { return std::is_sorted(row.begin(), row.end()); }));
+    }
+}
+
+int main()
+{
+    ex::static_thread_pool pool(4);
+    ex::static_thread_pool single(1);
+
+    TestPolicy(ex::seq);
+    TestPolicy(ex::unseq);
+    TestPolicy(ex::par);
+    TestPolicy(ex::par_unseq);
+    TestPolicy(ex::par.on(pool));
+    TestPolicy(ex::par_unseq.on(single));
+    TestSequentialIterators();
+    TestNested();
+
+    return StdReimplTests::GetExitCode();
+}
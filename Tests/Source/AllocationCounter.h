@@ -0,0 +1,51 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+// Replaces the global allocation functions to count every allocation made through them. Include this header in exactly
+// one translation unit of an executable, since replacement allocation functions can only be defined once.
+
+namespace StdReimplTests
+{
+    // Atomic, since benchmarks may allocate on several threads at once.
+    inline std::atomic<std::size_t> g_AllocationCount = 0;
+
+    /**
+     * @brief Returns the number of allocations made while calling `function`.
+     */
+    template <class F>
+    std::size_t CountAllocations(F&& function)
+    {
+        const std::size_t countBefore = g_AllocationCount;
+        std::forward<F>(function)();
+        return g_AllocationCount - countBefore;
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    StdReimplTests::g_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
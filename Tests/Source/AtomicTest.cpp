@@ -0,0 +1,222 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/atomic.h>
+
+#include "TestCheck.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    using StdReimpl::atomic_ref;
+
+    // Not default constructible, and too big for the kernel to wait on directly.
+    struct Pair
+    {
+        Pair(int inFirst, int inSecond) noexcept
+            : first(inFirst), second(inSecond)
+        {
+        }
+
+        int first;
+        int second;
+    };
+
+    template <class T>
+    concept has_difference_type = requires { typename T::difference_type; };
+
+    template <class T>
+    concept has_fetch_and = requires(const T& ref) { ref.fetch_and(typename T::value_type()); };
+
+    static_assert(std::is_same_v<atomic_ref<int>::value_type, int>);
+    static_assert(std::is_same_v<atomic_ref<int>::difference_type, int>);
+    static_assert(std::is_same_v<atomic_ref<double>::difference_type, double>);
+    static_assert(std::is_same_v<atomic_ref<int*>::difference_type, std::ptrdiff_t>);
+    static_assert(!has_difference_type<atomic_ref<bool>>);
+    static_assert(!has_difference_type<atomic_ref<Pair>>);
+    static_assert(has_fetch_and<atomic_ref<unsigned>>);
+    static_assert(!has_fetch_and<atomic_ref<double>>);
+    static_assert(!has_fetch_and<atomic_ref<bool>>);
+    static_assert(atomic_ref<std::uint64_t>::required_alignment == sizeof(std::uint64_t));
+    static_assert(atomic_ref<int>::is_always_lock_free);
+    static_assert(!std::is_copy_assignable_v<atomic_ref<int>>);
+
+    void TestOperations()
+    {
+        int i = 5;
+        const atomic_ref<int> ri(i);
+        CPPUTILS_STDREIMPL_TEST_CHECK(ri.load() == 5 && ri.is_lock_free());
+        ri.store(7, std::memory_order_release);
+        CPPUTILS_STDREIMPL_TEST_CHECK(i == 7 && ri.exchange(9) == 7 && ri == 9);
+        CPPUTILS_STDREIMPL_TEST_CHECK(ri.fetch_add(1) == 9 && ri.fetch_sub(2) == 10 && ri.load() == 8);
+        CPPUTILS_STDREIMPL_TEST_CHECK(ri++ == 8 && ++ri == 10 && ri-- == 10 && --ri == 8);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ri += 4) == 12 && (ri -= 2) == 10);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ri &= 6) == 2 && (ri |= 5) == 7 && (ri ^= 1) == 6);
+        CPPUTILS_STDREIMPL_TEST_CHECK(ri.fetch_and(3) == 6 && ri.fetch_or(8) == 2 && ri.fetch_xor(10) == 10 && i == 0);
+
+        int expected = 1;
+        CPPUTILS_STDREIMPL_TEST_CHECK(!ri.compare_exchange_strong(expected, 5) && expected == 0);
+        CPPUTILS_STDREIMPL_TEST_CHECK(ri.compare_exchange_strong(expected, 5, std::memory_order_acq_rel) && i == 5);
+        while (!ri.compare_exchange_weak(expected, 6, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(i == 6);
+
+        // Copies refer to the same object.
+        const atomic_ref<int> copy = ri;
+        copy = 42;
+        CPPUTILS_STDREIMPL_TEST_CHECK(ri.load() == 42);
+
+        double d = 1.5;
+        const atomic_ref<double> rd(d);
+        CPPUTILS_STDREIMPL_TEST_CHECK(rd.fetch_add(1.0) == 1.5 && (rd -= 0.5) == 2.0 && d == 2.0);
+
+        int values[4] = {0, 1, 2, 3};
+        int* p = values;
+        const atomic_ref<int*> rp(p);
+        CPPUTILS_STDREIMPL_TEST_CHECK(rp.fetch_add(2) == values && p == values + 2);
+        CPPUTILS_STDREIMPL_TEST_CHECK(*++rp == 3 && *(rp -= 3) == 0);
+
+        Pair pair(1, 2);
+        const atomic_ref<Pair> rpair(pair);
+        const Pair old = rpair.exchange(Pair(3, 4));
+        CPPUTILS_STDREIMPL_TEST_CHECK(old.first == 1 && old.second == 2 && pair.first == 3 && rpair.load().second == 4);
+
+        Pair expectedPair(3, 4);
+        CPPUTILS_STDREIMPL_TEST_CHECK(rpair.compare_exchange_strong(expectedPair, Pair(5, 6)) && pair.first == 5);
+
+        bool flag = false;
+        const atomic_ref<bool> rflag(flag);
+        CPPUTILS_STDREIMPL_TEST_CHECK(!rflag.exchange(true) && flag);
+    }
+
+    void TestConcurrentIncrements()
+    {
+        constexpr int ThreadCount = 4;
+        constexpr int Increments = 100000;
+
+        long long counter = 0;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < ThreadCount; ++t)
+        {
+            threads.emplace_back([&counter]()
+            {
+                const atomic_ref<long long> ref(counter);
+                for (int i = 0; i < Increments; ++i)
+                {
+                    ref.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(counter == ThreadCount * Increments);
+    }
+
+    /**
+     * @brief Passes a token back and forth between two threads, each waiting for the other to change the value, so that
+     *        both parking and waking are exercised many times.
+     */
+    template <class T>
+    bool PingPong(const atomic_ref<T>& ref, bool notifyAll)
+    {
+        constexpr int Rounds = 2000;
+
+        const auto notify = [&ref, notifyAll]()
+        {
+            notifyAll ? ref.notify_all() : ref.notify_one();
+        };
+
+        std::thread partner([&ref, &notify]()
+        {
+            for (int i = 0; i < Rounds; ++i)
+            {
+                ref.wait(static_cast<T>(2 * i), std::memory_order_acquire);
+                ref.store(static_cast<T>(2 * i + 2), std::memory_order_release);
+                notify();
+            }
+        });
+
+        bool inOrder = true;
+        for (int i = 0; i < Rounds; ++i)
+        {
+            ref.store(static_cast<T>(2 * i + 1), std::memory_order_release);
+            notify();
+            ref.wait(static_cast<T>(2 * i + 1), std::memory_order_acquire);
+            inOrder = inOrder && ref.load() == static_cast<T>(2 * i + 2);
+        }
+        partner.join();
+        return inOrder;
+    }
+
+    void TestWaitNotify()
+    {
+        // Four bytes, which the kernel waits on directly.
+        int i = 0;
+        const atomic_ref<int> ri(i);
+        CPPUTILS_STDREIMPL_TEST_CHECK(PingPong(ri, true));
+
+        // Other sizes go through the version counter of their parking slot.
+        alignas(atomic_ref<std::uint64_t>::required_alignment) std::uint64_t u = 0;
+        const atomic_ref<std::uint64_t> ru(u);
+        CPPUTILS_STDREIMPL_TEST_CHECK(PingPong(ru, false));
+
+        std::uint16_t s = 0;
+        const atomic_ref<std::uint16_t> rs(s);
+        CPPUTILS_STDREIMPL_TEST_CHECK(PingPong(rs, false));
+
+        // Waiting on a value that has already changed returns right away, and notifying with no waiters does nothing.
+        ri.wait(-1);
+        ri.notify_one();
+        ru.notify_all();
+
+        // The free functions work on `std::atomic`.
+        std::atomic<int> a{0};
+        int seen = 0;
+        std::thread waiter([&]()
+        {
+            StdReimpl::atomic_wait(&a, 0);
+            seen = a.load();
+        });
+        a.store(1);
+        StdReimpl::atomic_notify_one(&a);
+        waiter.join();
+        CPPUTILS_STDREIMPL_TEST_CHECK(seen == 1);
+
+        // Every waiter is woken by `atomic_notify_all`.
+        std::atomic<std::int64_t> gate{0};
+        std::atomic<int> released{0};
+        std::vector<std::thread> waiters;
+        for (int t = 0; t < 4; ++t)
+        {
+            waiters.emplace_back([&]()
+            {
+                StdReimpl::atomic_wait_explicit(&gate, std::int64_t{0}, std::memory_order_acquire);
+                released.fetch_add(1);
+            });
+        }
+        gate.store(1, std::memory_order_release);
+        StdReimpl::atomic_notify_all(&gate);
+        for (std::thread& thread : waiters)
+        {
+            thread.join();
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(released.load() == 4);
+    }
+}
+
+int main()
+{
+    TestOperations();
+    TestConcurrentIncrements();
+    TestWaitNotify();
+
+    return StdReimplTests::GetExitCode();
+}
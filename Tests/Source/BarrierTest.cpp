@@ -0,0 +1,143 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/barrier.h>
+
+#include "TestCheck.h"
+
+#include <atomic>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    using StdReimpl::barrier;
+
+    struct CountPhases
+    {
+        void operator()() noexcept
+        {
+            ++*phases;
+        }
+
+        int* phases;
+    };
+
+    static_assert(barrier<>::max() > 0);
+    static_assert(!std::is_copy_constructible_v<barrier<>>);
+    static_assert(std::is_move_constructible_v<barrier<>::arrival_token>);
+
+    void TestSingleThread()
+    {
+        int phases = 0;
+        barrier<CountPhases> sync(1, CountPhases{&phases});
+        sync.arrive_and_wait();
+        sync.arrive_and_wait();
+        CPPUTILS_STDREIMPL_TEST_CHECK(phases == 2);
+
+        // One thread can arrive for several participants at once.
+        barrier<CountPhases> several(3, CountPhases{&phases});
+        auto token = several.arrive(2);
+        CPPUTILS_STDREIMPL_TEST_CHECK(phases == 2);
+        several.wait(several.arrive());
+        CPPUTILS_STDREIMPL_TEST_CHECK(phases == 3);
+
+        // Waiting on a token of a phase that has ended returns right away.
+        several.wait(std::move(token));
+    }
+
+    /**
+     * @brief Runs `threadCount` threads through `rounds` rounds, each writing its slot of the shared data and then
+     *        checking, after the barrier, that everyone else wrote theirs. It takes two phases of the barrier per round,
+     *        and the completion step runs exactly once per phase, after every write of that phase.
+     */
+    bool RunRounds(int threadCount, int rounds)
+    {
+        std::vector<int> slots(static_cast<std::size_t>(threadCount), -1);
+        int completions = 0;
+        bool completionsInOrder = true;
+        std::atomic<bool> inOrder{true};
+
+        const auto completion = [&]() noexcept
+        {
+            for (const int slot : slots)
+            {
+                completionsInOrder = completionsInOrder && slot == completions / 2;
+            }
+            ++completions;
+        };
+        barrier<decltype(completion)> sync(threadCount, completion);
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&, t]()
+            {
+                for (int round = 0; round < rounds; ++round)
+                {
+                    slots[static_cast<std::size_t>(t)] = round;
+                    sync.arrive_and_wait();
+                    if (completions != 2 * round + 1 || slots[static_cast<std::size_t>((t + 1) % threadCount)] != round)
+                    {
+                        inOrder.store(false);
+                    }
+                    // Nobody writes the next phase's values before everyone has read this phase's.
+                    sync.arrive_and_wait();
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        return inOrder.load() && completionsInOrder && completions == 2 * rounds;
+    }
+
+    void TestThreads()
+    {
+        // A single node, then a tree with one level of leaves, then one with three levels.
+        CPPUTILS_STDREIMPL_TEST_CHECK(RunRounds(3, 200));
+        CPPUTILS_STDREIMPL_TEST_CHECK(RunRounds(8, 100));
+        CPPUTILS_STDREIMPL_TEST_CHECK(RunRounds(40, 20));
+    }
+
+    void TestDrop()
+    {
+        // Threads leave one after another, and the remaining ones keep going with a smaller count.
+        constexpr int ThreadCount = 12;
+
+        std::atomic<int> completions{0};
+        const auto completion = [&completions]() noexcept { completions.fetch_add(1, std::memory_order_relaxed); };
+        barrier<decltype(completion)> sync(ThreadCount, completion);
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < ThreadCount; ++t)
+        {
+            threads.emplace_back([&sync, t]()
+            {
+                for (int phase = 0; phase < t; ++phase)
+                {
+                    sync.arrive_and_wait();
+                }
+                sync.arrive_and_drop();
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // In each phase, one thread drops, until the last one drops alone.
+        CPPUTILS_STDREIMPL_TEST_CHECK(completions.load() == ThreadCount);
+    }
+}
+
+int main()
+{
+    TestSingleThread();
+    TestThreads();
+    TestDrop();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,192 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/algorithm.h>
+#include <CppUtils/StdReimpl/numeric.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace
+{
+    namespace ex = StdReimpl::execution;
+
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    //
+    // The parallel algorithms on pools of 1 to 64 threads, each against the sequential algorithm from the vendor's
+    // standard library. Each operation is one call over the whole range, so the time per operation should fall as the
+    // threads go up, until they outnumber the cores.
+    //
+
+    constexpr std::size_t ElementCount = std::size_t{1} << 20;
+    constexpr std::size_t SortElementCount = std::size_t{1} << 18;
+
+    template <int ThreadCount>
+    ex::static_thread_pool& Pool()
+    {
+        static ex::static_thread_pool pool(ThreadCount);
+        return pool;
+    }
+
+    const std::vector<double>& Inputs()
+    {
+        static const std::vector<double> inputs = []()
+        {
+            std::vector<double> values(ElementCount);
+            std::uint64_t x = 0x9E3779B97F4A7C15ull;
+            for (double& value : values)
+            {
+                x ^= x << 13;
+                x ^= x >> 7;
+                x ^= x << 17;
+                value = static_cast<double>(x % 1000000) / 1000.0;
+            }
+            return values;
+        }();
+        return inputs;
+    }
+
+    // A little work per element, so that there is something to split up besides memory bandwidth.
+    double Work(double x)
+    {
+        return std::sqrt(x) * 1.5 + 2.0;
+    }
+
+    bool Keep(double x)
+    {
+        return std::fmod(x, 3.0) < 1.0;
+    }
+
+    template <class Policy>
+    void ForEach(const Policy& policy, std::uint64_t iterations)
+    {
+        std::vector<double> values = Inputs();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            StdReimpl::for_each(policy, values.begin(), values.end(), [](double& x) { x = Work(x); });
+            DoNotOptimize(values);
+        }
+    }
+
+    template <class Policy>
+    void Transform(const Policy& policy, std::uint64_t iterations)
+    {
+        std::vector<double> results(ElementCount);
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            StdReimpl::transform(policy, Inputs().begin(), Inputs().end(), results.begin(), Work);
+            DoNotOptimize(results);
+        }
+    }
+
+    template <class Policy>
+    void Reduce(const Policy& policy, std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            double sum = StdReimpl::reduce(policy, Inputs().begin(), Inputs().end());
+            DoNotOptimize(sum);
+        }
+    }
+
+    template <class Policy>
+    void TransformReduce(const Policy& policy, std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            double sum = StdReimpl::transform_reduce(policy, Inputs().begin(), Inputs().end(), 0.0, std::plus<>(), Work);
+            DoNotOptimize(sum);
+        }
+    }
+
+    template <class Policy>
+    void InclusiveScan(const Policy& policy, std::uint64_t iterations)
+    {
+        std::vector<double> results(ElementCount);
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            StdReimpl::inclusive_scan(policy, Inputs().begin(), Inputs().end(), results.begin());
+            DoNotOptimize(results);
+        }
+    }
+
+    // Copying the unsorted values back in is part of each operation, for both implementations.
+    template <class Policy>
+    void Sort(const Policy& policy, std::uint64_t iterations)
+    {
+        std::vector<double> values(SortElementCount);
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            std::copy_n(Inputs().begin(), SortElementCount, values.begin());
+            StdReimpl::sort(policy, values.begin(), values.end());
+            DoNotOptimize(values);
+        }
+    }
+
+    template <class Policy>
+    void CopyIf(const Policy& policy, std::uint64_t iterations)
+    {
+        std::vector<double> results(ElementCount);
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            auto end = StdReimpl::copy_if(policy, Inputs().begin(), Inputs().end(), results.begin(), Keep);
+            DoNotOptimize(end);
+        }
+    }
+
+    template <void (*Algorithm)(const ex::parallel_policy&, std::uint64_t), int ThreadCount>
+    void RunParallel(std::uint64_t iterations)
+    {
+        Algorithm(ex::par.on(Pool<ThreadCount>()), iterations);
+    }
+
+    template <void (*Algorithm)(const ex::sequenced_policy&, std::uint64_t)>
+    void RunSequential(std::uint64_t iterations)
+    {
+        Algorithm(ex::seq, iterations);
+    }
+
+    template <void (*Parallel)(const ex::parallel_policy&, std::uint64_t), void (*Sequential)(const ex::sequenced_policy&, std::uint64_t),
+        int ThreadCount>
+    void RegisterAlgorithm(const char* name)
+    {
+        // Zero-padded, so that the groups sort by thread count.
+        const std::string group = std::string("parallel/") + name + "/threads_" + std::string(ThreadCount < 10 ? "0" : "") +
+            std::to_string(ThreadCount);
+
+        StdReimplBenchmarks::RegisterBenchmark({group, "StdReimpl", &RunParallel<Parallel, ThreadCount>});
+        StdReimplBenchmarks::RegisterBenchmark({group, "std_sequential", &RunSequential<Sequential>});
+    }
+
+    template <int ThreadCount>
+    void RegisterThreadCount()
+    {
+        RegisterAlgorithm<&ForEach, &ForEach, ThreadCount>("for_each");
+        RegisterAlgorithm<&Transform, &Transform, ThreadCount>("transform");
+        RegisterAlgorithm<&Reduce, &Reduce, ThreadCount>("reduce");
+        RegisterAlgorithm<&TransformReduce, &TransformReduce, ThreadCount>("transform_reduce");
+        RegisterAlgorithm<&InclusiveScan, &InclusiveScan, ThreadCount>("inclusive_scan");
+        RegisterAlgorithm<&Sort, &Sort, ThreadCount>("sort");
+        RegisterAlgorithm<&CopyIf, &CopyIf, ThreadCount>("copy_if");
+    }
+
+    const bool g_ThreadCountsRegistered = []()
+    {
+        RegisterThreadCount<1>();
+        RegisterThreadCount<2>();
+        RegisterThreadCount<4>();
+        RegisterThreadCount<8>();
+        RegisterThreadCount<16>();
+        RegisterThreadCount<32>();
+        RegisterThreadCount<64>();
+        return true;
+    }();
+}
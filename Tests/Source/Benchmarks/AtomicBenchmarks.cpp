@@ -0,0 +1,166 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/atomic.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    //
+    // Two threads passing a token back and forth, each blocking until the other changes a shared value. Each operation is
+    // one round trip, i.e., two wake-ups. Besides the mean, the percentiles of the time a single wake-up takes are reported,
+    // since a sleep loop shows up in the tail rather than in the mean.
+    //
+
+    /**
+     * @brief Reports the percentiles of the wake-up latencies, which are half of each round trip.
+     */
+    void ReportLatencies(std::vector<double>& roundTrips)
+    {
+        if (roundTrips.empty())
+        {
+            return;
+        }
+
+        std::sort(roundTrips.begin(), roundTrips.end());
+        const auto percentile = [&roundTrips](double fraction)
+        {
+            const std::size_t index = static_cast<std::size_t>(fraction * static_cast<double>(roundTrips.size() - 1));
+            return roundTrips[index] / 2.0;
+        };
+
+        StdReimplBenchmarks::ReportCounter("wake-up p50 ns", percentile(0.5));
+        StdReimplBenchmarks::ReportCounter("wake-up p90 ns", percentile(0.9));
+        StdReimplBenchmarks::ReportCounter("wake-up p99 ns", percentile(0.99));
+        StdReimplBenchmarks::ReportCounter("wake-up p99.9 ns", percentile(0.999));
+    }
+
+    /**
+     * @brief Runs the ping-pong with `wait(value, old)` blocking until `value` isn't `old`, and `notify(value)` waking the
+     *        other thread.
+     */
+    template <class Wait, class Notify>
+    void PingPong(std::uint64_t iterations, Wait wait, Notify notify)
+    {
+        std::atomic<std::uint32_t> value{0};
+
+        std::thread partner([&value, iterations, wait, notify]()
+        {
+            for (std::uint64_t i = 0; i < iterations; ++i)
+            {
+                const std::uint32_t ping = static_cast<std::uint32_t>(2 * i + 1);
+                wait(value, ping - 1);
+                value.store(ping + 1, std::memory_order_release);
+                notify(value);
+            }
+        });
+
+        std::vector<double> roundTrips;
+        roundTrips.reserve(static_cast<std::size_t>(iterations));
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const std::uint32_t ping = static_cast<std::uint32_t>(2 * i + 1);
+            const auto before = std::chrono::steady_clock::now();
+
+            value.store(ping, std::memory_order_release);
+            notify(value);
+            wait(value, ping);
+
+            roundTrips.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - before).count());
+        }
+
+        partner.join();
+        ReportLatencies(roundTrips);
+    }
+
+    void PingPongStdReimpl(std::uint64_t iterations)
+    {
+        PingPong(iterations,
+            [](const std::atomic<std::uint32_t>& value, std::uint32_t old) { StdReimpl::atomic_wait_explicit(&value, old, std::memory_order_acquire); },
+            [](std::atomic<std::uint32_t>& value) { StdReimpl::atomic_notify_one(&value); });
+    }
+
+    // The usual way to block without `wait`: a condition variable, which every wake-up has to lock a mutex for.
+    struct ConditionVariable
+    {
+        std::mutex mutex;
+        std::condition_variable condition;
+    };
+
+    void PingPongConditionVariable(std::uint64_t iterations)
+    {
+        static ConditionVariable cv;
+        PingPong(iterations,
+            [](const std::atomic<std::uint32_t>& value, std::uint32_t old)
+            {
+                std::unique_lock<std::mutex> lock(cv.mutex);
+                cv.condition.wait(lock, [&value, old]() { return value.load(std::memory_order_acquire) != old; });
+            },
+            [](std::atomic<std::uint32_t>&)
+            {
+                {
+                    const std::lock_guard<std::mutex> lock(cv.mutex);
+                }
+                cv.condition.notify_one();
+            });
+    }
+
+    const BenchmarkRegistrar g_PingPongStdReimpl{"atomic_wait/ping_pong", "StdReimpl", &PingPongStdReimpl};
+    const BenchmarkRegistrar g_PingPongConditionVariable{"atomic_wait/ping_pong", "condition_variable", &PingPongConditionVariable};
+
+#if defined(__cpp_lib_atomic_wait)
+    void PingPongStd(std::uint64_t iterations)
+    {
+        PingPong(iterations,
+            [](const std::atomic<std::uint32_t>& value, std::uint32_t old) { value.wait(old, std::memory_order_acquire); },
+            [](std::atomic<std::uint32_t>& value) { value.notify_one(); });
+    }
+
+    const BenchmarkRegistrar g_PingPongStd{"atomic_wait/ping_pong", "std", &PingPongStd};
+#endif
+
+    //
+    // Notifying when nothing waits, which should cost no more than a fence and a load.
+    //
+
+    void NotifyUncontendedStdReimpl(std::uint64_t iterations)
+    {
+        std::atomic<std::uint32_t> value{0};
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            value.store(static_cast<std::uint32_t>(i), std::memory_order_release);
+            StdReimpl::atomic_notify_one(&value);
+        }
+        DoNotOptimize(value);
+    }
+
+    const BenchmarkRegistrar g_NotifyUncontendedStdReimpl{"atomic_wait/notify_uncontended", "StdReimpl", &NotifyUncontendedStdReimpl};
+
+#if defined(__cpp_lib_atomic_wait)
+    void NotifyUncontendedStd(std::uint64_t iterations)
+    {
+        std::atomic<std::uint32_t> value{0};
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            value.store(static_cast<std::uint32_t>(i), std::memory_order_release);
+            value.notify_one();
+        }
+        DoNotOptimize(value);
+    }
+
+    const BenchmarkRegistrar g_NotifyUncontendedStd{"atomic_wait/notify_uncontended", "std", &NotifyUncontendedStd};
+#endif
+}
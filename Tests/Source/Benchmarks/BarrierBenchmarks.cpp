@@ -0,0 +1,129 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/barrier.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__has_include)
+#   if __has_include(<barrier>)
+#       include <barrier>
+#   endif
+#endif
+
+namespace
+{
+    //
+    // 1 to 64 threads going through the same barrier over and over. Each operation is one phase, i.e., every thread
+    // arriving once and waiting for the others, so the time per operation is how long a phase takes with that many
+    // threads: a single counter that every thread contends on makes it grow faster than the tree does.
+    //
+
+    template <class Barrier>
+    void RunPhases(Barrier& sync, int threadCount, std::uint64_t iterations)
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(static_cast<std::size_t>(threadCount));
+        for (int i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back([&sync, iterations]()
+            {
+                for (std::uint64_t phase = 0; phase < iterations; ++phase)
+                {
+                    sync.arrive_and_wait();
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    // The usual way to write a barrier by hand: a counter and a generation behind a mutex.
+    class ConditionVariableBarrier
+    {
+    public:
+        explicit ConditionVariableBarrier(int inExpected)
+            : expected(inExpected)
+        {
+        }
+
+        void arrive_and_wait()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            const std::uint64_t arrivalGeneration = generation;
+            if (++arrived == expected)
+            {
+                arrived = 0;
+                ++generation;
+                lock.unlock();
+                condition.notify_all();
+                return;
+            }
+            condition.wait(lock, [this, arrivalGeneration]() { return generation != arrivalGeneration; });
+        }
+
+    private:
+        std::mutex mutex;
+        std::condition_variable condition;
+        int expected;
+        int arrived = 0;
+        std::uint64_t generation = 0;
+    };
+
+    template <int ThreadCount>
+    void PhasesStdReimpl(std::uint64_t iterations)
+    {
+        StdReimpl::barrier<> sync(ThreadCount);
+        RunPhases(sync, ThreadCount, iterations);
+    }
+
+    template <int ThreadCount>
+    void PhasesConditionVariable(std::uint64_t iterations)
+    {
+        ConditionVariableBarrier sync(ThreadCount);
+        RunPhases(sync, ThreadCount, iterations);
+    }
+
+#if defined(__cpp_lib_barrier)
+    template <int ThreadCount>
+    void PhasesStd(std::uint64_t iterations)
+    {
+        std::barrier<> sync(ThreadCount);
+        RunPhases(sync, ThreadCount, iterations);
+    }
+#endif
+
+    template <int ThreadCount>
+    void RegisterThreadCount()
+    {
+        // Zero-padded, so that the groups sort by thread count.
+        const std::string group = "barrier/threads_" + std::string(ThreadCount < 10 ? "0" : "") + std::to_string(ThreadCount);
+
+        StdReimplBenchmarks::RegisterBenchmark({group, "StdReimpl", &PhasesStdReimpl<ThreadCount>});
+#if defined(__cpp_lib_barrier)
+        StdReimplBenchmarks::RegisterBenchmark({group, "std", &PhasesStd<ThreadCount>});
+#endif
+        StdReimplBenchmarks::RegisterBenchmark({group, "condition_variable", &PhasesConditionVariable<ThreadCount>});
+    }
+
+    const bool g_ThreadCountsRegistered = []()
+    {
+        RegisterThreadCount<1>();
+        RegisterThreadCount<2>();
+        RegisterThreadCount<4>();
+        RegisterThreadCount<8>();
+        RegisterThreadCount<16>();
+        RegisterThreadCount<32>();
+        RegisterThreadCount<64>();
+        return true;
+    }();
+}
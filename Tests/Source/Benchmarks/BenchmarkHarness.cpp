@@ -0,0 +1,380 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include "../AllocationCounter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__) && __has_include(<linux/perf_event.h>)
+#   include <linux/perf_event.h>
+#   include <sys/ioctl.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#   define CPPUTILS_STDREIMPL_BENCHMARKS_HAS_PERF_EVENT 1
+#else
+#   define CPPUTILS_STDREIMPL_BENCHMARKS_HAS_PERF_EVENT 0
+#endif
+
+namespace StdReimplBenchmarks
+{
+    namespace
+    {
+        std::vector<BenchmarkDefinition>& GetBenchmarks()
+        {
+            static std::vector<BenchmarkDefinition> benchmarks;
+            return benchmarks;
+        }
+
+        using Counters = std::vector<std::pair<std::string, double>>;
+
+        // What the benchmark that is running has reported with `ReportCounter`.
+        Counters& GetCurrentCounters()
+        {
+            static Counters counters;
+            return counters;
+        }
+
+        /**
+         * @brief Counts retired user-space instructions of this thread using `perf_event_open`. Unavailable on other
+         *        platforms, and also on Linux when the kernel doesn't permit it (see `perf_event_paranoid`).
+         */
+        class InstructionCounter
+        {
+        public:
+            InstructionCounter()
+            {
+#if CPPUTILS_STDREIMPL_BENCHMARKS_HAS_PERF_EVENT
+                perf_event_attr attributes{};
+                attributes.type = PERF_TYPE_HARDWARE;
+                attributes.size = sizeof(attributes);
+                attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+                attributes.disabled = 1;
+                attributes.exclude_kernel = 1;
+                attributes.exclude_hv = 1;
+
+                fileDescriptor = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+#endif
+            }
+
+            ~InstructionCounter()
+            {
+#if CPPUTILS_STDREIMPL_BENCHMARKS_HAS_PERF_EVENT
+                if (IsAvailable())
+                {
+                    close(fileDescriptor);
+                }
+#endif
+            }
+
+            InstructionCounter(const InstructionCounter&) = delete;
+            InstructionCounter& operator=(const InstructionCounter&) = delete;
+
+            bool IsAvailable() const
+            {
+                return fileDescriptor >= 0;
+            }
+
+            void Start()
+            {
+#if CPPUTILS_STDREIMPL_BENCHMARKS_HAS_PERF_EVENT
+                if (IsAvailable())
+                {
+                    ioctl(fileDescriptor, PERF_EVENT_IOC_RESET, 0);
+                    ioctl(fileDescriptor, PERF_EVENT_IOC_ENABLE, 0);
+                }
+#endif
+            }
+
+            std::optional<std::uint64_t> Stop()
+            {
+#if CPPUTILS_STDREIMPL_BENCHMARKS_HAS_PERF_EVENT
+                if (IsAvailable())
+                {
+                    ioctl(fileDescriptor, PERF_EVENT_IOC_DISABLE, 0);
+
+                    std::uint64_t count = 0;
+                    if (read(fileDescriptor, &count, sizeof(count)) == static_cast<ssize_t>(sizeof(count)))
+                    {
+                        return count;
+                    }
+                }
+#endif
+                return std::nullopt;
+            }
+
+        private:
+            int fileDescriptor = -1;
+        };
+
+        struct Measurement
+        {
+            double nanoseconds = 0.0;
+            std::optional<std::uint64_t> instructions;
+            std::size_t allocations = 0;
+            Counters counters;
+        };
+
+        struct BenchmarkResult
+        {
+            const BenchmarkDefinition* definition = nullptr;
+            std::uint64_t iterations = 0;
+            double nanosecondsPerOperation = 0.0;
+            std::optional<double> instructionsPerOperation;
+            double allocationsPerOperation = 0.0;
+            Counters counters;
+        };
+
+        struct Options
+        {
+            std::string_view filter;
+            std::string_view jsonPath;
+            double minimumMilliseconds = 50.0;
+            int repetitions = 5;
+        };
+
+        Measurement Measure(const BenchmarkDefinition& definition, std::uint64_t iterations, InstructionCounter& instructionCounter)
+        {
+            Measurement measurement;
+            GetCurrentCounters().clear();
+
+            const std::size_t allocationsBefore = StdReimplTests::g_AllocationCount;
+            const auto timeBefore = std::chrono::steady_clock::now();
+            instructionCounter.Start();
+
+            definition.function(iterations);
+
+            measurement.instructions = instructionCounter.Stop();
+            const auto timeAfter = std::chrono::steady_clock::now();
+            measurement.allocations = StdReimplTests::g_AllocationCount - allocationsBefore;
+            measurement.nanoseconds = std::chrono::duration<double, std::nano>(timeAfter - timeBefore).count();
+            measurement.counters = std::move(GetCurrentCounters());
+
+            return measurement;
+        }
+
+        BenchmarkResult Run(const BenchmarkDefinition& definition, const Options& options, InstructionCounter& instructionCounter)
+        {
+            const double minimumNanoseconds = options.minimumMilliseconds * 1e6;
+
+            // Find an iteration count that runs for at least the minimum time.
+            std::uint64_t iterations = 1;
+            while (true)
+            {
+                const Measurement measurement = Measure(definition, iterations, instructionCounter);
+                if (measurement.nanoseconds >= minimumNanoseconds || iterations >= (std::uint64_t{1} << 40))
+                {
+                    break;
+                }
+
+                const double scale = measurement.nanoseconds > 0.0 ? 1.2 * minimumNanoseconds / measurement.nanoseconds : 100.0;
+                iterations = static_cast<std::uint64_t>(static_cast<double>(iterations) * std::clamp(scale, 2.0, 100.0));
+            }
+
+            // Keep the fastest repetition, since noise only ever makes a run slower.
+            Measurement best;
+            best.nanoseconds = -1.0;
+            for (int repetition = 0; repetition < options.repetitions; ++repetition)
+            {
+                const Measurement measurement = Measure(definition, iterations, instructionCounter);
+                if (best.nanoseconds < 0.0 || measurement.nanoseconds < best.nanoseconds)
+                {
+                    best = measurement;
+                }
+            }
+
+            BenchmarkResult result;
+            result.definition = &definition;
+            result.iterations = iterations;
+            result.nanosecondsPerOperation = best.nanoseconds / static_cast<double>(iterations);
+            if (best.instructions)
+            {
+                result.instructionsPerOperation = static_cast<double>(*best.instructions) / static_cast<double>(iterations);
+            }
+            result.allocationsPerOperation = static_cast<double>(best.allocations) / static_cast<double>(iterations);
+            result.counters = std::move(best.counters);
+
+            return result;
+        }
+
+        void WriteJsonString(std::FILE* file, std::string_view text)
+        {
+            std::fputc('"', file);
+            for (const char c : text)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    std::fputc('\\', file);
+                }
+                std::fputc(c, file);
+            }
+            std::fputc('"', file);
+        }
+
+        bool WriteJson(const std::vector<BenchmarkResult>& results, std::string_view path)
+        {
+            std::FILE* file = std::fopen(std::string(path).c_str(), "w");
+            if (!file)
+            {
+                std::fprintf(stderr, "Failed to open \"%.*s\" for writing.\n", static_cast<int>(path.size()), path.data());
+                return false;
+            }
+
+            std::fprintf(file, "{\n  \"context\": {\n    \"compiler\": ");
+#if defined(__clang__)
+            WriteJsonString(file, "clang " __clang_version__);
+#elif defined(__GNUC__)
+            WriteJsonString(file, "gcc " __VERSION__);
+#elif defined(_MSC_VER)
+            std::fprintf(file, "\"msvc %d\"", _MSC_FULL_VER);
+#else
+            WriteJsonString(file, "unknown");
+#endif
+            std::fprintf(file, ",\n    \"cplusplus\": %ld\n  },\n  \"benchmarks\": [", static_cast<long>(__cplusplus));
+
+            for (std::size_t i = 0; i < results.size(); ++i)
+            {
+                const BenchmarkResult& result = results[i];
+
+                std::fprintf(file, "%s\n    {\"group\": ", i == 0 ? "" : ",");
+                WriteJsonString(file, result.definition->group);
+                std::fprintf(file, ", \"implementation\": ");
+                WriteJsonString(file, result.definition->implementation);
+                std::fprintf(file, ", \"iterations\": %llu, \"ns_per_op\": %.4f, \"instructions_per_op\": ",
+                    static_cast<unsigned long long>(result.iterations), result.nanosecondsPerOperation);
+                if (result.instructionsPerOperation)
+                {
+                    std::fprintf(file, "%.4f", *result.instructionsPerOperation);
+                }
+                else
+                {
+                    std::fprintf(file, "null");
+                }
+                std::fprintf(file, ", \"allocations_per_op\": %.4f", result.allocationsPerOperation);
+                if (!result.counters.empty())
+                {
+                    std::fprintf(file, ", \"counters\": {");
+                    for (std::size_t j = 0; j < result.counters.size(); ++j)
+                    {
+                        std::fprintf(file, "%s", j == 0 ? "" : ", ");
+                        WriteJsonString(file, result.counters[j].first);
+                        std::fprintf(file, ": %.4f", result.counters[j].second);
+                    }
+                    std::fprintf(file, "}");
+                }
+                std::fprintf(file, "}");
+            }
+
+            std::fprintf(file, "\n  ]\n}\n");
+            return std::fclose(file) == 0;
+        }
+
+        void PrintUsage(const char* programName)
+        {
+            std::printf(
+                "Usage: %s [--filter <substring>] [--json <path>] [--min-time-ms <milliseconds>] [--repetitions <count>]\n",
+                programName);
+        }
+    }
+
+    void RegisterBenchmark(BenchmarkDefinition definition)
+    {
+        GetBenchmarks().push_back(std::move(definition));
+    }
+
+    void ReportCounter(std::string name, double value)
+    {
+        GetCurrentCounters().emplace_back(std::move(name), value);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using namespace StdReimplBenchmarks;
+
+    Options options;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view argument = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (argument == "--filter" && hasValue)
+        {
+            options.filter = argv[++i];
+        }
+        else if (argument == "--json" && hasValue)
+        {
+            options.jsonPath = argv[++i];
+        }
+        else if (argument == "--min-time-ms" && hasValue)
+        {
+            options.minimumMilliseconds = std::atof(argv[++i]);
+        }
+        else if (argument == "--repetitions" && hasValue)
+        {
+            options.repetitions = std::max(1, std::atoi(argv[++i]));
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return argument == "--help" ? 0 : 1;
+        }
+    }
+
+    // Run benchmarks of the same group next to each other so they're easy to compare.
+    std::vector<BenchmarkDefinition>& benchmarks = GetBenchmarks();
+    std::stable_sort(benchmarks.begin(), benchmarks.end(),
+        [](const BenchmarkDefinition& a, const BenchmarkDefinition& b) { return a.group < b.group; });
+
+    InstructionCounter instructionCounter;
+    if (!instructionCounter.IsAvailable())
+    {
+        std::printf("Instruction counts are unavailable on this system.\n");
+    }
+
+    std::printf("%-40s %-32s %12s %12s %12s\n", "group", "impl", "ns/op", "instr/op", "allocs/op");
+
+    std::vector<BenchmarkResult> results;
+    for (const BenchmarkDefinition& definition : benchmarks)
+    {
+        const std::string fullName = definition.group + "/" + definition.implementation;
+        if (!options.filter.empty() && fullName.find(options.filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        const BenchmarkResult& result = results.emplace_back(Run(definition, options, instructionCounter));
+
+        std::printf("%-40s %-32s %12.3f ", definition.group.c_str(), definition.implementation.c_str(), result.nanosecondsPerOperation);
+        if (result.instructionsPerOperation)
+        {
+            std::printf("%12.2f", *result.instructionsPerOperation);
+        }
+        else
+        {
+            std::printf("%12s", "-");
+        }
+        std::printf(" %12.3f\n", result.allocationsPerOperation);
+        for (const auto& [name, value] : result.counters)
+        {
+            std::printf("%-40s %-32s %12.3f  (%s)\n", "", "", value, name.c_str());
+        }
+        std::fflush(stdout);
+    }
+
+    if (!options.jsonPath.empty() && !WriteJson(results, options.jsonPath))
+    {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+/**
+ * @brief A small, self-contained microbenchmark harness, so that we can compare our reimplementations against the
+ *        vendor's standard library without depending on a benchmarking framework.
+ */
+namespace StdReimplBenchmarks
+{
+    /**
+     * @brief A benchmark body. It must perform the measured operation exactly `iterations` times.
+     */
+    using BenchmarkFunction = void (*)(std::uint64_t iterations);
+
+    struct BenchmarkDefinition
+    {
+        // What is being measured, e.g., "invoke_r". Benchmarks in the same group are compared against each other.
+        std::string group;
+
+        // Whose implementation is being measured, e.g., "StdReimpl" or "std".
+        std::string implementation;
+
+        BenchmarkFunction function = nullptr;
+    };
+
+    void RegisterBenchmark(BenchmarkDefinition definition);
+
+    /**
+     * @brief Reports another number about the run being measured, e.g., a latency percentile, to be printed and written
+     *        to the results next to the time per operation. Call it from a benchmark body. The numbers from the fastest
+     *        repetition are kept.
+     */
+    void ReportCounter(std::string name, double value);
+
+    /**
+     * @brief Registers a benchmark during static initialization. Define one of these at namespace scope per benchmark.
+     */
+    struct BenchmarkRegistrar
+    {
+        BenchmarkRegistrar(std::string group, std::string implementation, BenchmarkFunction function)
+        {
+            StdReimplBenchmarks::RegisterBenchmark({std::move(group), std::move(implementation), function});
+        }
+    };
+
+    /**
+     * @brief Prevents the compiler from optimizing away the computation of `value`.
+     */
+    template <class T>
+    inline void DoNotOptimize(T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : "+m"(value) : : "memory");
+#else
+        static_cast<void>(*static_cast<volatile T*>(&value));
+#endif
+    }
+
+    /**
+     * @brief Prevents the compiler from assuming anything about the contents of memory.
+     */
+    inline void ClobberMemory()
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : : "memory");
+#endif
+    }
+}
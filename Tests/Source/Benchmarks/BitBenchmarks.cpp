@@ -0,0 +1,97 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/bit.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::ClobberMemory;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    // Each operation converts this many elements, as when loading a big endian asset.
+    constexpr std::size_t g_Count = 4096;
+
+    template <class T>
+    std::vector<T> MakeValues()
+    {
+        std::vector<T> values(g_Count);
+        for (std::size_t i = 0; i < g_Count; ++i)
+        {
+            values[i] = static_cast<T>(0x0123456789ABCDEFu * (i + 1));
+        }
+        return values;
+    }
+
+    template <class T>
+    void ByteswapBatchStdReimpl(std::uint64_t iterations)
+    {
+        const std::vector<T> values = MakeValues<T>();
+        std::vector<T> result(g_Count);
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            StdReimpl::byteswap(std::span<const T>(values), std::span<T>(result));
+            ClobberMemory();
+        }
+        DoNotOptimize(result);
+    }
+
+    // A loop over the scalar `byteswap`, which is what we'd write without the batch version.
+    template <class T>
+    void ByteswapBatchScalarLoop(std::uint64_t iterations)
+    {
+        const std::vector<T> values = MakeValues<T>();
+        std::vector<T> result(g_Count);
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            for (std::size_t j = 0; j < g_Count; ++j)
+            {
+                result[j] = StdReimpl::byteswap(values[j]);
+            }
+            ClobberMemory();
+        }
+        DoNotOptimize(result);
+    }
+
+    const BenchmarkRegistrar g_ByteswapBatch16StdReimpl{"byteswap_batch/uint16", "StdReimpl", &ByteswapBatchStdReimpl<std::uint16_t>};
+    const BenchmarkRegistrar g_ByteswapBatch16ScalarLoop{"byteswap_batch/uint16", "scalar_loop", &ByteswapBatchScalarLoop<std::uint16_t>};
+    const BenchmarkRegistrar g_ByteswapBatch32StdReimpl{"byteswap_batch/uint32", "StdReimpl", &ByteswapBatchStdReimpl<std::uint32_t>};
+    const BenchmarkRegistrar g_ByteswapBatch32ScalarLoop{"byteswap_batch/uint32", "scalar_loop", &ByteswapBatchScalarLoop<std::uint32_t>};
+    const BenchmarkRegistrar g_ByteswapBatch64StdReimpl{"byteswap_batch/uint64", "StdReimpl", &ByteswapBatchStdReimpl<std::uint64_t>};
+    const BenchmarkRegistrar g_ByteswapBatch64ScalarLoop{"byteswap_batch/uint64", "scalar_loop", &ByteswapBatchScalarLoop<std::uint64_t>};
+
+    template <bool UseStdReimpl>
+    void Popcount(std::uint64_t iterations)
+    {
+        const std::vector<std::uint64_t> values = MakeValues<std::uint64_t>();
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            std::uint64_t value = values[i % g_Count];
+            DoNotOptimize(value);
+
+            int result;
+            if constexpr (UseStdReimpl)
+            {
+                result = StdReimpl::popcount(value) + StdReimpl::countl_zero(value) + StdReimpl::countr_zero(value);
+            }
+            else
+            {
+                result = std::popcount(value) + std::countl_zero(value) + std::countr_zero(value);
+            }
+            DoNotOptimize(result);
+        }
+    }
+
+    const BenchmarkRegistrar g_PopcountStdReimpl{"bit_counts/uint64", "StdReimpl", &Popcount<true>};
+    const BenchmarkRegistrar g_PopcountStd{"bit_counts/uint64", "std", &Popcount<false>};
+}
@@ -0,0 +1,301 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/charconv.h>
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    constexpr std::size_t g_Count = 1024;
+
+    /**
+     * @brief Half short decimals, like the ones in telemetry and JSON, and half any finite double, which need all 17
+     *        digits.
+     */
+    std::vector<double> MakeDoubles()
+    {
+        std::vector<double> values(g_Count);
+        std::uint64_t state = 0x9E3779B97F4A7C15;
+        for (std::size_t i = 0; i < g_Count; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            if (i % 2 == 0)
+            {
+                values[i] = static_cast<double>(state % 10000000) / 1000.0;
+            }
+            else
+            {
+                // Clears the top exponent bit, so it's finite, and keeps the sign.
+                const std::uint64_t bits = state & ~(std::uint64_t{1} << 62);
+                std::memcpy(&values[i], &bits, sizeof(double));
+            }
+        }
+        return values;
+    }
+
+    std::vector<float> MakeFloats()
+    {
+        const std::vector<double> doubles = MakeDoubles();
+        std::vector<float> values(g_Count);
+        for (std::size_t i = 0; i < g_Count; ++i)
+        {
+            values[i] = i % 2 == 0 ? static_cast<float>(doubles[i]) : static_cast<float>(doubles[i] * 1e-300);
+        }
+        return values;
+    }
+
+    template <class T>
+    std::vector<T> MakeValues()
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            return MakeFloats();
+        }
+        else
+        {
+            return MakeDoubles();
+        }
+    }
+
+    std::vector<std::string> MakeDoubleStrings()
+    {
+        const std::vector<double> values = MakeDoubles();
+        std::vector<std::string> strings(g_Count);
+        for (std::size_t i = 0; i < g_Count; ++i)
+        {
+            char buffer[64];
+            const StdReimpl::to_chars_result result = StdReimpl::to_chars(buffer, buffer + sizeof(buffer), values[i]);
+            strings[i].assign(buffer, result.ptr);
+        }
+        return strings;
+    }
+
+    //
+    // to_chars: the shortest round trip representation. snprintf can't find that, so it's given the 17 digits that
+    // always round trip, which is the usual workaround.
+    //
+
+    template <class T>
+    void ShortestStdReimpl(std::uint64_t iterations)
+    {
+        const std::vector<T> values = MakeValues<T>();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            char buffer[64];
+            StdReimpl::to_chars_result result = StdReimpl::to_chars(buffer, buffer + sizeof(buffer), values[i % g_Count]);
+            DoNotOptimize(result);
+            DoNotOptimize(buffer);
+        }
+    }
+
+#if defined(__cpp_lib_to_chars)
+    template <class T>
+    void ShortestStd(std::uint64_t iterations)
+    {
+        const std::vector<T> values = MakeValues<T>();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            char buffer[64];
+            std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), values[i % g_Count]);
+            DoNotOptimize(result);
+            DoNotOptimize(buffer);
+        }
+    }
+#endif
+
+    template <class T>
+    void ShortestSnprintf(std::uint64_t iterations)
+    {
+        const std::vector<T> values = MakeValues<T>();
+        const char* format = std::is_same_v<T, float> ? "%.9g" : "%.17g";
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            char buffer[64];
+            int length = std::snprintf(buffer, sizeof(buffer), format, static_cast<double>(values[i % g_Count]));
+            DoNotOptimize(length);
+            DoNotOptimize(buffer);
+        }
+    }
+
+    const BenchmarkRegistrar g_ShortestDoubleStdReimpl{"to_chars/double_shortest", "StdReimpl", &ShortestStdReimpl<double>};
+    const BenchmarkRegistrar g_ShortestDoubleSnprintf{"to_chars/double_shortest", "snprintf_%.17g", &ShortestSnprintf<double>};
+    const BenchmarkRegistrar g_ShortestFloatStdReimpl{"to_chars/float_shortest", "StdReimpl", &ShortestStdReimpl<float>};
+    const BenchmarkRegistrar g_ShortestFloatSnprintf{"to_chars/float_shortest", "snprintf_%.9g", &ShortestSnprintf<float>};
+#if defined(__cpp_lib_to_chars)
+    const BenchmarkRegistrar g_ShortestDoubleStd{"to_chars/double_shortest", "std", &ShortestStd<double>};
+    const BenchmarkRegistrar g_ShortestFloatStd{"to_chars/float_shortest", "std", &ShortestStd<float>};
+#endif
+
+    //
+    // to_chars with a precision: `%.6f`, the everyday telemetry format.
+    //
+
+    void FixedStdReimpl(std::uint64_t iterations)
+    {
+        const std::vector<double> values = MakeDoubles();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            // The short decimals only, since the others can have hundreds of digits before the point.
+            char buffer[64];
+            StdReimpl::to_chars_result result =
+                StdReimpl::to_chars(buffer, buffer + sizeof(buffer), values[(i * 2) % g_Count], StdReimpl::chars_format::fixed, 6);
+            DoNotOptimize(result);
+            DoNotOptimize(buffer);
+        }
+    }
+
+#if defined(__cpp_lib_to_chars)
+    void FixedStd(std::uint64_t iterations)
+    {
+        const std::vector<double> values = MakeDoubles();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            char buffer[64];
+            std::to_chars_result result =
+                std::to_chars(buffer, buffer + sizeof(buffer), values[(i * 2) % g_Count], std::chars_format::fixed, 6);
+            DoNotOptimize(result);
+            DoNotOptimize(buffer);
+        }
+    }
+#endif
+
+    void FixedSnprintf(std::uint64_t iterations)
+    {
+        const std::vector<double> values = MakeDoubles();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            char buffer[64];
+            int length = std::snprintf(buffer, sizeof(buffer), "%.6f", values[(i * 2) % g_Count]);
+            DoNotOptimize(length);
+            DoNotOptimize(buffer);
+        }
+    }
+
+    const BenchmarkRegistrar g_FixedStdReimpl{"to_chars/double_fixed_6", "StdReimpl", &FixedStdReimpl};
+    const BenchmarkRegistrar g_FixedSnprintf{"to_chars/double_fixed_6", "snprintf_%.6f", &FixedSnprintf};
+#if defined(__cpp_lib_to_chars)
+    const BenchmarkRegistrar g_FixedStd{"to_chars/double_fixed_6", "std", &FixedStd};
+#endif
+
+    //
+    // from_chars: reading back the shortest representations.
+    //
+
+    void ParseStdReimpl(std::uint64_t iterations)
+    {
+        const std::vector<std::string> strings = MakeDoubleStrings();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const std::string& text = strings[i % g_Count];
+            double value;
+            StdReimpl::from_chars_result result = StdReimpl::from_chars(text.data(), text.data() + text.size(), value);
+            DoNotOptimize(result);
+            DoNotOptimize(value);
+        }
+    }
+
+#if defined(__cpp_lib_to_chars)
+    void ParseStd(std::uint64_t iterations)
+    {
+        const std::vector<std::string> strings = MakeDoubleStrings();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const std::string& text = strings[i % g_Count];
+            double value;
+            std::from_chars_result result = std::from_chars(text.data(), text.data() + text.size(), value);
+            DoNotOptimize(result);
+            DoNotOptimize(value);
+        }
+    }
+#endif
+
+    void ParseStrtod(std::uint64_t iterations)
+    {
+        const std::vector<std::string> strings = MakeDoubleStrings();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            double value = std::strtod(strings[i % g_Count].c_str(), nullptr);
+            DoNotOptimize(value);
+        }
+    }
+
+    const BenchmarkRegistrar g_ParseStdReimpl{"from_chars/double", "StdReimpl", &ParseStdReimpl};
+    const BenchmarkRegistrar g_ParseStrtod{"from_chars/double", "strtod", &ParseStrtod};
+#if defined(__cpp_lib_to_chars)
+    const BenchmarkRegistrar g_ParseStd{"from_chars/double", "std", &ParseStd};
+#endif
+
+    //
+    // Integers, which write two digits per step.
+    //
+
+    std::vector<std::int64_t> MakeIntegers()
+    {
+        std::vector<std::int64_t> values(g_Count);
+        std::uint64_t state = 0x2545F4914F6CDD1D;
+        for (std::size_t i = 0; i < g_Count; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            // All sorts of lengths.
+            values[i] = static_cast<std::int64_t>(state >> (state % 64));
+        }
+        return values;
+    }
+
+    void IntegerStdReimpl(std::uint64_t iterations)
+    {
+        const std::vector<std::int64_t> values = MakeIntegers();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            char buffer[32];
+            StdReimpl::to_chars_result result = StdReimpl::to_chars(buffer, buffer + sizeof(buffer), values[i % g_Count]);
+            DoNotOptimize(result);
+            DoNotOptimize(buffer);
+        }
+    }
+
+    void IntegerStd(std::uint64_t iterations)
+    {
+        const std::vector<std::int64_t> values = MakeIntegers();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            char buffer[32];
+            std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), values[i % g_Count]);
+            DoNotOptimize(result);
+            DoNotOptimize(buffer);
+        }
+    }
+
+    void IntegerSnprintf(std::uint64_t iterations)
+    {
+        const std::vector<std::int64_t> values = MakeIntegers();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            char buffer[32];
+            int length = std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(values[i % g_Count]));
+            DoNotOptimize(length);
+            DoNotOptimize(buffer);
+        }
+    }
+
+    const BenchmarkRegistrar g_IntegerStdReimpl{"to_chars/int64", "StdReimpl", &IntegerStdReimpl};
+    const BenchmarkRegistrar g_IntegerStd{"to_chars/int64", "std", &IntegerStd};
+    const BenchmarkRegistrar g_IntegerSnprintf{"to_chars/int64", "snprintf_%lld", &IntegerSnprintf};
+}
@@ -0,0 +1,157 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/cmath.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::ClobberMemory;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    constexpr std::size_t g_BatchSize = 1024;
+
+    template <class T>
+    std::array<T, g_BatchSize> MakeMixedSignValues()
+    {
+        std::array<T, g_BatchSize> values{};
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = static_cast<T>(i) * ((i % 3 == 0) ? T(-0.5) : T(1.25));
+        }
+        return values;
+    }
+
+    template <class T, bool UseStdReimpl>
+    void Fabs(std::uint64_t iterations)
+    {
+        std::array<T, g_BatchSize> values = MakeMixedSignValues<T>();
+        DoNotOptimize(values);
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            T value = values[i % values.size()];
+            DoNotOptimize(value);
+
+            T result;
+            if constexpr (UseStdReimpl)
+            {
+                result = StdReimpl::fabs(value);
+            }
+            else
+            {
+                result = std::fabs(value);
+            }
+            DoNotOptimize(result);
+        }
+    }
+
+    template <class T, bool UseStdReimpl>
+    void Copysign(std::uint64_t iterations)
+    {
+        std::array<T, g_BatchSize> values = MakeMixedSignValues<T>();
+        DoNotOptimize(values);
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            T mag = values[i % values.size()];
+            T sgn = values[(i + 1) % values.size()];
+            DoNotOptimize(mag);
+            DoNotOptimize(sgn);
+
+            T result;
+            if constexpr (UseStdReimpl)
+            {
+                result = StdReimpl::copysign(mag, sgn);
+            }
+            else
+            {
+                result = std::copysign(mag, sgn);
+            }
+            DoNotOptimize(result);
+        }
+    }
+
+    /**
+     * @brief One iteration is one whole batch of `g_BatchSize` elements. The `std` version is a plain loop, which the
+     *        compiler is free to vectorize itself.
+     */
+    template <class T, bool UseStdReimpl>
+    void FabsBatch(std::uint64_t iterations)
+    {
+        std::array<T, g_BatchSize> values = MakeMixedSignValues<T>();
+        std::array<T, g_BatchSize> result{};
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(values);
+            if constexpr (UseStdReimpl)
+            {
+                StdReimpl::fabs(values, result);
+            }
+            else
+            {
+                for (std::size_t j = 0; j < values.size(); ++j)
+                {
+                    result[j] = std::fabs(values[j]);
+                }
+            }
+            DoNotOptimize(result);
+            ClobberMemory();
+        }
+    }
+
+    template <class T, bool UseStdReimpl>
+    void CopysignBatch(std::uint64_t iterations)
+    {
+        std::array<T, g_BatchSize> mags = MakeMixedSignValues<T>();
+        std::array<T, g_BatchSize> sgns = MakeMixedSignValues<T>();
+        std::array<T, g_BatchSize> result{};
+        std::rotate(sgns.begin(), sgns.begin() + 1, sgns.end());
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(mags);
+            DoNotOptimize(sgns);
+            if constexpr (UseStdReimpl)
+            {
+                StdReimpl::copysign(mags, sgns, result);
+            }
+            else
+            {
+                for (std::size_t j = 0; j < mags.size(); ++j)
+                {
+                    result[j] = std::copysign(mags[j], sgns[j]);
+                }
+            }
+            DoNotOptimize(result);
+            ClobberMemory();
+        }
+    }
+
+    const BenchmarkRegistrar g_FabsFloatStdReimpl{"fabs/float", "StdReimpl", &Fabs<float, true>};
+    const BenchmarkRegistrar g_FabsFloatStd{"fabs/float", "std", &Fabs<float, false>};
+    const BenchmarkRegistrar g_FabsDoubleStdReimpl{"fabs/double", "StdReimpl", &Fabs<double, true>};
+    const BenchmarkRegistrar g_FabsDoubleStd{"fabs/double", "std", &Fabs<double, false>};
+
+    const BenchmarkRegistrar g_CopysignFloatStdReimpl{"copysign/float", "StdReimpl", &Copysign<float, true>};
+    const BenchmarkRegistrar g_CopysignFloatStd{"copysign/float", "std", &Copysign<float, false>};
+    const BenchmarkRegistrar g_CopysignDoubleStdReimpl{"copysign/double", "StdReimpl", &Copysign<double, true>};
+    const BenchmarkRegistrar g_CopysignDoubleStd{"copysign/double", "std", &Copysign<double, false>};
+
+    const BenchmarkRegistrar g_FabsBatchFloatStdReimpl{"fabs/float[1024]", "StdReimpl", &FabsBatch<float, true>};
+    const BenchmarkRegistrar g_FabsBatchFloatStd{"fabs/float[1024]", "std loop", &FabsBatch<float, false>};
+    const BenchmarkRegistrar g_FabsBatchDoubleStdReimpl{"fabs/double[1024]", "StdReimpl", &FabsBatch<double, true>};
+    const BenchmarkRegistrar g_FabsBatchDoubleStd{"fabs/double[1024]", "std loop", &FabsBatch<double, false>};
+
+    const BenchmarkRegistrar g_CopysignBatchFloatStdReimpl{"copysign/float[1024]", "StdReimpl", &CopysignBatch<float, true>};
+    const BenchmarkRegistrar g_CopysignBatchFloatStd{"copysign/float[1024]", "std loop", &CopysignBatch<float, false>};
+    const BenchmarkRegistrar g_CopysignBatchDoubleStdReimpl{"copysign/double[1024]", "StdReimpl", &CopysignBatch<double, true>};
+    const BenchmarkRegistrar g_CopysignBatchDoubleStd{"copysign/double[1024]", "std loop", &CopysignBatch<double, false>};
+}
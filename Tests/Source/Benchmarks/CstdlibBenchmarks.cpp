@@ -0,0 +1,52 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/cstdlib.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    template <class T>
+    std::array<T, 1024> MakeMixedSignValues()
+    {
+        std::array<T, 1024> values{};
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = static_cast<T>((i % 3 == 0) ? -static_cast<T>(i) : static_cast<T>(i * 7));
+        }
+        return values;
+    }
+
+    template <class T, bool UseStdReimpl>
+    void Abs(std::uint64_t iterations)
+    {
+        std::array<T, 1024> values = MakeMixedSignValues<T>();
+        DoNotOptimize(values);
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            T result;
+            if constexpr (UseStdReimpl)
+            {
+                result = StdReimpl::abs(values[i % values.size()]);
+            }
+            else
+            {
+                result = std::abs(values[i % values.size()]);
+            }
+            DoNotOptimize(result);
+        }
+    }
+
+    const BenchmarkRegistrar g_AbsIntStdReimpl{"abs/int", "StdReimpl", &Abs<int, true>};
+    const BenchmarkRegistrar g_AbsIntStd{"abs/int", "std", &Abs<int, false>};
+    const BenchmarkRegistrar g_AbsLongLongStdReimpl{"abs/long long", "StdReimpl", &Abs<long long, true>};
+    const BenchmarkRegistrar g_AbsLongLongStd{"abs/long long", "std", &Abs<long long, false>};
+}
@@ -0,0 +1,255 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/execution.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    namespace ex = StdReimpl::execution;
+
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    /**
+     * @brief The usual thread pool: a single queue of `std::function`s behind a mutex, which every worker waits on with a
+     *        condition variable. Each submission allocates, and every worker contends for the same lock.
+     */
+    class MutexQueuePool
+    {
+    public:
+        explicit MutexQueuePool(unsigned threadCount)
+        {
+            for (unsigned i = 0; i < threadCount; ++i)
+            {
+                threads.emplace_back([this]() { Run(); });
+            }
+        }
+
+        ~MutexQueuePool()
+        {
+            {
+                const std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            condition.notify_all();
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        void Submit(std::function<void()> task)
+        {
+            {
+                const std::lock_guard<std::mutex> lock(mutex);
+                tasks.push_back(std::move(task));
+            }
+            condition.notify_one();
+        }
+
+    private:
+        void Run()
+        {
+            while (true)
+            {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    condition.wait(lock, [this]() { return stopping || !tasks.empty(); });
+                    if (tasks.empty())
+                    {
+                        return;
+                    }
+                    task = std::move(tasks.front());
+                    tasks.pop_front();
+                }
+                task();
+            }
+        }
+
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::deque<std::function<void()>> tasks;
+        bool stopping = false;
+        std::vector<std::thread> threads;
+    };
+
+    /**
+     * @brief Blocks until `Arrive` has been called `count` times, for waiting on the naive pool.
+     */
+    class Countdown
+    {
+    public:
+        explicit Countdown(std::size_t count)
+            : remaining(count)
+        {
+        }
+
+        void Arrive()
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            if (--remaining == 0)
+            {
+                condition.notify_one();
+            }
+        }
+
+        void Wait()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this]() { return remaining == 0; });
+        }
+
+    private:
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::size_t remaining;
+    };
+
+    unsigned ThreadCount()
+    {
+        return std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    // A little work per task, so that the benchmarks measure scheduling rather than nothing.
+    std::uint64_t Work(std::uint64_t seed)
+    {
+        std::uint64_t x = seed | 1;
+        for (int i = 0; i < 64; ++i)
+        {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+        }
+        return x;
+    }
+
+    //
+    // Fork-join: each operation forks eight small tasks onto the pool and waits for all of them.
+    //
+
+    void ForkJoinStdReimpl(std::uint64_t iterations)
+    {
+        static ex::static_thread_pool pool(ThreadCount());
+        const ex::static_thread_pool::scheduler sch = pool.get_scheduler();
+
+        const auto task = [sch](std::uint64_t seed) { return ex::starts_on(sch, ex::just(seed) | ex::then(Work)); };
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            auto results = StdReimpl::this_thread::sync_wait(ex::when_all(task(i), task(i + 1), task(i + 2), task(i + 3), task(i + 4),
+                task(i + 5), task(i + 6), task(i + 7)));
+            DoNotOptimize(results);
+        }
+    }
+
+    void ForkJoinMutexQueue(std::uint64_t iterations)
+    {
+        static MutexQueuePool pool(ThreadCount());
+
+        std::uint64_t results[8];
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            Countdown countdown(8);
+            for (std::uint64_t j = 0; j < 8; ++j)
+            {
+                pool.Submit([&results, &countdown, i, j]()
+                {
+                    results[j] = Work(i + j);
+                    countdown.Arrive();
+                });
+            }
+            countdown.Wait();
+            DoNotOptimize(results);
+        }
+    }
+
+    const BenchmarkRegistrar g_ForkJoinStdReimpl{"static_thread_pool/fork_join", "StdReimpl", &ForkJoinStdReimpl};
+    const BenchmarkRegistrar g_ForkJoinMutexQueue{"static_thread_pool/fork_join", "mutex_queue", &ForkJoinMutexQueue};
+
+    //
+    // Bulk: each operation runs 4096 small calls spread over the pool, and waits for them.
+    //
+
+    constexpr std::size_t BulkShape = 4096;
+
+    void BulkStdReimpl(std::uint64_t iterations)
+    {
+        static ex::static_thread_pool pool(ThreadCount());
+        const ex::static_thread_pool::scheduler sch = pool.get_scheduler();
+
+        static std::vector<std::uint64_t> results(BulkShape);
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            StdReimpl::this_thread::sync_wait(ex::schedule(sch) | ex::bulk(BulkShape, [i](std::size_t j) { results[j] = Work(i + j); }));
+            DoNotOptimize(results);
+        }
+    }
+
+    // Splits the range into a few chunks per thread, as one would by hand.
+    void BulkMutexQueue(std::uint64_t iterations)
+    {
+        static MutexQueuePool pool(ThreadCount());
+
+        static std::vector<std::uint64_t> results(BulkShape);
+        const std::size_t chunkCount = ThreadCount() * 4;
+        const std::size_t chunkSize = (BulkShape + chunkCount - 1) / chunkCount;
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            Countdown countdown(chunkCount);
+            for (std::size_t c = 0; c < chunkCount; ++c)
+            {
+                pool.Submit([&countdown, i, c, chunkSize]()
+                {
+                    for (std::size_t j = c * chunkSize; j < std::min((c + 1) * chunkSize, BulkShape); ++j)
+                    {
+                        results[j] = Work(i + j);
+                    }
+                    countdown.Arrive();
+                });
+            }
+            countdown.Wait();
+            DoNotOptimize(results);
+        }
+    }
+
+    const BenchmarkRegistrar g_BulkStdReimpl{"static_thread_pool/bulk", "StdReimpl", &BulkStdReimpl};
+    const BenchmarkRegistrar g_BulkMutexQueue{"static_thread_pool/bulk", "mutex_queue", &BulkMutexQueue};
+
+    //
+    // A chain of adaptors run to completion on the calling thread, which should cost no more than the calls themselves.
+    //
+
+    void ThenChainStdReimpl(std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            auto result = StdReimpl::this_thread::sync_wait(ex::just(i) | ex::then([](std::uint64_t x) { return x * 3; }) |
+                ex::then([](std::uint64_t x) { return x + 1; }) | ex::then([](std::uint64_t x) { return x ^ 5; }));
+            DoNotOptimize(result);
+        }
+    }
+
+    void ThenChainDirect(std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            std::uint64_t result = ((i * 3) + 1) ^ 5;
+            DoNotOptimize(result);
+        }
+    }
+
+    const BenchmarkRegistrar g_ThenChainStdReimpl{"execution/then_chain", "StdReimpl", &ThenChainStdReimpl};
+    const BenchmarkRegistrar g_ThenChainDirect{"execution/then_chain", "direct", &ThenChainDirect};
+}
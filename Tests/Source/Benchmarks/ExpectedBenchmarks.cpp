@@ -0,0 +1,149 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/expected.h>
+
+#include <cstdint>
+#include <utility>
+
+#if defined(__has_include)
+#   if __has_include(<expected>)
+#       include <expected>
+#   endif
+#endif
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    enum class ErrorCode : std::uint8_t
+    {
+        None,
+        EndOfFile
+    };
+
+    //
+    // Returning a result across a call that isn't inlined, the way an I/O layer would. One in 64 calls fails.
+    //
+
+    StdReimpl::expected<int, ErrorCode> ReadStdReimpl(int x)
+    {
+        if ((x & 63) == 63)
+        {
+            return StdReimpl::unexpected(ErrorCode::EndOfFile);
+        }
+        return x + 1;
+    }
+
+    bool ReadOutParam(int x, int& outValue, ErrorCode& outError)
+    {
+        if ((x & 63) == 63)
+        {
+            outError = ErrorCode::EndOfFile;
+            return false;
+        }
+        outValue = x + 1;
+        return true;
+    }
+
+    void ReturnStdReimpl(std::uint64_t iterations)
+    {
+        StdReimpl::expected<int, ErrorCode> (*read)(int) = &ReadStdReimpl;
+        DoNotOptimize(read);
+
+        int value = 0;
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const StdReimpl::expected<int, ErrorCode> result = read(value);
+            value = result ? *result : static_cast<int>(result.error());
+            DoNotOptimize(value);
+        }
+    }
+
+    void ReturnOutParam(std::uint64_t iterations)
+    {
+        bool (*read)(int, int&, ErrorCode&) = &ReadOutParam;
+        DoNotOptimize(read);
+
+        int value = 0;
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            int result;
+            ErrorCode error;
+            value = read(value, result, error) ? result : static_cast<int>(error);
+            DoNotOptimize(value);
+        }
+    }
+
+    const BenchmarkRegistrar g_ReturnStdReimpl{"expected/return", "StdReimpl", &ReturnStdReimpl};
+    const BenchmarkRegistrar g_ReturnOutParam{"expected/return", "out-param", &ReturnOutParam};
+
+#if defined(__cpp_lib_expected)
+    std::expected<int, ErrorCode> ReadStd(int x)
+    {
+        if ((x & 63) == 63)
+        {
+            return std::unexpected(ErrorCode::EndOfFile);
+        }
+        return x + 1;
+    }
+
+    void ReturnStd(std::uint64_t iterations)
+    {
+        std::expected<int, ErrorCode> (*read)(int) = &ReadStd;
+        DoNotOptimize(read);
+
+        int value = 0;
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const std::expected<int, ErrorCode> result = read(value);
+            value = result ? *result : static_cast<int>(result.error());
+            DoNotOptimize(value);
+        }
+    }
+
+    const BenchmarkRegistrar g_ReturnStd{"expected/return", "std", &ReturnStd};
+#endif
+
+    //
+    // A chain of monadic operations.
+    //
+
+    void AndThenStdReimpl(std::uint64_t iterations)
+    {
+        int value = 0;
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(value);
+            const auto result = ReadStdReimpl(value)
+                .and_then(&ReadStdReimpl)
+                .transform([](int x) { return x * 2; })
+                .transform_error([](ErrorCode) { return -1; });
+            value = result ? *result : result.error();
+            DoNotOptimize(value);
+        }
+    }
+
+    const BenchmarkRegistrar g_AndThenStdReimpl{"expected/and_then", "StdReimpl", &AndThenStdReimpl};
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202211L
+    void AndThenStd(std::uint64_t iterations)
+    {
+        int value = 0;
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(value);
+            const auto result = ReadStd(value)
+                .and_then(&ReadStd)
+                .transform([](int x) { return x * 2; })
+                .transform_error([](ErrorCode) { return -1; });
+            value = result ? *result : result.error();
+            DoNotOptimize(value);
+        }
+    }
+
+    const BenchmarkRegistrar g_AndThenStd{"expected/and_then", "std", &AndThenStd};
+#endif
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/flat_map.h>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    // A power of two, so that we can pick a probe with a mask.
+    constexpr std::size_t g_ProbeCount = 1024;
+
+    /**
+     * @brief Sparse, asset-ID-like keys: the `i`th is a hash of `i`, so they aren't inserted in order.
+     */
+    std::uint32_t MakeKey(std::size_t i)
+    {
+        return static_cast<std::uint32_t>((i + 1) * 2654435761u);
+    }
+
+    /**
+     * @brief Builds the table once per benchmark, outside of the measured loop, from a batch of pairs the way a table
+     *        loaded from config or an asset manifest would be.
+     */
+    template <class Map, std::size_t Size>
+    const Map& GetMap()
+    {
+        static const Map s_Map = []()
+            {
+                std::vector<std::pair<std::uint32_t, std::uint32_t>> pairs;
+                pairs.reserve(Size);
+                for (std::size_t i = 0; i < Size; ++i)
+                {
+                    pairs.emplace_back(MakeKey(i), static_cast<std::uint32_t>(i));
+                }
+                return Map(pairs.begin(), pairs.end());
+            }();
+        return s_Map;
+    }
+
+    /**
+     * @brief Looks up keys that are in the table, in an order that a branch predictor can't learn.
+     */
+    template <class Map, std::size_t Size>
+    void Find(std::uint64_t iterations)
+    {
+        const Map& map = GetMap<Map, Size>();
+
+        static const std::vector<std::uint32_t> s_Probes = []()
+            {
+                std::vector<std::uint32_t> probes(g_ProbeCount);
+                for (std::size_t i = 0; i < g_ProbeCount; ++i)
+                {
+                    probes[i] = MakeKey((i * 7919) % Size);
+                }
+                return probes;
+            }();
+
+        std::uint32_t sum = 0;
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const auto it = map.find(s_Probes[i & (g_ProbeCount - 1)]);
+            sum += it->second;
+        }
+        DoNotOptimize(sum);
+    }
+
+    template <StdReimpl::flat_search_mode SearchMode>
+    using FlatMap = StdReimpl::flat_map<std::uint32_t, std::uint32_t, std::less<std::uint32_t>,
+        std::vector<std::uint32_t>, std::vector<std::uint32_t>, SearchMode>;
+
+    using BinaryFlatMap = FlatMap<StdReimpl::flat_search_mode::binary>;
+    using EytzingerFlatMap = FlatMap<StdReimpl::flat_search_mode::eytzinger>;
+    using StdMap = std::map<std::uint32_t, std::uint32_t>;
+
+#define MY_REGISTER_FLAT_MAP_BENCHMARKS(Name, Function, Size) \
+    const BenchmarkRegistrar g_##Function##Size##Binary{Name, "StdReimpl", &Function<BinaryFlatMap, Size>}; \
+    const BenchmarkRegistrar g_##Function##Size##Eytzinger{Name, "StdReimpl (eytzinger)", &Function<EytzingerFlatMap, Size>}; \
+    const BenchmarkRegistrar g_##Function##Size##Std{Name, "std::map", &Function<StdMap, Size>};
+
+    MY_REGISTER_FLAT_MAP_BENCHMARKS("flat_map/find/16", Find, 16)
+    MY_REGISTER_FLAT_MAP_BENCHMARKS("flat_map/find/256", Find, 256)
+    MY_REGISTER_FLAT_MAP_BENCHMARKS("flat_map/find/65536", Find, 65536)
+
+#undef MY_REGISTER_FLAT_MAP_BENCHMARKS
+}
@@ -0,0 +1,197 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/format.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#if __has_include(<format>)
+#   include <format>
+#endif
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    constexpr std::size_t g_Count = 64;
+
+    // The fields of a typical log line.
+    struct LogRecord
+    {
+        const char* level;
+        int thread;
+        std::uint64_t sequence;
+        double latencyMs;
+        std::string_view message;
+    };
+
+    const LogRecord& GetRecord(std::uint64_t i)
+    {
+        static const LogRecord* const records = []
+        {
+            static LogRecord storage[g_Count];
+            const char* const levels[] = {"info", "warn", "error", "debug"};
+            const std::string_view messages[] = {"frame submitted", "texture streamed in", "connection dropped, retrying", "ok"};
+            for (std::size_t j = 0; j < g_Count; ++j)
+            {
+                storage[j] = {levels[j % 4], static_cast<int>(j * 7 % 13), 1000000 + j * 7919, static_cast<double>(j * 37 % 1000) / 7.0, messages[j % 4]};
+            }
+            return storage;
+        }();
+        return records[i % g_Count];
+    }
+
+    //
+    // A log line into a fixed buffer on the stack, the logging hot path.
+    //
+
+    void LogLineStdReimpl(std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const LogRecord& r = GetRecord(i);
+            char buffer[256];
+            StdReimpl::format_to_n_result<char*> result =
+                StdReimpl::format_to_n(buffer, sizeof(buffer), "[{:<5}] t{:02} #{} {:.3f}ms {}", r.level, r.thread, r.sequence, r.latencyMs, r.message);
+            DoNotOptimize(result);
+            DoNotOptimize(buffer);
+        }
+    }
+
+    void LogLineSnprintf(std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const LogRecord& r = GetRecord(i);
+            char buffer[256];
+            int length = std::snprintf(buffer, sizeof(buffer), "[%-5s] t%02d #%llu %.3fms %.*s", r.level, r.thread, static_cast<unsigned long long>(r.sequence),
+                r.latencyMs, static_cast<int>(r.message.size()), r.message.data());
+            DoNotOptimize(length);
+            DoNotOptimize(buffer);
+        }
+    }
+
+#if defined(__cpp_lib_format)
+    void LogLineStd(std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const LogRecord& r = GetRecord(i);
+            char buffer[256];
+            std::format_to_n_result<char*> result =
+                std::format_to_n(buffer, sizeof(buffer), "[{:<5}] t{:02} #{} {:.3f}ms {}", r.level, r.thread, r.sequence, r.latencyMs, r.message);
+            DoNotOptimize(result);
+            DoNotOptimize(buffer);
+        }
+    }
+#endif
+
+    void LogLineOstringstream(std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const LogRecord& r = GetRecord(i);
+            std::ostringstream stream;
+            stream.setf(std::ios::fixed);
+            stream.precision(3);
+            stream << '[' << r.level;
+            for (std::size_t pad = std::char_traits<char>::length(r.level); pad < 5; ++pad)
+            {
+                stream << ' ';
+            }
+            stream << "] t" << (r.thread < 10 ? "0" : "") << r.thread << " #" << r.sequence << ' ' << r.latencyMs << "ms " << r.message;
+            std::string result = stream.str();
+            DoNotOptimize(result);
+        }
+    }
+
+    const BenchmarkRegistrar g_LogLineStdReimpl{"format/log_line_to_n", "StdReimpl", &LogLineStdReimpl};
+    const BenchmarkRegistrar g_LogLineSnprintf{"format/log_line_to_n", "snprintf", &LogLineSnprintf};
+    const BenchmarkRegistrar g_LogLineOstringstream{"format/log_line_to_n", "ostringstream", &LogLineOstringstream};
+#if defined(__cpp_lib_format)
+    const BenchmarkRegistrar g_LogLineStd{"format/log_line_to_n", "std", &LogLineStd};
+#endif
+
+    //
+    // A few integers into a std::string, where the result fits in its small string buffer.
+    //
+
+    void IntegersStdReimpl(std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const LogRecord& r = GetRecord(i);
+            std::string result = StdReimpl::format("{}:{}", r.thread, r.sequence);
+            DoNotOptimize(result);
+        }
+    }
+
+    void IntegersSnprintf(std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const LogRecord& r = GetRecord(i);
+            char buffer[64];
+            const int length = std::snprintf(buffer, sizeof(buffer), "%d:%llu", r.thread, static_cast<unsigned long long>(r.sequence));
+            std::string result(buffer, static_cast<std::size_t>(length));
+            DoNotOptimize(result);
+        }
+    }
+
+#if defined(__cpp_lib_format)
+    void IntegersStd(std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const LogRecord& r = GetRecord(i);
+            std::string result = std::format("{}:{}", r.thread, r.sequence);
+            DoNotOptimize(result);
+        }
+    }
+#endif
+
+    void IntegersOstringstream(std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const LogRecord& r = GetRecord(i);
+            std::ostringstream stream;
+            stream << r.thread << ':' << r.sequence;
+            std::string result = stream.str();
+            DoNotOptimize(result);
+        }
+    }
+
+    const BenchmarkRegistrar g_IntegersStdReimpl{"format/integers_to_string", "StdReimpl", &IntegersStdReimpl};
+    const BenchmarkRegistrar g_IntegersSnprintf{"format/integers_to_string", "snprintf", &IntegersSnprintf};
+    const BenchmarkRegistrar g_IntegersOstringstream{"format/integers_to_string", "ostringstream", &IntegersOstringstream};
+#if defined(__cpp_lib_format)
+    const BenchmarkRegistrar g_IntegersStd{"format/integers_to_string", "std", &IntegersStd};
+#endif
+
+    //
+    // The same log line parsed at runtime, which shows what compiling the format string saves.
+    //
+
+    void RuntimeFormatStdReimpl(std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const LogRecord& r = GetRecord(i);
+            char buffer[256];
+            StdReimpl::format_to_n_result<char*> result = StdReimpl::format_to_n(buffer, sizeof(buffer),
+                StdReimpl::runtime_format("[{:<5}] t{:02} #{} {:.3f}ms {}"), r.level, r.thread, r.sequence, r.latencyMs, r.message);
+            DoNotOptimize(result);
+            DoNotOptimize(buffer);
+        }
+    }
+
+    const BenchmarkRegistrar g_RuntimeFormatStdReimpl{"format/log_line_to_n", "StdReimpl_runtime_format", &RuntimeFormatStdReimpl};
+}
@@ -0,0 +1,302 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/functional.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    int AddOne(int x)
+    {
+        return x + 1;
+    }
+
+    //
+    // invoke_r
+    //
+
+    void InvokeRStdReimpl(std::uint64_t iterations)
+    {
+        int (*function)(int) = &AddOne;
+        DoNotOptimize(function);
+
+        int value = 0;
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            value = static_cast<int>(StdReimpl::invoke_r<long>(function, value));
+            DoNotOptimize(value);
+        }
+    }
+
+    void InvokeRStd(std::uint64_t iterations)
+    {
+        int (*function)(int) = &AddOne;
+        DoNotOptimize(function);
+
+        int value = 0;
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+#if defined(__cpp_lib_invoke_r)
+            value = static_cast<int>(std::invoke_r<long>(function, value));
+#else
+            value = static_cast<int>(static_cast<long>(std::invoke(function, value)));
+#endif
+            DoNotOptimize(value);
+        }
+    }
+
+    const BenchmarkRegistrar g_InvokeRStdReimpl{"invoke_r", "StdReimpl", &InvokeRStdReimpl};
+#if defined(__cpp_lib_invoke_r)
+    const BenchmarkRegistrar g_InvokeRStd{"invoke_r", "std", &InvokeRStd};
+#else
+    const BenchmarkRegistrar g_InvokeRStd{"invoke_r", "std::invoke", &InvokeRStd};
+#endif
+
+    //
+    // Calling through each callable wrapper. The wrapper is laundered so that the compiler can't see through it.
+    //
+
+    template <class Wrapper>
+    void CallWrapper(std::uint64_t iterations)
+    {
+        int offset = 1;
+        const auto addOffset = [&offset](int x) { return x + offset; };
+
+        Wrapper wrapper{addOffset};
+        DoNotOptimize(wrapper);
+
+        int value = 0;
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            value = wrapper(value);
+            DoNotOptimize(value);
+        }
+    }
+
+    const BenchmarkRegistrar g_CallFunctionRef{"callable/call", "StdReimpl::function_ref", &CallWrapper<StdReimpl::function_ref<int(int) const>>};
+    const BenchmarkRegistrar g_CallMoveOnlyFunction{"callable/call", "StdReimpl::move_only_function", &CallWrapper<StdReimpl::move_only_function<int(int) const>>};
+    const BenchmarkRegistrar g_CallInplaceFunction{"callable/call", "StdReimpl::inplace_function", &CallWrapper<StdReimpl::inplace_function<int(int) const>>};
+    const BenchmarkRegistrar g_CallStdFunction{"callable/call", "std::function", &CallWrapper<std::function<int(int)>>};
+#if defined(__cpp_lib_function_ref)
+    const BenchmarkRegistrar g_CallStdFunctionRef{"callable/call", "std::function_ref", &CallWrapper<std::function_ref<int(int) const>>};
+#endif
+#if defined(__cpp_lib_move_only_function)
+    const BenchmarkRegistrar g_CallStdMoveOnlyFunction{"callable/call", "std::move_only_function", &CallWrapper<std::move_only_function<int(int) const>>};
+#endif
+
+    //
+    // Constructing and moving an owning wrapper, like pushing a job into a queue.
+    //
+
+    template <class Wrapper>
+    void ConstructSmallCapture(std::uint64_t iterations)
+    {
+        int a = 1;
+        int b = 2;
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            Wrapper wrapper{[&a, &b](int x) { return x + a + b; }};
+            Wrapper moved{std::move(wrapper)};
+            DoNotOptimize(moved);
+        }
+    }
+
+    const BenchmarkRegistrar g_ConstructMoveOnlyFunction{"callable/construct_small_capture", "StdReimpl::move_only_function", &ConstructSmallCapture<StdReimpl::move_only_function<int(int)>>};
+    const BenchmarkRegistrar g_ConstructInplaceFunction{"callable/construct_small_capture", "StdReimpl::inplace_function", &ConstructSmallCapture<StdReimpl::inplace_function<int(int)>>};
+    const BenchmarkRegistrar g_ConstructStdFunction{"callable/construct_small_capture", "std::function", &ConstructSmallCapture<std::function<int(int)>>};
+#if defined(__cpp_lib_move_only_function)
+    const BenchmarkRegistrar g_ConstructStdMoveOnlyFunction{"callable/construct_small_capture", "std::move_only_function", &ConstructSmallCapture<std::move_only_function<int(int)>>};
+#endif
+
+    template <class Wrapper>
+    void ConstructUniquePtrCapture(std::uint64_t iterations)
+    {
+        auto owned = std::make_unique<int>(1);
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            Wrapper wrapper{[p = std::move(owned)]() mutable { return std::move(p); }};
+            Wrapper moved{std::move(wrapper)};
+            owned = moved();
+            DoNotOptimize(owned);
+        }
+    }
+
+    // `std::function` can't hold move-only callables, so there may not be a std counterpart for this one.
+    const BenchmarkRegistrar g_ConstructUniquePtrMoveOnlyFunction{"callable/construct_unique_ptr_capture", "StdReimpl::move_only_function", &ConstructUniquePtrCapture<StdReimpl::move_only_function<std::unique_ptr<int>()>>};
+#if defined(__cpp_lib_move_only_function)
+    const BenchmarkRegistrar g_ConstructUniquePtrStdMoveOnlyFunction{"callable/construct_unique_ptr_capture", "std::move_only_function", &ConstructUniquePtrCapture<std::move_only_function<std::unique_ptr<int>()>>};
+#endif
+
+    //
+    // Searching a megabyte of log text for a pattern that's only at its end, in GB/s. The log lines share most of their
+    // characters with the patterns, as real ones do, so the first and last bytes match often enough to matter.
+    //
+
+    constexpr std::size_t g_HaystackSize = std::size_t{1} << 20;
+
+    constexpr std::string_view g_ShortPattern = "status=503";
+    constexpr std::string_view g_LongPattern =
+        "2025-01-01T00:00:00Z worker-3 ERROR request 99999 failed status=503 upstream=backend-4 reason=connection reset by peer";
+
+    template <const std::string_view* Pattern>
+    const std::string& GetHaystack()
+    {
+        static const std::string haystack = []
+        {
+            std::string result;
+            for (std::uint64_t line = 0; result.size() < g_HaystackSize; ++line)
+            {
+                result += "2025-01-01T00:00:00Z worker-" + std::to_string(line % 16) + " INFO request " + std::to_string(line * 7919 % 100000) +
+                    " completed status=200 upstream=backend-" + std::to_string(line % 5) + "\n";
+            }
+            result.resize(g_HaystackSize - Pattern->size());
+            result += *Pattern;
+            return result;
+        }();
+        return haystack;
+    }
+
+    /**
+     * @brief Runs `search(haystack)` `iterations` times, each returning the offset of the match, and reports GB/s.
+     */
+    template <class Search>
+    void SearchThroughput(std::uint64_t iterations, const std::string& haystack, Search search)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            std::size_t offset = search(std::string_view(haystack));
+            DoNotOptimize(offset);
+        }
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() > 0)
+        {
+            StdReimplBenchmarks::ReportCounter("GB/s", static_cast<double>(haystack.size()) * static_cast<double>(iterations) / elapsed.count());
+        }
+    }
+
+    template <template <class...> class Searcher, const std::string_view* Pattern>
+    void SearchWithSearcher(std::uint64_t iterations)
+    {
+        const Searcher searcher(Pattern->begin(), Pattern->end());
+        SearchThroughput(iterations, GetHaystack<Pattern>(), [&searcher](std::string_view haystack)
+            {
+                return static_cast<std::size_t>(searcher(haystack.begin(), haystack.end()).first - haystack.begin());
+            });
+    }
+
+    template <const std::string_view* Pattern>
+    void SearchFind(std::uint64_t iterations)
+    {
+        SearchThroughput(iterations, GetHaystack<Pattern>(), [](std::string_view haystack) { return haystack.find(*Pattern); });
+    }
+
+#if defined(__GLIBC__) || defined(__APPLE__)
+    template <const std::string_view* Pattern>
+    void SearchMemmem(std::uint64_t iterations)
+    {
+        SearchThroughput(iterations, GetHaystack<Pattern>(), [](std::string_view haystack)
+            {
+                const void* found = memmem(haystack.data(), haystack.size(), Pattern->data(), Pattern->size());
+                return static_cast<std::size_t>(static_cast<const char*>(found) - haystack.data());
+            });
+    }
+#endif
+
+    const BenchmarkRegistrar g_SearchShortDefault{"searcher/1MiB_short_pattern", "StdReimpl::default_searcher", &SearchWithSearcher<StdReimpl::default_searcher, &g_ShortPattern>};
+    const BenchmarkRegistrar g_SearchShortHorspool{"searcher/1MiB_short_pattern", "StdReimpl::boyer_moore_horspool_searcher", &SearchWithSearcher<StdReimpl::boyer_moore_horspool_searcher, &g_ShortPattern>};
+    const BenchmarkRegistrar g_SearchShortStdHorspool{"searcher/1MiB_short_pattern", "std::boyer_moore_horspool_searcher", &SearchWithSearcher<std::boyer_moore_horspool_searcher, &g_ShortPattern>};
+    const BenchmarkRegistrar g_SearchShortFind{"searcher/1MiB_short_pattern", "std::string_view::find", &SearchFind<&g_ShortPattern>};
+    const BenchmarkRegistrar g_SearchLongDefault{"searcher/1MiB_long_pattern", "StdReimpl::default_searcher", &SearchWithSearcher<StdReimpl::default_searcher, &g_LongPattern>};
+    const BenchmarkRegistrar g_SearchLongBoyerMoore{"searcher/1MiB_long_pattern", "StdReimpl::boyer_moore_searcher", &SearchWithSearcher<StdReimpl::boyer_moore_searcher, &g_LongPattern>};
+    const BenchmarkRegistrar g_SearchLongHorspool{"searcher/1MiB_long_pattern", "StdReimpl::boyer_moore_horspool_searcher", &SearchWithSearcher<StdReimpl::boyer_moore_horspool_searcher, &g_LongPattern>};
+    const BenchmarkRegistrar g_SearchLongStdBoyerMoore{"searcher/1MiB_long_pattern", "std::boyer_moore_searcher", &SearchWithSearcher<std::boyer_moore_searcher, &g_LongPattern>};
+    const BenchmarkRegistrar g_SearchLongStdHorspool{"searcher/1MiB_long_pattern", "std::boyer_moore_horspool_searcher", &SearchWithSearcher<std::boyer_moore_horspool_searcher, &g_LongPattern>};
+    const BenchmarkRegistrar g_SearchLongFind{"searcher/1MiB_long_pattern", "std::string_view::find", &SearchFind<&g_LongPattern>};
+#if defined(__GLIBC__) || defined(__APPLE__)
+    const BenchmarkRegistrar g_SearchShortMemmem{"searcher/1MiB_short_pattern", "memmem", &SearchMemmem<&g_ShortPattern>};
+    const BenchmarkRegistrar g_SearchLongMemmem{"searcher/1MiB_long_pattern", "memmem", &SearchMemmem<&g_LongPattern>};
+#endif
+
+    //
+    // A frame's worth of member functions bound into callbacks. The callbacks are laundered each frame, as if they were
+    // read out of a subscriber list, so a stored pointer to member has to be loaded and called through every time.
+    //
+
+    struct Particle
+    {
+        float position = 0.0f;
+        float velocity = 1.0f;
+
+        void Update(float dt)
+        {
+            position += velocity * dt;
+        }
+    };
+
+    constexpr std::size_t g_ParticleCount = 1024;
+
+    auto BindUpdateStdReimplConstant(Particle* particle)
+    {
+        return StdReimpl::bind_front<&Particle::Update>(particle);
+    }
+
+    auto BindUpdateStdReimpl(Particle* particle)
+    {
+        return StdReimpl::bind_front(&Particle::Update, particle);
+    }
+
+    auto BindUpdateStd(Particle* particle)
+    {
+        return std::bind_front(&Particle::Update, particle);
+    }
+
+    auto BindUpdateLambda(Particle* particle)
+    {
+        return [particle](float dt) { particle->Update(dt); };
+    }
+
+    template <auto Bind>
+    void CallBoundMembers(std::uint64_t iterations)
+    {
+        std::vector<Particle> particles(g_ParticleCount);
+        std::vector<decltype(Bind(nullptr))> callbacks;
+        callbacks.reserve(g_ParticleCount);
+        for (Particle& particle : particles)
+        {
+            callbacks.push_back(Bind(&particle));
+        }
+
+        for (std::uint64_t i = 0; i < iterations; i += g_ParticleCount)
+        {
+            DoNotOptimize(*callbacks.data());
+            for (auto& callback : callbacks)
+            {
+                callback(0.016f);
+            }
+        }
+        DoNotOptimize(*particles.data());
+        StdReimplBenchmarks::ReportCounter("bytes_per_callback", static_cast<double>(sizeof(callbacks[0])));
+    }
+
+    const BenchmarkRegistrar g_CallBoundStdReimplConstant{"bind_front/member_callback", "StdReimpl::bind_front<f>", &CallBoundMembers<&BindUpdateStdReimplConstant>};
+    const BenchmarkRegistrar g_CallBoundStdReimpl{"bind_front/member_callback", "StdReimpl::bind_front", &CallBoundMembers<&BindUpdateStdReimpl>};
+    const BenchmarkRegistrar g_CallBoundStd{"bind_front/member_callback", "std::bind_front", &CallBoundMembers<&BindUpdateStd>};
+    const BenchmarkRegistrar g_CallBoundLambda{"bind_front/member_callback", "lambda", &CallBoundMembers<&BindUpdateLambda>};
+}
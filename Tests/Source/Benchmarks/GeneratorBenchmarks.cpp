@@ -0,0 +1,197 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/generator.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#if defined(__has_include)
+#   if __has_include(<generator>)
+#       include <generator>
+#   endif
+#endif
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    constexpr int Depth = 32;
+
+    //
+    // Iterating a chain of nested generators, each of which yields a value before and after the one it nests.
+    //
+
+    StdReimpl::generator<int> NestedStdReimpl(int depth)
+    {
+        co_yield depth;
+        if (depth > 0)
+        {
+            co_yield StdReimpl::ranges::elements_of(NestedStdReimpl(depth - 1));
+        }
+        co_yield -depth;
+    }
+
+    // Without elements_of, each element is passed up through every generator above it.
+    StdReimpl::generator<int> NestedReyield(int depth)
+    {
+        co_yield depth;
+        if (depth > 0)
+        {
+            for (int i : NestedReyield(depth - 1))
+            {
+                co_yield i;
+            }
+        }
+        co_yield -depth;
+    }
+
+    void NestedElementsOf(std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            int sum = 0;
+            for (int value : NestedStdReimpl(Depth))
+            {
+                sum += value;
+            }
+            DoNotOptimize(sum);
+        }
+    }
+
+    void NestedReyieldEach(std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            int sum = 0;
+            for (int value : NestedReyield(Depth))
+            {
+                sum += value;
+            }
+            DoNotOptimize(sum);
+        }
+    }
+
+    const BenchmarkRegistrar g_NestedElementsOf{"generator/nested", "StdReimpl", &NestedElementsOf};
+    const BenchmarkRegistrar g_NestedReyieldEach{"generator/nested", "re-yield", &NestedReyieldEach};
+
+#if defined(__cpp_lib_generator)
+    std::generator<int> NestedStd(int depth)
+    {
+        co_yield depth;
+        if (depth > 0)
+        {
+            co_yield std::ranges::elements_of(NestedStd(depth - 1));
+        }
+        co_yield -depth;
+    }
+
+    void NestedElementsOfStd(std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            int sum = 0;
+            for (int value : NestedStd(Depth))
+            {
+                sum += value;
+            }
+            DoNotOptimize(sum);
+        }
+    }
+
+    const BenchmarkRegistrar g_NestedElementsOfStd{"generator/nested", "std", &NestedElementsOfStd};
+#endif
+
+    //
+    // Creating and running a short generator, whose frame comes from the global heap or from an arena.
+    //
+
+    // Hands out memory from a fixed buffer, and frees all of it at once.
+    struct Arena
+    {
+        alignas(std::max_align_t) std::byte buffer[4096];
+        std::size_t used = 0;
+    };
+
+    template <class T>
+    struct ArenaAllocator
+    {
+        using value_type = T;
+
+        Arena* arena;
+
+        explicit ArenaAllocator(Arena* inArena) noexcept
+            : arena(inArena)
+        {
+        }
+
+        template <class U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+            : arena(other.arena)
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            T* result = reinterpret_cast<T*>(arena->buffer + arena->used);
+            arena->used += (n * sizeof(T) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+            return result;
+        }
+
+        void deallocate(T*, std::size_t) noexcept
+        {
+        }
+
+        template <class U>
+        bool operator==(const ArenaAllocator<U>& other) const noexcept
+        {
+            return arena == other.arena;
+        }
+    };
+
+    StdReimpl::generator<int> PairHeap(int x)
+    {
+        co_yield x;
+        co_yield x + 1;
+    }
+
+    StdReimpl::generator<int, void, ArenaAllocator<std::byte>> PairArena(std::allocator_arg_t, ArenaAllocator<std::byte>, int x)
+    {
+        co_yield x;
+        co_yield x + 1;
+    }
+
+    void AllocateHeap(std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            int sum = 0;
+            for (int value : PairHeap(static_cast<int>(i)))
+            {
+                sum += value;
+            }
+            DoNotOptimize(sum);
+        }
+    }
+
+    void AllocateArena(std::uint64_t iterations)
+    {
+        static Arena arena;
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            arena.used = 0;
+            int sum = 0;
+            for (int value : PairArena(std::allocator_arg, ArenaAllocator<std::byte>(&arena), static_cast<int>(i)))
+            {
+                sum += value;
+            }
+            DoNotOptimize(sum);
+        }
+    }
+
+    const BenchmarkRegistrar g_AllocateHeap{"generator/allocate", "StdReimpl heap", &AllocateHeap};
+    const BenchmarkRegistrar g_AllocateArena{"generator/allocate", "StdReimpl arena", &AllocateArena};
+}
@@ -0,0 +1,192 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/hive.h>
+
+#include <cstdint>
+#include <list>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    // How many particles are alive, whatever the erase density.
+    constexpr std::size_t g_LiveCount = 10000;
+
+    struct Particle
+    {
+        float position[3];
+        float velocity[3];
+        float lifetime;
+        std::uint32_t id;
+    };
+
+    using ParticleHive = StdReimpl::hive<Particle>;
+    using ParticleList = std::list<Particle>;
+
+    // Erases by moving its last particle into the hole, which keeps it dense, but moves a particle that something else
+    // may have been pointing at. What a hive is meant to replace, along with `std::list`.
+    using ParticleVector = std::vector<Particle>;
+
+    Particle MakeParticle(std::uint64_t i)
+    {
+        const float f = static_cast<float>(i % 1024);
+        return Particle{{f, f + 1.0f, f + 2.0f}, {0.5f, -0.25f, 0.125f}, 10.0f, static_cast<std::uint32_t>(i)};
+    }
+
+    /**
+     * @brief A pseudo-random index below `n`, from the same sequence for every container.
+     */
+    std::size_t NextIndex(std::uint64_t& state, std::size_t n)
+    {
+        state = state * 6364136223846793005u + 1442695040888963407u;
+        return static_cast<std::size_t>((state >> 33) % n);
+    }
+
+    /**
+     * @brief A container of particles, and iterators to them for erasing at random, as a pool of particles whose
+     *        handles are kept elsewhere would have.
+     */
+    template <class Container>
+    struct Pool
+    {
+        Container particles;
+        std::vector<typename Container::iterator> handles;
+        std::uint64_t randomState = 1;
+        std::uint64_t nextId = 0;
+
+        void Insert()
+        {
+            // A hive puts it wherever it likes and ignores the hint, the others append.
+            const auto position = particles.insert(particles.end(), MakeParticle(nextId++));
+            if constexpr (!std::is_same_v<Container, ParticleVector>)
+            {
+                handles.push_back(position);
+            }
+        }
+
+        void EraseRandom()
+        {
+            if constexpr (std::is_same_v<Container, ParticleVector>)
+            {
+                const std::size_t index = NextIndex(randomState, particles.size());
+                particles[index] = particles.back();
+                particles.pop_back();
+            }
+            else
+            {
+                const std::size_t index = NextIndex(randomState, handles.size());
+                particles.erase(handles[index]);
+                handles[index] = handles.back();
+                handles.pop_back();
+            }
+        }
+    };
+
+    /**
+     * @brief `g_LiveCount` particles, which are what's left of inserting more and erasing `erasedPercent` percent of
+     *        them at random.
+     */
+    template <class Container>
+    Pool<Container> MakePool(std::size_t erasedPercent)
+    {
+        Pool<Container> pool;
+        const std::size_t insertedCount = g_LiveCount * 100 / (100 - erasedPercent);
+        for (std::size_t i = 0; i < insertedCount; ++i)
+        {
+            pool.Insert();
+        }
+        for (std::size_t i = g_LiveCount; i < insertedCount; ++i)
+        {
+            pool.EraseRandom();
+        }
+        return pool;
+    }
+
+    /**
+     * @brief Moves every particle once, as a particle system's update does each frame.
+     */
+    template <class Container, int ErasedPercent>
+    void Iterate(std::uint64_t iterations)
+    {
+        // Built once per benchmark, outside of the measured loop. Moving the pool keeps its handles valid.
+        static Pool<Container> s_Pool = MakePool<Container>(ErasedPercent);
+        Container& particles = s_Pool.particles;
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            for (Particle& particle : particles)
+            {
+                particle.position[0] += particle.velocity[0];
+                particle.position[1] += particle.velocity[1];
+                particle.position[2] += particle.velocity[2];
+            }
+            DoNotOptimize(particles);
+        }
+    }
+
+    /**
+     * @brief Erases `ErasedPercent` percent of the particles at random, then inserts as many new ones, as a pool that
+     *        churns every frame does.
+     */
+    template <class Container, int ErasedPercent>
+    void EraseInsert(std::uint64_t iterations)
+    {
+        static Pool<Container> s_Pool = MakePool<Container>(0);
+        Pool<Container>& pool = s_Pool;
+        const std::size_t churnedCount = g_LiveCount * ErasedPercent / 100;
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            for (std::size_t j = 0; j < churnedCount; ++j)
+            {
+                pool.EraseRandom();
+            }
+            for (std::size_t j = 0; j < churnedCount; ++j)
+            {
+                pool.Insert();
+            }
+            DoNotOptimize(pool.particles);
+        }
+    }
+
+    /**
+     * @brief Fills an empty container with `g_LiveCount` particles, allocating as it goes.
+     */
+    template <class Container>
+    void InsertIntoEmpty(std::uint64_t iterations)
+    {
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            Container particles;
+            for (std::uint64_t j = 0; j < g_LiveCount; ++j)
+            {
+                particles.insert(particles.end(), MakeParticle(j));
+            }
+            DoNotOptimize(particles);
+        }
+    }
+
+#define MY_REGISTER_HIVE_BENCHMARKS(Name, Function, Percent) \
+    const BenchmarkRegistrar g_##Function##Percent##StdReimpl{Name, "StdReimpl", &Function<ParticleHive, Percent>}; \
+    const BenchmarkRegistrar g_##Function##Percent##List{Name, "std::list", &Function<ParticleList, Percent>}; \
+    const BenchmarkRegistrar g_##Function##Percent##Vector{Name, "std::vector (swap and pop)", &Function<ParticleVector, Percent>};
+
+    MY_REGISTER_HIVE_BENCHMARKS("hive/iterate 10000, 0% erased", Iterate, 0)
+    MY_REGISTER_HIVE_BENCHMARKS("hive/iterate 10000, 25% erased", Iterate, 25)
+    MY_REGISTER_HIVE_BENCHMARKS("hive/iterate 10000, 50% erased", Iterate, 50)
+    MY_REGISTER_HIVE_BENCHMARKS("hive/iterate 10000, 90% erased", Iterate, 90)
+    MY_REGISTER_HIVE_BENCHMARKS("hive/erase+insert 10% of 10000", EraseInsert, 10)
+    MY_REGISTER_HIVE_BENCHMARKS("hive/erase+insert 50% of 10000", EraseInsert, 50)
+    MY_REGISTER_HIVE_BENCHMARKS("hive/erase+insert 90% of 10000", EraseInsert, 90)
+
+    const BenchmarkRegistrar g_InsertIntoEmptyStdReimpl{"hive/insert 10000 into empty", "StdReimpl", &InsertIntoEmpty<ParticleHive>};
+    const BenchmarkRegistrar g_InsertIntoEmptyList{"hive/insert 10000 into empty", "std::list", &InsertIntoEmpty<ParticleList>};
+    const BenchmarkRegistrar g_InsertIntoEmptyVector{"hive/insert 10000 into empty", "std::vector", &InsertIntoEmpty<ParticleVector>};
+
+#undef MY_REGISTER_HIVE_BENCHMARKS
+}
@@ -0,0 +1,142 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/inplace_vector.h>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<boost/container/static_vector.hpp>)
+#include <boost/container/static_vector.hpp>
+#define CPPUTILS_STDREIMPL_BENCHMARK_HAS_BOOST_STATIC_VECTOR 1
+#endif
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    constexpr std::size_t g_SmallCapacity = 16;
+
+    /**
+     * @brief Makes each kind of container empty with room for `g_SmallCapacity` elements. For `std::vector` that's a
+     *        `reserve`, which is the heap traffic we're comparing against.
+     */
+    template <class Container>
+    Container MakeEmpty()
+    {
+        Container container;
+        container.reserve(g_SmallCapacity);
+        return container;
+    }
+
+    template <class T>
+    T MakeValue(std::uint64_t i)
+    {
+        if constexpr (std::is_same_v<T, std::string>)
+        {
+            return std::string(1, static_cast<char>('a' + (i % 26)));
+        }
+        else
+        {
+            return static_cast<T>(i);
+        }
+    }
+
+    /**
+     * @brief Builds a container of `g_SmallCapacity` elements from scratch, as a per-frame, per-entity array would.
+     */
+    template <class Container>
+    void PushBack(std::uint64_t iterations)
+    {
+        using T = typename Container::value_type;
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            Container container = MakeEmpty<Container>();
+            for (std::size_t j = 0; j < g_SmallCapacity; ++j)
+            {
+                container.push_back(MakeValue<T>(i + j));
+            }
+            DoNotOptimize(container);
+        }
+    }
+
+    /**
+     * @brief Inserts every element at the front, so every insert shifts the whole tail.
+     */
+    template <class Container>
+    void InsertFront(std::uint64_t iterations)
+    {
+        using T = typename Container::value_type;
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            Container container = MakeEmpty<Container>();
+            for (std::size_t j = 0; j < g_SmallCapacity; ++j)
+            {
+                container.insert(container.begin(), MakeValue<T>(i + j));
+            }
+            DoNotOptimize(container);
+        }
+    }
+
+    /**
+     * @brief Copies a full container, then erases from the middle until it's empty.
+     */
+    template <class Container>
+    void CopyThenErase(std::uint64_t iterations)
+    {
+        using T = typename Container::value_type;
+
+        Container source = MakeEmpty<Container>();
+        for (std::size_t j = 0; j < g_SmallCapacity; ++j)
+        {
+            source.push_back(MakeValue<T>(j));
+        }
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(source);
+            Container container = source;
+            while (!container.empty())
+            {
+                container.erase(container.begin() + static_cast<std::ptrdiff_t>(container.size() / 2));
+            }
+            DoNotOptimize(container);
+        }
+    }
+
+    template <class T>
+    using InplaceVector = StdReimpl::inplace_vector<T, g_SmallCapacity>;
+
+#if defined(CPPUTILS_STDREIMPL_BENCHMARK_HAS_BOOST_STATIC_VECTOR)
+    template <class T>
+    using BoostStaticVector = boost::container::static_vector<T, g_SmallCapacity>;
+#endif
+
+#if defined(CPPUTILS_STDREIMPL_BENCHMARK_HAS_BOOST_STATIC_VECTOR)
+#define MY_REGISTER_INPLACE_VECTOR_BENCHMARKS(Name, Function, Type) \
+    const BenchmarkRegistrar g_##Function##Type##StdReimpl{Name, "StdReimpl", &Function<InplaceVector<Type>>}; \
+    const BenchmarkRegistrar g_##Function##Type##Std{Name, "std::vector (reserved)", &Function<std::vector<Type>>}; \
+    const BenchmarkRegistrar g_##Function##Type##Boost{Name, "boost::static_vector", &Function<BoostStaticVector<Type>>};
+#else
+#define MY_REGISTER_INPLACE_VECTOR_BENCHMARKS(Name, Function, Type) \
+    const BenchmarkRegistrar g_##Function##Type##StdReimpl{Name, "StdReimpl", &Function<InplaceVector<Type>>}; \
+    const BenchmarkRegistrar g_##Function##Type##Std{Name, "std::vector (reserved)", &Function<std::vector<Type>>};
+#endif
+
+    using String = std::string;
+
+    MY_REGISTER_INPLACE_VECTOR_BENCHMARKS("inplace_vector/push_back x16/int", PushBack, int)
+    MY_REGISTER_INPLACE_VECTOR_BENCHMARKS("inplace_vector/push_back x16/string", PushBack, String)
+    MY_REGISTER_INPLACE_VECTOR_BENCHMARKS("inplace_vector/insert front x16/int", InsertFront, int)
+    MY_REGISTER_INPLACE_VECTOR_BENCHMARKS("inplace_vector/insert front x16/string", InsertFront, String)
+    MY_REGISTER_INPLACE_VECTOR_BENCHMARKS("inplace_vector/copy, erase middle x16/int", CopyThenErase, int)
+    MY_REGISTER_INPLACE_VECTOR_BENCHMARKS("inplace_vector/copy, erase middle x16/string", CopyThenErase, String)
+
+#undef MY_REGISTER_INPLACE_VECTOR_BENCHMARKS
+}
@@ -0,0 +1,193 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/mdspan.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__has_include)
+#   if __has_include(<mdspan>)
+#       include <mdspan>
+#   endif
+#endif
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    constexpr std::size_t Rows = 64;
+    constexpr std::size_t Columns = 64;
+
+    float* GetMatrix()
+    {
+        alignas(64) static float matrix[Rows * Columns] = {};
+        return matrix;
+    }
+
+    std::size_t GetDynamicColumns()
+    {
+        static std::size_t columns = Columns;
+        DoNotOptimize(columns);
+        return columns;
+    }
+
+    //
+    // Summing a matrix with static extents. The mdspan's index math should compile down to the hand-written loop's.
+    //
+
+    void SumStaticHandWritten(std::uint64_t iterations)
+    {
+        const float* matrix = GetMatrix();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(matrix);
+            float sum = 0.0f;
+            for (std::size_t row = 0; row < Rows; ++row)
+            {
+                for (std::size_t column = 0; column < Columns; ++column)
+                {
+                    sum += matrix[row * Columns + column];
+                }
+            }
+            DoNotOptimize(sum);
+        }
+    }
+
+    void SumStaticStdReimpl(std::uint64_t iterations)
+    {
+        const float* matrix = GetMatrix();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(matrix);
+            const StdReimpl::mdspan<const float, StdReimpl::extents<std::size_t, Rows, Columns>> view(matrix);
+            float sum = 0.0f;
+            for (std::size_t row = 0; row < view.extent(0); ++row)
+            {
+                for (std::size_t column = 0; column < view.extent(1); ++column)
+                {
+                    sum += view(row, column);
+                }
+            }
+            DoNotOptimize(sum);
+        }
+    }
+
+    void SumStaticStdReimplAligned(std::uint64_t iterations)
+    {
+        using Accessor = StdReimpl::aligned_accessor<const float, 64>;
+
+        const float* matrix = GetMatrix();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(matrix);
+            const StdReimpl::mdspan<const float, StdReimpl::extents<std::size_t, Rows, Columns>, StdReimpl::layout_right, Accessor>
+                view(matrix, {}, Accessor());
+            float sum = 0.0f;
+            for (std::size_t row = 0; row < view.extent(0); ++row)
+            {
+                for (std::size_t column = 0; column < view.extent(1); ++column)
+                {
+                    sum += view(row, column);
+                }
+            }
+            DoNotOptimize(sum);
+        }
+    }
+
+    const BenchmarkRegistrar g_SumStaticHandWritten{"mdspan/sum_static", "hand-written", &SumStaticHandWritten};
+    const BenchmarkRegistrar g_SumStaticStdReimpl{"mdspan/sum_static", "StdReimpl", &SumStaticStdReimpl};
+    const BenchmarkRegistrar g_SumStaticStdReimplAligned{"mdspan/sum_static", "StdReimpl aligned", &SumStaticStdReimplAligned};
+
+    //
+    // Summing a matrix whose column count is only known at runtime.
+    //
+
+    void SumDynamicHandWritten(std::uint64_t iterations)
+    {
+        const float* matrix = GetMatrix();
+        const std::size_t columns = GetDynamicColumns();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(matrix);
+            float sum = 0.0f;
+            for (std::size_t row = 0; row < Rows; ++row)
+            {
+                for (std::size_t column = 0; column < columns; ++column)
+                {
+                    sum += matrix[row * columns + column];
+                }
+            }
+            DoNotOptimize(sum);
+        }
+    }
+
+    void SumDynamicStdReimpl(std::uint64_t iterations)
+    {
+        const float* matrix = GetMatrix();
+        const std::size_t columns = GetDynamicColumns();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(matrix);
+            const StdReimpl::mdspan<const float, StdReimpl::extents<std::size_t, Rows, StdReimpl::dynamic_extent>> view(matrix, columns);
+            float sum = 0.0f;
+            for (std::size_t row = 0; row < view.extent(0); ++row)
+            {
+                for (std::size_t column = 0; column < view.extent(1); ++column)
+                {
+                    sum += view(row, column);
+                }
+            }
+            DoNotOptimize(sum);
+        }
+    }
+
+    const BenchmarkRegistrar g_SumDynamicHandWritten{"mdspan/sum_dynamic", "hand-written", &SumDynamicHandWritten};
+    const BenchmarkRegistrar g_SumDynamicStdReimpl{"mdspan/sum_dynamic", "StdReimpl", &SumDynamicStdReimpl};
+
+#if defined(__cpp_lib_mdspan)
+    void SumStaticStd(std::uint64_t iterations)
+    {
+        const float* matrix = GetMatrix();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(matrix);
+            const std::mdspan<const float, std::extents<std::size_t, Rows, Columns>> view(matrix);
+            float sum = 0.0f;
+            for (std::size_t row = 0; row < view.extent(0); ++row)
+            {
+                for (std::size_t column = 0; column < view.extent(1); ++column)
+                {
+                    sum += view[row, column];
+                }
+            }
+            DoNotOptimize(sum);
+        }
+    }
+
+    void SumDynamicStd(std::uint64_t iterations)
+    {
+        const float* matrix = GetMatrix();
+        const std::size_t columns = GetDynamicColumns();
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(matrix);
+            const std::mdspan<const float, std::extents<std::size_t, Rows, std::dynamic_extent>> view(matrix, columns);
+            float sum = 0.0f;
+            for (std::size_t row = 0; row < view.extent(0); ++row)
+            {
+                for (std::size_t column = 0; column < view.extent(1); ++column)
+                {
+                    sum += view[row, column];
+                }
+            }
+            DoNotOptimize(sum);
+        }
+    }
+
+    const BenchmarkRegistrar g_SumStaticStd{"mdspan/sum_static", "std", &SumStaticStd};
+    const BenchmarkRegistrar g_SumDynamicStd{"mdspan/sum_dynamic", "std", &SumDynamicStd};
+#endif
+}
@@ -0,0 +1,205 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/memory_resource.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__has_include)
+#   if __has_include(<memory_resource>)
+#       include <memory_resource>
+#   endif
+#endif
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    //
+    // Allocating and freeing blocks of mixed sizes from a shared resource on 1 to 64 threads at once. Each operation is
+    // one allocation and one deallocation, so the time per operation shows how well a resource scales: it stays flat when
+    // threads don't contend, and grows with the thread count when they do.
+    //
+
+    // How many blocks each thread keeps alive, so that frees don't simply undo the previous allocation.
+    constexpr std::size_t LiveBlocks = 64;
+
+    constexpr std::array<std::size_t, 8> BlockSizes = {16, 24, 32, 48, 64, 96, 128, 256};
+
+    template <class Resource>
+    void AllocateOnThread(Resource& resource, std::uint64_t operations)
+    {
+        std::array<void*, LiveBlocks> blocks{};
+        std::array<std::size_t, LiveBlocks> sizes{};
+
+        for (std::uint64_t i = 0; i < operations; ++i)
+        {
+            const std::size_t slot = static_cast<std::size_t>(i % LiveBlocks);
+            if (blocks[slot] != nullptr)
+            {
+                resource.deallocate(blocks[slot], sizes[slot]);
+            }
+
+            sizes[slot] = BlockSizes[static_cast<std::size_t>((i * 7) % BlockSizes.size())];
+            blocks[slot] = resource.allocate(sizes[slot]);
+            DoNotOptimize(blocks[slot]);
+        }
+
+        for (std::size_t slot = 0; slot < LiveBlocks; ++slot)
+        {
+            if (blocks[slot] != nullptr)
+            {
+                resource.deallocate(blocks[slot], sizes[slot]);
+            }
+        }
+    }
+
+    template <class Resource>
+    void AllocateOnThreads(Resource& resource, int threadCount, std::uint64_t iterations)
+    {
+        const std::uint64_t operationsPerThread = (iterations + static_cast<std::uint64_t>(threadCount) - 1) / static_cast<std::uint64_t>(threadCount);
+
+        std::vector<std::thread> threads;
+        threads.reserve(static_cast<std::size_t>(threadCount));
+        for (int i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back([&resource, operationsPerThread]() { AllocateOnThread(resource, operationsPerThread); });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    // Goes straight to the global `operator new` and `operator delete`, as a baseline.
+    struct NewDeleteResource
+    {
+        void* allocate(std::size_t bytes)
+        {
+            return ::operator new(bytes);
+        }
+
+        void deallocate(void* p, std::size_t bytes)
+        {
+            ::operator delete(p, bytes);
+        }
+    };
+
+    template <int ThreadCount>
+    void AllocateStdReimpl(std::uint64_t iterations)
+    {
+        StdReimpl::pmr::synchronized_pool_resource resource;
+        AllocateOnThreads(resource, ThreadCount, iterations);
+    }
+
+    template <int ThreadCount>
+    void AllocateNewDelete(std::uint64_t iterations)
+    {
+        NewDeleteResource resource;
+        AllocateOnThreads(resource, ThreadCount, iterations);
+    }
+
+#if defined(__cpp_lib_memory_resource)
+    template <int ThreadCount>
+    void AllocateStd(std::uint64_t iterations)
+    {
+        std::pmr::synchronized_pool_resource resource;
+        AllocateOnThreads(resource, ThreadCount, iterations);
+    }
+#endif
+
+    template <int ThreadCount>
+    void RegisterThreadCount()
+    {
+        // Zero-padded, so that the groups sort by thread count.
+        const std::string group = "synchronized_pool_resource/threads_" + std::string(ThreadCount < 10 ? "0" : "") + std::to_string(ThreadCount);
+
+        StdReimplBenchmarks::RegisterBenchmark({group, "StdReimpl", &AllocateStdReimpl<ThreadCount>});
+#if defined(__cpp_lib_memory_resource)
+        StdReimplBenchmarks::RegisterBenchmark({group, "std", &AllocateStd<ThreadCount>});
+#endif
+        StdReimplBenchmarks::RegisterBenchmark({group, "new/delete", &AllocateNewDelete<ThreadCount>});
+    }
+
+    const bool g_ThreadCountsRegistered = []()
+    {
+        RegisterThreadCount<1>();
+        RegisterThreadCount<2>();
+        RegisterThreadCount<4>();
+        RegisterThreadCount<8>();
+        RegisterThreadCount<16>();
+        RegisterThreadCount<32>();
+        RegisterThreadCount<64>();
+        return true;
+    }();
+
+    //
+    // Per-frame allocations from an arena that is reset at the end of each frame, against the global heap.
+    //
+
+    constexpr std::size_t FrameAllocations = 256;
+
+    void FrameMonotonic(std::uint64_t iterations)
+    {
+        alignas(std::max_align_t) static std::byte buffer[FrameAllocations * 128];
+        StdReimpl::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), StdReimpl::pmr::null_memory_resource());
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            for (std::size_t j = 0; j < FrameAllocations; ++j)
+            {
+                void* p = arena.allocate(BlockSizes[j % BlockSizes.size()]);
+                DoNotOptimize(p);
+            }
+            arena.release();
+        }
+    }
+
+    void FrameNewDelete(std::uint64_t iterations)
+    {
+        std::array<void*, FrameAllocations> blocks{};
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            for (std::size_t j = 0; j < FrameAllocations; ++j)
+            {
+                blocks[j] = ::operator new(BlockSizes[j % BlockSizes.size()]);
+                DoNotOptimize(blocks[j]);
+            }
+            for (std::size_t j = 0; j < FrameAllocations; ++j)
+            {
+                ::operator delete(blocks[j], BlockSizes[j % BlockSizes.size()]);
+            }
+        }
+    }
+
+    const BenchmarkRegistrar g_FrameMonotonic{"monotonic_buffer_resource/frame", "StdReimpl", &FrameMonotonic};
+    const BenchmarkRegistrar g_FrameNewDelete{"monotonic_buffer_resource/frame", "new/delete", &FrameNewDelete};
+
+#if defined(__cpp_lib_memory_resource)
+    void FrameMonotonicStd(std::uint64_t iterations)
+    {
+        alignas(std::max_align_t) static std::byte buffer[FrameAllocations * 128];
+        std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            for (std::size_t j = 0; j < FrameAllocations; ++j)
+            {
+                void* p = arena.allocate(BlockSizes[j % BlockSizes.size()]);
+                DoNotOptimize(p);
+            }
+            arena.release();
+        }
+    }
+
+    const BenchmarkRegistrar g_FrameMonotonicStd{"monotonic_buffer_resource/frame", "std", &FrameMonotonicStd};
+#endif
+}
@@ -0,0 +1,88 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/semaphore.h>
+
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#if defined(__has_include)
+#   if __has_include(<semaphore>)
+#       include <semaphore>
+#   endif
+#endif
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    //
+    // Acquiring and releasing a semaphore that no other thread touches, which should cost one read-modify-write each.
+    //
+
+    template <class Semaphore>
+    void Uncontended(std::uint64_t iterations)
+    {
+        Semaphore semaphore(1);
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            semaphore.acquire();
+            DoNotOptimize(semaphore);
+            semaphore.release();
+        }
+    }
+
+    void UncontendedMutex(std::uint64_t iterations)
+    {
+        std::mutex mutex;
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            mutex.lock();
+            DoNotOptimize(mutex);
+            mutex.unlock();
+        }
+    }
+
+    const BenchmarkRegistrar g_UncontendedStdReimpl{"binary_semaphore/uncontended", "StdReimpl", &Uncontended<StdReimpl::binary_semaphore>};
+    const BenchmarkRegistrar g_UncontendedMutex{"binary_semaphore/uncontended", "mutex", &UncontendedMutex};
+
+#if defined(__cpp_lib_semaphore)
+    const BenchmarkRegistrar g_UncontendedStd{"binary_semaphore/uncontended", "std", &Uncontended<std::binary_semaphore>};
+#endif
+
+    //
+    // Two threads signaling each other in turn, so that every operation is a round trip with two wake-ups.
+    //
+
+    template <class Semaphore>
+    void PingPong(std::uint64_t iterations)
+    {
+        Semaphore ping(0);
+        Semaphore pong(0);
+
+        std::thread partner([&ping, &pong, iterations]()
+        {
+            for (std::uint64_t i = 0; i < iterations; ++i)
+            {
+                ping.acquire();
+                pong.release();
+            }
+        });
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            ping.release();
+            pong.acquire();
+        }
+        partner.join();
+    }
+
+    const BenchmarkRegistrar g_PingPongStdReimpl{"binary_semaphore/ping_pong", "StdReimpl", &PingPong<StdReimpl::binary_semaphore>};
+
+#if defined(__cpp_lib_semaphore)
+    const BenchmarkRegistrar g_PingPongStd{"binary_semaphore/ping_pong", "std", &PingPong<std::binary_semaphore>};
+#endif
+}
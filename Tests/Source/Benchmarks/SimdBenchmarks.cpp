@@ -0,0 +1,218 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/simd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if __has_include(<experimental/simd>)
+#   include <experimental/simd>
+#   define CPPUTILS_STDREIMPL_BENCHMARK_EXPERIMENTAL_SIMD 1
+#endif
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::ClobberMemory;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    // Each operation streams over this many floats, which fit in the L1 cache, so that we measure throughput rather than
+    // memory bandwidth.
+    constexpr std::size_t g_Count = 4096;
+
+    std::vector<float> MakeValues(float scale)
+    {
+        std::vector<float> values(g_Count);
+        for (std::size_t i = 0; i < g_Count; ++i)
+        {
+            values[i] = static_cast<float>(static_cast<int>(i % 101) - 50) * scale;
+        }
+        return values;
+    }
+
+    //
+    // saxpy: y = a * x + y
+    //
+
+    void SaxpyStdReimpl(std::uint64_t iterations)
+    {
+        using V = StdReimpl::native_simd<float>;
+        const std::vector<float> x = MakeValues(0.5f);
+        std::vector<float> y = MakeValues(0.25f);
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const V a(1.0001f);
+            for (std::size_t j = 0; j < g_Count; j += V::size())
+            {
+                const V result = a * V(x.data() + j, StdReimpl::element_aligned) + V(y.data() + j, StdReimpl::element_aligned);
+                result.copy_to(y.data() + j, StdReimpl::element_aligned);
+            }
+            ClobberMemory();
+        }
+        DoNotOptimize(y);
+    }
+
+    void SaxpyScalar(std::uint64_t iterations)
+    {
+        const std::vector<float> x = MakeValues(0.5f);
+        std::vector<float> y = MakeValues(0.25f);
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            for (std::size_t j = 0; j < g_Count; ++j)
+            {
+                y[j] = 1.0001f * x[j] + y[j];
+            }
+            ClobberMemory();
+        }
+        DoNotOptimize(y);
+    }
+
+    const BenchmarkRegistrar g_SaxpyStdReimpl{"simd/saxpy", "StdReimpl", &SaxpyStdReimpl};
+    const BenchmarkRegistrar g_SaxpyScalar{"simd/saxpy", "scalar_loop", &SaxpyScalar};
+
+    //
+    // Sum: a horizontal reduction at the end of a vertical accumulation. The scalar loop can't be vectorized without
+    // -ffast-math, since that would reorder the floating point additions.
+    //
+
+    void SumStdReimpl(std::uint64_t iterations)
+    {
+        using V = StdReimpl::native_simd<float>;
+        const std::vector<float> x = MakeValues(0.5f);
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            V sum(0.0f);
+            for (std::size_t j = 0; j < g_Count; j += V::size())
+            {
+                sum += V(x.data() + j, StdReimpl::element_aligned);
+            }
+            float result = StdReimpl::reduce(sum);
+            DoNotOptimize(result);
+        }
+    }
+
+    void SumScalar(std::uint64_t iterations)
+    {
+        const std::vector<float> x = MakeValues(0.5f);
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            float result = 0.0f;
+            for (std::size_t j = 0; j < g_Count; ++j)
+            {
+                result += x[j];
+            }
+            DoNotOptimize(result);
+        }
+    }
+
+    const BenchmarkRegistrar g_SumStdReimpl{"simd/sum", "StdReimpl", &SumStdReimpl};
+    const BenchmarkRegistrar g_SumScalar{"simd/sum", "scalar_loop", &SumScalar};
+
+    //
+    // Abs and max: the largest magnitude, which has a masked compare in the scalar loop.
+    //
+
+    void MaxAbsStdReimpl(std::uint64_t iterations)
+    {
+        using V = StdReimpl::native_simd<float>;
+        const std::vector<float> x = MakeValues(0.5f);
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            V largest(0.0f);
+            for (std::size_t j = 0; j < g_Count; j += V::size())
+            {
+                largest = StdReimpl::max(largest, StdReimpl::abs(V(x.data() + j, StdReimpl::element_aligned)));
+            }
+            float result = StdReimpl::reduce_max(largest);
+            DoNotOptimize(result);
+        }
+    }
+
+    void MaxAbsScalar(std::uint64_t iterations)
+    {
+        const std::vector<float> x = MakeValues(0.5f);
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            float result = 0.0f;
+            for (std::size_t j = 0; j < g_Count; ++j)
+            {
+                const float magnitude = x[j] < 0.0f ? -x[j] : x[j];
+                result = result < magnitude ? magnitude : result;
+            }
+            DoNotOptimize(result);
+        }
+    }
+
+    const BenchmarkRegistrar g_MaxAbsStdReimpl{"simd/max_abs", "StdReimpl", &MaxAbsStdReimpl};
+    const BenchmarkRegistrar g_MaxAbsScalar{"simd/max_abs", "scalar_loop", &MaxAbsScalar};
+
+#if defined(CPPUTILS_STDREIMPL_BENCHMARK_EXPERIMENTAL_SIMD)
+    namespace stdx = std::experimental;
+
+    void SaxpyExperimental(std::uint64_t iterations)
+    {
+        using V = stdx::native_simd<float>;
+        const std::vector<float> x = MakeValues(0.5f);
+        std::vector<float> y = MakeValues(0.25f);
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const V a(1.0001f);
+            for (std::size_t j = 0; j < g_Count; j += V::size())
+            {
+                const V result = a * V(x.data() + j, stdx::element_aligned) + V(y.data() + j, stdx::element_aligned);
+                result.copy_to(y.data() + j, stdx::element_aligned);
+            }
+            ClobberMemory();
+        }
+        DoNotOptimize(y);
+    }
+
+    void SumExperimental(std::uint64_t iterations)
+    {
+        using V = stdx::native_simd<float>;
+        const std::vector<float> x = MakeValues(0.5f);
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            V sum(0.0f);
+            for (std::size_t j = 0; j < g_Count; j += V::size())
+            {
+                sum += V(x.data() + j, stdx::element_aligned);
+            }
+            float result = stdx::reduce(sum);
+            DoNotOptimize(result);
+        }
+    }
+
+    void MaxAbsExperimental(std::uint64_t iterations)
+    {
+        using V = stdx::native_simd<float>;
+        const std::vector<float> x = MakeValues(0.5f);
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            V largest(0.0f);
+            for (std::size_t j = 0; j < g_Count; j += V::size())
+            {
+                largest = stdx::max(largest, stdx::abs(V(x.data() + j, stdx::element_aligned)));
+            }
+            float result = stdx::hmax(largest);
+            DoNotOptimize(result);
+        }
+    }
+
+    const BenchmarkRegistrar g_SaxpyExperimental{"simd/saxpy", "std_experimental", &SaxpyExperimental};
+    const BenchmarkRegistrar g_SumExperimental{"simd/sum", "std_experimental", &SumExperimental};
+    const BenchmarkRegistrar g_MaxAbsExperimental{"simd/max_abs", "std_experimental", &MaxAbsExperimental};
+#endif
+}
@@ -0,0 +1,71 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/stop_token.h>
+
+#include <cstdint>
+
+#if defined(__has_include)
+#   if __has_include(<stop_token>)
+#       include <stop_token>
+#   endif
+#endif
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    //
+    // The life of a cancellable task: a stop state of its own, a token handed to the task, and a callback registered
+    // for as long as it runs. Each operation is one task, which should cost one allocation and no lock.
+    //
+
+    template <class StopSource, template <class> class StopCallback>
+    void CancellableTask(std::uint64_t iterations)
+    {
+        int cancelled = 0;
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            StopSource source;
+            const auto token = source.get_token();
+            const StopCallback callback(token, [&cancelled]() noexcept { ++cancelled; });
+            bool requested = token.stop_requested();
+            DoNotOptimize(requested);
+        }
+        DoNotOptimize(cancelled);
+    }
+
+    //
+    // Registering and deregistering a callback on a stop state that many tasks share, e.g., that of a server shutting
+    // down.
+    //
+
+    template <class StopSource, template <class> class StopCallback>
+    void SharedRegistration(std::uint64_t iterations)
+    {
+        StopSource source;
+        const auto token = source.get_token();
+        int cancelled = 0;
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            const StopCallback callback(token, [&cancelled]() noexcept { ++cancelled; });
+            DoNotOptimize(cancelled);
+        }
+    }
+
+    template <class Callback>
+    using StdReimplStopCallback = StdReimpl::stop_callback<Callback>;
+
+    const BenchmarkRegistrar g_CancellableTaskStdReimpl{"stop_token/cancellable_task", "StdReimpl", &CancellableTask<StdReimpl::stop_source, StdReimplStopCallback>};
+    const BenchmarkRegistrar g_SharedRegistrationStdReimpl{"stop_callback/shared_registration", "StdReimpl", &SharedRegistration<StdReimpl::stop_source, StdReimplStopCallback>};
+
+#if defined(__cpp_lib_jthread)
+    template <class Callback>
+    using StdStopCallback = std::stop_callback<Callback>;
+
+    const BenchmarkRegistrar g_CancellableTaskStd{"stop_token/cancellable_task", "std", &CancellableTask<std::stop_source, StdStopCallback>};
+    const BenchmarkRegistrar g_SharedRegistrationStd{"stop_callback/shared_registration", "std", &SharedRegistration<std::stop_source, StdStopCallback>};
+#endif
+}
@@ -0,0 +1,54 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include "BenchmarkHarness.h"
+
+#include <CppUtils/StdReimpl/utility.h>
+
+#include <cstdint>
+#include <utility>
+
+namespace
+{
+    using StdReimplBenchmarks::BenchmarkRegistrar;
+    using StdReimplBenchmarks::DoNotOptimize;
+
+    enum class Color : std::uint8_t
+    {
+        Red,
+        Green,
+        Blue
+    };
+
+    template <bool UseStdReimpl>
+    void ToUnderlying(std::uint64_t iterations)
+    {
+        Color color = Color::Green;
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(color);
+
+            std::uint8_t result;
+            if constexpr (UseStdReimpl)
+            {
+                result = StdReimpl::to_underlying(color);
+            }
+            else
+            {
+#if defined(__cpp_lib_to_underlying)
+                result = std::to_underlying(color);
+#else
+                result = static_cast<std::uint8_t>(color);
+#endif
+            }
+            DoNotOptimize(result);
+        }
+    }
+
+    const BenchmarkRegistrar g_ToUnderlyingStdReimpl{"to_underlying", "StdReimpl", &ToUnderlying<true>};
+#if defined(__cpp_lib_to_underlying)
+    const BenchmarkRegistrar g_ToUnderlyingStd{"to_underlying", "std", &ToUnderlying<false>};
+#else
+    const BenchmarkRegistrar g_ToUnderlyingStd{"to_underlying", "static_cast", &ToUnderlying<false>};
+#endif
+}
@@ -0,0 +1,217 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/functional.h>
+
+#include "TestCheck.h"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+    constexpr int Subtract(int a, int b)
+    {
+        return a - b;
+    }
+
+    constexpr bool IsEven(int a) noexcept
+    {
+        return a % 2 == 0;
+    }
+
+    struct Widget
+    {
+        int clicks = 0;
+
+        constexpr int OnClick(int count) noexcept
+        {
+            clicks += count;
+            return clicks;
+        }
+
+        constexpr int GetClicks() const
+        {
+            return clicks;
+        }
+    };
+
+    // Reports the value category and constness it's called with.
+    struct Qualifiers
+    {
+        constexpr int operator()() &
+        {
+            return 0;
+        }
+
+        constexpr int operator()() const&
+        {
+            return 1;
+        }
+
+        constexpr int operator()() &&
+        {
+            return 2;
+        }
+
+        constexpr int operator()() const&&
+        {
+            return 3;
+        }
+    };
+
+    // Only callable as an lvalue.
+    struct LvalueOnly
+    {
+        int operator()() &
+        {
+            return 0;
+        }
+
+        void operator()() && = delete;
+    };
+
+    // With the callable in the type, the wrapper holds only the bound arguments. Make sure the layout can't regress.
+
+    static_assert(std::is_empty_v<decltype(StdReimpl::bind_front<&Subtract>())>);
+    static_assert(std::is_empty_v<decltype(StdReimpl::bind_back(StdReimpl::constant_arg<&Subtract>))>);
+    static_assert(std::is_empty_v<decltype(StdReimpl::not_fn<&IsEven>())>);
+    static_assert(std::is_empty_v<decltype(StdReimpl::not_fn(StdReimpl::constant_arg<&IsEven>))>);
+    static_assert(sizeof(StdReimpl::bind_front<&Widget::OnClick>(std::declval<Widget*>())) == sizeof(Widget*));
+    static_assert(sizeof(StdReimpl::bind_front(StdReimpl::constant_arg<&Widget::OnClick>, std::declval<Widget*>())) == sizeof(Widget*));
+    static_assert(sizeof(StdReimpl::bind_back<&Subtract>(1)) == sizeof(int));
+    static_assert(std::is_trivially_copyable_v<decltype(StdReimpl::bind_front<&Widget::OnClick>(std::declval<Widget*>()))>);
+
+    // Whereas a runtime callable is stored, a pointer to member function being two pointers wide on the Itanium ABI.
+
+    static_assert(sizeof(StdReimpl::bind_front(&Widget::OnClick, std::declval<Widget*>())) == sizeof(&Widget::OnClick) + sizeof(Widget*));
+    static_assert(sizeof(StdReimpl::not_fn(&IsEven)) == sizeof(&IsEven));
+    static_assert(std::is_empty_v<decltype(StdReimpl::bind_front([](int a) { return a; }))>);
+
+    // noexcept is propagated from the call the wrapper makes.
+
+    static_assert(std::is_nothrow_invocable_v<decltype(StdReimpl::bind_front<&Widget::OnClick>(std::declval<Widget*>())), int>);
+    static_assert(!std::is_nothrow_invocable_v<decltype(StdReimpl::bind_front<&Widget::GetClicks>(std::declval<Widget*>()))>);
+    static_assert(std::is_nothrow_invocable_v<decltype(StdReimpl::bind_back(&IsEven, 2))>);
+    static_assert(!std::is_nothrow_invocable_v<decltype(StdReimpl::bind_back(&Subtract, 2)), int>);
+    static_assert(std::is_nothrow_invocable_v<decltype(StdReimpl::not_fn<&IsEven>()), int>);
+    static_assert(!std::is_nothrow_invocable_v<decltype(StdReimpl::not_fn<&Subtract>()), int, int>);
+
+    // The call operators are constrained, and deleted for a qualification that can't make the call.
+
+    static_assert(!std::is_invocable_v<decltype(StdReimpl::bind_front<&Subtract>(1)), int, int>);
+    static_assert(!std::is_invocable_v<decltype(StdReimpl::bind_front<&Subtract>(1)), std::string>);
+    static_assert(std::is_invocable_v<decltype(StdReimpl::bind_front(LvalueOnly()))&>);
+    static_assert(!std::is_invocable_v<decltype(StdReimpl::bind_front(LvalueOnly()))>);
+    static_assert(!std::is_invocable_v<const decltype(StdReimpl::bind_front(LvalueOnly()))&>);
+    static_assert(!std::is_invocable_v<decltype(StdReimpl::not_fn(LvalueOnly()))>);
+
+    // The wrappers of constant callables are usable in constant expressions, which also means there's no call through
+    // a pointer left for the optimizer to see through.
+
+    static_assert(StdReimpl::bind_front<&Subtract>(10)(3) == 7);
+    static_assert(StdReimpl::bind_back<&Subtract>(10)(3) == -7);
+    static_assert(StdReimpl::bind_front(StdReimpl::constant_arg<&Subtract>, 10, 3)() == 7);
+    static_assert(StdReimpl::bind_back(StdReimpl::constant_arg<&Subtract>, 10)(3) == -7);
+    static_assert(StdReimpl::not_fn<&IsEven>()(3));
+    static_assert(!StdReimpl::not_fn(StdReimpl::constant_arg<&IsEven>)(4));
+    static_assert(StdReimpl::bind_front(&Subtract, 10)(3) == 7);
+    static_assert(StdReimpl::bind_back(&Subtract, 10)(3) == -7);
+    static_assert(StdReimpl::not_fn(&IsEven)(3));
+
+    constexpr int ClickTwice()
+    {
+        Widget widget;
+        auto onClick = StdReimpl::bind_front<&Widget::OnClick>(&widget);
+        onClick(2);
+        return onClick(3);
+    }
+    static_assert(ClickTwice() == 5);
+
+    void TestBindFront()
+    {
+        Widget widget;
+        auto onClick = StdReimpl::bind_front<&Widget::OnClick>(&widget);
+        CPPUTILS_STDREIMPL_TEST_CHECK(onClick(2) == 2);
+        CPPUTILS_STDREIMPL_TEST_CHECK(onClick(3) == 5);
+        CPPUTILS_STDREIMPL_TEST_CHECK(widget.clicks == 5);
+
+        // The object itself is bound by copy, and called through with the wrapper's constness.
+        const auto getClicks = StdReimpl::bind_front(StdReimpl::constant_arg<&Widget::GetClicks>, widget);
+        widget.clicks = 0;
+        CPPUTILS_STDREIMPL_TEST_CHECK(getClicks() == 5);
+
+        auto runtime = StdReimpl::bind_front(&Widget::OnClick, std::ref(widget));
+        CPPUTILS_STDREIMPL_TEST_CHECK(runtime(4) == 4);
+        CPPUTILS_STDREIMPL_TEST_CHECK(widget.clicks == 4);
+
+        // Pointers to members apply to objects, pointers, smart pointers and reference_wrappers, as with INVOKE.
+        struct DerivedWidget : Widget
+        {
+        };
+        DerivedWidget derived;
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::bind_front<&Widget::OnClick>(&derived)(6) == 6);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::bind_front<&Widget::OnClick>(std::ref(derived))(1) == 7);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::bind_front<&Widget::GetClicks>(std::make_unique<Widget>())() == 0);
+        StdReimpl::bind_back<&Widget::clicks>()(derived) = 1;
+        CPPUTILS_STDREIMPL_TEST_CHECK(derived.clicks == 1);
+        using BoundClicks = decltype(StdReimpl::bind_front<&Widget::clicks>(Widget()));
+        static_assert(std::is_same_v<std::invoke_result_t<BoundClicks&>, int&>);
+        static_assert(std::is_same_v<std::invoke_result_t<const BoundClicks&>, const int&>);
+        static_assert(std::is_same_v<std::invoke_result_t<BoundClicks>, int&&>);
+        static_assert(std::is_same_v<std::invoke_result_t<decltype(StdReimpl::bind_front<&Widget::clicks>(std::declval<const Widget*>()))>, const int&>);
+
+        const auto greet = StdReimpl::bind_front([](const std::string& greeting, const std::string& name) { return greeting + ", " + name; }, std::string("Hello"));
+        CPPUTILS_STDREIMPL_TEST_CHECK(greet("world") == "Hello, world");
+    }
+
+    void TestBindBack()
+    {
+        const auto minusOne = StdReimpl::bind_back<&Subtract>(1);
+        CPPUTILS_STDREIMPL_TEST_CHECK(minusOne(10) == 9);
+
+        const auto concatenate = StdReimpl::bind_back([](std::string a, const std::string& b, const std::string& c) { return a + b + c; }, std::string("b"), std::string("c"));
+        CPPUTILS_STDREIMPL_TEST_CHECK(concatenate("a") == "abc");
+    }
+
+    void TestNotFn()
+    {
+        const auto isOdd = StdReimpl::not_fn<&IsEven>();
+        CPPUTILS_STDREIMPL_TEST_CHECK(isOdd(3));
+        CPPUTILS_STDREIMPL_TEST_CHECK(!isOdd(4));
+
+        const auto isNotEmpty = StdReimpl::not_fn(&std::string::empty);
+        CPPUTILS_STDREIMPL_TEST_CHECK(isNotEmpty(std::string("x")));
+        CPPUTILS_STDREIMPL_TEST_CHECK(!isNotEmpty(std::string()));
+    }
+
+    void TestValueCategories()
+    {
+        auto front = StdReimpl::bind_front(Qualifiers());
+        const auto& constFront = front;
+        CPPUTILS_STDREIMPL_TEST_CHECK(front() == 0);
+        CPPUTILS_STDREIMPL_TEST_CHECK(constFront() == 1);
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::move(front)() == 2);
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::move(constFront)() == 3);
+
+        auto negated = StdReimpl::not_fn(Qualifiers());
+        CPPUTILS_STDREIMPL_TEST_CHECK(negated());
+        CPPUTILS_STDREIMPL_TEST_CHECK(!std::move(negated)());
+
+        // An rvalue wrapper moves its bound arguments into the call.
+        auto sink = StdReimpl::bind_front([](std::unique_ptr<int> p) { return *p; }, std::make_unique<int>(42));
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::move(sink)() == 42);
+        static_assert(!std::is_invocable_v<decltype(sink)&>);
+    }
+}
+
+int main()
+{
+    TestBindFront();
+    TestBindBack();
+    TestNotFn();
+    TestValueCategories();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,157 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/bit.h>
+
+#include "TestCheck.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace
+{
+    // Everything should be usable in constant evaluation.
+    static_assert(StdReimpl::bit_cast<std::uint32_t>(1.0f) == 0x3F800000u);
+    static_assert(StdReimpl::bit_cast<double>(std::uint64_t{0x4000000000000000}) == 2.0);
+
+    static_assert(StdReimpl::byteswap(std::uint16_t{0x1234}) == 0x3412);
+    static_assert(StdReimpl::byteswap(std::uint32_t{0x12345678}) == 0x78563412u);
+    static_assert(StdReimpl::byteswap(std::uint64_t{0x0123456789ABCDEF}) == 0xEFCDAB8967452301u);
+    static_assert(StdReimpl::byteswap(std::int32_t{0x01020380}) == static_cast<std::int32_t>(0x80030201u));
+    static_assert(StdReimpl::byteswap(std::uint8_t{0xAB}) == 0xAB);
+
+    static_assert(StdReimpl::has_single_bit(64u) && !StdReimpl::has_single_bit(0u) && !StdReimpl::has_single_bit(65u));
+    static_assert(StdReimpl::bit_ceil(0u) == 1u && StdReimpl::bit_ceil(1u) == 1u && StdReimpl::bit_ceil(5u) == 8u);
+    static_assert(StdReimpl::bit_ceil(std::uint8_t{128}) == 128);
+    static_assert(StdReimpl::bit_floor(0u) == 0u && StdReimpl::bit_floor(5u) == 4u && StdReimpl::bit_floor(~0u) == 0x80000000u);
+    static_assert(StdReimpl::bit_width(0u) == 0 && StdReimpl::bit_width(1u) == 1 && StdReimpl::bit_width(std::uint64_t{1} << 40) == 41);
+
+    static_assert(StdReimpl::rotl(std::uint8_t{0x81}, 1) == 0x03);
+    static_assert(StdReimpl::rotl(std::uint8_t{0x81}, -1) == 0xC0);
+    static_assert(StdReimpl::rotr(0x1u, 1) == 0x80000000u);
+    static_assert(StdReimpl::rotr(std::uint16_t{0x1234}, 20) == 0x4123);
+    static_assert(StdReimpl::rotl(0x12345678u, 0) == 0x12345678u);
+
+    static_assert(StdReimpl::countl_zero(std::uint8_t{0}) == 8 && StdReimpl::countl_zero(std::uint16_t{1}) == 15);
+    static_assert(StdReimpl::countl_zero(std::uint64_t{1} << 62) == 1);
+    static_assert(StdReimpl::countl_one(std::uint8_t{0xF0}) == 4);
+    static_assert(StdReimpl::countr_zero(std::uint8_t{0}) == 8 && StdReimpl::countr_zero(0x100u) == 8);
+    static_assert(StdReimpl::countr_one(std::uint32_t{0x7}) == 3 && StdReimpl::countr_one(~0u) == 32);
+    static_assert(StdReimpl::popcount(std::uint8_t{0xFF}) == 8 && StdReimpl::popcount(~std::uint64_t{0}) == 64);
+    static_assert(StdReimpl::popcount(0x12345678u) == 13);
+
+    static_assert(StdReimpl::endian::native == StdReimpl::endian::little || StdReimpl::endian::native == StdReimpl::endian::big);
+    static_assert(static_cast<int>(StdReimpl::endian::native) == static_cast<int>(std::endian::native));
+
+    // The bit functions only take unsigned integers that aren't `bool` or characters.
+    template <class T>
+    concept CanPopcount = requires(T x) { StdReimpl::popcount(x); };
+
+    static_assert(CanPopcount<unsigned char> && CanPopcount<unsigned long long>);
+    static_assert(!CanPopcount<int> && !CanPopcount<bool> && !CanPopcount<char8_t> && !CanPopcount<char32_t>);
+
+    std::uint64_t Next(std::uint64_t& state)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    // Checks the runtime versions against the constant evaluated ones, and against the vendor's, over values with all
+    // sorts of widths.
+    template <class T>
+    void TestRuntimeMatchesConstantEvaluation()
+    {
+        constexpr auto constantEvaluated = [](T x)
+        {
+            return StdReimpl::Detail::popcount_portable(x) * 1000000 + StdReimpl::Detail::countl_zero_portable(x) * 1000 +
+                StdReimpl::Detail::countr_zero_portable(x);
+        };
+
+        std::uint64_t state = 0x9E3779B97F4A7C15;
+        bool matches = true;
+        for (int i = 0; i < 10000; ++i)
+        {
+            const std::uint64_t random = Next(state);
+            const T x = static_cast<T>(i < 200 ? (i < 100 ? i : T(~T(0)) - (i - 100)) : random >> (random % 64));
+
+            const int runtime = StdReimpl::popcount(x) * 1000000 + StdReimpl::countl_zero(x) * 1000 + StdReimpl::countr_zero(x);
+            matches = matches && runtime == constantEvaluated(x) && StdReimpl::popcount(x) == std::popcount(x) &&
+                StdReimpl::countl_zero(x) == std::countl_zero(x) && StdReimpl::countr_zero(x) == std::countr_zero(x) &&
+                StdReimpl::countl_one(x) == std::countl_one(x) && StdReimpl::countr_one(x) == std::countr_one(x) &&
+                StdReimpl::bit_width(x) == static_cast<int>(std::bit_width(x)) && StdReimpl::bit_floor(x) == std::bit_floor(x) &&
+                StdReimpl::has_single_bit(x) == std::has_single_bit(x) && StdReimpl::byteswap(x) == StdReimpl::Detail::byteswap_portable(x) &&
+                StdReimpl::rotl(x, i % 200 - 100) == std::rotl(x, i % 200 - 100) && StdReimpl::rotr(x, i % 200 - 100) == std::rotr(x, i % 200 - 100);
+            if (StdReimpl::bit_width(x) < std::numeric_limits<T>::digits)
+            {
+                matches = matches && StdReimpl::bit_ceil(x) == std::bit_ceil(x);
+            }
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(matches);
+    }
+
+    template <class T>
+    void TestBatchByteswap()
+    {
+        // Sizes around each vector width, at offsets that aren't vector aligned, both in place and not.
+        for (std::size_t offset = 0; offset < 3; ++offset)
+        {
+            for (std::size_t count = 0; count < 80; ++count)
+            {
+                std::vector<T> values(offset + count);
+                for (std::size_t i = 0; i < values.size(); ++i)
+                {
+                    values[i] = static_cast<T>(0x0102030405060708u * (i + 1));
+                }
+
+                const std::span<const T> x(values.data() + offset, count);
+                std::vector<T> result(count + 1, T(0x5A));
+                StdReimpl::byteswap(x, std::span<T>(result.data(), count));
+
+                std::vector<T> inPlace(x.begin(), x.end());
+                StdReimpl::byteswap(inPlace, inPlace);
+
+                bool swapped = result[count] == T(0x5A);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    swapped = swapped && result[i] == StdReimpl::Detail::byteswap_portable(x[i]) && inPlace[i] == result[i];
+                }
+                CPPUTILS_STDREIMPL_TEST_CHECK(swapped);
+            }
+        }
+    }
+
+    void TestBitCast()
+    {
+        const float value = -1.5f;
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::bit_cast<std::uint32_t>(value) == std::bit_cast<std::uint32_t>(value));
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::bit_cast<float>(StdReimpl::bit_cast<std::uint32_t>(value)) == value);
+
+        struct Pair
+        {
+            std::uint16_t low;
+            std::uint16_t high;
+        };
+        const Pair pair = StdReimpl::bit_cast<Pair>(std::uint32_t{0x12345678});
+        CPPUTILS_STDREIMPL_TEST_CHECK((StdReimpl::endian::native == StdReimpl::endian::little ? pair.low : pair.high) == 0x5678);
+    }
+}
+
+int main()
+{
+    TestRuntimeMatchesConstantEvaluation<unsigned char>();
+    TestRuntimeMatchesConstantEvaluation<unsigned short>();
+    TestRuntimeMatchesConstantEvaluation<unsigned int>();
+    TestRuntimeMatchesConstantEvaluation<unsigned long>();
+    TestRuntimeMatchesConstantEvaluation<unsigned long long>();
+    TestBatchByteswap<std::uint16_t>();
+    TestBatchByteswap<std::uint32_t>();
+    TestBatchByteswap<std::uint64_t>();
+    TestBitCast();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,373 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/charconv.h>
+
+#include "TestCheck.h"
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <utility>
+
+// Building with this defined checks every float, rather than a sample of them, which takes minutes.
+#if !defined(CPPUTILS_STDREIMPL_CHARCONV_TEST_EVERY_FLOAT)
+#   define CPPUTILS_STDREIMPL_CHARCONV_TEST_EVERY_FLOAT 0
+#endif
+
+// Where the vendor has floating point `<charconv>`, we check that we write exactly what it does, and read the same
+// values. Otherwise we only check that values round trip.
+#if defined(__cpp_lib_to_chars)
+#   define CPPUTILS_STDREIMPL_CHARCONV_TEST_AGAINST_VENDOR 1
+#endif
+
+namespace
+{
+    using StdReimpl::chars_format;
+
+    // The integer conversions should be usable in constant evaluation.
+    constexpr bool TestConstantEvaluation()
+    {
+        char buffer[8] = {};
+        const StdReimpl::to_chars_result written = StdReimpl::to_chars(buffer, buffer + 8, -1234);
+        int value = 0;
+        const StdReimpl::from_chars_result read = StdReimpl::from_chars(buffer, written.ptr, value);
+        return written && read && read.ptr == written.ptr && value == -1234 && buffer[0] == '-' && buffer[4] == '4';
+    }
+    static_assert(TestConstantEvaluation());
+
+    template <class T>
+    concept CanToChars = requires(char* p, T value) { StdReimpl::to_chars(p, p, value); };
+
+    static_assert(CanToChars<int> && CanToChars<char> && CanToChars<unsigned long long> && CanToChars<double>);
+    static_assert(!CanToChars<bool> && !CanToChars<char8_t> && !CanToChars<wchar_t>);
+
+    static_assert((chars_format::fixed | chars_format::scientific) == chars_format::general);
+    static_assert((chars_format::general & ~chars_format::fixed) == chars_format::scientific);
+
+    std::uint64_t Next(std::uint64_t& state)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    template <class T>
+    std::string ToString(T value)
+    {
+        char buffer[64];
+        const StdReimpl::to_chars_result result = StdReimpl::to_chars(buffer, buffer + sizeof(buffer), value);
+        return std::string(buffer, result.ptr);
+    }
+
+    template <class T>
+    std::string ToString(T value, chars_format fmt)
+    {
+        char buffer[2000];
+        const StdReimpl::to_chars_result result = StdReimpl::to_chars(buffer, buffer + sizeof(buffer), value, fmt);
+        return std::string(buffer, result.ptr);
+    }
+
+    template <class T>
+    std::string ToString(T value, chars_format fmt, int precision)
+    {
+        char buffer[2000];
+        const StdReimpl::to_chars_result result = StdReimpl::to_chars(buffer, buffer + sizeof(buffer), value, fmt, precision);
+        return std::string(buffer, result.ptr);
+    }
+
+    template <class T>
+    bool SameBits(T a, T b)
+    {
+        return std::memcmp(&a, &b, sizeof(T)) == 0;
+    }
+
+    template <class T>
+    void TestIntegers()
+    {
+        std::uint64_t state = 0x9E3779B97F4A7C15;
+        bool matches = true;
+        for (int i = 0; i < 20000; ++i)
+        {
+            const std::uint64_t random = Next(state);
+            const T value = static_cast<T>(i < 100 ? i - 50 : static_cast<std::int64_t>(random >> (random % 64)));
+            const int base = i % 3 == 0 ? 10 : 2 + static_cast<int>(random % 35);
+
+            char ours[80];
+            char theirs[80];
+            const StdReimpl::to_chars_result written = StdReimpl::to_chars(ours, ours + sizeof(ours), value, base);
+            const std::to_chars_result expected = std::to_chars(theirs, theirs + sizeof(theirs), value, base);
+            matches = matches && written && std::string_view(ours, written.ptr) == std::string_view(theirs, expected.ptr);
+
+            T readBack = 0;
+            const StdReimpl::from_chars_result read = StdReimpl::from_chars(ours, written.ptr, readBack, base);
+            matches = matches && read && read.ptr == written.ptr && readBack == value;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(matches);
+
+        // The extremes, in every base.
+        for (int base = 2; base <= 36; ++base)
+        {
+            for (const T value : {std::numeric_limits<T>::min(), std::numeric_limits<T>::max()})
+            {
+                char buffer[80];
+                const StdReimpl::to_chars_result written = StdReimpl::to_chars(buffer, buffer + sizeof(buffer), value, base);
+                T readBack = 0;
+                const StdReimpl::from_chars_result read = StdReimpl::from_chars(buffer, written.ptr, readBack, base);
+                CPPUTILS_STDREIMPL_TEST_CHECK(read.ptr == written.ptr && readBack == value);
+            }
+        }
+    }
+
+    void TestIntegerErrors()
+    {
+        char buffer[4];
+        CPPUTILS_STDREIMPL_TEST_CHECK((StdReimpl::to_chars(buffer, buffer + 4, 12345) == StdReimpl::to_chars_result{buffer + 4, std::errc::value_too_large}));
+        CPPUTILS_STDREIMPL_TEST_CHECK((StdReimpl::to_chars(buffer, buffer + 4, -1234) == StdReimpl::to_chars_result{buffer + 4, std::errc::value_too_large}));
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(255u) == "255" && ToString(static_cast<signed char>(-128)) == "-128");
+
+        const auto read = [](std::string_view text, auto value, int base = 10)
+        {
+            const StdReimpl::from_chars_result result = StdReimpl::from_chars(text.data(), text.data() + text.size(), value, base);
+            return std::pair{result, value};
+        };
+
+        // Overflow consumes all the digits, and leaves the value alone.
+        const auto [overflow, overflowValue] = read("256x", std::uint8_t{7});
+        CPPUTILS_STDREIMPL_TEST_CHECK(overflow.ec == std::errc::result_out_of_range && overflow.ptr[0] == 'x' && overflowValue == 7);
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("-129", std::int8_t{0}).first.ec == std::errc::result_out_of_range);
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("-128", std::int8_t{0}).second == -128);
+
+        // No sign for unsigned types, no '+', no prefixes, and no whitespace.
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("-1", 0u).first.ec == std::errc::invalid_argument);
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("+1", 0).first.ec == std::errc::invalid_argument);
+        CPPUTILS_STDREIMPL_TEST_CHECK(read(" 1", 0).first.ec == std::errc::invalid_argument);
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("-", 0).first.ec == std::errc::invalid_argument);
+        const auto [prefixed, prefixedValue] = read("0x1F", 5, 16);
+        CPPUTILS_STDREIMPL_TEST_CHECK(prefixed.ptr[0] == 'x' && prefixedValue == 0);
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("Zz", 0, 36).second == 35 * 36 + 35);
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("129", 0, 2).second == 1);
+    }
+
+    void TestShortest()
+    {
+        // Fixed or scientific, whichever is shorter.
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(0.1) == "0.1" && ToString(-0.0) == "-0" && ToString(1e23) == "1e+23");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(123456.0) == "123456" && ToString(1e5) == "1e+05" && ToString(1e-5) == "1e-05");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(0.001) == "0.001" && ToString(5e-324) == "5e-324");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(1.7976931348623157e308) == "1.7976931348623157e+308");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(0.3f) == "0.3" && ToString(16777216.0f) == "16777216" && ToString(1e-45f) == "1e-45");
+
+        // Fixed notation writes big values' exact integers.
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(1e23, chars_format::fixed) == "99999999999999991611392");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(1.2345678901234567e21) == "1234567890123456774144");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(5e-324, chars_format::fixed).size() == 326);
+
+        // General is `%g` with a precision of 6.
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(123456.0, chars_format::general) == "123456");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(1234567.0, chars_format::general) == "1.234567e+06");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(0.0001, chars_format::general) == "0.0001");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(0.0, chars_format::scientific) == "0e+00");
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(1.5, chars_format::hex) == "1.8p+0" && ToString(-0.0, chars_format::hex) == "-0p+0");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(5e-324, chars_format::hex) == "0.0000000000001p-1022");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(1e-45f, chars_format::hex) == "0.000002p-126");
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(std::numeric_limits<double>::infinity()) == "inf");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(-std::numeric_limits<float>::infinity(), chars_format::fixed, 3) == "-inf");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(std::numeric_limits<double>::quiet_NaN(), chars_format::hex) == "nan");
+
+        char buffer[8];
+        CPPUTILS_STDREIMPL_TEST_CHECK((StdReimpl::to_chars(buffer, buffer + 3, 1234.5) == StdReimpl::to_chars_result{buffer + 3, std::errc::value_too_large}));
+        CPPUTILS_STDREIMPL_TEST_CHECK((StdReimpl::to_chars(buffer, buffer + 2, -std::numeric_limits<double>::infinity()) == StdReimpl::to_chars_result{buffer + 2, std::errc::value_too_large}));
+    }
+
+    void TestPrecision()
+    {
+        // Rounded from the exact binary value, ties to even.
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(0.5, chars_format::fixed, 0) == "0" && ToString(1.5, chars_format::fixed, 0) == "2");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(2.5, chars_format::fixed, 0) == "2" && ToString(0.125, chars_format::fixed, 2) == "0.12");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(0.1, chars_format::fixed, 30) == "0.100000000000000005551115123126");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(9.995, chars_format::fixed, 2) == "9.99" && ToString(9.9951, chars_format::fixed, 2) == "10.00");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(0.0004, chars_format::fixed, 3) == "0.000" && ToString(0.0006, chars_format::fixed, 3) == "0.001");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(0.1f, chars_format::fixed, 20) == "0.10000000149011611938");
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(0.5, chars_format::scientific, 0) == "5e-01" && ToString(0.5, chars_format::scientific, 2) == "5.00e-01");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(9.99, chars_format::scientific, 1) == "1.0e+01" && ToString(1e-300, chars_format::scientific, 3) == "1.000e-300");
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(1e-10, chars_format::general, 20) == "1.0000000000000000364e-10");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(1234.5678, chars_format::general, 0) == "1e+03" && ToString(0.5, chars_format::general, 0) == "0.5");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(100000.0, chars_format::general, 6) == "100000" && ToString(1e6, chars_format::general, 6) == "1e+06");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(0.0, chars_format::general, 3) == "0" && ToString(0.0, chars_format::scientific, 1) == "0.0e+00");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(3.0, chars_format::general, -1) == "3" && ToString(3.0, chars_format::fixed, -1) == "3.000000");
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(1.5, chars_format::hex, 0) == "2p+0" && ToString(1.5, chars_format::hex, 3) == "1.800p+0");
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToString(1.0 / 3.0, chars_format::hex, 2) == "1.55p-2" && ToString(1e-45f, chars_format::hex, 2) == "0.00p-126");
+
+        // Long precisions, past the last nonzero digit.
+        const std::string longFixed = ToString(0.5, chars_format::fixed, 1500);
+        CPPUTILS_STDREIMPL_TEST_CHECK(longFixed.size() == 1502 && longFixed.substr(0, 4) == "0.50" && longFixed.back() == '0');
+    }
+
+    void TestFromChars()
+    {
+        const auto read = [](std::string_view text, double initial, chars_format fmt = chars_format::general)
+        {
+            double value = initial;
+            const StdReimpl::from_chars_result result = StdReimpl::from_chars(text.data(), text.data() + text.size(), value, fmt);
+            return std::tuple{result.ec, result.ptr - text.data(), value};
+        };
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("0.1", 0.0) == std::tuple(std::errc{}, 3, 0.1));
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("-2.5e-3x", 0.0) == std::tuple(std::errc{}, 7, -2.5e-3));
+        CPPUTILS_STDREIMPL_TEST_CHECK(read(".5", 0.0) == std::tuple(std::errc{}, 2, 0.5) && read("5.", 0.0) == std::tuple(std::errc{}, 2, 5.0));
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("1e", 0.0) == std::tuple(std::errc{}, 1, 1.0) && read("1e+", 0.0) == std::tuple(std::errc{}, 1, 1.0));
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("0x1p3", 7.0) == std::tuple(std::errc{}, 1, 0.0));
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::get<0>(read(".", 7.0)) == std::errc::invalid_argument && std::get<0>(read("+1", 7.0)) == std::errc::invalid_argument);
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::get<0>(read(" 1", 7.0)) == std::errc::invalid_argument);
+
+        // Out of range values leave the value alone, but underflow to a subnormal is fine.
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("1e400", 7.0) == std::tuple(std::errc::result_out_of_range, 5, 7.0));
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("1e-400", 7.0) == std::tuple(std::errc::result_out_of_range, 6, 7.0));
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("2.4703282292062327e-324", 7.0) == std::tuple(std::errc::result_out_of_range, 23, 7.0));
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("2.4703282292062328e-324", 7.0) == std::tuple(std::errc{}, 23, 5e-324));
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("0e999999999999", 7.0) == std::tuple(std::errc{}, 14, 0.0));
+
+        // The formats: fixed has no exponent, and scientific requires one.
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("1e5", 7.0, chars_format::fixed) == std::tuple(std::errc{}, 1, 1.0));
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::get<0>(read("15", 7.0, chars_format::scientific)) == std::errc::invalid_argument);
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("1.8p1", 7.0, chars_format::hex) == std::tuple(std::errc{}, 5, 3.0));
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("1.8", 7.0, chars_format::hex) == std::tuple(std::errc{}, 3, 1.5));
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("1p-1075", 7.0, chars_format::hex) == std::tuple(std::errc::result_out_of_range, 7, 7.0));
+
+        // Infinities and NaNs, in any case.
+        CPPUTILS_STDREIMPL_TEST_CHECK(read("-inFinity", 0.0) == std::tuple(std::errc{}, 9, -std::numeric_limits<double>::infinity()));
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::get<1>(read("infin", 0.0)) == 3 && std::get<1>(read("nan(abc", 0.0)) == 3);
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::get<1>(read("NaN(a_1)x", 0.0)) == 8 && std::get<2>(read("nan", 0.0)) != std::get<2>(read("nan", 0.0)));
+
+        // Exactly halfway between two doubles, with the tie broken by a digit far past the 19th.
+        const std::string halfway = "1.00000000000000011102230246251565404236316680908203125";
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::get<2>(read(halfway, 0.0)) == 1.0);
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::get<2>(read(halfway + "000000001", 0.0)) == 1.0000000000000002);
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::get<2>(read("9007199254740993", 0.0)) == 9007199254740992.0);
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::get<2>(read("9007199254740993.00000000000000000001", 0.0)) == 9007199254740994.0);
+    }
+
+    template <class T>
+    void CheckValue(T value, bool& matches)
+    {
+        char ours[2000];
+        const StdReimpl::to_chars_result written = StdReimpl::to_chars(ours, ours + sizeof(ours), value);
+        T readBack = 0;
+        const StdReimpl::from_chars_result read = StdReimpl::from_chars(ours, written.ptr, readBack);
+        matches = matches && written && read.ptr == written.ptr && (SameBits(readBack, value) || value != value);
+
+#if defined(CPPUTILS_STDREIMPL_CHARCONV_TEST_AGAINST_VENDOR)
+        char theirs[2000];
+        const std::to_chars_result expected = std::to_chars(theirs, theirs + sizeof(theirs), value);
+        matches = matches && std::string_view(ours, written.ptr) == std::string_view(theirs, expected.ptr);
+#endif
+    }
+
+    template <class T>
+    void CheckFormats(T value, int precision, bool& matches)
+    {
+        constexpr chars_format formats[] = {chars_format::fixed, chars_format::scientific, chars_format::general, chars_format::hex};
+        for (const chars_format fmt : formats)
+        {
+            char ours[2000];
+            const StdReimpl::to_chars_result shortest = StdReimpl::to_chars(ours, ours + sizeof(ours), value, fmt);
+            T readBack = 0;
+            const StdReimpl::from_chars_result read = StdReimpl::from_chars(ours, shortest.ptr, readBack, fmt);
+            matches = matches && shortest && read.ptr == shortest.ptr && (SameBits(readBack, value) || value != value);
+
+#if defined(CPPUTILS_STDREIMPL_CHARCONV_TEST_AGAINST_VENDOR)
+            const std::chars_format vendorFormat = static_cast<std::chars_format>(static_cast<int>(fmt));
+            char theirs[2000];
+            const std::to_chars_result expected = std::to_chars(theirs, theirs + sizeof(theirs), value, vendorFormat);
+            matches = matches && std::string_view(ours, shortest.ptr) == std::string_view(theirs, expected.ptr);
+
+            const StdReimpl::to_chars_result withPrecision = StdReimpl::to_chars(ours, ours + sizeof(ours), value, fmt, precision);
+            const std::to_chars_result expectedWithPrecision = std::to_chars(theirs, theirs + sizeof(theirs), value, vendorFormat, precision);
+            matches = matches && std::string_view(ours, withPrecision.ptr) == std::string_view(theirs, expectedWithPrecision.ptr);
+
+            // Reading what we wrote with a precision is a good source of inputs that don't round trip on their own.
+            T ourValue = 0;
+            T theirValue = 0;
+            const StdReimpl::from_chars_result ourRead = StdReimpl::from_chars(ours, withPrecision.ptr, ourValue, fmt);
+            const std::from_chars_result theirRead = std::from_chars(ours, withPrecision.ptr, theirValue, vendorFormat);
+            matches = matches && ourRead.ptr == theirRead.ptr && ourRead.ec == theirRead.ec && (SameBits(ourValue, theirValue) || value != value);
+#else
+            static_cast<void>(precision);
+#endif
+        }
+    }
+
+    void TestRandomDoubles()
+    {
+        std::uint64_t state = 0x2545F4914F6CDD1D;
+        bool matches = true;
+        for (int i = 0; i < 100000; ++i)
+        {
+            const std::uint64_t random = Next(state);
+            double value;
+            if (i % 2 == 0)
+            {
+                // Any bit pattern.
+                std::memcpy(&value, &random, sizeof(value));
+            }
+            else
+            {
+                // Short decimals, the everyday case.
+                value = static_cast<double>(random % 100000000) / 1000.0;
+            }
+            CheckValue(value, matches);
+            CheckFormats(value, static_cast<int>(random % 25), matches);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(matches);
+    }
+
+    void TestFloatSweep()
+    {
+        // Every float with the exhaustive sweep, or every 4099th otherwise, which still reaches every exponent.
+        constexpr std::uint64_t stride = CPPUTILS_STDREIMPL_CHARCONV_TEST_EVERY_FLOAT ? 1 : 4099;
+        bool matches = true;
+        for (std::uint64_t bits = 0; bits <= 0xFFFFFFFFu; bits += stride)
+        {
+            const std::uint32_t floatBits = static_cast<std::uint32_t>(bits);
+            float value;
+            std::memcpy(&value, &floatBits, sizeof(value));
+            CheckValue(value, matches);
+            if (bits % (stride * 64) == 0)
+            {
+                CheckFormats(value, static_cast<int>(bits % 13), matches);
+            }
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(matches);
+    }
+}
+
+int main()
+{
+    TestIntegers<char>();
+    TestIntegers<signed char>();
+    TestIntegers<unsigned short>();
+    TestIntegers<int>();
+    TestIntegers<unsigned int>();
+    TestIntegers<long long>();
+    TestIntegers<unsigned long long>();
+    TestIntegerErrors();
+    TestShortest();
+    TestPrecision();
+    TestFromChars();
+    TestRandomDoubles();
+    TestFloatSweep();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,163 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/cmath.h>
+#include <CppUtils/StdReimpl/cstdlib.h>
+
+#include "TestCheck.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace
+{
+    template <class T>
+    constexpr T g_Inf = std::numeric_limits<T>::infinity();
+
+    template <class T>
+    constexpr T g_NaN = std::numeric_limits<T>::quiet_NaN();
+
+    // Everything should be usable in constant evaluation.
+    static_assert(!StdReimpl::signbit(0.0f));
+    static_assert(StdReimpl::signbit(-0.0f));
+    static_assert(StdReimpl::signbit(-g_Inf<double>));
+    static_assert(StdReimpl::signbit(-g_NaN<double>));
+    static_assert(StdReimpl::signbit(-0.0L));
+    static_assert(!StdReimpl::signbit(g_Inf<long double>));
+
+    static_assert(StdReimpl::fabs(-2.5f) == 2.5f);
+    static_assert(!StdReimpl::signbit(StdReimpl::fabs(-0.0)));
+    static_assert(StdReimpl::fabs(-g_Inf<double>) == g_Inf<double>);
+    static_assert(StdReimpl::fabs(-2.5L) == 2.5L);
+    static_assert(!StdReimpl::signbit(StdReimpl::fabs(-0.0L)));
+
+    static_assert(StdReimpl::copysign(3.0f, -0.0f) == -3.0f);
+    static_assert(StdReimpl::signbit(StdReimpl::copysign(0.0, -1.0)));
+    static_assert(StdReimpl::copysign(-3.0L, 1.0L) == 3.0L);
+    static_assert(StdReimpl::copysign(3.0L, -g_NaN<long double>) == -3.0L);
+
+    static_assert(StdReimpl::fpclassify(1.0f) == FP_NORMAL);
+    static_assert(StdReimpl::fpclassify(-0.0) == FP_ZERO);
+    static_assert(StdReimpl::fpclassify(std::numeric_limits<double>::denorm_min()) == FP_SUBNORMAL);
+    static_assert(StdReimpl::fpclassify(g_Inf<float>) == FP_INFINITE);
+    static_assert(StdReimpl::fpclassify(g_NaN<double>) == FP_NAN);
+    static_assert(StdReimpl::fpclassify(std::numeric_limits<long double>::denorm_min()) == FP_SUBNORMAL);
+    static_assert(StdReimpl::fpclassify(g_NaN<long double>) == FP_NAN);
+
+    static_assert(StdReimpl::abs(-1.5) == 1.5);
+    static_assert(StdReimpl::abs(-7) == 7);
+
+    template <class T>
+    std::vector<T> MakeSpecialValues()
+    {
+        std::vector<T> values = {
+            T(0), -T(0), T(1), -T(1), T(0.5), -T(123.25),
+            g_Inf<T>, -g_Inf<T>, g_NaN<T>, -g_NaN<T>,
+            std::numeric_limits<T>::min(), -std::numeric_limits<T>::min(),
+            std::numeric_limits<T>::denorm_min(), -std::numeric_limits<T>::denorm_min(),
+            std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest(),
+        };
+
+        // Make the size awkward so every vector width gets a scalar tail.
+        for (int i = 0; i < 21; ++i)
+        {
+            values.push_back(static_cast<T>((i % 2 == 0) ? -i : i) * T(0.75));
+        }
+        return values;
+    }
+
+    template <class T>
+    bool IsSameBits(T a, T b)
+    {
+        using Bits = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+        return std::bit_cast<Bits>(a) == std::bit_cast<Bits>(b);
+    }
+
+    template <class T>
+    void TestMatchesStd()
+    {
+        for (const T x : MakeSpecialValues<T>())
+        {
+            CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::signbit(x) == std::signbit(x));
+            CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::fpclassify(x) == std::fpclassify(x));
+            CPPUTILS_STDREIMPL_TEST_CHECK(IsSameBits(StdReimpl::fabs(x), std::fabs(x)));
+            CPPUTILS_STDREIMPL_TEST_CHECK(IsSameBits(StdReimpl::abs(x), std::fabs(x)));
+            CPPUTILS_STDREIMPL_TEST_CHECK(IsSameBits(StdReimpl::copysign(T(2), x), std::copysign(T(2), x)));
+            CPPUTILS_STDREIMPL_TEST_CHECK(IsSameBits(StdReimpl::copysign(x, -T(0)), std::copysign(x, -T(0))));
+        }
+    }
+
+    void TestLongDoubleMatchesStd()
+    {
+        using T = long double;
+        for (const T x : MakeSpecialValues<T>())
+        {
+            CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::signbit(x) == std::signbit(x));
+            CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::fpclassify(x) == std::fpclassify(x));
+            CPPUTILS_STDREIMPL_TEST_CHECK(std::signbit(StdReimpl::fabs(x)) == false);
+            CPPUTILS_STDREIMPL_TEST_CHECK(std::signbit(StdReimpl::copysign(T(2), x)) == std::signbit(x));
+        }
+    }
+
+    template <class T>
+    void TestBatchMatchesScalar()
+    {
+        const std::vector<T> values = MakeSpecialValues<T>();
+        std::vector<T> signs = values;
+        std::reverse(signs.begin(), signs.end());
+
+        std::vector<T> result(values.size());
+        StdReimpl::fabs(values, result);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CPPUTILS_STDREIMPL_TEST_CHECK(IsSameBits(result[i], StdReimpl::fabs(values[i])));
+        }
+
+        StdReimpl::abs(values, result);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CPPUTILS_STDREIMPL_TEST_CHECK(IsSameBits(result[i], StdReimpl::fabs(values[i])));
+        }
+
+        StdReimpl::copysign(values, signs, result);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CPPUTILS_STDREIMPL_TEST_CHECK(IsSameBits(result[i], StdReimpl::copysign(values[i], signs[i])));
+        }
+
+        // In place.
+        std::vector<T> inPlace = values;
+        StdReimpl::fabs(inPlace, inPlace);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CPPUTILS_STDREIMPL_TEST_CHECK(IsSameBits(inPlace[i], StdReimpl::fabs(values[i])));
+        }
+
+        // Every length, so every combination of vector body and scalar tail gets run.
+        for (std::size_t count = 0; count <= 17; ++count)
+        {
+            std::vector<T> partial(values.size(), T(42));
+            StdReimpl::copysign(std::span<const T>(values.data(), count), signs, partial);
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                const T expected = (i < count) ? StdReimpl::copysign(values[i], signs[i]) : T(42);
+                CPPUTILS_STDREIMPL_TEST_CHECK(IsSameBits(partial[i], expected));
+            }
+        }
+    }
+}
+
+int main()
+{
+    TestMatchesStd<float>();
+    TestMatchesStd<double>();
+    TestLongDoubleMatchesStd();
+    TestBatchMatchesScalar<float>();
+    TestBatchMatchesScalar<double>();
+
+    return StdReimplTests::GetExitCode();
+}
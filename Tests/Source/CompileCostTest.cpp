@@ -0,0 +1,95 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+// Instantiates `invoke_r`, the callable wrappers and the invocable concepts for a few hundred distinct signatures, so
+// that the compile-cost test can measure what our templates cost to instantiate. Nothing here is run.
+//
+// It's built twice: with `CPPUTILS_STDREIMPL_COMPILE_COST_SIGNATURES` signatures, and with none as a reference that
+// only pays for the includes. The difference between the two is the instantiation cost that the test tracks.
+
+#include <CppUtils/StdReimpl/concepts.h>
+#include <CppUtils/StdReimpl/functional.h>
+
+#include <utility>
+
+#ifndef CPPUTILS_STDREIMPL_COMPILE_COST_SIGNATURES
+#   define CPPUTILS_STDREIMPL_COMPILE_COST_SIGNATURES 256
+#endif
+
+namespace
+{
+    // Every signature has its own argument type, so that nothing is shared between the instantiations of two of them.
+    template <int N>
+    struct Tag
+    {
+        int value = N;
+    };
+
+    template <int N>
+    int Function(Tag<N> tag, int x) noexcept
+    {
+        return tag.value + x;
+    }
+
+    template <int N>
+    struct Functor
+    {
+        int operator()(Tag<N> tag, int x) const
+        {
+            return tag.value - x;
+        }
+    };
+
+    template <int N>
+    struct Object
+    {
+        int data = N;
+
+        int Member(Tag<N> tag) noexcept
+        {
+            return data + tag.value;
+        }
+    };
+
+    /**
+     * @brief Instantiates what a typical user of ours would for one signature: the concepts checking a callback, a direct
+     *        `invoke_r`, and each wrapper storing a function pointer, a functor and a bound member function.
+     */
+    template <int N>
+    int InstantiateSignature()
+    {
+        // Function pointers are the common case that `invocable` can check without `std::invoke`.
+        static_assert(StdReimpl::invocable<int (*)(Tag<N>, int) noexcept, Tag<N>, int>);
+        static_assert(StdReimpl::regular_invocable<const Functor<N>&, Tag<N>, int>);
+        static_assert(StdReimpl::invocable<int (Object<N>::*)(Tag<N>) noexcept, Object<N>&, Tag<N>>);
+        static_assert(!StdReimpl::invocable<int (*)(Tag<N>, int) noexcept, Tag<N + 1>, int>);
+
+        Object<N> object;
+        int result = StdReimpl::invoke_r<int>(&Function<N>, Tag<N>(), 1);
+        result += static_cast<int>(StdReimpl::invoke_r<long>(Functor<N>(), Tag<N>(), 2));
+        result += StdReimpl::invoke_r<int>(&Object<N>::Member, object, Tag<N>());
+        StdReimpl::invoke_r<void>(&Function<N>, Tag<N>(), 3);
+
+        const StdReimpl::function_ref<int(Tag<N>, int) const> ref = Functor<N>();
+        const StdReimpl::function_ref<int(Tag<N>, int) noexcept> pointerRef = &Function<N>;
+        const StdReimpl::function_ref<int(Tag<N>) noexcept> memberRef(StdReimpl::constant_arg<&Object<N>::Member>, object);
+        result += ref(Tag<N>(), 4) + pointerRef(Tag<N>(), 5) + memberRef(Tag<N>());
+
+        StdReimpl::move_only_function<int(Tag<N>, int) const> owning = Functor<N>();
+        StdReimpl::inplace_function<int(Tag<N>, int)> inplace = &Function<N>;
+        StdReimpl::move_only_function<int(Tag<N>)> bound = StdReimpl::bind_front<&Object<N>::Member>(&object);
+        result += owning(Tag<N>(), 6) + inplace(Tag<N>(), 7) + bound(Tag<N>());
+
+        return result;
+    }
+
+    template <int... N>
+    int InstantiateSignatures(std::integer_sequence<int, N...>)
+    {
+        return (InstantiateSignature<N>() + ... + 0);
+    }
+}
+
+int CompileCostTest()
+{
+    return InstantiateSignatures(std::make_integer_sequence<int, CPPUTILS_STDREIMPL_COMPILE_COST_SIGNATURES>());
+}
@@ -0,0 +1,59 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+// The code of each translation unit that the compile-time benchmark builds. It's what a typical source file of a user
+// of ours does: a few containers, callbacks, an expected and some formatting. It's the same whether our API comes from
+// includes or from the module, so that the only difference between the two builds is how they get it.
+//
+// It only uses our names, because importing our module doesn't make the standard library's names available.
+
+namespace CompileTimeBenchmark
+{
+    struct Entity
+    {
+        int id = 0;
+        float health = 100.0f;
+
+        int Damage(int amount) noexcept
+        {
+            health -= static_cast<float>(amount);
+            return id;
+        }
+    };
+
+    StdReimpl::expected<int, int> FindEntity(const StdReimpl::flat_map<int, Entity>& entities, int id)
+    {
+        const auto it = entities.find(id);
+        if (it == entities.end())
+        {
+            return StdReimpl::unexpected(id);
+        }
+        return it->second.id;
+    }
+
+    int UpdateEntities(StdReimpl::flat_map<int, Entity>& entities, StdReimpl::function_ref<void(Entity&)> update)
+    {
+        StdReimpl::inplace_vector<StdReimpl::move_only_function<int(int)>, 8> callbacks;
+        for (auto&& [id, entity] : entities)
+        {
+            update(entity);
+            if (callbacks.size() < callbacks.capacity())
+            {
+                callbacks.push_back(StdReimpl::bind_front<&Entity::Damage>(&entity));
+            }
+        }
+
+        int hits = 0;
+        for (auto& callback : callbacks)
+        {
+            hits += callback(1);
+        }
+        return hits;
+    }
+
+    decltype(sizeof(0)) DescribeEntity(const Entity& entity, char* buffer, decltype(sizeof(0)) size)
+    {
+        const StdReimpl::expected<int, int> found = entity.id > 0 ? StdReimpl::expected<int, int>(entity.id) : StdReimpl::unexpected(entity.id);
+        return static_cast<decltype(sizeof(0))>(StdReimpl::format_to_n(buffer, static_cast<long>(size), "entity {} at {:.1f} health, found: {}", entity.id, entity.health,
+            found.value_or(-1)).size);
+    }
+}
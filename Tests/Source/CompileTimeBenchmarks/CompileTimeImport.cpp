@@ -0,0 +1,7 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+// A translation unit of the compile-time benchmark that gets our API by importing our module.
+
+import CppUtils.StdReimpl;
+
+#include "CompileTimeBody.h"
@@ -0,0 +1,11 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+// A translation unit of the compile-time benchmark that gets our API by including our headers.
+
+#include <CppUtils/StdReimpl/expected.h>
+#include <CppUtils/StdReimpl/flat_map.h>
+#include <CppUtils/StdReimpl/format.h>
+#include <CppUtils/StdReimpl/functional.h>
+#include <CppUtils/StdReimpl/inplace_vector.h>
+
+#include "CompileTimeBody.h"
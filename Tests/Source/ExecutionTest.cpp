@@ -0,0 +1,276 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/execution.h>
+
+#include "AllocationCounter.h"
+#include "TestCheck.h"
+
+#include <atomic>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    namespace ex = StdReimpl::execution;
+
+    using StdReimpl::this_thread::sync_wait;
+    using StdReimplTests::CountAllocations;
+
+    struct Empty
+    {
+        int operator()(int i) const noexcept
+        {
+            return i + 1;
+        }
+    };
+
+    using JustInt = decltype(ex::just(1));
+    using ThenNoexcept = decltype(ex::just(1) | ex::then(Empty()));
+    using ThenThrowing = decltype(ex::just(1) | ex::then([](int i) { return i * 0.5; }));
+    using Scheduler = ex::static_thread_pool::scheduler;
+
+    static_assert(ex::sender<JustInt> && ex::sender<ThenNoexcept> && ex::scheduler<Scheduler>);
+    static_assert(!ex::sender<int> && !ex::receiver<JustInt>);
+    static_assert(std::is_same_v<ex::completion_signatures_of_t<JustInt>, ex::completion_signatures<ex::set_value_t(int)>>);
+    static_assert(std::is_same_v<ex::value_types_of_t<JustInt>, std::variant<std::tuple<int>>>);
+    static_assert(std::is_same_v<ex::completion_signatures_of_t<ThenNoexcept>, ex::completion_signatures<ex::set_value_t(int)>>);
+    static_assert(std::is_same_v<ex::completion_signatures_of_t<ThenThrowing>,
+        ex::completion_signatures<ex::set_value_t(double), ex::set_error_t(std::exception_ptr)>>);
+    static_assert(!ex::sends_stopped<ThenNoexcept>);
+    static_assert(ex::sends_stopped<decltype(ex::when_all(ex::just(1), ex::just()))>);
+
+    // Adaptors with empty functions take no space of their own.
+    static_assert(sizeof(ThenNoexcept) == sizeof(int));
+
+    static_assert(std::is_same_v<decltype(sync_wait(ex::when_all(ex::just(1), ex::just(), ex::just(2.0, 'c')))),
+        std::optional<std::tuple<int, double, char>>>);
+
+    // Completes with an error, for the paths that forward one.
+    struct JustError
+    {
+        using sender_concept = ex::sender_t;
+        using completion_signatures = ex::completion_signatures<ex::set_value_t(int), ex::set_error_t(std::exception_ptr)>;
+
+        template <class Rcvr>
+        struct operation
+        {
+            using operation_state_concept = ex::operation_state_t;
+
+            void start() & noexcept
+            {
+                ex::set_error(std::move(rcvr), std::make_exception_ptr(std::runtime_error("failed")));
+            }
+
+            Rcvr rcvr;
+        };
+
+        template <class Rcvr>
+        operation<Rcvr> connect(Rcvr rcvr) &&
+        {
+            return operation<Rcvr>{std::move(rcvr)};
+        }
+    };
+
+    // Completes with stopped.
+    struct JustStopped
+    {
+        using sender_concept = ex::sender_t;
+        using completion_signatures = ex::completion_signatures<ex::set_value_t(), ex::set_stopped_t()>;
+
+        template <class Rcvr>
+        struct operation
+        {
+            using operation_state_concept = ex::operation_state_t;
+
+            void start() & noexcept
+            {
+                ex::set_stopped(std::move(rcvr));
+            }
+
+            Rcvr rcvr;
+        };
+
+        template <class Rcvr>
+        operation<Rcvr> connect(Rcvr rcvr) &&
+        {
+            return operation<Rcvr>{std::move(rcvr)};
+        }
+    };
+
+    template <class Sndr>
+    bool ThrowsRuntimeError(Sndr&& sndr)
+    {
+        try
+        {
+            static_cast<void>(sync_wait(std::forward<Sndr>(sndr)));
+        }
+        catch (const std::runtime_error&)
+        {
+            return true;
+        }
+        return false;
+    }
+
+    void TestJustThen()
+    {
+        const auto sum = sync_wait(ex::just(1, 2) | ex::then([](int a, int b) { return a + b; }));
+        CPPUTILS_STDREIMPL_TEST_CHECK(sum && std::get<0>(*sum) == 3);
+
+        int seen = 0;
+        const auto none = sync_wait(ex::then(ex::just(4), [&seen](int i) { seen = i; }));
+        CPPUTILS_STDREIMPL_TEST_CHECK(none.has_value() && seen == 4);
+
+        // Connecting an lvalue copies it.
+        const auto sender = ex::just(std::vector<int>{1, 2, 3}) | ex::then([](std::vector<int> v) { return v.size(); });
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::get<0>(*sync_wait(sender)) == 3 && std::get<0>(*sync_wait(sender)) == 3);
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(ThrowsRuntimeError(ex::just() | ex::then([]() -> int { throw std::runtime_error("then"); })));
+        CPPUTILS_STDREIMPL_TEST_CHECK(ThrowsRuntimeError(JustError() | ex::then([](int i) { return i; })));
+        CPPUTILS_STDREIMPL_TEST_CHECK(!sync_wait(JustStopped() | ex::then([]() { return 1; })).has_value());
+    }
+
+    void TestNoAllocations()
+    {
+        int result = 0;
+        const std::size_t allocations = CountAllocations([&result]()
+        {
+            const auto values = sync_wait(ex::just(20) | ex::then([](int i) { return i * 2; }) | ex::then(Empty()) |
+                ex::let_value([](int& i) { return ex::just(i, 1); }) | ex::then([](int a, int b) { return a + b; }));
+            result = std::get<0>(*values);
+        });
+        CPPUTILS_STDREIMPL_TEST_CHECK(result == 42 && allocations == 0);
+    }
+
+    void TestLetValue()
+    {
+        // The values live until the second sender completes, so it may refer to them.
+        const auto result = sync_wait(ex::just(std::vector<int>{1, 2, 3}) | ex::let_value([](std::vector<int>& v)
+        {
+            return ex::just(&v) | ex::then([](std::vector<int>* p) { return p->size(); });
+        }));
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::get<0>(*result) == 3);
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(ThrowsRuntimeError(ex::just() | ex::let_value([]() { return JustError(); })));
+        CPPUTILS_STDREIMPL_TEST_CHECK(ThrowsRuntimeError(ex::just() | ex::let_value([]() -> decltype(ex::just()) { throw std::runtime_error("let"); })));
+    }
+
+    void TestWhenAll()
+    {
+        const auto values = sync_wait(ex::when_all(ex::just(1), ex::just(), ex::just(2.5, 'c')));
+        CPPUTILS_STDREIMPL_TEST_CHECK(values && *values == std::make_tuple(1, 2.5, 'c'));
+
+        const auto empty = sync_wait(ex::when_all());
+        CPPUTILS_STDREIMPL_TEST_CHECK(empty.has_value());
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(ThrowsRuntimeError(ex::when_all(ex::just(1), JustError())));
+        CPPUTILS_STDREIMPL_TEST_CHECK(!sync_wait(ex::when_all(ex::just(1), JustStopped())).has_value());
+    }
+
+    void TestThreadPool()
+    {
+        ex::static_thread_pool pool(4);
+        const Scheduler sch = pool.get_scheduler();
+        CPPUTILS_STDREIMPL_TEST_CHECK(pool.available_parallelism() == 4 && sch == pool.get_scheduler());
+
+        const std::thread::id caller = std::this_thread::get_id();
+        const auto starts = sync_wait(ex::starts_on(sch, ex::just() | ex::then([]() { return std::this_thread::get_id(); })));
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::get<0>(*starts) != caller);
+
+        const auto moves = sync_wait(ex::just(5) | ex::continues_on(sch) | ex::then([](int i) { return std::make_pair(i, std::this_thread::get_id()); }));
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::get<0>(*moves).first == 5 && std::get<0>(*moves).second != caller);
+
+        // The environment names the pool as the completion scheduler.
+        const auto sender = ex::just() | ex::continues_on(sch);
+        CPPUTILS_STDREIMPL_TEST_CHECK(ex::get_completion_scheduler<ex::set_value_t>(ex::get_env(sender)) == sch);
+
+        // Fork-join, with forks from the pool's own workers, which go to their own deques.
+        std::atomic<int> leaves{0};
+        const auto leaf = [&leaves]() { leaves.fetch_add(1, std::memory_order_relaxed); };
+        const auto branch = [&]()
+        {
+            return ex::when_all(ex::starts_on(sch, ex::just() | ex::then(leaf)), ex::starts_on(sch, ex::just() | ex::then(leaf)),
+                ex::starts_on(sch, ex::just() | ex::then(leaf)));
+        };
+        for (int i = 0; i < 200; ++i)
+        {
+            sync_wait(ex::when_all(ex::starts_on(sch, ex::just() | ex::let_value(branch)), ex::starts_on(sch, ex::just() | ex::let_value(branch))));
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(leaves.load() == 200 * 6);
+
+        // Work scheduled from many threads at once.
+        std::atomic<int> done{0};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&]()
+            {
+                for (int i = 0; i < 500; ++i)
+                {
+                    sync_wait(ex::schedule(sch) | ex::then([&done]() { done.fetch_add(1, std::memory_order_relaxed); }));
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(done.load() == 2000);
+    }
+
+    void TestBulk()
+    {
+        // Off the pool, the calls run in order on the completing thread.
+        std::vector<int> order;
+        sync_wait(ex::just() | ex::bulk(4, [&order](int i) { order.push_back(i); }));
+        CPPUTILS_STDREIMPL_TEST_CHECK((order == std::vector<int>{0, 1, 2, 3}));
+
+        ex::static_thread_pool pool(4);
+        const Scheduler sch = pool.get_scheduler();
+
+        // On the pool, each index is visited exactly once, and the values are passed through.
+        std::vector<std::atomic<int>> visits(10000);
+        const auto result = sync_wait(ex::just(7) | ex::continues_on(sch) | ex::bulk(10000, [&visits](std::size_t i, int& seven)
+        {
+            visits[i].fetch_add(seven, std::memory_order_relaxed);
+        }) | ex::bulk(10000, [&visits](std::size_t i, int) { visits[i].fetch_add(1, std::memory_order_relaxed); }));
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::get<0>(*result) == 7);
+
+        bool allVisited = true;
+        for (const std::atomic<int>& visit : visits)
+        {
+            allVisited = allVisited && visit.load() == 8;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(allVisited);
+
+        // Fewer indices than threads, and none at all.
+        std::atomic<int> count{0};
+        sync_wait(ex::schedule(sch) | ex::bulk(2, [&count](int) { count.fetch_add(1); }) | ex::bulk(0, [&count](int) { count.fetch_add(1); }));
+        CPPUTILS_STDREIMPL_TEST_CHECK(count.load() == 2);
+
+        // The first exception stops the rest and becomes the error.
+        CPPUTILS_STDREIMPL_TEST_CHECK(ThrowsRuntimeError(ex::schedule(sch) | ex::bulk(100000, [](int i)
+        {
+            if (i == 500)
+            {
+                throw std::runtime_error("bulk");
+            }
+        })));
+    }
+}
+
+int main()
+{
+    TestJustThen();
+    TestNoAllocations();
+    TestLetValue();
+    TestWhenAll();
+    TestThreadPool();
+    TestBulk();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,314 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/expected.h>
+
+#include "TestCheck.h"
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using StdReimpl::expected;
+    using StdReimpl::unexpect;
+    using StdReimpl::unexpected;
+
+    enum class ErrorCode : std::uint8_t
+    {
+        None,
+        NotFound,
+        AccessDenied,
+        EndOfFile
+    };
+}
+
+template <>
+struct StdReimpl::expected_niche<ErrorCode>
+{
+    static constexpr ErrorCode value = ErrorCode::None;
+};
+
+namespace
+{
+    enum class OtherError
+    {
+        Timeout,
+        Refused
+    };
+
+    // The flag goes in the padding, and the result is as cheap to return as the value alone.
+    static_assert(sizeof(expected<int, ErrorCode>) == 8);
+    static_assert(sizeof(expected<std::int16_t, ErrorCode>) == 4);
+    static_assert(sizeof(expected<void, ErrorCode>) == sizeof(ErrorCode));
+    static_assert(sizeof(expected<void, OtherError>) == 8);
+    static_assert(std::is_trivially_copyable_v<expected<int, ErrorCode>>);
+    static_assert(std::is_trivially_copyable_v<expected<void, ErrorCode>>);
+    static_assert(std::is_trivially_copyable_v<expected<void, OtherError>>);
+    static_assert(std::is_trivially_destructible_v<expected<double, OtherError>>);
+    static_assert(!std::is_trivially_copyable_v<expected<std::string, ErrorCode>>);
+
+    static_assert(std::is_same_v<expected<int, ErrorCode>::rebind<float>, expected<float, ErrorCode>>);
+    static_assert(std::is_same_v<decltype(unexpected(ErrorCode::NotFound)), unexpected<ErrorCode>>);
+    static_assert(std::is_convertible_v<int, expected<long, ErrorCode>>);
+    static_assert(!std::is_convertible_v<std::size_t, expected<std::string, int>>);
+    static_assert(!std::is_copy_constructible_v<expected<std::unique_ptr<int>, int>>);
+    static_assert(std::is_move_constructible_v<expected<std::unique_ptr<int>, int>>);
+
+    constexpr expected<int, ErrorCode> ParseDigit(char c)
+    {
+        if (c < '0' || c > '9')
+        {
+            return unexpected(ErrorCode::NotFound);
+        }
+        return c - '0';
+    }
+
+    constexpr int ConstantEvaluate()
+    {
+        expected<int, ErrorCode> digit = ParseDigit('7');
+        const expected<int, ErrorCode> error = ParseDigit('x');
+        digit = error;
+        digit = 5;
+        return *digit.and_then([](int value) { return ParseDigit(static_cast<char>('0' + value - 1)); })
+            .transform([](int value) { return value * 10; }) + static_cast<int>(error.error());
+    }
+    static_assert(ConstantEvaluate() == 41);
+
+    void TestBasics()
+    {
+        expected<int, ErrorCode> value = 42;
+        CPPUTILS_STDREIMPL_TEST_CHECK(value.has_value() && value && *value == 42 && value.value() == 42);
+        CPPUTILS_STDREIMPL_TEST_CHECK(value.value_or(0) == 42 && value.error_or(ErrorCode::None) == ErrorCode::None);
+
+        expected<int, ErrorCode> error = unexpected(ErrorCode::AccessDenied);
+        CPPUTILS_STDREIMPL_TEST_CHECK(!error.has_value() && !error && error.error() == ErrorCode::AccessDenied);
+        CPPUTILS_STDREIMPL_TEST_CHECK(error.value_or(-1) == -1 && error.error_or(ErrorCode::None) == ErrorCode::AccessDenied);
+        CPPUTILS_STDREIMPL_TEST_CHECK(error.emplace(7) == 7 && *error == 7);
+        error = unexpected(ErrorCode::AccessDenied);
+
+        expected<std::string, std::string> text(std::in_place, 3, 'a');
+        CPPUTILS_STDREIMPL_TEST_CHECK(*text == "aaa" && text->size() == 3);
+        expected<std::string, std::string> textError(unexpect, "bad");
+        CPPUTILS_STDREIMPL_TEST_CHECK(textError.error() == "bad");
+
+        expected<std::vector<int>, int> list(std::in_place, {1, 2, 3});
+        CPPUTILS_STDREIMPL_TEST_CHECK(list->size() == 3);
+
+        // Converting from another `expected`.
+        const expected<long, ErrorCode> widened = value;
+        CPPUTILS_STDREIMPL_TEST_CHECK(*widened == 42);
+        const expected<long, ErrorCode> widenedError = error;
+        CPPUTILS_STDREIMPL_TEST_CHECK(widenedError.error() == ErrorCode::AccessDenied);
+
+        // Default-constructs the value.
+        const expected<std::string, int> empty;
+        CPPUTILS_STDREIMPL_TEST_CHECK(empty.has_value() && empty->empty());
+
+        expected<std::unique_ptr<int>, int> owner = std::make_unique<int>(3);
+        expected<std::unique_ptr<int>, int> moved = std::move(owner);
+        CPPUTILS_STDREIMPL_TEST_CHECK(**moved == 3);
+        std::unique_ptr<int> released = std::move(moved).value();
+        CPPUTILS_STDREIMPL_TEST_CHECK(*released == 3);
+    }
+
+    void TestVoid()
+    {
+        expected<void, ErrorCode> ok;
+        CPPUTILS_STDREIMPL_TEST_CHECK(ok.has_value() && ok.error_or(ErrorCode::EndOfFile) == ErrorCode::EndOfFile);
+        ok.value();
+
+        ok = unexpected(ErrorCode::NotFound);
+        CPPUTILS_STDREIMPL_TEST_CHECK(!ok.has_value() && ok.error() == ErrorCode::NotFound);
+        ok.emplace();
+        CPPUTILS_STDREIMPL_TEST_CHECK(ok.has_value());
+
+        expected<void, std::string> message(unexpect, "oops");
+        CPPUTILS_STDREIMPL_TEST_CHECK(!message && message.error() == "oops");
+        expected<void, std::string> copy = message;
+        message = expected<void, std::string>();
+        CPPUTILS_STDREIMPL_TEST_CHECK(message && copy.error() == "oops");
+        swap(message, copy);
+        CPPUTILS_STDREIMPL_TEST_CHECK(!message && copy && message.error() == "oops");
+
+        const expected<void, OtherError> other(unexpect, OtherError::Refused);
+        CPPUTILS_STDREIMPL_TEST_CHECK(other.error() == OtherError::Refused);
+        CPPUTILS_STDREIMPL_TEST_CHECK(other.transform_error([](OtherError) { return ErrorCode::AccessDenied; }).error() == ErrorCode::AccessDenied);
+    }
+
+    void TestMonadicOperations()
+    {
+        const auto half = [](int value) -> expected<int, ErrorCode>
+            {
+                if (value % 2 != 0)
+                {
+                    return unexpected(ErrorCode::NotFound);
+                }
+                return value / 2;
+            };
+
+        const expected<int, ErrorCode> eight = 8;
+        CPPUTILS_STDREIMPL_TEST_CHECK(*eight.and_then(half).and_then(half).and_then(half) == 1);
+        CPPUTILS_STDREIMPL_TEST_CHECK(eight.and_then(half).and_then(half).and_then(half).and_then(half).error() == ErrorCode::NotFound);
+
+        // `and_then` doesn't call the function on an error.
+        int calls = 0;
+        const expected<int, ErrorCode> error = unexpected(ErrorCode::EndOfFile);
+        const auto counted = error.and_then([&](int value) { ++calls; return expected<int, ErrorCode>(value); });
+        CPPUTILS_STDREIMPL_TEST_CHECK(calls == 0 && counted.error() == ErrorCode::EndOfFile);
+
+        const expected<std::string, ErrorCode> text = eight.transform([](int value) { return std::to_string(value); });
+        CPPUTILS_STDREIMPL_TEST_CHECK(*text == "8");
+        const expected<void, ErrorCode> discarded = eight.transform([](int) {});
+        CPPUTILS_STDREIMPL_TEST_CHECK(discarded.has_value());
+
+        const auto recovered = error.or_else([](ErrorCode code)
+            {
+                return code == ErrorCode::EndOfFile ? expected<int, OtherError>(0) : expected<int, OtherError>(unexpect, OtherError::Refused);
+            });
+        CPPUTILS_STDREIMPL_TEST_CHECK(*recovered == 0);
+        CPPUTILS_STDREIMPL_TEST_CHECK(*eight.or_else([](ErrorCode) { return expected<int, OtherError>(unexpect, OtherError::Timeout); }) == 8);
+
+        const expected<int, std::string> described = error.transform_error([](ErrorCode code) { return "error " + std::to_string(static_cast<int>(code)); });
+        CPPUTILS_STDREIMPL_TEST_CHECK(described.error() == "error 3");
+        CPPUTILS_STDREIMPL_TEST_CHECK(*eight.transform_error([](ErrorCode) { return 0; }) == 8);
+
+        // Rvalue overloads move the value through.
+        expected<std::unique_ptr<int>, ErrorCode> owner = std::make_unique<int>(5);
+        const expected<int, ErrorCode> unwrapped = std::move(owner).transform([](std::unique_ptr<int>&& pointer) { return *pointer; });
+        CPPUTILS_STDREIMPL_TEST_CHECK(*unwrapped == 5);
+
+        // On `expected<void, E>`.
+        expected<void, ErrorCode> ok;
+        CPPUTILS_STDREIMPL_TEST_CHECK(*ok.transform([]() { return 3; }) == 3);
+        CPPUTILS_STDREIMPL_TEST_CHECK(*ok.and_then([]() { return expected<int, ErrorCode>(4); }) == 4);
+        ok = unexpected(ErrorCode::NotFound);
+        CPPUTILS_STDREIMPL_TEST_CHECK(ok.transform([]() { return 3; }).error() == ErrorCode::NotFound);
+        CPPUTILS_STDREIMPL_TEST_CHECK(ok.or_else([](ErrorCode) { return expected<void, OtherError>(); }).has_value());
+    }
+
+    void TestAssignmentAndSwap()
+    {
+        expected<std::string, std::string> a = std::string("value");
+        expected<std::string, std::string> b(unexpect, "error");
+
+        a = b;
+        CPPUTILS_STDREIMPL_TEST_CHECK(!a && a.error() == "error");
+        a = std::string("again");
+        CPPUTILS_STDREIMPL_TEST_CHECK(a && *a == "again");
+        a = unexpected(std::string("later"));
+        CPPUTILS_STDREIMPL_TEST_CHECK(!a && a.error() == "later");
+        a = std::string("emplaced");
+        CPPUTILS_STDREIMPL_TEST_CHECK(a && *a == "emplaced");
+
+        swap(a, b);
+        CPPUTILS_STDREIMPL_TEST_CHECK(!a && a.error() == "error" && b && *b == "emplaced");
+        a.swap(b);
+        CPPUTILS_STDREIMPL_TEST_CHECK(a && *a == "emplaced" && !b && b.error() == "error");
+
+        b = std::move(a);
+        CPPUTILS_STDREIMPL_TEST_CHECK(b && *b == "emplaced");
+    }
+
+    /**
+     * @brief Throws when a negative one is copied, and has a move that might throw, so that assigning it over an error
+     *        has to move the error out of the way first.
+     */
+    struct ThrowingValue
+    {
+        explicit ThrowingValue(int inValue)
+            : value(inValue)
+        {
+        }
+
+        ThrowingValue(const ThrowingValue& other)
+            : value(other.value)
+        {
+            if (value < 0)
+            {
+                throw std::runtime_error("negative");
+            }
+        }
+
+        ThrowingValue(ThrowingValue&& other) noexcept(false)
+            : value(other.value)
+        {
+        }
+
+        ThrowingValue& operator=(const ThrowingValue&) = default;
+        ThrowingValue& operator=(ThrowingValue&&) noexcept(false) = default;
+
+        int value;
+    };
+
+    void TestExceptions()
+    {
+        expected<ThrowingValue, std::string> e(unexpect, "kept");
+
+        bool threw = false;
+        try
+        {
+            static_cast<void>(e.value());
+        }
+        catch (const StdReimpl::bad_expected_access<std::string>& exception)
+        {
+            threw = exception.error() == "kept";
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(threw);
+
+        // Copying the value in throws, so the error is put back.
+        threw = false;
+        const expected<ThrowingValue, std::string> negative(std::in_place, -1);
+        try
+        {
+            e = negative;
+        }
+        catch (const std::runtime_error&)
+        {
+            threw = true;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(threw && !e && e.error() == "kept");
+
+        const expected<ThrowingValue, std::string> positive(std::in_place, 2);
+        e = positive;
+        CPPUTILS_STDREIMPL_TEST_CHECK(e && e->value == 2);
+
+        // Swapping a value with an error.
+        expected<ThrowingValue, std::string> error(unexpect, "swapped");
+        swap(e, error);
+        CPPUTILS_STDREIMPL_TEST_CHECK(!e && e.error() == "swapped" && error && error->value == 2);
+    }
+
+    void TestComparisons()
+    {
+        const expected<int, ErrorCode> one = 1;
+        const expected<long, ErrorCode> alsoOne = 1L;
+        const expected<int, ErrorCode> error = unexpected(ErrorCode::NotFound);
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(one == alsoOne && one != error);
+        CPPUTILS_STDREIMPL_TEST_CHECK(one == 1 && one != 2 && error != 1);
+        CPPUTILS_STDREIMPL_TEST_CHECK(error == unexpected(ErrorCode::NotFound) && one != unexpected(ErrorCode::NotFound));
+
+        const expected<void, ErrorCode> ok;
+        const expected<void, ErrorCode> failed = unexpected(ErrorCode::NotFound);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ok == expected<void, ErrorCode>() && ok != failed));
+        CPPUTILS_STDREIMPL_TEST_CHECK(failed == unexpected(ErrorCode::NotFound));
+        CPPUTILS_STDREIMPL_TEST_CHECK(unexpected(1) == unexpected(1L) && unexpected(1) != unexpected(2));
+    }
+}
+
+int main()
+{
+    TestBasics();
+    TestVoid();
+    TestMonadicOperations();
+    TestAssignmentAndSwap();
+    TestExceptions();
+    TestComparisons();
+
+    return StdReimplTests::GetExitCode();
+}
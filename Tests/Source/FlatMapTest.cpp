@@ -0,0 +1,362 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/flat_map.h>
+
+#include "TestCheck.h"
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using StdReimpl::flat_search_mode;
+
+    static_assert(std::random_access_iterator<StdReimpl::flat_map<int, int>::iterator> ||
+        !std::indirectly_readable<StdReimpl::flat_map<int, int>::iterator>,
+        "The iterator only misses random access when the standard library can't make a common reference of pairs.");
+    static_assert(std::is_convertible_v<StdReimpl::flat_map<int, int>::iterator, StdReimpl::flat_map<int, int>::const_iterator>);
+    static_assert(std::is_same_v<StdReimpl::flat_map<int, int>::reference, std::pair<const int&, int&>>);
+    static_assert(std::is_same_v<decltype(StdReimpl::flat_map<int, int>().insert({1, 2})), std::pair<StdReimpl::flat_map<int, int>::iterator, bool>>);
+    static_assert(std::is_same_v<decltype(StdReimpl::flat_multimap<int, int>().insert({1, 2})), StdReimpl::flat_multimap<int, int>::iterator>);
+
+    // Deduction guides.
+    static_assert(std::is_same_v<decltype(StdReimpl::flat_map(std::vector<int>{}, std::vector<char>{})), StdReimpl::flat_map<int, char>>);
+    static_assert(std::is_same_v<decltype(StdReimpl::flat_map{std::pair{1, 'a'}, std::pair{2, 'b'}}), StdReimpl::flat_map<int, char>>);
+    static_assert(std::is_same_v<decltype(StdReimpl::flat_multimap(StdReimpl::sorted_equivalent, std::deque<int>{}, std::vector<int>{})),
+        StdReimpl::flat_multimap<int, int, std::less<int>, std::deque<int>>>);
+
+    template <class Map>
+    std::vector<std::pair<typename Map::key_type, typename Map::mapped_type>> ToPairs(const Map& map)
+    {
+        std::vector<std::pair<typename Map::key_type, typename Map::mapped_type>> result;
+        for (const auto& [key, value] : map)
+        {
+            result.emplace_back(key, value);
+        }
+        return result;
+    }
+
+    using Pairs = std::vector<std::pair<int, std::string>>;
+
+    template <flat_search_mode Mode>
+    void TestBasics()
+    {
+        using Map = StdReimpl::flat_map<int, std::string, std::less<int>, std::vector<int>, std::vector<std::string>, Mode>;
+
+        // Unsorted input is sorted, and the first of equivalent keys wins.
+        Map map = {{3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}};
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToPairs(map) == Pairs{{1, "a"}, {2, "b"}, {3, "c"}}));
+        CPPUTILS_STDREIMPL_TEST_CHECK((map.keys() == std::vector<int>{1, 2, 3}));
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(map[2] == "b");
+        map[5] = "e";
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.size() == 4 && map.at(5) == "e");
+
+        auto [it, inserted] = map.insert({4, "d"});
+        CPPUTILS_STDREIMPL_TEST_CHECK(inserted && it->first == 4 && it->second == "d");
+        std::tie(it, inserted) = map.emplace(4, "not d");
+        CPPUTILS_STDREIMPL_TEST_CHECK(!inserted && it->second == "d");
+
+        std::tie(it, inserted) = map.try_emplace(0, 3, 'z');
+        CPPUTILS_STDREIMPL_TEST_CHECK(inserted && it == map.begin() && it->second == "zzz");
+        std::tie(it, inserted) = map.insert_or_assign(0, "o");
+        CPPUTILS_STDREIMPL_TEST_CHECK(!inserted && map.at(0) == "o");
+
+        // Hints, both right and wrong.
+        it = map.emplace_hint(map.end(), 6, "f");
+        CPPUTILS_STDREIMPL_TEST_CHECK(it->first == 6 && map.end() - 1 == it);
+        it = map.try_emplace(map.begin(), 7, "g");
+        CPPUTILS_STDREIMPL_TEST_CHECK(it->first == 7 && it->second == "g");
+        it = map.insert(map.begin(), {7, "not g"});
+        CPPUTILS_STDREIMPL_TEST_CHECK(it->first == 7 && it->second == "g");
+        CPPUTILS_STDREIMPL_TEST_CHECK((map.keys() == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}));
+
+        // Lookups.
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.find(3) != map.end() && map.find(3)->second == "c");
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.find(8) == map.end());
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.contains(0) && !map.contains(-1));
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.count(2) == 1 && map.count(9) == 0);
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.lower_bound(3) == map.find(3) && map.upper_bound(3) == map.find(4));
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.equal_range(3) == std::make_pair(map.find(3), map.find(4)));
+
+        bool threw = false;
+        try
+        {
+            static_cast<void>(map.at(42));
+        }
+        catch (const std::out_of_range&)
+        {
+            threw = true;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(threw);
+
+        // Erasure.
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.erase(3) == 1 && map.erase(3) == 0);
+        it = map.erase(map.begin());
+        CPPUTILS_STDREIMPL_TEST_CHECK(it == map.begin() && it->first == 1);
+        it = map.erase(map.find(4), map.find(6));
+        CPPUTILS_STDREIMPL_TEST_CHECK(it->first == 6);
+        CPPUTILS_STDREIMPL_TEST_CHECK((map.keys() == std::vector<int>{1, 2, 6, 7}));
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::erase_if(map, [](const auto& element) { return element.first % 2 == 0; }) == 2);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToPairs(map) == Pairs{{1, "a"}, {7, "g"}}));
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.find(7)->second == "g");
+
+        // Values can be changed through iterators.
+        for (auto [key, value] : map)
+        {
+            value += "!";
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToPairs(map) == Pairs{{1, "a!"}, {7, "g!"}}));
+
+        // Bulk insertion merges, and existing elements win.
+        const Pairs more = {{9, "i"}, {1, "not a"}, {8, "h"}, {0, "-"}};
+        map.insert(more.begin(), more.end());
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToPairs(map) == Pairs{{0, "-"}, {1, "a!"}, {7, "g!"}, {8, "h"}, {9, "i"}}));
+        map.insert(StdReimpl::sorted_unique, {{2, "b"}, {10, "j"}});
+        CPPUTILS_STDREIMPL_TEST_CHECK((map.keys() == std::vector<int>{0, 1, 2, 7, 8, 9, 10}));
+        map.insert_range(Pairs{{3, "c"}});
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.size() == 8 && map.at(3) == "c");
+
+        // Comparisons.
+        Map copy = map;
+        CPPUTILS_STDREIMPL_TEST_CHECK(copy == map);
+        copy[3] = "d";
+        CPPUTILS_STDREIMPL_TEST_CHECK(copy != map && map < copy);
+
+        // Extracting leaves it empty, and `replace` puts containers back.
+        auto containers = std::move(copy).extract();
+        CPPUTILS_STDREIMPL_TEST_CHECK(copy.empty() && containers.keys.size() == 8);
+        copy.replace(std::move(containers.keys), std::move(containers.values));
+        CPPUTILS_STDREIMPL_TEST_CHECK(copy.size() == 8 && copy.at(3) == "d" && copy.find(10) != copy.end());
+
+        copy = {{2, "b"}, {1, "a"}};
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToPairs(copy) == Pairs{{1, "a"}, {2, "b"}}));
+        swap(copy, map);
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.size() == 2 && copy.size() == 8 && copy.contains(10) && map.contains(1));
+        map.clear();
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.empty() && map.begin() == map.end() && !map.contains(1));
+    }
+
+    template <flat_search_mode Mode>
+    void TestMultimap()
+    {
+        using Map = StdReimpl::flat_multimap<int, std::string, std::less<int>, std::vector<int>, std::vector<std::string>, Mode>;
+
+        // Equivalent keys keep their order, and new ones go after the old ones.
+        Map map = {{2, "b1"}, {1, "a"}, {2, "b2"}};
+        map.emplace(2, "b3");
+        map.insert({0, "z"});
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToPairs(map) == Pairs{{0, "z"}, {1, "a"}, {2, "b1"}, {2, "b2"}, {2, "b3"}}));
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.count(2) == 3 && map.count(1) == 1);
+
+        auto [first, last] = map.equal_range(2);
+        CPPUTILS_STDREIMPL_TEST_CHECK(last - first == 3 && first->second == "b1" && last == map.end());
+
+        // A hint is used as is when the key belongs there, and as closely as possible when it doesn't.
+        auto it = map.emplace_hint(map.find(2), 2, "b0");
+        CPPUTILS_STDREIMPL_TEST_CHECK(it == map.find(2) && it->second == "b0");
+        it = map.emplace_hint(map.begin(), 2, "b4");
+        CPPUTILS_STDREIMPL_TEST_CHECK(it == map.lower_bound(2));
+        it = map.emplace_hint(map.end(), 1, "a2");
+        CPPUTILS_STDREIMPL_TEST_CHECK(it == map.lower_bound(2) - 1 && it->second == "a2");
+
+        const Pairs more = {{1, "a3"}, {3, "c"}};
+        map.insert(more.begin(), more.end());
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.count(1) == 3 && (map.upper_bound(1) - 1)->second == "a3");
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.erase(2) == 5);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToPairs(map) == Pairs{{0, "z"}, {1, "a"}, {1, "a2"}, {1, "a3"}, {3, "c"}}));
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::erase_if(map, [](const auto& element) { return element.first == 1; }) == 3);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToPairs(map) == Pairs{{0, "z"}, {3, "c"}}));
+    }
+
+    void TestHeterogeneousLookup()
+    {
+        StdReimpl::flat_map<std::string, int, std::less<>> map = {{"one", 1}, {"two", 2}};
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.contains(std::string_view("one")) && map.find("two")->second == 2);
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.at(std::string_view("two")) == 2);
+        map[std::string_view("three")] = 3;
+        map.try_emplace("four", 4);
+        map.insert_or_assign(std::string_view("one"), 11);
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.size() == 4 && map.at("three") == 3 && map.at("one") == 11);
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.erase("four") == 1 && map.count("four") == 0);
+    }
+
+    void TestOtherContainers()
+    {
+        // Deques are random access, but not contiguous, so they search with the binary search even for small tables.
+        StdReimpl::flat_map<int, int, std::less<int>, std::deque<int>, std::deque<int>> map;
+        for (int i = 0; i < 50; ++i)
+        {
+            map.emplace((i * 37) % 50, i);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.size() == 50);
+        for (int i = 0; i < 50; ++i)
+        {
+            CPPUTILS_STDREIMPL_TEST_CHECK(map.find(i) != map.end() && map.find(i)->first == i);
+        }
+
+        // A descending order is fine too; it just isn't the order the linear scan counts in.
+        StdReimpl::flat_map<int, int, std::greater<int>> descending = {{1, 1}, {3, 3}, {2, 2}};
+        CPPUTILS_STDREIMPL_TEST_CHECK((descending.keys() == std::vector<int>{3, 2, 1}));
+        CPPUTILS_STDREIMPL_TEST_CHECK(descending.lower_bound(2)->first == 2 && descending.upper_bound(2)->first == 1);
+    }
+
+    /**
+     * @brief Compares every lookup against `std::map`, for sizes on both sides of the linear scan threshold. This is what
+     *        covers the SIMD scan for each key type, and the Eytzinger search.
+     */
+    template <class Key, flat_search_mode Mode>
+    void TestLookupsMatchStdMap()
+    {
+        std::mt19937 random(1234);
+
+        for (int size : {0, 1, 2, 3, 7, 8, 9, 16, 31, 32, 33, 64, 100, 1000})
+        {
+            std::map<Key, int> expected;
+            StdReimpl::flat_map<Key, int, std::less<Key>, std::vector<Key>, std::vector<int>, Mode> map;
+            for (int i = 0; i < size; ++i)
+            {
+                // Spread the keys out so that there are gaps to look up, and include negatives for the signed types.
+                const Key key = static_cast<Key>(static_cast<int>(random() % 4000) - (std::is_signed_v<Key> ? 2000 : 0));
+                expected.emplace(key, i);
+                map.emplace(key, i);
+            }
+            CPPUTILS_STDREIMPL_TEST_CHECK(map.size() == expected.size());
+
+            for (int probe = -2100; probe < 4100; probe += 7)
+            {
+                const Key key = static_cast<Key>(probe);
+                const auto expectedLower = static_cast<std::size_t>(std::distance(expected.begin(), expected.lower_bound(key)));
+                const auto expectedUpper = static_cast<std::size_t>(std::distance(expected.begin(), expected.upper_bound(key)));
+
+                CPPUTILS_STDREIMPL_TEST_CHECK(static_cast<std::size_t>(map.lower_bound(key) - map.begin()) == expectedLower);
+                CPPUTILS_STDREIMPL_TEST_CHECK(static_cast<std::size_t>(map.upper_bound(key) - map.begin()) == expectedUpper);
+                CPPUTILS_STDREIMPL_TEST_CHECK(map.contains(key) == expected.contains(key));
+            }
+
+            // Every key that's there is found, with its value.
+            for (const auto& [key, value] : expected)
+            {
+                const auto found = map.find(key);
+                CPPUTILS_STDREIMPL_TEST_CHECK(found != map.end() && found->second == value);
+            }
+        }
+    }
+
+    /**
+     * @brief Counts comparisons, so that we can tell whether something was sorted.
+     */
+    struct CountingLess
+    {
+        static inline int s_Count = 0;
+
+        bool operator()(int a, int b) const
+        {
+            ++s_Count;
+            return a < b;
+        }
+    };
+
+    void TestSortedConstructorsDoNotSort()
+    {
+        std::vector<int> keys(1000);
+        std::vector<int> values(1000);
+        for (int i = 0; i < 1000; ++i)
+        {
+            keys[i] = i;
+            values[i] = -i;
+        }
+
+        // Checking the precondition in debug builds is one pass; sorting would be far more.
+        CountingLess::s_Count = 0;
+        StdReimpl::flat_map<int, int, CountingLess> map(StdReimpl::sorted_unique, keys, values);
+        CPPUTILS_STDREIMPL_TEST_CHECK(CountingLess::s_Count < 1000);
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.size() == 1000 && map.at(500) == -500);
+
+        // Unsorted containers get sorted.
+        std::vector<int> reversedKeys(keys.rbegin(), keys.rend());
+        std::vector<int> reversedValues(values.rbegin(), values.rend());
+        StdReimpl::flat_map<int, int> sorted(std::move(reversedKeys), std::move(reversedValues));
+        CPPUTILS_STDREIMPL_TEST_CHECK(sorted.keys() == keys && sorted.values() == values);
+    }
+
+    struct ThrowingValue
+    {
+        static inline bool s_Throw = false;
+
+        int value = 0;
+
+        ThrowingValue(int inValue)
+            : value(inValue)
+        {
+            if (s_Throw)
+            {
+                throw std::runtime_error("ThrowingValue");
+            }
+        }
+    };
+
+    void TestExceptionsLeaveItValid()
+    {
+        StdReimpl::flat_map<int, ThrowingValue, std::less<int>, std::vector<int>, std::vector<ThrowingValue>, flat_search_mode::eytzinger> map;
+        for (int i = 0; i < 100; ++i)
+        {
+            map.try_emplace(i, i);
+        }
+
+        // The key has been inserted by the time the value throws. The standard lets us restore the invariants by clearing.
+        ThrowingValue::s_Throw = true;
+        bool threw = false;
+        try
+        {
+            map.try_emplace(1000, 1000);
+        }
+        catch (const std::runtime_error&)
+        {
+            threw = true;
+        }
+        ThrowingValue::s_Throw = false;
+        CPPUTILS_STDREIMPL_TEST_CHECK(threw);
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.keys().size() == map.values().size());
+        CPPUTILS_STDREIMPL_TEST_CHECK(!map.contains(1000));
+
+        map.try_emplace(5, 5);
+        CPPUTILS_STDREIMPL_TEST_CHECK(map.find(5) != map.end() && map.find(5)->second.value == 5);
+    }
+}
+
+int main()
+{
+    TestBasics<flat_search_mode::binary>();
+    TestBasics<flat_search_mode::eytzinger>();
+    TestMultimap<flat_search_mode::binary>();
+    TestMultimap<flat_search_mode::eytzinger>();
+    TestHeterogeneousLookup();
+    TestOtherContainers();
+
+    TestLookupsMatchStdMap<int, flat_search_mode::binary>();
+    TestLookupsMatchStdMap<int, flat_search_mode::eytzinger>();
+    TestLookupsMatchStdMap<unsigned int, flat_search_mode::binary>();
+    TestLookupsMatchStdMap<std::int64_t, flat_search_mode::binary>();
+    TestLookupsMatchStdMap<std::uint64_t, flat_search_mode::eytzinger>();
+    TestLookupsMatchStdMap<short, flat_search_mode::binary>();
+    TestLookupsMatchStdMap<float, flat_search_mode::binary>();
+    TestLookupsMatchStdMap<double, flat_search_mode::eytzinger>();
+
+    TestSortedConstructorsDoNotSort();
+    TestExceptionsLeaveItValid();
+
+    return StdReimplTests::GetExitCode();
+}
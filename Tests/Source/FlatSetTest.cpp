@@ -0,0 +1,239 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/flat_set.h>
+
+#include "TestCheck.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using StdReimpl::flat_search_mode;
+
+    static_assert(std::random_access_iterator<StdReimpl::flat_set<int>::iterator>);
+    static_assert(std::is_same_v<StdReimpl::flat_set<int>::iterator, StdReimpl::flat_set<int>::const_iterator>);
+    static_assert(std::is_same_v<decltype(StdReimpl::flat_set<int>().insert(1)), std::pair<StdReimpl::flat_set<int>::iterator, bool>>);
+    static_assert(std::is_same_v<decltype(StdReimpl::flat_multiset<int>().insert(1)), StdReimpl::flat_multiset<int>::iterator>);
+
+    // Deduction guides.
+    static_assert(std::is_same_v<decltype(StdReimpl::flat_set(std::vector<short>{})), StdReimpl::flat_set<short>>);
+    static_assert(std::is_same_v<decltype(StdReimpl::flat_set{1, 2, 3}), StdReimpl::flat_set<int>>);
+    static_assert(std::is_same_v<decltype(StdReimpl::flat_multiset(StdReimpl::sorted_equivalent, std::deque<int>{})),
+        StdReimpl::flat_multiset<int, std::less<int>, std::deque<int>>>);
+
+    template <class Set>
+    std::vector<typename Set::key_type> ToVector(const Set& set)
+    {
+        return std::vector<typename Set::key_type>(set.begin(), set.end());
+    }
+
+    template <flat_search_mode Mode>
+    void TestBasics()
+    {
+        using Set = StdReimpl::flat_set<int, std::less<int>, std::vector<int>, Mode>;
+
+        Set set = {5, 1, 4, 1, 3};
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToVector(set) == std::vector<int>{1, 3, 4, 5}));
+
+        auto [it, inserted] = set.insert(2);
+        CPPUTILS_STDREIMPL_TEST_CHECK(inserted && *it == 2 && it - set.begin() == 1);
+        std::tie(it, inserted) = set.emplace(2);
+        CPPUTILS_STDREIMPL_TEST_CHECK(!inserted && *it == 2);
+
+        it = set.insert(set.end(), 6);
+        CPPUTILS_STDREIMPL_TEST_CHECK(*it == 6 && it == set.end() - 1);
+        it = set.insert(set.end(), 0);
+        CPPUTILS_STDREIMPL_TEST_CHECK(*it == 0 && it == set.begin());
+        it = set.emplace_hint(set.begin(), 3);
+        CPPUTILS_STDREIMPL_TEST_CHECK(*it == 3 && set.size() == 7);
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(set.contains(4) && !set.contains(7) && set.count(0) == 1);
+        CPPUTILS_STDREIMPL_TEST_CHECK(*set.find(5) == 5 && set.find(-1) == set.end());
+        CPPUTILS_STDREIMPL_TEST_CHECK(*set.lower_bound(4) == 4 && *set.upper_bound(4) == 5);
+        CPPUTILS_STDREIMPL_TEST_CHECK(set.equal_range(4).second - set.equal_range(4).first == 1);
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(set.erase(3) == 1 && set.erase(3) == 0);
+        it = set.erase(set.begin());
+        CPPUTILS_STDREIMPL_TEST_CHECK(*it == 1);
+        it = set.erase(set.find(4), set.end());
+        CPPUTILS_STDREIMPL_TEST_CHECK(it == set.end());
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToVector(set) == std::vector<int>{1, 2}));
+
+        // Bulk insertion merges the new elements in.
+        const std::vector<int> more = {9, 2, 7, 8, 7};
+        set.insert(more.begin(), more.end());
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToVector(set) == std::vector<int>{1, 2, 7, 8, 9}));
+        set.insert(StdReimpl::sorted_unique, {0, 10});
+        set.insert_range(std::vector<int>{5, 3});
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToVector(set) == std::vector<int>{0, 1, 2, 3, 5, 7, 8, 9, 10}));
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::erase_if(set, [](int key) { return key % 2 == 1; }) == 5);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToVector(set) == std::vector<int>{0, 2, 8, 10}));
+        CPPUTILS_STDREIMPL_TEST_CHECK(set.contains(8) && !set.contains(9));
+
+        Set copy = set;
+        CPPUTILS_STDREIMPL_TEST_CHECK(copy == set);
+        copy.insert(1);
+        CPPUTILS_STDREIMPL_TEST_CHECK(copy != set && copy < set);
+
+        std::vector<int> keys = std::move(copy).extract();
+        CPPUTILS_STDREIMPL_TEST_CHECK(copy.empty() && keys.size() == 5);
+        keys.push_back(11);
+        copy.replace(std::move(keys));
+        CPPUTILS_STDREIMPL_TEST_CHECK(copy.size() == 6 && copy.contains(11) && copy.contains(1));
+
+        copy = {3, 2};
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToVector(copy) == std::vector<int>{2, 3}));
+        swap(copy, set);
+        CPPUTILS_STDREIMPL_TEST_CHECK(set.size() == 2 && copy.size() == 4 && copy.contains(10));
+        set.clear();
+        CPPUTILS_STDREIMPL_TEST_CHECK(set.empty() && !set.contains(2));
+    }
+
+    template <flat_search_mode Mode>
+    void TestMultiset()
+    {
+        using Set = StdReimpl::flat_multiset<int, std::less<int>, std::vector<int>, Mode>;
+
+        Set set = {3, 1, 3, 2, 3};
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToVector(set) == std::vector<int>{1, 2, 3, 3, 3}));
+        set.insert(1);
+        set.emplace_hint(set.end(), 1);
+        CPPUTILS_STDREIMPL_TEST_CHECK(set.count(1) == 3 && set.count(3) == 3 && set.count(4) == 0);
+
+        auto [first, last] = set.equal_range(3);
+        CPPUTILS_STDREIMPL_TEST_CHECK(last - first == 3 && last == set.end());
+
+        set.insert(StdReimpl::sorted_equivalent, {0, 0, 4});
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToVector(set) == std::vector<int>{0, 0, 1, 1, 1, 2, 3, 3, 3, 4}));
+        CPPUTILS_STDREIMPL_TEST_CHECK(set.erase(1) == 3);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::erase_if(set, [](int key) { return key == 3; }) == 3);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToVector(set) == std::vector<int>{0, 0, 2, 4}));
+    }
+
+    void TestHeterogeneousLookup()
+    {
+        StdReimpl::flat_set<std::string, std::less<>> set = {"b", "a"};
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(set.contains(std::string_view("a")) && *set.find("b") == "b");
+        auto [it, inserted] = set.insert(std::string_view("c"));
+        CPPUTILS_STDREIMPL_TEST_CHECK(inserted && *it == "c" && set.size() == 3);
+        std::tie(it, inserted) = set.insert(std::string_view("a"));
+        CPPUTILS_STDREIMPL_TEST_CHECK(!inserted && it == set.begin());
+        CPPUTILS_STDREIMPL_TEST_CHECK(set.erase("b") == 1 && set.count("b") == 0);
+    }
+
+    template <class Key>
+    Key MakeKey(int value)
+    {
+        if constexpr (std::is_arithmetic_v<Key>)
+        {
+            return static_cast<Key>(std::is_signed_v<Key> ? value - 100 : value);
+        }
+        else
+        {
+            return std::to_string(value);
+        }
+    }
+
+    /**
+     * @brief Runs random insertions, erasures, and lookups against `std::set` or `std::multiset`, checking that they
+     *        agree. The size wanders across the linear scan threshold, so this covers the scan for each key type.
+     */
+    template <class FlatSet, class StdSet>
+    void TestMatchesStdSet()
+    {
+        using Key = typename FlatSet::key_type;
+
+        std::mt19937 random(5678);
+        FlatSet set;
+        StdSet expected;
+
+        for (int step = 0; step < 2000; ++step)
+        {
+            const Key key = MakeKey<Key>(static_cast<int>(random() % 200));
+            switch (random() % 4)
+            {
+            case 0:
+            case 1:
+                set.insert(key);
+                expected.insert(key);
+                break;
+            case 2:
+                CPPUTILS_STDREIMPL_TEST_CHECK(set.erase(key) == expected.erase(key));
+                break;
+            default:
+                CPPUTILS_STDREIMPL_TEST_CHECK(set.count(key) == expected.count(key));
+                CPPUTILS_STDREIMPL_TEST_CHECK(set.lower_bound(key) - set.begin() == std::distance(expected.begin(), expected.lower_bound(key)));
+                CPPUTILS_STDREIMPL_TEST_CHECK(set.upper_bound(key) - set.begin() == std::distance(expected.begin(), expected.upper_bound(key)));
+                break;
+            }
+
+            if (step % 100 == 0)
+            {
+                CPPUTILS_STDREIMPL_TEST_CHECK(std::equal(set.begin(), set.end(), expected.begin(), expected.end()));
+            }
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::equal(set.begin(), set.end(), expected.begin(), expected.end()));
+    }
+
+    template <class Key, flat_search_mode Mode>
+    void TestMatchesStdSets()
+    {
+        TestMatchesStdSet<StdReimpl::flat_set<Key, std::less<Key>, std::vector<Key>, Mode>, std::set<Key>>();
+        TestMatchesStdSet<StdReimpl::flat_multiset<Key, std::less<Key>, std::vector<Key>, Mode>, std::multiset<Key>>();
+    }
+
+    void TestSortedConstructorsDoNotSort()
+    {
+        static int s_Comparisons = 0;
+        const auto countingLess = [](int a, int b)
+            {
+                ++s_Comparisons;
+                return a < b;
+            };
+
+        std::vector<int> keys(1000);
+        for (int i = 0; i < 1000; ++i)
+        {
+            keys[i] = i / 2;
+        }
+
+        StdReimpl::flat_multiset<int, decltype(countingLess)> set(StdReimpl::sorted_equivalent, keys, countingLess);
+        CPPUTILS_STDREIMPL_TEST_CHECK(s_Comparisons < 1000);
+        CPPUTILS_STDREIMPL_TEST_CHECK(set.size() == 1000 && set.count(7) == 2);
+    }
+}
+
+int main()
+{
+    TestBasics<flat_search_mode::binary>();
+    TestBasics<flat_search_mode::eytzinger>();
+    TestMultiset<flat_search_mode::binary>();
+    TestMultiset<flat_search_mode::eytzinger>();
+    TestHeterogeneousLookup();
+
+    TestMatchesStdSets<int, flat_search_mode::binary>();
+    TestMatchesStdSets<int, flat_search_mode::eytzinger>();
+    TestMatchesStdSets<unsigned short, flat_search_mode::binary>();
+    TestMatchesStdSets<std::int64_t, flat_search_mode::eytzinger>();
+    TestMatchesStdSets<std::uint32_t, flat_search_mode::binary>();
+    TestMatchesStdSets<float, flat_search_mode::binary>();
+    TestMatchesStdSets<double, flat_search_mode::binary>();
+    TestMatchesStdSets<std::string, flat_search_mode::eytzinger>();
+
+    TestSortedConstructorsDoNotSort();
+
+    return StdReimplTests::GetExitCode();
+}
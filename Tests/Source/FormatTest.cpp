@@ -0,0 +1,339 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/format.h>
+#include <CppUtils/StdReimpl/inplace_vector.h>
+
+#include "TestCheck.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace
+{
+    struct Point
+    {
+        int x;
+        int y;
+    };
+
+    struct Celsius
+    {
+        double degrees;
+    };
+}
+
+// A formatter that writes other arguments through the context, taking no spec of its own.
+template <>
+struct StdReimpl::formatter<Point, char>
+{
+    constexpr format_parse_context::iterator parse(format_parse_context& ctx)
+    {
+        return ctx.begin();
+    }
+
+    format_context::iterator format(const Point& p, format_context& ctx) const
+    {
+        return StdReimpl::format_to(ctx.out(), "({}, {})", p.x, p.y);
+    }
+};
+
+// A formatter that takes the spec of the type it wraps.
+template <>
+struct StdReimpl::formatter<Celsius, char> : StdReimpl::formatter<double, char>
+{
+    format_context::iterator format(const Celsius& c, format_context& ctx) const
+    {
+        format_context::iterator out = StdReimpl::formatter<double, char>::format(c.degrees, ctx);
+        return StdReimpl::format_to(out, "C");
+    }
+};
+
+namespace
+{
+    static_assert(StdReimpl::formattable<int, char> && StdReimpl::formattable<std::string_view, char> && StdReimpl::formattable<Point, char>);
+    static_assert(!StdReimpl::formattable<std::list<int>, char> && !StdReimpl::formattable<wchar_t, char>);
+
+    bool Throws(std::string_view fmt, int arg)
+    {
+        try
+        {
+            static_cast<void>(StdReimpl::format(StdReimpl::runtime_format(fmt), arg));
+        }
+        catch (const StdReimpl::format_error&)
+        {
+            return true;
+        }
+        return false;
+    }
+
+    void TestBasics()
+    {
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("") == "");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("plain text") == "plain text");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{} + {} = {}", 1, 2, 3) == "1 + 2 = 3");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{1} {0} {1}", "a", "b") == "b a b");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{{}} {{{}}}", 5) == "{} {5}");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("}}{{") == "}{");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{}{}{}", 'a', true, false) == "atruefalse");
+
+        // More fields than the compiled form has room for, which is parsed at runtime instead.
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{0}-{0}-{0}-{0}-{0}", 7) == "7-7-7-7-7");
+    }
+
+    void TestIntegers()
+    {
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{}", 0) == "0");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{}", -42) == "-42");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{}", std::numeric_limits<long long>::min()) == "-9223372036854775808");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{}", std::numeric_limits<unsigned long long>::max()) == "18446744073709551615");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{}", static_cast<signed char>(-5)) == "-5");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{}", static_cast<std::uint16_t>(65535)) == "65535");
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:b} {:o} {:x} {:X}", 10, 8, 255, 255) == "1010 10 ff FF");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:#b} {:#o} {:#x} {:#X}", 10, 8, 255, 255) == "0b1010 010 0xff 0XFF");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:#o}", 0) == "0");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:#x}", -255) == "-0xff");
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:+} {:+} {: } {:-}", 1, -1, 1, 1) == "+1 -1  1 1");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:06}", -42) == "-00042");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:#010x}", 255) == "0x000000ff");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:<06}", 42) == "42    ");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:c}", 65) == "A");
+        CPPUTILS_STDREIMPL_TEST_CHECK(Throws("{:c}", 100000));
+    }
+
+    void TestAlignment()
+    {
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("[{:5}]", 42) == "[   42]");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("[{:5}]", "ab") == "[ab   ]");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("[{:<5}]", 42) == "[42   ]");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("[{:^5}]", 42) == "[ 42  ]");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("[{:*>5}]", "ab") == "[***ab]");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("[{:*^7}]", 'x') == "[***x***]");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("[{:6}]", true) == "[true  ]");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("[{:1}]", 12345) == "[12345]");
+
+        // Fills and widths are code points, not bytes.
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("[{:\xC2\xB7^5}]", 1) == "[\xC2\xB7\xC2\xB7" "1\xC2\xB7\xC2\xB7]");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("[{:3}]", "\xC3\xA9") == "[\xC3\xA9  ]");
+
+        // Dynamic widths and precisions, by automatic and manual index.
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("[{:{}}]", 42, 5) == "[   42]");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("[{0:>{1}.{2}}]", "abcdef", 5, 3) == "[  abc]");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("[{:.{}f}]", 3.14159, 2) == "[3.14]");
+    }
+
+    void TestFloatingPoint()
+    {
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{}", 0.1) == "0.1");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{}", 1e300) == "1e+300");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{}", 0.1f) == "0.1");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{}", -0.0) == "-0");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{}", 100.0) == "100");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:.3}", 3.14159) == "3.14");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:f} {:e} {:g}", 1.5, 1.5, 1.5) == "1.500000 1.500000e+00 1.5");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:E} {:G}", 1e-10, 1e-10) == "1.000000E-10 1E-10");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:a}", 1.0) == "1p+0");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:.2A}", 1.0) == "1.00P+0");
+
+        const double inf = std::numeric_limits<double>::infinity();
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{} {} {:F} {}", inf, -inf, inf, nan) == "inf -inf INF nan");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:06}", -inf) == "  -inf");
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:+08.2f}", 3.14159) == "+0003.14");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:#}", 1.0) == "1.");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:#.0f}", 2.0) == "2.");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:#g}", 1.0) == "1.00000");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:#g}", 0.0) == "0.00000");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:#.3g}", 1e10) == "1.00e+10");
+
+        // `printf` agrees with the presentations that have a precision.
+        const double values[] = {0.0, 1.0, -2.5, 0.1, 123456.789, 1e-7, 9.9999999, 6.02214076e23, 5e-324, 1.7976931348623157e308};
+        for (const double value : values)
+        {
+            for (int precision = 0; precision <= 20; precision += 4)
+            {
+                char expected[512];
+                std::snprintf(expected, sizeof(expected), "%.*e|%.*f|%.*g|%#.*g", precision, value, precision, value, precision, value, precision, value);
+                const std::string actual = StdReimpl::format("{0:.{1}e}|{0:.{1}f}|{0:.{1}g}|{0:#.{1}g}", value, precision);
+                CPPUTILS_STDREIMPL_TEST_CHECK(actual == expected);
+            }
+        }
+
+        // A precision long enough to need the heap.
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:.1000f}", 1.0).size() == 1002);
+    }
+
+    void TestStringsAndPointers()
+    {
+        const char array[8] = "abc";
+        char mutableString[] = "mutable";
+        const std::string string = "string";
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{} {} {} {}", array, mutableString, string, std::string_view("view")) == "abc mutable string view");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:.2}|{:s}", "abcdef", static_cast<const char*>("x")) == "ab|x");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:.1}", "\xC3\xA9\xC3\xA9") == "\xC3\xA9");
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{}", nullptr) == "0x0");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:P}", reinterpret_cast<const void*>(std::uintptr_t{0xab})) == "0XAB");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:06}", reinterpret_cast<void*>(std::uintptr_t{0xab})) == "0x00ab");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{:>6}", static_cast<void*>(nullptr)) == "   0x0");
+    }
+
+    void TestCustomFormatters()
+    {
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{}", Point{1, -2}) == "(1, -2)");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{} {:.1f} {}", Point{3, 4}, Celsius{21.25}, 5) == "(3, 4) 21.2C 5");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("{1:>{0}}", 7, Celsius{1.5}) == "    1.5C");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format(StdReimpl::runtime_format("{:e}"), Celsius{1.0}) == "1.000000e+00C");
+    }
+
+    void TestOutputs()
+    {
+        // A long result, past the small arrays of every buffer.
+        const std::string longText(1000, 'x');
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::format("<{}>", longText) == "<" + longText + ">");
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::formatted_size("<{}>", longText) == 1002);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::formatted_size("{:>10}", 1) == 10);
+
+        char buffer[16];
+        std::memset(buffer, '#', sizeof(buffer));
+        StdReimpl::format_to_n_result<char*> truncated = StdReimpl::format_to_n(buffer, 5, "{} {}", 123, 4567);
+        CPPUTILS_STDREIMPL_TEST_CHECK(truncated.out == buffer + 5 && truncated.size == 8);
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::string_view(buffer, 6) == "123 4#");
+
+        truncated = StdReimpl::format_to_n(buffer, -1, "{}", 1);
+        CPPUTILS_STDREIMPL_TEST_CHECK(truncated.out == buffer && truncated.size == 1);
+
+        char longBuffer[8];
+        truncated = StdReimpl::format_to_n(longBuffer, sizeof(longBuffer), "{}", longText);
+        CPPUTILS_STDREIMPL_TEST_CHECK(truncated.out == longBuffer + 8 && truncated.size == 1000 && std::string_view(longBuffer, 8) == "xxxxxxxx");
+
+        char* end = StdReimpl::format_to(buffer, "{:04}", 7);
+        CPPUTILS_STDREIMPL_TEST_CHECK(end == buffer + 4 && std::string_view(buffer, 4) == "0007");
+
+        std::string appended = "x=";
+        StdReimpl::format_to(std::back_inserter(appended), "{}", 1.5);
+        CPPUTILS_STDREIMPL_TEST_CHECK(appended == "x=1.5");
+
+        // A fixed capacity buffer, which never touches the heap.
+        StdReimpl::inplace_vector<char, 32> line;
+        const auto lineResult = StdReimpl::format_to_n(std::back_inserter(line), static_cast<std::ptrdiff_t>(line.capacity()), "{}:{}", "level", 3);
+        CPPUTILS_STDREIMPL_TEST_CHECK(lineResult.size == 7 && std::string_view(line.data(), line.size()) == "level:3");
+
+        std::list<char> chars;
+        const auto listResult = StdReimpl::format_to_n(std::back_inserter(chars), 300, "{}", longText);
+        CPPUTILS_STDREIMPL_TEST_CHECK(listResult.size == 1000 && chars.size() == 300);
+    }
+
+    void TestTypeErasedArguments()
+    {
+        int width = 4;
+        const char* text = "ab";
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::vformat("[{:>{}}]", StdReimpl::make_format_args(text, width)) == "[  ab]");
+
+        char buffer[8];
+        int value = 12;
+        char* end = StdReimpl::vformat_to(buffer, "{:x}", StdReimpl::make_format_args(value));
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::string_view(buffer, static_cast<std::size_t>(end - buffer)) == "c");
+
+        double d = 2.5;
+        Point p{1, 2};
+        const auto store = StdReimpl::make_format_args(value, d, text, p);
+        const StdReimpl::format_args args = store;
+        CPPUTILS_STDREIMPL_TEST_CHECK(args.get(0).visit([](auto v) { return std::is_same_v<decltype(v), int>; }));
+        CPPUTILS_STDREIMPL_TEST_CHECK(args.get(1).visit<bool>([](auto v) { return std::is_same_v<decltype(v), double>; }));
+        CPPUTILS_STDREIMPL_TEST_CHECK(args.get(2).visit([](auto v) { return std::is_same_v<decltype(v), const char*>; }));
+        CPPUTILS_STDREIMPL_TEST_CHECK(args.get(3).visit([](auto v) { return std::is_same_v<decltype(v), StdReimpl::basic_format_arg<StdReimpl::format_context>::handle>; }));
+        CPPUTILS_STDREIMPL_TEST_CHECK(args.get(3) && !args.get(4));
+    }
+
+    void TestRuntimeErrors()
+    {
+        // Each of these is a compile error when the format string is a constant.
+        CPPUTILS_STDREIMPL_TEST_CHECK(Throws("{", 1));
+        CPPUTILS_STDREIMPL_TEST_CHECK(Throws("}", 1));
+        CPPUTILS_STDREIMPL_TEST_CHECK(Throws("{} {}", 1));
+        CPPUTILS_STDREIMPL_TEST_CHECK(Throws("{0} {}", 1));
+        CPPUTILS_STDREIMPL_TEST_CHECK(Throws("{1}", 1));
+        CPPUTILS_STDREIMPL_TEST_CHECK(Throws("{01}", 1));
+        CPPUTILS_STDREIMPL_TEST_CHECK(Throws("{:s}", 1));
+        CPPUTILS_STDREIMPL_TEST_CHECK(Throws("{:.2}", 1));
+        CPPUTILS_STDREIMPL_TEST_CHECK(Throws("{:.}", 1));
+        CPPUTILS_STDREIMPL_TEST_CHECK(Throws("{:{<5}", 1));
+        CPPUTILS_STDREIMPL_TEST_CHECK(Throws("{:99999999999}", 1));
+        CPPUTILS_STDREIMPL_TEST_CHECK(Throws("{:x", 1));
+        CPPUTILS_STDREIMPL_TEST_CHECK(!Throws("{0:{0}}", 1));
+
+        bool negativeWidthThrows = false;
+        try
+        {
+            static_cast<void>(StdReimpl::format("{:{}}", 1, -1));
+        }
+        catch (const StdReimpl::format_error&)
+        {
+            negativeWidthThrows = true;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(negativeWidthThrows);
+
+        bool stringWidthThrows = false;
+        try
+        {
+            static_cast<void>(StdReimpl::format(StdReimpl::runtime_format("{:{}}"), 1, "a"));
+        }
+        catch (const StdReimpl::format_error&)
+        {
+            stringWidthThrows = true;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(stringWidthThrows);
+    }
+
+    void TestPrint()
+    {
+        std::FILE* file = std::tmpfile();
+        if (file == nullptr)
+        {
+            return;
+        }
+        const std::string longText(2000, 'y');
+        StdReimpl::print(file, "{}-{}", 1, "two");
+        StdReimpl::println(file, "!");
+        StdReimpl::println(file);
+        StdReimpl::print(file, "{}", longText);
+        int value = 3;
+        StdReimpl::vprint_nonunicode(file, "{}", StdReimpl::make_format_args(value));
+
+        std::rewind(file);
+        std::string contents;
+        char chunk[256];
+        for (std::size_t read; (read = std::fread(chunk, 1, sizeof(chunk), file)) != 0;)
+        {
+            contents.append(chunk, read);
+        }
+        std::fclose(file);
+        CPPUTILS_STDREIMPL_TEST_CHECK(contents == "1-two!\n\n" + longText + "3");
+    }
+}
+
+int main()
+{
+    TestBasics();
+    TestIntegers();
+    TestAlignment();
+    TestFloatingPoint();
+    TestStringsAndPointers();
+    TestCustomFormatters();
+    TestOutputs();
+    TestTypeErasedArguments();
+    TestRuntimeErrors();
+    TestPrint();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,151 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/functional.h>
+
+#include "TestCheck.h"
+
+#include <memory>
+#include <type_traits>
+
+namespace
+{
+    int Add(int a, int b)
+    {
+        return a + b;
+    }
+
+    int Identity(int a) noexcept
+    {
+        return a;
+    }
+
+    struct Counter
+    {
+        int value = 3;
+
+        int GetPlus(int x) const
+        {
+            return value + x;
+        }
+
+        int Increment(int x)
+        {
+            value += x;
+            return value;
+        }
+    };
+
+    int SubtractFromCounter(Counter& counter, int x)
+    {
+        return counter.value - x;
+    }
+
+    // The layout is the whole point of `function_ref`. Make sure it can't regress.
+
+    static_assert(sizeof(StdReimpl::function_ref<int(int)>) == 2 * sizeof(void*));
+    static_assert(sizeof(StdReimpl::function_ref<int(int) const>) == 2 * sizeof(void*));
+    static_assert(sizeof(StdReimpl::function_ref<int(int) noexcept>) == 2 * sizeof(void*));
+    static_assert(sizeof(StdReimpl::function_ref<int(int) const noexcept>) == 2 * sizeof(void*));
+
+    static_assert(std::is_trivially_copyable_v<StdReimpl::function_ref<int(int)>>);
+    static_assert(std::is_trivially_copyable_v<StdReimpl::function_ref<int(int) const>>);
+    static_assert(std::is_trivially_copyable_v<StdReimpl::function_ref<int(int) noexcept>>);
+    static_assert(std::is_trivially_copyable_v<StdReimpl::function_ref<int(int) const noexcept>>);
+
+    // Constraints.
+
+    static_assert(std::is_nothrow_invocable_v<StdReimpl::function_ref<int(int) noexcept>, int>);
+    static_assert(!std::is_nothrow_invocable_v<StdReimpl::function_ref<int(int)>, int>);
+    static_assert(!std::is_constructible_v<StdReimpl::function_ref<int(int) noexcept>, int (*)(int)>);
+    static_assert(!std::is_constructible_v<StdReimpl::function_ref<int(int)>, int Counter::*>);
+    static_assert(!std::is_assignable_v<StdReimpl::function_ref<int(int)>&, decltype([](int x) { return x; })>);
+    static_assert(std::is_assignable_v<StdReimpl::function_ref<int(int, int)>&, StdReimpl::constant_arg_t<&Add>>);
+
+    // Deduction guides.
+
+    static_assert(std::is_same_v<decltype(StdReimpl::function_ref{&Add}), StdReimpl::function_ref<int(int, int)>>);
+    static_assert(std::is_same_v<decltype(StdReimpl::function_ref{StdReimpl::constant_arg<&Identity>}), StdReimpl::function_ref<int(int) noexcept>>);
+    static_assert(std::is_same_v<
+        decltype(StdReimpl::function_ref{StdReimpl::constant_arg<&Counter::GetPlus>, std::declval<Counter&>()}),
+        StdReimpl::function_ref<int(int)>>);
+    static_assert(std::is_same_v<
+        decltype(StdReimpl::function_ref{StdReimpl::constant_arg<&Counter::value>, std::declval<Counter&>()}),
+        StdReimpl::function_ref<int&() noexcept>>);
+    static_assert(std::is_same_v<
+        decltype(StdReimpl::function_ref{StdReimpl::constant_arg<&SubtractFromCounter>, std::declval<Counter&>()}),
+        StdReimpl::function_ref<int(int)>>);
+
+    void TestFunctionPointers()
+    {
+        StdReimpl::function_ref<int(int, int)> fromFunction = Add;
+        CPPUTILS_STDREIMPL_TEST_CHECK(fromFunction(1, 2) == 3);
+
+        StdReimpl::function_ref<int(int, int) const> fromFunctionPointer = &Add;
+        CPPUTILS_STDREIMPL_TEST_CHECK(fromFunctionPointer(2, 2) == 4);
+
+        StdReimpl::function_ref<long(int) noexcept> convertingReturn = Identity;
+        CPPUTILS_STDREIMPL_TEST_CHECK(convertingReturn(5) == 5L);
+    }
+
+    void TestCallableObjects()
+    {
+        const auto addK = [k = 5](int x) { return x + k; };
+        StdReimpl::function_ref<int(int) const> constRef = addK;
+        CPPUTILS_STDREIMPL_TEST_CHECK(constRef(1) == 6);
+
+        int calls = 0;
+        auto mutableLambda = [&calls](int x) mutable { return x + ++calls; };
+        StdReimpl::function_ref<int(int)> mutableRef = mutableLambda;
+        CPPUTILS_STDREIMPL_TEST_CHECK(mutableRef(10) == 11);
+        CPPUTILS_STDREIMPL_TEST_CHECK(mutableRef(10) == 12);
+
+        // Copies refer to the same callable.
+        StdReimpl::function_ref<int(int)> copy = mutableRef;
+        CPPUTILS_STDREIMPL_TEST_CHECK(copy(10) == 13);
+
+        // Move-only arguments are forwarded rather than copied.
+        const auto dereference = [](std::unique_ptr<int> p) { return *p; };
+        StdReimpl::function_ref<int(std::unique_ptr<int>)> moveOnlyArgument = dereference;
+        CPPUTILS_STDREIMPL_TEST_CHECK(moveOnlyArgument(std::make_unique<int>(9)) == 9);
+
+        StdReimpl::function_ref<void(int)> voidReturn = mutableLambda;
+        voidReturn(0);
+        CPPUTILS_STDREIMPL_TEST_CHECK(calls == 4);
+    }
+
+    void TestConstantArg()
+    {
+        StdReimpl::function_ref unbound{StdReimpl::constant_arg<&Add>};
+        CPPUTILS_STDREIMPL_TEST_CHECK(unbound(3, 4) == 7);
+
+        Counter counter;
+
+        StdReimpl::function_ref boundByReference{StdReimpl::constant_arg<&Counter::GetPlus>, counter};
+        CPPUTILS_STDREIMPL_TEST_CHECK(boundByReference(1) == 4);
+
+        StdReimpl::function_ref<int(int)> boundByPointer{StdReimpl::constant_arg<&Counter::Increment>, &counter};
+        CPPUTILS_STDREIMPL_TEST_CHECK(boundByPointer(2) == 5);
+        CPPUTILS_STDREIMPL_TEST_CHECK(counter.value == 5);
+
+        StdReimpl::function_ref dataMember{StdReimpl::constant_arg<&Counter::value>, counter};
+        CPPUTILS_STDREIMPL_TEST_CHECK(&dataMember() == &counter.value);
+
+        StdReimpl::function_ref freeFunctionWithObject{StdReimpl::constant_arg<&SubtractFromCounter>, counter};
+        CPPUTILS_STDREIMPL_TEST_CHECK(freeFunctionWithObject(1) == 4);
+
+        const auto zero = [](int, int) { return 0; };
+        StdReimpl::function_ref<int(int, int)> reassigned = zero;
+        CPPUTILS_STDREIMPL_TEST_CHECK(reassigned(1, 1) == 0);
+        reassigned = StdReimpl::constant_arg<&Add>;
+        CPPUTILS_STDREIMPL_TEST_CHECK(reassigned(1, 1) == 2);
+    }
+}
+
+int main()
+{
+    TestFunctionPointers();
+    TestCallableObjects();
+    TestConstantArg();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,370 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/generator.h>
+
+#include "TestCheck.h"
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using StdReimpl::generator;
+    using StdReimpl::ranges::elements_of;
+
+    static_assert(std::ranges::input_range<generator<int>>);
+    static_assert(std::ranges::view<generator<int>>);
+    static_assert(!std::ranges::forward_range<generator<int>>);
+    static_assert(std::is_same_v<std::ranges::range_reference_t<generator<int>>, int&&>);
+    static_assert(std::is_same_v<std::ranges::range_value_t<generator<int>>, int>);
+    static_assert(std::is_same_v<std::ranges::range_reference_t<generator<const std::string&>>, const std::string&>);
+    static_assert(std::is_same_v<std::ranges::range_reference_t<generator<std::string_view, std::string>>, std::string_view>);
+    static_assert(std::is_same_v<std::ranges::range_value_t<generator<std::string_view, std::string>>, std::string>);
+    static_assert(!std::is_copy_constructible_v<generator<int>>);
+    static_assert(std::is_nothrow_move_constructible_v<generator<int>>);
+
+    // Counts the frames that are allocated with it, and the ones that are still alive.
+    struct ArenaState
+    {
+        int allocations = 0;
+        int live = 0;
+    };
+
+    template <class T>
+    struct CountingAllocator
+    {
+        using value_type = T;
+
+        ArenaState* state;
+
+        explicit CountingAllocator(ArenaState* inState) noexcept
+            : state(inState)
+        {
+        }
+
+        template <class U>
+        CountingAllocator(const CountingAllocator<U>& other) noexcept
+            : state(other.state)
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            ++state->allocations;
+            ++state->live;
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            --state->live;
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        template <class U>
+        bool operator==(const CountingAllocator<U>& other) const noexcept
+        {
+            return state == other.state;
+        }
+    };
+
+    generator<int> Iota(int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            co_yield i;
+        }
+    }
+
+    void TestBasics()
+    {
+        std::vector<int> values;
+        for (int i : Iota(0, 5))
+        {
+            values.push_back(i);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK((values == std::vector<int>{0, 1, 2, 3, 4}));
+
+        int count = 0;
+        for ([[maybe_unused]] int i : Iota(3, 3))
+        {
+            ++count;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(count == 0);
+
+        // Yielding an lvalue from a generator of rvalue references yields a copy, so that the coroutine's own variable
+        // can't be moved from.
+        auto names = []() -> generator<std::string>
+        {
+            std::string name = "a long enough name to not fit in the small buffer";
+            co_yield name;
+            co_yield name;
+        }();
+        std::vector<std::string> moved;
+        for (std::string&& name : names)
+        {
+            moved.push_back(std::move(name));
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(moved.size() == 2 && moved[0] == moved[1]);
+
+        // Generators are views, so they compose with range adaptors.
+        int sum = 0;
+        for (int i : Iota(0, 10) | std::views::filter([](int i) { return i % 2 == 0; }) | std::views::transform([](int i) { return i * 10; }))
+        {
+            sum += i;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(sum == 200);
+
+        // With a separate value type, the reference can be a view of the coroutine's state.
+        auto words = []() -> generator<std::string_view, std::string>
+        {
+            const std::string text = "one two";
+            co_yield std::string_view(text).substr(0, 3);
+            co_yield std::string_view(text).substr(4);
+        }();
+        std::vector<std::string> copies;
+        for (auto it = words.begin(); it != words.end(); ++it)
+        {
+            copies.emplace_back(*it);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK((copies == std::vector<std::string>{"one", "two"}));
+    }
+
+    struct Node
+    {
+        int value;
+        std::vector<Node> children;
+    };
+
+    generator<const int&> Traverse(const Node& node)
+    {
+        co_yield node.value;
+        for (const Node& child : node.children)
+        {
+            co_yield elements_of(Traverse(child));
+        }
+    }
+
+    generator<int> Countdown(int depth)
+    {
+        co_yield depth;
+        if (depth > 0)
+        {
+            co_yield elements_of(Countdown(depth - 1));
+        }
+        co_yield -depth;
+    }
+
+    void TestElementsOf()
+    {
+        const Node tree{1, {{2, {{3, {}}, {4, {}}}}, {5, {}}, {6, {{7, {{8, {}}}}}}}};
+        std::vector<int> values;
+        for (const int& i : Traverse(tree))
+        {
+            values.push_back(i);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK((values == std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+
+        // Deep enough that resuming every generator on the way to the innermost one for each element would show up.
+        int count = 0;
+        int sum = 0;
+        for (int i : Countdown(1000))
+        {
+            ++count;
+            sum += i;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(count == 2002 && sum == 0);
+
+        // Any range can be yielded, not just generators.
+        auto flattened = []() -> generator<const int&>
+        {
+            const std::vector<int> first = {1, 2};
+            co_yield elements_of(first);
+            co_yield 3;
+            co_yield elements_of(std::views::iota(4, 6));
+            co_yield elements_of(std::vector<int>());
+            co_yield elements_of(Iota(6, 8));
+        }();
+        values.clear();
+        for (const int& i : flattened)
+        {
+            values.push_back(i);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK((values == std::vector<int>{1, 2, 3, 4, 5, 6, 7}));
+
+        // Destroying a generator part-way through destroys the nested ones too.
+        ArenaState state;
+        {
+            auto outer = [](std::allocator_arg_t, CountingAllocator<std::byte> alloc) -> generator<int, void, CountingAllocator<std::byte>>
+            {
+                co_yield 1;
+                co_yield elements_of([](std::allocator_arg_t, CountingAllocator<std::byte>) -> generator<int, void, CountingAllocator<std::byte>>
+                {
+                    co_yield 2;
+                    co_yield 3;
+                }(std::allocator_arg, alloc));
+            }(std::allocator_arg, CountingAllocator<std::byte>(&state));
+
+            auto it = outer.begin();
+            ++it;
+            CPPUTILS_STDREIMPL_TEST_CHECK(*it == 2 && state.live == 2);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(state.allocations == 2 && state.live == 0);
+    }
+
+    generator<int, void, CountingAllocator<std::byte>> CountedIota(std::allocator_arg_t, CountingAllocator<std::byte>, int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            co_yield i;
+        }
+    }
+
+    generator<int> ErasedIota(std::allocator_arg_t, const CountingAllocator<int>&, int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            co_yield i;
+        }
+    }
+
+    struct Counter
+    {
+        int last;
+
+        generator<int> Count(std::allocator_arg_t, CountingAllocator<char>) const
+        {
+            for (int i = 0; i < last; ++i)
+            {
+                co_yield i;
+            }
+        }
+    };
+
+    void TestAllocators()
+    {
+        ArenaState state;
+        const CountingAllocator<std::byte> alloc(&state);
+
+        int sum = 0;
+        for (int i : CountedIota(std::allocator_arg, alloc, 0, 4))
+        {
+            CPPUTILS_STDREIMPL_TEST_CHECK(state.live == 1);
+            sum += i;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(sum == 6 && state.allocations == 1 && state.live == 0);
+
+        // With no allocator in the type, any allocator can be passed.
+        sum = 0;
+        for (int i : ErasedIota(std::allocator_arg, CountingAllocator<int>(&state), 0, 4))
+        {
+            sum += i;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(sum == 6 && state.allocations == 2 && state.live == 0);
+
+        // Member functions are passed the object first.
+        sum = 0;
+        const Counter counter{4};
+        for (int i : counter.Count(std::allocator_arg, CountingAllocator<char>(&state)))
+        {
+            sum += i;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(sum == 6 && state.allocations == 3 && state.live == 0);
+
+        // Ranges that aren't generators are wrapped in one, which uses the allocator given to elements_of.
+        auto flattened = [](std::allocator_arg_t, CountingAllocator<std::byte> a) -> generator<int, void, CountingAllocator<std::byte>>
+        {
+            co_yield elements_of(std::views::iota(0, 4), a);
+        }(std::allocator_arg, alloc);
+        sum = 0;
+        for (int i : flattened)
+        {
+            sum += i;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(sum == 6 && state.allocations == 5 && state.live == 1);
+    }
+
+    generator<int> Throwing(int depth)
+    {
+        if (depth == 0)
+        {
+            co_yield 0;
+            throw std::runtime_error("innermost");
+        }
+        co_yield elements_of(Throwing(depth - 1));
+    }
+
+    void TestExceptions()
+    {
+        // An exception in a nested generator goes through each parent, so it can be caught by any of them.
+        std::vector<int> values;
+        bool caught = false;
+        try
+        {
+            for (int i : Throwing(3))
+            {
+                values.push_back(i);
+            }
+        }
+        catch (const std::runtime_error& e)
+        {
+            caught = std::string(e.what()) == "innermost";
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(caught && values == std::vector<int>{0});
+
+        auto recovering = []() -> generator<int>
+        {
+            try
+            {
+                co_yield elements_of(Throwing(2));
+            }
+            catch (const std::runtime_error&)
+            {
+            }
+            co_yield 1;
+        }();
+        values.clear();
+        for (int i : recovering)
+        {
+            values.push_back(i);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK((values == std::vector<int>{0, 1}));
+    }
+
+    void TestMove()
+    {
+        generator<int> a = Iota(0, 3);
+        generator<int> b = std::move(a);
+        a = Iota(10, 12);
+
+        std::vector<int> values;
+        for (int i : b)
+        {
+            values.push_back(i);
+        }
+        for (int i : a)
+        {
+            values.push_back(i);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK((values == std::vector<int>{0, 1, 2, 10, 11}));
+    }
+}
+
+int main()
+{
+    TestBasics();
+    TestElementsOf();
+    TestAllocators();
+    TestExceptions();
+    TestMove();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,590 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/hive.h>
+
+#include "AllocationCounter.h"
+#include "TestCheck.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    static_assert(std::bidirectional_iterator<StdReimpl::hive<int>::iterator>);
+    static_assert(std::bidirectional_iterator<StdReimpl::hive<int>::const_iterator>);
+    static_assert(std::ranges::bidirectional_range<StdReimpl::hive<std::string>>);
+    static_assert(std::is_convertible_v<StdReimpl::hive<int>::iterator, StdReimpl::hive<int>::const_iterator>);
+    static_assert(!std::is_convertible_v<StdReimpl::hive<int>::const_iterator, StdReimpl::hive<int>::iterator>);
+    static_assert(std::totally_ordered<StdReimpl::hive<int>::iterator>);
+    static_assert(std::is_nothrow_move_constructible_v<StdReimpl::hive<std::string>>);
+    static_assert(std::is_nothrow_move_assignable_v<StdReimpl::hive<std::string>>);
+    static_assert(std::is_move_constructible_v<StdReimpl::hive<std::unique_ptr<int>>>);
+
+    /**
+     * @brief Counts live instances, so we can check every element gets destroyed exactly once. Can be made to throw
+     *        from its constructor.
+     */
+    struct Tracked
+    {
+        static inline int s_LiveCount = 0;
+        static inline bool s_ThrowOnConstruct = false;
+
+        int value = 0;
+
+        Tracked(int inValue = 0)
+            : value(inValue)
+        {
+            if (s_ThrowOnConstruct)
+            {
+                throw std::runtime_error("Tracked");
+            }
+            ++s_LiveCount;
+        }
+        Tracked(const Tracked& other)
+            : Tracked(other.value)
+        {
+        }
+        Tracked(Tracked&& other) noexcept
+            : value(other.value)
+        {
+            other.value = -1;
+            ++s_LiveCount;
+        }
+        Tracked& operator=(const Tracked&) = default;
+        Tracked& operator=(Tracked&& other) noexcept
+        {
+            value = other.value;
+            other.value = -1;
+            return *this;
+        }
+        ~Tracked()
+        {
+            --s_LiveCount;
+        }
+
+        friend bool operator==(const Tracked& a, const Tracked& b)
+        {
+            return a.value == b.value;
+        }
+
+        friend bool operator<(const Tracked& a, const Tracked& b)
+        {
+            return a.value < b.value;
+        }
+    };
+
+    template <class Hive>
+    std::vector<int> ToInts(const Hive& h)
+    {
+        std::vector<int> result;
+        for (const auto& element : h)
+        {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(element)>, Tracked>)
+            {
+                result.push_back(element.value);
+            }
+            else
+            {
+                result.push_back(static_cast<int>(element));
+            }
+        }
+        return result;
+    }
+
+    template <class Hive>
+    std::vector<int> ToSortedInts(const Hive& h)
+    {
+        std::vector<int> result = ToInts(h);
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    /**
+     * @brief Checks that iterating forward and back visits the same `size()` elements, in opposite orders, and that
+     *        iterators are ordered the way they're visited.
+     */
+    template <class Hive>
+    bool IteratesConsistently(const Hive& h)
+    {
+        std::vector<const typename Hive::value_type*> forward;
+        for (auto it = h.begin(); it != h.end(); ++it)
+        {
+            if (!forward.empty() && !(std::prev(it) < it))
+            {
+                return false;
+            }
+            forward.push_back(std::addressof(*it));
+        }
+
+        std::vector<const typename Hive::value_type*> backward;
+        for (auto it = h.rbegin(); it != h.rend(); ++it)
+        {
+            backward.push_back(std::addressof(*it));
+        }
+        std::reverse(backward.begin(), backward.end());
+
+        return forward.size() == h.size() && forward == backward
+            && static_cast<std::size_t>(std::distance(h.begin(), h.end())) == h.size();
+    }
+
+    void TestBasics()
+    {
+        StdReimpl::hive<int> h;
+        CPPUTILS_STDREIMPL_TEST_CHECK(h.empty() && h.size() == 0 && h.capacity() == 0 && h.begin() == h.end());
+
+        const auto first = h.insert(1);
+        h.emplace(2);
+        h.insert(h.cbegin(), 3);
+        h.insert({4, 5});
+        CPPUTILS_STDREIMPL_TEST_CHECK(*first == 1 && h.size() == 5);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(h) == std::vector<int>{1, 2, 3, 4, 5}));
+
+        // The first block holds the default minimum, and later ones grow with the size.
+        CPPUTILS_STDREIMPL_TEST_CHECK(h.capacity() == StdReimpl::hive<int>::block_capacity_default_limits().min);
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::erase(h, 3) == 1);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::erase_if(h, [](int x) { return x % 2 == 0; }) == 2);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(h) == std::vector<int>{1, 5}));
+
+        // What was erased gets reused before anything else.
+        const auto reused = h.insert(6);
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::next(h.begin()) == reused || std::next(h.begin(), 2) == reused);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToSortedInts(h) == std::vector<int>{1, 5, 6}));
+
+        const StdReimpl::hive<int> list = {3, 1, 2};
+        StdReimpl::hive<int> copy(list.begin(), list.end());
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(copy) == std::vector<int>{3, 1, 2}));
+        copy.assign(2, 7);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(copy) == std::vector<int>{7, 7}));
+        const std::vector<int> range = {8, 9};
+        copy.assign_range(range);
+        copy.insert_range(range);
+        copy.insert(2, 1);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(copy) == std::vector<int>{8, 9, 8, 9, 1, 1}));
+
+        StdReimpl::hive<std::string> strings(3, "abc");
+        CPPUTILS_STDREIMPL_TEST_CHECK(strings.size() == 3 && *strings.begin() == "abc" && strings.begin()->size() == 3);
+        StdReimpl::hive<std::string> defaulted(4);
+        CPPUTILS_STDREIMPL_TEST_CHECK(defaulted.size() == 4 && defaulted.begin()->empty());
+    }
+
+    /**
+     * @brief Elements never move while they're in the hive, however much is inserted and erased around them.
+     */
+    void TestStability()
+    {
+        StdReimpl::hive<int> h;
+        std::vector<std::pair<int*, int>> kept;
+        for (int i = 0; i < 1000; ++i)
+        {
+            int* element = &*h.insert(i);
+            if (i % 3 == 0)
+            {
+                kept.emplace_back(element, i);
+            }
+        }
+
+        const std::size_t capacity = h.capacity();
+        std::size_t erased = StdReimpl::erase_if(h, [](int x) { return x % 3 != 0; });
+        for (int i = 0; i < 2000; ++i)
+        {
+            h.insert(-i);
+            if (i % 2 == 0)
+            {
+                h.erase(h.get_iterator(&*h.insert(-i)));
+            }
+        }
+
+        bool allKept = true;
+        for (const auto& [element, value] : kept)
+        {
+            allKept = allKept && *element == value && &*h.get_iterator(element) == element;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(allKept);
+        CPPUTILS_STDREIMPL_TEST_CHECK(h.size() == 1000 - erased + 2000);
+        CPPUTILS_STDREIMPL_TEST_CHECK(IteratesConsistently(h));
+
+        // Erasing and inserting as many elements reuses the erased slots, without growing.
+        StdReimpl::hive<int> churn;
+        churn.insert(500, 0);
+        const std::size_t churnCapacity = churn.capacity();
+        for (int round = 0; round < 10; ++round)
+        {
+            erased = StdReimpl::erase_if(churn, [round, i = 0](int) mutable { return (i++ + round) % 4 == 0; });
+            churn.insert(erased, round);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(churn.size() == 500 && churn.capacity() == churnCapacity);
+        CPPUTILS_STDREIMPL_TEST_CHECK(capacity <= h.capacity());
+    }
+
+    /**
+     * @brief Erases runs of every length at the start, middle and end of blocks, including whole blocks, and checks that
+     *        iteration jumps over exactly what was erased.
+     */
+    void TestSkipfield()
+    {
+        const StdReimpl::hive_limits limits(8, 8);
+        for (int first = 0; first < 24; ++first)
+        {
+            for (int count = 1; first + count <= 24; ++count)
+            {
+                StdReimpl::hive<int> h(limits);
+                std::vector<int> expected;
+                for (int i = 0; i < 24; ++i)
+                {
+                    h.insert(i);
+                    if (i < first || i >= first + count)
+                    {
+                        expected.push_back(i);
+                    }
+                }
+
+                // Erased out of order, so that runs are joined from both sides.
+                for (int i = first; i < first + count; i += 2)
+                {
+                    h.erase(h.get_iterator(&*std::find(h.begin(), h.end(), i)));
+                }
+                for (int i = first + 1; i < first + count; i += 2)
+                {
+                    h.erase(h.get_iterator(&*std::find(h.begin(), h.end(), i)));
+                }
+
+                if (ToInts(h) != expected || !IteratesConsistently(h))
+                {
+                    CPPUTILS_STDREIMPL_TEST_CHECK(false);
+                    return;
+                }
+
+                // Filling the slots again gets back to what we started with.
+                for (int i = first; i < first + count; ++i)
+                {
+                    h.insert(i);
+                }
+                if (ToSortedInts(h).size() != 24 || !IteratesConsistently(h))
+                {
+                    CPPUTILS_STDREIMPL_TEST_CHECK(false);
+                    return;
+                }
+            }
+        }
+
+        // Erasing a range, which can take whole blocks and our end with it.
+        StdReimpl::hive<int> h(limits);
+        for (int i = 0; i < 40; ++i)
+        {
+            h.insert(i);
+        }
+        auto it = h.erase(std::next(h.begin(), 3), std::next(h.begin(), 30));
+        CPPUTILS_STDREIMPL_TEST_CHECK(*it == 30 && h.size() == 13 && IteratesConsistently(h));
+        it = h.erase(std::next(h.begin(), 5), h.end());
+        CPPUTILS_STDREIMPL_TEST_CHECK(it == h.end() && (ToInts(h) == std::vector<int>{0, 1, 2, 30, 31}));
+        it = h.erase(h.begin(), h.end());
+        CPPUTILS_STDREIMPL_TEST_CHECK(it == h.end() && h.empty() && h.begin() == h.end());
+        CPPUTILS_STDREIMPL_TEST_CHECK(h.capacity() == 40);
+    }
+
+    /**
+     * @brief Checks random inserts and erases against a vector of what should be in the hive.
+     */
+    void TestAgainstReference()
+    {
+        std::mt19937 random(12345);
+        for (const StdReimpl::hive_limits limits : {StdReimpl::hive_limits(1, 1), StdReimpl::hive_limits(3, 17), StdReimpl::hive_limits(8, 8192)})
+        {
+            StdReimpl::hive<Tracked> h(limits);
+            std::vector<int> expected;
+            int next = 0;
+            bool consistent = true;
+            for (int step = 0; step < 4000 && consistent; ++step)
+            {
+                // Mostly grows at first, then mostly shrinks.
+                const bool insert = expected.empty() || std::uniform_int_distribution<int>(0, 99)(random) < (step < 2000 ? 65 : 35);
+                if (insert)
+                {
+                    const auto position = h.emplace(next);
+                    consistent = position->value == next;
+                    expected.push_back(next++);
+                }
+                else
+                {
+                    const auto index = std::uniform_int_distribution<std::size_t>(0, expected.size() - 1)(random);
+                    const int value = expected[index];
+                    expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(index));
+                    auto position = std::find(h.begin(), h.end(), Tracked(value));
+                    // Our end moves when the last block is emptied, so the old one isn't what's returned then.
+                    const auto after = std::next(position);
+                    const bool afterIsEnd = after == h.end();
+                    const auto returned = h.erase(position);
+                    consistent = afterIsEnd ? returned == h.end() : returned == after;
+                }
+
+                if (step % 97 == 0)
+                {
+                    std::vector<int> sortedExpected = expected;
+                    std::sort(sortedExpected.begin(), sortedExpected.end());
+                    consistent = consistent && ToSortedInts(h) == sortedExpected && IteratesConsistently(h);
+                }
+            }
+            CPPUTILS_STDREIMPL_TEST_CHECK(consistent);
+            CPPUTILS_STDREIMPL_TEST_CHECK(h.size() == expected.size());
+            CPPUTILS_STDREIMPL_TEST_CHECK(Tracked::s_LiveCount == static_cast<int>(expected.size()));
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(Tracked::s_LiveCount == 0);
+    }
+
+    void TestCapacity()
+    {
+        StdReimpl::hive<int> h(StdReimpl::hive_limits(4, 100));
+        CPPUTILS_STDREIMPL_TEST_CHECK(h.block_capacity_limits().min == 4 && h.block_capacity_limits().max == 100);
+
+        // Blocks grow geometrically, up to the maximum.
+        for (int i = 0; i < 4 + 4 + 8 + 16 + 32 + 64; ++i)
+        {
+            h.insert(i);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(h.capacity() == 4 + 4 + 8 + 16 + 32 + 64);
+        h.insert(0);
+        CPPUTILS_STDREIMPL_TEST_CHECK(h.capacity() == 4 + 4 + 8 + 16 + 32 + 64 + 100);
+
+        // Emptied blocks are kept, until trimmed.
+        h.erase(h.begin(), std::next(h.begin(), 16));
+        CPPUTILS_STDREIMPL_TEST_CHECK(h.capacity() == 228 && h.size() == 113);
+        h.trim_capacity();
+        CPPUTILS_STDREIMPL_TEST_CHECK(h.capacity() == 212);
+
+        h.reserve(500);
+        CPPUTILS_STDREIMPL_TEST_CHECK(h.capacity() >= 500);
+        h.trim_capacity(300);
+        CPPUTILS_STDREIMPL_TEST_CHECK(h.capacity() >= 300 && h.capacity() < 500);
+
+        // Shrinking moves the elements together.
+        StdReimpl::erase_if(h, [](int x) { return x % 2 == 0; });
+        const std::vector<int> before = ToSortedInts(h);
+        h.shrink_to_fit();
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToSortedInts(h) == before && h.capacity() == std::max<std::size_t>(h.size(), 4));
+        CPPUTILS_STDREIMPL_TEST_CHECK(IteratesConsistently(h));
+
+        // Reshaping moves the elements out of blocks that are outside the new limits.
+        h.reshape(StdReimpl::hive_limits(2, 3));
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToSortedInts(h) == before && h.capacity() <= h.size() + 2 && IteratesConsistently(h));
+        h.reshape(StdReimpl::hive_limits(1, 10));
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToSortedInts(h) == before);
+
+        bool threw = false;
+        try
+        {
+            h.reshape(StdReimpl::hive_limits(0, 10));
+        }
+        catch (const std::length_error&)
+        {
+            threw = true;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(threw);
+
+        threw = false;
+        try
+        {
+            StdReimpl::hive<int> invalid(StdReimpl::hive_limits(10, 5));
+        }
+        catch (const std::length_error&)
+        {
+            threw = true;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(threw);
+
+        const StdReimpl::hive_limits hardLimits = StdReimpl::hive<int>::block_capacity_hard_limits();
+        CPPUTILS_STDREIMPL_TEST_CHECK(hardLimits.min == 1 && hardLimits.max == 65535);
+
+        // A block of the largest capacity, whose runs are as long as the skipfield can count.
+        StdReimpl::hive<char> large(hardLimits);
+        large.reshape(StdReimpl::hive_limits(hardLimits.max, hardLimits.max));
+        large.insert(hardLimits.max, 'a');
+        large.erase(std::next(large.begin()), std::prev(large.end()));
+        CPPUTILS_STDREIMPL_TEST_CHECK(large.size() == 2 && large.capacity() == 65535 && IteratesConsistently(large));
+        large.erase(large.begin());
+        CPPUTILS_STDREIMPL_TEST_CHECK(large.size() == 1 && IteratesConsistently(large));
+        large.insert('b');
+        CPPUTILS_STDREIMPL_TEST_CHECK(*large.begin() == 'b' && *std::next(large.begin()) == 'a');
+    }
+
+    void TestCopyMoveSwap()
+    {
+        StdReimpl::hive<Tracked> h(StdReimpl::hive_limits(2, 4));
+        for (int i = 0; i < 10; ++i)
+        {
+            h.emplace(i);
+        }
+        StdReimpl::erase_if(h, [](const Tracked& x) { return x.value % 3 == 0; });
+
+        StdReimpl::hive<Tracked> copy = h;
+        CPPUTILS_STDREIMPL_TEST_CHECK(ToInts(copy) == ToInts(h) && copy.block_capacity_limits().max == 4);
+
+        const Tracked* element = &*h.begin();
+        StdReimpl::hive<Tracked> moved = std::move(h);
+        CPPUTILS_STDREIMPL_TEST_CHECK(&*moved.begin() == element && h.empty() && h.capacity() == 0);
+
+        h = {Tracked(1), Tracked(2)};
+        copy = h;
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(copy) == std::vector<int>{1, 2}));
+        copy = std::move(moved);
+        CPPUTILS_STDREIMPL_TEST_CHECK(&*copy.begin() == element && copy.size() == 6);
+
+        swap(copy, h);
+        CPPUTILS_STDREIMPL_TEST_CHECK(&*h.begin() == element && copy.size() == 2);
+
+        copy.clear();
+        CPPUTILS_STDREIMPL_TEST_CHECK(copy.empty() && copy.begin() == copy.end() && copy.capacity() != 0);
+        h.clear();
+        CPPUTILS_STDREIMPL_TEST_CHECK(Tracked::s_LiveCount == 0);
+    }
+
+    void TestOperations()
+    {
+        // Splicing keeps the elements where they are.
+        StdReimpl::hive<int> a = {1, 2, 3};
+        StdReimpl::hive<int> b = {4, 5, 6, 7};
+        b.erase(b.begin());
+        const int* spliced = &*b.begin();
+        a.splice(b);
+        CPPUTILS_STDREIMPL_TEST_CHECK(b.empty() && b.begin() == b.end() && a.size() == 6);
+        CPPUTILS_STDREIMPL_TEST_CHECK(&*a.get_iterator(spliced) == spliced && IteratesConsistently(a));
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(a) == std::vector<int>{1, 2, 3, 5, 6, 7}));
+
+        // Including the slots left unused in our last block, which later inserts fill.
+        for (int i = 0; i < 8; ++i)
+        {
+            a.insert(10 + i);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(a.size() == 14 && IteratesConsistently(a));
+        b.insert(20);
+        a.splice(std::move(b));
+        CPPUTILS_STDREIMPL_TEST_CHECK(a.size() == 15 && ToSortedInts(a).back() == 20);
+
+        bool threw = false;
+        StdReimpl::hive<int> small(StdReimpl::hive_limits(1, 2));
+        try
+        {
+            small.splice(a);
+        }
+        catch (const std::length_error&)
+        {
+            threw = true;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(threw && small.empty() && a.size() == 15);
+
+        a.sort();
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::is_sorted(a.begin(), a.end()) && a.size() == 15);
+        a.sort(std::greater<int>());
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::is_sorted(a.begin(), a.end(), std::greater<int>()));
+
+        StdReimpl::hive<int> duplicates = {1, 1, 2, 2, 2, 3, 1, 1};
+        CPPUTILS_STDREIMPL_TEST_CHECK(duplicates.unique() == 4);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(duplicates) == std::vector<int>{1, 2, 3, 1}));
+
+        const StdReimpl::hive<int>& constant = duplicates;
+        const int* second = &*std::next(constant.begin());
+        CPPUTILS_STDREIMPL_TEST_CHECK(constant.get_iterator(second) == std::next(constant.cbegin()));
+        const int outside = 0;
+        CPPUTILS_STDREIMPL_TEST_CHECK(constant.get_iterator(&outside) == constant.end());
+    }
+
+    /**
+     * @brief A throwing constructor leaves the hive as it was, whether the element was to go in an erased slot or a new
+     *        block.
+     */
+    void TestExceptionSafety()
+    {
+        StdReimpl::hive<Tracked> h(StdReimpl::hive_limits(4, 4));
+        for (int i = 0; i < 8; ++i)
+        {
+            h.emplace(i);
+        }
+        h.erase(std::next(h.begin()));
+
+        for (int attempt = 0; attempt < 2; ++attempt)
+        {
+            const std::vector<int> before = ToInts(h);
+            Tracked::s_ThrowOnConstruct = true;
+            bool threw = false;
+            try
+            {
+                h.emplace(100);
+            }
+            catch (const std::runtime_error&)
+            {
+                threw = true;
+            }
+            Tracked::s_ThrowOnConstruct = false;
+            CPPUTILS_STDREIMPL_TEST_CHECK(threw && ToInts(h) == before && IteratesConsistently(h));
+
+            // Fills the erased slot, so that the second attempt needs a new block.
+            h.emplace(200);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(h.size() == 9);
+        h.clear();
+        CPPUTILS_STDREIMPL_TEST_CHECK(Tracked::s_LiveCount == 0);
+    }
+
+    void TestAllocations()
+    {
+        StdReimpl::hive<int> h;
+
+        // Geometric growth allocates a block and its bookkeeping a logarithmic number of times.
+        const std::size_t growing = StdReimplTests::CountAllocations([&]
+        {
+            for (int i = 0; i < 10000; ++i)
+            {
+                h.insert(i);
+            }
+        });
+        CPPUTILS_STDREIMPL_TEST_CHECK(growing <= 2 * 15);
+
+        // Erasing and inserting reuses slots and blocks, without allocating.
+        const std::size_t churning = StdReimplTests::CountAllocations([&]
+        {
+            for (int round = 0; round < 5; ++round)
+            {
+                const std::size_t erased = StdReimpl::erase_if(h, [](int x) { return x % 5 != 0; });
+                h.insert(erased, round);
+                h.erase(h.begin(), h.end());
+                h.insert(10000, round);
+            }
+        });
+        CPPUTILS_STDREIMPL_TEST_CHECK(churning == 0);
+
+        StdReimpl::hive<int> reserved;
+        reserved.reserve(1000);
+        const std::size_t filling = StdReimplTests::CountAllocations([&]
+        {
+            for (int i = 0; i < 1000; ++i)
+            {
+                reserved.insert(i);
+            }
+        });
+        CPPUTILS_STDREIMPL_TEST_CHECK(filling == 0);
+    }
+}
+
+int main()
+{
+    TestBasics();
+    TestStability();
+    TestSkipfield();
+    TestAgainstReference();
+    TestCapacity();
+    TestCopyMoveSwap();
+    TestOperations();
+    TestExceptionSafety();
+    TestAllocations();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,67 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+// Names something from each of our headers through the module, so that a public name that the module forgets to export
+// fails to compile here.
+
+import CppUtils.StdReimpl;
+
+namespace
+{
+    int Twice(int x) noexcept
+    {
+        return 2 * x;
+    }
+
+    [[maybe_unused]] int UseFunctional()
+    {
+        StdReimpl::function_ref<int(int) noexcept> ref = StdReimpl::constant_arg<&Twice>;
+        StdReimpl::move_only_function<int(int)> owning = StdReimpl::bind_front<&Twice>();
+        StdReimpl::inplace_function<int(int)> inplace = StdReimpl::not_fn<&Twice>();
+        return ref(1) + owning(2) + inplace(3) + StdReimpl::invoke_r<int>(&Twice, 4);
+    }
+
+    [[maybe_unused]] int UseContainers()
+    {
+        StdReimpl::inplace_vector<int, 4> vector{1, 2, 3};
+        StdReimpl::erase(vector, 2);
+        StdReimpl::flat_map<int, int> map;
+        map.emplace(1, 2);
+        StdReimpl::flat_set<int> set{StdReimpl::sorted_unique, {1, 2}};
+        StdReimpl::erase_if(set, [](int x) { return x == 1; });
+        int storage[6] = {};
+        StdReimpl::mdspan<int, StdReimpl::dextents<int, 2>> span(storage, 2, 3);
+        StdReimpl::hive<int> hive(StdReimpl::hive_limits(4, 16));
+        StdReimpl::erase(hive, *hive.insert(1));
+        return static_cast<int>(vector.size() + map.size() + set.size() + hive.size()) + span.extent(1);
+    }
+
+    [[maybe_unused]] int UseVocabularyTypes()
+    {
+        StdReimpl::expected<int, int> value = StdReimpl::unexpected(1);
+        StdReimpl::chars_format format = StdReimpl::chars_format::fixed | StdReimpl::chars_format::scientific;
+        char buffer[32];
+        StdReimpl::to_chars_result result = StdReimpl::to_chars(buffer, buffer + sizeof(buffer), 1.5);
+        StdReimpl::format_to_n_result<char*> formatted = StdReimpl::format_to_n(buffer, sizeof(buffer), "{} {}", value.error_or(0), 2);
+        return static_cast<int>(format == StdReimpl::chars_format::general) + static_cast<int>(result.ptr - buffer) + static_cast<int>(formatted.size);
+    }
+
+    [[maybe_unused]] int UseNumerics()
+    {
+        StdReimpl::native_simd<float> lanes = 1.0f;
+        const int values[] = {1, 2, 3};
+        return StdReimpl::popcount(7u) + StdReimpl::bit_width(8u) + StdReimpl::reduce(StdReimpl::execution::seq, values, values + 3)
+            + static_cast<int>(StdReimpl::reduce(lanes)) + static_cast<int>(StdReimpl::fabs(-1.0));
+    }
+
+    [[maybe_unused]] int UseConcurrency()
+    {
+        StdReimpl::pmr::monotonic_buffer_resource resource;
+        StdReimpl::pmr::polymorphic_allocator<int> allocator(&resource);
+        StdReimpl::stop_source source;
+        StdReimpl::latch latch(0);
+        StdReimpl::binary_semaphore semaphore(1);
+        auto [sum] = StdReimpl::this_thread::sync_wait(StdReimpl::execution::just(1) | StdReimpl::execution::then([](int x) { return x + 1; })).value();
+        return static_cast<int>(allocator == allocator) + static_cast<int>(source.stop_possible()) + static_cast<int>(latch.try_wait())
+            + static_cast<int>(semaphore.try_acquire()) + sum;
+    }
+}
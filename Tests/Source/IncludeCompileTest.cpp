@@ -1,3 +1,28 @@
 // Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
 
+#include <CppUtils/StdReimpl/algorithm.h>
+#include <CppUtils/StdReimpl/atomic.h>
+#include <CppUtils/StdReimpl/barrier.h>
+#include <CppUtils/StdReimpl/bit.h>
+#include <CppUtils/StdReimpl/charconv.h>
+#include <CppUtils/StdReimpl/cmath.h>
 #include <CppUtils/StdReimpl/concepts.h>
+#include <CppUtils/StdReimpl/cstdlib.h>
+#include <CppUtils/StdReimpl/execution.h>
+#include <CppUtils/StdReimpl/expected.h>
+#include <CppUtils/StdReimpl/flat_map.h>
+#include <CppUtils/StdReimpl/flat_set.h>
+#include <CppUtils/StdReimpl/flat_tree.h>
+#include <CppUtils/StdReimpl/format.h>
+#include <CppUtils/StdReimpl/functional.h>
+#include <CppUtils/StdReimpl/generator.h>
+#include <CppUtils/StdReimpl/hive.h>
+#include <CppUtils/StdReimpl/inplace_vector.h>
+#include <CppUtils/StdReimpl/latch.h>
+#include <CppUtils/StdReimpl/mdspan.h>
+#include <CppUtils/StdReimpl/memory_resource.h>
+#include <CppUtils/StdReimpl/numeric.h>
+#include <CppUtils/StdReimpl/semaphore.h>
+#include <CppUtils/StdReimpl/simd.h>
+#include <CppUtils/StdReimpl/stop_token.h>
+#include <CppUtils/StdReimpl/thread.h>
@@ -0,0 +1,130 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/functional.h>
+
+#include "AllocationCounter.h"
+#include "TestCheck.h"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+    using StdReimplTests::CountAllocations;
+
+    struct alignas(32) OverAligned
+    {
+        int operator()() const
+        {
+            return 32;
+        }
+    };
+
+    struct CopyCounter
+    {
+        static inline int copyCount = 0;
+        static inline int liveCount = 0;
+
+        CopyCounter() { ++liveCount; }
+        CopyCounter(const CopyCounter&) { ++copyCount; ++liveCount; }
+        CopyCounter(CopyCounter&&) noexcept { ++liveCount; }
+        ~CopyCounter() { --liveCount; }
+
+        int operator()(int x) const
+        {
+            return x + 1;
+        }
+    };
+
+    // The storage is fixed at compile time: the buffer plus the table pointer.
+    static_assert(sizeof(StdReimpl::inplace_function<void(), 32, 8>) == 32 + sizeof(void*));
+    static_assert(sizeof(StdReimpl::inplace_function<void(), 64, 8>) == 64 + sizeof(void*));
+    static_assert(alignof(StdReimpl::inplace_function<void(), 64, 32>) == 32);
+
+    static_assert(std::is_copy_constructible_v<StdReimpl::inplace_function<void()>>);
+    static_assert(std::is_nothrow_move_constructible_v<StdReimpl::inplace_function<void()>>);
+    static_assert(std::is_nothrow_invocable_r_v<int, StdReimpl::inplace_function<int(int) noexcept>, int>);
+    static_assert(std::is_invocable_v<const StdReimpl::inplace_function<void() const>&>);
+    static_assert(!std::is_invocable_v<const StdReimpl::inplace_function<void()>&>);
+
+    void TestNeverAllocates()
+    {
+        const std::size_t allocations = CountAllocations([]()
+        {
+            std::array<char, 48> bigCapture{};
+            bigCapture[47] = 3;
+
+            StdReimpl::inplace_function<int(), 64> big = [bigCapture]() { return static_cast<int>(bigCapture[47]); };
+            CPPUTILS_STDREIMPL_TEST_CHECK(big() == 3);
+
+            StdReimpl::inplace_function<int(), 64> copy = big;
+            CPPUTILS_STDREIMPL_TEST_CHECK(copy() == 3);
+
+            StdReimpl::inplace_function<int(), 64> moved = std::move(big);
+            CPPUTILS_STDREIMPL_TEST_CHECK(moved() == 3);
+
+            StdReimpl::inplace_function<int(), 32, 32> overAligned = OverAligned{};
+            CPPUTILS_STDREIMPL_TEST_CHECK(overAligned() == 32);
+        });
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(allocations == 0);
+    }
+
+    void TestCopySemantics()
+    {
+        {
+            StdReimpl::inplace_function<int(int) const> original = CopyCounter{};
+            CPPUTILS_STDREIMPL_TEST_CHECK(CopyCounter::copyCount == 0);
+
+            StdReimpl::inplace_function<int(int) const> copy = original;
+            CPPUTILS_STDREIMPL_TEST_CHECK(CopyCounter::copyCount == 1);
+            CPPUTILS_STDREIMPL_TEST_CHECK(CopyCounter::liveCount == 2);
+            CPPUTILS_STDREIMPL_TEST_CHECK(original(1) == 2);
+            CPPUTILS_STDREIMPL_TEST_CHECK(copy(2) == 3);
+
+            copy = nullptr;
+            CPPUTILS_STDREIMPL_TEST_CHECK(CopyCounter::liveCount == 1);
+
+            copy = original;
+            CPPUTILS_STDREIMPL_TEST_CHECK(CopyCounter::copyCount == 2);
+
+            // Copying onto ourself must keep the callable.
+            copy = std::as_const(copy);
+            CPPUTILS_STDREIMPL_TEST_CHECK(copy(0) == 1);
+        }
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(CopyCounter::liveCount == 0);
+
+        // Non-trivial callables are copied through their copy constructor.
+        StdReimpl::inplace_function<std::size_t(), 64> withString = [text = std::string("hello")]() { return text.size(); };
+        StdReimpl::inplace_function<std::size_t(), 64> withStringCopy = withString;
+        withString = nullptr;
+        CPPUTILS_STDREIMPL_TEST_CHECK(withStringCopy() == 5);
+    }
+
+    void TestEmptyStates()
+    {
+        StdReimpl::inplace_function<void()> empty;
+        CPPUTILS_STDREIMPL_TEST_CHECK(empty == nullptr);
+
+        StdReimpl::inplace_function<void()> emptyCopy = empty;
+        CPPUTILS_STDREIMPL_TEST_CHECK(!emptyCopy);
+
+        void (*nullFunction)() = nullptr;
+        StdReimpl::inplace_function<void()> fromNullFunction = nullFunction;
+        CPPUTILS_STDREIMPL_TEST_CHECK(!fromNullFunction);
+    }
+}
+
+int main()
+{
+    TestNeverAllocates();
+    TestCopySemantics();
+    TestEmptyStates();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,335 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/inplace_vector.h>
+
+#include "AllocationCounter.h"
+#include "TestCheck.h"
+
+#include <iterator>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    // Trivially copyable elements make a trivially copyable container, and the size is stored in the smallest type that
+    // fits `N`.
+    static_assert(std::is_trivially_copyable_v<StdReimpl::inplace_vector<int, 8>>);
+    static_assert(std::is_trivially_destructible_v<StdReimpl::inplace_vector<int, 8>>);
+    static_assert(sizeof(StdReimpl::inplace_vector<int, 8>) == 9 * sizeof(int));
+    static_assert(sizeof(StdReimpl::inplace_vector<char, 255>) == 256);
+    static_assert(!std::is_trivially_copyable_v<StdReimpl::inplace_vector<std::string, 8>>);
+    static_assert(std::is_trivially_copyable_v<StdReimpl::inplace_vector<std::string, 0>>);
+    static_assert(sizeof(StdReimpl::inplace_vector<std::string, 0>) <= 2);
+
+    static_assert(std::is_nothrow_move_constructible_v<StdReimpl::inplace_vector<std::string, 4>>);
+    static_assert(!std::is_copy_constructible_v<std::unique_ptr<int>> && std::is_move_constructible_v<StdReimpl::inplace_vector<std::unique_ptr<int>, 4>>);
+    static_assert(std::random_access_iterator<StdReimpl::inplace_vector<int, 4>::iterator>);
+    static_assert(std::ranges::contiguous_range<StdReimpl::inplace_vector<int, 4>>);
+
+    // Everything is usable in constant evaluation.
+    constexpr int ConstexprSum()
+    {
+        StdReimpl::inplace_vector<int, 8> v = {1, 2, 3};
+        v.push_back(4);
+        v.insert(v.begin(), 0);
+        v.erase(v.begin() + 2);
+        v.insert(v.end(), 2, 10);
+        StdReimpl::inplace_vector<int, 8> copy = v;
+        copy.pop_back();
+
+        int sum = 0;
+        for (int value : copy)
+        {
+            sum += value;
+        }
+        return sum + static_cast<int>(copy.size());
+    }
+    static_assert(ConstexprSum() == (0 + 1 + 3 + 4 + 10) + 5);
+
+    constexpr bool ConstexprCompare()
+    {
+        const StdReimpl::inplace_vector<int, 4> a = {1, 2, 3};
+        const StdReimpl::inplace_vector<int, 4> b = {1, 2, 4};
+        return a < b && a != b && a == StdReimpl::inplace_vector<int, 4>{1, 2, 3};
+    }
+    static_assert(ConstexprCompare());
+
+    /**
+     * @brief Counts live instances, so we can check every element gets destroyed exactly once.
+     */
+    struct Tracked
+    {
+        static inline int s_LiveCount = 0;
+
+        int value = 0;
+
+        Tracked(int inValue = 0)
+            : value(inValue)
+        {
+            ++s_LiveCount;
+        }
+        Tracked(const Tracked& other)
+            : value(other.value)
+        {
+            ++s_LiveCount;
+        }
+        Tracked(Tracked&& other) noexcept
+            : value(other.value)
+        {
+            other.value = -1;
+            ++s_LiveCount;
+        }
+        Tracked& operator=(const Tracked&) = default;
+        Tracked& operator=(Tracked&& other) noexcept
+        {
+            value = other.value;
+            other.value = -1;
+            return *this;
+        }
+        ~Tracked()
+        {
+            --s_LiveCount;
+        }
+
+        friend bool operator==(const Tracked& a, const Tracked& b)
+        {
+            return a.value == b.value;
+        }
+    };
+
+    template <class Vector>
+    std::vector<int> ToInts(const Vector& v)
+    {
+        std::vector<int> result;
+        for (const auto& element : v)
+        {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(element)>, Tracked>)
+            {
+                result.push_back(element.value);
+            }
+            else
+            {
+                result.push_back(static_cast<int>(element));
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Runs the same operations on trivially copyable elements (the `memmove` paths) and on `Tracked` (the general
+     *        paths), so both get the same coverage.
+     */
+    template <class T>
+    void TestModifiers()
+    {
+        StdReimpl::inplace_vector<T, 8> v;
+        CPPUTILS_STDREIMPL_TEST_CHECK(v.empty() && v.size() == 0 && v.capacity() == 8);
+
+        v.push_back(T(1));
+        v.emplace_back(3);
+        v.insert(v.begin() + 1, T(2));
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(v) == std::vector<int>{1, 2, 3}));
+
+        // Inserting one of our own elements.
+        v.insert(v.begin(), v.back());
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(v) == std::vector<int>{3, 1, 2, 3}));
+
+        v.insert(v.begin() + 2, 2, T(9));
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(v) == std::vector<int>{3, 1, 9, 9, 2, 3}));
+
+        const T extra[] = {T(7), T(8)};
+        auto inserted = v.insert(v.end() - 1, std::begin(extra), std::end(extra));
+        CPPUTILS_STDREIMPL_TEST_CHECK(inserted == v.begin() + 5);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(v) == std::vector<int>{3, 1, 9, 9, 2, 7, 8, 3}));
+
+        auto erased = v.erase(v.begin() + 1, v.begin() + 4);
+        CPPUTILS_STDREIMPL_TEST_CHECK(erased == v.begin() + 1);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(v) == std::vector<int>{3, 2, 7, 8, 3}));
+
+        v.erase(v.begin());
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(v) == std::vector<int>{2, 7, 8, 3}));
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::erase(v, T(3)) == 1);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::erase_if(v, [](const T& element) { return element == T(7); }) == 1);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(v) == std::vector<int>{2, 8}));
+
+        v.resize(4, T(5));
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(v) == std::vector<int>{2, 8, 5, 5}));
+        v.resize(1);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(v) == std::vector<int>{2}));
+
+        // Copy and assignment, growing and shrinking.
+        StdReimpl::inplace_vector<T, 8> other = {T(4), T(5), T(6)};
+        StdReimpl::inplace_vector<T, 8> copy = other;
+        CPPUTILS_STDREIMPL_TEST_CHECK(copy == other);
+        copy = v;
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(copy) == std::vector<int>{2}));
+        copy = other;
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(copy) == std::vector<int>{4, 5, 6}));
+        copy = std::move(v);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(copy) == std::vector<int>{2}));
+
+        copy.assign(3, T(1));
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(copy) == std::vector<int>{1, 1, 1}));
+        copy.assign({T(6), T(7)});
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(copy) == std::vector<int>{6, 7}));
+
+        copy.swap(other);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(copy) == std::vector<int>{4, 5, 6}));
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(other) == std::vector<int>{6, 7}));
+
+        const std::vector<T> range = {T(1), T(2)};
+        copy.append_range(range);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(copy) == std::vector<int>{4, 5, 6, 1, 2}));
+        copy.insert_range(copy.begin(), range);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(copy) == std::vector<int>{1, 2, 4, 5, 6, 1, 2}));
+
+        copy.clear();
+        CPPUTILS_STDREIMPL_TEST_CHECK(copy.empty());
+    }
+
+    template <class T>
+    void TestCapacity()
+    {
+        StdReimpl::inplace_vector<T, 3> v = {T(1), T(2), T(3)};
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(v.try_push_back(T(4)) == nullptr);
+        CPPUTILS_STDREIMPL_TEST_CHECK(v.try_emplace_back(4) == nullptr);
+
+        bool threw = false;
+        try
+        {
+            v.push_back(T(4));
+        }
+        catch (const std::bad_alloc&)
+        {
+            threw = true;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(threw);
+
+        // A failed insert has no effects.
+        threw = false;
+        v.pop_back();
+        const T extra[] = {T(8), T(9)};
+        try
+        {
+            v.insert(v.begin(), std::begin(extra), std::end(extra));
+        }
+        catch (const std::bad_alloc&)
+        {
+            threw = true;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(threw);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(v) == std::vector<int>{1, 2}));
+
+        threw = false;
+        try
+        {
+            static_cast<void>(v.at(2));
+        }
+        catch (const std::out_of_range&)
+        {
+            threw = true;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(threw);
+
+        // `try_append_range` stops when full, and tells us where.
+        const std::vector<T> range = {T(5), T(6), T(7)};
+        auto rest = v.try_append_range(range);
+        CPPUTILS_STDREIMPL_TEST_CHECK(rest == range.begin() + 1);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(v) == std::vector<int>{1, 2, 5}));
+    }
+
+    void TestInputIterators()
+    {
+        std::istringstream stream("1 2 3 4");
+        StdReimpl::inplace_vector<int, 8> v(std::istream_iterator<int>(stream), std::istream_iterator<int>{});
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(v) == std::vector<int>{1, 2, 3, 4}));
+
+        // Input iterators can't be counted up front, so running out of room has to undo what was appended.
+        std::istringstream tooLong("5 6 7 8 9");
+        StdReimpl::inplace_vector<Tracked, 6> tracked = {Tracked(0), Tracked(1)};
+        bool threw = false;
+        try
+        {
+            tracked.insert(tracked.begin(), std::istream_iterator<int>(tooLong), std::istream_iterator<int>{});
+        }
+        catch (const std::bad_alloc&)
+        {
+            threw = true;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(threw);
+        CPPUTILS_STDREIMPL_TEST_CHECK((ToInts(tracked) == std::vector<int>{0, 1}));
+    }
+
+    void TestLifetimes()
+    {
+        {
+            StdReimpl::inplace_vector<Tracked, 8> v = {Tracked(1), Tracked(2), Tracked(3)};
+            CPPUTILS_STDREIMPL_TEST_CHECK(Tracked::s_LiveCount == 3);
+
+            v.insert(v.begin(), Tracked(0));
+            v.erase(v.begin() + 1);
+            StdReimpl::inplace_vector<Tracked, 8> copy = v;
+            CPPUTILS_STDREIMPL_TEST_CHECK(Tracked::s_LiveCount == 6);
+
+            copy.resize(1);
+            CPPUTILS_STDREIMPL_TEST_CHECK(Tracked::s_LiveCount == 4);
+
+            // Moving leaves the moved-from elements in place.
+            StdReimpl::inplace_vector<Tracked, 8> moved = std::move(v);
+            CPPUTILS_STDREIMPL_TEST_CHECK(moved.size() == 3 && v.size() == 3);
+            CPPUTILS_STDREIMPL_TEST_CHECK(Tracked::s_LiveCount == 7);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(Tracked::s_LiveCount == 0);
+
+        StdReimpl::inplace_vector<std::unique_ptr<int>, 4> pointers;
+        pointers.push_back(std::make_unique<int>(1));
+        pointers.emplace(pointers.begin(), std::make_unique<int>(0));
+        StdReimpl::inplace_vector<std::unique_ptr<int>, 4> movedPointers = std::move(pointers);
+        CPPUTILS_STDREIMPL_TEST_CHECK(*movedPointers[0] == 0 && *movedPointers[1] == 1);
+    }
+
+    void TestNeverAllocates()
+    {
+        const std::size_t allocations = StdReimplTests::CountAllocations([]
+            {
+                StdReimpl::inplace_vector<int, 64> v;
+                for (int i = 0; i < 64; ++i)
+                {
+                    v.insert(v.begin() + (i / 2), i);
+                }
+                StdReimpl::inplace_vector<int, 64> copy = v;
+                copy.erase(copy.begin(), copy.begin() + 10);
+                static_cast<void>(copy);
+            });
+        CPPUTILS_STDREIMPL_TEST_CHECK(allocations == 0);
+    }
+
+    void TestZeroCapacity()
+    {
+        StdReimpl::inplace_vector<std::string, 0> v;
+        CPPUTILS_STDREIMPL_TEST_CHECK(v.empty() && v.begin() == v.end() && v.capacity() == 0);
+        CPPUTILS_STDREIMPL_TEST_CHECK(v.try_push_back("a") == nullptr);
+    }
+}
+
+int main()
+{
+    TestModifiers<int>();
+    TestModifiers<Tracked>();
+    TestCapacity<int>();
+    TestCapacity<Tracked>();
+    TestInputIterators();
+    TestLifetimes();
+    TestNeverAllocates();
+    TestZeroCapacity();
+    CPPUTILS_STDREIMPL_TEST_CHECK(Tracked::s_LiveCount == 0);
+
+    return StdReimplTests::GetExitCode();
+}
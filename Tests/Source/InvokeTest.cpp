@@ -0,0 +1,169 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/concepts.h>
+#include <CppUtils/StdReimpl/functional.h>
+
+#include "TestCheck.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+    struct Base
+    {
+        int value = 1;
+
+        constexpr int Get() const noexcept
+        {
+            return value;
+        }
+
+        constexpr int Add(int x)
+        {
+            value += x;
+            return value;
+        }
+
+        constexpr int MoveOut() &&
+        {
+            return value * 10;
+        }
+    };
+
+    struct Derived : Base
+    {
+    };
+
+    struct PrivateDerived : private Base
+    {
+    };
+
+    struct Throwing
+    {
+        int operator()(int x) const
+        {
+            return x;
+        }
+    };
+
+    struct Implicit
+    {
+        Implicit(int)
+        {
+        }
+    };
+
+    struct ExplicitOnly
+    {
+        explicit ExplicitOnly(int)
+        {
+        }
+    };
+
+    int Twice(int x) noexcept
+    {
+        return 2 * x;
+    }
+
+    /**
+     * @brief Checks that our fast paths agree with the standard traits, which always go through `std::invoke`.
+     */
+    template <class R, class F, class... Args>
+    constexpr bool AgreesWithStandard()
+    {
+        return StdReimpl::Detail::is_invocable_r_v<R, F, Args...> == std::is_invocable_r_v<R, F, Args...>
+            && StdReimpl::Detail::is_nothrow_invocable_r_v<R, F, Args...> == std::is_nothrow_invocable_r_v<R, F, Args...>
+            && StdReimpl::invocable<F, Args...> == std::is_invocable_v<F, Args...>;
+    }
+
+    // Plain calls.
+    static_assert(AgreesWithStandard<int, int (*)(int) noexcept, int>());
+    static_assert(AgreesWithStandard<long, int (&)(int) noexcept, short>());
+    static_assert(AgreesWithStandard<void, int (*)(int) noexcept, int>());
+    static_assert(AgreesWithStandard<int, int (*)(int) noexcept, std::string>());
+    static_assert(AgreesWithStandard<int, int (*)(int) noexcept>());
+    static_assert(AgreesWithStandard<int, Throwing, int>());
+    static_assert(AgreesWithStandard<const int&, Throwing&, int>());
+    static_assert(AgreesWithStandard<Implicit, int (*)(int) noexcept, int>());
+    static_assert(AgreesWithStandard<ExplicitOnly, int (*)(int) noexcept, int>());
+    static_assert(AgreesWithStandard<int, std::reference_wrapper<Throwing>, int>());
+
+    // Pointers to member functions, on objects, derived objects, pointers, smart pointers and reference_wrappers.
+    static_assert(AgreesWithStandard<int, int (Base::*)() const noexcept, const Base&>());
+    static_assert(AgreesWithStandard<int, int (Base::*)() const noexcept, Derived>());
+    static_assert(AgreesWithStandard<int, int (Base::*)() const noexcept, const Derived*>());
+    static_assert(AgreesWithStandard<int, int (Base::*)() const noexcept, std::unique_ptr<Derived>&>());
+    static_assert(AgreesWithStandard<int, int (Base::*)() const noexcept, std::reference_wrapper<Base>>());
+    static_assert(AgreesWithStandard<int, int (Base::*)() const noexcept, PrivateDerived&>());
+    static_assert(AgreesWithStandard<int, int (Base::*)() const noexcept, int>());
+    static_assert(AgreesWithStandard<int, int (Base::*)() const noexcept>());
+    static_assert(AgreesWithStandard<int, int (Base::*)(int), Base&, int>());
+    static_assert(AgreesWithStandard<int, int (Base::*)(int), const Base&, int>());
+    static_assert(AgreesWithStandard<int, int (Base::*)(int), Base*, std::string>());
+    static_assert(AgreesWithStandard<int, int (Base::*)() &&, Base>());
+    static_assert(AgreesWithStandard<int, int (Base::*)() &&, Base&>());
+    static_assert(AgreesWithStandard<int, int (Base::*)() &&, Base*>());
+    static_assert(AgreesWithStandard<void, int (Base::*)(int), Derived*, int>());
+
+    // Pointers to data members, which take no arguments besides the object.
+    static_assert(AgreesWithStandard<int&, int Base::*, Base&>());
+    static_assert(AgreesWithStandard<int&, int Base::*, Base>());
+    static_assert(AgreesWithStandard<int&&, int Base::*, Base>());
+    static_assert(AgreesWithStandard<int&, int Base::*, const Base&>());
+    static_assert(AgreesWithStandard<int&, int Base::*, Derived*>());
+    static_assert(AgreesWithStandard<long, int Base::*, std::shared_ptr<Base>>());
+    static_assert(AgreesWithStandard<int, int Base::*, std::reference_wrapper<Derived>>());
+    static_assert(AgreesWithStandard<int, int Base::*, Base&, int>());
+    static_assert(AgreesWithStandard<int, int Base::*>());
+
+    // `invoke_r` returns what INVOKE does, converted to `R`, and is as noexcept as the call.
+    static_assert(std::is_same_v<decltype(StdReimpl::invoke_r<int&>(&Base::value, std::declval<Derived&>())), int&>);
+    static_assert(noexcept(StdReimpl::invoke_r<int>(&Base::Get, std::declval<Base*>())));
+    static_assert(!noexcept(StdReimpl::invoke_r<int>(&Base::Add, std::declval<Base&>(), 1)));
+    static_assert(noexcept(StdReimpl::invoke_r<int>(&Twice, 1)));
+    static_assert(!noexcept(StdReimpl::invoke_r<int>(Throwing(), 1)));
+
+    constexpr int InvokeInConstantExpression()
+    {
+        Base base;
+        Derived derived;
+        StdReimpl::invoke_r<void>(&Base::Add, derived, 2);
+        StdReimpl::invoke_r<int&>(&Base::value, &base) = 5;
+        return StdReimpl::invoke_r<int>(&Base::Get, &derived) + StdReimpl::invoke_r<int>(&Base::value, base);
+    }
+    static_assert(InvokeInConstantExpression() == 8);
+
+    void TestInvokeR()
+    {
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::invoke_r<long>(&Twice, 3) == 6);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::invoke_r<int>(Throwing(), 4) == 4);
+
+        Derived derived;
+        const auto owner = std::make_unique<Derived>();
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::invoke_r<int>(&Base::Add, derived, 2) == 3);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::invoke_r<int>(&Base::Add, &derived, 2) == 5);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::invoke_r<int>(&Base::Add, owner, 4) == 5);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::invoke_r<int>(&Base::Add, std::ref(derived), 1) == 6);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::invoke_r<int>(&Base::MoveOut, Base()) == 10);
+
+        // Data members come out with the object's value category.
+        StdReimpl::invoke_r<int&>(&Base::value, derived) = 20;
+        CPPUTILS_STDREIMPL_TEST_CHECK(derived.value == 20);
+        StdReimpl::invoke_r<int&>(&Base::value, owner) = 30;
+        CPPUTILS_STDREIMPL_TEST_CHECK(owner->value == 30);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::invoke_r<int>(&Base::value, std::cref(derived)) == 20);
+        static_assert(std::is_same_v<StdReimpl::Detail::member_invoke_result_t<int Base::*, Base>, int&&>);
+        static_assert(std::is_same_v<StdReimpl::Detail::member_invoke_result_t<int Base::*, const Base*>, const int&>);
+    }
+}
+
+int main()
+{
+    TestInvokeR();
+
+    return StdReimplTests::GetExitCode();
+}
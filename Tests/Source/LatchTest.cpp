@@ -0,0 +1,101 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/latch.h>
+
+#include "TestCheck.h"
+
+#include <atomic>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    using StdReimpl::latch;
+
+    static_assert(latch::max() > 0);
+    static_assert(!std::is_copy_constructible_v<latch>);
+    static_assert(!std::is_copy_assignable_v<latch>);
+
+    void TestSingleThread()
+    {
+        latch done(3);
+        CPPUTILS_STDREIMPL_TEST_CHECK(!done.try_wait());
+        done.count_down();
+        done.count_down(2);
+        CPPUTILS_STDREIMPL_TEST_CHECK(done.try_wait());
+        done.wait();
+
+        // A latch that starts at zero is already open.
+        latch open(0);
+        CPPUTILS_STDREIMPL_TEST_CHECK(open.try_wait());
+        open.wait();
+
+        latch one(1);
+        one.arrive_and_wait();
+        CPPUTILS_STDREIMPL_TEST_CHECK(one.try_wait());
+    }
+
+    void TestThreads()
+    {
+        constexpr int ThreadCount = 8;
+
+        // The workers wait for the main thread to start them, and it waits for all of them to finish.
+        latch start(1);
+        latch finished(ThreadCount);
+        std::atomic<int> work{0};
+        bool startedTooEarly = false;
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < ThreadCount; ++t)
+        {
+            threads.emplace_back([&]()
+            {
+                start.wait();
+                work.fetch_add(1, std::memory_order_relaxed);
+                finished.count_down();
+            });
+        }
+
+        startedTooEarly = work.load() != 0;
+        start.count_down();
+        finished.wait();
+        CPPUTILS_STDREIMPL_TEST_CHECK(!startedTooEarly && work.load() == ThreadCount);
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // Every thread blocks in `arrive_and_wait` until the last one arrives.
+        latch rendezvous(ThreadCount);
+        std::atomic<int> arrived{0};
+        std::atomic<bool> leftEarly{false};
+        threads.clear();
+        for (int t = 0; t < ThreadCount; ++t)
+        {
+            threads.emplace_back([&]()
+            {
+                arrived.fetch_add(1);
+                rendezvous.arrive_and_wait();
+                if (arrived.load() != ThreadCount)
+                {
+                    leftEarly.store(true);
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(!leftEarly.load());
+    }
+}
+
+int main()
+{
+    TestSingleThread();
+    TestThreads();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,222 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/mdspan.h>
+
+#include "TestCheck.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    using StdReimpl::dextents;
+    using StdReimpl::dynamic_extent;
+    using StdReimpl::extents;
+    using StdReimpl::layout_left;
+    using StdReimpl::layout_right;
+    using StdReimpl::layout_stride;
+    using StdReimpl::mdspan;
+
+    // Static extents, and the empty layouts and accessors, take no storage.
+    static_assert(std::is_empty_v<extents<int, 4, 4>>);
+    static_assert(std::is_empty_v<layout_right::mapping<extents<int, 4, 4>>>);
+    static_assert(sizeof(extents<int, 4, dynamic_extent, 2>) == sizeof(int));
+    static_assert(sizeof(mdspan<float, extents<int, 4, 4>>) == sizeof(float*));
+    static_assert(sizeof(mdspan<float, dextents<int, 2>>) == sizeof(float*) + 2 * sizeof(int));
+    static_assert(sizeof(mdspan<float, dextents<int, 2>, layout_left, StdReimpl::aligned_accessor<float, 32>>) == sizeof(float*) + 2 * sizeof(int));
+    static_assert(std::is_trivially_copyable_v<mdspan<float, dextents<std::size_t, 3>>>);
+
+    static_assert(extents<int, 2, dynamic_extent>::rank() == 2 && extents<int, 2, dynamic_extent>::rank_dynamic() == 1);
+    static_assert(extents<int, 2, dynamic_extent>::static_extent(1) == dynamic_extent);
+    static_assert(std::is_same_v<dextents<short, 3>, extents<short, dynamic_extent, dynamic_extent, dynamic_extent>>);
+    static_assert(std::is_same_v<StdReimpl::dims<2>, dextents<std::size_t, 2>>);
+    static_assert(std::is_same_v<decltype(extents(1, 2)), dextents<std::size_t, 2>>);
+
+    // Conversions that can lose a static extent or narrow the index type are explicit.
+    static_assert(std::is_convertible_v<extents<int, 3>, dextents<int, 1>>);
+    static_assert(!std::is_convertible_v<dextents<int, 1>, extents<int, 3>>);
+    static_assert(std::is_constructible_v<extents<int, 3>, dextents<int, 1>>);
+    static_assert(!std::is_constructible_v<extents<int, 3>, extents<int, 4>>);
+    static_assert(!std::is_convertible_v<extents<std::int64_t, 3>, extents<int, 3>>);
+
+    // Deduction guides.
+    static_assert(std::is_same_v<decltype(mdspan(static_cast<int*>(nullptr), 2, 3)), mdspan<int, dextents<std::size_t, 2>>>);
+    static_assert(std::is_same_v<decltype(mdspan(static_cast<int*>(nullptr), extents<int, 2, 3>())), mdspan<int, extents<int, 2, 3>>>);
+    static_assert(std::is_same_v<decltype(mdspan(static_cast<int*>(nullptr), layout_left::mapping<extents<int, 2>>())),
+        mdspan<int, extents<int, 2>, layout_left>>);
+
+    constexpr int ConstantEvaluate()
+    {
+        int data[6] = {0, 1, 2, 3, 4, 5};
+        mdspan<int, extents<int, 2, 3>> m(data);
+        m(1, 2) = 10;
+        return m(0, 1) + m(1, 0) + data[5] + static_cast<int>(m.size());
+    }
+    static_assert(ConstantEvaluate() == 1 + 3 + 10 + 6);
+
+    void TestExtents()
+    {
+        const extents<int, 2, dynamic_extent, 4> e(3);
+        CPPUTILS_STDREIMPL_TEST_CHECK(e.extent(0) == 2 && e.extent(1) == 3 && e.extent(2) == 4);
+
+        // From all of the extents, and from only the dynamic ones.
+        const extents<int, 2, dynamic_extent, 4> all(2, 3, 4);
+        CPPUTILS_STDREIMPL_TEST_CHECK(all == e);
+        const std::array<std::size_t, 1> dynamic = {3};
+        CPPUTILS_STDREIMPL_TEST_CHECK((extents<int, 2, dynamic_extent, 4>(dynamic) == e));
+        std::array<int, 3> everything = {2, 3, 4};
+        CPPUTILS_STDREIMPL_TEST_CHECK((extents<int, 2, dynamic_extent, 4>(std::span(everything)) == e));
+
+        // Comparisons ignore which extents are static and the index type.
+        const dextents<std::size_t, 3> converted = e;
+        CPPUTILS_STDREIMPL_TEST_CHECK(converted == e && converted.extent(1) == 3);
+        CPPUTILS_STDREIMPL_TEST_CHECK(e != (extents<int, 2, 3>()));
+        CPPUTILS_STDREIMPL_TEST_CHECK((extents<int, 2, dynamic_extent, 4>(dextents<long, 3>(2, 5, 4)).extent(1) == 5));
+
+        const extents<int> scalar;
+        CPPUTILS_STDREIMPL_TEST_CHECK(scalar.rank() == 0 && scalar == extents<std::size_t>());
+    }
+
+    /**
+     * @brief Checks that every index maps to what hand-written stride math gives, for a 3D view.
+     */
+    template <class Mapping>
+    void CheckMapping(const Mapping& mapping, std::array<int, 3> strides)
+    {
+        const auto& e = mapping.extents();
+        for (int i = 0; i < e.extent(0); ++i)
+        {
+            for (int j = 0; j < e.extent(1); ++j)
+            {
+                for (int k = 0; k < e.extent(2); ++k)
+                {
+                    CPPUTILS_STDREIMPL_TEST_CHECK(mapping(i, j, k) == i * strides[0] + j * strides[1] + k * strides[2]);
+                }
+            }
+        }
+        for (std::size_t r = 0; r < 3; ++r)
+        {
+            CPPUTILS_STDREIMPL_TEST_CHECK(mapping.stride(r) == strides[r]);
+        }
+    }
+
+    void TestLayouts()
+    {
+        using Extents = extents<int, 2, dynamic_extent, 4>;
+        const Extents e(3);
+
+        const layout_right::mapping<Extents> right(e);
+        CheckMapping(right, {12, 4, 1});
+        CPPUTILS_STDREIMPL_TEST_CHECK(right.required_span_size() == 24 && right.is_exhaustive());
+
+        const layout_left::mapping<Extents> left(e);
+        CheckMapping(left, {1, 2, 6});
+        CPPUTILS_STDREIMPL_TEST_CHECK(left.required_span_size() == 24);
+
+        // A 2x3x4 block out of a 4x5x6 volume.
+        const layout_stride::mapping<Extents> strided(e, std::array<int, 3>{30, 6, 1});
+        CheckMapping(strided, {30, 6, 1});
+        CPPUTILS_STDREIMPL_TEST_CHECK(strided.required_span_size() == 30 + 2 * 6 + 3 + 1);
+        CPPUTILS_STDREIMPL_TEST_CHECK(!strided.is_exhaustive());
+
+        // Converting to `layout_stride` keeps the strides, and compares equal to the original.
+        const layout_stride::mapping<Extents> fromRight = right;
+        CheckMapping(fromRight, {12, 4, 1});
+        CPPUTILS_STDREIMPL_TEST_CHECK(fromRight == right && fromRight.is_exhaustive() && fromRight != strided);
+        const layout_stride::mapping<Extents> fromLeft(left);
+        CPPUTILS_STDREIMPL_TEST_CHECK(fromLeft == left && fromLeft != fromRight);
+        const layout_right::mapping<Extents> backToRight(fromRight);
+        CPPUTILS_STDREIMPL_TEST_CHECK(backToRight == right);
+
+        // The default `layout_stride` has `layout_right`'s strides.
+        CPPUTILS_STDREIMPL_TEST_CHECK((layout_stride::mapping<extents<int, 3, 5>>().strides() == std::array<int, 2>{5, 1}));
+
+        // For one dimension, `layout_left` and `layout_right` are the same.
+        const layout_left::mapping<dextents<int, 1>> line = layout_right::mapping<dextents<int, 1>>(dextents<int, 1>(7));
+        CPPUTILS_STDREIMPL_TEST_CHECK(line(6) == 6 && line.required_span_size() == 7);
+
+        // An extent of zero means there's nothing to map.
+        CPPUTILS_STDREIMPL_TEST_CHECK((layout_stride::mapping<dextents<int, 2>>(dextents<int, 2>(0, 3), std::array<int, 2>{1, 7}).required_span_size() == 0));
+    }
+
+    void TestMdspan()
+    {
+        std::vector<int> data(24);
+        std::iota(data.begin(), data.end(), 0);
+
+        mdspan m(data.data(), 2, 3, 4);
+        static_assert(std::is_same_v<decltype(m), mdspan<int, dextents<std::size_t, 3>>>);
+        CPPUTILS_STDREIMPL_TEST_CHECK(m.rank() == 3 && m.extent(1) == 3 && m.size() == 24 && !m.empty());
+        CPPUTILS_STDREIMPL_TEST_CHECK(m(1, 2, 3) == 23 && m(0, 1, 0) == 4);
+        CPPUTILS_STDREIMPL_TEST_CHECK((m[std::array<int, 3>{1, 0, 2}] == 14));
+        std::array<std::size_t, 3> index = {0, 2, 1};
+        CPPUTILS_STDREIMPL_TEST_CHECK(m[std::span(index)] == 9);
+#if defined(__cpp_multidimensional_subscript)
+        CPPUTILS_STDREIMPL_TEST_CHECK((m[1, 1, 1] == 17));
+#endif
+        m(0, 0, 0) = 100;
+        CPPUTILS_STDREIMPL_TEST_CHECK(data[0] == 100);
+        CPPUTILS_STDREIMPL_TEST_CHECK(m.is_exhaustive() && m.stride(0) == 12 && m.data_handle() == data.data());
+
+        // A column-major view of the same data, and a strided view of every other column.
+        const mdspan<int, extents<int, 4, 6>, layout_left> columns(data.data());
+        CPPUTILS_STDREIMPL_TEST_CHECK(columns(1, 0) == 1 && columns(0, 1) == 4 && columns(3, 5) == 23);
+        const mdspan<int, extents<int, 4, 3>, layout_stride> everyOther(data.data(),
+            layout_stride::mapping<extents<int, 4, 3>>(extents<int, 4, 3>(), std::array<int, 2>{1, 8}));
+        CPPUTILS_STDREIMPL_TEST_CHECK(everyOther(2, 1) == 10 && everyOther(3, 2) == 19 && !everyOther.is_exhaustive());
+
+        // Converting to a view of const, with dynamic extents.
+        const mdspan<const int, dextents<int, 2>, layout_left> view = columns;
+        CPPUTILS_STDREIMPL_TEST_CHECK(view.extent(0) == 4 && view(3, 5) == 23);
+
+        mdspan<int, dextents<int, 2>> empty;
+        CPPUTILS_STDREIMPL_TEST_CHECK(empty.empty() && empty.size() == 0 && empty.data_handle() == nullptr);
+        mdspan<int, dextents<int, 2>> other(data.data(), 2, 12);
+        swap(empty, other);
+        CPPUTILS_STDREIMPL_TEST_CHECK(empty.size() == 24 && other.empty());
+
+        int scalar = 5;
+        const mdspan<int, extents<int>> zero(&scalar);
+        CPPUTILS_STDREIMPL_TEST_CHECK(zero() == 5 && zero.size() == 1);
+    }
+
+    void TestAlignedAccessor()
+    {
+        alignas(32) float data[4 * 8] = {};
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::is_sufficiently_aligned<32>(data));
+        CPPUTILS_STDREIMPL_TEST_CHECK(!StdReimpl::is_sufficiently_aligned<32>(data + 1));
+
+        using Aligned = mdspan<float, extents<int, 4, 8>, layout_right, StdReimpl::aligned_accessor<float, 32>>;
+        const Aligned m(data);
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 8; ++j)
+            {
+                m(i, j) = static_cast<float>(i * 8 + j);
+            }
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(data[31] == 31.0f && data[9] == 9.0f);
+
+        // Less alignment converts implicitly, and to `default_accessor`.
+        const mdspan<float, extents<int, 4, 8>, layout_right, StdReimpl::aligned_accessor<float, 16>> lessAligned = m;
+        const mdspan<const float, extents<int, 4, 8>> unaligned = m;
+        CPPUTILS_STDREIMPL_TEST_CHECK(lessAligned(2, 3) == 19.0f && unaligned(3, 7) == 31.0f);
+        static_assert(!std::is_convertible_v<mdspan<float, extents<int, 4, 8>>, Aligned>);
+        static_assert(std::is_constructible_v<Aligned, mdspan<float, extents<int, 4, 8>>>);
+    }
+}
+
+int main()
+{
+    TestExtents();
+    TestLayouts();
+    TestMdspan();
+    TestAlignedAccessor();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,360 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/memory_resource.h>
+
+#include "TestCheck.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <set>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    namespace pmr = StdReimpl::pmr;
+
+    static_assert(std::is_same_v<pmr::polymorphic_allocator<>::value_type, std::byte>);
+    static_assert(!std::is_copy_constructible_v<pmr::monotonic_buffer_resource>);
+    static_assert(!std::is_copy_constructible_v<pmr::unsynchronized_pool_resource>);
+    static_assert(!std::is_copy_constructible_v<pmr::synchronized_pool_resource>);
+    static_assert(std::is_convertible_v<pmr::memory_resource*, pmr::polymorphic_allocator<int>>);
+
+    // Forwards to another resource, and keeps count of what is still allocated from it.
+    class CountingResource : public pmr::memory_resource
+    {
+    public:
+        explicit CountingResource(pmr::memory_resource* inUpstream = pmr::new_delete_resource())
+            : upstream(inUpstream)
+        {
+        }
+
+        int allocations = 0;
+        int live = 0;
+        std::size_t liveBytes = 0;
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            void* p = upstream->allocate(bytes, alignment);
+            ++allocations;
+            ++live;
+            liveBytes += bytes;
+            return p;
+        }
+
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+        {
+            --live;
+            liveBytes -= bytes;
+            upstream->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        pmr::memory_resource* upstream;
+    };
+
+    bool IsAligned(const void* p, std::size_t alignment)
+    {
+        return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+    }
+
+    void TestPolymorphicAllocator()
+    {
+        CountingResource resource;
+        {
+            std::vector<int, pmr::polymorphic_allocator<int>> values(&resource);
+            for (int i = 0; i < 100; ++i)
+            {
+                values.push_back(i);
+            }
+            CPPUTILS_STDREIMPL_TEST_CHECK(values.back() == 99 && resource.allocations > 0 && resource.live == 1);
+
+            // Copies of a container use the default resource, rather than the one that was copied.
+            const std::vector<int, pmr::polymorphic_allocator<int>> copy = values;
+            CPPUTILS_STDREIMPL_TEST_CHECK(copy.get_allocator().resource() == pmr::get_default_resource());
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(resource.live == 0);
+
+        // The allocator is passed on to elements that use one.
+        using string = std::basic_string<char, std::char_traits<char>, pmr::polymorphic_allocator<char>>;
+        {
+            std::vector<string, pmr::polymorphic_allocator<string>> strings(&resource);
+            strings.emplace_back("a long enough string to not fit in the small buffer");
+            CPPUTILS_STDREIMPL_TEST_CHECK(strings[0].get_allocator().resource() == &resource && resource.live == 2);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(resource.live == 0);
+
+        pmr::polymorphic_allocator<> allocator(&resource);
+        string* s = allocator.new_object<string>("a long enough string to not fit in the small buffer");
+        CPPUTILS_STDREIMPL_TEST_CHECK(s->get_allocator().resource() == &resource && resource.live == 2);
+        allocator.delete_object(s);
+        CPPUTILS_STDREIMPL_TEST_CHECK(resource.live == 0);
+
+        void* p = allocator.allocate_bytes(100, 64);
+        CPPUTILS_STDREIMPL_TEST_CHECK(IsAligned(p, 64));
+        allocator.deallocate_bytes(p, 100, 64);
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(allocator == pmr::polymorphic_allocator<int>(&resource));
+        CPPUTILS_STDREIMPL_TEST_CHECK(allocator != pmr::polymorphic_allocator<int>());
+
+        // A failed allocation throws.
+        bool threw = false;
+        try
+        {
+            static_cast<void>(pmr::polymorphic_allocator<int>(pmr::null_memory_resource()).allocate(1));
+        }
+        catch (const std::bad_alloc&)
+        {
+            threw = true;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(threw);
+
+        // Changing the default resource changes what default-constructed allocators use.
+        pmr::memory_resource* previous = pmr::set_default_resource(&resource);
+        CPPUTILS_STDREIMPL_TEST_CHECK(previous == pmr::new_delete_resource());
+        CPPUTILS_STDREIMPL_TEST_CHECK(pmr::polymorphic_allocator<int>().resource() == &resource);
+        pmr::set_default_resource(nullptr);
+        CPPUTILS_STDREIMPL_TEST_CHECK(pmr::get_default_resource() == pmr::new_delete_resource());
+    }
+
+    void TestMonotonicBufferResource()
+    {
+        CountingResource upstream;
+
+        // Allocations come from the initial buffer until it runs out.
+        alignas(std::max_align_t) std::byte buffer[256];
+        pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), &upstream);
+
+        void* a = arena.allocate(10, 1);
+        void* b = arena.allocate(8, 8);
+        CPPUTILS_STDREIMPL_TEST_CHECK(a == buffer && IsAligned(b, 8) && static_cast<std::byte*>(b) >= buffer + 10);
+        CPPUTILS_STDREIMPL_TEST_CHECK(upstream.allocations == 0);
+
+        void* c = arena.allocate(300, 32);
+        CPPUTILS_STDREIMPL_TEST_CHECK(IsAligned(c, 32) && upstream.live == 1);
+
+        // Deallocating does nothing.
+        arena.deallocate(c, 300, 32);
+        CPPUTILS_STDREIMPL_TEST_CHECK(upstream.live == 1);
+
+        // Releasing gives everything back, and starts over at the initial buffer.
+        arena.release();
+        CPPUTILS_STDREIMPL_TEST_CHECK(upstream.live == 0);
+        CPPUTILS_STDREIMPL_TEST_CHECK(arena.allocate(10, 1) == buffer);
+
+        // The buffers from upstream grow geometrically.
+        pmr::monotonic_buffer_resource growing(64, &upstream);
+        for (int i = 0; i < 100; ++i)
+        {
+            static_cast<void>(growing.allocate(64));
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(upstream.live < 10 && upstream.liveBytes >= 6400);
+
+        // Nothing goes upstream while it fits, so a null upstream makes sure of it.
+        pmr::monotonic_buffer_resource bounded(buffer, sizeof(buffer), pmr::null_memory_resource());
+        std::vector<int, pmr::polymorphic_allocator<int>> values(&bounded);
+        values.reserve(16);
+        bool threw = false;
+        try
+        {
+            values.reserve(1000);
+        }
+        catch (const std::bad_alloc&)
+        {
+            threw = true;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(threw && values.capacity() == 16);
+    }
+
+    template <class PoolResource>
+    void TestPoolResource()
+    {
+        CountingResource upstream;
+        {
+            PoolResource pool(pmr::pool_options{8, 512}, &upstream);
+            CPPUTILS_STDREIMPL_TEST_CHECK(pool.upstream_resource() == &upstream);
+            CPPUTILS_STDREIMPL_TEST_CHECK(pool.options().max_blocks_per_chunk == 8 && pool.options().largest_required_pool_block == 512);
+
+            // Freed blocks are reused.
+            void* a = pool.allocate(24);
+            pool.deallocate(a, 24);
+            void* b = pool.allocate(24);
+            CPPUTILS_STDREIMPL_TEST_CHECK(a == b);
+            pool.deallocate(b, 24);
+
+            // Blocks of all sizes are distinct and aligned, and allocating many doesn't go upstream for each of them.
+            std::vector<std::pair<void*, std::size_t>> blocks;
+            std::set<void*> unique;
+            for (std::size_t i = 0; i < 1000; ++i)
+            {
+                const std::size_t size = 1 + (i * 37) % 512;
+                const std::size_t alignment = std::size_t{1} << (i % 6);
+                void* p = pool.allocate(size, alignment);
+                CPPUTILS_STDREIMPL_TEST_CHECK(IsAligned(p, alignment));
+                static_cast<void>(std::fill_n(static_cast<unsigned char*>(p), size, static_cast<unsigned char>(i)));
+                blocks.emplace_back(p, size);
+                unique.insert(p);
+            }
+            CPPUTILS_STDREIMPL_TEST_CHECK(unique.size() == blocks.size() && upstream.allocations < 500);
+
+            for (std::size_t i = 0; i < blocks.size(); ++i)
+            {
+                const std::size_t alignment = std::size_t{1} << (i % 6);
+                CPPUTILS_STDREIMPL_TEST_CHECK(*static_cast<unsigned char*>(blocks[i].first) == static_cast<unsigned char>(i));
+                pool.deallocate(blocks[i].first, blocks[i].second, alignment);
+            }
+
+            // Allocations too big for any pool go straight upstream, and come straight back.
+            const int liveBefore = upstream.live;
+            void* big = pool.allocate(10000, 128);
+            CPPUTILS_STDREIMPL_TEST_CHECK(IsAligned(big, 128) && upstream.live == liveBefore + 1);
+            pool.deallocate(big, 10000, 128);
+            CPPUTILS_STDREIMPL_TEST_CHECK(upstream.live == liveBefore);
+
+            // Releasing gives back everything, even what is still allocated. The synchronized pool keeps the cache of the
+            // thread that used it.
+            static_cast<void>(pool.allocate(10000));
+            static_cast<void>(pool.allocate(16));
+            pool.release();
+            CPPUTILS_STDREIMPL_TEST_CHECK(upstream.live == (std::is_same_v<PoolResource, pmr::synchronized_pool_resource> ? 1 : 0));
+
+            // And the pool still works afterwards.
+            void* c = pool.allocate(16);
+            pool.deallocate(c, 16);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(upstream.live == 0);
+
+        // Options are rounded to what the pools can do.
+        const PoolResource defaulted(&upstream);
+        CPPUTILS_STDREIMPL_TEST_CHECK(defaulted.options().max_blocks_per_chunk > 0 && defaulted.options().largest_required_pool_block > 0);
+        const PoolResource rounded(pmr::pool_options{0, 1000}, &upstream);
+        CPPUTILS_STDREIMPL_TEST_CHECK(rounded.options().largest_required_pool_block == 1024);
+    }
+
+    void TestSynchronizedPoolResourceThreads()
+    {
+        CountingResource upstream;
+        {
+            pmr::synchronized_pool_resource pool(&upstream);
+
+            // Each thread allocates blocks that another thread frees, so that blocks move between the threads' caches
+            // through the depot.
+            constexpr int ThreadCount = 8;
+            constexpr int BlocksPerThread = 20000;
+            std::vector<std::vector<int*>> allocated(ThreadCount);
+
+            std::vector<std::thread> threads;
+            for (int t = 0; t < ThreadCount; ++t)
+            {
+                threads.emplace_back([&pool, &allocated, t]()
+                {
+                    for (int i = 0; i < BlocksPerThread; ++i)
+                    {
+                        int* p = static_cast<int*>(pool.allocate(sizeof(int) * (1 + i % 8), alignof(int)));
+                        *p = t * BlocksPerThread + i;
+                        allocated[static_cast<std::size_t>(t)].push_back(p);
+                    }
+                });
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+            threads.clear();
+
+            bool valuesIntact = true;
+            std::set<int*> unique;
+            for (int t = 0; t < ThreadCount; ++t)
+            {
+                for (int i = 0; i < BlocksPerThread; ++i)
+                {
+                    int* p = allocated[static_cast<std::size_t>(t)][static_cast<std::size_t>(i)];
+                    valuesIntact = valuesIntact && *p == t * BlocksPerThread + i;
+                    unique.insert(p);
+                }
+            }
+            CPPUTILS_STDREIMPL_TEST_CHECK(valuesIntact && unique.size() == ThreadCount * BlocksPerThread);
+
+            const int upstreamAllocations = upstream.allocations;
+            for (int t = 0; t < ThreadCount; ++t)
+            {
+                threads.emplace_back([&pool, &allocated, t]()
+                {
+                    const std::vector<int*>& blocks = allocated[static_cast<std::size_t>((t + 1) % ThreadCount)];
+                    for (int i = 0; i < BlocksPerThread; ++i)
+                    {
+                        pool.deallocate(blocks[static_cast<std::size_t>(i)], sizeof(int) * (1 + i % 8), alignof(int));
+                    }
+
+                    // Reallocating reuses freed blocks rather than going upstream.
+                    std::vector<void*> again;
+                    for (int i = 0; i < BlocksPerThread; ++i)
+                    {
+                        again.push_back(pool.allocate(sizeof(int) * (1 + i % 8), alignof(int)));
+                    }
+                    for (int i = 0; i < BlocksPerThread; ++i)
+                    {
+                        pool.deallocate(again[static_cast<std::size_t>(i)], sizeof(int) * (1 + i % 8), alignof(int));
+                    }
+                });
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+            CPPUTILS_STDREIMPL_TEST_CHECK(upstream.allocations - upstreamAllocations < ThreadCount * 4);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(upstream.live == 0);
+
+        // A thread that outlives the resource leaves its cache alone when it exits.
+        std::optional<pmr::synchronized_pool_resource> pool(std::in_place, &upstream);
+        bool allocated = false;
+        bool destroyed = false;
+        std::mutex mutex;
+        std::condition_variable condition;
+
+        std::thread survivor([&]()
+        {
+            pool->deallocate(pool->allocate(32), 32);
+
+            std::unique_lock<std::mutex> lock(mutex);
+            allocated = true;
+            condition.notify_all();
+            condition.wait(lock, [&]() { return destroyed; });
+        });
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [&]() { return allocated; });
+            pool.reset();
+            destroyed = true;
+            condition.notify_all();
+        }
+        survivor.join();
+        CPPUTILS_STDREIMPL_TEST_CHECK(upstream.live == 0);
+    }
+}
+
+int main()
+{
+    TestPolymorphicAllocator();
+    TestMonotonicBufferResource();
+    TestPoolResource<pmr::unsynchronized_pool_resource>();
+    TestPoolResource<pmr::synchronized_pool_resource>();
+    TestSynchronizedPoolResourceThreads();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,175 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/functional.h>
+
+#include "AllocationCounter.h"
+#include "TestCheck.h"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+    using StdReimplTests::CountAllocations;
+
+    int Twice(int x)
+    {
+        return 2 * x;
+    }
+
+    struct ThrowingMove
+    {
+        ThrowingMove() = default;
+        ThrowingMove(ThrowingMove&&) noexcept(false) {}
+
+        int operator()() const
+        {
+            return 1;
+        }
+    };
+
+    struct LifetimeCounter
+    {
+        static inline int liveCount = 0;
+
+        LifetimeCounter() { ++liveCount; }
+        LifetimeCounter(LifetimeCounter&&) noexcept { ++liveCount; }
+        ~LifetimeCounter() { --liveCount; }
+
+        void operator()() const {}
+    };
+
+    static_assert(!std::is_copy_constructible_v<StdReimpl::move_only_function<void()>>);
+    static_assert(std::is_nothrow_move_constructible_v<StdReimpl::move_only_function<void()>>);
+    static_assert(std::is_nothrow_invocable_v<StdReimpl::move_only_function<void() noexcept>>);
+    static_assert(!std::is_invocable_v<const StdReimpl::move_only_function<void()>&>);
+    static_assert(std::is_invocable_v<const StdReimpl::move_only_function<void() const>&>);
+    static_assert(std::is_invocable_v<StdReimpl::move_only_function<void() &&>>);
+    static_assert(!std::is_invocable_v<StdReimpl::move_only_function<void() &&>&>);
+    static_assert(std::is_invocable_v<StdReimpl::move_only_function<void() &>&>);
+    static_assert(!std::is_constructible_v<StdReimpl::move_only_function<void() const>, decltype([x = 0]() mutable { ++x; })>);
+    static_assert(!std::is_constructible_v<StdReimpl::move_only_function<void() noexcept>, decltype([]() {})>);
+
+    void TestInlineStorageDoesNotAllocate()
+    {
+        const std::size_t allocations = CountAllocations([]()
+        {
+            // A move-only capture, like a task handle.
+            auto owned = std::make_unique<int>(7);
+            const int* ownedAddress = owned.get();
+
+            std::size_t innerAllocations = CountAllocations([&]()
+            {
+                StdReimpl::move_only_function<int()> f = [p = std::move(owned)]() { return *p; };
+                CPPUTILS_STDREIMPL_TEST_CHECK(f() == 7);
+
+                // Moving must relocate the lambda without allocating or copying the pointee.
+                StdReimpl::move_only_function<int()> moved = std::move(f);
+                CPPUTILS_STDREIMPL_TEST_CHECK(!f);
+                CPPUTILS_STDREIMPL_TEST_CHECK(moved() == 7);
+
+                StdReimpl::move_only_function<int(int)> functionPointer = &Twice;
+                CPPUTILS_STDREIMPL_TEST_CHECK(functionPointer(4) == 8);
+
+                StdReimpl::move_only_function<int(int)> threePointers = [a = ownedAddress, b = ownedAddress, c = ownedAddress](int x) { return x + (a == b && b == c); };
+                CPPUTILS_STDREIMPL_TEST_CHECK(threePointers(1) == 2);
+            });
+
+            CPPUTILS_STDREIMPL_TEST_CHECK(innerAllocations == 0);
+        });
+
+        // Only `std::make_unique` allocates.
+        CPPUTILS_STDREIMPL_TEST_CHECK(allocations == 1);
+    }
+
+    void TestInlineCapacityIsConfigurable()
+    {
+        std::array<char, 64> bigCapture{};
+        bigCapture[63] = 5;
+        const auto bigLambda = [bigCapture]() { return static_cast<int>(bigCapture[63]); };
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(CountAllocations([&]() { StdReimpl::move_only_function<int()> f = bigLambda; CPPUTILS_STDREIMPL_TEST_CHECK(f() == 5); }) == 1);
+        CPPUTILS_STDREIMPL_TEST_CHECK(CountAllocations([&]() { StdReimpl::move_only_function<int(), 64> f = bigLambda; CPPUTILS_STDREIMPL_TEST_CHECK(f() == 5); }) == 0);
+
+        static_assert(sizeof(StdReimpl::move_only_function<int(), 64>) > sizeof(StdReimpl::move_only_function<int()>));
+    }
+
+    void TestThrowingMoveGoesToTheHeap()
+    {
+        // Relocation has to be noexcept, so a callable with a throwing move constructor is stored on the heap even though it fits.
+        CPPUTILS_STDREIMPL_TEST_CHECK(CountAllocations([]() { StdReimpl::move_only_function<int()> f = ThrowingMove{}; CPPUTILS_STDREIMPL_TEST_CHECK(f() == 1); }) == 1);
+    }
+
+    void TestEmptyStates()
+    {
+        StdReimpl::move_only_function<void()> defaultConstructed;
+        CPPUTILS_STDREIMPL_TEST_CHECK(!defaultConstructed);
+        CPPUTILS_STDREIMPL_TEST_CHECK(defaultConstructed == nullptr);
+
+        int (*nullFunction)(int) = nullptr;
+        StdReimpl::move_only_function<int(int)> fromNullFunction = nullFunction;
+        CPPUTILS_STDREIMPL_TEST_CHECK(fromNullFunction == nullptr);
+
+        StdReimpl::move_only_function<int(int) const> emptyOther;
+        StdReimpl::move_only_function<int(int)> fromEmptyOther = std::move(emptyOther);
+        CPPUTILS_STDREIMPL_TEST_CHECK(!fromEmptyOther);
+    }
+
+    void TestLifetimes()
+    {
+        {
+            StdReimpl::move_only_function<void()> a{std::in_place_type<LifetimeCounter>};
+            StdReimpl::move_only_function<void()> b = LifetimeCounter{};
+            CPPUTILS_STDREIMPL_TEST_CHECK(LifetimeCounter::liveCount == 2);
+
+            swap(a, b);
+            CPPUTILS_STDREIMPL_TEST_CHECK(LifetimeCounter::liveCount == 2);
+
+            a = nullptr;
+            CPPUTILS_STDREIMPL_TEST_CHECK(LifetimeCounter::liveCount == 1);
+
+            a = std::move(b);
+            CPPUTILS_STDREIMPL_TEST_CHECK(LifetimeCounter::liveCount == 1);
+            CPPUTILS_STDREIMPL_TEST_CHECK(a != nullptr);
+            CPPUTILS_STDREIMPL_TEST_CHECK(b == nullptr);
+        }
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(LifetimeCounter::liveCount == 0);
+    }
+
+    void TestQualifiers()
+    {
+        struct Overloaded
+        {
+            int operator()() & { return 1; }
+            int operator()() && { return 2; }
+            int operator()() const & { return 3; }
+            int operator()() const && { return 4; }
+        };
+
+        StdReimpl::move_only_function<int()> plain = Overloaded{};
+        StdReimpl::move_only_function<int() &&> rvalue = Overloaded{};
+        StdReimpl::move_only_function<int() const> constPlain = Overloaded{};
+        StdReimpl::move_only_function<int() const &&> constRvalue = Overloaded{};
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(plain() == 1);
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::move(rvalue)() == 2);
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::as_const(constPlain)() == 3);
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::move(std::as_const(constRvalue))() == 4);
+    }
+}
+
+int main()
+{
+    TestInlineStorageDoesNotAllocate();
+    TestInlineCapacityIsConfigurable();
+    TestThrowingMoveGoesToTheHeap();
+    TestEmptyStates();
+    TestLifetimes();
+    TestQualifiers();
+
+    return StdReimplTests::GetExitCode();
+}
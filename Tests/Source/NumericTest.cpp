@@ -0,0 +1,149 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/numeric.h>
+
+#include "TestCheck.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+    namespace ex = StdReimpl::execution;
+
+    // Sizes around the chunking thresholds, including ones too small to split.
+    constexpr std::size_t Sizes[] = {0, 1, 2, 3, 5, 64, 1000, 4099, 100003};
+
+    std::vector<std::int64_t> Values(std::size_t count)
+    {
+        std::vector<std::int64_t> values(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            values[i] = static_cast<std::int64_t>((i * 7919) % 1009) - 500;
+        }
+        return values;
+    }
+
+    // Has no default constructor, so the chunks' sums can't be default constructed.
+    struct Sum
+    {
+        explicit Sum(std::int64_t inValue)
+            : value(inValue)
+        {
+        }
+
+        std::int64_t value;
+    };
+
+    struct AddSums
+    {
+        Sum operator()(const Sum& a, const Sum& b) const
+        {
+            return Sum(a.value + b.value);
+        }
+
+        Sum operator()(const Sum& a, std::int64_t b) const
+        {
+            return Sum(a.value + b);
+        }
+
+        Sum operator()(std::int64_t a, const Sum& b) const
+        {
+            return Sum(a + b.value);
+        }
+
+        Sum operator()(std::int64_t a, std::int64_t b) const
+        {
+            return Sum(a + b);
+        }
+    };
+
+    template <class Policy>
+    void TestReduce(const Policy& policy)
+    {
+        for (std::size_t count : Sizes)
+        {
+            const std::vector<std::int64_t> values = Values(count);
+            const std::int64_t expected = std::accumulate(values.begin(), values.end(), std::int64_t{0});
+
+            CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::reduce(policy, values.begin(), values.end()) == expected);
+            CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::reduce(policy, values.begin(), values.end(), std::int64_t{10}) == expected + 10);
+            CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::reduce(policy, values.begin(), values.end(), Sum(1), AddSums()).value == expected + 1);
+
+            const std::int64_t squares = std::inner_product(values.begin(), values.end(), values.begin(), std::int64_t{0});
+            CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::transform_reduce(policy, values.begin(), values.end(), values.begin(), std::int64_t{0}) == squares);
+            CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::transform_reduce(policy, values.begin(), values.end(), values.begin(), std::int64_t{0},
+                std::plus<>(), std::minus<>()) == 0);
+            CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::transform_reduce(policy, values.begin(), values.end(), std::int64_t{0}, std::plus<>(),
+                [](std::int64_t i) { return i * i; }) == squares);
+        }
+    }
+
+    template <class Policy>
+    void TestInclusiveScan(const Policy& policy)
+    {
+        for (std::size_t count : Sizes)
+        {
+            const std::vector<std::int64_t> values = Values(count);
+            std::vector<std::int64_t> expected(count);
+            std::partial_sum(values.begin(), values.end(), expected.begin());
+
+            std::vector<std::int64_t> result(count);
+            const auto end = StdReimpl::inclusive_scan(policy, values.begin(), values.end(), result.begin());
+            CPPUTILS_STDREIMPL_TEST_CHECK(end == result.end() && result == expected);
+
+            // With an initial value, and in place.
+            result = values;
+            StdReimpl::inclusive_scan(policy, result.begin(), result.end(), result.begin(), std::plus<>(), std::int64_t{100});
+            CPPUTILS_STDREIMPL_TEST_CHECK(std::equal(result.begin(), result.end(), expected.begin(), [](std::int64_t a, std::int64_t b) { return a == b + 100; }));
+
+            // Not commutative: the maximum prefix, kept in order.
+            std::vector<std::int64_t> maximums(count);
+            StdReimpl::inclusive_scan(policy, values.begin(), values.end(), maximums.begin(), [](std::int64_t a, std::int64_t b) { return std::max(a, b); });
+            std::vector<std::int64_t> expectedMaximums(count);
+            std::partial_sum(values.begin(), values.end(), expectedMaximums.begin(), [](std::int64_t a, std::int64_t b) { return std::max(a, b); });
+            CPPUTILS_STDREIMPL_TEST_CHECK(maximums == expectedMaximums);
+
+            std::vector<Sum> sums(count, Sum(0));
+            StdReimpl::inclusive_scan(policy, values.begin(), values.end(), sums.begin(), AddSums(), Sum(0));
+            CPPUTILS_STDREIMPL_TEST_CHECK(std::equal(sums.begin(), sums.end(), expected.begin(), [](const Sum& a, std::int64_t b) { return a.value == b; }));
+        }
+    }
+
+    template <class Policy>
+    void TestPolicy(const Policy& policy)
+    {
+        TestReduce(policy);
+        TestInclusiveScan(policy);
+    }
+
+    void TestSequentialIterators()
+    {
+        const std::list<std::int64_t> values{1, 2, 3, 4};
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::reduce(ex::par, values.begin(), values.end()) == 10);
+
+        std::vector<std::int64_t> result(4);
+        StdReimpl::inclusive_scan(ex::par, values.begin(), values.end(), result.begin());
+        CPPUTILS_STDREIMPL_TEST_CHECK((result == std::vector<std::int64_t>{1, 3, 6, 10}));
+    }
+}
+
+int main()
+{
+    ex::static_thread_pool pool(4);
+    ex::static_thread_pool single(1);
+
+    TestPolicy(ex::seq);
+    TestPolicy(ex::unseq);
+    TestPolicy(ex::par);
+    TestPolicy(ex::par_unseq);
+    TestPolicy(ex::par.on(pool));
+    TestPolicy(ex::par_unseq.on(single));
+    TestSequentialIterators();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,212 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/functional.h>
+
+#include "AllocationCounter.h"
+#include "TestCheck.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    // `default_searcher` can be used in constant evaluation, where it doesn't use the SIMD filter.
+    constexpr bool TestConstantEvaluation()
+    {
+        constexpr std::string_view haystack = "the quick brown fox";
+        constexpr std::string_view pattern = "brown";
+        const StdReimpl::default_searcher searcher(pattern.begin(), pattern.end());
+        const auto [first, last] = searcher(haystack.begin(), haystack.end());
+        return first - haystack.begin() == 10 && last - first == 5;
+    }
+    static_assert(TestConstantEvaluation());
+
+    std::uint64_t Next(std::uint64_t& state)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    struct CaseInsensitiveEqual
+    {
+        bool operator()(char a, char b) const
+        {
+            const auto lower = [](char c) { return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c; };
+            return lower(a) == lower(b);
+        }
+    };
+
+    // Hashes the lower case letter, so that it agrees with `CaseInsensitiveEqual`.
+    struct CaseInsensitiveHash
+    {
+        std::size_t operator()(char c) const
+        {
+            return static_cast<std::size_t>(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c);
+        }
+    };
+
+    /**
+     * @brief Checks that every searcher finds the same match as `std::search`.
+     */
+    template <class Haystack, class Pattern, class Pred = std::equal_to<>, class Hash = std::hash<typename Pattern::value_type>>
+    bool SearchersAgree(const Haystack& haystack, const Pattern& pattern, Pred pred = Pred(), Hash hash = Hash())
+    {
+        const auto expected = std::search(haystack.begin(), haystack.end(), pattern.begin(), pattern.end(), pred);
+        auto expectedEnd = expected;
+        if (expected != haystack.end())
+        {
+            std::advance(expectedEnd, static_cast<std::ptrdiff_t>(pattern.size()));
+        }
+
+        const StdReimpl::default_searcher defaultSearcher(pattern.begin(), pattern.end(), pred);
+        const auto found = defaultSearcher(haystack.begin(), haystack.end());
+        bool agree = found.first == expected && found.second == expectedEnd;
+        agree = agree && std::search(haystack.begin(), haystack.end(), defaultSearcher) == expected;
+
+        if constexpr (std::random_access_iterator<typename Haystack::const_iterator>)
+        {
+            const StdReimpl::boyer_moore_searcher boyerMoore(pattern.begin(), pattern.end(), hash, pred);
+            const StdReimpl::boyer_moore_horspool_searcher horspool(pattern.begin(), pattern.end(), hash, pred);
+            agree = agree && boyerMoore(haystack.begin(), haystack.end()) == std::pair(expected, expectedEnd);
+            agree = agree && horspool(haystack.begin(), haystack.end()) == std::pair(expected, expectedEnd);
+            agree = agree && std::search(haystack.begin(), haystack.end(), boyerMoore) == expected;
+            agree = agree && std::search(haystack.begin(), haystack.end(), horspool) == expected;
+        }
+        return agree;
+    }
+
+    void TestSimple()
+    {
+        const std::string haystack = "abracadabra";
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(haystack, std::string("abra")));
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(haystack, std::string("cad")));
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(haystack, std::string("a")));
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(haystack, std::string("ra")));
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(haystack, std::string("abracadabra")));
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(haystack, std::string("abracadabrax")));
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(haystack, std::string("x")));
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(std::string(), std::string("x")));
+
+        // An empty pattern matches at the start.
+        const std::string empty;
+        const StdReimpl::boyer_moore_searcher boyerMoore(empty.begin(), empty.end());
+        CPPUTILS_STDREIMPL_TEST_CHECK(boyerMoore(haystack.begin(), haystack.end()) == std::pair(haystack.begin(), haystack.begin()));
+        const StdReimpl::default_searcher defaultSearcher(empty.begin(), empty.end());
+        CPPUTILS_STDREIMPL_TEST_CHECK(defaultSearcher(haystack.begin(), haystack.end()) == std::pair(haystack.begin(), haystack.begin()));
+    }
+
+    /**
+     * @brief Random haystacks over a small alphabet, so that there are plenty of partial matches, with patterns of
+     *        every length around the SIMD block sizes and the Boyer-Moore crossover.
+     */
+    template <class T>
+    void TestRandom(std::size_t alphabet)
+    {
+        std::uint64_t state = 0x9E3779B97F4A7C15 + alphabet;
+        bool agree = true;
+        for (int round = 0; round < 300; ++round)
+        {
+            std::vector<T> haystack(Next(state) % 600);
+            for (T& c : haystack)
+            {
+                c = static_cast<T>('a' + Next(state) % alphabet);
+            }
+            const std::size_t patternSize = 1 + Next(state) % 100;
+            std::vector<T> pattern(patternSize);
+            if (haystack.size() >= patternSize && Next(state) % 2 == 0)
+            {
+                // Taken from the haystack, so that it's found.
+                const std::size_t at = Next(state) % (haystack.size() - patternSize + 1);
+                std::copy_n(haystack.begin() + static_cast<std::ptrdiff_t>(at), patternSize, pattern.begin());
+            }
+            else
+            {
+                for (T& c : pattern)
+                {
+                    c = static_cast<T>('a' + Next(state) % alphabet);
+                }
+            }
+            agree = agree && SearchersAgree(haystack, pattern);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(agree);
+    }
+
+    void TestPredicates()
+    {
+        const std::string haystack = "GET /Index.HTML HTTP/1.1";
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(haystack, std::string("index.html"), CaseInsensitiveEqual(), CaseInsensitiveHash()));
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(haystack, std::string("http/"), CaseInsensitiveEqual(), CaseInsensitiveHash()));
+
+        const StdReimpl::boyer_moore_horspool_searcher searcher(haystack.begin() + 5, haystack.begin() + 10, CaseInsensitiveHash(), CaseInsensitiveEqual());
+        const std::string other = "see index for details";
+        CPPUTILS_STDREIMPL_TEST_CHECK(searcher(other.begin(), other.end()).first - other.begin() == 4);
+
+        // Long patterns, which the Boyer-Moore searchers skip through rather than filter.
+        std::string longHaystack;
+        for (int i = 0; i < 100; ++i)
+        {
+            longHaystack += "Log line " + std::to_string(i) + ": Connection Reset By Peer; ";
+        }
+        const std::string longPattern = "LOG LINE 77: CONNECTION RESET BY PEER; LOG LINE 78: CONNECTION RESET BY PEER; LOG";
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(longHaystack, longPattern, CaseInsensitiveEqual(), CaseInsensitiveHash()));
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(longHaystack, longPattern));
+    }
+
+    void TestOtherSequences()
+    {
+        const std::string text = "one two three two one";
+        const std::list<char> list(text.begin(), text.end());
+        const std::deque<char> deque(text.begin(), text.end());
+        const std::string pattern = "two";
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(list, std::list<char>(pattern.begin(), pattern.end())));
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(deque, std::deque<char>(pattern.begin(), pattern.end())));
+
+        const std::vector<std::byte> bytes = {std::byte{0}, std::byte{0xFF}, std::byte{0x80}, std::byte{0xFF}, std::byte{0x80}, std::byte{1}};
+        const std::vector<std::byte> bytePattern = {std::byte{0xFF}, std::byte{0x80}, std::byte{1}};
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(bytes, bytePattern));
+
+        const std::vector<int> ints = {1, 2, 3, 1000000, 2, 3, 1000000, 7};
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(ints, std::vector<int>{2, 3, 1000000, 7}));
+        CPPUTILS_STDREIMPL_TEST_CHECK(SearchersAgree(ints, std::vector<int>{3, 2}));
+    }
+
+    void TestNoAllocation()
+    {
+        const std::string haystack(4096, 'x');
+        const std::string pattern = "xxxxy";
+
+        bool notFound = false;
+        const std::size_t allocations = StdReimplTests::CountAllocations([&]
+            {
+                const StdReimpl::boyer_moore_horspool_searcher horspool(pattern.begin(), pattern.end());
+                const StdReimpl::default_searcher defaultSearcher(pattern.begin(), pattern.end());
+                notFound = horspool(haystack.begin(), haystack.end()).first == haystack.end() &&
+                    defaultSearcher(haystack.begin(), haystack.end()).first == haystack.end();
+            });
+        CPPUTILS_STDREIMPL_TEST_CHECK(notFound);
+        CPPUTILS_STDREIMPL_TEST_CHECK(allocations == 0);
+    }
+}
+
+int main()
+{
+    TestSimple();
+    TestRandom<char>(2);
+    TestRandom<char>(4);
+    TestRandom<unsigned char>(26);
+    TestRandom<char16_t>(3);
+    TestRandom<int>(2);
+    TestPredicates();
+    TestOtherSequences();
+    TestNoAllocation();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,132 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/semaphore.h>
+
+#include "TestCheck.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    using StdReimpl::binary_semaphore;
+    using StdReimpl::counting_semaphore;
+
+    static_assert(binary_semaphore::max() == 1);
+    static_assert(counting_semaphore<5>::max() == 5);
+    static_assert(counting_semaphore<>::max() >= 1000000);
+    static_assert(!std::is_copy_constructible_v<binary_semaphore>);
+    static_assert(!std::is_copy_assignable_v<binary_semaphore>);
+
+    void TestSingleThread()
+    {
+        counting_semaphore<4> semaphore(2);
+        CPPUTILS_STDREIMPL_TEST_CHECK(semaphore.try_acquire() && semaphore.try_acquire() && !semaphore.try_acquire());
+        semaphore.release(3);
+        semaphore.acquire();
+        semaphore.acquire();
+        semaphore.acquire();
+        CPPUTILS_STDREIMPL_TEST_CHECK(!semaphore.try_acquire());
+
+        // Timing out leaves the count alone.
+        const auto before = std::chrono::steady_clock::now();
+        CPPUTILS_STDREIMPL_TEST_CHECK(!semaphore.try_acquire_for(std::chrono::milliseconds(20)));
+        CPPUTILS_STDREIMPL_TEST_CHECK(std::chrono::steady_clock::now() - before >= std::chrono::milliseconds(20));
+        CPPUTILS_STDREIMPL_TEST_CHECK(!semaphore.try_acquire_until(std::chrono::system_clock::now() - std::chrono::seconds(1)));
+        semaphore.release();
+        CPPUTILS_STDREIMPL_TEST_CHECK(semaphore.try_acquire_for(std::chrono::seconds(0)));
+    }
+
+    void TestSignal()
+    {
+        // Two threads take turns, each signaling the other.
+        constexpr int Rounds = 2000;
+
+        binary_semaphore ping(0);
+        binary_semaphore pong(0);
+        int value = 0;
+        bool inOrder = true;
+
+        std::thread partner([&]()
+        {
+            for (int i = 0; i < Rounds; ++i)
+            {
+                ping.acquire();
+                value = 2 * i + 2;
+                pong.release();
+            }
+        });
+
+        for (int i = 0; i < Rounds; ++i)
+        {
+            value = 2 * i + 1;
+            ping.release();
+            pong.acquire();
+            inOrder = inOrder && value == 2 * i + 2;
+        }
+        partner.join();
+        CPPUTILS_STDREIMPL_TEST_CHECK(inOrder);
+
+        // A timed wait that is released in time succeeds.
+        binary_semaphore late(0);
+        std::thread releaser([&late]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            late.release();
+        });
+        CPPUTILS_STDREIMPL_TEST_CHECK(late.try_acquire_for(std::chrono::seconds(10)));
+        releaser.join();
+    }
+
+    void TestLimit()
+    {
+        // No more threads than the initial count ever hold the semaphore at once.
+        constexpr int ThreadCount = 8;
+        constexpr int Slots = 3;
+        constexpr int Rounds = 2000;
+
+        counting_semaphore<Slots> semaphore(Slots);
+        std::atomic<int> holders{0};
+        std::atomic<int> mostHolders{0};
+        std::atomic<int> acquisitions{0};
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < ThreadCount; ++t)
+        {
+            threads.emplace_back([&]()
+            {
+                for (int i = 0; i < Rounds; ++i)
+                {
+                    semaphore.acquire();
+                    const int now = holders.fetch_add(1) + 1;
+                    int most = mostHolders.load();
+                    while (now > most && !mostHolders.compare_exchange_weak(most, now))
+                    {
+                    }
+                    acquisitions.fetch_add(1, std::memory_order_relaxed);
+                    holders.fetch_sub(1);
+                    semaphore.release();
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(mostHolders.load() <= Slots && acquisitions.load() == ThreadCount * Rounds);
+        CPPUTILS_STDREIMPL_TEST_CHECK(semaphore.try_acquire() && semaphore.try_acquire() && semaphore.try_acquire() && !semaphore.try_acquire());
+    }
+}
+
+int main()
+{
+    TestSingleThread();
+    TestSignal();
+    TestLimit();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,270 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/simd.h>
+
+#include "TestCheck.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+// These run again with a wider native ABI forced by `CPPUTILS_STDREIMPL_SIMD_NATIVE_BYTES`, so that each width's code is
+// tested on any machine, since the compiler splits vectors wider than the target's registers.
+
+namespace
+{
+    namespace simd_abi = StdReimpl::simd_abi;
+
+    static_assert(StdReimpl::native_simd<float>::size() == CPPUTILS_STDREIMPL_SIMD_NATIVE_BYTES / sizeof(float));
+    static_assert(StdReimpl::native_simd<std::int8_t>::size() == CPPUTILS_STDREIMPL_SIMD_NATIVE_BYTES);
+    static_assert(StdReimpl::simd<double, simd_abi::scalar>::size() == 1);
+    static_assert(StdReimpl::fixed_size_simd<int, 3>::size() == 3);
+    static_assert(StdReimpl::simd_size_v<short, simd_abi::fixed_size<5>> == 5);
+    static_assert(StdReimpl::is_simd_v<StdReimpl::native_simd<int>> && !StdReimpl::is_simd_v<int>);
+    static_assert(StdReimpl::is_simd_mask_v<StdReimpl::native_simd_mask<int>> && !StdReimpl::is_simd_mask_v<bool>);
+    static_assert(StdReimpl::memory_alignment_v<StdReimpl::native_simd<float>> % alignof(float) == 0);
+#if defined(CPPUTILS_STDREIMPL_SIMD_USE_VECTOR_EXTENSIONS)
+    static_assert(StdReimpl::Detail::simd_storage<float, simd_abi::native<float>>::is_vector);
+    static_assert(StdReimpl::Detail::simd_storage<std::int8_t, simd_abi::fixed_size<16>>::is_vector);
+    static_assert(!StdReimpl::Detail::simd_storage<float, simd_abi::fixed_size<3>>::is_vector);
+#endif
+
+    // Only value preserving conversions are implicit.
+    static_assert(std::is_convertible_v<int, StdReimpl::native_simd<double>>);
+    static_assert(!std::is_convertible_v<double, StdReimpl::native_simd<float>>);
+    static_assert(std::is_convertible_v<StdReimpl::fixed_size_simd<float, 4>, StdReimpl::fixed_size_simd<double, 4>>);
+    static_assert(!std::is_convertible_v<StdReimpl::fixed_size_simd<double, 4>, StdReimpl::fixed_size_simd<float, 4>>);
+    static_assert(std::is_constructible_v<StdReimpl::fixed_size_simd<float, 4>, StdReimpl::fixed_size_simd<double, 4>>);
+
+    // Everything works during constant evaluation, on the element-wise path.
+    constexpr int ConstantEvaluated()
+    {
+        const StdReimpl::native_simd<int> a([](auto i) { return static_cast<int>(i) - 2; });
+        StdReimpl::native_simd<int> b = StdReimpl::abs(a) * 2 + 1;
+        StdReimpl::where(a < 0, b) = 100;
+
+        int out[StdReimpl::native_simd<int>::size()] = {};
+        b.copy_to(out, StdReimpl::element_aligned);
+        return out[0] + StdReimpl::reduce(b) + StdReimpl::reduce_max(a) + StdReimpl::reduce_count(a == 0) + StdReimpl::reduce_min_index(a > 0);
+    }
+
+    constexpr int ExpectedConstantEvaluated()
+    {
+        constexpr int size = static_cast<int>(StdReimpl::native_simd<int>::size());
+        int sum = 200;
+        for (int i = 2; i < size; ++i)
+        {
+            sum += (i - 2) * 2 + 1;
+        }
+        return 100 + sum + (size - 3) + 1 + 3;
+    }
+
+    static_assert(ConstantEvaluated() == ExpectedConstantEvaluated());
+    static_assert(StdReimpl::abs(StdReimpl::simd<double, simd_abi::scalar>(-2.5))[0] == 2.5);
+    static_assert(StdReimpl::all_of(StdReimpl::fixed_size_simd<float, 3>(1.0f) == 1.0f));
+
+    template <class T, class Abi>
+    void TestSimd()
+    {
+        using V = StdReimpl::simd<T, Abi>;
+        using M = typename V::mask_type;
+        constexpr std::size_t size = V::size();
+
+        T values[size];
+        T others[size];
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            values[i] = static_cast<T>(static_cast<int>(i % 11) - 5);
+            others[i] = static_cast<T>(static_cast<int>(i % 7) + 1);
+        }
+
+        const V x(values, StdReimpl::element_aligned);
+        const V y([&others](auto i) { return others[i]; });
+
+        // Loads, stores, and element access.
+        T stored[size];
+        x.copy_to(stored, StdReimpl::element_aligned);
+        bool loaded = true;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            loaded = loaded && stored[i] == values[i] && x[i] == values[i] && y[i] == others[i];
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(loaded);
+
+        alignas(StdReimpl::memory_alignment_v<V>) T aligned[size];
+        (x + y).copy_to(aligned, StdReimpl::vector_aligned);
+        CPPUTILS_STDREIMPL_TEST_CHECK(V(aligned, StdReimpl::vector_aligned)[size - 1] == static_cast<T>(values[size - 1] + others[size - 1]));
+
+        // Arithmetic and comparisons match the scalar operations.
+        const V sum = x + y;
+        const V difference = x - y;
+        const V product = x * y;
+        const V quotient = x / y;
+        const M less = x < y;
+        const M equal = x == V(T(0));
+        bool arithmetic = true;
+        std::size_t lessCount = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            arithmetic = arithmetic && sum[i] == static_cast<T>(values[i] + others[i]) && difference[i] == static_cast<T>(values[i] - others[i]) &&
+                product[i] == static_cast<T>(values[i] * others[i]) && quotient[i] == static_cast<T>(values[i] / others[i]) &&
+                less[i] == (values[i] < others[i]) && equal[i] == (values[i] == T(0));
+            lessCount += values[i] < others[i];
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(arithmetic);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::reduce_count(less) == static_cast<int>(lessCount));
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::all_of(less || !less) && StdReimpl::none_of(less && !less));
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::all_of((x != y) == !(x == y)));
+
+        if constexpr (StdReimpl::integral<T>)
+        {
+            const V remainder = x % y;
+            const V bits = (x & y) | (x ^ y);
+            bool integral = true;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                integral = integral && remainder[i] == static_cast<T>(values[i] % others[i]) && bits[i] == static_cast<T>(values[i] | others[i]) &&
+                    (~x)[i] == static_cast<T>(~values[i]);
+            }
+            CPPUTILS_STDREIMPL_TEST_CHECK(integral);
+            CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::all_of(((y << 1) >> 1) == y));
+        }
+
+        V counter = x;
+        ++counter;
+        counter--;
+        counter += 2;
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::all_of(counter == x + 2));
+
+        // Masked operations only touch the selected elements.
+        V masked = x;
+        StdReimpl::where(less, masked) = y;
+        StdReimpl::where(!less, masked) += T(1);
+        V divided = y;
+        StdReimpl::where(!equal, divided) /= x;
+        T scattered[size];
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            scattered[i] = T(42);
+        }
+        StdReimpl::where(less, x).copy_to(scattered, StdReimpl::element_aligned);
+        V gathered = y;
+        StdReimpl::where(!less, gathered).copy_from(values, StdReimpl::element_aligned);
+        bool where = true;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            const bool selected = values[i] < others[i];
+            where = where && masked[i] == (selected ? others[i] : static_cast<T>(values[i] + 1)) &&
+                scattered[i] == (selected ? values[i] : T(42)) && gathered[i] == (selected ? others[i] : values[i]) &&
+                divided[i] == (values[i] == T(0) ? others[i] : static_cast<T>(others[i] / values[i]));
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(where);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::all_of(StdReimpl::select(less, x, y) == StdReimpl::min(x, y) || x == y));
+
+        // Reductions.
+        T total = T(0);
+        T selectedTotal = T(0);
+        T smallest = values[0];
+        T largest = values[0];
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            total = static_cast<T>(total + values[i]);
+            selectedTotal = static_cast<T>(selectedTotal + (values[i] < others[i] ? values[i] : T(0)));
+            smallest = values[i] < smallest ? values[i] : smallest;
+            largest = largest < values[i] ? values[i] : largest;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::reduce(x) == total);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::reduce(x, less, std::plus<>()) == selectedTotal);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::reduce(V(T(1)), std::multiplies<>()) == T(1));
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::reduce_min(x) == smallest);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::reduce_max(x) == largest);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::reduce_max(x, M(false)) == std::numeric_limits<T>::lowest());
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::reduce_min_index(M(true)) == 0);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::reduce_max_index(M(true)) == static_cast<int>(size) - 1);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::reduce_count(M(true)) == static_cast<int>(size) && StdReimpl::none_of(M(false)));
+
+        // abs, min, max, and clamp.
+        const V clamped = StdReimpl::clamp(x, V(std::is_signed_v<T> ? T(-2) : T(0)), V(T(3)));
+        bool math = true;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            const T expectedAbs = values[i] < T(0) ? static_cast<T>(-values[i]) : values[i];
+            const T lo = std::is_signed_v<T> ? T(-2) : T(0);
+            const T expectedClamp = values[i] < lo ? lo : T(3) < values[i] ? T(3) : values[i];
+            if constexpr (StdReimpl::signed_integral<T> || StdReimpl::floating_point<T>)
+            {
+                math = math && StdReimpl::abs(x)[i] == expectedAbs;
+            }
+            math = math && StdReimpl::max(x, y)[i] == (values[i] < others[i] ? others[i] : values[i]) &&
+                clamped[i] == expectedClamp;
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(math);
+
+        // Masks round trip through memory.
+        bool flags[size];
+        less.copy_to(flags, StdReimpl::element_aligned);
+        CPPUTILS_STDREIMPL_TEST_CHECK(StdReimpl::all_of(M(flags, StdReimpl::element_aligned) == less));
+    }
+
+    template <class Abi>
+    void TestFloatingPointAbs()
+    {
+        using V = StdReimpl::simd<double, Abi>;
+        const double infinity = std::numeric_limits<double>::infinity();
+
+        const V x([infinity](auto i) { return i % 3 == 0 ? -0.0 : i % 3 == 1 ? -infinity : -std::numeric_limits<double>::quiet_NaN(); });
+        const V result = StdReimpl::abs(x);
+        bool exact = true;
+        for (std::size_t i = 0; i < V::size(); ++i)
+        {
+            exact = exact && !std::signbit(result[i]) && (i % 3 != 1 || result[i] == infinity) && (i % 3 != 2 || std::isnan(result[i]));
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(exact);
+    }
+
+    template <class T>
+    void TestAbis()
+    {
+        TestSimd<T, simd_abi::scalar>();
+        TestSimd<T, simd_abi::fixed_size<3>>();
+        TestSimd<T, simd_abi::fixed_size<8>>();
+        TestSimd<T, simd_abi::native<T>>();
+        TestSimd<T, simd_abi::fixed_size<64>>();
+    }
+
+    void TestConversions()
+    {
+        const StdReimpl::fixed_size_simd<float, 8> floats([](auto i) { return static_cast<float>(i) + 0.5f; });
+        const StdReimpl::fixed_size_simd<double, 8> doubles = floats;
+        const StdReimpl::fixed_size_simd<std::int32_t, 8> truncated(doubles);
+        bool converted = true;
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            converted = converted && doubles[i] == static_cast<double>(i) + 0.5 && truncated[i] == static_cast<std::int32_t>(i);
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(converted);
+
+        // Loads convert from other element types too.
+        const std::uint8_t bytes[8] = {1, 2, 3, 4, 250, 251, 252, 253};
+        const StdReimpl::fixed_size_simd<std::int32_t, 8> widened(bytes, StdReimpl::element_aligned);
+        CPPUTILS_STDREIMPL_TEST_CHECK(widened[0] == 1 && widened[7] == 253);
+    }
+}
+
+int main()
+{
+    TestAbis<float>();
+    TestAbis<double>();
+    TestAbis<std::int32_t>();
+    TestAbis<std::int8_t>();
+    TestAbis<std::uint16_t>();
+    TestAbis<std::int64_t>();
+    TestFloatingPointAbs<simd_abi::native<double>>();
+    TestFloatingPointAbs<simd_abi::fixed_size<5>>();
+    TestConversions();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,222 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/stop_token.h>
+
+#include "TestCheck.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    using StdReimpl::stop_callback;
+    using StdReimpl::stop_source;
+    using StdReimpl::stop_token;
+
+    struct Counter
+    {
+        void Increment() noexcept
+        {
+            ++count;
+        }
+
+        int count = 0;
+    };
+
+    static_assert(std::is_nothrow_default_constructible_v<stop_token>);
+    static_assert(std::is_nothrow_copy_constructible_v<stop_token>);
+    static_assert(sizeof(stop_token) == sizeof(void*));
+    static_assert(sizeof(stop_source) == sizeof(void*));
+    static_assert(!std::is_copy_constructible_v<stop_callback<void (*)()>>);
+    static_assert(!std::is_move_constructible_v<stop_callback<void (*)()>>);
+    static_assert(std::is_same_v<decltype(stop_callback(stop_token(), &std::abort))::callback_type, void (*)() noexcept>);
+
+    void TestSourceAndToken()
+    {
+        const stop_token empty;
+        CPPUTILS_STDREIMPL_TEST_CHECK(!empty.stop_possible() && !empty.stop_requested());
+
+        stop_source none(StdReimpl::nostopstate);
+        CPPUTILS_STDREIMPL_TEST_CHECK(!none.stop_possible() && !none.request_stop() && none.get_token() == empty);
+
+        stop_source source;
+        stop_token token = source.get_token();
+        CPPUTILS_STDREIMPL_TEST_CHECK(source.stop_possible() && token.stop_possible() && !token.stop_requested());
+        CPPUTILS_STDREIMPL_TEST_CHECK(token == source.get_token() && token != empty);
+
+        // Only the first request succeeds.
+        stop_source copy = source;
+        CPPUTILS_STDREIMPL_TEST_CHECK(copy == source && source.request_stop() && !copy.request_stop());
+        CPPUTILS_STDREIMPL_TEST_CHECK(token.stop_requested() && copy.stop_requested() && token.stop_possible());
+
+        // A stop can't be requested anymore once every source is gone.
+        std::optional<stop_source> lastSource(std::in_place);
+        const stop_token orphan = lastSource->get_token();
+        CPPUTILS_STDREIMPL_TEST_CHECK(orphan.stop_possible());
+        lastSource.reset();
+        CPPUTILS_STDREIMPL_TEST_CHECK(!orphan.stop_possible() && !orphan.stop_requested());
+
+        stop_token moved = std::move(token);
+        CPPUTILS_STDREIMPL_TEST_CHECK(moved.stop_requested() && !token.stop_possible());
+        swap(moved, token);
+        CPPUTILS_STDREIMPL_TEST_CHECK(token.stop_requested() && !moved.stop_possible());
+    }
+
+    void TestCallbacks()
+    {
+        stop_source source;
+        int calls = 0;
+
+        // Callbacks run in the order opposite to the one they were registered in, and each exactly once.
+        std::vector<int> order;
+        {
+            const stop_callback first(source.get_token(), [&order]() { order.push_back(1); });
+            const stop_callback second(source.get_token(), [&order]() { order.push_back(2); });
+            std::optional<stop_callback<std::function<void()>>> removed(std::in_place, source.get_token(), [&calls]() { ++calls; });
+            const stop_callback third(source.get_token(), [&order]() { order.push_back(3); });
+            removed.reset();
+
+            CPPUTILS_STDREIMPL_TEST_CHECK(source.request_stop() && order == std::vector<int>({3, 2, 1}) && calls == 0);
+        }
+
+        // A callback registered afterwards runs right away, on the registering thread.
+        const stop_callback late(source.get_token(), [&calls]() { ++calls; });
+        CPPUTILS_STDREIMPL_TEST_CHECK(calls == 1);
+
+        // Without a source left, a callback never runs.
+        std::optional<stop_source> gone(std::in_place);
+        const stop_token token = gone->get_token();
+        gone.reset();
+        {
+            const stop_callback never(token, [&calls]() { ++calls; });
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(calls == 1);
+
+        // `function_ref`, also bound to a `constant_arg`, is a callback type in itself.
+        Counter counter;
+        stop_source refSource;
+        {
+            const auto increment = [&counter]() noexcept { counter.Increment(); };
+            const stop_callback<StdReimpl::function_ref<void() noexcept>> byObject(refSource.get_token(), increment);
+            const stop_callback<StdReimpl::function_ref<void() noexcept>> byMember(refSource.get_token(),
+                StdReimpl::function_ref<void() noexcept>(StdReimpl::constant_arg<&Counter::Increment>, counter));
+            refSource.request_stop();
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(counter.count == 2);
+    }
+
+    void TestSelfDestruction()
+    {
+        // A callback may destroy the next one's `stop_callback`, and its own.
+        stop_source source;
+        std::optional<stop_callback<std::function<void()>>> second;
+        std::optional<stop_callback<std::function<void()>>> first;
+        int calls = 0;
+
+        second.emplace(source.get_token(), [&calls]() { ++calls; });
+        first.emplace(source.get_token(), [&]()
+        {
+            // Its own captures are gone once `first` is, so that comes last.
+            ++calls;
+            second.reset();
+            first.reset();
+        });
+
+        CPPUTILS_STDREIMPL_TEST_CHECK(source.request_stop() && calls == 1 && !first && !second);
+    }
+
+    void TestDestructionWaits()
+    {
+        // Destroying a `stop_callback` on another thread while its callback runs waits for the callback to return.
+        stop_source source;
+        std::atomic<bool> running{false};
+        std::atomic<bool> finished{false};
+        auto callback = std::make_unique<stop_callback<std::function<void()>>>(source.get_token(), [&]()
+        {
+            running.store(true);
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            finished.store(true);
+        });
+
+        std::thread requester([&source]() { source.request_stop(); });
+        while (!running.load())
+        {
+            std::this_thread::yield();
+        }
+        callback.reset();
+        CPPUTILS_STDREIMPL_TEST_CHECK(finished.load());
+        requester.join();
+    }
+
+    void TestConcurrentRegistration()
+    {
+        // Threads keep registering and deregistering callbacks while a stop is requested. Every callback that is
+        // registered when the request comes in runs exactly once, whether by the requester or by the registering thread.
+        constexpr int ThreadCount = 4;
+        constexpr int Rounds = 50;
+
+        for (int round = 0; round < Rounds; ++round)
+        {
+            stop_source source;
+            std::atomic<int> registered{0};
+            std::atomic<int> ran{0};
+            std::atomic<bool> wrong{false};
+
+            std::vector<std::thread> threads;
+            for (int t = 0; t < ThreadCount; ++t)
+            {
+                threads.emplace_back([&]()
+                {
+                    for (int i = 0; i < 200; ++i)
+                    {
+                        int calls = 0;
+                        {
+                            const stop_callback callback(source.get_token(), [&calls, &ran]()
+                            {
+                                ++calls;
+                                ran.fetch_add(1);
+                            });
+                            registered.fetch_add(1);
+                        }
+                        if (calls > 1)
+                        {
+                            wrong.store(true);
+                        }
+                    }
+                    // Registered after the request at the latest, so it has run by the end of its constructor.
+                    int lastCalls = 0;
+                    source.request_stop();
+                    const stop_callback last(source.get_token(), [&lastCalls]() { ++lastCalls; });
+                    if (lastCalls != 1)
+                    {
+                        wrong.store(true);
+                    }
+                });
+            }
+            source.request_stop();
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+            CPPUTILS_STDREIMPL_TEST_CHECK(!wrong.load() && ran.load() <= registered.load());
+        }
+    }
+}
+
+int main()
+{
+    TestSourceAndToken();
+    TestCallbacks();
+    TestSelfDestruction();
+    TestDestructionWaits();
+    TestConcurrentRegistration();
+
+    return StdReimplTests::GetExitCode();
+}
@@ -0,0 +1,35 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <cstdio>
+
+/**
+ * @brief A tiny check facility for our runtime tests, so that we don't need to depend on a test framework. Unlike
+ *        `assert`, checks are still evaluated in release builds.
+ */
+namespace StdReimplTests
+{
+    inline int& GetFailureCount()
+    {
+        static int failureCount = 0;
+        return failureCount;
+    }
+
+    inline void ReportFailure(const char* expression, const char* file, int line)
+    {
+        std::fprintf(stderr, "%s(%d): Check failed: %s\n", file, line, expression);
+        ++GetFailureCount();
+    }
+
+    /**
+     * @brief The value to return from a test's `main()`.
+     */
+    inline int GetExitCode()
+    {
+        return GetFailureCount() == 0 ? 0 : 1;
+    }
+}
+
+#define CPPUTILS_STDREIMPL_TEST_CHECK(expression) \
+    ((expression) ? static_cast<void>(0) : StdReimplTests::ReportFailure(#expression, __FILE__, __LINE__))
@@ -0,0 +1,94 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils/StdReimpl/thread.h>
+
+#include "TestCheck.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+    using StdReimpl::jthread;
+
+    static_assert(std::is_nothrow_default_constructible_v<jthread>);
+    static_assert(std::is_nothrow_move_constructible_v<jthread>);
+    static_assert(!std::is_copy_constructible_v<jthread>);
+
+    void TestStopOnDestruction()
+    {
+        // The thread is asked to stop and joined when its `jthread` goes away.
+        std::atomic<int> iterations{0};
+        bool stopped = false;
+        {
+            const jthread worker([&](StdReimpl::stop_token token, int step)
+            {
+                while (!token.stop_requested())
+                {
+                    iterations.fetch_add(step);
+                    std::this_thread::yield();
+                }
+                stopped = true;
+            }, 1);
+
+            while (iterations.load() == 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+        CPPUTILS_STDREIMPL_TEST_CHECK(stopped);
+    }
+
+    void TestWithoutToken()
+    {
+        int result = 0;
+        jthread worker([&result](int a, int b) { result = a + b; }, 2, 3);
+        CPPUTILS_STDREIMPL_TEST_CHECK(worker.joinable() && worker.get_id() != jthread::id());
+        worker.join();
+        CPPUTILS_STDREIMPL_TEST_CHECK(result == 5 && !worker.joinable());
+
+        // The stop state exists even though the function doesn't take a token.
+        CPPUTILS_STDREIMPL_TEST_CHECK(worker.get_stop_source().stop_possible() && worker.request_stop());
+        CPPUTILS_STDREIMPL_TEST_CHECK(worker.get_stop_token().stop_requested());
+    }
+
+    void TestStateAndMoves()
+    {
+        jthread empty;
+        CPPUTILS_STDREIMPL_TEST_CHECK(!empty.joinable() && !empty.get_stop_source().stop_possible() && !empty.get_stop_token().stop_possible());
+
+        // A callback registered on the thread's token runs when the stop is requested.
+        bool called = false;
+        jthread worker([](StdReimpl::stop_token token)
+        {
+            while (!token.stop_requested())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+        const StdReimpl::stop_callback callback(worker.get_stop_token(), [&called]() { called = true; });
+
+        jthread moved = std::move(worker);
+        CPPUTILS_STDREIMPL_TEST_CHECK(!worker.joinable() && !worker.get_stop_source().stop_possible() && moved.joinable());
+
+        swap(moved, empty);
+        CPPUTILS_STDREIMPL_TEST_CHECK(empty.joinable() && !moved.joinable());
+
+        // Assigning over a running thread stops and joins it.
+        empty = jthread();
+        CPPUTILS_STDREIMPL_TEST_CHECK(called && !empty.joinable());
+        CPPUTILS_STDREIMPL_TEST_CHECK(jthread::hardware_concurrency() == std::thread::hardware_concurrency());
+    }
+}
+
+int main()
+{
+    TestStopOnDestruction();
+    TestWithoutToken();
+    TestStateAndMoves();
+
+    return StdReimplTests::GetExitCode();
+}